@@ -363,6 +363,15 @@ try
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
 
+        ("graph_test",
+         bool_switch(&arg.graph_test)->default_value(false),
+         "Capture the timed calls into a hipGraph and time its launch")
+
+        ("device_memory_limit",
+         value<size_t>(&arg.device_memory_limit)->default_value(0),
+         "Device memory budget in bytes for streamed functions. 0 picks a budget which splits "
+         "the problem into several tiles")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
@@ -153,6 +153,30 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipblasComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipblasDoubleComplex* A, int* lda, int* info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -1759,6 +1783,74 @@ int cblas_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+// potri
+template <>
+int cblas_potri(char uplo, int n, float* A, int lda)
+{
+    int info;
+    spotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, double* A, int lda)
+{
+    int info;
+    dpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, hipblasComplex* A, int lda)
+{
+    int info;
+    cpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, hipblasDoubleComplex* A, int lda)
+{
+    int info;
+    zpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
 // tbmv
 template <>
 void cblas_tbmv<float>(hipblasFillMode_t  uplo,
@@ -2810,6 +2902,317 @@ void cblas_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
         C[i] = static_cast<int32_t>(C_double[i]);
 }
 
+// gemm epilogue
+template <typename T, typename Load, typename Store>
+void cblas_gemm_epilogue_helper(int                 m,
+                                int                 n,
+                                const T*            bias,
+                                hipblasActivation_t activation,
+                                double              scale,
+                                T*                  C,
+                                int                 ldc,
+                                T*                  aux,
+                                int                 ldaux,
+                                Load                load,
+                                Store               store)
+{
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < m; i++)
+        {
+            double x = load(C[i + size_t(j) * ldc]);
+            if(bias)
+                x += load(bias[i]);
+            if(aux)
+                aux[i + size_t(j) * ldaux] = store(x);
+
+            if(activation == HIPBLAS_ACTIVATION_RELU)
+                x = x > 0 ? x : 0;
+            else if(activation == HIPBLAS_ACTIVATION_GELU)
+                x = 0.5 * x * (1 + std::tanh(std::sqrt(2 / M_PI) * (x + 0.044715 * x * x * x)));
+
+            C[i + size_t(j) * ldc] = store(scale * x);
+        }
+    }
+}
+
+template <>
+void cblas_gemm_epilogue<hipblasHalf>(int                 m,
+                                      int                 n,
+                                      const hipblasHalf*  bias,
+                                      hipblasActivation_t activation,
+                                      double              scale,
+                                      hipblasHalf*        C,
+                                      int                 ldc,
+                                      hipblasHalf*        aux,
+                                      int                 ldaux)
+{
+    cblas_gemm_epilogue_helper(
+        m,
+        n,
+        bias,
+        activation,
+        scale,
+        C,
+        ldc,
+        aux,
+        ldaux,
+        [](hipblasHalf x) { return double(half_to_float(x)); },
+        [](double x) { return float_to_half(float(x)); });
+}
+
+template <>
+void cblas_gemm_epilogue<hipblasBfloat16>(int                    m,
+                                          int                    n,
+                                          const hipblasBfloat16* bias,
+                                          hipblasActivation_t    activation,
+                                          double                 scale,
+                                          hipblasBfloat16*       C,
+                                          int                    ldc,
+                                          hipblasBfloat16*       aux,
+                                          int                    ldaux)
+{
+    cblas_gemm_epilogue_helper(
+        m,
+        n,
+        bias,
+        activation,
+        scale,
+        C,
+        ldc,
+        aux,
+        ldaux,
+        [](hipblasBfloat16 x) { return double(float(x)); },
+        [](double x) { return hipblasBfloat16(float(x)); });
+}
+
+template <>
+void cblas_gemm_epilogue<float>(int                 m,
+                                int                 n,
+                                const float*        bias,
+                                hipblasActivation_t activation,
+                                double              scale,
+                                float*              C,
+                                int                 ldc,
+                                float*              aux,
+                                int                 ldaux)
+{
+    cblas_gemm_epilogue_helper(
+        m,
+        n,
+        bias,
+        activation,
+        scale,
+        C,
+        ldc,
+        aux,
+        ldaux,
+        [](float x) { return double(x); },
+        [](double x) { return float(x); });
+}
+
+template <>
+void cblas_gemm_epilogue<double>(int                 m,
+                                 int                 n,
+                                 const double*       bias,
+                                 hipblasActivation_t activation,
+                                 double              scale,
+                                 double*             C,
+                                 int                 ldc,
+                                 double*             aux,
+                                 int                 ldaux)
+{
+    cblas_gemm_epilogue_helper(
+        m,
+        n,
+        bias,
+        activation,
+        scale,
+        C,
+        ldc,
+        aux,
+        ldaux,
+        [](double x) { return x; },
+        [](double x) { return x; });
+}
+
+// gemm fp8
+// The FNUZ formats have no infinities and no negative zero; 0x80 is the only NaN. Of the OCP
+// formats, from HIP 6.3, E4M3 has no infinities and NaN in all bits of exponent and mantissa set,
+// and E5M2 the infinities and NaNs of IEEE 754
+static double fp8_to_double(uint8_t v, hipDataType type)
+{
+    bool e5m2 = type == HIP_R_8F_E5M2_FNUZ;
+    bool ocp  = false;
+#if HIP_VERSION >= 60300000
+    ocp  = type == HIP_R_8F_E4M3 || type == HIP_R_8F_E5M2;
+    e5m2 = e5m2 || type == HIP_R_8F_E5M2;
+#endif
+
+    int mantissa_bits = e5m2 ? 2 : 3;
+    int bias          = (e5m2 ? 16 : 8) - (ocp ? 1 : 0);
+    int exponent      = (v & 0x7f) >> mantissa_bits;
+    int mantissa      = v & ((1 << mantissa_bits) - 1);
+
+    if(!ocp && v == 0x80)
+        return std::numeric_limits<double>::quiet_NaN();
+    if(ocp && !e5m2 && (v & 0x7f) == 0x7f)
+        return std::numeric_limits<double>::quiet_NaN();
+    if(ocp && e5m2 && exponent == 0x1f)
+    {
+        if(mantissa)
+            return std::numeric_limits<double>::quiet_NaN();
+        return v & 0x80 ? -std::numeric_limits<double>::infinity()
+                        : std::numeric_limits<double>::infinity();
+    }
+
+    // subnormals have the exponent of the smallest normal, without the implicit bit
+    if(exponent)
+        mantissa |= 1 << mantissa_bits;
+    else
+        exponent = 1;
+
+    double x = std::ldexp(double(mantissa), exponent - bias - mantissa_bits);
+    return v & 0x80 ? -x : x;
+}
+
+template <typename T, typename Load, typename Store>
+void cblas_gemm_fp8_helper(hipblasOperation_t transA,
+                           hipblasOperation_t transB,
+                           int                m,
+                           int                n,
+                           int                k,
+                           float              alpha,
+                           const uint8_t*     A,
+                           hipDataType        a_type,
+                           int                lda,
+                           float              scale_a,
+                           const uint8_t*     B,
+                           hipDataType        b_type,
+                           int                ldb,
+                           float              scale_b,
+                           float              beta,
+                           T*                 C,
+                           int                ldc,
+                           Load               load,
+                           Store              store)
+{
+    size_t const sizeA = ((transA == HIPBLAS_OP_N) ? k : m) * size_t(lda);
+    size_t const sizeB = ((transB == HIPBLAS_OP_N) ? n : k) * size_t(ldb);
+    size_t const sizeC = n * size_t(ldc);
+
+    std::unique_ptr<double[]> A_double(new double[sizeA]());
+    std::unique_ptr<double[]> B_double(new double[sizeB]());
+    std::unique_ptr<double[]> C_double(new double[sizeC]());
+
+    for(size_t i = 0; i < sizeA; i++)
+        A_double[i] = scale_a * fp8_to_double(A[i], a_type);
+    for(size_t i = 0; i < sizeB; i++)
+        B_double[i] = scale_b * fp8_to_double(B[i], b_type);
+    for(size_t i = 0; i < sizeC; i++)
+        C_double[i] = load(C[i]);
+
+    cblas_dgemm(CblasColMajor,
+                static_cast<CBLAS_TRANSPOSE>(transA),
+                static_cast<CBLAS_TRANSPOSE>(transB),
+                m,
+                n,
+                k,
+                alpha,
+                A_double.get(),
+                lda,
+                B_double.get(),
+                ldb,
+                beta,
+                C_double.get(),
+                ldc);
+
+    for(size_t i = 0; i < sizeC; i++)
+        C[i] = store(C_double[i]);
+}
+
+template <>
+void cblas_gemm_fp8<hipblasBfloat16>(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     float              alpha,
+                                     const uint8_t*     A,
+                                     hipDataType        a_type,
+                                     int                lda,
+                                     float              scale_a,
+                                     const uint8_t*     B,
+                                     hipDataType        b_type,
+                                     int                ldb,
+                                     float              scale_b,
+                                     float              beta,
+                                     hipblasBfloat16*   C,
+                                     int                ldc)
+{
+    cblas_gemm_fp8_helper(
+        transA,
+        transB,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        scale_a,
+        B,
+        b_type,
+        ldb,
+        scale_b,
+        beta,
+        C,
+        ldc,
+        [](hipblasBfloat16 x) { return double(float(x)); },
+        [](double x) { return hipblasBfloat16(float(x)); });
+}
+
+template <>
+void cblas_gemm_fp8<float>(hipblasOperation_t transA,
+                           hipblasOperation_t transB,
+                           int                m,
+                           int                n,
+                           int                k,
+                           float              alpha,
+                           const uint8_t*     A,
+                           hipDataType        a_type,
+                           int                lda,
+                           float              scale_a,
+                           const uint8_t*     B,
+                           hipDataType        b_type,
+                           int                ldb,
+                           float              scale_b,
+                           float              beta,
+                           float*             C,
+                           int                ldc)
+{
+    cblas_gemm_fp8_helper(
+        transA,
+        transB,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        scale_a,
+        B,
+        b_type,
+        ldb,
+        scale_b,
+        beta,
+        C,
+        ldc,
+        [](float x) { return double(x); },
+        [](double x) { return float(x); });
+}
+
 // hemm
 template <>
 void cblas_hemm(hipblasSideMode_t side,
@@ -45,6 +45,8 @@
 // aux
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_matrix_strided_batched_async.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
 // blas1
@@ -52,6 +54,7 @@
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
 #include "testing_axpy.hpp"
+#include "testing_axpy_64.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
 #include "testing_axpy_ex.hpp"
@@ -61,6 +64,7 @@
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
+#include "testing_dot_64.hpp"
 #include "testing_dot_batched.hpp"
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
@@ -155,8 +159,11 @@
 #include "testing_tbmv_batched.hpp"
 #include "testing_tbmv_strided_batched.hpp"
 #include "testing_tbsv.hpp"
+#include "testing_tbsv_64.hpp"
 #include "testing_tbsv_batched.hpp"
 #include "testing_tbsv_strided_batched.hpp"
+#include "testing_packed_conversion.hpp"
+#include "testing_packed_mode.hpp"
 #include "testing_tpmv.hpp"
 #include "testing_tpmv_batched.hpp"
 #include "testing_tpmv_strided_batched.hpp"
@@ -175,11 +182,16 @@
 #include "testing_geam_batched.hpp"
 #include "testing_geam_strided_batched.hpp"
 #include "testing_gemm.hpp"
+#include "testing_gemm_64.hpp"
+#include "testing_gemm_3m.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_epilogue.hpp"
+#include "testing_gemm_ex_fp8.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_gemm_streamed.hpp"
 #include "testing_hemm.hpp"
 #include "testing_hemm_batched.hpp"
 #include "testing_hemm_strided_batched.hpp"
@@ -210,9 +222,13 @@
 #include "testing_trsm.hpp"
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
+#include "testing_trsm_cached.hpp"
 #include "testing_trsm_ex.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
+#include "testing_xt_gemm.hpp"
+#include "testing_xt_syrk.hpp"
+#include "testing_xt_trsm.hpp"
 #include "testing_trsv.hpp"
 #include "testing_trsv_batched.hpp"
 #include "testing_trsv_strided_batched.hpp"
@@ -227,6 +243,11 @@
 #include "testing_geqrf.hpp"
 #include "testing_geqrf_batched.hpp"
 #include "testing_geqrf_strided_batched.hpp"
+#include "testing_gesv_batched.hpp"
+#include "testing_gesv_mixed.hpp"
+#include "testing_gesv_mixed_batched.hpp"
+#include "testing_gesv_mixed_strided_batched.hpp"
+#include "testing_gesv_strided_batched.hpp"
 #include "testing_getrf.hpp"
 #include "testing_getrf_batched.hpp"
 #include "testing_getrf_npvt.hpp"
@@ -238,6 +259,15 @@
 #include "testing_getrs.hpp"
 #include "testing_getrs_batched.hpp"
 #include "testing_getrs_strided_batched.hpp"
+#include "testing_potrf.hpp"
+#include "testing_potrf_batched.hpp"
+#include "testing_potrf_strided_batched.hpp"
+#include "testing_potri.hpp"
+#include "testing_potri_batched.hpp"
+#include "testing_potri_strided_batched.hpp"
+#include "testing_potrs.hpp"
+#include "testing_potrs_batched.hpp"
+#include "testing_potrs_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -284,6 +314,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"axpy", testname_axpy},
         {"axpy_batched", testname_axpy_batched},
         {"axpy_strided_batched", testname_axpy_strided_batched},
+        {"axpy_64", testname_axpy_64},
         {"axpy_ex", testname_axpy_ex},
         {"axpy_batched_ex", testname_axpy_batched_ex},
         {"axpy_strided_batched_ex", testname_axpy_strided_batched_ex},
@@ -293,6 +324,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"dot", testname_dot},
         {"dot_batched", testname_dot_batched},
         {"dot_strided_batched", testname_dot_strided_batched},
+        {"dot_64", testname_dot_64},
         {"dotc", testname_dotc},
         {"dotc_batched", testname_dotc_batched},
         {"dotc_strided_batched", testname_dotc_strided_batched},
@@ -395,8 +427,11 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"tbmv_batched", testname_tbmv_batched},
         {"tbmv_strided_batched", testname_tbmv_strided_batched},
         {"tbsv", testname_tbsv},
+        {"tbsv_64", testname_tbsv_64},
         {"tbsv_batched", testname_tbsv_batched},
         {"tbsv_strided_batched", testname_tbsv_strided_batched},
+        {"packed_conversion", testname_packed_conversion},
+        {"packed_mode", testname_packed_mode},
         {"tpmv", testname_tpmv},
         {"tpmv_batched", testname_tpmv_batched},
         {"tpmv_strided_batched", testname_tpmv_strided_batched},
@@ -420,9 +455,14 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm", testname_gemm},
         {"gemm_batched", testname_gemm_batched},
         {"gemm_strided_batched", testname_gemm_strided_batched},
+        {"gemm_3m", testname_gemm_3m},
         {"gemm_ex", testname_gemm_ex},
+        {"gemm_ex_epilogue", testname_gemm_ex_epilogue},
+        {"gemm_ex_fp8", testname_gemm_ex_fp8},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+        {"gemm_streamed", testname_gemm_streamed},
+        {"gemm_64", testname_gemm_64},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
@@ -456,9 +496,13 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"trsm_ex", testname_trsm_ex},
         {"trsm_batched_ex", testname_trsm_batched_ex},
         {"trsm_strided_batched_ex", testname_trsm_strided_batched_ex},
+        {"trsm_cached", testname_trsm_cached},
         {"trtri", testname_trtri},
         {"trtri_batched", testname_trtri_batched},
         {"trtri_strided_batched", testname_trtri_strided_batched},
+        {"xt_gemm", testname_xt_gemm},
+        {"xt_syrk", testname_xt_syrk},
+        {"xt_trsm", testname_xt_trsm},
 
 #ifdef __HIP_PLATFORM_SOLVER__
         {"geqrf", testname_geqrf},
@@ -478,6 +522,20 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
+        {"gesv_mixed", testname_gesv_mixed},
+        {"gesv_mixed_batched", testname_gesv_mixed_batched},
+        {"gesv_mixed_strided_batched", testname_gesv_mixed_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
+        {"potri", testname_potri},
+        {"potri_batched", testname_potri_batched},
+        {"potri_strided_batched", testname_potri_strided_batched},
 #endif
 
         // Aux
@@ -485,6 +543,8 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"set_get_vector_async", testname_set_get_vector_async},
         {"set_get_matrix", testname_set_get_matrix},
         {"set_get_matrix_async", testname_set_get_matrix_async},
+        {"set_get_matrix_batched_async", testname_set_get_matrix_batched_async},
+        {"set_get_matrix_strided_batched_async", testname_set_get_matrix_strided_batched_async},
     };
 
     auto match = fmap.find(arg.function);
@@ -512,6 +572,7 @@ struct perf_gemm_ex<Ti,
     {
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_ex_epilogue", testing_gemm_ex_epilogue_template<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
@@ -562,12 +623,14 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"axpy", testing_axpy<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+            {"axpy_64", testing_axpy_64<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
             {"dot", testing_dot<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
+            {"dot_64", testing_dot_64<T>},
             {"iamax", testing_amax<T>},
             {"iamax_batched", testing_amax_batched<T>},
             {"iamax_strided_batched", testing_amax_strided_batched<T>},
@@ -628,8 +691,11 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"tbmv_batched", testing_tbmv_batched<T>},
             {"tbmv_strided_batched", testing_tbmv_strided_batched<T>},
             {"tbsv", testing_tbsv<T>},
+            {"tbsv_64", testing_tbsv_64<T>},
             {"tbsv_batched", testing_tbsv_batched<T>},
             {"tbsv_strided_batched", testing_tbsv_strided_batched<T>},
+            {"packed_conversion", testing_packed_conversion<T>},
+            {"packed_mode", testing_packed_mode<T>},
             {"tpmv", testing_tpmv<T>},
             {"tpmv_batched", testing_tpmv_batched<T>},
             {"tpmv_strided_batched", testing_tpmv_strided_batched<T>},
@@ -656,6 +722,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_streamed", testing_gemm_streamed<T>},
+            {"gemm_64", testing_gemm_64<T>},
+            {"gemm_ex_fp8", testing_gemm_ex_fp8<T>},
             {"symm", testing_symm<T>},
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
@@ -677,6 +746,10 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"trsm_batched_ex", testing_trsm_batched_ex<T>},
             {"trsm_strided_batched", testing_trsm_strided_batched<T>},
             {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+            {"trsm_cached", testing_trsm_cached<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
+            {"xt_syrk", testing_xt_syrk<T>},
+            {"xt_trsm", testing_xt_trsm<T>},
 
 #ifdef __HIP_PLATFORM_SOLVER__
             {"geqrf", testing_geqrf<T>},
@@ -696,6 +769,20 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"gesv_mixed", testing_gesv_mixed<T>},
+            {"gesv_mixed_batched", testing_gesv_mixed_batched<T>},
+            {"gesv_mixed_strided_batched", testing_gesv_mixed_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
 #endif
 
             // Aux
@@ -703,6 +790,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"set_get_vector_async", testing_set_get_vector_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
             {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+            {"set_get_matrix_batched_async", testing_set_get_matrix_batched_async<T>},
+            {"set_get_matrix_strided_batched_async",
+             testing_set_get_matrix_strided_batched_async<T>},
         };
         run_function(fmap, arg);
     }
@@ -717,6 +807,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, hipblasBfloat16>{}>> : h
             {"dot", testing_dot<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
+            {"gemm_ex_fp8", testing_gemm_ex_fp8<T>},
         };
         run_function(map, arg);
     }
@@ -760,6 +851,7 @@ struct perf_blas<
             {"axpy", testing_axpy<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+            {"axpy_64", testing_axpy_64<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
@@ -769,6 +861,7 @@ struct perf_blas<
             {"dotc", testing_dotc<T>},
             {"dotc_batched", testing_dotc_batched<T>},
             {"dotc_strided_batched", testing_dotc_strided_batched<T>},
+            {"dot_64", testing_dot_64<T>},
             {"iamax", testing_amax<T>},
             {"iamax_batched", testing_amax_batched<T>},
             {"iamax_strided_batched", testing_amax_strided_batched<T>},
@@ -838,8 +931,11 @@ struct perf_blas<
             {"tbmv_batched", testing_tbmv_batched<T>},
             {"tbmv_strided_batched", testing_tbmv_strided_batched<T>},
             {"tbsv", testing_tbsv<T>},
+            {"tbsv_64", testing_tbsv_64<T>},
             {"tbsv_batched", testing_tbsv_batched<T>},
             {"tbsv_strided_batched", testing_tbsv_strided_batched<T>},
+            {"packed_conversion", testing_packed_conversion<T>},
+            {"packed_mode", testing_packed_mode<T>},
             {"tpmv", testing_tpmv<T>},
             {"tpmv_batched", testing_tpmv_batched<T>},
             {"tpmv_strided_batched", testing_tpmv_strided_batched<T>},
@@ -863,6 +959,9 @@ struct perf_blas<
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_streamed", testing_gemm_streamed<T>},
+            {"gemm_64", testing_gemm_64<T>},
+            {"gemm_3m", testing_gemm_3m<T>},
             {"hemm", testing_hemm<T>},
             {"hemm_batched", testing_hemm_batched<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched<T>},
@@ -896,6 +995,10 @@ struct perf_blas<
             {"trsm_ex", testing_trsm_ex<T>},
             {"trsm_batched_ex", testing_trsm_batched_ex<T>},
             {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+            {"trsm_cached", testing_trsm_cached<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
+            {"xt_syrk", testing_xt_syrk<T>},
+            {"xt_trsm", testing_xt_trsm<T>},
             {"trmm", testing_trmm<T>},
             {"trmm_batched", testing_trmm_batched<T>},
             {"trmm_strided_batched", testing_trmm_strided_batched<T>},
@@ -918,6 +1021,20 @@ struct perf_blas<
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"gesv_mixed", testing_gesv_mixed<T>},
+            {"gesv_mixed_batched", testing_gesv_mixed_batched<T>},
+            {"gesv_mixed_strided_batched", testing_gesv_mixed_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
 #endif
         };
         run_function(map, arg);
@@ -1213,7 +1330,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
             arg.ldc = min_ldc;
         }
     }
-    else if(!strcmp(function, "gemm_strided_batched"))
+    else if(!strcmp(function, "gemm_strided_batched") || !strcmp(function, "gemm_3m")
+            || !strcmp(function, "gemm_ex_fp8"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1264,7 +1382,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_ex_epilogue"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -9926,6 +9926,450 @@ hipblasStatus_t hipblasGetrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
+// getrs_device_info
+template <>
+hipblasStatus_t hipblasGetrsDeviceInfo<float>(hipblasHandle_t          handle,
+                                              const hipblasOperation_t trans,
+                                              const int                n,
+                                              const int                nrhs,
+                                              float*                   A,
+                                              const int                lda,
+                                              const int*               ipiv,
+                                              float*                   B,
+                                              const int                ldb,
+                                              int*                     deviceInfo)
+{
+    return hipblasSgetrsDeviceInfo(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsDeviceInfo<double>(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               double*                  A,
+                                               const int                lda,
+                                               const int*               ipiv,
+                                               double*                  B,
+                                               const int                ldb,
+                                               int*                     deviceInfo)
+{
+    return hipblasDgetrsDeviceInfo(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsDeviceInfo<hipblasComplex>(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       hipblasComplex*          A,
+                                                       const int                lda,
+                                                       const int*               ipiv,
+                                                       hipblasComplex*          B,
+                                                       const int                ldb,
+                                                       int*                     deviceInfo)
+{
+    return hipblasCgetrsDeviceInfo(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                             const hipblasOperation_t trans,
+                                                             const int                n,
+                                                             const int                nrhs,
+                                                             hipblasDoubleComplex*    A,
+                                                             const int                lda,
+                                                             const int*               ipiv,
+                                                             hipblasDoubleComplex*    B,
+                                                             const int                ldb,
+                                                             int*                     deviceInfo)
+{
+    return hipblasZgetrsDeviceInfo(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+
+// getrs_batched_device_info
+template <>
+hipblasStatus_t hipblasGetrsBatchedDeviceInfo<float>(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int                n,
+                                                     const int                nrhs,
+                                                     float* const             A[],
+                                                     const int                lda,
+                                                     const int*               ipiv,
+                                                     float* const             B[],
+                                                     const int                ldb,
+                                                     int*                     deviceInfo,
+                                                     const int                batchCount)
+{
+    return hipblasSgetrsBatchedDeviceInfo(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsBatchedDeviceInfo<double>(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      double* const            A[],
+                                                      const int                lda,
+                                                      const int*               ipiv,
+                                                      double* const            B[],
+                                                      const int                ldb,
+                                                      int*                     deviceInfo,
+                                                      const int                batchCount)
+{
+    return hipblasDgetrsBatchedDeviceInfo(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsBatchedDeviceInfo<hipblasComplex>(hipblasHandle_t          handle,
+                                                              const hipblasOperation_t trans,
+                                                              const int                n,
+                                                              const int                nrhs,
+                                                              hipblasComplex* const    A[],
+                                                              const int                lda,
+                                                              const int*               ipiv,
+                                                              hipblasComplex* const    B[],
+                                                              const int                ldb,
+                                                              int*                     deviceInfo,
+                                                              const int                batchCount)
+{
+    return hipblasCgetrsBatchedDeviceInfo(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGetrsBatchedDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                        const hipblasOperation_t    trans,
+                                                        const int                   n,
+                                                        const int                   nrhs,
+                                                        hipblasDoubleComplex* const A[],
+                                                        const int                   lda,
+                                                        const int*                  ipiv,
+                                                        hipblasDoubleComplex* const B[],
+                                                        const int                   ldb,
+                                                        int*                        deviceInfo,
+                                                        const int                   batchCount)
+{
+    return hipblasZgetrsBatchedDeviceInfo(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+
+// getrs_strided_batched_device_info
+template <>
+hipblasStatus_t hipblasGetrsStridedBatchedDeviceInfo<float>(hipblasHandle_t          handle,
+                                                            const hipblasOperation_t trans,
+                                                            const int                n,
+                                                            const int                nrhs,
+                                                            float*                   A,
+                                                            const int                lda,
+                                                            const hipblasStride      strideA,
+                                                            const int*               ipiv,
+                                                            const hipblasStride      strideP,
+                                                            float*                   B,
+                                                            const int                ldb,
+                                                            const hipblasStride      strideB,
+                                                            int*                     deviceInfo,
+                                                            const int                batchCount)
+{
+    return hipblasSgetrsStridedBatchedDeviceInfo(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 strideB,
+                                                 deviceInfo,
+                                                 batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsStridedBatchedDeviceInfo<double>(hipblasHandle_t          handle,
+                                                             const hipblasOperation_t trans,
+                                                             const int                n,
+                                                             const int                nrhs,
+                                                             double*                  A,
+                                                             const int                lda,
+                                                             const hipblasStride      strideA,
+                                                             const int*               ipiv,
+                                                             const hipblasStride      strideP,
+                                                             double*                  B,
+                                                             const int                ldb,
+                                                             const hipblasStride      strideB,
+                                                             int*                     deviceInfo,
+                                                             const int                batchCount)
+{
+    return hipblasDgetrsStridedBatchedDeviceInfo(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 strideB,
+                                                 deviceInfo,
+                                                 batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGetrsStridedBatchedDeviceInfo<hipblasComplex>(hipblasHandle_t          handle,
+                                                         const hipblasOperation_t trans,
+                                                         const int                n,
+                                                         const int                nrhs,
+                                                         hipblasComplex*          A,
+                                                         const int                lda,
+                                                         const hipblasStride      strideA,
+                                                         const int*               ipiv,
+                                                         const hipblasStride      strideP,
+                                                         hipblasComplex*          B,
+                                                         const int                ldb,
+                                                         const hipblasStride      strideB,
+                                                         int*                     deviceInfo,
+                                                         const int                batchCount)
+{
+    return hipblasCgetrsStridedBatchedDeviceInfo(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 strideB,
+                                                 deviceInfo,
+                                                 batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGetrsStridedBatchedDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               hipblasDoubleComplex*    A,
+                                                               const int                lda,
+                                                               const hipblasStride      strideA,
+                                                               const int*               ipiv,
+                                                               const hipblasStride      strideP,
+                                                               hipblasDoubleComplex*    B,
+                                                               const int                ldb,
+                                                               const hipblasStride      strideB,
+                                                               int*                     deviceInfo,
+                                                               const int                batchCount)
+{
+    return hipblasZgetrsStridedBatchedDeviceInfo(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 strideB,
+                                                 deviceInfo,
+                                                 batchCount);
+}
+
+// gesv_batched
+template <>
+hipblasStatus_t hipblasGesvBatched<float>(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          float* const    A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          float* const    B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount)
+{
+    return hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<double>(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount)
+{
+    return hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         int*                        ipiv,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         const int                   batchCount)
+{
+    return hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+// gesv_strided_batched
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<float>(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 float*              A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 float*              B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 const int           batchCount)
+{
+    return hipblasSgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<double>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount)
+{
+    return hipblasDgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount)
+{
+    return hipblasCgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                const int             n,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* A,
+                                                                const int             lda,
+                                                                const hipblasStride   strideA,
+                                                                int*                  ipiv,
+                                                                const hipblasStride   strideP,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const hipblasStride   strideB,
+                                                                int*                  info,
+                                                                const int             batchCount)
+{
+    return hipblasZgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
 // getri_batched
 template <>
 hipblasStatus_t hipblasGetriBatched<float>(hipblasHandle_t handle,
@@ -9983,123 +10427,648 @@ hipblasStatus_t hipblasGetriBatched<hipblasDoubleComplex>(hipblasHandle_t
     return hipblasZgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batchCount);
 }
 
-// geqrf
+// potrf
 template <>
-hipblasStatus_t hipblasGeqrf<float>(hipblasHandle_t handle,
-                                    const int       m,
-                                    const int       n,
-                                    float*          A,
-                                    const int       lda,
-                                    float*          ipiv,
-                                    int*            info)
+hipblasStatus_t hipblasPotrf<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    float*                  A,
+                                    const int               lda,
+                                    int*                    info)
 {
-    return hipblasSgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasSpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<double>(hipblasHandle_t handle,
-                                     const int       m,
-                                     const int       n,
-                                     double*         A,
-                                     const int       lda,
-                                     double*         ipiv,
-                                     int*            info)
+hipblasStatus_t hipblasPotrf<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info)
 {
-    return hipblasDgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasDpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<hipblasComplex>(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             hipblasComplex* A,
-                                             const int       lda,
-                                             hipblasComplex* ipiv,
-                                             int*            info)
+hipblasStatus_t hipblasPotrf<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info)
 {
-    return hipblasCgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasCpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                   const int             m,
-                                                   const int             n,
-                                                   hipblasDoubleComplex* A,
-                                                   const int             lda,
-                                                   hipblasDoubleComplex* ipiv,
-                                                   int*                  info)
+hipblasStatus_t hipblasPotrf<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   int*                    info)
 {
-    return hipblasZgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasZpotrf(handle, uplo, n, A, lda, info);
 }
 
-// geqrf_batched
+// potrf_batched
 template <>
-hipblasStatus_t hipblasGeqrfBatched<float>(hipblasHandle_t handle,
-                                           const int       m,
-                                           const int       n,
-                                           float* const    A[],
-                                           const int       lda,
-                                           float* const    ipiv[],
-                                           int*            info,
-                                           const int       batchCount)
+hipblasStatus_t hipblasPotrfBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           float* const            A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount)
 {
-    return hipblasSgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<double>(hipblasHandle_t handle,
-                                            const int       m,
-                                            const int       n,
-                                            double* const   A[],
-                                            const int       lda,
-                                            double* const   ipiv[],
-                                            int*            info,
-                                            const int       batchCount)
+hipblasStatus_t hipblasPotrfBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount)
 {
-    return hipblasDgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                    const int             m,
-                                                    const int             n,
-                                                    hipblasComplex* const A[],
-                                                    const int             lda,
-                                                    hipblasComplex* const ipiv[],
-                                                    int*                  info,
-                                                    const int             batchCount)
+hipblasStatus_t hipblasPotrfBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount)
 {
-    return hipblasCgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                          const int                   m,
+hipblasStatus_t hipblasPotrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
                                                           const int                   n,
                                                           hipblasDoubleComplex* const A[],
                                                           const int                   lda,
-                                                          hipblasDoubleComplex* const ipiv[],
                                                           int*                        info,
                                                           const int                   batchCount)
 {
-    return hipblasZgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
-// geqrf_strided_batched
+// potrf_strided_batched
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<float>(hipblasHandle_t     handle,
-                                                  const int           m,
-                                                  const int           n,
-                                                  float*              A,
-                                                  const int           lda,
-                                                  const hipblasStride strideA,
-                                                  float*              ipiv,
-                                                  const hipblasStride strideP,
-                                                  int*                info,
-                                                  const int           batchCount)
+hipblasStatus_t hipblasPotrfStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount)
 {
-    return hipblasSgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+// potrs
+template <>
+hipblasStatus_t hipblasPotrs<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    float*                  A,
+                                    const int               lda,
+                                    float*                  B,
+                                    const int               ldb,
+                                    int*                    info)
+{
+    return hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info)
+{
+    return hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info)
+{
+    return hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   int*                    info)
+{
+    return hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+// potrs_batched
+template <>
+hipblasStatus_t hipblasPotrsBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           float* const            A[],
+                                           const int               lda,
+                                           float* const            B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount)
+{
+    return hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount)
+{
+    return hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          hipblasDoubleComplex* const B[],
+                                                          const int                   ldb,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+// potrs_strided_batched
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  float*                  B,
+                                                  const int               ldb,
+                                                  const hipblasStride     strideB,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 const int               nrhs,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 hipblasDoubleComplex*   B,
+                                                                 const int               ldb,
+                                                                 const hipblasStride     strideB,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+// potri
+template <>
+hipblasStatus_t hipblasPotri<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    float*                  A,
+                                    const int               lda,
+                                    int*                    info)
+{
+    return hipblasSpotri(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info)
+{
+    return hipblasDpotri(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info)
+{
+    return hipblasCpotri(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   int*                    info)
+{
+    return hipblasZpotri(handle, uplo, n, A, lda, info);
+}
+
+// potri_batched
+template <>
+hipblasStatus_t hipblasPotriBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           float* const            A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount)
+{
+    return hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount)
+{
+    return hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+// potri_strided_batched
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+// geqrf
+template <>
+hipblasStatus_t hipblasGeqrf<float>(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    float*          A,
+                                    const int       lda,
+                                    float*          ipiv,
+                                    int*            info)
+{
+    return hipblasSgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<double>(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     double*         A,
+                                     const int       lda,
+                                     double*         ipiv,
+                                     int*            info)
+{
+    return hipblasDgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<hipblasComplex>(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* ipiv,
+                                             int*            info)
+{
+    return hipblasCgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                   const int             m,
+                                                   const int             n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   hipblasDoubleComplex* ipiv,
+                                                   int*                  info)
+{
+    return hipblasZgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+// geqrf_batched
+template <>
+hipblasStatus_t hipblasGeqrfBatched<float>(hipblasHandle_t handle,
+                                           const int       m,
+                                           const int       n,
+                                           float* const    A[],
+                                           const int       lda,
+                                           float* const    ipiv[],
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasSgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrfBatched<double>(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            double* const   A[],
+                                            const int       lda,
+                                            double* const   ipiv[],
+                                            int*            info,
+                                            const int       batchCount)
+{
+    return hipblasDgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrfBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                    const int             m,
+                                                    const int             n,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const ipiv[],
+                                                    int*                  info,
+                                                    const int             batchCount)
+{
+    return hipblasCgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const int                   m,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          hipblasDoubleComplex* const ipiv[],
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+}
+
+// geqrf_strided_batched
+template <>
+hipblasStatus_t hipblasGeqrfStridedBatched<float>(hipblasHandle_t     handle,
+                                                  const int           m,
+                                                  const int           n,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  float*              ipiv,
+                                                  const hipblasStride strideP,
+                                                  int*                info,
+                                                  const int           batchCount)
+{
+    return hipblasSgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
 template <>
@@ -10114,262 +11083,1752 @@ hipblasStatus_t hipblasGeqrfStridedBatched<double>(hipblasHandle_t     handle,
                                                    int*                info,
                                                    const int           batchCount)
 {
-    return hipblasDgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasDgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrfStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           hipblasComplex*     ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount)
+{
+    return hipblasCgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             m,
+                                                                 const int             n,
+                                                                 hipblasDoubleComplex* A,
+                                                                 const int             lda,
+                                                                 const hipblasStride   strideA,
+                                                                 hipblasDoubleComplex* ipiv,
+                                                                 const hipblasStride   strideP,
+                                                                 int*                  info,
+                                                                 const int             batchCount)
+{
+    return hipblasZgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+// gels
+template <>
+hipblasStatus_t hipblasGels<float>(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   const int          m,
+                                   const int          n,
+                                   const int          nrhs,
+                                   float*             A,
+                                   const int          lda,
+                                   float*             B,
+                                   const int          ldb,
+                                   int*               info,
+                                   int*               deviceInfo)
+{
+    return hipblasSgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGels<double>(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    double*            A,
+                                    const int          lda,
+                                    double*            B,
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo)
+{
+    return hipblasDgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGels<hipblasComplex>(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          nrhs,
+                                            hipblasComplex*    A,
+                                            const int          lda,
+                                            hipblasComplex*    B,
+                                            const int          ldb,
+                                            int*               info,
+                                            int*               deviceInfo)
+{
+    return hipblasCgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGels<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    trans,
+                                                  const int             m,
+                                                  const int             n,
+                                                  const int             nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int             lda,
+                                                  hipblasDoubleComplex* B,
+                                                  const int             ldb,
+                                                  int*                  info,
+                                                  int*                  deviceInfo)
+{
+    return hipblasZgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+}
+
+// gelsBatched
+template <>
+hipblasStatus_t hipblasGelsBatched<float>(hipblasHandle_t    handle,
+                                          hipblasOperation_t trans,
+                                          const int          m,
+                                          const int          n,
+                                          const int          nrhs,
+                                          float* const       A[],
+                                          const int          lda,
+                                          float* const       B[],
+                                          const int          ldb,
+                                          int*               info,
+                                          int*               deviceInfo,
+                                          const int          batchCount)
+{
+    return hipblasSgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<double>(hipblasHandle_t    handle,
+                                           hipblasOperation_t trans,
+                                           const int          m,
+                                           const int          n,
+                                           const int          nrhs,
+                                           double* const      A[],
+                                           const int          lda,
+                                           double* const      B[],
+                                           const int          ldb,
+                                           int*               info,
+                                           int*               deviceInfo,
+                                           const int          batchCount)
+{
+    return hipblasDgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   hipblasOperation_t    trans,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   int*                  deviceInfo,
+                                                   const int             batchCount)
+{
+    return hipblasCgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         hipblasOperation_t          trans,
+                                                         const int                   m,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         int*                        deviceInfo,
+                                                         const int                   batchCount)
+{
+    return hipblasZgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+// gelsStridedBatched
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<float>(hipblasHandle_t     handle,
+                                                 hipblasOperation_t  trans,
+                                                 const int           m,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 float*              A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 float*              B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 int*                deviceInfo,
+                                                 const int           batchCount)
+{
+    return hipblasSgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<double>(hipblasHandle_t     handle,
+                                                  hipblasOperation_t  trans,
+                                                  const int           m,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  int*                deviceInfo,
+                                                  const int           batchCount)
+{
+    return hipblasDgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                          hipblasOperation_t  trans,
+                                                          const int           m,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          int*                deviceInfo,
+                                                          const int           batchCount)
+{
+    return hipblasCgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                hipblasOperation_t    trans,
+                                                                const int             m,
+                                                                const int             n,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* A,
+                                                                const int             lda,
+                                                                const hipblasStride   strideA,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const hipblasStride   strideB,
+                                                                int*                  info,
+                                                                int*                  deviceInfo,
+                                                                const int             batchCount)
+{
+    return hipblasZgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+// gels_device_info
+template <>
+hipblasStatus_t hipblasGelsDeviceInfo<float>(hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             const int          m,
+                                             const int          n,
+                                             const int          nrhs,
+                                             float*             A,
+                                             const int          lda,
+                                             float*             B,
+                                             const int          ldb,
+                                             int*               deviceInfo)
+{
+    return hipblasSgelsDeviceInfo(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGelsDeviceInfo<double>(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              const int          m,
+                                              const int          n,
+                                              const int          nrhs,
+                                              double*            A,
+                                              const int          lda,
+                                              double*            B,
+                                              const int          ldb,
+                                              int*               deviceInfo)
+{
+    return hipblasDgelsDeviceInfo(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGelsDeviceInfo<hipblasComplex>(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      const int          m,
+                                                      const int          n,
+                                                      const int          nrhs,
+                                                      hipblasComplex*    A,
+                                                      const int          lda,
+                                                      hipblasComplex*    B,
+                                                      const int          ldb,
+                                                      int*               deviceInfo)
+{
+    return hipblasCgelsDeviceInfo(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGelsDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    trans,
+                                                            const int             m,
+                                                            const int             n,
+                                                            const int             nrhs,
+                                                            hipblasDoubleComplex* A,
+                                                            const int             lda,
+                                                            hipblasDoubleComplex* B,
+                                                            const int             ldb,
+                                                            int*                  deviceInfo)
+{
+    return hipblasZgelsDeviceInfo(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+
+// gels_batched_device_info
+template <>
+hipblasStatus_t hipblasGelsBatchedDeviceInfo<float>(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans,
+                                                    const int          m,
+                                                    const int          n,
+                                                    const int          nrhs,
+                                                    float* const       A[],
+                                                    const int          lda,
+                                                    float* const       B[],
+                                                    const int          ldb,
+                                                    int*               deviceInfo,
+                                                    const int          batchCount)
+{
+    return hipblasSgelsBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatchedDeviceInfo<double>(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     const int          m,
+                                                     const int          n,
+                                                     const int          nrhs,
+                                                     double* const      A[],
+                                                     const int          lda,
+                                                     double* const      B[],
+                                                     const int          ldb,
+                                                     int*               deviceInfo,
+                                                     const int          batchCount)
+{
+    return hipblasDgelsBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatchedDeviceInfo<hipblasComplex>(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    trans,
+                                                             const int             m,
+                                                             const int             n,
+                                                             const int             nrhs,
+                                                             hipblasComplex* const A[],
+                                                             const int             lda,
+                                                             hipblasComplex* const B[],
+                                                             const int             ldb,
+                                                             int*                  deviceInfo,
+                                                             const int             batchCount)
+{
+    return hipblasCgelsBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGelsBatchedDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                       hipblasOperation_t          trans,
+                                                       const int                   m,
+                                                       const int                   n,
+                                                       const int                   nrhs,
+                                                       hipblasDoubleComplex* const A[],
+                                                       const int                   lda,
+                                                       hipblasDoubleComplex* const B[],
+                                                       const int                   ldb,
+                                                       int*                        deviceInfo,
+                                                       const int                   batchCount)
+{
+    return hipblasZgelsBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+
+// gels_strided_batched_device_info
+template <>
+hipblasStatus_t hipblasGelsStridedBatchedDeviceInfo<float>(hipblasHandle_t     handle,
+                                                           hipblasOperation_t  trans,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           float*              A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           float*              B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount)
+{
+    return hipblasSgelsStridedBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatchedDeviceInfo<double>(hipblasHandle_t     handle,
+                                                            hipblasOperation_t  trans,
+                                                            const int           m,
+                                                            const int           n,
+                                                            const int           nrhs,
+                                                            double*             A,
+                                                            const int           lda,
+                                                            const hipblasStride strideA,
+                                                            double*             B,
+                                                            const int           ldb,
+                                                            const hipblasStride strideB,
+                                                            int*                deviceInfo,
+                                                            const int           batchCount)
+{
+    return hipblasDgelsStridedBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatchedDeviceInfo<hipblasComplex>(hipblasHandle_t     handle,
+                                                                    hipblasOperation_t  trans,
+                                                                    const int           m,
+                                                                    const int           n,
+                                                                    const int           nrhs,
+                                                                    hipblasComplex*     A,
+                                                                    const int           lda,
+                                                                    const hipblasStride strideA,
+                                                                    hipblasComplex*     B,
+                                                                    const int           ldb,
+                                                                    const hipblasStride strideB,
+                                                                    int*                deviceInfo,
+                                                                    const int           batchCount)
+{
+    return hipblasCgelsStridedBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGelsStridedBatchedDeviceInfo<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                              hipblasOperation_t    trans,
+                                                              const int             m,
+                                                              const int             n,
+                                                              const int             nrhs,
+                                                              hipblasDoubleComplex* A,
+                                                              const int             lda,
+                                                              const hipblasStride   strideA,
+                                                              hipblasDoubleComplex* B,
+                                                              const int             ldb,
+                                                              const hipblasStride   strideB,
+                                                              int*                  deviceInfo,
+                                                              const int             batchCount)
+{
+    return hipblasZgelsStridedBatchedDeviceInfo(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+
+// gesv_mixed
+template <>
+hipblasStatus_t hipblasGesvMixed<double>(hipblasHandle_t handle,
+                                         const int       n,
+                                         const int       nrhs,
+                                         const double*   A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         const double*   B,
+                                         const int       ldb,
+                                         double*         X,
+                                         const int       ldx,
+                                         int*            iter,
+                                         double*         residual,
+                                         int*            info,
+                                         int*            deviceInfo)
+{
+    return hipblasDSgesv(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, residual, info, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGesvMixed<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                       const int                   n,
+                                                       const int                   nrhs,
+                                                       const hipblasDoubleComplex* A,
+                                                       const int                   lda,
+                                                       int*                        ipiv,
+                                                       const hipblasDoubleComplex* B,
+                                                       const int                   ldb,
+                                                       hipblasDoubleComplex*       X,
+                                                       const int                   ldx,
+                                                       int*                        iter,
+                                                       double*                     residual,
+                                                       int*                        info,
+                                                       int*                        deviceInfo)
+{
+    return hipblasZCgesv(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, residual, info, deviceInfo);
+}
+
+// gesv_mixed_batched
+template <>
+hipblasStatus_t hipblasGesvMixedBatched<double>(hipblasHandle_t     handle,
+                                                const int           n,
+                                                const int           nrhs,
+                                                const double* const A[],
+                                                const int           lda,
+                                                int*                ipiv,
+                                                const double* const B[],
+                                                const int           ldb,
+                                                double* const       X[],
+                                                const int           ldx,
+                                                int*                iter,
+                                                double*             residual,
+                                                int*                info,
+                                                int*                deviceInfo,
+                                                const int           batchCount)
+{
+    return hipblasDSgesvBatched(handle,
+                                n,
+                                nrhs,
+                                A,
+                                lda,
+                                ipiv,
+                                B,
+                                ldb,
+                                X,
+                                ldx,
+                                iter,
+                                residual,
+                                info,
+                                deviceInfo,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGesvMixedBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                  const int                         n,
+                                                  const int                         nrhs,
+                                                  const hipblasDoubleComplex* const A[],
+                                                  const int                         lda,
+                                                  int*                              ipiv,
+                                                  const hipblasDoubleComplex* const B[],
+                                                  const int                         ldb,
+                                                  hipblasDoubleComplex* const       X[],
+                                                  const int                         ldx,
+                                                  int*                              iter,
+                                                  double*                           residual,
+                                                  int*                              info,
+                                                  int*                              deviceInfo,
+                                                  const int                         batchCount)
+{
+    return hipblasZCgesvBatched(handle,
+                                n,
+                                nrhs,
+                                A,
+                                lda,
+                                ipiv,
+                                B,
+                                ldb,
+                                X,
+                                ldx,
+                                iter,
+                                residual,
+                                info,
+                                deviceInfo,
+                                batchCount);
+}
+
+// gesv_mixed_strided_batched
+template <>
+hipblasStatus_t hipblasGesvMixedStridedBatched<double>(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       const double*       A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
+                                                       const double*       B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       double*             X,
+                                                       const int           ldx,
+                                                       const hipblasStride strideX,
+                                                       int*                iter,
+                                                       double*             residual,
+                                                       int*                info,
+                                                       int*                deviceInfo,
+                                                       const int           batchCount)
+{
+    return hipblasDSgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       residual,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGesvMixedStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         const hipblasDoubleComplex* A,
+                                                         const int                   lda,
+                                                         const hipblasStride         strideA,
+                                                         int*                        ipiv,
+                                                         const hipblasStride         strideP,
+                                                         const hipblasDoubleComplex* B,
+                                                         const int                   ldb,
+                                                         const hipblasStride         strideB,
+                                                         hipblasDoubleComplex*       X,
+                                                         const int                   ldx,
+                                                         const hipblasStride         strideX,
+                                                         int*                        iter,
+                                                         double*                     residual,
+                                                         int*                        info,
+                                                         int*                        deviceInfo,
+                                                         const int                   batchCount)
+{
+    return hipblasZCgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       residual,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+}
+
+#endif
+
+// gemmStreamed
+template <>
+hipblasStatus_t hipblasGemmStreamed<float>(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const float*       alpha,
+                                           const float*       A,
+                                           int                lda,
+                                           const float*       B,
+                                           int                ldb,
+                                           const float*       beta,
+                                           float*             C,
+                                           int                ldc,
+                                           size_t             deviceMemoryLimit)
+{
+    return hipblasSgemmStreamed(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStreamed<double>(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            const double*      B,
+                                            int                ldb,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc,
+                                            size_t             deviceMemoryLimit)
+{
+    return hipblasDgemmStreamed(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStreamed<hipblasComplex>(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* A,
+                                                    int                   lda,
+                                                    const hipblasComplex* B,
+                                                    int                   ldb,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    size_t                deviceMemoryLimit)
+{
+    return hipblasCgemmStreamed(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStreamed<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasOperation_t          transB,
+                                                          int                         m,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          size_t                      deviceMemoryLimit)
+{
+    return hipblasZgemmStreamed(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+
+// trsmCached
+template <>
+hipblasStatus_t hipblasTrsmCached<float>(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const float*       alpha,
+                                         const float*       A,
+                                         int                lda,
+                                         float*             B,
+                                         int                ldb,
+                                         uint64_t           version)
+{
+    return hipblasStrsmCached(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, version);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCached<double>(hipblasHandle_t    handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int                m,
+                                          int                n,
+                                          const double*      alpha,
+                                          const double*      A,
+                                          int                lda,
+                                          double*            B,
+                                          int                ldb,
+                                          uint64_t           version)
+{
+    return hipblasDtrsmCached(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, version);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCached<hipblasComplex>(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int                   m,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int                   lda,
+                                                  hipblasComplex*       B,
+                                                  int                   ldb,
+                                                  uint64_t              version)
+{
+    return hipblasCtrsmCached(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, version);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCached<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                        hipblasSideMode_t           side,
+                                                        hipblasFillMode_t           uplo,
+                                                        hipblasOperation_t          transA,
+                                                        hipblasDiagType_t           diag,
+                                                        int                         m,
+                                                        int                         n,
+                                                        const hipblasDoubleComplex* alpha,
+                                                        const hipblasDoubleComplex* A,
+                                                        int                         lda,
+                                                        hipblasDoubleComplex*       B,
+                                                        int                         ldb,
+                                                        uint64_t                    version)
+{
+    return hipblasZtrsmCached(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, version);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           int                n,
+                                           const float* const AP[],
+                                           float* const       A[],
+                                           int                lda,
+                                           int                batchCount)
+{
+    return hipblasStpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            int                 n,
+                                            const double* const AP[],
+                                            double* const       A[],
+                                            int                 lda,
+                                            int                 batchCount)
+{
+    return hipblasDtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount)
+{
+    return hipblasCtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTpttrBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int                               n,
+                                              const hipblasDoubleComplex* const AP[],
+                                              hipblasDoubleComplex* const       A[],
+                                              int                               lda,
+                                              int                               batchCount)
+{
+    return hipblasZtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  const float*      AP,
+                                                  hipblasStride     strideAP,
+                                                  float*            A,
+                                                  int               lda,
+                                                  hipblasStride     strideA,
+                                                  int               batchCount)
+{
+    return hipblasStpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const double*     AP,
+                                                   hipblasStride     strideAP,
+                                                   double*           A,
+                                                   int               lda,
+                                                   hipblasStride     strideA,
+                                                   int               batchCount)
+{
+    return hipblasDtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* AP,
+                                                           hipblasStride         strideAP,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount)
+{
+    return hipblasCtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTpttrStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideAP,
+                                                     hipblasDoubleComplex*       A,
+                                                     int                         lda,
+                                                     hipblasStride               strideA,
+                                                     int                         batchCount)
+{
+    return hipblasZtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           int                n,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       AP[],
+                                           int                batchCount)
+{
+    return hipblasStrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            int                 n,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       AP[],
+                                            int                 batchCount)
+{
+    return hipblasDtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AP[],
+                                                    int                         batchCount)
+{
+    return hipblasCtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrttpBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int                               n,
+                                              const hipblasDoubleComplex* const A[],
+                                              int                               lda,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int                               batchCount)
+{
+    return hipblasZtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  const float*      A,
+                                                  int               lda,
+                                                  hipblasStride     strideA,
+                                                  float*            AP,
+                                                  hipblasStride     strideAP,
+                                                  int               batchCount)
+{
+    return hipblasStrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const double*     A,
+                                                   int               lda,
+                                                   hipblasStride     strideA,
+                                                   double*           AP,
+                                                   hipblasStride     strideAP,
+                                                   int               batchCount)
+{
+    return hipblasDtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AP,
+                                                           hipblasStride         strideAP,
+                                                           int                   batchCount)
+{
+    return hipblasCtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrttpStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       AP,
+                                                     hipblasStride               strideAP,
+                                                     int                         batchCount)
+{
+    return hipblasZtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<float>(hipblasHandle_t    handle,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const float* const AB[],
+                                           int                ldab,
+                                           float* const       A[],
+                                           int                lda,
+                                           int                batchCount)
+{
+    return hipblasSgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<double>(hipblasHandle_t     handle,
+                                            int                 m,
+                                            int                 n,
+                                            int                 kl,
+                                            int                 ku,
+                                            const double* const AB[],
+                                            int                 ldab,
+                                            double* const       A[],
+                                            int                 lda,
+                                            int                 batchCount)
+{
+    return hipblasDgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const AB[],
+                                                    int                         ldab,
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount)
+{
+    return hipblasCgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGb2geBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              int                               m,
+                                              int                               n,
+                                              int                               kl,
+                                              int                               ku,
+                                              const hipblasDoubleComplex* const AB[],
+                                              int                               ldab,
+                                              hipblasDoubleComplex* const       A[],
+                                              int                               lda,
+                                              int                               batchCount)
+{
+    return hipblasZgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  int             kl,
+                                                  int             ku,
+                                                  const float*    AB,
+                                                  int             ldab,
+                                                  hipblasStride   strideAB,
+                                                  float*          A,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  int             batchCount)
+{
+    return hipblasSgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   int             kl,
+                                                   int             ku,
+                                                   const double*   AB,
+                                                   int             ldab,
+                                                   hipblasStride   strideAB,
+                                                   double*         A,
+                                                   int             lda,
+                                                   hipblasStride   strideA,
+                                                   int             batchCount)
+{
+    return hipblasDgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount)
+{
+    return hipblasCgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
-                                                           const int           m,
-                                                           const int           n,
-                                                           hipblasComplex*     A,
-                                                           const int           lda,
-                                                           const hipblasStride strideA,
-                                                           hipblasComplex*     ipiv,
-                                                           const hipblasStride strideP,
-                                                           int*                info,
-                                                           const int           batchCount)
+hipblasStatus_t
+    hipblasGb2geStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         kl,
+                                                     int                         ku,
+                                                     const hipblasDoubleComplex* AB,
+                                                     int                         ldab,
+                                                     hipblasStride               strideAB,
+                                                     hipblasDoubleComplex*       A,
+                                                     int                         lda,
+                                                     hipblasStride               strideA,
+                                                     int                         batchCount)
 {
-    return hipblasCgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasZgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                                 const int             m,
-                                                                 const int             n,
-                                                                 hipblasDoubleComplex* A,
-                                                                 const int             lda,
-                                                                 const hipblasStride   strideA,
-                                                                 hipblasDoubleComplex* ipiv,
-                                                                 const hipblasStride   strideP,
-                                                                 int*                  info,
-                                                                 const int             batchCount)
+hipblasStatus_t hipblasGe2gbBatched<float>(hipblasHandle_t    handle,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       AB[],
+                                           int                ldab,
+                                           int                batchCount)
 {
-    return hipblasZgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasSge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
-// gels
 template <>
-hipblasStatus_t hipblasGels<float>(hipblasHandle_t    handle,
-                                   hipblasOperation_t trans,
-                                   const int          m,
-                                   const int          n,
-                                   const int          nrhs,
-                                   float*             A,
-                                   const int          lda,
-                                   float*             B,
-                                   const int          ldb,
-                                   int*               info,
-                                   int*               deviceInfo)
+hipblasStatus_t hipblasGe2gbBatched<double>(hipblasHandle_t     handle,
+                                            int                 m,
+                                            int                 n,
+                                            int                 kl,
+                                            int                 ku,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       AB[],
+                                            int                 ldab,
+                                            int                 batchCount)
 {
-    return hipblasSgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+    return hipblasDge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGels<double>(hipblasHandle_t    handle,
-                                    hipblasOperation_t trans,
-                                    const int          m,
-                                    const int          n,
-                                    const int          nrhs,
-                                    double*            A,
-                                    const int          lda,
-                                    double*            B,
-                                    const int          ldb,
-                                    int*               info,
-                                    int*               deviceInfo)
+hipblasStatus_t hipblasGe2gbBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AB[],
+                                                    int                         ldab,
+                                                    int                         batchCount)
 {
-    return hipblasDgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+    return hipblasCge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGels<hipblasComplex>(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            const int          m,
-                                            const int          n,
-                                            const int          nrhs,
-                                            hipblasComplex*    A,
-                                            const int          lda,
-                                            hipblasComplex*    B,
-                                            const int          ldb,
-                                            int*               info,
-                                            int*               deviceInfo)
+hipblasStatus_t
+    hipblasGe2gbBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              int                               m,
+                                              int                               n,
+                                              int                               kl,
+                                              int                               ku,
+                                              const hipblasDoubleComplex* const A[],
+                                              int                               lda,
+                                              hipblasDoubleComplex* const       AB[],
+                                              int                               ldab,
+                                              int                               batchCount)
 {
-    return hipblasCgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+    return hipblasZge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGels<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                  hipblasOperation_t    trans,
-                                                  const int             m,
-                                                  const int             n,
-                                                  const int             nrhs,
-                                                  hipblasDoubleComplex* A,
-                                                  const int             lda,
-                                                  hipblasDoubleComplex* B,
-                                                  const int             ldb,
-                                                  int*                  info,
-                                                  int*                  deviceInfo)
+hipblasStatus_t hipblasGe2gbStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  int             kl,
+                                                  int             ku,
+                                                  const float*    A,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  float*          AB,
+                                                  int             ldab,
+                                                  hipblasStride   strideAB,
+                                                  int             batchCount)
 {
-    return hipblasZgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+    return hipblasSge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
 }
 
-// gelsBatched
 template <>
-hipblasStatus_t hipblasGelsBatched<float>(hipblasHandle_t    handle,
-                                          hipblasOperation_t trans,
-                                          const int          m,
-                                          const int          n,
-                                          const int          nrhs,
-                                          float* const       A[],
-                                          const int          lda,
-                                          float* const       B[],
-                                          const int          ldb,
-                                          int*               info,
-                                          int*               deviceInfo,
-                                          const int          batchCount)
+hipblasStatus_t hipblasGe2gbStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   int             kl,
+                                                   int             ku,
+                                                   const double*   A,
+                                                   int             lda,
+                                                   hipblasStride   strideA,
+                                                   double*         AB,
+                                                   int             ldab,
+                                                   hipblasStride   strideAB,
+                                                   int             batchCount)
 {
-    return hipblasSgelsBatched(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasDge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<double>(hipblasHandle_t    handle,
-                                           hipblasOperation_t trans,
-                                           const int          m,
-                                           const int          n,
-                                           const int          nrhs,
-                                           double* const      A[],
-                                           const int          lda,
-                                           double* const      B[],
-                                           const int          ldb,
-                                           int*               info,
-                                           int*               deviceInfo,
-                                           const int          batchCount)
+hipblasStatus_t hipblasGe2gbStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           int                   batchCount)
 {
-    return hipblasDgelsBatched(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasCge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                   hipblasOperation_t    trans,
-                                                   const int             m,
-                                                   const int             n,
-                                                   const int             nrhs,
-                                                   hipblasComplex* const A[],
-                                                   const int             lda,
-                                                   hipblasComplex* const B[],
-                                                   const int             ldb,
-                                                   int*                  info,
-                                                   int*                  deviceInfo,
-                                                   const int             batchCount)
+hipblasStatus_t
+    hipblasGe2gbStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         kl,
+                                                     int                         ku,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       AB,
+                                                     int                         ldab,
+                                                     hipblasStride               strideAB,
+                                                     int                         batchCount)
+{
+    return hipblasZge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+// hipblasXt
+template <>
+hipblasStatus_t hipblasXtGemm<float>(hipblasXtHandle_t  handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     size_t             m,
+                                     size_t             n,
+                                     size_t             k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     const float*       B,
+                                     size_t             ldb,
+                                     const float*       beta,
+                                     float*             C,
+                                     size_t             ldc)
+{
+    return hipblasXtSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<double>(hipblasXtHandle_t  handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      size_t             m,
+                                      size_t             n,
+                                      size_t             k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      const double*      B,
+                                      size_t             ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      size_t             ldc)
+{
+    return hipblasXtDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              size_t                m,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* B,
+                                              size_t                ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc)
+{
+    return hipblasXtCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    size_t                      m,
+                                                    size_t                      n,
+                                                    size_t                      k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    size_t                      ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    size_t                      ldc)
+{
+    return hipblasXtZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<float>(hipblasXtHandle_t  handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     size_t             n,
+                                     size_t             k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     const float*       beta,
+                                     float*             C,
+                                     size_t             ldc)
+{
+    return hipblasXtSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<double>(hipblasXtHandle_t  handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      size_t             n,
+                                      size_t             k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      const double*      beta,
+                                      double*            C,
+                                      size_t             ldc)
+{
+    return hipblasXtDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc)
+{
+    return hipblasXtCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    size_t                      n,
+                                                    size_t                      k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    size_t                      ldc)
 {
-    return hipblasCgelsBatched(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasXtZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<float>(hipblasXtHandle_t  handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     size_t             m,
+                                     size_t             n,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     float*             B,
+                                     size_t             ldb)
+{
+    return hipblasXtStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                         hipblasOperation_t          trans,
-                                                         const int                   m,
-                                                         const int                   n,
-                                                         const int                   nrhs,
-                                                         hipblasDoubleComplex* const A[],
-                                                         const int                   lda,
-                                                         hipblasDoubleComplex* const B[],
-                                                         const int                   ldb,
-                                                         int*                        info,
-                                                         int*                        deviceInfo,
-                                                         const int                   batchCount)
+hipblasStatus_t hipblasXtTrsm<double>(hipblasXtHandle_t  handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      size_t             m,
+                                      size_t             n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      double*            B,
+                                      size_t             ldb)
 {
-    return hipblasZgelsBatched(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasXtDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
-// gelsStridedBatched
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<float>(hipblasHandle_t     handle,
-                                                 hipblasOperation_t  trans,
-                                                 const int           m,
-                                                 const int           n,
-                                                 const int           nrhs,
-                                                 float*              A,
-                                                 const int           lda,
-                                                 const hipblasStride strideA,
-                                                 float*              B,
-                                                 const int           ldb,
-                                                 const hipblasStride strideB,
-                                                 int*                info,
-                                                 int*                deviceInfo,
-                                                 const int           batchCount)
+hipblasStatus_t hipblasXtTrsm<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              size_t                m,
+                                              size_t                n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              hipblasComplex*       B,
+                                              size_t                ldb)
 {
-    return hipblasSgelsStridedBatched(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasXtCtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<double>(hipblasHandle_t     handle,
-                                                  hipblasOperation_t  trans,
-                                                  const int           m,
-                                                  const int           n,
-                                                  const int           nrhs,
-                                                  double*             A,
-                                                  const int           lda,
-                                                  const hipblasStride strideA,
-                                                  double*             B,
-                                                  const int           ldb,
-                                                  const hipblasStride strideB,
-                                                  int*                info,
-                                                  int*                deviceInfo,
-                                                  const int           batchCount)
+hipblasStatus_t hipblasXtTrsm<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    size_t                      m,
+                                                    size_t                      n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    hipblasDoubleComplex*       B,
+                                                    size_t                      ldb)
 {
-    return hipblasDgelsStridedBatched(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasXtZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
+// ILP64
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
-                                                          hipblasOperation_t  trans,
-                                                          const int           m,
-                                                          const int           n,
-                                                          const int           nrhs,
-                                                          hipblasComplex*     A,
-                                                          const int           lda,
-                                                          const hipblasStride strideA,
-                                                          hipblasComplex*     B,
-                                                          const int           ldb,
-                                                          const hipblasStride strideB,
-                                                          int*                info,
-                                                          int*                deviceInfo,
-                                                          const int           batchCount)
+hipblasStatus_t hipblasAxpy_64<float>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy)
 {
-    return hipblasCgelsStridedBatched(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasSaxpy_64(handle, n, alpha, x, incx, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                                hipblasOperation_t    trans,
-                                                                const int             m,
-                                                                const int             n,
-                                                                const int             nrhs,
-                                                                hipblasDoubleComplex* A,
-                                                                const int             lda,
-                                                                const hipblasStride   strideA,
-                                                                hipblasDoubleComplex* B,
-                                                                const int             ldb,
-                                                                const hipblasStride   strideB,
-                                                                int*                  info,
-                                                                int*                  deviceInfo,
-                                                                const int             batchCount)
+hipblasStatus_t hipblasAxpy_64<double>(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy)
 {
-    return hipblasZgelsStridedBatched(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasDaxpy_64(handle, n, alpha, x, incx, y, incy);
 }
 
-#endif
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<float>(hipblasHandle_t handle,
+                                     int64_t         n,
+                                     const float*    x,
+                                     int64_t         incx,
+                                     const float*    y,
+                                     int64_t         incy,
+                                     float*          result)
+{
+    return hipblasSdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<double>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result)
+{
+    return hipblasDdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasComplex>(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasComplex*       result)
+{
+    return hipblasCdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    const hipblasDoubleComplex* y,
+                                                    int64_t                     incy,
+                                                    hipblasDoubleComplex*       result)
+{
+    return hipblasZdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv_64<float>(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            k,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      float*             x,
+                                      int64_t            incx)
+{
+    return hipblasStbsv_64(handle, uplo, transA, diag, m, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv_64<double>(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx)
+{
+    return hipblasDtbsv_64(handle, uplo, transA, diag, m, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               k,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx)
+{
+    return hipblasCtbsv_64(handle, uplo, transA, diag, m, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx)
+{
+    return hipblasZtbsv_64(handle, uplo, transA, diag, m, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<float>(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       B,
+                                      int64_t            ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int64_t            ldc)
+{
+    return hipblasSgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<double>(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+{
+    return hipblasDgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* B,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc)
+{
+    return hipblasCgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     const hipblasDoubleComplex* B,
+                                                     int64_t                     ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc)
+{
+    return hipblasZgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
 
 /////////////
 // FORTRAN //
@@ -226,6 +226,39 @@ hipblasLocalHandle::~hipblasLocalHandle()
     }
 }
 
+hipblasXtLocalHandle::hipblasXtLocalHandle(hipblasXtBackend_t backend,
+                                           int                nb_devices,
+                                           int                block_dim)
+{
+    auto status = hipblasXtCreate(&m_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw std::runtime_error(hipblasStatusToString(status));
+
+    std::vector<int> devices(nb_devices);
+    for(int i = 0; i < nb_devices; i++)
+        devices[i] = i;
+
+    status = hipblasXtSetBackend(m_handle, backend);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasXtDeviceSelect(m_handle, nb_devices, devices.data());
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasXtSetBlockDim(m_handle, block_dim);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasXtDestroy(m_handle);
+        throw std::runtime_error(hipblasStatusToString(status));
+    }
+}
+
+hipblasXtLocalHandle::~hipblasXtLocalHandle()
+{
+    hipblasStatus_t status = hipblasXtDestroy(m_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        printf("hipblasXtDestroy error!\n");
+    }
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
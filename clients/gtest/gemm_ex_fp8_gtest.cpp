@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_ex_fp8.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int> gemm_ex_fp8_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {{-1, -1, -1, 1, 1, 1},
+                                               {0, 10, 10, 10, 10, 10},
+                                               {10, 10, 0, 10, 10, 10},
+                                               {31, 33, 35, 101, 102, 103},
+                                               {128, 96, 160, 128, 160, 128}};
+
+// vector of vector, each vector is a {alpha, alphai, beta, betai};
+const vector<vector<double>> alpha_beta_range = {{2.0, 0.0, 0.0, 0.0}, {-0.5, 0.0, 1.5, 0.0}};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-EX gemmEx with FP8 inputs:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_gemm_ex_fp8_arguments(gemm_ex_fp8_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+    int            batch_count   = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.stride_scale = 1.0;
+    arg.batch_count  = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class gemm_ex_fp8_gtest : public ::TestWithParam<gemm_ex_fp8_tuple>
+{
+protected:
+    gemm_ex_fp8_gtest() {}
+    virtual ~gemm_ex_fp8_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_ex_fp8_gtest, gemm_ex_fp8_gtest_float)
+{
+    Arguments arg = setup_gemm_ex_fp8_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_fp8<float>(arg);
+
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return; // no FP8 gemm on the backend or device
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.M
+           || arg.lda < (arg.transA == 'N' ? arg.M : arg.K)
+           || arg.ldb < (arg.transB == 'N' ? arg.K : arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_ex_fp8_gtest, gemm_ex_fp8_gtest_bf16)
+{
+    Arguments arg = setup_gemm_ex_fp8_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_fp8<hipblasBfloat16>(arg);
+
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return; // no FP8 gemm on the backend or device
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.M
+           || arg.lda < (arg.transA == 'N' ? arg.M : arg.K)
+           || arg.ldb < (arg.transB == 'N' ? arg.K : arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST(gemm_ex_fp8_gtest, gemm_ex_fp8_bad_arg_float)
+{
+    Arguments arg;
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_ex_fp8_bad_arg<float>(arg));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmExFp8,
+                         gemm_ex_fp8_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(batch_count_range)));
@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_mixed.hpp"
+#include "testing_gesv_mixed_batched.hpp"
+#include "testing_gesv_mixed_strided_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, double, int> gesv_mixed_tuple;
+
+// {N, lda, ldb, ldx}
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1, 1}, {10, 20, 100, 30}, {500, 600, 600, 500}, {1024, 1024, 1024, 1024}};
+
+const vector<double> stride_scale_range = {2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 2};
+
+Arguments setup_gesv_mixed_arguments(gesv_mixed_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    double      stride_scale = std::get<1>(tup);
+    int         batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class gesv_mixed_gtest : public ::TestWithParam<gesv_mixed_tuple>
+{
+protected:
+    gesv_mixed_gtest() {}
+    virtual ~gesv_mixed_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+bool gesv_mixed_bad_arg(const Arguments& arg)
+{
+    return arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.ldc < arg.N
+           || arg.batch_count < 0;
+}
+
+TEST(gesv_mixed_gtest_bad_arg, gesv_mixed_gtest_bad_arg_test)
+{
+    Arguments arg;
+
+    EXPECT_EQ(testing_gesv_mixed_bad_arg<double>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gesv_mixed_bad_arg<hipblasDoubleComplex>(arg), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_gtest_double)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_batched_gtest_double)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_strided_batched_gtest_double)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_strided_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_bad_arg(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// The combinations are  { {N, lda, ldb, ldx}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGesvMixed,
+                         gesv_mixed_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
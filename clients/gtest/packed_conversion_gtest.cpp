@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_packed_conversion.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char, int> packed_conversion_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 2}, {0, 0, 1}, {10, 3, 4}, {33, 0, 1}, {64, 7, 10}, {100, 99, 100}, {300, 40, 45}};
+
+const vector<char> uplo_range = {'L', 'U'};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS extensions tpttr, trttp, gb2ge, ge2gb:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_packed_conversion_arguments(packed_conversion_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+    int         batch_count = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.uplo        = uplo;
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class packed_conversion_gtest : public ::TestWithParam<packed_conversion_tuple>
+{
+protected:
+    packed_conversion_gtest() {}
+    virtual ~packed_conversion_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(packed_conversion_gtest, packed_conversion_gtest_float)
+{
+    Arguments arg = setup_packed_conversion_arguments(GetParam());
+
+    hipblasStatus_t status = testing_packed_conversion<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(packed_conversion_gtest, packed_conversion_gtest_double_complex)
+{
+    Arguments arg = setup_packed_conversion_arguments(GetParam());
+
+    hipblasStatus_t status = testing_packed_conversion<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// In HIPBLAS_PACKED_MODE_UNPACK, tpmv and spmv compute on a full-storage copy of AP and give the
+// results of HIPBLAS_PACKED_MODE_DEFAULT
+TEST(packed_conversion_gtest, packed_mode_unpack)
+{
+    const int N = 100;
+
+    hipblasLocalHandle   handle;
+    hipblasPackedMode_t  mode;
+    float                alpha = 2.0f, beta = 0.5f;
+    device_vector<float> dAP(N * (N + 1) / 2);
+    device_vector<float> dx(N);
+    device_vector<float> dy(N);
+    host_vector<float>   hAP(N * (N + 1) / 2);
+    host_vector<float>   hx(N);
+    host_vector<float>   hy(N);
+    host_vector<float>   hx_res[2] = {host_vector<float>(N), host_vector<float>(N)};
+    host_vector<float>   hy_res[2] = {host_vector<float>(N), host_vector<float>(N)};
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetPackedMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_PACKED_MODE_DEFAULT, mode);
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasGetPackedMode(handle, nullptr));
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM,
+              hipblasSetPackedMode(handle, hipblasPackedMode_t(HIPBLAS_PACKED_MODE_UNPACK + 1)));
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_INITIALIZED,
+              hipblasSetPackedMode(nullptr, HIPBLAS_PACKED_MODE_UNPACK));
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // rocBLAS cannot unpack AP in one call, so the mode is not offered
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              hipblasSetPackedMode(handle, HIPBLAS_PACKED_MODE_UNPACK));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetPackedMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_PACKED_MODE_DEFAULT, mode);
+    return;
+#endif
+
+    hipblas_init(hAP, 1, N * (N + 1) / 2, 1);
+    hipblas_init(hx, 1, N, 1);
+    hipblas_init(hy, 1, N, 1);
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP, sizeof(float) * N * (N + 1) / 2, hipMemcpyHostToDevice));
+
+    for(int unpack = 0; unpack < 2; unpack++)
+    {
+        hipblasPackedMode_t set = unpack ? HIPBLAS_PACKED_MODE_UNPACK : HIPBLAS_PACKED_MODE_DEFAULT;
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetPackedMode(handle, set));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetPackedMode(handle, &mode));
+        EXPECT_EQ(set, mode);
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * N, hipMemcpyHostToDevice));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+                  hipblasStpmv(handle,
+                               HIPBLAS_FILL_MODE_UPPER,
+                               HIPBLAS_OP_T,
+                               HIPBLAS_DIAG_NON_UNIT,
+                               N,
+                               dAP,
+                               dx,
+                               1));
+        EXPECT_EQ(
+            HIPBLAS_STATUS_SUCCESS,
+            hipblasSspmv(handle, HIPBLAS_FILL_MODE_LOWER, N, &alpha, dAP, dx, 1, &beta, dy, 1));
+        CHECK_HIP_ERROR(hipMemcpy(hx_res[unpack], dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_res[unpack], dy, sizeof(float) * N, hipMemcpyDeviceToHost));
+    }
+
+    double tolerance = std::numeric_limits<float>::epsilon() * N;
+    unit_check_error(norm_check_general<float>('F', 1, N, 1, hx_res[0], hx_res[1]), tolerance);
+    unit_check_error(norm_check_general<float>('F', 1, N, 1, hy_res[0], hy_res[1]), tolerance);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasPackedConversion,
+                         packed_conversion_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(batch_count_range)));
@@ -23,6 +23,8 @@
 
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_matrix_strided_batched_async.hpp"
 #include "utility.h"
 #include <functional>
 #include <math.h>
@@ -39,6 +41,7 @@ using ::testing::ValuesIn;
 // only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
 
 typedef std::tuple<vector<int>, vector<int>, bool> set_get_matrix_tuple;
+typedef std::tuple<vector<int>, vector<int>, double, int> set_get_matrix_batched_tuple;
 
 /* =====================================================================
 README: This file contains testers to verify the correctness of
@@ -85,6 +88,21 @@ const vector<vector<int>> lda_ldb_ldc_range = {{3, 3, 3},
                                                {5, 5, 4},
                                                {5, 5, 5}};
 
+// large sizes, above the threshold for staging pageable memory through pinned buffers
+
+const vector<vector<int>> rows_cols_large_range = {{1024, 300}};
+
+const vector<vector<int>> lda_ldb_ldc_large_range = {{1024, 1024, 1024}, {1030, 1027, 1031}};
+
+// batched sizes; the stride scales cover contiguous batches, batches which are a whole number
+// of columns apart and batches which are not
+
+const vector<vector<int>> lda_ldb_ldc_batched_range = {{3, 3, 3}, {3, 4, 5}, {5, 3, 4}};
+
+const vector<double> stride_scale_range = {1.0, 2.0, 2.5};
+
+const vector<int> batch_count_range = {0, 1, 5};
+
 const bool is_fortran[] = {false, true};
 
 /* ===============Google Unit Test==================================================== */
@@ -121,6 +139,26 @@ Arguments setup_set_get_matrix_arguments(set_get_matrix_tuple tup)
     return arg;
 }
 
+Arguments setup_set_get_matrix_batched_arguments(set_get_matrix_batched_tuple tup)
+{
+    vector<int> rows_cols   = std::get<0>(tup);
+    vector<int> lda_ldb_ldc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.rows = rows_cols[0];
+    arg.cols = rows_cols[1];
+
+    arg.lda = lda_ldb_ldc[0];
+    arg.ldb = lda_ldb_ldc[1];
+    arg.ldc = lda_ldb_ldc[2];
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    return arg;
+}
+
 class set_matrix_get_matrix_gtest : public ::TestWithParam<set_get_matrix_tuple>
 {
 protected:
@@ -180,6 +218,57 @@ TEST_P(set_matrix_get_matrix_gtest, async_float)
     }
 }
 
+class set_matrix_get_matrix_batched_gtest : public ::TestWithParam<set_get_matrix_batched_tuple>
+{
+protected:
+    set_matrix_get_matrix_batched_gtest() {}
+    virtual ~set_matrix_get_matrix_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(set_matrix_get_matrix_batched_gtest, batched_async_float)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols < 0 || arg.lda < arg.rows || arg.ldb < arg.rows
+           || arg.ldc < arg.rows || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_matrix_get_matrix_batched_gtest, strided_batched_async_float)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_strided_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols < 0 || arg.lda < arg.rows || arg.ldb < arg.rows
+           || arg.ldc < arg.rows || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -190,3 +279,16 @@ INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_small,
                          Combine(ValuesIn(rows_cols_range),
                                  ValuesIn(lda_ldb_ldc_range),
                                  ValuesIn(is_fortran)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_large,
+                         set_matrix_get_matrix_gtest,
+                         Combine(ValuesIn(rows_cols_large_range),
+                                 ValuesIn(lda_ldb_ldc_large_range),
+                                 ValuesIn(is_fortran)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_small,
+                         set_matrix_get_matrix_batched_gtest,
+                         Combine(ValuesIn(rows_cols_range),
+                                 ValuesIn(lda_ldb_ldc_batched_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "testing_tbsv.hpp"
+#include "testing_tbsv_64.hpp"
 #include "testing_tbsv_batched.hpp"
 #include "testing_tbsv_strided_batched.hpp"
 #include "utility.h"
@@ -185,6 +186,46 @@ TEST_P(blas2_tbsv_gtest, tbsv_double)
     }
 }
 
+TEST_P(blas2_tbsv_gtest, tbsv_64_float)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_64<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_64_double_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_64<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 #ifndef __HIP_PLATFORM_NVCC__
 
 TEST_P(blas2_tbsv_gtest, tbsv_batched_float)
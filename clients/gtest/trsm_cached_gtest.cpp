@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_trsm_cached.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> trsm_cached_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 1, 1}, {10, 10, 20, 100}, {129, 65, 130, 140}, {600, 500, 600, 600}};
+
+const vector<vector<double>> alpha_range = {{1.0, -5.0}, {-2.0, 0.5}};
+
+// vector of vector, each pair is a {side, uplo, transA, diag};
+// both sides, both triangles and both diagonals, with and without op(A)
+const vector<vector<char>> side_uplo_transA_diag_range = {
+    {'L', 'L', 'N', 'N'},
+    {'R', 'L', 'N', 'U'},
+    {'L', 'U', 'C', 'U'},
+    {'R', 'U', 'T', 'N'},
+    {'L', 'L', 'T', 'N'},
+    {'R', 'U', 'C', 'N'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 trsmCached:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_trsm_cached_arguments(trsm_cached_tuple tup)
+{
+    vector<int>    matrix_size           = std::get<0>(tup);
+    vector<double> alpha_alphai          = std::get<1>(tup);
+    vector<char>   side_uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha  = alpha_alphai[0];
+    arg.alphai = alpha_alphai[1];
+
+    arg.side   = side_uplo_transA_diag[0];
+    arg.uplo   = side_uplo_transA_diag[1];
+    arg.transA = side_uplo_transA_diag[2];
+    arg.diag   = side_uplo_transA_diag[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class trsm_cached_gtest : public ::TestWithParam<trsm_cached_tuple>
+{
+protected:
+    trsm_cached_gtest() {}
+    virtual ~trsm_cached_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_cached_gtest, trsm_cached_gtest_float)
+{
+    Arguments arg = setup_trsm_cached_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_cached<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(trsm_cached_gtest, trsm_cached_gtest_double_complex)
+{
+    Arguments arg = setup_trsm_cached_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_cached<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// The cache is bounded by hipblasSetTrsmCacheSize: inverses which do not fit are not kept, and
+// the least recently used inverse makes room for a new one
+TEST(trsm_cached_gtest, trsm_cache_size)
+{
+    const int K = 64;
+
+    hipblasLocalHandle   handle;
+    size_t               size  = 0;
+    float                alpha = 1.0f;
+    device_vector<float> dA1(K * K);
+    device_vector<float> dA2(K * K);
+    device_vector<float> dB(K);
+    host_vector<float>   hA(K * K);
+    std::vector<float>   hB(K, 1.0f);
+
+    for(int j = 0; j < K; j++)
+        for(int i = 0; i < K; i++)
+            hA[i + j * K] = i == j ? 2.0f : (i > j ? 0.25f / K : 0.0f);
+    CHECK_HIP_ERROR(hipMemcpy(dA1, hA, sizeof(float) * K * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA2, hA, sizeof(float) * K * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * K, hipMemcpyHostToDevice));
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetTrsmCacheSize(handle, &size));
+    EXPECT_LT(size_t(0), size);
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasGetTrsmCacheSize(handle, nullptr));
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_INITIALIZED, hipblasSetTrsmCacheSize(nullptr, size));
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_INITIALIZED, hipblasTrsmCacheInvalidate(nullptr, nullptr));
+
+    // Room for one inverse and the copy of B only
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetTrsmCacheSize(handle, sizeof(float) * (K * K + K)));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetTrsmCacheSize(handle, &size));
+    EXPECT_EQ(sizeof(float) * (K * K + K), size);
+
+    for(int i = 0; i < 2; i++)
+    {
+        for(float* dA : {(float*)dA1, (float*)dA2})
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+                      hipblasStrsmCached(handle,
+                                         HIPBLAS_SIDE_LEFT,
+                                         HIPBLAS_FILL_MODE_LOWER,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_DIAG_NON_UNIT,
+                                         K,
+                                         1,
+                                         &alpha,
+                                         dA,
+                                         K,
+                                         dB,
+                                         K,
+                                         i));
+        }
+    }
+
+    // A size of 0 disables the cache, and calls solve with trsm
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetTrsmCacheSize(handle, 0));
+    alpha = 0.0f;
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+              hipblasStrsmCached(handle,
+                                 HIPBLAS_SIDE_LEFT,
+                                 HIPBLAS_FILL_MODE_LOWER,
+                                 HIPBLAS_OP_N,
+                                 HIPBLAS_DIAG_NON_UNIT,
+                                 K,
+                                 1,
+                                 &alpha,
+                                 dA1,
+                                 K,
+                                 dB,
+                                 K,
+                                 0));
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(float) * K, hipMemcpyDeviceToHost));
+    for(int i = 0; i < K; i++)
+        EXPECT_EQ(0.0f, hB[i]);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasTrsmCacheInvalidate(handle, nullptr));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasTrsmCached,
+                         trsm_cached_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_range),
+                                 ValuesIn(side_uplo_transA_diag_range)));
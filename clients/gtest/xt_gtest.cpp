@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_xt_gemm.hpp"
+#include "testing_xt_syrk.hpp"
+#include "testing_xt_trsm.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> xt_gemm_tuple;
+typedef std::tuple<vector<int>, vector<double>, char, char>   xt_syrk_tuple;
+typedef std::tuple<vector<int>, double, vector<char>>         xt_trsm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        hipblasXt routines with google test
+
+        The testers pick a tile size which splits every dimension into
+        several tiles, so that the edge tiles, the k panels and the tiles
+        dealt to each device are all exercised even on small matrices.
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> xt_gemm_size_range = {{-1, -1, -1, -1, -1, -1},
+                                                {0, 3, 3, 3, 3, 3},
+                                                {3, 3, 0, 3, 3, 3},
+                                                {10, 7, 5, 20, 20, 20},
+                                                {64, 33, 47, 64, 64, 64},
+                                                {301, 129, 75, 302, 303, 304}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+// add/delete single values, like {2.0}
+const vector<vector<double>> xt_alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 0.0, 0.0}, {0.0, 0.0, 3.0, 1.0}};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> xt_transA_transB_range
+    = {{'N', 'N'}, {'N', 'T'}, {'C', 'N'}, {'T', 'C'}};
+
+// vector of vector, each vector is a {N, K, lda, ldc};
+const vector<vector<int>> xt_syrk_size_range
+    = {{-1, -1, -1, -1}, {11, 6, 11, 11}, {65, 4, 65, 65}, {130, 70, 131, 132}};
+
+const vector<char> xt_uplo_range   = {'L', 'U'};
+const vector<char> xt_transA_range = {'N', 'T'};
+
+// vector of vector, each vector is a {M, N, lda, ldb};
+const vector<vector<int>> xt_trsm_size_range
+    = {{-1, -1, -1, -1}, {10, 10, 20, 100}, {33, 65, 65, 66}, {129, 40, 130, 131}};
+
+const vector<double> xt_alpha_range = {1.0, -5.0};
+
+// vector of vector, each vector is a {side, uplo, transA, diag};
+const vector<vector<char>> xt_side_uplo_transA_diag_range = {{'L', 'L', 'N', 'N'},
+                                                             {'R', 'L', 'N', 'N'},
+                                                             {'L', 'U', 'C', 'U'},
+                                                             {'R', 'U', 'T', 'N'},
+                                                             {'L', 'L', 'T', 'U'},
+                                                             {'R', 'U', 'C', 'U'}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     hipblasXt gemm, syrk, trsm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_xt_gemm_arguments(xt_gemm_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+    vector<char>   transA_B    = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about xt_gemm_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_B[0];
+    arg.transB = transA_B[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_xt_syrk_arguments(xt_syrk_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.uplo   = std::get<2>(tup);
+    arg.transA = std::get<3>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_xt_trsm_arguments(xt_trsm_tuple tup)
+{
+    vector<int>  matrix_size = std::get<0>(tup);
+    double       alpha       = std::get<1>(tup);
+    vector<char> side_uplo   = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha = alpha;
+
+    arg.side   = side_uplo[0];
+    arg.uplo   = side_uplo[1];
+    arg.transA = side_uplo[2];
+    arg.diag   = side_uplo[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class xt_gemm_gtest : public ::TestWithParam<xt_gemm_tuple>
+{
+protected:
+    xt_gemm_gtest() {}
+    virtual ~xt_gemm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class xt_syrk_gtest : public ::TestWithParam<xt_syrk_tuple>
+{
+protected:
+    xt_syrk_gtest() {}
+    virtual ~xt_syrk_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class xt_trsm_gtest : public ::TestWithParam<xt_trsm_tuple>
+{
+protected:
+    xt_trsm_gtest() {}
+    virtual ~xt_trsm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// xt_gemm
+TEST_P(xt_gemm_gtest, float)
+{
+    Arguments arg = setup_xt_gemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_gemm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(xt_gemm_gtest, double_complex)
+{
+    Arguments arg = setup_xt_gemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_gemm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// xt_syrk
+TEST_P(xt_syrk_gtest, double)
+{
+    Arguments arg = setup_xt_syrk_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_syrk<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(xt_syrk_gtest, float_complex)
+{
+    Arguments arg = setup_xt_syrk_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_syrk<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// xt_trsm
+TEST_P(xt_trsm_gtest, float)
+{
+    Arguments arg = setup_xt_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_trsm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(xt_trsm_gtest, double_complex)
+{
+    Arguments arg = setup_xt_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_trsm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasXtGemm,
+                         xt_gemm_gtest,
+                         Combine(ValuesIn(xt_gemm_size_range),
+                                 ValuesIn(xt_alpha_beta_range),
+                                 ValuesIn(xt_transA_transB_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasXtSyrk,
+                         xt_syrk_gtest,
+                         Combine(ValuesIn(xt_syrk_size_range),
+                                 ValuesIn(xt_alpha_beta_range),
+                                 ValuesIn(xt_uplo_range),
+                                 ValuesIn(xt_transA_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasXtTrsm,
+                         xt_trsm_gtest,
+                         Combine(ValuesIn(xt_trsm_size_range),
+                                 ValuesIn(xt_alpha_range),
+                                 ValuesIn(xt_side_uplo_transA_diag_range)));
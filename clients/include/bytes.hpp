@@ -45,6 +45,13 @@ constexpr double set_get_matrix_gbyte_count(int m, int n)
     return (sizeof(T) * m * n * 2.0) / 1e9;
 }
 
+/* \brief byte counts of SET/GET_MATRIX_BATCHED_ASYNC and SET/GET_MATRIX_STRIDED_BATCHED_ASYNC */
+template <typename T>
+constexpr double set_get_matrix_batched_gbyte_count(int m, int n, int batch_count)
+{
+    return set_get_matrix_gbyte_count<T>(m, n) * batch_count;
+}
+
 /* \brief byte counts of SET/GET_VECTOR/_ASYNC */
 template <typename T>
 constexpr double set_get_vector_gbyte_count(int n)
@@ -295,6 +302,13 @@ constexpr double tpmv_gbyte_count(int m)
     return (sizeof(T) * tri_count(m)) / 1e9;
 }
 
+/* \brief byte counts of TPTTR and TRTTP */
+template <typename T>
+constexpr double tpttr_gbyte_count(int n)
+{
+    return (sizeof(T) * 2.0 * tri_count(n)) / 1e9;
+}
+
 /* \brief byte counts of TRMV */
 template <typename T>
 constexpr double trmv_gbyte_count(int m)
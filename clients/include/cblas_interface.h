@@ -199,6 +199,14 @@ void cblas_symv(
 template <typename T>
 int cblas_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int cblas_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
+// potri
+template <typename T>
+int cblas_potri(char uplo, int n, T* A, int lda);
+
 // tbmv
 template <typename T>
 void cblas_tbmv(hipblasFillMode_t  uplo,
@@ -345,6 +353,38 @@ void cblas_gemm(hipblasOperation_t transA,
                 To*                C,
                 int                ldc);
 
+// gemm epilogue, applied to C holding the result of the gemm
+template <typename T>
+void cblas_gemm_epilogue(int                 m,
+                         int                 n,
+                         const T*            bias,
+                         hipblasActivation_t activation,
+                         double              scale,
+                         T*                  C,
+                         int                 ldc,
+                         T*                  aux,
+                         int                 ldaux);
+
+// gemm with FP8 A and B, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ, each scaled by its own factor
+template <typename T>
+void cblas_gemm_fp8(hipblasOperation_t transA,
+                    hipblasOperation_t transB,
+                    int                m,
+                    int                n,
+                    int                k,
+                    float              alpha,
+                    const uint8_t*     A,
+                    hipDataType        a_type,
+                    int                lda,
+                    float              scale_a,
+                    const uint8_t*     B,
+                    hipDataType        b_type,
+                    int                ldb,
+                    float              scale_b,
+                    float              beta,
+                    T*                 C,
+                    int                ldc);
+
 // hemm
 template <typename T>
 void cblas_hemm(hipblasSideMode_t side,
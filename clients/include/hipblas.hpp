@@ -27,6 +27,7 @@
 
 /* library headers */
 #include "hipblas.h"
+#include "hipblasXt.h"
 
 /*!\file
  * \brief hipblasTemplate_api.h provides Basic Linear Algebra Subprograms of Level 1, 2 and 3,
@@ -1950,6 +1951,75 @@ hipblasStatus_t hipblasGetrsStridedBatched(hipblasHandle_t          handle,
                                            int*                     info,
                                            const int                batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasGetrsDeviceInfo(hipblasHandle_t          handle,
+                                       const hipblasOperation_t trans,
+                                       const int                n,
+                                       const int                nrhs,
+                                       T*                       A,
+                                       const int                lda,
+                                       const int*               ipiv,
+                                       T*                       B,
+                                       const int                ldb,
+                                       int*                     deviceInfo);
+
+template <typename T>
+hipblasStatus_t hipblasGetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                              const hipblasOperation_t trans,
+                                              const int                n,
+                                              const int                nrhs,
+                                              T* const                 A[],
+                                              const int                lda,
+                                              const int*               ipiv,
+                                              T* const                 B[],
+                                              const int                ldb,
+                                              int*                     deviceInfo,
+                                              const int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int                n,
+                                                     const int                nrhs,
+                                                     T*                       A,
+                                                     const int                lda,
+                                                     const hipblasStride      strideA,
+                                                     const int*               ipiv,
+                                                     const hipblasStride      strideP,
+                                                     T*                       B,
+                                                     const int                ldb,
+                                                     const hipblasStride      strideB,
+                                                     int*                     deviceInfo,
+                                                     const int                batchCount);
+
+// gesv
+template <typename T>
+hipblasStatus_t hipblasGesvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T* const        A[],
+                                   const int       lda,
+                                   int*            ipiv,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGesvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const int           nrhs,
+                                          T*                  A,
+                                          const int           lda,
+                                          const hipblasStride strideA,
+                                          int*                ipiv,
+                                          const hipblasStride strideP,
+                                          T*                  B,
+                                          const int           ldb,
+                                          const hipblasStride strideB,
+                                          int*                info,
+                                          const int           batchCount);
+
 // getri
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
@@ -1962,6 +2032,100 @@ hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
                                     int*            info,
                                     const int       batchCount);
 
+// potrf
+template <typename T>
+hipblasStatus_t hipblasPotrf(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T>
+hipblasStatus_t hipblasPotrfBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasPotrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potrs
+template <typename T>
+hipblasStatus_t hipblasPotrs(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const int               nrhs,
+                             T*                      A,
+                             const int               lda,
+                             T*                      B,
+                             const int               ldb,
+                             int*                    info);
+
+template <typename T>
+hipblasStatus_t hipblasPotrsBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T* const                A[],
+                                    const int               lda,
+                                    T* const                B[],
+                                    const int               ldb,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasPotrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const hipblasStride     strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potri
+template <typename T>
+hipblasStatus_t hipblasPotri(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T>
+hipblasStatus_t hipblasPotriBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasPotriStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
 // geqrf
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeqrf(
@@ -2033,6 +2197,46 @@ hipblasStatus_t hipblasGelsStridedBatched(hipblasHandle_t     handle,
                                           int*                deviceInfo,
                                           const int           batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasGelsDeviceInfo(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      const int          m,
+                                      const int          n,
+                                      const int          nrhs,
+                                      T*                 A,
+                                      const int          lda,
+                                      T*                 B,
+                                      const int          ldb,
+                                      int*               deviceInfo);
+
+template <typename T>
+hipblasStatus_t hipblasGelsBatchedDeviceInfo(hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             const int          m,
+                                             const int          n,
+                                             const int          nrhs,
+                                             T* const           A[],
+                                             const int          lda,
+                                             T* const           B[],
+                                             const int          ldb,
+                                             int*               deviceInfo,
+                                             const int          batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                    hipblasOperation_t  trans,
+                                                    const int           m,
+                                                    const int           n,
+                                                    const int           nrhs,
+                                                    T*                  A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    T*                  B,
+                                                    const int           ldb,
+                                                    const hipblasStride strideB,
+                                                    int*                deviceInfo,
+                                                    const int           batchCount);
+
 // dgmm
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
@@ -2119,4 +2323,273 @@ hipblasStatus_t hipblasTrtri_trsm(hipblasHandle_t   handle,
                                   int               lda,
                                   T*                invA);
 
+template <typename T>
+hipblasStatus_t hipblasGemmStreamed(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           B,
+                                    int                ldb,
+                                    const T*           beta,
+                                    T*                 C,
+                                    int                ldc,
+                                    size_t             deviceMemoryLimit);
+
+template <typename T>
+hipblasStatus_t hipblasTrsmCached(hipblasHandle_t    handle,
+                                  hipblasSideMode_t  side,
+                                  hipblasFillMode_t  uplo,
+                                  hipblasOperation_t transA,
+                                  hipblasDiagType_t  diag,
+                                  int                m,
+                                  int                n,
+                                  const T*           alpha,
+                                  const T*           A,
+                                  int                lda,
+                                  T*                 B,
+                                  int                ldb,
+                                  uint64_t           version);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const T* const    AP[],
+                                    T* const          A[],
+                                    int               lda,
+                                    int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const T*          AP,
+                                           hipblasStride     strideAP,
+                                           T*                A,
+                                           int               lda,
+                                           hipblasStride     strideA,
+                                           int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const T* const    A[],
+                                    int               lda,
+                                    T* const          AP[],
+                                    int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const T*          A,
+                                           int               lda,
+                                           hipblasStride     strideA,
+                                           T*                AP,
+                                           hipblasStride     strideAP,
+                                           int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGb2geBatched(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const T* const  AB[],
+                                    int             ldab,
+                                    T* const        A[],
+                                    int             lda,
+                                    int             batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGb2geStridedBatched(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           int             kl,
+                                           int             ku,
+                                           const T*        AB,
+                                           int             ldab,
+                                           hipblasStride   strideAB,
+                                           T*              A,
+                                           int             lda,
+                                           hipblasStride   strideA,
+                                           int             batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGe2gbBatched(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const T* const  A[],
+                                    int             lda,
+                                    T* const        AB[],
+                                    int             ldab,
+                                    int             batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGe2gbStridedBatched(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           int             kl,
+                                           int             ku,
+                                           const T*        A,
+                                           int             lda,
+                                           hipblasStride   strideA,
+                                           T*              AB,
+                                           int             ldab,
+                                           hipblasStride   strideAB,
+                                           int             batchCount);
+
+// hipblasXt
+template <typename T>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              size_t             m,
+                              size_t             n,
+                              size_t             k,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              const T*           B,
+                              size_t             ldb,
+                              const T*           beta,
+                              T*                 C,
+                              size_t             ldc);
+
+template <typename T>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              size_t             n,
+                              size_t             k,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              const T*           beta,
+                              T*                 C,
+                              size_t             ldc);
+
+template <typename T>
+hipblasStatus_t hipblasXtTrsm(hipblasXtHandle_t  handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              size_t             m,
+                              size_t             n,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              T*                 B,
+                              size_t             ldb);
+
+// ILP64
+template <typename T>
+hipblasStatus_t hipblasAxpy_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        alpha,
+                               const T*        x,
+                               int64_t         incx,
+                               T*              y,
+                               int64_t         incy);
+
+template <typename T>
+hipblasStatus_t hipblasDot_64(hipblasHandle_t handle,
+                              int64_t         n,
+                              const T*        x,
+                              int64_t         incx,
+                              const T*        y,
+                              int64_t         incy,
+                              T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasTbsv_64(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int64_t            m,
+                               int64_t            k,
+                               const T*           A,
+                               int64_t            lda,
+                               T*                 x,
+                               int64_t            incx);
+
+template <typename T>
+hipblasStatus_t hipblasGemm_64(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           B,
+                               int64_t            ldb,
+                               const T*           beta,
+                               T*                 C,
+                               int64_t            ldc);
+
+template <typename T>
+hipblasStatus_t hipblasGesvMixed(hipblasHandle_t handle,
+                                 const int       n,
+                                 const int       nrhs,
+                                 const T*        A,
+                                 const int       lda,
+                                 int*            ipiv,
+                                 const T*        B,
+                                 const int       ldb,
+                                 T*              X,
+                                 const int       ldx,
+                                 int*            iter,
+                                 double*         residual,
+                                 int*            info,
+                                 int*            deviceInfo);
+
+template <typename T>
+hipblasStatus_t hipblasGesvMixedBatched(hipblasHandle_t handle,
+                                        const int       n,
+                                        const int       nrhs,
+                                        const T* const  A[],
+                                        const int       lda,
+                                        int*            ipiv,
+                                        const T* const  B[],
+                                        const int       ldb,
+                                        T* const        X[],
+                                        const int       ldx,
+                                        int*            iter,
+                                        double*         residual,
+                                        int*            info,
+                                        int*            deviceInfo,
+                                        const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGesvMixedStridedBatched(hipblasHandle_t     handle,
+                                               const int           n,
+                                               const int           nrhs,
+                                               const T*            A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               const T*            B,
+                                               const int           ldb,
+                                               const hipblasStride strideB,
+                                               T*                  X,
+                                               const int           ldx,
+                                               const hipblasStride strideX,
+                                               int*                iter,
+                                               double*             residual,
+                                               int*                info,
+                                               int*                deviceInfo,
+                                               const int           batchCount);
+
 #endif // _ROCBLAS_HPP_
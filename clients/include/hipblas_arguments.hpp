@@ -147,6 +147,10 @@ struct Arguments
 
     hipblas_initialization initialization = hipblas_initialization::rand_int;
 
+    bool graph_test = false; // capture timed calls into a hipGraph
+
+    size_t device_memory_limit = 0; // for streamed functions, 0 picks a limit from the sizes
+
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
@@ -207,7 +211,9 @@ struct Arguments
     OPER(name) SEP                   \
     OPER(category) SEP               \
     OPER(atomics_mode) SEP           \
-    OPER(initialization)
+    OPER(initialization) SEP         \
+    OPER(graph_test) SEP             \
+    OPER(device_memory_limit)
 
     // clang-format on
 
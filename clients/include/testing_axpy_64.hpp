@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasAxpy64Model = ArgumentModel<e_N, e_alpha, e_incx, e_incy>;
+
+inline void testname_axpy_64(const Arguments& arg, std::string& name)
+{
+    hipblasAxpy64Model{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_axpy_64(const Arguments& arg)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    int64_t abs_incx = incx < 0 ? -incx : incx;
+    int64_t abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, nullptr, nullptr, incx, nullptr, incy));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(N) * abs_incy;
+    if(!sizeX)
+        sizeX = 1;
+    if(!sizeY)
+        sizeY = 1;
+
+    T alpha = arg.get_alpha<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+    host_vector<T> hy_split(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> dy_split(sizeY);
+    device_vector<T> d_alpha(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy_host, arg, N, abs_incy, 0, 1, hipblas_client_alpha_sets_nan, false);
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_split, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, d_alpha, dx, incx, dy_device, incy));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy_host, incy));
+
+        // Split into chunks as a vector longer than INT_MAX would be
+        hipblas_set_ilp64_chunk_size(7);
+        hipblasStatus_t split_status
+            = hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy_split, incy);
+        hipblas_set_ilp64_chunk_size(0);
+        CHECK_HIPBLAS_ERROR(split_status);
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_split.data(), dy_split, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_axpy<T>(N, alpha, hx.data(), incx, hy_cpu.data(), incy);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_device.data());
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_split.data());
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_device.data());
+        }
+
+    } // end of if unit check
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, d_alpha, dx, incx, dy_device, incy));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasAxpy64Model{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         axpy_gflop_count<T>(N),
+                                         axpy_gbyte_count<T>(N),
+                                         hipblas_error_host,
+                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
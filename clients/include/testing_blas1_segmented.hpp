@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+struct blas1_segmented_fns;
+
+template <>
+struct blas1_segmented_fns<double>
+{
+    static constexpr auto dotu = hipblasDdotSegmented;
+    static constexpr auto dotc = hipblasDdotSegmented;
+    static constexpr auto axpy = hipblasDaxpySegmented;
+    static constexpr auto nrm2 = hipblasDnrm2Segmented;
+};
+
+template <>
+struct blas1_segmented_fns<hipblasDoubleComplex>
+{
+    static constexpr auto dotu = hipblasZdotuSegmented;
+    static constexpr auto dotc = hipblasZdotcSegmented;
+    static constexpr auto axpy = hipblasZaxpySegmented;
+    static constexpr auto nrm2 = hipblasDznrm2Segmented;
+};
+
+inline void testname_blas1_segmented(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_blas1_segmented(const Arguments& arg)
+{
+    using Tr  = real_t<T>;
+    using Fns = blas1_segmented_fns<T>;
+
+    // Segments of different lengths, some repeated and some lacking powers of two that longer
+    // ones have, and empty ones, starting past the beginning of the vectors
+    const std::vector<int> lengths       = {5, 0, 17, 5, 1, 17, 64, 5, 0, 13, 100, 31, 2};
+    const int              segment_count = lengths.size();
+    const int              incx = 1, incy = 2;
+
+    std::vector<int> offsets(segment_count + 1, 3);
+    for(int i = 0; i < segment_count; i++)
+        offsets[i + 1] = offsets[i] + lengths[i];
+    const size_t size_x = size_t(offsets[segment_count]) * incx;
+    const size_t size_y = size_t(offsets[segment_count]) * incy;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T>  hx(size_x), hy(size_y), hy_cpu(size_y), hy_gpu(size_y);
+    host_vector<T>  halpha(segment_count), halpha_uniform(segment_count, T(2));
+    host_vector<T>  hdot(segment_count), hdot_cpu(segment_count), hdot_gpu(segment_count);
+    host_vector<Tr> hnrm2(segment_count), hnrm2_cpu(segment_count), hnrm2_gpu(segment_count);
+
+    device_vector<T>  dx(size_x), dy(size_y), dalpha(segment_count), ddot(segment_count);
+    device_vector<Tr> dnrm2(segment_count);
+
+    hipblas_init(hx, true);
+    hipblas_init(hy);
+    hipblas_init(halpha);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           dot and nrm2, against one CPU BLAS call per segment
+    =================================================================== */
+    for(bool conj : {false, true})
+    {
+        auto dot = conj ? Fns::dotc : Fns::dotu;
+        for(int i = 0; i < segment_count; i++)
+            (conj ? cblas_dotc<T> : cblas_dot<T>)(lengths[i],
+                                                  hx + size_t(offsets[i]) * incx,
+                                                  incx,
+                                                  hy + size_t(offsets[i]) * incy,
+                                                  incy,
+                                                  &hdot_cpu[i]);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(dot(handle, segment_count, offsets.data(), dx, incx, dy, incy, hdot));
+        unit_check_general<T>(1, segment_count, 1, hdot_cpu, hdot);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(dot(handle, segment_count, offsets.data(), dx, incx, dy, incy, ddot));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hdot_gpu, ddot, sizeof(T) * segment_count, hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, segment_count, 1, hdot_cpu, hdot_gpu);
+    }
+
+    for(int i = 0; i < segment_count; i++)
+        cblas_nrm2<T, Tr>(lengths[i], hx + size_t(offsets[i]) * incx, incx, &hnrm2_cpu[i]);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(Fns::nrm2(handle, segment_count, offsets.data(), dx, incx, hnrm2));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(Fns::nrm2(handle, segment_count, offsets.data(), dx, incx, dnrm2));
+    CHECK_HIP_ERROR(hipMemcpy(hnrm2_gpu, dnrm2, sizeof(Tr) * segment_count, hipMemcpyDeviceToHost));
+    for(int i = 0; i < segment_count; i++)
+    {
+        unit_check_nrm2<Tr>(hnrm2_cpu[i], hnrm2[i], lengths[i]);
+        unit_check_nrm2<Tr>(hnrm2_cpu[i], hnrm2_gpu[i], lengths[i]);
+    }
+
+    /* =====================================================================
+           axpy, with an alpha for each segment and with one alpha for all
+    =================================================================== */
+    for(host_vector<T>* alpha : {&halpha, &halpha_uniform})
+    {
+        hy_cpu = hy;
+        for(int i = 0; i < segment_count; i++)
+            cblas_axpy<T>(lengths[i],
+                          (*alpha)[i],
+                          hx + size_t(offsets[i]) * incx,
+                          incx,
+                          hy_cpu + size_t(offsets[i]) * incy,
+                          incy);
+
+        // alpha on the host, and then on the device
+        for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+        {
+            const T* alpha_ptr = *alpha;
+            if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dalpha, *alpha, sizeof(T) * segment_count, hipMemcpyHostToDevice));
+                alpha_ptr = dalpha;
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+            CHECK_HIPBLAS_ERROR(Fns::axpy(
+                handle, segment_count, offsets.data(), alpha_ptr, dx, incx, dy, incy));
+            CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+            unit_check_general<T>(1, size_y, 1, hy_cpu, hy_gpu);
+        }
+    }
+
+    /* =====================================================================
+           Invalid arguments
+    =================================================================== */
+    std::vector<int> bad_offsets = offsets;
+    bad_offsets[4]               = offsets[3] - 1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    EXPECT_HIPBLAS_STATUS(
+        Fns::dotu(nullptr, segment_count, offsets.data(), dx, incx, dy, incy, hdot),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        Fns::dotu(handle, segment_count, bad_offsets.data(), dx, incx, dy, incy, hdot),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(Fns::nrm2(handle, segment_count, offsets.data(), dx, 0, hnrm2),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(Fns::axpy(handle, -1, offsets.data(), halpha, dx, incx, dy, incy),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
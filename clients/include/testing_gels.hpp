@@ -128,6 +128,23 @@ inline hipblasStatus_t testing_gels_bad_arg(const Arguments& arg)
         HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsDeviceInfo<T>(handle, opBad, M, N, nrhs, dA, lda, dB, ldb, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsDeviceInfo<T>(handle, opN, M, N, nrhs, dA, M - 1, dB, ldb, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsDeviceInfo<T>(handle, opN, 100, 200, nrhs, dA, lda, dB, 199, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsDeviceInfo<T>(handle, opN, M, N, nrhs, dA, lda, dB, ldb, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsDeviceInfo<T>(handle, opN, 0, 0, nrhs, nullptr, lda, nullptr, ldb, dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -165,7 +182,8 @@ inline hipblasStatus_t testing_gels(const Arguments& arg)
     host_vector<T> hA(A_size);
     host_vector<T> hB(B_size);
     host_vector<T> hB_res(B_size);
-    int            info, info_res;
+    host_vector<T> hB_res2(B_size);
+    int            info, info_res, info_res2;
     int            info_input(-1);
 
     device_vector<T>   dA(A_size);
@@ -209,6 +227,14 @@ inline hipblasStatus_t testing_gels(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(hB_res, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(&info_res, dInfo, sizeof(int), hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same A and B
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGelsDeviceInfo<T>(handle, trans, M, N, nrhs, dA, lda, dB, ldb, dInfo));
+        CHECK_HIP_ERROR(hipMemcpy(hB_res2, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&info_res2, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
@@ -217,10 +243,11 @@ inline hipblasStatus_t testing_gels(const Arguments& arg)
 
         info = cblas_gels(transc, M, N, nrhs, hA.data(), lda, hB.data(), ldb, hW.data(), sizeW);
 
-        hipblas_error
-            = norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB.data(), hB_res.data());
+        hipblas_error = std::max(
+            norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB.data(), hB_res.data()),
+            norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB.data(), hB_res2.data()));
 
-        if(info != info_res)
+        if(info != info_res || info != info_res2)
             hipblas_error += 1.0;
         if(info_input != 0)
             hipblas_error += 1.0;
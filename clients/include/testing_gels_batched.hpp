@@ -166,6 +166,26 @@ inline hipblasStatus_t testing_gels_batched_bad_arg(const Arguments& arg)
         HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsBatchedDeviceInfo<T>(
+            handle, opBad, M, N, nrhs, dAp, lda, dBp, ldb, dInfo, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsBatchedDeviceInfo<T>(
+            handle, opN, M, N, nrhs, dAp, M - 1, dBp, ldb, dInfo, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsBatchedDeviceInfo<T>(
+            handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, nullptr, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsBatchedDeviceInfo<T>(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsBatchedDeviceInfo<T>(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, nullptr, 0),
+        HIPBLAS_STATUS_SUCCESS);
+
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -209,7 +229,9 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
     host_batch_vector<T> hA(A_size, 1, batchCount);
     host_batch_vector<T> hB(B_size, 1, batchCount);
     host_batch_vector<T> hB_res(B_size, 1, batchCount);
+    host_batch_vector<T> hB_res2(B_size, 1, batchCount);
     host_vector<T>       info_res(batchCount);
+    host_vector<int>     info_res2(batchCount);
     host_vector<T>       info(batchCount);
     int                  info_input(-1);
 
@@ -267,6 +289,24 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(info_res.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same A and B
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIPBLAS_ERROR(hipblasGelsBatchedDeviceInfo<T>(handle,
+                                                            trans,
+                                                            M,
+                                                            N,
+                                                            nrhs,
+                                                            dA.ptr_on_device(),
+                                                            lda,
+                                                            dB.ptr_on_device(),
+                                                            ldb,
+                                                            dInfo,
+                                                            batchCount));
+        CHECK_HIP_ERROR(hB_res2.transfer_from(dB));
+        CHECK_HIP_ERROR(
+            hipMemcpy(info_res2.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
@@ -278,14 +318,15 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
             info[b] = cblas_gels(transc, M, N, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW);
         }
 
-        hipblas_error
-            = norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB, hB_res, batchCount);
+        hipblas_error = std::max(
+            norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB, hB_res, batchCount),
+            norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB, hB_res2, batchCount));
 
         if(info_input != 0)
             hipblas_error += 1.0;
         for(int b = 0; b < batchCount; b++)
         {
-            if(info[b] != info_res[b])
+            if(info[b] != info_res[b] || info[b] != info_res2[b])
                 hipblas_error += 1.0;
         }
 
@@ -301,6 +301,57 @@ inline hipblasStatus_t testing_gels_strided_batched_bad_arg(const Arguments& arg
         HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only
+    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedDeviceInfo<T>(handle,
+                                                                 opBad,
+                                                                 M,
+                                                                 N,
+                                                                 nrhs,
+                                                                 dA,
+                                                                 lda,
+                                                                 strideA,
+                                                                 dB,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 dInfo,
+                                                                 batchCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedDeviceInfo<T>(handle,
+                                                                 opN,
+                                                                 M,
+                                                                 N,
+                                                                 nrhs,
+                                                                 dA,
+                                                                 M - 1,
+                                                                 strideA,
+                                                                 dB,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 dInfo,
+                                                                 batchCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedDeviceInfo<T>(handle,
+                                                                 opN,
+                                                                 M,
+                                                                 N,
+                                                                 nrhs,
+                                                                 dA,
+                                                                 lda,
+                                                                 strideA,
+                                                                 dB,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 nullptr,
+                                                                 batchCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGelsStridedBatchedDeviceInfo<T>(
+            handle, opN, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -348,7 +399,9 @@ inline hipblasStatus_t testing_gels_strided_batched(const Arguments& arg)
     host_vector<T>   hA(A_size);
     host_vector<T>   hB(B_size);
     host_vector<T>   hB_res(B_size);
+    host_vector<T>   hB_res2(B_size);
     host_vector<int> info_res(batchCount);
+    host_vector<int> info_res2(batchCount);
     host_vector<int> info(batchCount);
     int              info_input(-1);
 
@@ -411,6 +464,26 @@ inline hipblasStatus_t testing_gels_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(info_res.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same A and B
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGelsStridedBatchedDeviceInfo<T>(handle,
+                                                                   trans,
+                                                                   M,
+                                                                   N,
+                                                                   nrhs,
+                                                                   dA,
+                                                                   lda,
+                                                                   strideA,
+                                                                   dB,
+                                                                   ldb,
+                                                                   strideB,
+                                                                   dInfo,
+                                                                   batchCount));
+        CHECK_HIP_ERROR(hipMemcpy(hB_res2, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(info_res2.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
@@ -431,14 +504,17 @@ inline hipblasStatus_t testing_gels_strided_batched(const Arguments& arg)
                                  sizeW);
         }
 
-        hipblas_error = norm_check_general<T>(
-            'F', std::max(M, N), nrhs, ldb, strideB, hB.data(), hB_res.data(), batchCount);
+        hipblas_error = std::max(
+            norm_check_general<T>(
+                'F', std::max(M, N), nrhs, ldb, strideB, hB.data(), hB_res.data(), batchCount),
+            norm_check_general<T>(
+                'F', std::max(M, N), nrhs, ldb, strideB, hB.data(), hB_res2.data(), batchCount));
 
         if(info_input != 0)
             hipblas_error += 1.0;
         for(int b = 0; b < batchCount; b++)
         {
-            if(info[b] != info_res[b])
+            if(info[b] != info_res[b] || info[b] != info_res2[b])
                 hipblas_error += 1.0;
         }
 
@@ -186,16 +186,30 @@ inline hipblasStatus_t testing_gemm(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+        auto hipblasTimedFn = [&]() {
+            return hipblasGemmFn(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        };
 
-            CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        if(arg.graph_test)
+        {
+            // the first call allocates any workspace outside of the capture
+            CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            CHECK_HIPBLAS_ERROR(
+                get_time_us_graph(handle, arg.iters, gpu_time_used, hipblasTimedFn));
+        }
+        else
+        {
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemm3mModel = ArgumentModel<e_transA,
+                                         e_transB,
+                                         e_M,
+                                         e_N,
+                                         e_K,
+                                         e_alpha,
+                                         e_lda,
+                                         e_ldb,
+                                         e_beta,
+                                         e_ldc,
+                                         e_stride_scale,
+                                         e_batch_count>;
+
+inline void testname_gemm_3m(const Arguments& arg, std::string& name)
+{
+    hipblasGemm3mModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_3m(const Arguments& arg)
+{
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                K            = arg.K;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    int                ldc          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStride stride_A = size_t(lda) * A_col * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * B_col * stride_scale;
+    hipblasStride stride_C = size_t(ldc) * N * stride_scale;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gemm(C_size);
+    host_vector<T> hC_batched(C_size);
+    host_vector<T> hC_strided(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    host_batch_vector<T>   hA_array(stride_A, 1, batch_count);
+    host_batch_vector<T>   hB_array(stride_B, 1, batch_count);
+    host_batch_vector<T>   hC_array(stride_C, 1, batch_count);
+    device_batch_vector<T> dA_array(stride_A, 1, batch_count);
+    device_batch_vector<T> dB_array(stride_B, 1, batch_count);
+    device_batch_vector<T> dC_array(stride_C, 1, batch_count);
+
+    CHECK_HIP_ERROR(dA_array.memcheck());
+    CHECK_HIP_ERROR(dB_array.memcheck());
+    CHECK_HIP_ERROR(dC_array.memcheck());
+
+    double             gpu_time_used, hipblas_error_gemm, hipblas_error_batched;
+    double             hipblas_error_strided;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+    // The rows of C between M and ldc are not part of the result, and must be left as they are
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = M; i < ldc; i++)
+                hC[b * stride_C + i + j * size_t(ldc)] = T(i + 1 + j);
+
+    hC_gold = hC;
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA.data() + b * stride_A, hA.data() + (b + 1) * stride_A, hA_array[b]);
+        std::copy(hB.data() + b * stride_B, hB.data() + (b + 1) * stride_B, hB_array[b]);
+        std::copy(hC.data() + b * stride_C, hC.data() + (b + 1) * stride_C, hC_array[b]);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(dA_array.transfer_from(hA_array));
+    CHECK_HIP_ERROR(dB_array.transfer_from(hB_array));
+    CHECK_HIP_ERROR(dC_array.transfer_from(hC_array));
+
+    hipblasComplexGemmMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasSetComplexGemmMode(handle, HIPBLAS_COMPLEX_GEMM_MODE_3M));
+    CHECK_HIPBLAS_ERROR(hipblasGetComplexGemmMode(handle, &mode));
+    if(mode != HIPBLAS_COMPLEX_GEMM_MODE_3M)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // Each problem on its own
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        for(int b = 0; b < batch_count; b++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasGemm<T>(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               dA + b * stride_A,
+                                               lda,
+                                               dB + b * stride_B,
+                                               ldb,
+                                               &h_beta,
+                                               dC + b * stride_C,
+                                               ldc));
+        }
+        CHECK_HIP_ERROR(hipMemcpy(hC_gemm, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemmBatched<T>(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA_array.ptr_on_device(),
+                                                  lda,
+                                                  dB_array.ptr_on_device(),
+                                                  ldb,
+                                                  &h_beta,
+                                                  dC_array.ptr_on_device(),
+                                                  ldc,
+                                                  batch_count));
+        CHECK_HIP_ERROR(hC_array.transfer_from(dC_array));
+        for(int b = 0; b < batch_count; b++)
+            std::copy(hC_array[b], hC_array[b] + stride_C, hC_batched.data() + b * stride_C);
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatched<T>(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         &h_alpha,
+                                                         dA,
+                                                         lda,
+                                                         stride_A,
+                                                         dB,
+                                                         ldb,
+                                                         stride_B,
+                                                         &h_beta,
+                                                         dC,
+                                                         ldc,
+                                                         stride_C,
+                                                         batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hC_strided, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * b,
+                          lda,
+                          hB.data() + stride_B * b,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + stride_C * b,
+                          ldc);
+        }
+
+        // The 3M algorithm is accurate to a normwise rather than an elementwise bound
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 10 * std::max(K, 1) * batch_count;
+
+        hipblas_error_gemm
+            = norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_gemm, batch_count);
+        hipblas_error_batched
+            = norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_batched, batch_count);
+        hipblas_error_strided
+            = norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_strided, batch_count);
+
+        if(arg.unit_check)
+        {
+            unit_check_error(hipblas_error_gemm, tolerance);
+            unit_check_error(hipblas_error_batched, tolerance);
+            unit_check_error(hipblas_error_strided, tolerance);
+
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = M; i < ldc; i++)
+                    {
+                        size_t index = b * stride_C + i + j * size_t(ldc);
+                        unit_check_general<T>(1, 1, 1, &hC[index], &hC_gemm[index]);
+                        unit_check_general<T>(1, 1, 1, &hC[index], &hC_batched[index]);
+                        unit_check_general<T>(1, 1, 1, &hC[index], &hC_strided[index]);
+                    }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatched<T>(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             &h_alpha,
+                                                             dA,
+                                                             lda,
+                                                             stride_A,
+                                                             dB,
+                                                             ldb,
+                                                             stride_B,
+                                                             &h_beta,
+                                                             dC,
+                                                             ldc,
+                                                             stride_C,
+                                                             batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // The gflops are those of the standard algorithm, so that they compare with gemm
+        hipblasGemm3mModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gemm_gflop_count<T>(M, N, K),
+                                         gemm_gbyte_count<T>(M, N, K),
+                                         hipblas_error_gemm,
+                                         hipblas_error_strided);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -228,37 +228,51 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
-                                                transA,
-                                                transB,
-                                                M,
-                                                N,
-                                                K,
-                                                &h_alpha_Tex,
-                                                dA,
-                                                a_type,
-                                                lda,
-                                                dB,
-                                                b_type,
-                                                ldb,
-                                                &h_beta_Tex,
-                                                dC,
-                                                c_type,
-                                                ldc,
+        auto hipblasTimedFn = [&]() {
+            return hipblasGemmExFn(handle,
+                                   transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   &h_alpha_Tex,
+                                   dA,
+                                   a_type,
+                                   lda,
+                                   dB,
+                                   b_type,
+                                   ldb,
+                                   &h_beta_Tex,
+                                   dC,
+                                   c_type,
+                                   ldc,
 #ifdef HIPBLAS_V2
-                                                compute_type_gemm,
+                                   compute_type_gemm,
 #else
-                                                compute_type,
+                                   compute_type,
 #endif
-                                                algo));
+                                   algo);
+        };
+
+        if(arg.graph_test)
+        {
+            // the first call allocates any workspace outside of the capture
+            CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            CHECK_HIPBLAS_ERROR(
+                get_time_us_graph(handle, arg.iters, gpu_time_used, hipblasTimedFn));
+        }
+        else
+        {
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmExModel{}.log_args<Tc>(std::cout,
                                           arg,
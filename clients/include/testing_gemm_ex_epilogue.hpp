@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExEpilogueModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_ex_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExEpilogueModel{}.test_name(arg, name);
+}
+
+template <typename T>
+constexpr hipDataType gemm_ex_epilogue_type = std::is_same<T, hipblasHalf>{}       ? HIP_R_16F
+                                              : std::is_same<T, hipblasBfloat16>{} ? HIP_R_16BF
+                                              : std::is_same<T, double>{}          ? HIP_R_64F
+                                                                                   : HIP_R_32F;
+
+template <typename T>
+constexpr hipblasComputeType_t gemm_ex_epilogue_compute_type
+    = std::is_same<T, hipblasHalf>{} ? HIPBLAS_COMPUTE_16F
+      : std::is_same<T, double>{}    ? HIPBLAS_COMPUTE_64F
+                                     : HIPBLAS_COMPUTE_32F;
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+inline hipblasStatus_t testing_gemm_ex_epilogue_template(const Arguments& arg)
+{
+    // The epilogue supports real floating point C only
+    if constexpr(!std::is_same<To, hipblasHalf>{} && !std::is_same<To, hipblasBfloat16>{}
+                 && !std::is_same<To, float>{} && !std::is_same<To, double>{})
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    else
+    {
+        hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+
+        hipDataType          a_type       = gemm_ex_epilogue_type<Ti>;
+        hipDataType          c_type       = gemm_ex_epilogue_type<To>;
+        hipblasComputeType_t compute_type = gemm_ex_epilogue_compute_type<Tex>;
+
+        Tex h_alpha_Tex = arg.get_alpha<Tex>();
+        Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        // check here to prevent undefined memory allocation error
+        if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        const size_t size_A   = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+        const size_t size_B   = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+        const size_t size_C   = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+        const size_t size_aux = static_cast<size_t>(M) * static_cast<size_t>(N);
+
+        // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<Ti> hA(size_A);
+        host_vector<Ti> hB(size_B);
+        host_vector<To> hC(size_C);
+        host_vector<To> hC_host(size_C);
+        host_vector<To> hC_device(size_C);
+        host_vector<To> hC_gold(size_C);
+        host_vector<To> hbias(M);
+        host_vector<To> haux(size_aux);
+        host_vector<To> haux_gold(size_aux);
+
+        device_vector<Ti>  dA(size_A);
+        device_vector<Ti>  dB(size_B);
+        device_vector<To>  dC(size_C);
+        device_vector<To>  dbias(M);
+        device_vector<To>  daux(size_aux);
+        device_vector<Tex> d_alpha(1);
+        device_vector<Tex> d_beta(1);
+
+        double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+        hipblasLocalHandle handle(arg);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+        hipblas_init_matrix(hbias, arg, M, 1, M, 0, 1, hipblas_client_never_set_nan);
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dbias, hbias, sizeof(To) * M, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+
+        // bias only; scale only and bias and scale, folded into alpha and beta in host pointer
+        // mode; bias, scale and aux; bias, ReLU and aux; GELU and aux without bias
+        hipblasGemmEpilogue_t epilogues[] = {
+            {dbias, HIPBLAS_ACTIVATION_NONE, 1.0, nullptr, M},
+            {nullptr, HIPBLAS_ACTIVATION_NONE, 0.5, nullptr, M},
+            {dbias, HIPBLAS_ACTIVATION_NONE, 2.0, nullptr, M},
+            {dbias, HIPBLAS_ACTIVATION_NONE, 0.5, daux, M},
+            {dbias, HIPBLAS_ACTIVATION_RELU, 0.5, daux, M},
+            {nullptr, HIPBLAS_ACTIVATION_GELU, 2.0, daux, M},
+        };
+
+        auto hipblasGemmExEpilogueFn
+            = [&](const void* alpha, const void* beta, const hipblasGemmEpilogue_t& epilogue) {
+                  return hipblasGemmExEpilogue(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               alpha,
+                                               dA,
+                                               a_type,
+                                               lda,
+                                               dB,
+                                               a_type,
+                                               ldb,
+                                               beta,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               compute_type,
+                                               algo,
+                                               &epilogue);
+              };
+
+        if(arg.unit_check || arg.norm_check)
+        {
+            for(const auto& epilogue : epilogues)
+            {
+                // hipBLAS
+                CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * size_C, hipMemcpyHostToDevice));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+                hipblasStatus_t status
+                    = hipblasGemmExEpilogueFn(&h_alpha_Tex, &h_beta_Tex, epilogue);
+
+                // Activations are applied by cublasLt or hipBLASLt, which may have no algorithm
+                // for one, and not at all by rocBLAS when hipBLAS is built without hipBLASLt
+                if(epilogue.activation != HIPBLAS_ACTIVATION_NONE
+                   && status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                    continue;
+                CHECK_HIPBLAS_ERROR(status);
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * size_C, hipMemcpyHostToDevice));
+
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+                CHECK_HIPBLAS_ERROR(hipblasGemmExEpilogueFn(d_alpha, d_beta, epilogue));
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hC_device, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(haux, daux, sizeof(To) * size_aux, hipMemcpyDeviceToHost));
+
+                // reference BLAS
+                hC_gold = hC;
+                cblas_gemm<Ti, To, Tex>(transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        h_alpha_Tex,
+                                        hA.data(),
+                                        lda,
+                                        hB.data(),
+                                        ldb,
+                                        h_beta_Tex,
+                                        hC_gold.data(),
+                                        ldc);
+                cblas_gemm_epilogue<To>(M,
+                                        N,
+                                        epilogue.bias ? hbias.data() : nullptr,
+                                        epilogue.activation,
+                                        epilogue.scale,
+                                        hC_gold.data(),
+                                        ldc,
+                                        epilogue.aux ? haux_gold.data() : nullptr,
+                                        M);
+
+                if(arg.unit_check)
+                {
+                    // check for float16/bfloat16 input
+                    if((getArchMajor() == 11)
+                       && (std::is_same<Ti, hipblasBfloat16>{} || std::is_same<Ti, hipblasHalf>{}))
+                    {
+                        const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+                        near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
+                        near_check_general<To>(M, N, ldc, hC_gold.data(), hC_device.data(), tol);
+                        if(epilogue.aux)
+                            near_check_general<To>(M, N, M, haux_gold.data(), haux.data(), tol);
+                    }
+                    else
+                    {
+                        unit_check_general<To>(M, N, ldc, hC_gold, hC_host);
+                        unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+                        if(epilogue.aux)
+                            unit_check_general<To>(M, N, M, haux_gold, haux);
+                    }
+                }
+                if(arg.norm_check)
+                {
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        std::abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_host)));
+                    hipblas_error_device = std::max(
+                        hipblas_error_device,
+                        std::abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_device)));
+                }
+            }
+        }
+
+        if(arg.timing)
+        {
+            hipStream_t stream;
+            CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmExEpilogueFn(&h_alpha_Tex, &h_beta_Tex, epilogues[1]));
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+            hipblasGemmExEpilogueModel{}.log_args<To>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      gemm_gflop_count<Tex>(M, N, K),
+                                                      gemm_gbyte_count<Tex>(M, N, K),
+                                                      hipblas_error_host,
+                                                      hipblas_error_device);
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_epilogue_bad_arg(const Arguments& arg)
+{
+    const int            M = 10, N = 10, K = 10;
+    const T              alpha = 1, beta = 0;
+    device_vector<T>     dA(M * K), dB(K * N), dC(M * N), daux(M * N);
+    hipblasLocalHandle   handle(arg);
+    hipDataType          type         = gemm_ex_epilogue_type<T>;
+    hipblasComputeType_t compute_type = gemm_ex_epilogue_compute_type<T>;
+
+    hipblasGemmEpilogue_t epilogue = {nullptr, HIPBLAS_ACTIVATION_RELU, 1.0, daux, M};
+
+    auto call = [&](hipblasHandle_t handle, hipDataType c_type) {
+        return hipblasGemmExEpilogue(handle,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_OP_N,
+                                     M,
+                                     N,
+                                     K,
+                                     &alpha,
+                                     dA,
+                                     type,
+                                     M,
+                                     dB,
+                                     type,
+                                     K,
+                                     &beta,
+                                     dC,
+                                     c_type,
+                                     M,
+                                     compute_type,
+                                     HIPBLAS_GEMM_DEFAULT,
+                                     &epilogue);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, type), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    epilogue.activation = hipblasActivation_t(3);
+    EXPECT_HIPBLAS_STATUS(call(handle, type), HIPBLAS_STATUS_INVALID_ENUM);
+
+    epilogue.activation = HIPBLAS_ACTIVATION_RELU;
+    epilogue.ldaux      = M - 1;
+    EXPECT_HIPBLAS_STATUS(call(handle, type), HIPBLAS_STATUS_INVALID_VALUE);
+
+    epilogue.ldaux = M;
+    EXPECT_HIPBLAS_STATUS(call(handle, HIP_C_32F), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,523 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExFp8Model = ArgumentModel<e_transA,
+                                            e_transB,
+                                            e_M,
+                                            e_N,
+                                            e_K,
+                                            e_alpha,
+                                            e_lda,
+                                            e_ldb,
+                                            e_beta,
+                                            e_ldc,
+                                            e_stride_scale,
+                                            e_batch_count>;
+
+inline void testname_gemm_ex_fp8(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExFp8Model{}.test_name(arg, name);
+}
+
+// The OCP FP8 formats of hipDataType, from HIP 6.3, which cuBLAS computes; rocBLAS computes the
+// FNUZ ones
+#if HIP_VERSION >= 60300000
+#define HIPBLAS_CLIENTS_OCP_FP8
+#endif
+
+// Random FP8 encoding of magnitude 1/4 to 4, so that the products accumulate well within range
+inline uint8_t random_fp8(hipDataType type)
+{
+    bool e5m2 = type == HIP_R_8F_E5M2_FNUZ;
+#ifdef HIPBLAS_CLIENTS_OCP_FP8
+    // The OCP formats have an exponent bias one less than that of the FNUZ ones
+    bool ocp = type == HIP_R_8F_E4M3 || type == HIP_R_8F_E5M2;
+    e5m2     = e5m2 || type == HIP_R_8F_E5M2;
+#else
+    bool ocp = false;
+#endif
+    int mantissa_bits = e5m2 ? 2 : 3;
+    int bias          = (e5m2 ? 16 : 8) - (ocp ? 1 : 0);
+    auto random       = [](int lo, int hi) {
+        return std::uniform_int_distribution<int>(lo, hi)(hipblas_rng);
+    };
+
+    int sign     = random(0, 1);
+    int exponent = random(bias - 2, bias + 1);
+    int mantissa = random(0, (1 << mantissa_bits) - 1);
+    return uint8_t(sign << 7 | exponent << mantissa_bits | mantissa);
+}
+
+template <typename To>
+inline hipblasStatus_t testing_gemm_ex_fp8(const Arguments& arg)
+{
+    // FP8 gemms produce bfloat16 or float
+    if constexpr(!std::is_same<To, hipblasBfloat16>{} && !std::is_same<To, float>{})
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    else
+    {
+        hipblasGemmAlgo_t  algo         = HIPBLAS_GEMM_DEFAULT;
+        hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
+        int                M            = arg.M;
+        int                N            = arg.N;
+        int                K            = arg.K;
+        int                lda          = arg.lda;
+        int                ldb          = arg.ldb;
+        int                ldc          = arg.ldc;
+        double             stride_scale = arg.stride_scale;
+        int                batch_count  = arg.batch_count;
+
+        // Both FP8 formats, one for each operand, in the OCP formats on cuBLAS
+#if defined(__HIP_PLATFORM_NVCC__) && defined(HIPBLAS_CLIENTS_OCP_FP8)
+        hipDataType a_type = HIP_R_8F_E4M3;
+        hipDataType b_type = HIP_R_8F_E5M2;
+#else
+        hipDataType a_type = HIP_R_8F_E4M3_FNUZ;
+        hipDataType b_type = HIP_R_8F_E5M2_FNUZ;
+#endif
+        hipDataType          c_type       = std::is_same<To, float>{} ? HIP_R_32F : HIP_R_16BF;
+        hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_32F;
+
+        float h_alpha   = arg.get_alpha<float>();
+        float h_beta    = arg.get_beta<float>();
+        float h_scale_a = 0.5f;
+        float h_scale_b = 3.0f;
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        // check here to prevent undefined memory allocation error
+        if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        hipblasStride stride_A = size_t(lda) * A_col * stride_scale;
+        hipblasStride stride_B = size_t(ldb) * B_col * stride_scale;
+        hipblasStride stride_C = size_t(ldc) * N * stride_scale;
+        size_t        A_size   = stride_A * batch_count;
+        size_t        B_size   = stride_B * batch_count;
+        size_t        C_size   = stride_C * batch_count;
+
+        // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<uint8_t> hA(A_size);
+        host_vector<uint8_t> hB(B_size);
+        host_vector<To>      hC(C_size);
+        host_vector<To>      hC_v2(C_size);
+        host_vector<To>      hC_device(C_size);
+        host_vector<To>      hC_batched(C_size);
+        host_vector<To>      hC_strided(C_size);
+        host_vector<To>      hC_gold_v2(C_size);
+        host_vector<To>      hC_gold(C_size);
+
+        device_vector<uint8_t> dA(A_size);
+        device_vector<uint8_t> dB(B_size);
+        device_vector<To>      dC(C_size);
+        device_vector<float>   d_alpha(1);
+        device_vector<float>   d_beta(1);
+        device_vector<float>   d_scale_a(1);
+        device_vector<float>   d_scale_b(1);
+
+        host_batch_vector<uint8_t>   hA_array(stride_A, 1, batch_count);
+        host_batch_vector<uint8_t>   hB_array(stride_B, 1, batch_count);
+        host_batch_vector<To>        hC_array(stride_C, 1, batch_count);
+        device_batch_vector<uint8_t> dA_array(stride_A, 1, batch_count);
+        device_batch_vector<uint8_t> dB_array(stride_B, 1, batch_count);
+        device_batch_vector<To>      dC_array(stride_C, 1, batch_count);
+
+        CHECK_HIP_ERROR(dA_array.memcheck());
+        CHECK_HIP_ERROR(dB_array.memcheck());
+        CHECK_HIP_ERROR(dC_array.memcheck());
+
+        double             gpu_time_used, hipblas_error_v2, hipblas_error_device;
+        double             hipblas_error_batched, hipblas_error_strided;
+        hipblasLocalHandle handle(arg);
+
+        // Initial Data on CPU
+        for(auto& a : hA)
+            a = random_fp8(a_type);
+        for(auto& b : hB)
+            b = random_fp8(b_type);
+        hipblas_init_matrix(
+            hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            std::copy(hA.data() + b * stride_A, hA.data() + (b + 1) * stride_A, hA_array[b]);
+            std::copy(hB.data() + b * stride_B, hB.data() + (b + 1) * stride_B, hB_array[b]);
+            std::copy(hC.data() + b * stride_C, hC.data() + (b + 1) * stride_C, hC_array[b]);
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_scale_a, &h_scale_a, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_scale_b, &h_scale_b, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(dA_array.transfer_from(hA_array));
+        CHECK_HIP_ERROR(dB_array.transfer_from(hB_array));
+        CHECK_HIP_ERROR(dC_array.transfer_from(hC_array));
+
+        // FP8 is computed natively, only on devices with FP8: on rocBLAS in the FNUZ formats, and
+        // on cuBLAS in the OCP formats, with cublasLt, which on most devices takes only A
+        // transposed and B not
+        if(batch_count > 0)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            hipblasStatus_t status = hipblasGemmEx_v2(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      dA,
+                                                      a_type,
+                                                      lda,
+                                                      dB,
+                                                      b_type,
+                                                      ldb,
+                                                      &h_beta,
+                                                      dC,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type,
+                                                      algo);
+#if defined(__HIP_PLATFORM_NVCC__) && !defined(HIPBLAS_CLIENTS_OCP_FP8)
+            if(M && N)
+                EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_NOT_SUPPORTED);
+#endif
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                return status;
+            CHECK_HIPBLAS_ERROR(status);
+        }
+
+        /* =====================================================================
+             HIPBLAS
+        =================================================================== */
+        if(arg.unit_check || arg.norm_check)
+        {
+            // Each problem on its own, unscaled through gemmEx and scaled with device scalars
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * C_size, hipMemcpyHostToDevice));
+            for(int b = 0; b < batch_count; b++)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA + b * stride_A,
+                                                     a_type,
+                                                     lda,
+                                                     dB + b * stride_B,
+                                                     b_type,
+                                                     ldb,
+                                                     &h_beta,
+                                                     dC + b * stride_C,
+                                                     c_type,
+                                                     ldc,
+                                                     compute_type,
+                                                     algo));
+            }
+            CHECK_HIP_ERROR(hipMemcpy(hC_v2, dC, sizeof(To) * C_size, hipMemcpyDeviceToHost));
+
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * C_size, hipMemcpyHostToDevice));
+            for(int b = 0; b < batch_count; b++)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmExScaled(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        d_alpha,
+                                                        dA + b * stride_A,
+                                                        a_type,
+                                                        lda,
+                                                        dB + b * stride_B,
+                                                        b_type,
+                                                        ldb,
+                                                        d_beta,
+                                                        dC + b * stride_C,
+                                                        c_type,
+                                                        ldc,
+                                                        compute_type,
+                                                        algo,
+                                                        d_scale_a,
+                                                        d_scale_b));
+            }
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_device, dC, sizeof(To) * C_size, hipMemcpyDeviceToHost));
+
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExScaled(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           &h_alpha,
+                                                           (const void**)dA_array.ptr_on_device(),
+                                                           a_type,
+                                                           lda,
+                                                           (const void**)dB_array.ptr_on_device(),
+                                                           b_type,
+                                                           ldb,
+                                                           &h_beta,
+                                                           (void**)dC_array.ptr_on_device(),
+                                                           c_type,
+                                                           ldc,
+                                                           batch_count,
+                                                           compute_type,
+                                                           algo,
+                                                           d_scale_a,
+                                                           d_scale_b));
+            CHECK_HIP_ERROR(hC_array.transfer_from(dC_array));
+            for(int b = 0; b < batch_count; b++)
+                std::copy(hC_array[b], hC_array[b] + stride_C, hC_batched.data() + b * stride_C);
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * C_size, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExScaled(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  &h_alpha,
+                                                                  dA,
+                                                                  a_type,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  dB,
+                                                                  b_type,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  &h_beta,
+                                                                  dC,
+                                                                  c_type,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count,
+                                                                  compute_type,
+                                                                  algo,
+                                                                  d_scale_a,
+                                                                  d_scale_b));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_strided, dC, sizeof(To) * C_size, hipMemcpyDeviceToHost));
+
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            hC_gold_v2 = hC;
+            hC_gold    = hC;
+            for(int b = 0; b < batch_count; b++)
+            {
+                cblas_gemm_fp8<To>(transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   h_alpha,
+                                   hA.data() + stride_A * b,
+                                   a_type,
+                                   lda,
+                                   1.0f,
+                                   hB.data() + stride_B * b,
+                                   b_type,
+                                   ldb,
+                                   1.0f,
+                                   h_beta,
+                                   hC_gold_v2.data() + stride_C * b,
+                                   ldc);
+                cblas_gemm_fp8<To>(transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   h_alpha,
+                                   hA.data() + stride_A * b,
+                                   a_type,
+                                   lda,
+                                   h_scale_a,
+                                   hB.data() + stride_B * b,
+                                   b_type,
+                                   ldb,
+                                   h_scale_b,
+                                   h_beta,
+                                   hC_gold.data() + stride_C * b,
+                                   ldc);
+            }
+
+            // FP32 accumulation against the double precision reference, then rounding to To
+            double eps       = std::is_same<To, float>{} ? std::numeric_limits<float>::epsilon()
+                                                         : 1.0 / 128;
+            double tolerance = 2 * eps + std::numeric_limits<float>::epsilon() * std::max(K, 1);
+
+            hipblas_error_v2 = norm_check_general<To>(
+                'F', M, N, ldc, stride_C, hC_gold_v2, hC_v2, batch_count);
+            hipblas_error_device = norm_check_general<To>(
+                'F', M, N, ldc, stride_C, hC_gold, hC_device, batch_count);
+            hipblas_error_batched = norm_check_general<To>(
+                'F', M, N, ldc, stride_C, hC_gold, hC_batched, batch_count);
+            hipblas_error_strided = norm_check_general<To>(
+                'F', M, N, ldc, stride_C, hC_gold, hC_strided, batch_count);
+
+            if(arg.unit_check)
+            {
+                unit_check_error(hipblas_error_v2, tolerance);
+                unit_check_error(hipblas_error_device, tolerance);
+                unit_check_error(hipblas_error_batched, tolerance);
+                unit_check_error(hipblas_error_strided, tolerance);
+            }
+        }
+
+        if(arg.timing)
+        {
+            hipStream_t stream;
+            CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExScaled(handle,
+                                                                      transA,
+                                                                      transB,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      &h_alpha,
+                                                                      dA,
+                                                                      a_type,
+                                                                      lda,
+                                                                      stride_A,
+                                                                      dB,
+                                                                      b_type,
+                                                                      ldb,
+                                                                      stride_B,
+                                                                      &h_beta,
+                                                                      dC,
+                                                                      c_type,
+                                                                      ldc,
+                                                                      stride_C,
+                                                                      batch_count,
+                                                                      compute_type,
+                                                                      algo,
+                                                                      d_scale_a,
+                                                                      d_scale_b));
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+            hipblasGemmExFp8Model{}.log_args<To>(std::cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 gemm_gflop_count<float>(M, N, K),
+                                                 gemm_gbyte_count<To>(M, N, K),
+                                                 hipblas_error_device,
+                                                 hipblas_error_strided);
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_fp8_bad_arg(const Arguments& arg)
+{
+    const int                  M = 10, N = 10, K = 10;
+    const float                alpha = 1, beta = 0;
+    device_vector<uint8_t>     dA(M * K), dB(K * N);
+    device_vector<T>           dC(M * N);
+    hipblasLocalHandle         handle(arg);
+    const hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_32F;
+
+    auto call = [&](hipblasHandle_t      handle,
+                    hipblasOperation_t   transA,
+                    int                  lda,
+                    hipDataType          a_type,
+                    hipDataType          c_type,
+                    hipblasComputeType_t compute_type) {
+        return hipblasGemmExScaled(handle,
+                                   transA,
+                                   HIPBLAS_OP_N,
+                                   M,
+                                   N,
+                                   K,
+                                   &alpha,
+                                   dA,
+                                   a_type,
+                                   lda,
+                                   dB,
+                                   HIP_R_8F_E4M3_FNUZ,
+                                   K,
+                                   &beta,
+                                   dC,
+                                   c_type,
+                                   M,
+                                   compute_type,
+                                   HIPBLAS_GEMM_DEFAULT,
+                                   nullptr,
+                                   nullptr);
+    };
+
+    const hipDataType fp8 = HIP_R_8F_E5M2_FNUZ;
+    const hipDataType c   = std::is_same<T, float>{} ? HIP_R_32F : HIP_R_16BF;
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, HIPBLAS_OP_N, M, fp8, c, compute_type),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(call(handle, hipblasOperation_t(0), M, fp8, c, compute_type),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, HIPBLAS_OP_N, M - 1, fp8, c, compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // FP8 with a non-FP8 operand, a 16F result, or other than FP32 computation
+    EXPECT_HIPBLAS_STATUS(call(handle, HIPBLAS_OP_N, M, HIP_R_16BF, c, compute_type),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(call(handle, HIPBLAS_OP_N, M, fp8, HIP_R_16F, compute_type),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(call(handle, HIPBLAS_OP_N, M, fp8, c, HIPBLAS_COMPUTE_64F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
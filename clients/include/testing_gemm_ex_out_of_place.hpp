@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExOutOfPlaceModel = ArgumentModel<e_transA,
+                                                   e_transB,
+                                                   e_M,
+                                                   e_N,
+                                                   e_K,
+                                                   e_alpha,
+                                                   e_lda,
+                                                   e_ldb,
+                                                   e_beta,
+                                                   e_ldc,
+                                                   e_ldd,
+                                                   e_batch_count>;
+
+inline void testname_gemm_ex_out_of_place(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExOutOfPlaceModel{}.test_name(arg, name);
+}
+
+template <typename T>
+constexpr hipDataType gemm_ex_out_of_place_type = std::is_same<T, double>{} ? HIP_R_64F : HIP_R_32F;
+
+template <typename T>
+constexpr hipblasComputeType_t gemm_ex_out_of_place_compute_type
+    = std::is_same<T, double>{} ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_out_of_place_template(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                ldd         = arg.ldd;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          type         = gemm_ex_out_of_place_type<T>;
+    hipblasComputeType_t compute_type = gemm_ex_out_of_place_compute_type<T>;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M
+       || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t        size_A   = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t        size_B   = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t        size_C   = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+    const size_t        size_D   = static_cast<size_t>(ldd) * static_cast<size_t>(N);
+    const hipblasStride stride_A = size_A, stride_B = size_B, stride_C = size_C, stride_D = size_D;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(size_A, 1, batch_count);
+    host_batch_vector<T> hB(size_B, 1, batch_count);
+    host_batch_vector<T> hC(size_C, 1, batch_count);
+    host_batch_vector<T> hC_after(size_C, 1, batch_count);
+    host_batch_vector<T> hD(size_D, 1, batch_count);
+    host_batch_vector<T> hD_gold(size_D, 1, batch_count);
+
+    device_batch_vector<T> dA(size_A, 1, batch_count);
+    device_batch_vector<T> dB(size_B, 1, batch_count);
+    device_batch_vector<T> dC(size_C, 1, batch_count);
+    device_batch_vector<T> dD(size_D, 1, batch_count);
+    device_vector<T>       d_alpha(1);
+    device_vector<T>       d_beta(1);
+
+    // The same matrices, one after another, for the strided batched form
+    host_vector<T>   hA_strided(size_A * batch_count);
+    host_vector<T>   hB_strided(size_B * batch_count);
+    host_vector<T>   hC_strided(size_C * batch_count);
+    host_vector<T>   hD_strided(size_D * batch_count);
+    device_vector<T> dA_strided(size_A * batch_count);
+    device_vector<T> dB_strided(size_B * batch_count);
+    device_vector<T> dC_strided(size_C * batch_count);
+    device_vector<T> dD_strided(size_D * batch_count);
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_vector(hC, arg, hipblas_client_beta_sets_nan);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA[b], hA[b] + size_A, hA_strided.data() + b * size_A);
+        std::copy(hB[b], hB[b] + size_B, hB_strided.data() + b * size_B);
+        std::copy(hC[b], hC[b] + size_C, hC_strided.data() + b * size_C);
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_strided, hA_strided, sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_strided, hB_strided, sizeof(T) * size_B * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dC_strided, hC_strided, sizeof(T) * size_C * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto hipblasGemmExOutOfPlaceFn = [&](const void* alpha, const void* beta, int b) {
+        return hipblasGemmExOutOfPlace(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       alpha,
+                                       dA[b],
+                                       type,
+                                       lda,
+                                       dB[b],
+                                       type,
+                                       ldb,
+                                       beta,
+                                       dC[b],
+                                       type,
+                                       ldc,
+                                       dD[b],
+                                       type,
+                                       ldd,
+                                       compute_type,
+                                       algo);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // reference BLAS, computed in place on a copy of C
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int j = 0; j < N; j++)
+                std::copy(hC[b] + j * size_t(ldc),
+                          hC[b] + j * size_t(ldc) + M,
+                          hD_gold[b] + j * size_t(ldd));
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA[b],
+                          lda,
+                          hB[b],
+                          ldb,
+                          h_beta,
+                          hD_gold[b],
+                          ldd);
+        }
+
+        // hipBLAS, the first problem of the batch with the scalars on the host and then on the
+        // device
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExOutOfPlaceFn(&h_alpha, &h_beta, 0));
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldd, hD_gold[0], hD[0]);
+        if(arg.norm_check)
+            hipblas_error_host = norm_check_general<T>('F', M, N, ldd, hD_gold[0], hD[0]);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExOutOfPlaceFn(d_alpha, d_beta, 0));
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldd, hD_gold[0], hD[0]);
+        if(arg.norm_check)
+            hipblas_error_device = norm_check_general<T>('F', M, N, ldd, hD_gold[0], hD[0]);
+
+        // The batched forms
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExOutOfPlace(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           &h_alpha,
+                                                           (const void**)dA.ptr_on_device(),
+                                                           type,
+                                                           lda,
+                                                           (const void**)dB.ptr_on_device(),
+                                                           type,
+                                                           ldb,
+                                                           &h_beta,
+                                                           (const void**)dC.ptr_on_device(),
+                                                           type,
+                                                           ldc,
+                                                           (void**)dD.ptr_on_device(),
+                                                           type,
+                                                           ldd,
+                                                           batch_count,
+                                                           compute_type,
+                                                           algo));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExOutOfPlace(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  &h_alpha,
+                                                                  dA_strided,
+                                                                  type,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  dB_strided,
+                                                                  type,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  &h_beta,
+                                                                  dC_strided,
+                                                                  type,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  dD_strided,
+                                                                  type,
+                                                                  ldd,
+                                                                  stride_D,
+                                                                  batch_count,
+                                                                  compute_type,
+                                                                  algo));
+
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+        CHECK_HIP_ERROR(hC_after.transfer_from(dC));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hD_strided, dD_strided, sizeof(T) * size_D * batch_count, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldd, hD_gold, hD);
+            for(int b = 0; b < batch_count; b++)
+                unit_check_general<T>(M, N, ldd, hD_gold[b], hD_strided.data() + b * size_D);
+
+            // C is left unchanged
+            unit_check_general<T>(M, N, batch_count, ldc, hC, hC_after);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmExOutOfPlaceFn(&h_alpha, &h_beta, 0));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExOutOfPlaceModel{}.log_args<T>(std::cout,
+                                                   arg,
+                                                   gpu_time_used,
+                                                   gemm_gflop_count<T>(M, N, K),
+                                                   gemm_gbyte_count<T>(M, N, K),
+                                                   hipblas_error_host,
+                                                   hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_out_of_place_bad_arg(const Arguments& arg)
+{
+    const int            M = 10, N = 10, K = 10;
+    const T              alpha = 1, beta = 0;
+    device_vector<T>     dA(M * K), dB(K * N), dC(M * N), dD(M * N);
+    hipblasLocalHandle   handle(arg);
+    hipDataType          type         = gemm_ex_out_of_place_type<T>;
+    hipblasComputeType_t compute_type = gemm_ex_out_of_place_compute_type<T>;
+
+    auto call = [&](hipblasHandle_t handle, hipDataType d_type, int ldd) {
+        return hipblasGemmExOutOfPlace(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       M,
+                                       N,
+                                       K,
+                                       &alpha,
+                                       dA,
+                                       type,
+                                       M,
+                                       dB,
+                                       type,
+                                       K,
+                                       &beta,
+                                       dC,
+                                       type,
+                                       M,
+                                       dD,
+                                       d_type,
+                                       ldd,
+                                       compute_type,
+                                       HIPBLAS_GEMM_DEFAULT);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, type, M), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(call(handle, type, M - 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, HIP_R_16F, M), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
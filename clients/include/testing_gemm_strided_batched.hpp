@@ -242,32 +242,46 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        auto hipblasTimedFn = [&]() {
+            return hipblasGemmStridedBatchedFn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dB,
+                                               ldb,
+                                               stride_B,
+                                               &h_beta,
+                                               dC,
+                                               ldc,
+                                               stride_C,
+                                               batch_count);
+        };
+
+        if(arg.graph_test)
+        {
+            // the first call allocates any workspace outside of the capture
+            CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            CHECK_HIPBLAS_ERROR(
+                get_time_us_graph(handle, arg.iters, gpu_time_used, hipblasTimedFn));
+        }
+        else
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            K,
-                                                            &h_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            &h_beta,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasTimedFn());
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvMixedModel = ArgumentModel<e_N, e_lda, e_ldb, e_ldc>;
+
+inline void testname_gesv_mixed(const Arguments& arg, std::string& name)
+{
+    hipblasGesvMixedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline void setup_gesv_mixed_testing(
+    host_vector<T>& hA, host_vector<T>& hB, host_vector<T>& hX, int N, int lda, int ldb)
+{
+    // Initial hA, hX on CPU
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hX, N, 1, ldb);
+
+    // scale A to avoid singularities
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+        }
+    }
+
+    // Calculate hB = hA*hX;
+    hipblasOperation_t opN = HIPBLAS_OP_N;
+    cblas_gemm<T>(opN, opN, N, 1, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_mixed_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          N      = 100;
+    const int          nrhs   = 1;
+    const int          lda    = 101;
+    const int          ldb    = 102;
+    const int          ldx    = 103;
+    const size_t       A_size = size_t(N) * lda;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(ldb);
+    device_vector<T>   dX(ldx);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+    int                iter, info = 0;
+    double             residual;
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvMixed<T>(handle,
+                                              N,
+                                              nrhs,
+                                              dA,
+                                              lda,
+                                              dIpiv,
+                                              dB,
+                                              ldb,
+                                              dX,
+                                              ldx,
+                                              &iter,
+                                              &residual,
+                                              nullptr,
+                                              dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, ldx, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, &iter, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, nullptr, &residual, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, nullptr, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvMixed<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &residual, &info, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-13, info);
+
+    // If N == 0, A, B, X, and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasGesvMixed<T>(handle,
+                                              0,
+                                              nrhs,
+                                              nullptr,
+                                              lda,
+                                              nullptr,
+                                              nullptr,
+                                              ldb,
+                                              nullptr,
+                                              ldx,
+                                              &iter,
+                                              &residual,
+                                              &info,
+                                              dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+    EXPECT_EQ(0, iter);
+
+    // if nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasGesvMixed<T>(handle,
+                                              N,
+                                              0,
+                                              dA,
+                                              lda,
+                                              dIpiv,
+                                              nullptr,
+                                              ldb,
+                                              nullptr,
+                                              ldx,
+                                              &iter,
+                                              &residual,
+                                              &info,
+                                              dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_mixed(const Arguments& arg)
+{
+    // Only double precision systems have a solver with single precision factors
+    if constexpr(!std::is_same<T, double>{} && !std::is_same<T, hipblasDoubleComplex>{})
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    else
+    {
+        using U = real_t<T>;
+
+        int N   = arg.N;
+        int lda = arg.lda;
+        int ldb = arg.ldb;
+        int ldx = arg.ldc;
+
+        size_t A_size = size_t(lda) * N;
+        size_t B_size = ldb * 1;
+        size_t X_size = ldx * 1;
+
+        // Check to prevent memory allocation error
+        if(N < 0 || lda < N || ldb < N || ldx < N)
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<T>   hA(A_size);
+        host_vector<T>   hA1(A_size);
+        host_vector<T>   hX(B_size);
+        host_vector<T>   hB(B_size);
+        host_vector<T>   hX1(X_size);
+        host_vector<int> hIpiv(N);
+        int              info, iter, dev_info;
+        double           residual;
+
+        device_vector<T>   dA(A_size);
+        device_vector<T>   dB(B_size);
+        device_vector<T>   dX(X_size);
+        device_vector<int> dIpiv(N);
+        device_vector<int> dInfo(1);
+
+        double             gpu_time_used, hipblas_error;
+        hipblasLocalHandle handle(arg);
+
+        srand(1);
+        setup_gesv_mixed_testing(hA, hB, hX, N, lda, ldb);
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+        if(arg.unit_check || arg.norm_check)
+        {
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIPBLAS_ERROR(hipblasGesvMixed<T>(handle,
+                                                    N,
+                                                    1,
+                                                    dA,
+                                                    lda,
+                                                    dIpiv,
+                                                    dB,
+                                                    ldb,
+                                                    dX,
+                                                    ldx,
+                                                    &iter,
+                                                    &residual,
+                                                    &info,
+                                                    dInfo));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(&dev_info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+            // The exact solution is hX; A is well conditioned, so refinement converges
+            hipblas_error = norm_check_general<T>('F', N, 1, ldb, hX.data(), hX1.data());
+
+            if(arg.unit_check)
+            {
+                U      eps       = std::numeric_limits<U>::epsilon();
+                double tolerance = N * eps * 100;
+                int    zero      = 0;
+
+                unit_check_error(hipblas_error, tolerance);
+                unit_check_error(residual, tolerance);
+                unit_check_general(1, 1, 1, &zero, &info);
+                unit_check_general(1, 1, 1, &zero, &dev_info);
+                unit_check_general(N, N, lda, hA.data(), hA1.data());
+                EXPECT_GE(iter, 0);
+            }
+        }
+
+        if(arg.timing)
+        {
+            hipStream_t stream;
+            CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+            int runs = arg.cold_iters + arg.iters;
+            for(int it = 0; it < runs; it++)
+            {
+                if(it == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasGesvMixed<T>(handle,
+                                                        N,
+                                                        1,
+                                                        dA,
+                                                        lda,
+                                                        dIpiv,
+                                                        dB,
+                                                        ldb,
+                                                        dX,
+                                                        ldx,
+                                                        &iter,
+                                                        &residual,
+                                                        &info,
+                                                        dInfo));
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+            hipblasGesvMixedModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                getrf_gflop_count<T>(N, N)
+                                                    + getrs_gflop_count<T>(N, 1),
+                                                ArgumentLogging::NA_value,
+                                                hipblas_error);
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
@@ -162,6 +162,25 @@ inline hipblasStatus_t testing_getrs_bad_arg(const Arguments& arg)
                           HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsDeviceInfo<T>(handle, op, -1, nrhs, dA, lda, dIpiv, dB, ldb, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsDeviceInfo<T>(handle, op, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsDeviceInfo<T>(handle, op, N, nrhs, dA, lda, nullptr, dB, ldb, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsDeviceInfo<T>(handle, op, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsDeviceInfo<T>(handle, op, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -192,12 +211,14 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
     host_vector<T>   hB(B_size);
     host_vector<T>   hB1(B_size);
     host_vector<int> hIpiv(Ipiv_size);
+    host_vector<T>   hB2(B_size);
     host_vector<int> hIpiv1(Ipiv_size);
-    int              info;
+    int              info, hInfo2 = -1;
 
     device_vector<T>   dA(A_size);
     device_vector<T>   dB(B_size);
     device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(1);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -217,12 +238,21 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(hB1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same right hand side
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dInfo, &hInfo2, sizeof(int), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGetrsDeviceInfo<T>(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, dInfo));
+        CHECK_HIP_ERROR(hipMemcpy(hB2, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&hInfo2, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
         cblas_getrs('N', N, 1, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
 
-        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB.data(), hB1.data());
+        hipblas_error = std::max(norm_check_general<T>('F', N, 1, ldb, hB.data(), hB1.data()),
+                                 norm_check_general<T>('F', N, 1, ldb, hB.data(), hB2.data()));
 
         if(arg.unit_check)
         {
@@ -232,6 +262,7 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, 1, 1, &zero, &hInfo2);
         }
     }
 
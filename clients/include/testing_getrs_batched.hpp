@@ -170,6 +170,25 @@ inline hipblasStatus_t testing_getrs_batched_bad_arg(const Arguments& arg)
         HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only, on both backends
+    device_vector<int> dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedDeviceInfo<T>(
+            handle, op, N, nrhs, dAp, N - 1, dIpiv, dBp, ldb, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedDeviceInfo<T>(
+            handle, op, N, nrhs, dAp, lda, nullptr, dBp, ldb, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedDeviceInfo<T>(
+            handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedDeviceInfo<T>(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
     // can't make any assumptions about ptrs when batch_count < 0, this is handled by rocSOLVER
 
     // cuBLAS beckend doesn't check for nullptrs, including info, hipBLAS/rocSOLVER does
@@ -232,13 +251,16 @@ inline hipblasStatus_t testing_getrs_batched(const Arguments& arg)
     host_batch_vector<T> hX(B_size, 1, batch_count);
     host_batch_vector<T> hB(B_size, 1, batch_count);
     host_batch_vector<T> hB1(B_size, 1, batch_count);
+    host_batch_vector<T> hB2(B_size, 1, batch_count);
     host_vector<int>     hIpiv(Ipiv_size);
     host_vector<int>     hIpiv1(Ipiv_size);
+    host_vector<int>     hInfo2(batch_count);
     int                  info;
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
     device_batch_vector<T> dB(B_size, 1, batch_count);
     device_vector<int>     dIpiv(Ipiv_size);
+    device_vector<int>     dInfo(batch_count);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -270,6 +292,24 @@ inline hipblasStatus_t testing_getrs_batched(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same right hand sides
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(hipMemset(dInfo, -1, batch_count * sizeof(int)));
+        CHECK_HIPBLAS_ERROR(hipblasGetrsBatchedDeviceInfo<T>(handle,
+                                                             op,
+                                                             N,
+                                                             1,
+                                                             dA.ptr_on_device(),
+                                                             lda,
+                                                             dIpiv,
+                                                             dB.ptr_on_device(),
+                                                             ldb,
+                                                             dInfo,
+                                                             batch_count));
+        CHECK_HIP_ERROR(hB2.transfer_from(dB));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo2.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
@@ -279,15 +319,18 @@ inline hipblasStatus_t testing_getrs_batched(const Arguments& arg)
             cblas_getrs('N', N, 1, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
         }
 
-        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB, hB1, batch_count);
+        hipblas_error = std::max(norm_check_general<T>('F', N, 1, ldb, hB, hB1, batch_count),
+                                 norm_check_general<T>('F', N, 1, ldb, hB, hB2, batch_count));
         if(arg.unit_check)
         {
-            U      eps       = std::numeric_limits<U>::epsilon();
-            double tolerance = N * eps * 100;
-            int    zero      = 0;
+            U                eps       = std::numeric_limits<U>::epsilon();
+            double           tolerance = N * eps * 100;
+            int              zero      = 0;
+            host_vector<int> zeros(batch_count);
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, batch_count, 1, zeros.data(), hInfo2.data());
         }
     }
 
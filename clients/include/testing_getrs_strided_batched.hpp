@@ -316,6 +316,73 @@ inline hipblasStatus_t testing_getrs_strided_batched_bad_arg(const Arguments& ar
                           HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // The DeviceInfo variant reports invalid arguments through the status only
+    device_vector<int> dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedDeviceInfo<T>(handle,
+                                                                  op,
+                                                                  N,
+                                                                  nrhs,
+                                                                  dA,
+                                                                  N - 1,
+                                                                  strideA,
+                                                                  dIpiv,
+                                                                  strideP,
+                                                                  dB,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  dInfo,
+                                                                  batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedDeviceInfo<T>(handle,
+                                                                  op,
+                                                                  N,
+                                                                  nrhs,
+                                                                  dA,
+                                                                  lda,
+                                                                  strideA,
+                                                                  nullptr,
+                                                                  strideP,
+                                                                  dB,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  dInfo,
+                                                                  batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedDeviceInfo<T>(handle,
+                                                                  op,
+                                                                  N,
+                                                                  nrhs,
+                                                                  dA,
+                                                                  lda,
+                                                                  strideA,
+                                                                  dIpiv,
+                                                                  strideP,
+                                                                  dB,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  nullptr,
+                                                                  batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedDeviceInfo<T>(handle,
+                                                                  op,
+                                                                  N,
+                                                                  nrhs,
+                                                                  dA,
+                                                                  lda,
+                                                                  strideA,
+                                                                  dIpiv,
+                                                                  strideP,
+                                                                  dB,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  dInfo,
+                                                                  -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
     // can't make any assumptions about ptrs when batch_count < 0, this is handled by rocSOLVER
 
     return HIPBLAS_STATUS_SUCCESS;
@@ -357,13 +424,16 @@ inline hipblasStatus_t testing_getrs_strided_batched(const Arguments& arg)
     host_vector<T>   hX(B_size);
     host_vector<T>   hB(B_size);
     host_vector<T>   hB1(B_size);
+    host_vector<T>   hB2(B_size);
     host_vector<int> hIpiv(Ipiv_size);
     host_vector<int> hIpiv1(Ipiv_size);
+    host_vector<int> hInfo2(batch_count);
     int              info;
 
     device_vector<T>   dA(A_size);
     device_vector<T>   dB(B_size);
     device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -399,6 +469,27 @@ inline hipblasStatus_t testing_getrs_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
 
+        // The DeviceInfo variant, from the same right hand sides
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemset(dInfo, -1, batch_count * sizeof(int)));
+        CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedDeviceInfo<T>(handle,
+                                                                    op,
+                                                                    N,
+                                                                    1,
+                                                                    dA,
+                                                                    lda,
+                                                                    strideA,
+                                                                    dIpiv,
+                                                                    strideP,
+                                                                    dB,
+                                                                    ldb,
+                                                                    strideB,
+                                                                    dInfo,
+                                                                    batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hB2.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo2.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
@@ -414,16 +505,20 @@ inline hipblasStatus_t testing_getrs_strided_batched(const Arguments& arg)
                         ldb);
         }
 
-        hipblas_error = norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB1, batch_count);
+        hipblas_error
+            = std::max(norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB1, batch_count),
+                       norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB2, batch_count));
 
         if(arg.unit_check)
         {
-            U      eps       = std::numeric_limits<U>::epsilon();
-            double tolerance = N * eps * 100;
-            int    zero      = 0;
+            U                eps       = std::numeric_limits<U>::epsilon();
+            double           tolerance = N * eps * 100;
+            int              zero      = 0;
+            host_vector<int> zeros(batch_count);
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, batch_count, 1, zeros.data(), hInfo2.data());
         }
     }
 
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_getrs_vbatched(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_getrs_vbatched(const Arguments& arg)
+{
+    using T = double;
+
+    // Problems of different sizes, some repeated so that they share a batched call although their
+    // leading dimensions differ, some in the same power of two so that getrf pads them, and one
+    // empty
+    const std::vector<int> N    = {64, 17, 64, 0, 33, 17, 64, 1, 40, 2};
+    const std::vector<int> nrhs = {1, 3, 1, 2, 1, 3, 2, 1, 2, 1};
+    const int              batch_count = N.size();
+
+    std::vector<int> lda(batch_count), ldb(batch_count), offsets(batch_count + 1, 0);
+    size_t           A_size = 0, B_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        lda[b]         = N[b] + b % 3;
+        ldb[b]         = std::max(1, N[b]) + b / 2 % 2;
+        offsets[b + 1] = offsets[b] + N[b];
+        A_size         = std::max(A_size, size_t(lda[b]) * N[b]);
+        B_size         = std::max(B_size, size_t(ldb[b]) * nrhs[b]);
+    }
+    const size_t Ipiv_size = offsets[batch_count];
+
+    hipblasLocalHandle handle(arg);
+
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA_gpu(A_size, 1, batch_count);
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hB_gpu(B_size, 1, batch_count);
+    host_batch_vector<T> hX(B_size, 1, batch_count);
+    host_vector<int>     hIpiv(Ipiv_size);
+    host_vector<int>     hIpiv_gpu(Ipiv_size);
+    host_vector<int>     hInfo(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+    device_vector<int>     dIpiv(Ipiv_size);
+    device_vector<int>     dInfo(batch_count);
+    int                    info = 0;
+
+    hipblas_init(hA, true);
+    hipblas_init(hX);
+    for(int b = 0; b < batch_count; b++)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < N[b]; i++)
+            hA[b][i + i * lda[b]] += 400;
+
+        // Calculate hB = hA*hX;
+        if(N[b])
+            cblas_gemm<T>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          N[b],
+                          nrhs[b],
+                          N[b],
+                          (T)1,
+                          hA[b],
+                          lda[b],
+                          hX[b],
+                          ldb[b],
+                          (T)0,
+                          hB[b],
+                          ldb[b]);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasDgetrfVbatched(
+        handle, N.data(), dA.ptr_on_device(), lda.data(), dIpiv, dInfo, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasDgetrsVbatched(handle,
+                                              HIPBLAS_OP_N,
+                                              N.data(),
+                                              nrhs.data(),
+                                              dA.ptr_on_device(),
+                                              lda.data(),
+                                              dIpiv,
+                                              dB.ptr_on_device(),
+                                              ldb.data(),
+                                              &info,
+                                              batch_count));
+    EXPECT_EQ(0, info);
+
+    CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+    CHECK_HIP_ERROR(hB_gpu.transfer_from(dB));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hIpiv_gpu.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+           CPU LAPACK
+    =================================================================== */
+    for(int b = 0; b < batch_count; b++)
+    {
+        EXPECT_EQ(0, hInfo[b]);
+        if(!N[b])
+            continue;
+
+        int* ipiv = hIpiv.data() + offsets[b];
+        cblas_getrf<T>(N[b], N[b], hA[b], lda[b], ipiv);
+        cblas_getrs<T>('N', N[b], nrhs[b], hA[b], lda[b], ipiv, hB[b], ldb[b]);
+
+        double e = std::numeric_limits<T>::epsilon() * N[b];
+        unit_check_error(norm_check_general<T>('F', N[b], N[b], lda[b], hA[b], hA_gpu[b]), e);
+        unit_check_error(norm_check_general<T>('F', N[b], nrhs[b], ldb[b], hB[b], hB_gpu[b]), e);
+    }
+    unit_check_general<int>(1, Ipiv_size, 1, hIpiv, hIpiv_gpu);
+
+    // Invalid arguments are reported as getrsBatched reports them
+    std::vector<int> bad_lda = lda;
+    bad_lda[2]               = N[2] - 1;
+    EXPECT_HIPBLAS_STATUS(hipblasDgetrfVbatched(handle,
+                                                N.data(),
+                                                dA.ptr_on_device(),
+                                                bad_lda.data(),
+                                                dIpiv,
+                                                dInfo,
+                                                batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasDgetrsVbatched(handle,
+                                                HIPBLAS_OP_N,
+                                                N.data(),
+                                                nrhs.data(),
+                                                dA.ptr_on_device(),
+                                                bad_lda.data(),
+                                                dIpiv,
+                                                dB.ptr_on_device(),
+                                                ldb.data(),
+                                                &info,
+                                                batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
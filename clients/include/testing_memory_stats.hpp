@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_memory_stats(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_memory_stats(const Arguments& arg)
+{
+    hipblasMemoryStats_t stats;
+    hipblasLocalHandle   handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetMemoryStats(nullptr, &stats), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetMemoryStats(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasResetMemoryStats(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    EXPECT_LE(stats.workspaceBytes, stats.peakWorkspaceBytes);
+
+    // Reserving more workspace than the handle holds allocates it, and is timed
+    size_t reserve = stats.workspaceBytes + (size_t(16) << 20);
+    CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, reserve));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    EXPECT_GE(stats.workspaceBytes, reserve);
+    EXPECT_GE(stats.peakWorkspaceBytes, stats.workspaceBytes);
+    EXPECT_GT(stats.allocTimeUs, 0.0);
+
+    // Resetting keeps the workspace, and starts the peak from it
+    size_t workspace = stats.workspaceBytes;
+    CHECK_HIPBLAS_ERROR(hipblasResetMemoryStats(handle));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    EXPECT_EQ(workspace, stats.workspaceBytes);
+    EXPECT_EQ(workspace, stats.peakWorkspaceBytes);
+    EXPECT_EQ(0u, stats.growthCount);
+    EXPECT_EQ(0.0, stats.allocTimeUs);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasPackedConversionModel = ArgumentModel<e_uplo, e_N, e_K, e_lda, e_batch_count>;
+
+inline void testname_packed_conversion(const Arguments& arg, std::string& name)
+{
+    hipblasPackedConversionModel{}.test_name(arg, name);
+}
+
+// Tests tpttr, trttp, gb2ge and ge2gb, in their batched and strided batched forms, on n by n
+// matrices. The band matrices are triangular, with K diagonals off the main one in the uplo
+// triangle, and lda is the leading dimension of their band storage.
+template <typename T>
+inline hipblasStatus_t testing_packed_conversion(const Arguments& arg)
+{
+    bool              upper       = arg.uplo == 'U';
+    hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
+    int               N           = arg.N;
+    int               K           = arg.K;
+    int               ldab        = arg.lda;
+    int               batch_count = arg.batch_count;
+    int               kl          = upper ? 0 : K;
+    int               ku          = upper ? K : 0;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || K < 0 || ldab < K + 1 || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGb2geStridedBatched<T>(
+            handle, N, N, kl, ku, nullptr, ldab, 0, nullptr, std::max(N, 1), 0, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    hipblasStride stride_A  = size_t(N) * N;
+    hipblasStride stride_AP = size_t(N) * (N + 1) / 2;
+    hipblasStride stride_AB = size_t(ldab) * N;
+    size_t        A_size    = stride_A * batch_count;
+    size_t        AP_size   = stride_AP * batch_count;
+    size_t        AB_size   = stride_AB * batch_count;
+
+    double gpu_time_used;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(A_size);
+    host_vector<T> hA_tri(A_size);
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hAB_init(AB_size);
+    host_vector<T> hAB_gold(AB_size);
+    host_vector<T> hA_res(A_size);
+    host_vector<T> hAP_res(AP_size);
+    host_vector<T> hAB_res(AB_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(A_size);
+    device_vector<T> dAP(AP_size);
+    device_vector<T> dAB(AB_size);
+    device_vector<T> dA_res(A_size);
+    device_vector<T> dAP_res(AP_size);
+    device_vector<T> dAB_res(AB_size);
+
+    host_batch_vector<T>   hA_batch(stride_A, 1, batch_count);
+    host_batch_vector<T>   hAP_batch(stride_AP, 1, batch_count);
+    host_batch_vector<T>   hAB_batch(stride_AB, 1, batch_count);
+    device_batch_vector<T> dA_batch(stride_A, 1, batch_count);
+    device_batch_vector<T> dAP_batch(stride_AP, 1, batch_count);
+    device_batch_vector<T> dAB_batch(stride_AB, 1, batch_count);
+
+    CHECK_HIP_ERROR(dA_batch.memcheck());
+    CHECK_HIP_ERROR(dAP_batch.memcheck());
+    CHECK_HIP_ERROR(dAB_batch.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, N, N, N, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(
+        hAB_init, arg, ldab, N, ldab, stride_AB, batch_count, hipblas_client_never_set_nan);
+
+    hB       = hA;
+    hAB_gold = hAB_init;
+    std::fill(hA_tri.begin(), hA_tri.end(), T(0));
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A  = hA + b * stride_A;
+        T* B  = hB + b * stride_A;
+        T* At = hA_tri + b * stride_A;
+
+        regular_to_packed(upper, (const T*)A, hAP + b * stride_AP, N);
+        banded_matrix_setup(upper, B, N, N, K);
+        regular_to_banded(upper, (const T*)B, N, hAB + b * stride_AB, ldab, N, K);
+
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = upper ? 0 : j; i < (upper ? j + 1 : N); i++)
+                At[i + j * N] = A[i + j * N];
+            for(int i = std::max(0, j - ku); i <= std::min(N - 1, j + kl); i++)
+                hAB_gold[b * stride_AB + j * ldab + ku + i - j] = A[i + j * N];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP, sizeof(T) * AP_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB, sizeof(T) * AB_size, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        // tpttr writes the uplo triangle only, and gb2ge the whole matrix
+        CHECK_HIP_ERROR(hipMemset(dA_res, 0, sizeof(T) * A_size));
+        CHECK_HIPBLAS_ERROR(hipblasTpttrStridedBatched<T>(
+            handle, uplo, N, dAP, stride_AP, dA_res, N, stride_A, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hA_res, dA_res, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+        unit_check_general<T>(N, N, batch_count, N, stride_A, hA_tri, hA_res);
+
+        CHECK_HIPBLAS_ERROR(hipblasTrttpStridedBatched<T>(
+            handle, uplo, N, dA, N, stride_A, dAP_res, stride_AP, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hAP_res, dAP_res, sizeof(T) * AP_size, hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, stride_AP, batch_count, 1, stride_AP, hAP, hAP_res);
+
+        CHECK_HIP_ERROR(hipMemcpy(dA_res, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGb2geStridedBatched<T>(
+            handle, N, N, kl, ku, dAB, ldab, stride_AB, dA_res, N, stride_A, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hA_res, dA_res, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+        unit_check_general<T>(N, N, batch_count, N, stride_A, hB, hA_res);
+
+        CHECK_HIP_ERROR(hipMemcpy(dAB_res, hAB_init, sizeof(T) * AB_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGe2gbStridedBatched<T>(
+            handle, N, N, kl, ku, dA, N, stride_A, dAB_res, ldab, stride_AB, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hAB_res, dAB_res, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+        unit_check_general<T>(ldab, N, batch_count, ldab, stride_AB, hAB_gold, hAB_res);
+
+        // The batched forms, on the same matrices
+        auto to_batch = [&](host_batch_vector<T>& h, const T* s, hipblasStride stride) {
+            for(int b = 0; b < batch_count; b++)
+                std::copy(s + b * stride, s + (b + 1) * stride, (T*)h[b]);
+        };
+        auto check_batch
+            = [&](host_batch_vector<T>& h, const T* gold, hipblasStride stride, int m, int ld) {
+                  for(int b = 0; b < batch_count; b++)
+                      unit_check_general<T>(m, stride / ld, ld, (T*)gold + b * stride, h[b]);
+              };
+
+        for(int b = 0; b < batch_count; b++)
+            std::fill((T*)hA_batch[b], (T*)hA_batch[b] + stride_A, T(0));
+        to_batch(hAP_batch, hAP, stride_AP);
+        CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+        CHECK_HIP_ERROR(dAP_batch.transfer_from(hAP_batch));
+        CHECK_HIPBLAS_ERROR(hipblasTpttrBatched<T>(
+            handle, uplo, N, dAP_batch.ptr_on_device(), dA_batch.ptr_on_device(), N, batch_count));
+        CHECK_HIP_ERROR(hA_batch.transfer_from(dA_batch));
+        check_batch(hA_batch, hA_tri, stride_A, N, N);
+
+        to_batch(hA_batch, hA, stride_A);
+        CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+        CHECK_HIPBLAS_ERROR(hipblasTrttpBatched<T>(
+            handle, uplo, N, dA_batch.ptr_on_device(), N, dAP_batch.ptr_on_device(), batch_count));
+        CHECK_HIP_ERROR(hAP_batch.transfer_from(dAP_batch));
+        check_batch(hAP_batch, hAP, stride_AP, 1, 1);
+
+        to_batch(hAB_batch, hAB, stride_AB);
+        CHECK_HIP_ERROR(dAB_batch.transfer_from(hAB_batch));
+        CHECK_HIPBLAS_ERROR(hipblasGb2geBatched<T>(handle,
+                                                   N,
+                                                   N,
+                                                   kl,
+                                                   ku,
+                                                   dAB_batch.ptr_on_device(),
+                                                   ldab,
+                                                   dA_batch.ptr_on_device(),
+                                                   N,
+                                                   batch_count));
+        CHECK_HIP_ERROR(hA_batch.transfer_from(dA_batch));
+        check_batch(hA_batch, hB, stride_A, N, N);
+
+        to_batch(hA_batch, hA, stride_A);
+        to_batch(hAB_batch, hAB_init, stride_AB);
+        CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+        CHECK_HIP_ERROR(dAB_batch.transfer_from(hAB_batch));
+        CHECK_HIPBLAS_ERROR(hipblasGe2gbBatched<T>(handle,
+                                                   N,
+                                                   N,
+                                                   kl,
+                                                   ku,
+                                                   dA_batch.ptr_on_device(),
+                                                   N,
+                                                   dAB_batch.ptr_on_device(),
+                                                   ldab,
+                                                   batch_count));
+        CHECK_HIP_ERROR(hAB_batch.transfer_from(dAB_batch));
+        check_batch(hAB_batch, hAB_gold, stride_AB, ldab, ldab);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTpttrStridedBatched<T>(
+                handle, uplo, N, dAP, stride_AP, dA_res, N, stride_A, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasPackedConversionModel{}.log_args<T>(
+            std::cout, arg, gpu_time_used, 0, tpttr_gbyte_count<T>(N));
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasPackedModeModel = ArgumentModel<e_uplo, e_transA, e_diag, e_N>;
+
+inline void testname_packed_mode(const Arguments& arg, std::string& name)
+{
+    hipblasPackedModeModel{}.test_name(arg, name);
+}
+
+// Times tpmv and tpsv in HIPBLAS_PACKED_MODE_DEFAULT and HIPBLAS_PACKED_MODE_UNPACK, one line
+// for each, followed by the speedup of the unpack mode, so that it is set only where it wins.
+// The results of the two modes are compared with unit_check or norm_check.
+template <typename T>
+inline hipblasStatus_t testing_packed_mode(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                N      = arg.N;
+    size_t             A_size = size_t(N) * (N + 1) / 2;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N <= 0)
+        return N < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+
+    // The mode is offered only where the backend unpacks AP in one call
+    hipblasStatus_t status = hipblasSetPackedMode(handle, HIPBLAS_PACKED_MODE_UNPACK);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hx(N);
+    host_vector<T> hres[2] = {host_vector<T>(N), host_vector<T>(N)};
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dx(N);
+
+    // Diagonally dominant, so that tpsv is well conditioned
+    hipblas_init_matrix(hA, arg, A_size, 1, 1, 0, 1, hipblas_client_never_set_nan, true, false);
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    for(int j = 0; j < N; j++)
+    {
+        size_t diagonal = uplo == HIPBLAS_FILL_MODE_UPPER ? size_t(j) * (j + 3) / 2
+                                                          : size_t(j) * (2 * N - j + 1) / 2;
+        hA[diagonal] += T(N);
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    const hipblasPackedMode_t modes[2] = {HIPBLAS_PACKED_MODE_DEFAULT, HIPBLAS_PACKED_MODE_UNPACK};
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int m = 0; m < 2; m++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPackedMode(handle, modes[m]));
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasTpmv<T>(handle, uplo, transA, diag, N, dA, dx, 1));
+            CHECK_HIPBLAS_ERROR(hipblasTpsv<T>(handle, uplo, transA, diag, N, dA, dx, 1));
+            CHECK_HIP_ERROR(hipMemcpy(hres[m].data(), dx, sizeof(T) * N, hipMemcpyDeviceToHost));
+        }
+
+        double tolerance = std::numeric_limits<real_t<T>>::epsilon() * N;
+        unit_check_error(norm_check_general<T>('F', 1, N, 1, hres[0], hres[1]), tolerance);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+        double gpu_time_used[2][2];
+        for(int m = 0; m < 2; m++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPackedMode(handle, modes[m]));
+            for(int tpsv = 0; tpsv < 2; tpsv++)
+            {
+                int runs = arg.cold_iters + arg.iters;
+                for(int iter = 0; iter < runs; iter++)
+                {
+                    if(iter == arg.cold_iters)
+                        gpu_time_used[m][tpsv] = get_time_us_sync(stream);
+
+                    if(tpsv)
+                        CHECK_HIPBLAS_ERROR(
+                            hipblasTpsv<T>(handle, uplo, transA, diag, N, dA, dx, 1));
+                    else
+                        CHECK_HIPBLAS_ERROR(
+                            hipblasTpmv<T>(handle, uplo, transA, diag, N, dA, dx, 1));
+                }
+                gpu_time_used[m][tpsv] = get_time_us_sync(stream) - gpu_time_used[m][tpsv];
+
+                std::cout << (tpsv ? "tpsv" : "tpmv") << " in "
+                          << (m ? "HIPBLAS_PACKED_MODE_UNPACK" : "HIPBLAS_PACKED_MODE_DEFAULT")
+                          << std::endl;
+                hipblasPackedModeModel{}.log_args<T>(
+                    std::cout,
+                    arg,
+                    gpu_time_used[m][tpsv],
+                    tpsv ? tpsv_gflop_count<T>(N) : tpmv_gflop_count<T>(N),
+                    tpsv ? tpsv_gbyte_count<T>(N) : tpmv_gbyte_count<T>(N));
+            }
+        }
+
+        std::cout << "unpack-speedup-tpmv,unpack-speedup-tpsv\n"
+                  << gpu_time_used[0][0] / gpu_time_used[1][0] << ", "
+                  << gpu_time_used[0][1] / gpu_time_used[1][1] << std::endl;
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+struct rank_update_deferred_fns;
+
+template <>
+struct rank_update_deferred_fns<float>
+{
+    static constexpr auto ger = hipblasSgerDeferred;
+    static constexpr auto syr = hipblasSsyrDeferred;
+};
+
+template <>
+struct rank_update_deferred_fns<double>
+{
+    static constexpr auto ger = hipblasDgerDeferred;
+    static constexpr auto syr = hipblasDsyrDeferred;
+};
+
+inline void testname_rank_update_deferred(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_rank_update_deferred(const Arguments& arg)
+{
+    using Fns = rank_update_deferred_fns<T>;
+
+    // More updates than the block size, so that some are applied as a block and the rest on flush
+    const int block_size = 4, updates = 10;
+    const int M = 13, N = 7, lda = 15, incx = 2, incy = -1;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hA(size_t(lda) * N), hA_cpu(size_t(lda) * N), hA_gpu(size_t(lda) * N);
+    host_vector<T> hS(size_t(lda) * M), hS_cpu(size_t(lda) * M), hS_gpu(size_t(lda) * M);
+    host_vector<T> hx(size_t(M) * incx * updates), hy(size_t(N) * -incy * updates);
+    host_vector<T> halpha(updates);
+
+    device_vector<T> dA(hA.size()), dS(hS.size()), dx(hx.size()), dy(hy.size());
+    device_vector<T> dalpha(updates);
+
+    hipblas_init(hA, true);
+    hipblas_init(hS);
+    hipblas_init(hx);
+    hipblas_init(hy);
+    for(int u = 0; u < updates; u++)
+        halpha[u] = T(u % 3 - 1) * T(0.5) + T(u % 2);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dS, hS, sizeof(T) * hS.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * hy.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, halpha, sizeof(T) * updates, hipMemcpyHostToDevice));
+
+    int block_size_default = 0, block_size_get = 0;
+    CHECK_HIPBLAS_ERROR(hipblasGetRankUpdateBlockSize(handle, &block_size_default));
+    EXPECT_EQ(64, block_size_default);
+    CHECK_HIPBLAS_ERROR(hipblasSetRankUpdateBlockSize(handle, block_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetRankUpdateBlockSize(handle, &block_size_get));
+    EXPECT_EQ(block_size, block_size_get);
+
+    /* =====================================================================
+           HIPBLAS: ger with alpha on the host, then syr with alpha on the device, which applies
+           the pending ger updates as it is to another matrix
+    =================================================================== */
+    hA_cpu = hA;
+    hS_cpu = hS;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    for(int u = 0; u < updates; u++)
+    {
+        T* x = dx + size_t(M) * incx * u;
+        T* y = dy + size_t(N) * -incy * u;
+        CHECK_HIPBLAS_ERROR(Fns::ger(handle, M, N, &halpha[u], x, incx, y, incy, dA, lda));
+        cblas_ger<T, false>(M,
+                            N,
+                            halpha[u],
+                            hx + size_t(M) * incx * u,
+                            incx,
+                            hy + size_t(N) * -incy * u,
+                            incy,
+                            hA_cpu,
+                            lda);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    for(int u = 0; u < updates; u++)
+    {
+        T* x = dx + size_t(M) * incx * u;
+        CHECK_HIPBLAS_ERROR(
+            Fns::syr(handle, HIPBLAS_FILL_MODE_LOWER, M, dalpha + u, x, incx, dS, lda));
+        cblas_syr<T>(
+            HIPBLAS_FILL_MODE_LOWER, M, halpha[u], hx + size_t(M) * incx * u, incx, hS_cpu, lda);
+    }
+    CHECK_HIPBLAS_ERROR(hipblasFlushRankUpdates(handle));
+
+    CHECK_HIP_ERROR(hipMemcpy(hA_gpu, dA, sizeof(T) * hA.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hS_gpu, dS, sizeof(T) * hS.size(), hipMemcpyDeviceToHost));
+
+    // The upper triangle of S is left alone, as syr leaves it
+    double e = double(std::numeric_limits<T>::epsilon()) * updates;
+    unit_check_error(norm_check_general<T>('F', M, N, lda, hA_cpu, hA_gpu), e);
+    unit_check_error(norm_check_general<T>('F', M, M, lda, hS_cpu, hS_gpu), e);
+
+    /* =====================================================================
+           Invalid arguments
+    =================================================================== */
+    EXPECT_HIPBLAS_STATUS(hipblasSetRankUpdateBlockSize(handle, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasFlushRankUpdates(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(Fns::ger(nullptr, M, N, dalpha, dx, incx, dy, incy, dA, lda),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(Fns::ger(handle, M, N, dalpha, dx, incx, dy, incy, dA, M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(Fns::syr(handle, HIPBLAS_FILL_MODE_FULL, M, dalpha, dx, incx, dS, lda),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,413 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_batch_streams(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_batch_streams(const Arguments& arg)
+{
+    using T = double;
+
+    int numStreams;
+    int N           = 128;
+    int lda         = N;
+    int batch_count = 200;
+
+    size_t A_size    = size_t(lda) * N;
+    size_t Ipiv_size = size_t(N) * batch_count;
+
+    hipblasLocalHandle handle(arg);
+    hipblasLocalHandle handle_split(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchStreams(handle_split, &numStreams));
+    EXPECT_EQ(1, numStreams);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchStreams(handle_split, 4));
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchStreams(handle_split, &numStreams));
+    EXPECT_EQ(4, numStreams);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetBatchStreams(handle_split, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchStreams(handle_split, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The batch is large enough to be split across all four streams, and the factors match those
+    // of the unsplit call
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA1(A_size, 1, batch_count);
+    host_batch_vector<T> hA2(A_size, 1, batch_count);
+    host_vector<int>     hIpiv1(Ipiv_size);
+    host_vector<int>     hIpiv2(Ipiv_size);
+    host_vector<int>     hInfo1(batch_count);
+    host_vector<int>     hInfo2(batch_count);
+
+    device_batch_vector<T> dA1(A_size, 1, batch_count);
+    device_batch_vector<T> dA2(A_size, 1, batch_count);
+    device_vector<int>     dIpiv1(Ipiv_size);
+    device_vector<int>     dIpiv2(Ipiv_size);
+    device_vector<int>     dInfo1(batch_count);
+    device_vector<int>     dInfo2(batch_count);
+
+    hipblas_init(hA, true);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < N; i++)
+            hA[b][i + i * lda] += 400;
+
+    CHECK_HIP_ERROR(dA1.transfer_from(hA));
+    CHECK_HIP_ERROR(dA2.transfer_from(hA));
+
+    CHECK_HIPBLAS_ERROR(
+        hipblasDgetrfBatched(handle, N, dA1.ptr_on_device(), lda, dIpiv1, dInfo1, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasDgetrfBatched(
+        handle_split, N, dA2.ptr_on_device(), lda, dIpiv2, dInfo2, batch_count));
+
+    CHECK_HIP_ERROR(hA1.transfer_from(dA1));
+    CHECK_HIP_ERROR(hA2.transfer_from(dA2));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hIpiv1.data(), dIpiv1, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hIpiv2.data(), dIpiv2, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo1.data(), dInfo1, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo2.data(), dInfo2, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    double error = norm_check_general<T>('F', N, N, lda, hA1, hA2, batch_count);
+    unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    unit_check_general<int>(1, Ipiv_size, 1, hIpiv1, hIpiv2);
+    unit_check_general<int>(1, batch_count, 1, hInfo1, hInfo2);
+
+    // getrs with the factors of the unsplit getrf, whose pivots for problem i start at
+    // ipiv + i * N. nrhs is large enough for the batch to be split across all four streams.
+    int    nrhs   = 64;
+    int    ldb    = N;
+    size_t B_size = size_t(ldb) * nrhs;
+
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hB1(B_size, 1, batch_count);
+    host_batch_vector<T> hB2(B_size, 1, batch_count);
+
+    device_batch_vector<T> dB1(B_size, 1, batch_count);
+    device_batch_vector<T> dB2(B_size, 1, batch_count);
+
+    hipblas_init(hB);
+    CHECK_HIP_ERROR(dB1.transfer_from(hB));
+    CHECK_HIP_ERROR(dB2.transfer_from(hB));
+
+    int info1 = -1, info2 = -1;
+    CHECK_HIPBLAS_ERROR(hipblasDgetrsBatched(handle,
+                                             HIPBLAS_OP_N,
+                                             N,
+                                             nrhs,
+                                             dA1.ptr_on_device(),
+                                             lda,
+                                             dIpiv1,
+                                             dB1.ptr_on_device(),
+                                             ldb,
+                                             &info1,
+                                             batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasDgetrsBatched(handle_split,
+                                             HIPBLAS_OP_N,
+                                             N,
+                                             nrhs,
+                                             dA1.ptr_on_device(),
+                                             lda,
+                                             dIpiv1,
+                                             dB2.ptr_on_device(),
+                                             ldb,
+                                             &info2,
+                                             batch_count));
+
+    CHECK_HIP_ERROR(hB1.transfer_from(dB1));
+    CHECK_HIP_ERROR(hB2.transfer_from(dB2));
+
+    error = norm_check_general<T>('F', N, nrhs, ldb, hB1, hB2, batch_count);
+    unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    EXPECT_EQ(info1, info2);
+
+    // gels on fresh copies of A and B, with deviceInfo + i for problem i
+    CHECK_HIP_ERROR(dA1.transfer_from(hA));
+    CHECK_HIP_ERROR(dA2.transfer_from(hA));
+    CHECK_HIP_ERROR(dB1.transfer_from(hB));
+    CHECK_HIP_ERROR(dB2.transfer_from(hB));
+
+    CHECK_HIPBLAS_ERROR(hipblasDgelsBatched(handle,
+                                            HIPBLAS_OP_N,
+                                            N,
+                                            N,
+                                            nrhs,
+                                            dA1.ptr_on_device(),
+                                            lda,
+                                            dB1.ptr_on_device(),
+                                            ldb,
+                                            &info1,
+                                            dInfo1,
+                                            batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasDgelsBatched(handle_split,
+                                            HIPBLAS_OP_N,
+                                            N,
+                                            N,
+                                            nrhs,
+                                            dA2.ptr_on_device(),
+                                            lda,
+                                            dB2.ptr_on_device(),
+                                            ldb,
+                                            &info2,
+                                            dInfo2,
+                                            batch_count));
+
+    CHECK_HIP_ERROR(hA1.transfer_from(dA1));
+    CHECK_HIP_ERROR(hA2.transfer_from(dA2));
+    CHECK_HIP_ERROR(hB1.transfer_from(dB1));
+    CHECK_HIP_ERROR(hB2.transfer_from(dB2));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo1.data(), dInfo1, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo2.data(), dInfo2, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    error = norm_check_general<T>('F', N, N, lda, hA1, hA2, batch_count);
+    unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    error = norm_check_general<T>('F', N, nrhs, ldb, hB1, hB2, batch_count);
+    unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    unit_check_general<int>(1, batch_count, 1, hInfo1, hInfo2);
+    EXPECT_EQ(info1, info2);
+
+    // The strided batched functions, with gaps between the matrices and between the pivots of
+    // consecutive problems, so that each sub-batch starts at i * strideA, i * strideB and
+    // i * strideP. Backends without them return HIPBLAS_STATUS_NOT_SUPPORTED split or not.
+    hipblasStride strideA = A_size + 7;
+    hipblasStride strideB = B_size + 3;
+    hipblasStride strideP = N + 5;
+    size_t        As_size = strideA * batch_count;
+    size_t        Bs_size = strideB * batch_count;
+    size_t        Ps_size = strideP * batch_count;
+
+    host_vector<T>   hAs(As_size);
+    host_vector<T>   hBs(Bs_size);
+    host_vector<T>   hAs1(As_size);
+    host_vector<T>   hAs2(As_size);
+    host_vector<T>   hBs1(Bs_size);
+    host_vector<T>   hBs2(Bs_size);
+    host_vector<int> hIpivs1(Ps_size);
+    host_vector<int> hIpivs2(Ps_size);
+
+    device_vector<T>   dAs1(As_size);
+    device_vector<T>   dAs2(As_size);
+    device_vector<T>   dBs1(Bs_size);
+    device_vector<T>   dBs2(Bs_size);
+    device_vector<int> dIpivs1(Ps_size);
+    device_vector<int> dIpivs2(Ps_size);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA[b], hA[b] + A_size, hAs.data() + b * strideA);
+        std::copy(hB[b], hB[b] + B_size, hBs.data() + b * strideB);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dAs1, hAs.data(), As_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAs2, hAs.data(), As_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dIpivs1, 0, Ps_size * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dIpivs2, 0, Ps_size * sizeof(int)));
+
+    hipblasStatus_t status = hipblasDgetrfStridedBatched(
+        handle, N, dAs1, lda, strideA, dIpivs1, strideP, dInfo1, batch_count);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasDgetrfStridedBatched(
+            handle_split, N, dAs2, lda, strideA, dIpivs2, strideP, dInfo2, batch_count),
+        status);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hAs1.data(), dAs1, As_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hAs2.data(), dAs2, As_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hIpivs1.data(), dIpivs1, Ps_size * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hIpivs2.data(), dIpivs2, Ps_size * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo1, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo2.data(), dInfo2, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        error = norm_check_general<T>('F', N, N, lda, strideA, hAs1, hAs2, batch_count);
+        unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+        unit_check_general<int>(1, Ps_size, 1, hIpivs1, hIpivs2);
+        unit_check_general<int>(1, batch_count, 1, hInfo1, hInfo2);
+    }
+
+    // getrs with the factors of the unsplit strided getrf
+    CHECK_HIP_ERROR(hipMemcpy(dBs1, hBs.data(), Bs_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBs2, hBs.data(), Bs_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        status = hipblasDgetrsStridedBatched(handle,
+                                             HIPBLAS_OP_N,
+                                             N,
+                                             nrhs,
+                                             dAs1,
+                                             lda,
+                                             strideA,
+                                             dIpivs1,
+                                             strideP,
+                                             dBs1,
+                                             ldb,
+                                             strideB,
+                                             &info1,
+                                             batch_count);
+        EXPECT_HIPBLAS_STATUS(hipblasDgetrsStridedBatched(handle_split,
+                                                          HIPBLAS_OP_N,
+                                                          N,
+                                                          nrhs,
+                                                          dAs1,
+                                                          lda,
+                                                          strideA,
+                                                          dIpivs1,
+                                                          strideP,
+                                                          dBs2,
+                                                          ldb,
+                                                          strideB,
+                                                          &info2,
+                                                          batch_count),
+                              status);
+    }
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hBs1.data(), dBs1, Bs_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hBs2.data(), dBs2, Bs_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        error = norm_check_general<T>('F', N, nrhs, ldb, strideB, hBs1, hBs2, batch_count);
+        unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+        EXPECT_EQ(info1, info2);
+    }
+
+    // gels on fresh copies of A and B
+    CHECK_HIP_ERROR(hipMemcpy(dAs1, hAs.data(), As_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAs2, hAs.data(), As_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBs1, hBs.data(), Bs_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBs2, hBs.data(), Bs_size * sizeof(T), hipMemcpyHostToDevice));
+
+    status = hipblasDgelsStridedBatched(handle,
+                                        HIPBLAS_OP_N,
+                                        N,
+                                        N,
+                                        nrhs,
+                                        dAs1,
+                                        lda,
+                                        strideA,
+                                        dBs1,
+                                        ldb,
+                                        strideB,
+                                        &info1,
+                                        dInfo1,
+                                        batch_count);
+    EXPECT_HIPBLAS_STATUS(hipblasDgelsStridedBatched(handle_split,
+                                                     HIPBLAS_OP_N,
+                                                     N,
+                                                     N,
+                                                     nrhs,
+                                                     dAs2,
+                                                     lda,
+                                                     strideA,
+                                                     dBs2,
+                                                     ldb,
+                                                     strideB,
+                                                     &info2,
+                                                     dInfo2,
+                                                     batch_count),
+                          status);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hAs1.data(), dAs1, As_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hAs2.data(), dAs2, As_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hBs1.data(), dBs1, Bs_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hBs2.data(), dBs2, Bs_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo1, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo2.data(), dInfo2, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        error = norm_check_general<T>('F', N, N, lda, strideA, hAs1, hAs2, batch_count);
+        unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+        error = norm_check_general<T>('F', N, nrhs, ldb, strideB, hBs1, hBs2, batch_count);
+        unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+        unit_check_general<int>(1, batch_count, 1, hInfo1, hInfo2);
+        EXPECT_EQ(info1, info2);
+    }
+
+    // The sub-handles take the workspace allocation mode of the handle
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetWorkspaceAllocMode(handle_split, HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED));
+    CHECK_HIP_ERROR(dA2.transfer_from(hA));
+    CHECK_HIPBLAS_ERROR(hipblasDgetrfBatched(
+        handle_split, N, dA2.ptr_on_device(), lda, dIpiv2, dInfo2, batch_count));
+    CHECK_HIP_ERROR(dA1.transfer_from(hA));
+    CHECK_HIPBLAS_ERROR(
+        hipblasDgetrfBatched(handle, N, dA1.ptr_on_device(), lda, dIpiv1, dInfo1, batch_count));
+    CHECK_HIP_ERROR(hA1.transfer_from(dA1));
+    CHECK_HIP_ERROR(hA2.transfer_from(dA2));
+
+    error = norm_check_general<T>('F', N, N, lda, hA1, hA2, batch_count);
+    unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetWorkspaceAllocMode(handle_split, HIPBLAS_WORKSPACE_ALLOC_DEFAULT));
+
+    // In HIPBLAS_CAPTURE_MODE_SAFE the call is made unsplit, within the workspace of the handle,
+    // which may be too small for it
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle_split, HIPBLAS_CAPTURE_MODE_SAFE));
+    CHECK_HIP_ERROR(dA2.transfer_from(hA));
+    status = hipblasDgetrfBatched(
+        handle_split, N, dA2.ptr_on_device(), lda, dIpiv2, dInfo2, batch_count);
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle_split, HIPBLAS_CAPTURE_MODE_DEFAULT));
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIP_ERROR(hA2.transfer_from(dA2));
+        error = norm_check_general<T>('F', N, N, lda, hA1, hA2, batch_count);
+        unit_check_error(error, std::numeric_limits<T>::epsilon() * 100);
+    }
+
+    // Back to a single stream
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchStreams(handle_split, 1));
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchStreams(handle_split, &numStreams));
+    EXPECT_EQ(1, numStreams);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_capture_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_capture_mode(const Arguments& arg)
+{
+    hipblasCaptureMode_t mode;
+    const char*          message;
+    hipblasLocalHandle   handle(arg);
+
+    int                  N = 100;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N);
+    device_vector<float> d_result(1);
+    float                h_result;
+
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    // Workspace can be reserved up front
+    CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, 1 << 20));
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_SAFE, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureDiagnostic(handle, &message));
+    EXPECT_EQ(std::string(), std::string(message));
+
+    // Results returned to host memory are rejected in safe mode, and the call is recorded
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    EXPECT_HIPBLAS_STATUS(hipblasSnrm2(handle, N, dx, 1, &h_result),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureDiagnostic(handle, &message));
+    EXPECT_NE(std::string::npos, std::string(message).find("hipblasSnrm2"));
+
+    // Results returned to device memory are fine
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, N, dx, 1, d_result));
+
+    // Setting the mode clears the diagnostic
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureDiagnostic(handle, &message));
+    EXPECT_EQ(std::string(), std::string(message));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, N, dx, 1, &h_result));
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetCaptureMode(handle, hipblasCaptureMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_gemm_ex_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_gemm_ex_mode(const Arguments& arg)
+{
+    using T = float;
+
+    hipblasGemmExMode_t mode;
+    hipblasLocalHandle  handle(arg);
+
+    int M = 128, N = 96, K = 160;
+    int lda = K, ldb = K, ldc = M;
+    T   alpha = 1, beta = 0.5;
+
+    size_t size_A = size_t(lda) * M;
+    size_t size_B = size_t(ldb) * N;
+    size_t size_C = size_t(ldc) * N;
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_default(size_C);
+    host_vector<T> hC_lt(size_C);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    hipblas_init_matrix(hA, arg, K, M, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, ldb, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmExMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_GEMM_EX_MODE_DEFAULT, mode);
+
+    // C = alpha * A^T * B + beta * C with the scalars on the host, then twice on the device so
+    // that the second call reuses the plan of the first
+    auto gemm_ex = [&](host_vector<T>& hC_result) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                          HIPBLAS_OP_T,
+                                          HIPBLAS_OP_N,
+                                          M,
+                                          N,
+                                          K,
+                                          &alpha,
+                                          dA,
+                                          HIP_R_32F,
+                                          lda,
+                                          dB,
+                                          HIP_R_32F,
+                                          ldb,
+                                          &beta,
+                                          dC,
+                                          HIP_R_32F,
+                                          ldc,
+                                          HIPBLAS_COMPUTE_32F,
+                                          HIPBLAS_GEMM_DEFAULT));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        for(int i = 0; i < 2; i++)
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                              HIPBLAS_OP_T,
+                                              HIPBLAS_OP_N,
+                                              M,
+                                              N,
+                                              K,
+                                              d_alpha,
+                                              dA,
+                                              HIP_R_32F,
+                                              lda,
+                                              dB,
+                                              HIP_R_32F,
+                                              ldb,
+                                              d_beta,
+                                              dC,
+                                              HIP_R_32F,
+                                              ldc,
+                                              HIPBLAS_COMPUTE_32F,
+                                              HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(hipMemcpy(hC_result, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+    };
+
+    gemm_ex(hC_default);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmExMode(handle, HIPBLAS_GEMM_EX_MODE_LT));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmExMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_GEMM_EX_MODE_LT, mode);
+
+    gemm_ex(hC_lt);
+
+    // The algorithms may differ, so the results match to the rounding of the sums over K
+    double error = norm_check_general<T>('F', M, N, ldc, hC_default, hC_lt);
+    unit_check_error(error, double(std::numeric_limits<T>::epsilon()) * K);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmExMode(handle, HIPBLAS_GEMM_EX_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmExMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_GEMM_EX_MODE_DEFAULT, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmExMode(handle, hipblasGemmExMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmExMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSetGetMatrixBatchedAsyncModel
+    = ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc, e_batch_count>;
+
+inline void testname_set_get_matrix_batched_async(const Arguments& arg, std::string& name)
+{
+    hipblasSetGetMatrixBatchedAsyncModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_set_get_matrix_batched_async(const Arguments& arg)
+{
+    int rows        = arg.rows;
+    int cols        = arg.cols;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0 || lda < rows || ldb < rows
+       || ldc < rows || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size = size_t(lda) * cols;
+    size_t B_size = size_t(ldb) * cols;
+    size_t C_size = size_t(ldc) * cols;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> ha(A_size, 1, batch_count);
+    host_batch_vector<T> hb(B_size, 1, batch_count);
+    host_batch_vector<T> hb_ref(B_size, 1, batch_count);
+
+    device_batch_vector<T> dc(C_size, 1, batch_count);
+    CHECK_HIP_ERROR(dc.memcheck());
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // Initial Data on CPU
+    hipblas_init_vector(ha, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hb, arg, hipblas_client_never_set_nan);
+    hb_ref.copy_from(hb);
+
+    // The arrays of pointers are passed in host memory
+    const void* const* ha_ptrs = (const void* const*)(T**)ha;
+    void* const*       hb_ptrs = (void* const*)(T**)hb;
+    const void* const* dc_ptrs = (const void* const*)(T**)dc;
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixBatchedAsync(
+        rows, cols, sizeof(T), ha_ptrs, lda, (void* const*)dc_ptrs, ldc, batch_count, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrixBatchedAsync(
+        rows, cols, sizeof(T), dc_ptrs, ldc, hb_ptrs, ldb, batch_count, stream));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int i1 = 0; i1 < rows; i1++)
+            {
+                for(int i2 = 0; i2 < cols; i2++)
+                {
+                    hb_ref[b][i1 + i2 * ldb] = ha[b][i1 + i2 * lda];
+                }
+            }
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, batch_count, ldb, hb_ref, hb);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', rows, cols, ldb, hb_ref, hb, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSetMatrixBatchedAsync(rows,
+                                                             cols,
+                                                             sizeof(T),
+                                                             ha_ptrs,
+                                                             lda,
+                                                             (void* const*)dc_ptrs,
+                                                             ldc,
+                                                             batch_count,
+                                                             stream));
+            CHECK_HIPBLAS_ERROR(hipblasGetMatrixBatchedAsync(
+                rows, cols, sizeof(T), dc_ptrs, ldc, hb_ptrs, ldb, batch_count, stream));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSetGetMatrixBatchedAsyncModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_batched_gbyte_count<T>(rows, cols, batch_count),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace_alloc_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_workspace_alloc_mode(const Arguments& arg)
+{
+    hipblasWorkspaceAllocMode_t mode;
+    uint64_t                    threshold;
+    hipblasMemoryStats_t        stats;
+    hipblasLocalHandle          handle(arg);
+
+    int                  N = 100;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N);
+    device_vector<float> d_result(1);
+
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAllocMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_DEFAULT, mode);
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceReleaseThreshold(handle, &threshold));
+    EXPECT_EQ(0u, threshold);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetWorkspaceAllocMode(handle, HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAllocMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceReleaseThreshold(handle, uint64_t(64) << 20));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceReleaseThreshold(handle, &threshold));
+    EXPECT_EQ(uint64_t(64) << 20, threshold);
+
+    // The workspace grows from the pool, twice so that the first is freed in stream order, and
+    // later calls run with it
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    size_t reserve = stats.workspaceBytes + (size_t(4) << 20);
+    for(int i = 1; i <= 2; i++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, reserve * i));
+        CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+        EXPECT_GE(stats.workspaceBytes, reserve * i);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, N, dx, 1, d_result));
+    }
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // On another stream, which waits for the work queued on the first before the workspace
+    // allocated on it is replaced and freed in the order of the new stream
+    hipStream_t other;
+    CHECK_HIP_ERROR(hipStreamCreate(&other));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, other));
+    CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, reserve * 3));
+    CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, N, dx, 1, d_result));
+    CHECK_HIP_ERROR(hipStreamSynchronize(other));
+
+    float h_result, h_norm = 0;
+    CHECK_HIP_ERROR(hipMemcpy(&h_result, d_result, sizeof(float), hipMemcpyDeviceToHost));
+    for(int i = 0; i < N; i++)
+        h_norm += hx[i] * hx[i];
+    h_norm = std::sqrt(h_norm);
+    EXPECT_NEAR(h_norm, h_result, h_norm * 1e-5);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(other));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceAllocMode(handle, HIPBLAS_WORKSPACE_ALLOC_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAllocMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_DEFAULT, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspaceAllocMode(handle, hipblasWorkspaceAllocMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceReleaseThreshold(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTbsv64Model = ArgumentModel<e_diag, e_M, e_K, e_lda, e_incx>;
+
+inline void testname_tbsv_64(const Arguments& arg, std::string& name)
+{
+    hipblasTbsv64Model{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_tbsv_64(const Arguments& arg)
+{
+    hipblasDiagType_t diag = char2hipblas_diagonal(arg.diag);
+    int64_t           M    = arg.M;
+    int64_t           K    = arg.K;
+    int64_t           incx = arg.incx;
+    int64_t           lda  = arg.lda;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || K < 0 || lda < K + 1 || !incx;
+    if(invalid_size || !M)
+    {
+        hipblasStatus_t actual = hipblasTbsv_64<T>(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_N, diag, M, K, nullptr, lda, nullptr, incx);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    int64_t abs_incx = incx < 0 ? -incx : incx;
+    size_t  size_A   = size_t(M) * M;
+    size_t  size_AB  = size_t(lda) * M;
+    size_t  size_x   = abs_incx * size_t(M);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hAB(size_AB);
+    host_vector<T> AAT(size_A);
+    host_vector<T> hb(size_x);
+    host_vector<T> hx(size_x);
+    host_vector<T> hx_whole(size_x);
+    host_vector<T> hx_split(size_x);
+
+    device_vector<T> dAB(size_AB);
+    device_vector<T> dx_or_b(size_x);
+
+    double gpu_time_used, hipblas_error = 0;
+
+    // Each fill and transpose splits in its own direction, and takes the elements it depends on
+    // from its own side of the split
+    for(hipblasFillMode_t uplo : {HIPBLAS_FILL_MODE_UPPER, HIPBLAS_FILL_MODE_LOWER})
+    {
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, size_A, 1, 1, 0, 1, hipblas_client_never_set_nan, true);
+        hipblas_init_vector(hx, arg, M, abs_incx, 0, 1, hipblas_client_never_set_nan, false, true);
+
+        banded_matrix_setup(uplo == HIPBLAS_FILL_MODE_UPPER, (T*)hA, M, M, K);
+
+        prepare_triangular_solve(
+            (T*)hA, M, (T*)AAT, M, uplo == HIPBLAS_FILL_MODE_UPPER ? 'U' : 'L');
+        if(diag == HIPBLAS_DIAG_UNIT)
+        {
+            make_unit_diagonal(uplo, (T*)hA, M, M);
+        }
+
+        regular_to_banded(uplo == HIPBLAS_FILL_MODE_UPPER, (T*)hA, M, (T*)hAB, lda, M, K);
+        CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * size_AB, hipMemcpyHostToDevice));
+
+        for(hipblasOperation_t transA : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+        {
+            hb = hx;
+            cblas_tbmv<T>(uplo, transA, diag, M, K, hAB, lda, hb, incx);
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(
+                hipMemcpy(dx_or_b, hb.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(
+                hipblasTbsv_64<T>(handle, uplo, transA, diag, M, K, dAB, lda, dx_or_b, incx));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hx_whole.data(), dx_or_b, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+
+            // Split into blocks as a vector longer than INT_MAX would be, solved one after another
+            // with the products of the blocks already solved subtracted through gbmv
+            CHECK_HIP_ERROR(
+                hipMemcpy(dx_or_b, hb.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+            hipblas_set_ilp64_chunk_size(7);
+            hipblasStatus_t split_status
+                = hipblasTbsv_64<T>(handle, uplo, transA, diag, M, K, dAB, lda, dx_or_b, incx);
+            hipblas_set_ilp64_chunk_size(0);
+            CHECK_HIPBLAS_ERROR(split_status);
+            CHECK_HIP_ERROR(
+                hipMemcpy(hx_split.data(), dx_or_b, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+
+            // Calculating error
+            double error_whole
+                = std::abs(vector_norm_1<T>(M, abs_incx, hx.data(), hx_whole.data()));
+            double error_split
+                = std::abs(vector_norm_1<T>(M, abs_incx, hx.data(), hx_split.data()));
+            hipblas_error = std::max(hipblas_error, std::max(error_whole, error_split));
+
+            if(arg.unit_check)
+            {
+                double tolerance = std::numeric_limits<real_t<T>>::epsilon() * 40 * M;
+                unit_check_error(error_whole, tolerance);
+                unit_check_error(error_split, tolerance);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTbsv_64<T>(handle,
+                                                  HIPBLAS_FILL_MODE_LOWER,
+                                                  HIPBLAS_OP_N,
+                                                  diag,
+                                                  M,
+                                                  K,
+                                                  dAB,
+                                                  lda,
+                                                  dx_or_b,
+                                                  incx));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasTbsv64Model{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         tbsv_gflop_count<T>(M, K),
+                                         tbsv_gbyte_count<T>(M, K),
+                                         hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
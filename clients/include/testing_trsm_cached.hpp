@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsmCachedModel
+    = ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>;
+
+inline void testname_trsm_cached(const Arguments& arg, std::string& name)
+{
+    hipblasTrsmCachedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_trsm_cached(const Arguments& arg)
+{
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int    K      = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    size_t A_size = size_t(lda) * K;
+    size_t B_size = size_t(ldb) * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_next(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_next(B_size);
+    host_vector<T> hB_host(B_size);
+    host_vector<T> hB_device(B_size);
+    host_vector<T> hB_next_result(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> d_alpha(1);
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device, hipblas_error_next;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, K, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+
+    // pad untouched area into zero
+    for(int i = K; i < lda; i++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = 0.0;
+        }
+    }
+    // proprocess the matrix to avoid ill-conditioned matrix
+    std::vector<int> ipiv(K);
+    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = i; j < K; j++)
+        {
+            hA[i + j * lda] = hA[j + i * lda];
+            if(diag == HIPBLAS_DIAG_UNIT)
+            {
+                if(i == j)
+                    hA[i + j * lda] = 1.0;
+            }
+        }
+    }
+
+    // The next version of A has its off-diagonal part halved, so that a stale inverse would give
+    // a wrong solution
+    hA_next = hA;
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            if(i != j)
+                hA_next[i + j * lda] = hA[i + j * lda] * T(0.5);
+        }
+    }
+
+    // pad untouched area into zero
+    for(int i = M; i < ldb; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            hB[i + j * ldb] = 0.0;
+        }
+    }
+    hB_gold = hB; // original solution hX
+    hB_next = hB;
+
+    // Calculate hB = hA*hX;
+    cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB, ldb);
+    cblas_trmm<T>(
+        side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA_next, lda, hB_next, ldb);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        // The first call computes the inverse, the second one reuses it
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmCached<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, 1));
+
+        CHECK_HIP_ERROR(hipMemcpy(hB_host, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmCached<T>(
+            handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, 1));
+
+        CHECK_HIP_ERROR(hipMemcpy(hB_device, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+        // New contents of A under a new version replace the cached inverse
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_next, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB_next, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmCached<T>(
+            handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, 2));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_next_result, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIPBLAS_ERROR(hipblasTrsmCacheInvalidate(handle, dA));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // if enable norm check, norm check is invasive; multiplying by the inverse is less
+        // accurate than substitution, hence the wider tolerance than for trsm
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 400 * K;
+
+        hipblas_error_host   = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_host);
+        hipblas_error_device = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_device);
+        hipblas_error_next   = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_next_result);
+        if(arg.unit_check)
+        {
+            unit_check_error(hipblas_error_host, tolerance);
+            unit_check_error(hipblas_error_device, tolerance);
+            unit_check_error(hipblas_error_next, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        // Only the first call computes the inverse; the others multiply by it
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTrsmCached<T>(
+                handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, 1));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasTrsmCachedModel{}.log_args<T>(std::cout,
+                                             arg,
+                                             gpu_time_used,
+                                             trsm_gflop_count<T>(M, N, K),
+                                             trsm_gbyte_count<T>(M, N, K),
+                                             hipblas_error_host,
+                                             hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_workspace_trim(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_workspace_trim(const Arguments& arg)
+{
+    hipblasMemoryStats_t         stats;
+    hipblasWorkspaceTrimPolicy_t policy;
+    hipblasLocalHandle           handle(arg);
+
+    size_t large  = size_t(64) << 20;
+    size_t target = size_t(1) << 20;
+
+    // The workspace is trimmed to the target in either allocation mode, and trimming a workspace
+    // which is already small enough leaves it alone
+    for(auto mode : {HIPBLAS_WORKSPACE_ALLOC_DEFAULT, HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceAllocMode(handle, mode));
+        CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, large));
+        CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+        EXPECT_GE(stats.workspaceBytes, large);
+
+        CHECK_HIPBLAS_ERROR(hipblasTrimWorkspace(handle, target));
+        CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+        EXPECT_LE(stats.workspaceBytes, target);
+        EXPECT_GE(stats.peakWorkspaceBytes, large);
+
+        size_t workspace = stats.workspaceBytes;
+        CHECK_HIPBLAS_ERROR(hipblasTrimWorkspace(handle, large));
+        CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+        EXPECT_EQ(workspace, stats.workspaceBytes);
+    }
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceTrimPolicy(handle, &policy));
+    EXPECT_EQ(0u, policy.callCount);
+    EXPECT_EQ(0u, policy.idleMs);
+
+    policy.callCount   = 10;
+    policy.idleMs      = 1000;
+    policy.targetBytes = target;
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceTrimPolicy(handle, &policy));
+
+    policy = {};
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceTrimPolicy(handle, &policy));
+    EXPECT_EQ(10u, policy.callCount);
+    EXPECT_EQ(1000u, policy.idleMs);
+    EXPECT_EQ(target, policy.targetBytes);
+
+    // The first getrf grows the workspace and the next two, which run in it, are counted, so the
+    // third trims it and the fourth grows it again
+    policy.callCount   = 2;
+    policy.idleMs      = 0;
+    policy.targetBytes = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceTrimPolicy(handle, &policy));
+    CHECK_HIPBLAS_ERROR(hipblasTrimWorkspace(handle, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    uint64_t growths = stats.growthCount;
+
+    int                   N = 512;
+    host_vector<double>   hA(size_t(N) * N);
+    device_vector<double> dA(size_t(N) * N);
+    device_vector<int>    dIpiv(N);
+    device_vector<int>    dInfo(1);
+
+    hipblas_init(hA, true);
+    for(int i = 0; i < N; i++)
+        hA[i + size_t(i) * N] += N;
+    for(int call = 0; call < 4; call++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * N * N, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasDgetrf(handle, N, dA, N, dIpiv, dInfo));
+    }
+    CHECK_HIPBLAS_ERROR(hipblasGetMemoryStats(handle, &stats));
+    if(stats.growthCount != growths)
+    {
+        EXPECT_EQ(growths + 2, stats.growthCount);
+        EXPECT_GT(stats.workspaceBytes, 0u);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceTrimPolicy(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceTrimPolicy(handle, &policy));
+    EXPECT_EQ(0u, policy.callCount);
+    EXPECT_EQ(0u, policy.idleMs);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrimWorkspace(nullptr, 0), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceTrimPolicy(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtSyrkModel
+    = ArgumentModel<e_uplo, e_transA, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>;
+
+inline void testname_xt_syrk(const Arguments& arg, std::string& name)
+{
+    hipblasXtSyrkModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xt_syrk(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldc    = arg.ldc;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int    K1     = (transA == HIPBLAS_OP_N ? K : N);
+    size_t A_size = size_t(lda) * K1;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: all matrices are in CPU (host) memory, hipblasXt moves the tiles to the devices
+    host_vector<T> hA(A_size);
+    host_vector<T> hC_stub(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double gpu_time_used, hipblas_error_stub, hipblas_error_device;
+
+    // see testing_xt_gemm for the choice of backends and tile size
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    int                  block_dim = std::max((std::max(N, K) + 2) / 3, 1);
+    hipblasXtLocalHandle stub(HIPBLASXT_BACKEND_STUB, 3, block_dim);
+    hipblasXtLocalHandle handle(HIPBLASXT_BACKEND_DEVICE, device_count, block_dim);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, N, K1, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hC_gold, arg, N, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    hC_stub   = hC_gold;
+    hC_device = hC_gold;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(
+            hipblasXtSyrk<T>(stub, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_stub, ldc));
+        CHECK_HIPBLAS_ERROR(hipblasXtSyrk<T>(
+            handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_device, ldc));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_syrk<T>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
+
+        // the triangle which is not referenced must be left untouched, so all of C is compared
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_stub);
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_device);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_stub   = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_stub);
+            hipblas_error_device = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        // hipblasXt calls return once C is back in host memory
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblasXtSyrk<T>(
+                handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_device, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used; // in microseconds
+
+        hipblasXtSyrkModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         syrk_gflop_count<T>(N, K),
+                                         syrk_gbyte_count<T>(N, K),
+                                         hipblas_error_stub,
+                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtTrsmModel
+    = ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>;
+
+inline void testname_xt_trsm(const Arguments& arg, std::string& name)
+{
+    hipblasXtTrsmModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xt_trsm(const Arguments& arg)
+{
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int    K      = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    size_t A_size = size_t(lda) * K;
+    size_t B_size = size_t(ldb) * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: all matrices are in CPU (host) memory, hipblasXt moves the tiles to the devices
+    host_vector<T> hA(A_size);
+    host_vector<T> hB_stub(B_size);
+    host_vector<T> hB_device(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    double gpu_time_used, hipblas_error_stub, hipblas_error_device;
+
+    // see testing_xt_gemm for the choice of backends and tile size
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    int                  block_dim = std::max((std::max(M, N) + 2) / 3, 1);
+    hipblasXtLocalHandle stub(HIPBLASXT_BACKEND_STUB, 3, block_dim);
+    hipblasXtLocalHandle handle(HIPBLASXT_BACKEND_DEVICE, device_count, block_dim);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, K, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB_gold, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+
+    // pad untouched area into zero
+    for(int i = K; i < lda; i++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = 0.0;
+        }
+    }
+    // proprocess the matrix to avoid ill-conditioned matrix
+    std::vector<int> ipiv(K);
+    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = i; j < K; j++)
+        {
+            hA[i + j * lda] = hA[j + i * lda];
+            if(diag == HIPBLAS_DIAG_UNIT)
+            {
+                if(i == j)
+                    hA[i + j * lda] = 1.0;
+            }
+        }
+    }
+
+    // pad untouched area into zero
+    for(int i = M; i < ldb; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            hB_gold[i + j * ldb] = 0.0;
+        }
+    }
+
+    // hB_gold is the solution X, B = op(A)*X/alpha (or X*op(A)/alpha) is solved for it
+    hB_stub = hB_gold;
+    cblas_trmm<T>(
+        side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_stub, ldb);
+    hB_device = hB_stub;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        host_vector<T> hB(hB_stub);
+
+        CHECK_HIPBLAS_ERROR(hipblasXtTrsm<T>(
+            stub, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB_stub, ldb));
+        CHECK_HIPBLAS_ERROR(hipblasXtTrsm<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB_device, ldb));
+
+        // the panels are solved blockwise, so the tolerance is the one used for trsm
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * M;
+
+        hipblas_error_stub   = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_stub);
+        hipblas_error_device = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_device);
+        if(arg.unit_check)
+        {
+            unit_check_error(hipblas_error_stub, tolerance);
+            unit_check_error(hipblas_error_device, tolerance);
+        }
+
+        hB_device = hB;
+    }
+
+    if(arg.timing)
+    {
+        // hipblasXt calls return once B is back in host memory; B is not restored between
+        // iterations as the solve takes the same time on any right hand side
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblasXtTrsm<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB_device, ldb));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtTrsmModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         trsm_gflop_count<T>(M, N, K),
+                                         trsm_gbyte_count<T>(M, N, K),
+                                         hipblas_error_stub,
+                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <hipblas/hipblas.h>
+#include <hipblas/hipblasXt.h>
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -795,13 +796,12 @@ void make_unit_diagonal(hipblasFillMode_t uplo, T* hA, int lda, int N)
 }
 
 /* ============================================================================================= */
-/*! \brief For testing purposes, prepares matrix hA for a triangular solve.                      *
- *         Makes hA strictly diagonal dominant (SPD), then calculates Cholesky factorization     *
- *         of hA.                                                                                */
+/*! \brief For testing purposes, replaces matrix hA with hA * hA ^ H and makes it strictly       *
+ *         diagonal dominant, and therefore symmetric (Hermitian) positive definite.             */
 template <typename T>
-void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
+void prepare_positive_definite(T* hA, int lda, T* AAT, int N)
 {
-    //  calculate AAT = hA * hA ^ T
+    //  calculate AAT = hA * hA ^ H
     cblas_gemm<T>(HIPBLAS_OP_N, HIPBLAS_OP_C, N, N, N, T(1.0), hA, lda, hA, lda, T(0.0), AAT, lda);
 
     //  copy AAT into hA, make hA strictly diagonal dominant, and therefore SPD
@@ -815,6 +815,17 @@ void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
         }
         hA[i + i * lda] = t;
     }
+}
+
+/* ============================================================================================= */
+/*! \brief For testing purposes, prepares matrix hA for a triangular solve.                      *
+ *         Makes hA strictly diagonal dominant (SPD), then calculates Cholesky factorization     *
+ *         of hA.                                                                                */
+template <typename T>
+void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
+{
+    prepare_positive_definite(hA, lda, AAT, N);
+
     //  calculate Cholesky factorization of SPD matrix hA
     cblas_potrf<T>(char_uplo, N, hA, lda);
 }
@@ -977,6 +988,104 @@ public:
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  Test-only: sets the environment variable HIPBLAS_ILP64_CHUNK_SIZE, the largest size
+            the _64 functions pass to the int API in one call, lowered so that their split paths
+            run on small problems rather than the native _64 API; 0 restores the default of
+            INT_MAX */
+inline void hipblas_set_ilp64_chunk_size(int64_t chunk)
+{
+    if(chunk)
+        setenv("HIPBLAS_ILP64_CHUNK_SIZE", std::to_string(chunk).c_str(), 1);
+    else
+        unsetenv("HIPBLAS_ILP64_CHUNK_SIZE");
+}
+
+/* ============================================================================================ */
+/*! \brief  Test-only hipblasXt backends, not in the public header: HIPBLASXT_BACKEND_STUB runs the
+            tiles on the host, so that tiling and scheduling can be tested without GPUs */
+typedef enum
+{
+    HIPBLASXT_BACKEND_DEVICE = 0,
+    HIPBLASXT_BACKEND_STUB   = 1
+} hipblasXtBackend_t;
+
+extern "C" hipblasStatus_t hipblasXtSetBackend(hipblasXtHandle_t  handle,
+                                               hipblasXtBackend_t backend);
+
+/* ============================================================================================ */
+/*! \brief  RAII hipblasXt handle running on nb_devices devices (or fake devices for
+            HIPBLASXT_BACKEND_STUB) with the given tile size */
+class hipblasXtLocalHandle
+{
+    hipblasXtHandle_t m_handle;
+
+public:
+    hipblasXtLocalHandle(hipblasXtBackend_t backend, int nb_devices, int block_dim);
+
+    ~hipblasXtLocalHandle();
+
+    hipblasXtLocalHandle(const hipblasXtLocalHandle&) = delete;
+    hipblasXtLocalHandle(hipblasXtLocalHandle&&)      = delete;
+    hipblasXtLocalHandle& operator=(const hipblasXtLocalHandle&) = delete;
+    hipblasXtLocalHandle& operator=(hipblasXtLocalHandle&&) = delete;
+
+    operator hipblasXtHandle_t() const
+    {
+        return m_handle;
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  Graph timer(in microsecond): capture iters calls of func on a new stream of handle
+            into a hipGraph, and return the wall time of one launch of the graph.
+            The handle is put in HIPBLAS_CAPTURE_MODE_SAFE during capture, so func must not
+            need to grow the workspace; call it once before timing. */
+template <typename F>
+hipblasStatus_t get_time_us_graph(hipblasHandle_t handle, int iters, double& gpu_time_used, F func)
+{
+    hipStream_t old_stream, stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    hipblasStatus_t status = hipblasGetStream(handle, &old_stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetStream(handle, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE);
+
+    hipGraph_t graph = nullptr;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+        for(int iter = 0; iter < iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+            status = func();
+        CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipGraphExec_t graph_exec;
+        CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+        // warm up launch
+        CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+
+        gpu_time_used = get_time_us_sync(stream);
+        CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+    }
+
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT);
+    hipblasSetStream(handle, old_stream);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return status;
+}
+
 #include "hipblas_arguments.hpp"
 
 #endif // __cplusplus
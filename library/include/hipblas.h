@@ -524,6 +524,99 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED = 1 /**< Algorithms will take advantage of atomics where applicable. */
 } hipblasAtomicsMode_t;
 
+/*! \brief Indicates whether a handle must keep every call capturable into a hipGraph. */
+typedef enum
+{
+    HIPBLAS_CAPTURE_MODE_DEFAULT = 0, /**< Calls that cannot be captured run as usual. */
+    HIPBLAS_CAPTURE_MODE_SAFE
+    = 1 /**< Calls that would allocate, synchronize or copy results to the host are rejected. */
+} hipblasCaptureMode_t;
+
+/*! \brief Indicates how complex gemms are computed. */
+typedef enum
+{
+    HIPBLAS_COMPLEX_GEMM_MODE_DEFAULT = 0, /**< Complex gemms use the standard algorithm. */
+    HIPBLAS_COMPLEX_GEMM_MODE_3M
+    = 1 /**< Complex gemms use the 3M algorithm: three real gemms instead of four. */
+} hipblasComplexGemmMode_t;
+
+/*! \brief Indicates how packed matrices are operated on. */
+typedef enum
+{
+    HIPBLAS_PACKED_MODE_DEFAULT = 0, /**< Packed routines work on the packed storage. */
+    HIPBLAS_PACKED_MODE_UNPACK
+    = 1 /**< Packed matrices are unpacked to full storage for the matching full-storage routine. */
+} hipblasPackedMode_t;
+
+/*! \brief Indicates how the workspace of a handle is allocated when it grows. */
+typedef enum
+{
+    HIPBLAS_WORKSPACE_ALLOC_DEFAULT = 0, /**< The backend allocates the workspace. */
+    HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED
+    = 1 /**< hipBLAS allocates the workspace from a memory pool, in the order of the stream. */
+} hipblasWorkspaceAllocMode_t;
+
+/*! \brief Indicates how hipblasGemmEx is computed on the cuBLAS backend. */
+typedef enum
+{
+    HIPBLAS_GEMM_EX_MODE_DEFAULT = 0, /**< hipblasGemmEx calls cublasGemmEx. */
+    HIPBLAS_GEMM_EX_MODE_LT
+    = 1 /**< hipblasGemmEx calls cublasLtMatmul with a plan cached by the handle. */
+} hipblasGemmExMode_t;
+
+/*! \brief Activation applied by the epilogue of hipblasGemmExEpilogue. */
+typedef enum
+{
+    HIPBLAS_ACTIVATION_NONE = 0, /**< The values are passed through. */
+    HIPBLAS_ACTIVATION_RELU = 1, /**< max(x, 0). */
+    HIPBLAS_ACTIVATION_GELU
+    = 2 /**< 0.5 x (1 + tanh(sqrt(2 / pi) (x + 0.044715 x^3))), the tanh approximation of GELU. */
+} hipblasActivation_t;
+
+/*! \brief Epilogue applied by hipblasGemmExEpilogue to the result of the gemm. */
+typedef struct
+{
+    /** Device vector of m elements of cType added to every column, or NULL. */
+    const void*         bias;
+    /** Activation applied after the bias. */
+    hipblasActivation_t activation;
+    /** Scale applied after the activation. */
+    double              scale;
+    /** Device matrix of cType receiving the values before the activation, or NULL. */
+    void*               aux;
+    /** Leading dimension of aux; ldaux >= m when aux is not NULL. */
+    int                 ldaux;
+} hipblasGemmEpilogue_t;
+
+/*! \brief Device memory held for a handle, returned by hipblasGetMemoryStats. */
+typedef struct
+{
+    /** Bytes of device workspace currently allocated for the handle. */
+    size_t   workspaceBytes;
+    /** Largest workspaceBytes since the handle was created or its statistics were reset. */
+    size_t   peakWorkspaceBytes;
+    /** Bytes of device memory hipBLAS keeps for the handle outside the workspace, e.g. the trsm
+        inverse cache and the temporaries of the 3M, FP8 and packed routines. */
+    size_t   scratchBytes;
+    /** Number of calls which grew the workspace because they needed more than was allocated. */
+    uint64_t growthCount;
+    /** Time spent allocating workspace, by those calls and by hipblasReserveWorkspace, in
+        microseconds. */
+    double   allocTimeUs;
+} hipblasMemoryStats_t;
+
+/*! \brief When the workspace of a handle is trimmed, set by hipblasSetWorkspaceTrimPolicy. */
+typedef struct
+{
+    /** Calls after which the workspace is trimmed when none of them grew it, or 0. */
+    uint64_t callCount;
+    /** Milliseconds after which the workspace is trimmed when no call grew it, or 0; checked when
+        a call returns. */
+    uint64_t idleMs;
+    /** Size in bytes the workspace is trimmed to. */
+    size_t   targetBytes;
+} hipblasWorkspaceTrimPolicy_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -531,7 +624,9 @@ extern "C" {
 /*! \brief Create hipblas handle. */
 HIPBLAS_EXPORT hipblasStatus_t hipblasCreate(hipblasHandle_t* handle);
 
-/*! \brief Destroys the library context created using hipblasCreate() */
+/*! \brief Destroys the library context created using hipblasCreate()
+    \details
+    The handle must not be destroyed while another thread is making a call on it. */
 HIPBLAS_EXPORT hipblasStatus_t hipblasDestroy(hipblasHandle_t handle);
 
 /*! \brief Set stream for handle */
@@ -590,6 +685,12 @@ HIPBLAS_EXPORT hipblasStatus_t
     hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy);
 
 /*! \brief copy matrix from host to device
+
+    \details
+    Copies of at least 1 MiB to or from pageable host memory are staged through a pool of pinned
+    buffers, allocated on first use. The environment variable HIPBLAS_STAGING_POOL_SIZE sets the
+    size of the pool in bytes; 0 disables staging.
+
     @param[in]
     rows        [int]
                 number of rows in matrices
@@ -614,6 +715,12 @@ HIPBLAS_EXPORT hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* AP, int lda, void* BP, int ldb);
 
 /*! \brief copy matrix from device to host
+
+    \details
+    Copies of at least 1 MiB to or from pageable host memory are staged through a pool of pinned
+    buffers, allocated on first use. The environment variable HIPBLAS_STAGING_POOL_SIZE sets the
+    size of the pool in bytes; 0 disables staging.
+
     @param[in]
     rows        [int]
                 number of rows in matrices
@@ -758,6 +865,188 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixAsync(int         rows,
                                                      int         ldb,
                                                      hipStream_t stream);
 
+/*! \brief asynchronously copy a batch of matrices from host to device
+    \details
+    hipblasSetMatrixBatchedAsync copies batchCount matrices from host to device asynchronously.
+    The arrays of pointers are in host memory. Runs of matrices which are evenly spaced in both
+    arrays are moved with a single 2D or 3D copy when the layout allows it, the others with one
+    copy per matrix. Memory on the host must be allocated with hipHostMalloc or the transfer will
+    be synchronous.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize   [int]
+                number of bytes per element in the matrix
+    @param[in]
+    AP          array of pointers to the matrices on the host, in host memory
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[out]
+    BP          array of pointers to the matrices on the GPU, in host memory
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                                            int               cols,
+                                                            int               elemSize,
+                                                            const void* const AP[],
+                                                            int               lda,
+                                                            void* const       BP[],
+                                                            int               ldb,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+
+/*! \brief asynchronously copy a batch of matrices from device to host
+    \details
+    hipblasGetMatrixBatchedAsync copies batchCount matrices from device to host asynchronously.
+    The arrays of pointers are in host memory. Runs of matrices which are evenly spaced in both
+    arrays are moved with a single 2D or 3D copy when the layout allows it, the others with one
+    copy per matrix. Memory on the host must be allocated with hipHostMalloc or the transfer will
+    be synchronous.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize   [int]
+                number of bytes per element in the matrix
+    @param[in]
+    AP          array of pointers to the matrices on the GPU, in host memory
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[out]
+    BP          array of pointers to the matrices on the host, in host memory
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                                            int               cols,
+                                                            int               elemSize,
+                                                            const void* const AP[],
+                                                            int               lda,
+                                                            void* const       BP[],
+                                                            int               ldb,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+
+/*! \brief asynchronously copy a batch of matrices from host to device
+    \details
+    hipblasSetMatrixStridedBatchedAsync copies batchCount matrices from host to device
+    asynchronously. The batch is moved with a single 2D or 3D copy when the strides allow it,
+    otherwise with one copy per matrix. Memory on the host must be allocated with hipHostMalloc
+    or the transfer will be synchronous.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize   [int]
+                number of bytes per element in the matrix
+    @param[in]
+    AP          pointer to the first matrix on the host
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[in]
+    strideA     [hipblasStride]
+                stride in elements from the start of one A_i to the next
+    @param[out]
+    BP          pointer to the first matrix on the GPU
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    strideB     [hipblasStride]
+                stride in elements from the start of one B_i to the next
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                                   int           cols,
+                                                                   int           elemSize,
+                                                                   const void*   AP,
+                                                                   int           lda,
+                                                                   hipblasStride strideA,
+                                                                   void*         BP,
+                                                                   int           ldb,
+                                                                   hipblasStride strideB,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+
+/*! \brief asynchronously copy a batch of matrices from device to host
+    \details
+    hipblasGetMatrixStridedBatchedAsync copies batchCount matrices from device to host
+    asynchronously. The batch is moved with a single 2D or 3D copy when the strides allow it,
+    otherwise with one copy per matrix. Memory on the host must be allocated with hipHostMalloc
+    or the transfer will be synchronous.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize   [int]
+                number of bytes per element in the matrix
+    @param[in]
+    AP          pointer to the first matrix on the GPU
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[in]
+    strideA     [hipblasStride]
+                stride in elements from the start of one A_i to the next
+    @param[out]
+    BP          pointer to the first matrix on the host
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    strideB     [hipblasStride]
+                stride in elements from the start of one B_i to the next
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                                   int           cols,
+                                                                   int           elemSize,
+                                                                   const void*   AP,
+                                                                   int           lda,
+                                                                   hipblasStride strideA,
+                                                                   void*         BP,
+                                                                   int           ldb,
+                                                                   hipblasStride strideB,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+
 /*! \brief Set hipblasSetAtomicsMode*/
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
                                                      hipblasAtomicsMode_t atomics_mode);
@@ -766,6 +1055,382 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Set hipblas capture mode
+    \details
+    In HIPBLAS_CAPTURE_MODE_SAFE, calls which cannot be recorded into a hipGraph are rejected with
+    HIPBLAS_STATUS_NOT_SUPPORTED instead of breaking the capture or being baked into the graph.
+    These are calls which need to grow the workspace, calls which return a result to host memory
+    in HIPBLAS_POINTER_MODE_HOST, and solver calls whose host-side argument checks fail.
+    Entering the safe mode pins the current workspace so that the backend never grows it
+    implicitly; use hipblasReserveWorkspace() before capture to make it large enough.
+    Setting the mode clears the diagnostic returned by hipblasGetCaptureDiagnostic().
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasCaptureMode_t]
+              the new capture mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t      handle,
+                                                     hipblasCaptureMode_t mode);
+
+/*! \brief Get hipblas capture mode */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t       handle,
+                                                     hipblasCaptureMode_t* mode);
+
+/*! \brief Reserve device workspace for handle
+    \details
+    hipblasReserveWorkspace makes sure at least workspaceSizeInBytes bytes of device workspace are
+    allocated for the handle, so that later calls, e.g. during stream capture, do not need to
+    allocate. The workspace is never shrunk by this call. It must not be called while the
+    handle's stream is being captured.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    workspaceSizeInBytes [size_t]
+              minimum size of the workspace in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasReserveWorkspace(hipblasHandle_t handle,
+                                                       size_t          workspaceSizeInBytes);
+
+/*! \brief Trim the device workspace of handle
+    \details
+    hipblasTrimWorkspace shrinks the workspace of the handle to targetBytes if it is larger, so that
+    the memory taken by a rare call which needed a large workspace is given back. The workspace is
+    reallocated at the smaller size, which synchronizes the device in
+    HIPBLAS_WORKSPACE_ALLOC_DEFAULT; in HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED the larger one is
+    freed in the order of the handle's stream, and returned to the system as the release threshold
+    of the pool allows. A later call which needs more grows the workspace again. It must not be
+    called while the handle's stream is being captured. With the cuBLAS backend, only workspace
+    allocated by hipblasReserveWorkspace is trimmed.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    targetBytes [size_t]
+              size of the workspace in bytes after the call, at most.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrimWorkspace(hipblasHandle_t handle, size_t targetBytes);
+
+/*! \brief Set the policy by which the workspace of handle is trimmed automatically
+    \details
+    With a policy, the workspace is trimmed to policy->targetBytes, as by hipblasTrimWorkspace,
+    once policy->callCount calls or policy->idleMs milliseconds have passed without a call growing
+    it or needing more than policy->targetBytes, whichever comes first; a count or period of 0 is
+    not used. The calls counted, and which trim the workspace when the policy is due, are those
+    which may grow the workspace on demand, such as the solvers; the cuBLAS backend has none, as
+    cuBLAS never grows it. The workspace a call needs is known only when the call grows it, so a
+    call which runs in a workspace larger than the target without growing it is counted too; after
+    a trim, the next call which needs more grows the workspace again and restarts the count.
+
+    There is no timer: the policy, including policy->idleMs, is only checked when such a call
+    returns, and the trim is made by that call. A handle which makes no such call keeps its
+    workspace however long it is idle; trim it with hipblasTrimWorkspace. In
+    HIPBLAS_WORKSPACE_ALLOC_DEFAULT the trim frees the workspace with hipFree, which synchronizes
+    the device within the call that made it; in HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED it is freed
+    in the order of the handle's stream instead. No trim is made while the handle's stream is being
+    captured or in HIPBLAS_CAPTURE_MODE_SAFE. A policy of NULL, the default, turns automatic
+    trimming off.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    policy    [const hipblasWorkspaceTrimPolicy_t*]
+              the new policy, or NULL.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspaceTrimPolicy(
+    hipblasHandle_t handle, const hipblasWorkspaceTrimPolicy_t* policy);
+
+/*! \brief Get the policy by which the workspace of handle is trimmed automatically; all zero if
+    there is none */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceTrimPolicy(hipblasHandle_t               handle,
+                                                             hipblasWorkspaceTrimPolicy_t* policy);
+
+/*! \brief Set how the workspace of handle is allocated
+    \details
+    In HIPBLAS_WORKSPACE_ALLOC_DEFAULT, the backend allocates the workspace when it grows, with
+    hipMalloc and hipFree, which synchronize the device and stall the work queued on every stream.
+    In HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, hipBLAS allocates it instead, from a memory pool of
+    the handle's own, with hipMallocFromPoolAsync on the handle's stream, and frees the workspace
+    it replaces with hipFreeAsync after the work already queued on that stream. The growth of the
+    workspace then does not act as a barrier for other streams. The pool keeps up to the release
+    threshold of freed memory for later allocations; see hipblasSetWorkspaceReleaseThreshold.
+    While the handle holds workspace from its pool, hipblasSetStream makes the work queued on the
+    new stream wait for the work already queued on the old one, which may still use the workspace,
+    unless either stream is being captured.
+
+    The mode applies to later growth of the workspace, whether by a call which needs more or by
+    hipblasReserveWorkspace; the workspace allocated before is kept until then.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasWorkspaceAllocMode_t]
+              the new workspace allocation mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspaceAllocMode(hipblasHandle_t             handle,
+                                                            hipblasWorkspaceAllocMode_t mode);
+
+/*! \brief Get how the workspace of handle is allocated */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceAllocMode(hipblasHandle_t              handle,
+                                                            hipblasWorkspaceAllocMode_t* mode);
+
+/*! \brief Set the release threshold of the workspace pool of handle
+    \details
+    The memory pool of HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED keeps up to releaseThreshold bytes of
+    freed memory when the device or a stream is synchronized, and returns the rest to the system.
+    A larger threshold lets a workspace which shrinks and grows again reuse the memory without
+    allocating it from the system; the default of 0 returns all freed memory.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    releaseThreshold [uint64_t]
+              bytes of freed memory the pool keeps.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSetWorkspaceReleaseThreshold(hipblasHandle_t handle, uint64_t releaseThreshold);
+
+/*! \brief Get the release threshold of the workspace pool of handle */
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGetWorkspaceReleaseThreshold(hipblasHandle_t handle, uint64_t* releaseThreshold);
+
+/*! \brief Get the device memory statistics of handle
+    \details
+    The statistics let an application see how much device memory hipBLAS is holding for a handle
+    and the most it has held, e.g. to pack work onto a device without running out of memory. The
+    handles of hipblasSetBatchStreams are counted as part of the handle. With the cuBLAS backend,
+    only workspace allocated by hipblasReserveWorkspace is counted, as cuBLAS does not report the
+    size of its own.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    stats     [hipblasMemoryStats_t*]
+              set to the statistics of the handle.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMemoryStats(hipblasHandle_t       handle,
+                                                     hipblasMemoryStats_t* stats);
+
+/*! \brief Reset the device memory statistics of handle
+    \details
+    The peak workspace is reset to the current workspace, and the growth count and allocation time
+    to zero.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetMemoryStats(hipblasHandle_t handle);
+
+/*! \brief Get the first non-capturable call seen on handle
+    \details
+    A call is recorded when it is rejected in HIPBLAS_CAPTURE_MODE_SAFE, or when it is made while
+    the handle's stream is being captured in HIPBLAS_CAPTURE_MODE_DEFAULT and the environment
+    variable HIPBLAS_CAPTURE_DIAGNOSTIC is set to a nonzero value; without it, calls in the default
+    mode do not query the stream. The message names the function and the reason, e.g. the
+    workspace size which would have been needed.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    message   [const char**]
+              set to a null-terminated string owned by the handle, or to an empty string if no
+              such call was recorded. It stays valid until the next hipblasSetCaptureMode() or
+              hipblasDestroy() on this handle.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCaptureDiagnostic(hipblasHandle_t handle,
+                                                           const char**    message);
+
+/*! \brief Set the complex gemm mode of handle
+    \details
+    In HIPBLAS_COMPLEX_GEMM_MODE_3M, hipblasCgemm, hipblasZgemm and their batched and strided
+    batched forms compute each product with the 3M (Gauss) algorithm, as three real gemms on the
+    real and imaginary parts of A and B followed by additions. This takes about 25% fewer flops
+    than the standard algorithm, so it pays off for large m, n and k, at the cost of a larger
+    rounding error in the result, which is bounded by the norms of op(A) and op(B) rather than
+    elementwise. The parts are kept in device memory owned by the handle and reused by later calls;
+    those of a batch are laid out at a fixed stride, so that each step of the algorithm is a single
+    strided batched gemm or geam for the whole batch, or for as many problems as fit in 256 MiB.
+
+    The 3M algorithm is used with HIPBLAS_POINTER_MODE_HOST only, and not while the handle's
+    stream is being captured or in HIPBLAS_CAPTURE_MODE_SAFE. Other calls use the standard
+    algorithm. With the cuBLAS backend, hipblasCgemm, hipblasZgemm, hipblasCgemmBatched and
+    hipblasCgemmStridedBatched call the cublasXgemm3m functions instead, which have none of these
+    restrictions; hipblasZgemmBatched and hipblasZgemmStridedBatched use the standard algorithm,
+    as cuBLAS has no batched geam.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasComplexGemmMode_t]
+              the new complex gemm mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetComplexGemmMode(hipblasHandle_t          handle,
+                                                         hipblasComplexGemmMode_t mode);
+
+/*! \brief Get the complex gemm mode of handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetComplexGemmMode(hipblasHandle_t           handle,
+                                                         hipblasComplexGemmMode_t* mode);
+
+/*! \brief Set the packed mode of handle
+    \details
+    In HIPBLAS_PACKED_MODE_UNPACK, hipblasXtpmv, hipblasXtpsv, hipblasXspmv and hipblasXhpmv
+    unpack AP into device memory owned by the handle and call hipblasXtrmv, hipblasXtrsv,
+    hipblasXsymv and hipblasXhemv on the full-storage copy. The full-storage routines coalesce
+    their loads of A, which the packed layout does not allow, so this pays off when the packed
+    routine is bound by its scattered loads rather than by the extra pass over A that the copy
+    takes; hipblas-bench -f packed_mode times tpmv and tpsv in both modes to check this for a
+    given size and device. The device memory for the copy is kept by the handle and reused by
+    later calls.
+
+    AP is unpacked with one call of cublasXtpttr, so the mode is supported on the cuBLAS backend
+    only. rocBLAS has no such conversion, and on the rocBLAS backend HIPBLAS_STATUS_NOT_SUPPORTED
+    is returned for HIPBLAS_PACKED_MODE_UNPACK.
+
+    A call is made on the packed storage as in HIPBLAS_PACKED_MODE_DEFAULT when its arguments are
+    invalid or describe a quick return, when the handle's stream is being captured or the handle
+    is in HIPBLAS_CAPTURE_MODE_SAFE, or when the device memory for the copy cannot be allocated.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasPackedMode_t]
+              the new packed mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetPackedMode(hipblasHandle_t     handle,
+                                                    hipblasPackedMode_t mode);
+
+/*! \brief Get the packed mode of handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetPackedMode(hipblasHandle_t      handle,
+                                                    hipblasPackedMode_t* mode);
+
+/*! \brief Set the gemm_ex mode of handle
+    \details
+    In HIPBLAS_GEMM_EX_MODE_LT, hipblasGemmEx and hipblasGemmEx_v2 are computed with cublasLtMatmul
+    on the cuBLAS backend, with the algorithm chosen by the cublasLt heuristic rather than by
+    cublasGemmEx. The heuristic is queried once for each combination of types, transposes, m, n,
+    k, leading dimensions, alignment of the pointers, pointer mode and math mode, and its plan is
+    kept by the handle for the later calls with the same combination; the most recently used plans
+    are kept. The math mode set with cublasSetMathMode is honoured as by cublasGemmEx, e.g.
+    CUBLAS_TF32_TENSOR_OP_MATH computes float gemms with TF32 tensor ops. The calls run with device
+    memory owned by the handle as their workspace, allocated on first use and reused by later
+    calls.
+
+    A call is made with cublasGemmEx as in HIPBLAS_GEMM_EX_MODE_DEFAULT when algo is not
+    HIPBLAS_GEMM_DEFAULT, when its arguments are invalid or describe a quick return, when cublasLt
+    has no algorithm for it, or when cublasLtMatmul fails; a plan that failed is not used again.
+    The workspace is not allocated while the handle's stream is being captured or in
+    HIPBLAS_CAPTURE_MODE_SAFE; calls planned then use only the workspace already allocated. rocBLAS
+    chooses the solutions of rocblas_gemm_ex itself, so the mode has no effect on the rocBLAS
+    backend.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasGemmExMode_t]
+              the new gemm_ex mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmExMode(hipblasHandle_t     handle,
+                                                    hipblasGemmExMode_t mode);
+
+/*! \brief Get the gemm_ex mode of handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmExMode(hipblasHandle_t      handle,
+                                                    hipblasGemmExMode_t* mode);
+
+/*! \brief Set the number of streams batched solvers are split across
+    \details
+    With numStreams greater than 1, hipblasXgetrfBatched, hipblasXgetrsBatched and
+    hipblasXgelsBatched and their StridedBatched forms split their batch into sub-batches which run
+    concurrently, each on an internal stream with a handle of its own. The internal streams wait on
+    an event recorded on the handle's stream before they start, and the handle's stream waits on an
+    event recorded on each of them after they finish, so the call is ordered on the handle's stream
+    as an unsplit call would be. This pays off when a single batched call leaves the device partly
+    idle.
+
+    The internal handles take the pointer mode, atomics mode, workspace allocation mode, release
+    threshold and workspace trim policy of the handle at each call, and allocate workspace of their
+    own as they need it. A call in HIPBLAS_CAPTURE_MODE_SAFE, or on a stream being captured, is
+    therefore not split, so that it uses only the workspace reserved for the handle.
+
+    The number of sub-batches is reduced from numStreams so that each one is estimated to take
+    enough work to pay for its fork and join, counting the operations of each problem as
+    hipblas-bench does; a call too small to split is made on the handle's stream. The internal
+    handles and streams are created by this function and destroyed by a later call with a
+    numStreams of 1, the default, or by hipblasDestroy.
+    @param[in]
+    handle     [hipblasHandle_t]
+               handle to the hipblas library context queue.
+    @param[in]
+    numStreams [int]
+               number of streams to split batched calls across; at least 1.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetBatchStreams(hipblasHandle_t handle, int numStreams);
+
+/*! \brief Get the number of streams batched solvers are split across */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetBatchStreams(hipblasHandle_t handle, int* numStreams);
+
+/*! \brief Set the size of the trsm inverse cache of handle
+    \details
+    hipblasXtrsmCached keeps the inverses of the triangular matrices it solves with, together with
+    a copy of B, in device memory owned by the handle. maxBytes bounds that memory; the least
+    recently used inverses are freed to stay within it, and calls whose inverse would not fit
+    solve with hipblasXtrsm instead. A size of 0 frees the cache and disables it. The default is
+    256 MiB.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    maxBytes  [size_t]
+              maximum size of the cache in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetTrsmCacheSize(hipblasHandle_t handle, size_t maxBytes);
+
+/*! \brief Get the size of the trsm inverse cache of handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetTrsmCacheSize(hipblasHandle_t handle, size_t* maxBytes);
+
+/*! \brief Drop cached trsm inverses
+    \details
+    Frees the inverses kept by hipblasXtrsmCached for the matrix at A, or all of them if A is
+    nullptr. Bumping the version passed to hipblasXtrsmCached has the same effect for A; this call
+    also releases the memory, e.g. before A is freed and its address reused.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    A         device pointer to the matrix whose inverses are dropped, or nullptr.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmCacheInvalidate(hipblasHandle_t handle, const void* A);
+
+/*! \brief Set the number of rank-1 updates deferred before they are applied
+    \details
+    hipblasXgerDeferred and hipblasXsyrDeferred buffer their vectors in device memory owned by the
+    handle, and apply them to A as one rank-k update by gemm or syr2k when blockSize of them are
+    pending. Pending updates are applied first. The default is 64.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    blockSize [int]
+              number of updates applied together; at least 1.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetRankUpdateBlockSize(hipblasHandle_t handle, int blockSize);
+
+/*! \brief Get the number of rank-1 updates deferred before they are applied */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetRankUpdateBlockSize(hipblasHandle_t handle,
+                                                             int*            blockSize);
+
+/*! \brief Apply the deferred rank-1 updates of handle
+    \details
+    Applies the updates pending from hipblasXgerDeferred and hipblasXsyrDeferred to their matrix,
+    on the handle's stream. A must not be read, or changed by other means, before this call; it is
+    made by hipblasDestroy too.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasFlushRankUpdates(hipblasHandle_t handle);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -808,6 +1473,21 @@ HIPBLAS_EXPORT hipblasStatus_t
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
 //! @}
 
 /*! @{
@@ -857,6 +1537,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t
                                                     int                               incx,
                                                     int                               batchCount,
                                                     int*                              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                                       int64_t            n,
+                                                       const float* const x[],
+                                                       int64_t            incx,
+                                                       int64_t            batchCount,
+                                                       int64_t*           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                                       int64_t             n,
+                                                       const double* const x[],
+                                                       int64_t             incx,
+                                                       int64_t             batchCount,
+                                                       int64_t*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       int64_t*                    result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       int64_t*                          result);
 //! @}
 
 /*! @{
@@ -923,10 +1631,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            int*                        result);
-//! @}
 
-/*! @{
-    \brief BLAS Level 1 API
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const double*   x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              int64_t*              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                                              int64_t                     n,
+                                                              const hipblasDoubleComplex* x,
+                                                              int64_t                     incx,
+                                                              hipblasStride               stridex,
+                                                              int64_t                     batchCount,
+                                                              int64_t*                    result);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
 
     \details
     amin finds the first index of the element of minimum magnitude of a vector x.
@@ -962,6 +1702,21 @@ HIPBLAS_EXPORT hipblasStatus_t
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
 //! @}
 
 /*! @{
@@ -1011,6 +1766,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t
                                                     int                               incx,
                                                     int                               batchCount,
                                                     int*                              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched_64(hipblasHandle_t    handle,
+                                                       int64_t            n,
+                                                       const float* const x[],
+                                                       int64_t            incx,
+                                                       int64_t            batchCount,
+                                                       int64_t*           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminBatched_64(hipblasHandle_t     handle,
+                                                       int64_t             n,
+                                                       const double* const x[],
+                                                       int64_t             incx,
+                                                       int64_t             batchCount,
+                                                       int64_t*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       int64_t*                    result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       int64_t*                          result);
 //! @}
 
 /*! @{
@@ -1077,6 +1860,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            int*                        result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const double*   x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              int64_t*              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched_64(hipblasHandle_t             handle,
+                                                              int64_t                     n,
+                                                              const hipblasDoubleComplex* x,
+                                                              int64_t                     incx,
+                                                              hipblasStride               stridex,
+                                                              int64_t                     batchCount,
+                                                              int64_t*                    result);
 //! @}
 
 /*! @{
@@ -1118,6 +1933,18 @@ HIPBLAS_EXPORT hipblasStatus_t
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasum_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -1174,6 +2001,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t
                                                     int                               incx,
                                                     int                               batchCount,
                                                     double*                           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
 //! @}
 
 /*! @{
@@ -1244,6 +2099,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            double*                     result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                                              int64_t                     n,
+                                                              const hipblasDoubleComplex* x,
+                                                              int64_t                     incx,
+                                                              hipblasStride               stridex,
+                                                              int64_t                     batchCount,
+                                                              double*                     result);
 //! @}
 
 /*! @{
@@ -1317,6 +2204,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             int                         incx,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -1396,6 +2315,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -1491,6 +2446,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             hipblasDoubleComplex*       y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -1538,6 +2537,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                                             int                         incx,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -1607,6 +2626,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -1696,6 +2747,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             hipblasDoubleComplex*       y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -1799,6 +2890,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* y,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -1916,6 +3055,60 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount,
                                                    hipblasDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                                     int64_t            n,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     const float* const y[],
+                                                     int64_t            incy,
+                                                     int64_t            batchCount,
+                                                     float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                                     int64_t             n,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     const double* const y[],
+                                                     int64_t             incy,
+                                                     int64_t             batchCount,
+                                                     double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
 //! @}
 
 /*! @{
@@ -2055,6 +3248,72 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount,
                                                           hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const float*    x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const float*    y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const double*   x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const double*   y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -2097,6 +3356,18 @@ HIPBLAS_EXPORT hipblasStatus_t
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -2154,6 +3425,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t
                                                     int                               incx,
                                                     int                               batchCount,
                                                     double*                           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
 //! @}
 
 /*! @{
@@ -2226,6 +3525,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            double*                     result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                                              int64_t                     n,
+                                                              const hipblasDoubleComplex* x,
+                                                              int64_t                     incx,
+                                                              hipblasStride               stridex,
+                                                              int64_t                     batchCount,
+                                                              double*                     result);
 //! @}
 
 /*! @{
@@ -2314,6 +3645,60 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                                             int                   incy,
                                             const double*         c,
                                             const double*         s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              float*          y,
+                                              int64_t         incy,
+                                              const float*    c,
+                                              const float*    s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              double*         y,
+                                              int64_t         incy,
+                                              const double*   c,
+                                              const double*   s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              const float*          c,
+                                              const hipblasComplex* s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy,
+                                               const float*    c,
+                                               const float*    s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              const double*               c,
+                                              const hipblasDoubleComplex* s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy,
+                                               const double*         c,
+                                               const double*         s);
 //! @}
 
 /*! @{
@@ -2411,6 +3796,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             h
                                                    const double*               c,
                                                    const double*               s,
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     float* const    x[],
+                                                     int64_t         incx,
+                                                     float* const    y[],
+                                                     int64_t         incy,
+                                                     const float*    c,
+                                                     const float*    s,
+                                                     int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     double* const   x[],
+                                                     int64_t         incx,
+                                                     double* const   y[],
+                                                     int64_t         incy,
+                                                     const double*   c,
+                                                     const double*   s,
+                                                     int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasComplex* const x[],
+                                                     int64_t               incx,
+                                                     hipblasComplex* const y[],
+                                                     int64_t               incy,
+                                                     const float*          c,
+                                                     const hipblasComplex* s,
+                                                     int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      hipblasComplex* const y[],
+                                                      int64_t               incy,
+                                                      const float*          c,
+                                                      const float*          s,
+                                                      int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     hipblasDoubleComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex* const y[],
+                                                     int64_t                     incy,
+                                                     const double*               c,
+                                                     const hipblasDoubleComplex* s,
+                                                     int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasDoubleComplex* const y[],
+                                                      int64_t                     incy,
+                                                      const double*               c,
+                                                      const double*               s,
+                                                      int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -2526,6 +3971,78 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t
                                                           const double*         c,
                                                           const double*         s,
                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            float*          x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            float*          y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const float*    c,
+                                                            const float*    s,
+                                                            int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            double*         x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            double*         y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const double*   c,
+                                                            const double*   s,
+                                                            int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                                            int64_t               n,
+                                                            hipblasComplex*       x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       y,
+                                                            int64_t               incy,
+                                                            hipblasStride         stridey,
+                                                            const float*          c,
+                                                            const hipblasComplex* s,
+                                                            int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    c,
+                                                             const float*    s,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                                            int64_t                     n,
+                                                            hipblasDoubleComplex*       x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       y,
+                                                            int64_t                     incy,
+                                                            hipblasStride               stridey,
+                                                            const double*               c,
+                                                            const hipblasDoubleComplex* s,
+                                                            int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             const double*         c,
+                                                             const double*         s,
+                                                             int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -3139,6 +4656,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
 //! @}
 
 /*! @{
@@ -3208,6 +4749,48 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const x[],
                                                     int                         incx,
                                                     int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    alpha,
+                                                      float* const    x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   alpha,
+                                                      double* const   x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                                       int64_t               n,
+                                                       const float*          alpha,
+                                                       hipblasComplex* const x[],
+                                                       int64_t               incx,
+                                                       int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const double*               alpha,
+                                                       hipblasDoubleComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -3292,6 +4875,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t
                                                            int                   incx,
                                                            hipblasStride         stridex,
                                                            int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    alpha,
+                                                              hipblasComplex* x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             hipblasDoubleComplex*       x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const double*         alpha,
+                                                              hipblasDoubleComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -3339,6 +4970,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                                             int                   incx,
                                             hipblasDoubleComplex* y,
                                             int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy);
 //! @}
 
 /*! @{
@@ -3405,6 +5056,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched(hipblasHandle_t             h
                                                    hipblasDoubleComplex* const y[],
                                                    int                         incy,
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      float* const    x[],
+                                                      int64_t         incx,
+                                                      float* const    y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      double* const   x[],
+                                                      int64_t         incx,
+                                                      double* const   y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      hipblasComplex* const y[],
+                                                      int64_t               incy,
+                                                      int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasDoubleComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -3491,6 +5174,318 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t
                                                           int                   incy,
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    dotSegmented(u) performs the dot products of the segments of vectors x and y
+
+        result_i = x_i * y_i;
+
+    dotcSegmented  performs the dot products of the conjugate of the segments of complex vector x
+    and the segments of complex vector y
+
+        result_i = conjugate (x_i) * y_i;
+
+    where x_i and y_i are the i-th segments of x and y, for i = 1, ..., segmentCount. The segments
+    are of different lengths, packed one after another in x and y as given by offsets.
+
+    Each segment is split into pieces whose lengths are the powers of two making up its length, and
+    \ref hipblasSdotBatched "dotBatched" is called once for each power of two, so there are at most
+    31 calls however many different lengths there are. The call for 2^b takes every segment of
+    length 2^b or more, reading zeros for those whose length lacks 2^b, which at most doubles the
+    work of a segment. The dot products of the pieces are summed by one \ref hipblasSgemv "gemv".
+    As cuBLAS has no dotBatched, there each segment is computed by a call to \ref hipblasSdot "dot".
+    The results are reordered through the host, so the call synchronizes with the stream of the
+    handle and cannot be captured into a hipGraph.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    segmentCount [int]
+              the number of segments. segmentCount >= 0.
+    @param[in]
+    offsets   host array of segmentCount + 1 ints.
+              Segment i is made of elements offsets[i], ..., offsets[i+1] - 1 of x and y, so its
+              length is offsets[i+1] - offsets[i]. offsets[0] >= 0, and offsets[i+1] >= offsets[i].
+    @param[in]
+    x         device pointer storing the segments of vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x. incx > 0.
+    @param[in]
+    y         device pointer storing the segments of vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y. incy > 0.
+    @param[out]
+    result
+              device array or host array of segmentCount size to store the dot product of each
+              segment. return 0.0 for each segment of length 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotSegmented(hipblasHandle_t handle,
+                                                    int             segmentCount,
+                                                    const int*      offsets,
+                                                    const float*    x,
+                                                    int             incx,
+                                                    const float*    y,
+                                                    int             incy,
+                                                    float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotSegmented(hipblasHandle_t handle,
+                                                    int             segmentCount,
+                                                    const int*      offsets,
+                                                    const double*   x,
+                                                    int             incx,
+                                                    const double*   y,
+                                                    int             incy,
+                                                    double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuSegmented(hipblasHandle_t       handle,
+                                                     int                   segmentCount,
+                                                     const int*            offsets,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const hipblasComplex* y,
+                                                     int                   incy,
+                                                     hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcSegmented(hipblasHandle_t       handle,
+                                                     int                   segmentCount,
+                                                     const int*            offsets,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const hipblasComplex* y,
+                                                     int                   incy,
+                                                     hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuSegmented(hipblasHandle_t             handle,
+                                                     int                         segmentCount,
+                                                     const int*                  offsets,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int                         incy,
+                                                     hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcSegmented(hipblasHandle_t             handle,
+                                                     int                         segmentCount,
+                                                     const int*                  offsets,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int                         incy,
+                                                     hipblasDoubleComplex*       result);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    axpySegmented computes constant alpha_i multiplied by the segments of vector x, plus the
+    segments of vector y
+
+        y_i := alpha_i * x_i + y_i
+
+    where x_i and y_i are the i-th segments of x and y, for i = 1, ..., segmentCount. The segments
+    are of different lengths, packed one after another in x and y as given by offsets.
+
+    When alpha is on the host and all of the alpha_i are equal this is one call to
+    \ref hipblasSaxpy "axpy" over all of the segments. Otherwise each segment is split into pieces
+    whose lengths are the powers of two making up its length, and the pieces of 2^b elements are
+    computed by one call to \ref hipblasSgemvBatched "gemvBatched", with the piece of x_i as a
+    1 x 2^b matrix and alpha_i as its vector, so there are at most 31 calls. As cuBLAS has no
+    gemvBatched, there each segment is computed by a call to \ref hipblasSaxpy "axpy". The arrays of
+    pointers are copied from the host, so the call then synchronizes with the stream of the handle
+    and cannot be captured into a hipGraph.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    segmentCount [int]
+              the number of segments. segmentCount >= 0.
+    @param[in]
+    offsets   host array of segmentCount + 1 ints.
+              Segment i is made of elements offsets[i], ..., offsets[i+1] - 1 of x and y, so its
+              length is offsets[i+1] - offsets[i]. offsets[0] >= 0, and offsets[i+1] >= offsets[i].
+    @param[in]
+    alpha     device array or host array of segmentCount size, the scalar of each segment.
+    @param[in]
+    x         device pointer storing the segments of vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x. incx > 0.
+    @param[inout]
+    y         device pointer storing the segments of vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y. incy > 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpySegmented(hipblasHandle_t handle,
+                                                     int             segmentCount,
+                                                     const int*      offsets,
+                                                     const float*    alpha,
+                                                     const float*    x,
+                                                     int             incx,
+                                                     float*          y,
+                                                     int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpySegmented(hipblasHandle_t handle,
+                                                     int             segmentCount,
+                                                     const int*      offsets,
+                                                     const double*   alpha,
+                                                     const double*   x,
+                                                     int             incx,
+                                                     double*         y,
+                                                     int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpySegmented(hipblasHandle_t       handle,
+                                                     int                   segmentCount,
+                                                     const int*            offsets,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     hipblasComplex*       y,
+                                                     int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpySegmented(hipblasHandle_t             handle,
+                                                     int                         segmentCount,
+                                                     const int*                  offsets,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int                         incy);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    nrm2Segmented computes the euclidean norms of the segments of a real or complex vector
+
+              result_i := sqrt( x_i'*x_i ) for real vectors x, for i = 1, ..., segmentCount
+              result_i := sqrt( x_i**H*x_i ) for complex vectors x, for i = 1, ..., segmentCount
+
+    where x_i is the i-th segment of x. The segments are of different lengths, packed one after
+    another in x as given by offsets.
+
+    Each segment is split into pieces whose lengths are the powers of two making up its length, and
+    \ref hipblasSnrm2Batched "nrm2Batched" is called once for each power of two, so there are at
+    most 31 calls however many different lengths there are. The call for 2^b takes every segment of
+    length 2^b or more, reading zeros for those whose length lacks 2^b, which at most doubles the
+    work of a segment. The norms of the pieces are combined by one
+    \ref hipblasSnrm2StridedBatched "nrm2StridedBatched". As cuBLAS has no nrm2Batched, there each
+    segment is computed by a call to \ref hipblasSnrm2 "nrm2". The results are reordered through
+    the host, so the call synchronizes with the stream of the handle and cannot be captured into a
+    hipGraph.
+
+    - Supported precisions in rocBLAS : s,d,sc,dz
+    - Supported precisions in cuBLAS  : s,d,sc,dz
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    segmentCount [int]
+              the number of segments. segmentCount >= 0.
+    @param[in]
+    offsets   host array of segmentCount + 1 ints.
+              Segment i is made of elements offsets[i], ..., offsets[i+1] - 1 of x, so its
+              length is offsets[i+1] - offsets[i]. offsets[0] >= 0, and offsets[i+1] >= offsets[i].
+    @param[in]
+    x         device pointer storing the segments of vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x. incx > 0.
+    @param[out]
+    result
+              device array or host array of segmentCount size to store the norm of each segment.
+              return 0.0 for each segment of length 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Segmented(hipblasHandle_t handle,
+                                                     int             segmentCount,
+                                                     const int*      offsets,
+                                                     const float*    x,
+                                                     int             incx,
+                                                     float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Segmented(hipblasHandle_t handle,
+                                                     int             segmentCount,
+                                                     const int*      offsets,
+                                                     const double*   x,
+                                                     int             incx,
+                                                     double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Segmented(hipblasHandle_t       handle,
+                                                      int                   segmentCount,
+                                                      const int*            offsets,
+                                                      const hipblasComplex* x,
+                                                      int                   incx,
+                                                      float*                result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Segmented(hipblasHandle_t             handle,
+                                                      int                         segmentCount,
+                                                      const int*                  offsets,
+                                                      const hipblasDoubleComplex* x,
+                                                      int                         incx,
+                                                      double*                     result);
 //! @}
 
 /*
@@ -3629,6 +5624,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            kl,
+                                               int64_t            ku,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            kl,
+                                               int64_t            ku,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               kl,
+                                               int64_t               ku,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     kl,
+                                               int64_t                     ku,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -3770,6 +5825,70 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            kl,
+                                                      int64_t            ku,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             kl,
+                                                      int64_t             ku,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     kl,
+                                                      int64_t                     ku,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           kl,
+                                                      int64_t                           ku,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -3932,6 +6051,83 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            kl,
+                                                             int64_t            ku,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            kl,
+                                                             int64_t            ku,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    trans,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               kl,
+                                                             int64_t               ku,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          trans,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  int64_t                     kl,
+                                  int64_t                     ku,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -4035,6 +6231,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -4146,6 +6394,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -4284,6 +6588,74 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          transA,
+                                                             int64_t                     m,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* AP,
+                                                             int64_t                     lda,
+                                                             hipblasStride               strideA,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -4353,6 +6725,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                                            double*         AP,
                                            int             lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          AP,
+                                              int64_t         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         AP,
+                                              int64_t         lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                                             int                   m,
                                             int                   n,
@@ -4386,6 +6780,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                                             int                         m,
                                             int                         n,
@@ -4396,6 +6812,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -4471,6 +6909,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                                   int                 lda,
                                                   int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerBatched_64(hipblasHandle_t    handle,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     const float* const y[],
+                                                     int64_t            incy,
+                                                     float* const       AP[],
+                                                     int64_t            lda,
+                                                     int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched_64(hipblasHandle_t     handle,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     const double* const y[],
+                                                     int64_t             incy,
+                                                     double* const       AP[],
+                                                     int64_t             lda,
+                                                     int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                                    int                         m,
                                                    int                         n,
@@ -4507,6 +6969,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t
                                                    int                               lda,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                                    int                               m,
                                                    int                               n,
@@ -4519,6 +7005,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t
                                                    int                               lda,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
+
 //! @}
 
 /*! @{
@@ -4615,6 +7125,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                                          hipblasStride   strideA,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         m,
+                                                            int64_t         n,
+                                                            const float*    alpha,
+                                                            const float*    x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const float*    y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            float*          AP,
+                                                            int64_t         lda,
+                                                            hipblasStride   strideA,
+                                                            int64_t         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         m,
+                                                            int64_t         n,
+                                                            const double*   alpha,
+                                                            const double*   x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const double*   y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            double*         AP,
+                                                            int64_t         lda,
+                                                            hipblasStride   strideA,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                                           int                   m,
                                                           int                   n,
@@ -4660,6 +7200,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgeruStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                                           int                         m,
                                                           int                         n,
@@ -4674,6 +7245,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgercStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -4778,6 +7380,32 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -4887,6 +7515,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5011,6 +7667,41 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5092,6 +7783,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -5178,6 +7893,32 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5280,6 +8021,39 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhemvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5348,6 +8122,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP,
                                            int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const float*          alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const double*               alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda);
 //! @}
 
 /*! @{
@@ -5421,6 +8213,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched(hipblasHandle_t
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               lda,
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const float*                alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     lda,
+                                                     int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const double*                     alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           lda,
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5504,6 +8316,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t
                                                          int                         lda,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const float*          alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            int64_t               lda,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const double*               alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            int64_t                     lda,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5581,6 +8417,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -5663,6 +8521,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               lda,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5760,6 +8642,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5851,6 +8764,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -5948,6 +8883,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6060,6 +9019,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhpmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6139,6 +9129,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                                            const hipblasDoubleComplex* x,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const float*          alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const double*               alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -6223,6 +9229,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched(hipblasHandle_t
                                                   int                               incx,
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const float*                alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const double*                     alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6317,6 +9341,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t
                                                          hipblasDoubleComplex*       AP,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const float*          alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const double*               alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6405,6 +9451,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* y,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -6498,6 +9564,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t
                                                    int                               incy,
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6606,6 +9694,35 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t
                                                           hipblasDoubleComplex*       AP,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhpr2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6683,6 +9800,32 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                                             const double*     beta,
                                             double*           y,
                                             int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
 //! @}
 
 /*! @{
@@ -6768,6 +9911,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                                    double* const       y[],
                                                    int                 incy,
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -6874,6 +10045,40 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   hand
                                                           int               incy,
                                                           hipblasStride     stridey,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             int64_t           k,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             int64_t           k,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -6941,6 +10146,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                                             const double*     beta,
                                             double*           y,
                                             int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
 //! @}
 
 /*! @{
@@ -7017,6 +10244,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                                    double* const       y[],
                                                    int                 incy,
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -7113,6 +10364,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   hand
                                                           int               incy,
                                                           hipblasStride     stridey,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -7208,6 +10489,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                                            const hipblasDoubleComplex* x,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              float*            AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              double*           AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCspr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZspr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -7310,6 +10623,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched(hipblasHandle_t
                                                   int                               incx,
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprBatched_64(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     float* const       AP[],
+                                                     int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched_64(hipblasHandle_t     handle,
+                                                     hipblasFillMode_t   uplo,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     double* const       AP[],
+                                                     int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -7426,6 +10775,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t
                                                          hipblasDoubleComplex*       AP,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const float*      alpha,
+                                                            const float*      x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            float*            AP,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const double*     alpha,
+                                                            const double*     x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            double*           AP,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -7514,6 +10907,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                                             const double*     y,
                                             int               incy,
                                             double*           AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      y,
+                                               int64_t           incy,
+                                               float*            AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     y,
+                                               int64_t           incy,
+                                               double*           AP);
 //! @}
 
 /*! @{
@@ -7607,6 +11020,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    double* const       AP[],
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float* const y[],
+                                                      int64_t            incy,
+                                                      float* const       AP[],
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double* const y[],
+                                                      int64_t             incy,
+                                                      double* const       AP[],
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -7715,6 +11150,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   hand
                                                           double*           AP,
                                                           hipblasStride     strideA,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             float*            AP,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             double*           AP,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -7811,6 +11274,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -7918,6 +11429,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8052,6 +11615,71 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsymvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -8131,6 +11759,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP,
                                            int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              float*            AP,
+                                              int64_t           lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              double*           AP,
+                                              int64_t           lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda);
 //! @}
 
 /*! @{
@@ -8216,6 +11880,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               lda,
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrBatched_64(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     float* const       AP[],
+                                                     int64_t            lda,
+                                                     int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched_64(hipblasHandle_t     handle,
+                                                     hipblasFillMode_t   uplo,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     double* const       AP[],
+                                                     int64_t             lda,
+                                                     int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     lda,
+                                                     int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           lda,
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8315,34 +12019,180 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t
                                                          int                         lda,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const float*      alpha,
+                                                            const float*      x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            float*            AP,
+                                                            int64_t           lda,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const double*     alpha,
+                                                            const double*     x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            double*           AP,
+                                                            int64_t           lda,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            int64_t               lda,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            int64_t                     lda,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 2 API
 
     \details
-    syr2 performs the matrix-vector operations
+    gerDeferred and syrDeferred perform the rank-1 updates of \ref hipblasSger "ger" and
+    \ref hipblasSsyr "syr"
 
-        A := A + alpha*x*y**T + alpha*y*x**T
+        A := A + alpha*x*y**T      for gerDeferred
+        A := A + alpha*x*x**T      for syrDeferred, on the uplo triangle of A
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    n by n symmetric matrix.
+    but defer them: x, and alpha*y or alpha*x, are copied into device memory owned by the handle,
+    and the pending updates are applied to A as one rank-k update, by \ref hipblasSgemm "gemm" for
+    ger and \ref hipblasSsyr2k "syr2k" for syr, so that A is read and written once for all of them.
+    They are applied when the number set by hipblasSetRankUpdateBlockSize are pending, on a
+    deferred update to another matrix or with other dimensions, on hipblasFlushRankUpdates and on
+    hipblasDestroy. Until then A is not up to date, and must not be read or changed by other means.
 
-    - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
+    x and y may be reused as soon as the call returns, in the order of the handle's stream, which
+    must not change while updates are pending. The memory for the updates is allocated on the
+    first call, or when a matrix needs more, which cannot be captured into a hipGraph.
+
+    - Supported precisions in rocBLAS : s,d
+    - Supported precisions in cuBLAS  : s,d
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
-
+              syrDeferred only; the triangle of A which is updated, HIPBLAS_FILL_MODE_UPPER or
+              HIPBLAS_FILL_MODE_LOWER.
+    @param[in]
+    m         [int]
+              gerDeferred only; the number of rows of A. m >= 0.
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A.
+              the number of columns of A. n >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x. incx != 0.
+    @param[in]
+    y         gerDeferred only; device pointer storing vector y.
+    @param[in]
+    incy      [int]
+              gerDeferred only; specifies the increment for the elements of y. incy != 0.
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max(1, m), or max(1, n) for syr.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerDeferred(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   const float*    alpha,
+                                                   const float*    x,
+                                                   int             incx,
+                                                   const float*    y,
+                                                   int             incy,
+                                                   float*          A,
+                                                   int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerDeferred(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   const double*   alpha,
+                                                   const double*   x,
+                                                   int             incx,
+                                                   const double*   y,
+                                                   int             incy,
+                                                   double*         A,
+                                                   int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrDeferred(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const float*      alpha,
+                                                   const float*      x,
+                                                   int               incx,
+                                                   float*            A,
+                                                   int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrDeferred(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const double*     alpha,
+                                                   const double*     x,
+                                                   int               incx,
+                                                   double*           A,
+                                                   int               lda);
+//! @}
+
+/*! @{
+    \brief BLAS Level 2 API
+
+    \details
+    syr2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are vectors, and A is an
+    n by n symmetric matrix.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
@@ -8407,6 +12257,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      y,
+                                               int64_t           incy,
+                                               float*            AP,
+                                               int64_t           lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     y,
+                                               int64_t           incy,
+                                               double*           AP,
+                                               int64_t           lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -8505,6 +12399,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               lda,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2Batched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float* const y[],
+                                                      int64_t            incy,
+                                                      float* const       AP[],
+                                                      int64_t            lda,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double* const y[],
+                                                      int64_t             incy,
+                                                      double* const       AP[],
+                                                      int64_t             lda,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8624,6 +12566,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             float*            AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             double*           AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -8747,6 +12750,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            k,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            k,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               k,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -8878,6 +12925,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            k,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      int64_t             k,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     k,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9023,6 +13118,63 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            k,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            k,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               k,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9130,6 +13282,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9247,6 +13443,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9377,6 +13621,63 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtbsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9473,6 +13774,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* AP,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9568,6 +13905,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9680,6 +14057,55 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtpmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9770,6 +14196,42 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* AP,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9868,6 +14330,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9981,6 +14483,55 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtpsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -10076,6 +14627,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -10180,6 +14771,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -10301,6 +14936,59 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -10396,6 +15084,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -10500,6 +15228,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -10619,6 +15391,59 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*
@@ -10762,6 +15587,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -10903,6 +15788,70 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -11074,6 +16023,213 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           long long                   strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const float*       BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const float*       beta,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const double*      BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const double*      beta,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             long long             strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             long long             strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             long long             strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          transA,
+                                                             hipblasOperation_t          transB,
+                                                             int64_t                     m,
+                                                             int64_t                     n,
+                                                             int64_t                     k,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* AP,
+                                                             int64_t                     lda,
+                                                             long long                   strideA,
+                                                             const hipblasDoubleComplex* BP,
+                                                             int64_t                     ldb,
+                                                             long long                   strideB,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       CP,
+                                                             int64_t                     ldc,
+                                                             long long                   strideC,
+                                                             int64_t                     batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmStreamed performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    like gemm, but with A, B and C in host memory, for matrices which do not fit in device
+    memory. C is computed in tiles; the tiles of C and the panels of A and B they need are
+    streamed through device buffers of at most deviceMemoryLimit bytes in total. Two tiles are
+    in flight at a time on separate streams, so that transfers overlap computation; transfers
+    only run asynchronously if the host matrices are in pinned memory.
+
+    The function runs on the device of the handle and returns once C has been written back.
+    The handle's stream is synchronized before the first transfer. One tile is computed with the
+    handle, and the other with a handle created for the call with the handle's atomics mode, so
+    that the two never share a workspace.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    deviceMemoryLimit [size_t]
+              the most device memory, in bytes, allocated for the tiles. It must hold at
+              least six elements; larger limits give larger tiles.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStreamed(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const float*       alpha,
+                                                    const float*       A,
+                                                    int                lda,
+                                                    const float*       B,
+                                                    int                ldb,
+                                                    const float*       beta,
+                                                    float*             C,
+                                                    int                ldc,
+                                                    size_t             deviceMemoryLimit);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStreamed(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const double*      alpha,
+                                                    const double*      A,
+                                                    int                lda,
+                                                    const double*      B,
+                                                    int                ldb,
+                                                    const double*      beta,
+                                                    double*            C,
+                                                    int                ldc,
+                                                    size_t             deviceMemoryLimit);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStreamed(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* A,
+                                                    int                   lda,
+                                                    const hipblasComplex* B,
+                                                    int                   ldb,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    size_t                deviceMemoryLimit);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStreamed(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int                         lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    int                         ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc,
+                                                    size_t                      deviceMemoryLimit);
 //! @}
 
 /*! @{
@@ -11171,6 +16327,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                                             const double*               beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const float*          alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const float*          beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const double*               alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const double*               beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11272,6 +16452,32 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const float*                alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const float*                beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const double*                     alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const double*                     beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -11386,6 +16592,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const float*          alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const float*          beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const double*               alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const double*               beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -11498,6 +16735,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                                              const double*               beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const float*          beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkx_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const double*               beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11615,6 +16880,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const float*                beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkxBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const double*                     beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -11750,6 +17046,43 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const float*          beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkxStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const double*               beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -11859,6 +17192,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                                              const double*               beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2k_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const float*          beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2k_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const double*               beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11972,6 +17333,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const float*                beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2kBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const double*                     beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12106,6 +17498,43 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const float*          beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2kStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const double*               beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -12241,6 +17670,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      BP,
+                                               int64_t           ldb,
+                                               const float*      beta,
+                                               float*            CP,
+                                               int64_t           ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     BP,
+                                               int64_t           ldb,
+                                               const double*     beta,
+                                               double*           CP,
+                                               int64_t           ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -12384,6 +17869,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12548,6 +18093,79 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      BP,
+                                                             int64_t           ldb,
+                                                             hipblasStride     strideB,
+                                                             const float*      beta,
+                                                             float*            CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     BP,
+                                                             int64_t           ldb,
+                                                             hipblasStride     strideB,
+                                                             const double*     beta,
+                                                             double*           CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsymmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -12672,6 +18290,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -12802,6 +18468,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12949,6 +18667,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       beta,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      beta,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -13086,6 +18865,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                                              const hipblasDoubleComplex* beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2k_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const float*       alpha,
+                                                const float*       AP,
+                                                int64_t            lda,
+                                                const float*       BP,
+                                                int64_t            ldb,
+                                                const float*       beta,
+                                                float*             CP,
+                                                int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2k_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const double*      alpha,
+                                                const double*      AP,
+                                                int64_t            lda,
+                                                const double*      BP,
+                                                int64_t            ldb,
+                                                const double*      beta,
+                                                double*            CP,
+                                                int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2k_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2k_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -13227,6 +19062,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kBatched_64(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const float*       alpha,
+                                                       const float* const AP[],
+                                                       int64_t            lda,
+                                                       const float* const BP[],
+                                                       int64_t            ldb,
+                                                       const float*       beta,
+                                                       float* const       CP[],
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kBatched_64(hipblasHandle_t     handle,
+                                                       hipblasFillMode_t   uplo,
+                                                       hipblasOperation_t  transA,
+                                                       int64_t             n,
+                                                       int64_t             k,
+                                                       const double*       alpha,
+                                                       const double* const AP[],
+                                                       int64_t             lda,
+                                                       const double* const BP[],
+                                                       int64_t             ldb,
+                                                       const double*       beta,
+                                                       double* const       CP[],
+                                                       int64_t             ldc,
+                                                       int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2kBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const hipblasDoubleComplex*       beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -13396,6 +19292,79 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const float*       alpha,
+                                                              const float*       AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const float*       BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const float*       beta,
+                                                              float*             CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const double*      alpha,
+                                                              const double*      AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const double*      BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const double*      beta,
+                                                              double*            CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2kStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const hipblasDoubleComplex* beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -13536,6 +19505,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                                              const hipblasDoubleComplex* beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkx_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const float*       alpha,
+                                                const float*       AP,
+                                                int64_t            lda,
+                                                const float*       BP,
+                                                int64_t            ldb,
+                                                const float*       beta,
+                                                float*             CP,
+                                                int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkx_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const double*      alpha,
+                                                const double*      AP,
+                                                int64_t            lda,
+                                                const double*      BP,
+                                                int64_t            ldb,
+                                                const double*      beta,
+                                                double*            CP,
+                                                int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkx_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkx_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -13682,6 +19707,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxBatched_64(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const float*       alpha,
+                                                       const float* const AP[],
+                                                       int64_t            lda,
+                                                       const float* const BP[],
+                                                       int64_t            ldb,
+                                                       const float*       beta,
+                                                       float* const       CP[],
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxBatched_64(hipblasHandle_t     handle,
+                                                       hipblasFillMode_t   uplo,
+                                                       hipblasOperation_t  transA,
+                                                       int64_t             n,
+                                                       int64_t             k,
+                                                       const double*       alpha,
+                                                       const double* const AP[],
+                                                       int64_t             lda,
+                                                       const double* const BP[],
+                                                       int64_t             ldb,
+                                                       const double*       beta,
+                                                       double* const       CP[],
+                                                       int64_t             ldc,
+                                                       int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkxBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const hipblasDoubleComplex*       beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -13852,6 +19938,79 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const float*       alpha,
+                                                              const float*       AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const float*       BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const float*       beta,
+                                                              float*             CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const double*      alpha,
+                                                              const double*      AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const double*      BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const double*      beta,
+                                                              double*            CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkxStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const hipblasDoubleComplex* beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -13966,6 +20125,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                                             int                         ldb,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       beta,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               float*             CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      beta,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               double*            CP,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* beta,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -14092,6 +20307,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float*       beta,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double*       beta,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex*       beta,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -14255,6 +20530,79 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       beta,
+                                                             const float*       BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      beta,
+                                                             const double*      BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* beta,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgeamStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  hipblasOperation_t          transB,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* beta,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -14363,6 +20711,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -14477,6 +20853,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -14609,9 +21015,46 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
-//! @}
 
-/*! @{
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhemmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
+//! @}
+
+/*! @{
     \brief BLAS Level 3 API
 
     \details
@@ -14775,6 +21218,66 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                                             int                         ldb,
                                             hipblasDoubleComplex*       C,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int64_t            lda,
+                                               const float*       B,
+                                               int64_t            ldb,
+                                               float*             C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int64_t            lda,
+                                               const double*      B,
+                                               int64_t            ldb,
+                                               double*            C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* B,
+                                               int64_t               ldb,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* B,
+                                               int64_t                     ldb,
+                                               hipblasDoubleComplex*       C,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -14949,6 +21452,70 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       C[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int64_t            lda,
+                                                      const float* const B[],
+                                                      int64_t            ldb,
+                                                      float* const       C[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int64_t             lda,
+                                                      const double* const B[],
+                                                      int64_t             ldb,
+                                                      double* const       C[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const B[],
+                                                      int64_t                     ldb,
+                                                      hipblasComplex* const       C[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const B[],
+                                                      int64_t                           ldb,
+                                                      hipblasDoubleComplex* const       C[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -15147,6 +21714,83 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       B,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             float*             C,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      B,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             double*            C,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* B,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             hipblasComplex*       C,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* A,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* B,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  hipblasDoubleComplex*       C,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -15291,6 +21935,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       BP,
                                             int                         ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             BP,
+                                               int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            BP,
+                                               int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       BP,
+                                               int64_t               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       BP,
+                                               int64_t                     ldb);
 //! @}
 
 /*! @{
@@ -15426,6 +22122,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       BP[],
                                                    int                               ldb,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       BP[],
+                                                      int64_t            ldb,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       BP[],
+                                                      int64_t             ldb,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       BP[],
+                                                      int64_t                     ldb,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       BP[],
+                                                      int64_t                           ldb,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -15576,6 +22328,215 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t
                                                           int                         ldb,
                                                           hipblasStride               strideB,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrsmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  int64_t                     batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    trsmCached solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    as trsm does, for repeated calls with the same matrix A. On the first call with a given A,
+    uplo, diag, dimensions and version, the inverse of A is computed with trtri and kept in the
+    handle; later calls compute X = alpha*op(inv(A))*B or X = alpha*B*op(inv(A)) with gemm, which
+    is much faster than trsm for many right-hand sides. The caller bumps version whenever the
+    contents of A change; the inverse of the older version is then dropped. See
+    hipblasSetTrsmCacheSize() and hipblasTrsmCacheInvalidate() to manage the cache.
+
+    Multiplying by the inverse is less accurate than substitution when A is ill-conditioned.
+    Calls whose inverse does not fit in the cache, and first calls made while the handle's stream
+    is being captured or in HIPBLAS_CAPTURE_MODE_SAFE, solve with trsm. Where trtri is not supported (cuBLAS), the inverse is
+    computed with trsm against the identity.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       [int]
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       [int]
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            device pointer or host pointer specifying the scalar alpha.
+
+    @param[in]
+    AP       device pointer storing matrix A.
+            of dimension ( lda, k ), where k is m
+            when  HIPBLAS_SIDE_LEFT  and
+            is  n  when  HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+
+    @param[in,out]
+    BP       device pointer storing matrix B.
+
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    @param[in]
+    version [uint64_t]
+           version of the contents of A, chosen by the caller. A cached inverse is only used by
+           calls with the same version.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmCached(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float*       AP,
+                                                  int                lda,
+                                                  float*             BP,
+                                                  int                ldb,
+                                                  uint64_t           version);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmCached(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const double*      alpha,
+                                                  const double*      AP,
+                                                  int                lda,
+                                                  double*            BP,
+                                                  int                ldb,
+                                                  uint64_t           version);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmCached(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int                   m,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* AP,
+                                                  int                   lda,
+                                                  hipblasComplex*       BP,
+                                                  int                   ldb,
+                                                  uint64_t              version);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmCached(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int                         m,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* AP,
+                                                  int                         lda,
+                                                  hipblasDoubleComplex*       BP,
+                                                  int                         ldb,
+                                                  uint64_t                    version);
 //! @}
 
 /*! @{
@@ -15929,6 +22890,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                                             int                         incx,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               float*            CP,
+                                               int64_t           ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               double*           CP,
+                                               int64_t           ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -16031,6 +23036,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -16154,6 +23207,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             float*            CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             double*           CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZdgmmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*
@@ -16774,15 +23888,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t
     \brief SOLVER API
 
     \details
-    getriBatched computes the inverse \f$C_i = A_i^{-1}\f$ of a batch of general n-by-n matrices \f$A_i\f$.
-
-    The inverse is computed by solving the linear system
-
-    \f[
-        A_i C_i = I
-    \f]
-
-    where I is the identity matrix, and \f$A_i\f$ is factorized as \f$A_i = P_i  L_i  U_i\f$ as given by \ref hipblasSgetrfBatched "getrfBatched".
+    getrfVbatched computes the LU factorization of a batch of general matrices A_i of different
+    sizes, as \ref hipblasSgetrfBatched "getrfBatched" does for matrices of one size.
+
+    The problems are sorted by size, and \ref hipblasSgetrfBatched "getrfBatched" is called once
+    for each group of problems with n in the same power of two, (N/2, N], largest first; with
+    \ref hipblasSetBatchStreams "hipblasSetBatchStreams" each group is in turn split across streams.
+    A batch of problems with n from 1 to 64 thus takes at most 7 calls, whatever their lda.
+
+    When the n of a group differ, the group is factorized at size N, each matrix whose n or lda is
+    not N in a copy in scratch, padded with an identity block of size N - n after A_i. The rows of
+    the padding are zero in the columns of A_i, so the partial pivoting chooses the same pivots as
+    for A_i alone, and the factors and pivots of A_i are those of the leading block of the copy.
+    This costs two device-to-device copies of each padded matrix, and the work of factorizing it
+    at up to twice its size. A group whose problems all have the same n is factorized at that
+    size, and when their lda differ, the matrices whose lda is not n are factorized in packed
+    copies. The arrays of pointers and the pivots are reordered through the host, so the call
+    synchronizes with the stream of the handle and cannot be captured into a hipGraph.
 
     - Supported precisions in rocSOLVER : s,d,c,z
     - Supported precisions in cuBLAS    : s,d,c,z
@@ -16790,99 +23912,181 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t
     @param[in]
     handle    hipblasHandle_t.
     @param[in]
-    n         int. n >= 0.\n
-              The number of rows and columns of all matrices A_i in the batch.
-    @param[in]
-    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfBatched "getrfBatched".
-    @param[in]
-    lda       int. lda >= n.\n
-              Specifies the leading dimension of matrices A_i.
+    n         pointer to int. Array on the host of dimension batchCount.\n
+              The number of columns and rows of each matrix A_i; n[i] >= 0.
+    @param[in,out]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension
+              lda[i]*n[i].\n
+              On entry, the matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorization.
+              The unit diagonal elements of L_i are not stored.
     @param[in]
-    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
-              The pivot indices returned by \ref hipblasSgetrfBatched "getrfBatched".
-              ipiv can be passed in as a nullptr, this will assume that getrfBatched was called without partial pivoting.
+    lda       pointer to int. Array on the host of dimension batchCount.\n
+              The leading dimension of each matrix A_i; lda[i] >= max(1, n[i]).
     @param[out]
-    C         array of pointers to type. Each pointer points to an array on the GPU of dimension ldc*n.\n
-              If info[i] = 0, the inverse of matrices A_i. Otherwise, undefined.
-    @param[in]
-    ldc       int. ldc >= n.\n
-              Specifies the leading dimension of C_i.
+    ipiv      pointer to int. Array on the GPU of dimension n[0] + ... + n[batchCount-1].\n
+              The pivot indices of A_i start at ipiv + n[0] + ... + n[i-1].
+              If ipiv is null, the factorizations are computed without pivoting.
     @param[out]
-    info      pointer to int. Array of batchCount integers on the GPU.\n
-              If info[i] = 0, successful exit for inversion of A_i.
+    info      pointer to int. Array on the GPU of dimension batchCount.\n
+              If info[i] = 0, successful exit for factorization of A_i.
               If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
     @param[in]
     batchCount int. batchCount >= 0.\n
                 Number of matrices in the batch.
 
-    ********************************************************************/
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
-                                                    const int       n,
-                                                    float* const    A[],
-                                                    const int       lda,
-                                                    int*            ipiv,
-                                                    float* const    C[],
-                                                    const int       ldc,
-                                                    int*            info,
-                                                    const int       batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
-                                                    const int       n,
-                                                    double* const   A[],
-                                                    const int       lda,
-                                                    int*            ipiv,
-                                                    double* const   C[],
-                                                    const int       ldc,
-                                                    int*            info,
-                                                    const int       batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
-                                                    const int             n,
-                                                    hipblasComplex* const A[],
-                                                    const int             lda,
-                                                    int*                  ipiv,
-                                                    hipblasComplex* const C[],
-                                                    const int             ldc,
-                                                    int*                  info,
-                                                    const int             batchCount);
+   ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
-                                                    const int                   n,
-                                                    hipblasDoubleComplex* const A[],
-                                                    const int                   lda,
-                                                    int*                        ipiv,
-                                                    hipblasDoubleComplex* const C[],
-                                                    const int                   ldc,
-                                                    int*                        info,
-                                                    const int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfVbatched(hipblasHandle_t handle,
+                                                     const int*      n,
+                                                     float* const    A[],
+                                                     const int*      lda,
+                                                     int*            ipiv,
+                                                     int*            info,
+                                                     const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfVbatched(hipblasHandle_t handle,
+                                                     const int*      n,
+                                                     double* const   A[],
+                                                     const int*      lda,
+                                                     int*            ipiv,
+                                                     int*            info,
+                                                     const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfVbatched(hipblasHandle_t       handle,
+                                                     const int*            n,
+                                                     hipblasComplex* const A[],
+                                                     const int*            lda,
+                                                     int*                  ipiv,
+                                                     int*                  info,
+                                                     const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfVbatched(hipblasHandle_t             handle,
+                                                     const int*                  n,
+                                                     hipblasDoubleComplex* const A[],
+                                                     const int*                  lda,
+                                                     int*                        ipiv,
+                                                     int*                        info,
+                                                     const int                   batchCount);
 //! @}
 
 /*! @{
-    \brief GELS solves an overdetermined (or underdetermined) linear system defined by an m-by-n
-    matrix A, and a corresponding matrix B, using the QR factorization computed by \ref hipblasSgeqrf "GEQRF" (or the LQ
-    factorization computed by "GELQF").
+    \brief SOLVER API
 
     \details
-    Depending on the value of trans, the problem solved by this function is either of the form
+    getrsVbatched solves a batch of systems of linear equations A_i * X_i = B_i of different
+    sizes, in the factorized form returned by \ref hipblasSgetrfVbatched "getrfVbatched", as
+    \ref hipblasSgetrsBatched "getrsBatched" does for systems of one size.
 
-    \f[
-        \begin{array}{cl}
-        A X = B & \: \text{not transposed, or}\\
-        A' X = B & \: \text{transposed if real, or conjugate transposed if complex}
-        \end{array}
-    \f]
+    The problems are sorted by size, and \ref hipblasSgetrsBatched "getrsBatched" is called once
+    for each group of problems with the same n and nrhs, largest first. When the lda or ldb of a
+    group differ, the systems whose lda or ldb is not n are solved with packed copies of A_i or
+    B_i in scratch. The arrays of pointers and the pivots are reordered through the host, so the
+    call synchronizes with the stream of the handle and cannot be captured into a hipGraph.
 
-    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
-    and a least-squares solution approximating X is found by minimizing
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
 
-    \f[
-        || B - A  X || \quad \text{(or} \: || B - A' X ||\text{)}
-    \f]
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the systems of equations.
+    @param[in]
+    n           pointer to int. Array on the host of dimension batchCount.\n
+                The order of each system; n[i] >= 0.
+    @param[in]
+    nrhs        pointer to int. Array on the host of dimension batchCount.\n
+                The number of right hand sides of each system; nrhs[i] >= 0.
+    @param[in]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension
+                lda[i]*n[i].\n
+                The factors L_i and U_i of the factorization returned by
+                \ref hipblasSgetrfVbatched "getrfVbatched".
+    @param[in]
+    lda         pointer to int. Array on the host of dimension batchCount.\n
+                The leading dimension of each matrix A_i; lda[i] >= max(1, n[i]).
+    @param[in]
+    ipiv        pointer to int. Array on the GPU of dimension n[0] + ... + n[batchCount-1].\n
+                The pivot indices returned by \ref hipblasSgetrfVbatched "getrfVbatched".
+    @param[in,out]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension
+                ldb[i]*nrhs[i].\n
+                On entry, the right hand sides B_i. On exit, the solutions X_i.
+    @param[in]
+    ldb         pointer to int. Array on the host of dimension batchCount.\n
+                The leading dimension of each matrix B_i; ldb[i] >= max(1, n[i]).
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of systems in the batch.
 
-    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
-    and a unique solution for X is chosen such that \f$|| X ||\f$ is minimal.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsVbatched(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int*               n,
+                                                     const int*               nrhs,
+                                                     float* const             A[],
+                                                     const int*               lda,
+                                                     const int*               ipiv,
+                                                     float* const             B[],
+                                                     const int*               ldb,
+                                                     int*                     info,
+                                                     const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsVbatched(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int*               n,
+                                                     const int*               nrhs,
+                                                     double* const            A[],
+                                                     const int*               lda,
+                                                     const int*               ipiv,
+                                                     double* const            B[],
+                                                     const int*               ldb,
+                                                     int*                     info,
+                                                     const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsVbatched(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int*               n,
+                                                     const int*               nrhs,
+                                                     hipblasComplex* const    A[],
+                                                     const int*               lda,
+                                                     const int*               ipiv,
+                                                     hipblasComplex* const    B[],
+                                                     const int*               ldb,
+                                                     int*                     info,
+                                                     const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsVbatched(hipblasHandle_t             handle,
+                                                     const hipblasOperation_t    trans,
+                                                     const int*                  n,
+                                                     const int*                  nrhs,
+                                                     hipblasDoubleComplex* const A[],
+                                                     const int*                  lda,
+                                                     const int*                  ipiv,
+                                                     hipblasDoubleComplex* const B[],
+                                                     const int*                  ldb,
+                                                     int*                        info,
+                                                     const int                   batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrsDeviceInfo solves a system of n linear equations on n variables in its factorized form, as
+    \ref hipblasSgetrs "getrs" does, without reading or writing host memory of the caller: invalid
+    arguments are reported through the returned status only, and there is no host-side info. getrs
+    has no numerical failures, so deviceInfo is only cleared, on the stream, for pipelines which
+    check every solver the same way.
+
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
 
     - Supported precisions in rocSOLVER : s,d,c,z
     - Supported precisions in cuBLAS    : currently unsupported
@@ -16893,118 +24097,194 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t
     trans       hipblasOperation_t.\n
                 Specifies the form of the system of equations.
     @param[in]
-    m           int. m >= 0.\n
-                The number of rows of matrix A.
-    @param[in]
     n           int. n >= 0.\n
-                The number of columns of matrix A.
+                The order of the system, i.e. the number of columns and rows of A.
     @param[in]
     nrhs        int. nrhs >= 0.\n
-                The number of columns of matrices B and X;
-                i.e., the columns on the right hand side.
-    @param[inout]
+                The number of right hand sides, i.e. the number of columns of B.
+    @param[in]
     A           pointer to type. Array on the GPU of dimension lda*n.\n
-                On entry, the matrix A.
-                On exit, the QR (or LQ) factorization of A as returned by "GEQRF" (or "GELQF").
+                The factors L and U of the factorization returned by \ref hipblasSgetrf "getrf".
     @param[in]
-    lda         int. lda >= m.\n
-                Specifies the leading dimension of matrix A.
-    @param[inout]
+    lda         int. lda >= n.\n
+                The leading dimension of A.
+    @param[in]
+    ipiv        pointer to int. Array on the GPU of dimension n.\n
+                The pivot indices returned by \ref hipblasSgetrf "getrf".
+    @param[in,out]
     B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
-                On entry, the matrix B.
-                On exit, when info = 0, B is overwritten by the solution vectors (and the residuals in
-                the overdetermined cases) stored as columns.
+                On entry, the right hand sides B. On exit, the solutions X.
     @param[in]
-    ldb         int. ldb >= max(m,n).\n
-                Specifies the leading dimension of matrix B.
-    @param[out]
-    info        pointer to an int on the host.\n
-                If info = 0, successful exit.
-                If info = j < 0, the argument at position -j is invalid.
+    ldb         int. ldb >= n.\n
+                The leading dimension of B.
     @param[out]
     deviceInfo  pointer to int on the GPU.\n
-                If info = 0, successful exit.
-                If info = i > 0, the solution could not be computed because input matrix A is
-                rank deficient; the i-th diagonal element of its triangular factor is zero.
+                Set to 0; getrs has no numerical failures.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            const int          m,
-                                            const int          n,
-                                            const int          nrhs,
-                                            float*             A,
-                                            const int          lda,
-                                            float*             B,
-                                            const int          ldb,
-                                            int*               info,
-                                            int*               deviceInfo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsDeviceInfo(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       float*                   A,
+                                                       const int                lda,
+                                                       const int*               ipiv,
+                                                       float*                   B,
+                                                       const int                ldb,
+                                                       int*                     deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsDeviceInfo(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       double*                  A,
+                                                       const int                lda,
+                                                       const int*               ipiv,
+                                                       double*                  B,
+                                                       const int                ldb,
+                                                       int*                     deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsDeviceInfo(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       hipblasComplex*          A,
+                                                       const int                lda,
+                                                       const int*               ipiv,
+                                                       hipblasComplex*          B,
+                                                       const int                ldb,
+                                                       int*                     deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsDeviceInfo(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       hipblasDoubleComplex*    A,
+                                                       const int                lda,
+                                                       const int*               ipiv,
+                                                       hipblasDoubleComplex*    B,
+                                                       const int                ldb,
+                                                       int*                     deviceInfo);
+//! @}
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            const int          m,
-                                            const int          n,
-                                            const int          nrhs,
-                                            double*            A,
-                                            const int          lda,
-                                            double*            B,
-                                            const int          ldb,
-                                            int*               info,
-                                            int*               deviceInfo);
+/*! @{
+    \brief SOLVER API
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            const int          m,
-                                            const int          n,
-                                            const int          nrhs,
-                                            hipblasComplex*    A,
-                                            const int          lda,
-                                            hipblasComplex*    B,
-                                            const int          ldb,
-                                            int*               info,
-                                            int*               deviceInfo);
+    \details
+    getrsBatchedDeviceInfo solves a system of n linear equations on n variables in its factorized
+    form, for each instance of a batch, as \ref hipblasSgetrsBatched "getrsBatched" does, without
+    reading or writing host memory of the caller: invalid arguments are reported through the
+    returned status only, and there is no host-side info. getrs has no numerical failures, so
+    deviceInfo is only cleared, on the stream, for pipelines which check every solver the same way.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
-                                            hipblasOperation_t    trans,
-                                            const int             m,
-                                            const int             n,
-                                            const int             nrhs,
-                                            hipblasDoubleComplex* A,
-                                            const int             lda,
-                                            hipblasDoubleComplex* B,
-                                            const int             ldb,
-                                            int*                  info,
-                                            int*                  deviceInfo);
-///@}
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
 
-/*! @{
-    \brief gelsBatched solves a batch of overdetermined (or underdetermined) linear systems
-    defined by a set of m-by-n matrices \f$A_j\f$, and corresponding matrices \f$B_j\f$, using the
-    QR factorizations computed by "GEQRF_BATCHED" (or the LQ factorizations computed by "GELQF_BATCHED").
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
 
-    \details
-    For each instance in the batch, depending on the value of trans, the problem solved by this function is either of the form
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A_j.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e. the number of columns of B_j.
+    @param[in]
+    A           array of pointers to type.\n
+                Each pointer points to an array on the GPU of dimension lda*n.
+                The factors L and U of the factorization returned by \ref hipblasSgetrf "getrf".
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of A_j.
+    @param[in]
+    ipiv        pointer to int. Array on the GPU of dimension batchCount*n.\n
+                The pivot indices returned by \ref hipblasSgetrf "getrf".
+    @param[in,out]
+    B           array of pointers to type.\n
+                Each pointer points to an array on the GPU of dimension ldb*nrhs.
+                On entry, the right hand sides B_j. On exit, the solutions X_j.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of B_j.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                Set to 0; getrs has no numerical failures.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances in the batch.
+    ********************************************************************/
 
-    \f[
-        \begin{array}{cl}
-        A_j X_j = B_j & \: \text{not transposed, or}\\
-        A_j' X_j = B_j & \: \text{transposed if real, or conjugate transposed if complex}
-        \end{array}
-    \f]
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                              const hipblasOperation_t trans,
+                                                              const int                n,
+                                                              const int                nrhs,
+                                                              float* const             A[],
+                                                              const int                lda,
+                                                              const int*               ipiv,
+                                                              float* const             B[],
+                                                              const int                ldb,
+                                                              int*                     deviceInfo,
+                                                              const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                              const hipblasOperation_t trans,
+                                                              const int                n,
+                                                              const int                nrhs,
+                                                              double* const            A[],
+                                                              const int                lda,
+                                                              const int*               ipiv,
+                                                              double* const            B[],
+                                                              const int                ldb,
+                                                              int*                     deviceInfo,
+                                                              const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                              const hipblasOperation_t trans,
+                                                              const int                n,
+                                                              const int                nrhs,
+                                                              hipblasComplex* const    A[],
+                                                              const int                lda,
+                                                              const int*               ipiv,
+                                                              hipblasComplex* const    B[],
+                                                              const int                ldb,
+                                                              int*                     deviceInfo,
+                                                              const int                batchCount);
 
-    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
-    and a least-squares solution approximating X_j is found by minimizing
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgetrsBatchedDeviceInfo(hipblasHandle_t             handle,
+                                   const hipblasOperation_t    trans,
+                                   const int                   n,
+                                   const int                   nrhs,
+                                   hipblasDoubleComplex* const A[],
+                                   const int                   lda,
+                                   const int*                  ipiv,
+                                   hipblasDoubleComplex* const B[],
+                                   const int                   ldb,
+                                   int*                        deviceInfo,
+                                   const int                   batchCount);
+//! @}
 
-    \f[
-        || B_j - A_j  X_j || \quad \text{(or} \: || B_j - A_j' X_j ||\text{)}
-    \f]
+/*! @{
+    \brief SOLVER API
 
-    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
-    and a unique solution for X_j is chosen such that \f$|| X_j ||\f$ is minimal.
+    \details
+    getrsStridedBatchedDeviceInfo solves a system of n linear equations on n variables in its
+    factorized form, for each instance of a batch, as \ref hipblasSgetrsStridedBatched
+    "getrsStridedBatched" does, without reading or writing host memory of the caller: invalid
+    arguments are reported through the returned status only, and there is no host-side info. getrs
+    has no numerical failures, so deviceInfo is only cleared, on the stream, for pipelines which
+    check every solver the same way.
+
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
 
     - Supported precisions in rocSOLVER : s,d,c,z
-    - Supported precisions in cuBLAS    : s,d,c,z
-    Note that cuBLAS backend supports only the non-transpose operation and only solves over-determined systems (m >= n).
+    - Supported precisions in cuBLAS    : currently unsupported
 
     @param[in]
     handle      hipblasHandle_t.
@@ -17012,364 +24292,355 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
     trans       hipblasOperation_t.\n
                 Specifies the form of the system of equations.
     @param[in]
-    m           int. m >= 0.\n
-                The number of rows of all matrices A_j in the batch.
-    @param[in]
     n           int. n >= 0.\n
-                The number of columns of all matrices A_j in the batch.
+                The order of the system, i.e. the number of columns and rows of A_j.
     @param[in]
     nrhs        int. nrhs >= 0.\n
-                The number of columns of all matrices B_j and X_j in the batch;
-                i.e., the columns on the right hand side.
-    @param[inout]
-    A           array of pointer to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-                On entry, the matrices A_j.
-                On exit, the QR (or LQ) factorizations of A_j as returned by "GEQRF_BATCHED"
-                (or "GELQF_BATCHED").
+                The number of right hand sides, i.e. the number of columns of B_j.
     @param[in]
-    lda         int. lda >= m.\n
-                Specifies the leading dimension of matrices A_j.
-    @param[inout]
-    B           array of pointer to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
-                On entry, the matrices B_j.
-                On exit, when info[j] = 0, B_j is overwritten by the solution vectors (and the residuals in
-                the overdetermined cases) stored as columns.
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L and U of the factorization returned by \ref hipblasSgetrf "getrf".
     @param[in]
-    ldb         int. ldb >= max(m,n).\n
-                Specifies the leading dimension of matrices B_j.
-    @param[out]
-    info        pointer to an int on the host.\n
-                If info = 0, successful exit.
-                If info = j < 0, the argument at position -j is invalid.
+    lda         int. lda >= n.\n
+                The leading dimension of A_j.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_j to the next one A_(j+1).
+    @param[in]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                The pivot indices returned by \ref hipblasSgetrf "getrf".
+    @param[in]
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+    @param[in,out]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the right hand sides B_j. On exit, the solutions X_j.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of B_j.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_j to the next one B_(j+1).
     @param[out]
     deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
-                If deviceInfo[j] = 0, successful exit for solution of A_j.
-                If deviceInfo[j] = i > 0, the solution of A_j could not be computed because input
-                matrix A_j is rank deficient; the i-th diagonal element of its triangular factor is zero.
+                Set to 0; getrs has no numerical failures.
     @param[in]
     batchCount  int. batchCount >= 0.\n
-                Number of matrices in the batch.
+                Number of instances in the batch.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t trans,
-                                                   const int          m,
-                                                   const int          n,
-                                                   const int          nrhs,
-                                                   float* const       A[],
-                                                   const int          lda,
-                                                   float* const       B[],
-                                                   const int          ldb,
-                                                   int*               info,
-                                                   int*               deviceInfo,
-                                                   const int          batchCount);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                n,
+                                          const int                nrhs,
+                                          float*                   A,
+                                          const int                lda,
+                                          const hipblasStride      strideA,
+                                          const int*               ipiv,
+                                          const hipblasStride      strideP,
+                                          float*                   B,
+                                          const int                ldb,
+                                          const hipblasStride      strideB,
+                                          int*                     deviceInfo,
+                                          const int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t trans,
-                                                   const int          m,
-                                                   const int          n,
-                                                   const int          nrhs,
-                                                   double* const      A[],
-                                                   const int          lda,
-                                                   double* const      B[],
-                                                   const int          ldb,
-                                                   int*               info,
-                                                   int*               deviceInfo,
-                                                   const int          batchCount);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                n,
+                                          const int                nrhs,
+                                          double*                  A,
+                                          const int                lda,
+                                          const hipblasStride      strideA,
+                                          const int*               ipiv,
+                                          const hipblasStride      strideP,
+                                          double*                  B,
+                                          const int                ldb,
+                                          const hipblasStride      strideB,
+                                          int*                     deviceInfo,
+                                          const int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
-                                                   hipblasOperation_t    trans,
-                                                   const int             m,
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                n,
+                                          const int                nrhs,
+                                          hipblasComplex*          A,
+                                          const int                lda,
+                                          const hipblasStride      strideA,
+                                          const int*               ipiv,
+                                          const hipblasStride      strideP,
+                                          hipblasComplex*          B,
+                                          const int                ldb,
+                                          const hipblasStride      strideB,
+                                          int*                     deviceInfo,
+                                          const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                n,
+                                          const int                nrhs,
+                                          hipblasDoubleComplex*    A,
+                                          const int                lda,
+                                          const hipblasStride      strideA,
+                                          const int*               ipiv,
+                                          const hipblasStride      strideP,
+                                          hipblasDoubleComplex*    B,
+                                          const int                ldb,
+                                          const hipblasStride      strideB,
+                                          int*                     deviceInfo,
+                                          const int                batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvBatched solves a batch of systems of n linear equations on n variables.
+
+    For each instance i in the batch, it computes the LU factorization
+    \f$A_i = P_i L_i U_i\f$ with partial pivoting, as \ref hipblasSgetrfBatched "getrfBatched" does,
+    and then solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    as \ref hipblasSgetrsBatched "getrsBatched" does. Both steps are enqueued by the one call,
+    which reserves its workspace once and does not read or write host memory: invalid arguments
+    are reported by the returned status only, and singular matrices by info on the device.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in,out]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the n-by-n matrices A_i.
+                On exit, the factors L_i and U_i from the factorization.
+                The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount.\n
+                Contains the vectors of pivots indices ipiv_i (corresponding to A_i).
+                Dimension of ipiv_i is n.
+                Elements of ipiv_i are 1-based indices.
+    @param[in,out]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[out]
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info[i] = 0, successful exit for instance i.
+                If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot, and the
+                solution X_i was not computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   float* const    A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   float* const    B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   double* const   A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   double* const   B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
                                                    const int             n,
                                                    const int             nrhs,
                                                    hipblasComplex* const A[],
                                                    const int             lda,
+                                                   int*                  ipiv,
                                                    hipblasComplex* const B[],
                                                    const int             ldb,
                                                    int*                  info,
-                                                   int*                  deviceInfo,
                                                    const int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          trans,
-                                                   const int                   m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
                                                    const int                   n,
                                                    const int                   nrhs,
                                                    hipblasDoubleComplex* const A[],
                                                    const int                   lda,
+                                                   int*                        ipiv,
                                                    hipblasDoubleComplex* const B[],
                                                    const int                   ldb,
                                                    int*                        info,
-                                                   int*                        deviceInfo,
                                                    const int                   batchCount);
-///@}
+//! @}
 
 /*! @{
-    \brief gelsStridedBatched solves a batch of overdetermined (or underdetermined) linear
-    systems defined by a set of m-by-n matrices \f$A_j\f$, and corresponding matrices \f$B_j\f$,
-    using the QR factorizations computed by "GEQRF_STRIDED_BATCHED"
-    (or the LQ factorizations computed by "GELQF_STRIDED_BATCHED").
+    \brief SOLVER API
 
     \details
-    For each instance in the batch, depending on the value of trans, the problem solved by this function is either of the form
-
-    \f[
-        \begin{array}{cl}
-        A_j X_j = B_j & \: \text{not transposed, or}\\
-        A_j' X_j = B_j & \: \text{transposed if real, or conjugate transposed if complex}
-        \end{array}
-    \f]
+    gesvStridedBatched solves a batch of systems of n linear equations on n variables.
 
-    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
-    and a least-squares solution approximating X_j is found by minimizing
+    For each instance i in the batch, it computes the LU factorization
+    \f$A_i = P_i L_i U_i\f$ with partial pivoting, as \ref hipblasSgetrfStridedBatched "getrfStridedBatched" does,
+    and then solves the system
 
     \f[
-        || B_j - A_j  X_j || \quad \text{(or} \: || B_j - A_j' X_j ||\text{)}
+        A_i X_i = B_i
     \f]
 
-    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
-    and a unique solution for X_j is chosen such that \f$|| X_j ||\f$ is minimal.
+    as \ref hipblasSgetrsStridedBatched "getrsStridedBatched" does. Both steps are enqueued by the one call,
+    which reserves its workspace once and does not read or write host memory: invalid arguments
+    are reported by the returned status only, and singular matrices by info on the device.
 
     - Supported precisions in rocSOLVER : s,d,c,z
-    - Supported precisions in cuBLAS    : currently unsupported
+    - Supported precisions in cuBLAS    : No support
 
     @param[in]
     handle      hipblasHandle_t.
     @param[in]
-    trans       hipblasOperation_t.\n
-                Specifies the form of the system of equations.
-    @param[in]
-    m           int. m >= 0.\n
-                The number of rows of all matrices A_j in the batch.
-    @param[in]
     n           int. n >= 0.\n
-                The number of columns of all matrices A_j in the batch.
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
     @param[in]
     nrhs        int. nrhs >= 0.\n
-                The number of columns of all matrices B_j and X_j in the batch;
-                i.e., the columns on the right hand side.
-    @param[inout]
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in,out]
     A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-                On entry, the matrices A_j.
-                On exit, the QR (or LQ) factorizations of A_j as returned by "GEQRF_STRIDED_BATCHED"
-                (or "GELQF_STRIDED_BATCHED").
+                On entry, the n-by-n matrices A_i.
+                On exit, the factors L_i and U_i from the factorization.
+                The unit diagonal elements of L_i are not stored.
     @param[in]
-    lda         int. lda >= m.\n
-                Specifies the leading dimension of matrices A_j.
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
     @param[in]
     strideA     hipblasStride.\n
-                Stride from the start of one matrix A_j to the next one A_(j+1).
-                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
-    @param[inout]
-    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
-                On entry, the matrices B_j.
-                On exit, when info[j] = 0, each B_j is overwritten by the solution vectors (and the residuals in
-                the overdetermined cases) stored as columns.
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors of pivots indices ipiv_i (corresponding to A_i).
+                Dimension of ipiv_i is n.
+                Elements of ipiv_i are 1-based indices.
     @param[in]
-    ldb         int. ldb >= max(m,n).\n
-                Specifies the leading dimension of matrices B_j.
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
     @param[in]
     strideB     hipblasStride.\n
-                Stride from the start of one matrix B_j to the next one B_(j+1).
-                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs
-    @param[out]
-    info        pointer to an int on the host.\n
-                If info = 0, successful exit.
-                If info = j < 0, the argument at position -j is invalid.
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
     @param[out]
-    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
-                If deviceInfo[j] = 0, successful exit for solution of A_j.
-                If deviceInfo[j] = i > 0, the solution of A_j could not be computed because input
-                matrix A_j is rank deficient; the i-th diagonal element of its triangular factor is zero.
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info[i] = 0, successful exit for instance i.
+                If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot, and the
+                solution X_i was not computed.
     @param[in]
     batchCount  int. batchCount >= 0.\n
-                Number of matrices in the batch.
-    ********************************************************************/
+                Number of instances (systems) in the batch.
+   ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
-                                                          hipblasOperation_t  trans,
-                                                          const int           m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
                                                           const int           n,
                                                           const int           nrhs,
                                                           float*              A,
                                                           const int           lda,
                                                           const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
                                                           float*              B,
                                                           const int           ldb,
                                                           const hipblasStride strideB,
                                                           int*                info,
-                                                          int*                deviceInfo,
-                                                          const int           batch_count);
+                                                          const int           batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
-                                                          hipblasOperation_t  trans,
-                                                          const int           m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
                                                           const int           n,
                                                           const int           nrhs,
                                                           double*             A,
                                                           const int           lda,
                                                           const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
                                                           double*             B,
                                                           const int           ldb,
                                                           const hipblasStride strideB,
                                                           int*                info,
-                                                          int*                deviceInfo,
-                                                          const int           batch_count);
+                                                          const int           batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
-                                                          hipblasOperation_t  trans,
-                                                          const int           m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
                                                           const int           n,
                                                           const int           nrhs,
                                                           hipblasComplex*     A,
                                                           const int           lda,
                                                           const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
                                                           hipblasComplex*     B,
                                                           const int           ldb,
                                                           const hipblasStride strideB,
                                                           int*                info,
-                                                          int*                deviceInfo,
-                                                          const int           batch_count);
+                                                          const int           batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    trans,
-                                                          const int             m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
                                                           const int             n,
                                                           const int             nrhs,
                                                           hipblasDoubleComplex* A,
                                                           const int             lda,
                                                           const hipblasStride   strideA,
+                                                          int*                  ipiv,
+                                                          const hipblasStride   strideP,
                                                           hipblasDoubleComplex* B,
                                                           const int             ldb,
                                                           const hipblasStride   strideB,
                                                           int*                  info,
-                                                          int*                  deviceInfo,
-                                                          const int             batch_count);
-///@}
-
-/*! @{
-    \brief SOLVER API
-
-    \details
-    geqrf computes a QR factorization of a general m-by-n matrix A.
-
-    The factorization has the form
-
-    \f[
-        A = Q\left[\begin{array}{c}
-        R\\
-        0
-        \end{array}\right]
-    \f]
-
-    where R is upper triangular (upper trapezoidal if m < n), and Q is
-    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
-
-    \f[
-        Q = H_1H_2\cdots H_k, \quad \text{with} \: k = \text{min}(m,n)
-    \f]
-
-    Each Householder matrix \f$H_i\f$ is given by
-
-    \f[
-        H_i = I - \text{ipiv}[i] \cdot v_i v_i'
-    \f]
-
-    where the first i-1 elements of the Householder vector \f$v_i\f$ are zero, and \f$v_i[i] = 1\f$.
-
-    - Supported precisions in rocSOLVER : s,d,c,z
-    - Supported precisions in cuBLAS    : s,d,c,z
-
-    @param[in]
-    handle    hipblasHandle_t.
-    @param[in]
-    m         int. m >= 0.\n
-              The number of rows of the matrix A.
-    @param[in]
-    n         int. n >= 0.\n
-              The number of columns of the matrix A.
-    @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrix to be factored.
-              On exit, the elements on and above the diagonal contain the
-              factor R; the elements below the diagonal are the last m - i elements
-              of Householder vector v_i.
-    @param[in]
-    lda       int. lda >= m.\n
-              Specifies the leading dimension of A.
-    @param[out]
-    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
-              The Householder scalars.
-    @param[out]
-    info      pointer to a int on the host.\n
-              If info = 0, successful exit.
-              If info = j < 0, the argument at position -j is invalid.
-
-    ********************************************************************/
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             float*          A,
-                                             const int       lda,
-                                             float*          ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             double*         A,
-                                             const int       lda,
-                                             double*         ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             hipblasComplex* A,
-                                             const int       lda,
-                                             hipblasComplex* ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
-                                             const int             m,
-                                             const int             n,
-                                             hipblasDoubleComplex* A,
-                                             const int             lda,
-                                             hipblasDoubleComplex* ipiv,
-                                             int*                  info);
+                                                          const int             batchCount);
 //! @}
 
 /*! @{
     \brief SOLVER API
 
     \details
-    geqrfBatched computes the QR factorization of a batch of general
-    m-by-n matrices.
-
-    The factorization of matrix \f$A_i\f$ in the batch has the form
-
-    \f[
-        A_i = Q_i\left[\begin{array}{c}
-        R_i\\
-        0
-        \end{array}\right]
-    \f]
-
-    where \f$R_i\f$ is upper triangular (upper trapezoidal if m < n), and \f$Q_i\f$ is
-    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
-
-    \f[
-        Q_i = H_{i_1}H_{i_2}\cdots H_{i_k}, \quad \text{with} \: k = \text{min}(m,n)
-    \f]
+    getriBatched computes the inverse \f$C_i = A_i^{-1}\f$ of a batch of general n-by-n matrices \f$A_i\f$.
 
-    Each Householder matrix \f$H_{i_j}\f$ is given by
+    The inverse is computed by solving the linear system
 
     \f[
-        H_{i_j} = I - \text{ipiv}_i[j] \cdot v_{i_j} v_{i_j}'
+        A_i C_i = I
     \f]
 
-    where the first j-1 elements of Householder vector \f$v_{i_j}\f$ are zero, and \f$v_{i_j}[j] = 1\f$.
+    where I is the identity matrix, and \f$A_i\f$ is factorized as \f$A_i = P_i  L_i  U_i\f$ as given by \ref hipblasSgetrfBatched "getrfBatched".
 
     - Supported precisions in rocSOLVER : s,d,c,z
     - Supported precisions in cuBLAS    : s,d,c,z
@@ -17377,66 +24648,71 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
     @param[in]
     handle    hipblasHandle_t.
     @param[in]
-    m         int. m >= 0.\n
-              The number of rows of all the matrices A_i in the batch.
-    @param[in]
     n         int. n >= 0.\n
-              The number of columns of all the matrices A_i in the batch.
-    @param[inout]
-    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrices A_i to be factored.
-              On exit, the elements on and above the diagonal contain the
-              factor R_i. The elements below the diagonal are the last m - j elements
-              of Householder vector v_(i_j).
+              The number of rows and columns of all matrices A_i in the batch.
     @param[in]
-    lda       int. lda >= m.\n
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfBatched "getrfBatched".
+    @param[in]
+    lda       int. lda >= n.\n
               Specifies the leading dimension of matrices A_i.
+    @param[in]
+    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+              The pivot indices returned by \ref hipblasSgetrfBatched "getrfBatched".
+              ipiv can be passed in as a nullptr, this will assume that getrfBatched was called without partial pivoting.
     @param[out]
-    ipiv      array of pointers to type. Each pointer points to an array on the GPU
-              of dimension min(m, n).\n
-              Contains the vectors ipiv_i of corresponding Householder scalars.
+    C         array of pointers to type. Each pointer points to an array on the GPU of dimension ldc*n.\n
+              If info[i] = 0, the inverse of matrices A_i. Otherwise, undefined.
+    @param[in]
+    ldc       int. ldc >= n.\n
+              Specifies the leading dimension of C_i.
     @param[out]
-    info      pointer to a int on the host.\n
-              If info = 0, successful exit.
-              If info = j < 0, the argument at position -j is invalid.
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for inversion of A_i.
+              If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
     @param[in]
-    batchCount  int. batchCount >= 0.\n
-                 Number of matrices in the batch.
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
-                                                    const int       m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                                     const int       n,
                                                     float* const    A[],
                                                     const int       lda,
-                                                    float* const    ipiv[],
+                                                    int*            ipiv,
+                                                    float* const    C[],
+                                                    const int       ldc,
                                                     int*            info,
                                                     const int       batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
-                                                    const int       m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                                     const int       n,
                                                     double* const   A[],
                                                     const int       lda,
-                                                    double* const   ipiv[],
+                                                    int*            ipiv,
+                                                    double* const   C[],
+                                                    const int       ldc,
                                                     int*            info,
                                                     const int       batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
-                                                    const int             m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                                     const int             n,
                                                     hipblasComplex* const A[],
                                                     const int             lda,
-                                                    hipblasComplex* const ipiv[],
+                                                    int*                  ipiv,
+                                                    hipblasComplex* const C[],
+                                                    const int             ldc,
                                                     int*                  info,
                                                     const int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
-                                                    const int                   m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                                     const int                   n,
                                                     hipblasDoubleComplex* const A[],
                                                     const int                   lda,
-                                                    hipblasDoubleComplex* const ipiv[],
+                                                    int*                        ipiv,
+                                                    hipblasDoubleComplex* const C[],
+                                                    const int                   ldc,
                                                     int*                        info,
                                                     const int                   batchCount);
 //! @}
@@ -17445,268 +24721,2812 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t
     \brief SOLVER API
 
     \details
-    geqrfStridedBatched computes the QR factorization of a batch of
-    general m-by-n matrices.
+    potrf computes the Cholesky factorization of a real symmetric (complex Hermitian)
+    positive definite matrix A.
 
-    The factorization of matrix \f$A_i\f$ in the batch has the form
+    (This is the blocked version of the algorithm).
+
+    The factorization has the form:
 
     \f[
-        A_i = Q_i\left[\begin{array}{c}
-        R_i\\
-        0
-        \end{array}\right]
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L  L^H & \: \text{if uplo is lower.}
+        \end{array}
     \f]
 
-    where \f$R_i\f$ is upper triangular (upper trapezoidal if m < n), and \f$Q_i\f$ is
-    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
+    U is an upper triangular matrix and L is lower triangular.
 
-    \f[
-        Q_i = H_{i_1}H_{i_2}\cdots H_{i_k}, \quad \text{with} \: k = \text{min}(m,n)
-    \f]
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
 
-    Each Householder matrix \f$H_{i_j}\f$ is given by
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrix A is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of matrix A.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A to be factored.
+                On exit, the lower or upper triangular factors.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    info        pointer to a int on the GPU.\n
+                If info = 0, successful exit.
+                If info = j > 0, the leading minor of order j of A is not positive definite.
+                The factorization stopped at this point.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrfBatched computes the Cholesky factorization of a batch of real symmetric (complex
+    Hermitian) positive definite matrices \f$A_i\f$.
+
+    The factorization of matrix \f$A_i\f$ in the batch has the form:
 
     \f[
-        H_{i_j} = I - \text{ipiv}_j[j] \cdot v_{i_j} v_{i_j}'
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
     \f]
 
-    where the first j-1 elements of Householder vector \f$v_{i_j}\f$ are zero, and \f$v_{i_j}[j] = 1\f$.
+    \f$U_i\f$ is an upper triangular matrix and \f$L_i\f$ is lower triangular.
 
     - Supported precisions in rocSOLVER : s,d,c,z
     - Supported precisions in cuBLAS    : No support
 
     @param[in]
-    handle    hipblasHandle_t.
-    @param[in]
-    m         int. m >= 0.\n
-              The number of rows of all the matrices A_i in the batch.
-    @param[in]
-    n         int. n >= 0.\n
-              The number of columns of all the matrices A_i in the batch.
-    @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the m-by-n matrices A_i to be factored.
-              On exit, the elements on and above the diagonal contain the
-              factor R_i. The elements below the diagonal are the last m - j elements
-              of Householder vector v_(i_j).
+    handle      hipblasHandle_t.
     @param[in]
-    lda       int. lda >= m.\n
-              Specifies the leading dimension of matrices A_i.
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
     @param[in]
-    strideA   hipblasStride.\n
-              Stride from the start of one matrix A_i to the next one A_(i+1).
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
-    @param[out]
-    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
-              Contains the vectors ipiv_i of corresponding Householder scalars.
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in,out]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_i to be factored.
+                On exit, the lower or upper triangular factors.
     @param[in]
-    strideP   hipblasStride.\n
-              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
-              There is no restriction for the value
-              of strideP. Normal use is strideP >= min(m,n).
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
     @param[out]
-    info      pointer to a int on the host.\n
-              If info = 0, successful exit.
-              If info = j < 0, the argument at position -j is invalid.
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info_i = 0, successful exit for instance i.
+                If info_i = j > 0, the leading minor of order j of A_i is not positive definite.
+                The i-th factorization stopped at this point.
     @param[in]
     batchCount  int. batchCount >= 0.\n
-                 Number of matrices in the batch.
-    ********************************************************************/
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
-                                                           const int           m,
-                                                           const int           n,
-                                                           float*              A,
-                                                           const int           lda,
-                                                           const hipblasStride strideA,
-                                                           float*              ipiv,
-                                                           const hipblasStride strideP,
-                                                           int*                info,
-                                                           const int           batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
-                                                           const int           m,
-                                                           const int           n,
-                                                           double*             A,
-                                                           const int           lda,
-                                                           const hipblasStride strideA,
-                                                           double*             ipiv,
-                                                           const hipblasStride strideP,
-                                                           int*                info,
-                                                           const int           batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
-                                                           const int           m,
-                                                           const int           n,
-                                                           hipblasComplex*     A,
-                                                           const int           lda,
-                                                           const hipblasStride strideA,
-                                                           hipblasComplex*     ipiv,
-                                                           const hipblasStride strideP,
-                                                           int*                info,
-                                                           const int           batchCount);
+                Number of matrices in the batch.
+   ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
-                                                           const int             m,
-                                                           const int             n,
-                                                           hipblasDoubleComplex* A,
-                                                           const int             lda,
-                                                           const hipblasStride   strideA,
-                                                           hipblasDoubleComplex* ipiv,
-                                                           const hipblasStride   strideP,
-                                                           int*                  info,
-                                                           const int             batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batchCount);
 //! @}
 
-/*
- * ===========================================================================
- *   BLAS Extensions
- * ===========================================================================
- */
-
-/*! \brief BLAS EX API
+/*! @{
+    \brief SOLVER API
 
     \details
-    gemmEx performs one of the matrix-matrix operations
+    potrfStridedBatched computes the Cholesky factorization of a batch of real symmetric (complex
+    Hermitian) positive definite matrices \f$A_i\f$.
 
-        C = alpha*op( A )*op( B ) + beta*C,
+    The factorization of matrix \f$A_i\f$ in the batch has the form:
 
-    where op( X ) is one of
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+    \f$U_i\f$ is an upper triangular matrix and \f$L_i\f$ is lower triangular.
 
-    alpha and beta are scalars, and A, B, and C are matrices, with
-    op( A ) an m by k matrix, op( B ) a k by n matrix and C is a m by n matrix.
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
 
-    - Supported types are determined by the backend. See cuBLAS documentation for cuBLAS backend.
-      For rocBLAS backend, conversion from hipblasComputeType_t to rocblas_datatype_t happens within hipBLAS.
-      Supported types are as follows:
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_i to be factored.
+                On exit, the lower or upper triangular factors.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info_i = 0, successful exit for instance i.
+                If info_i = j > 0, the leading minor of order j of A_i is not positive definite.
+                The i-th factorization stopped at this point.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+   ********************************************************************/
 
-      |   aType    |   bType    |   cType    |     computeType     |
-      | ---------- | ---------- | ---------- | ------------------- |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_16F |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16BF | HIP_R_16BF | HIP_R_16BF | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16BF | HIP_R_16BF | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_32F  | HIP_R_32F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_64F  | HIP_R_64F  | HIP_R_64F  | HIPBLAS_COMPUTE_64F |
-      | HIP_R_8I   | HIP_R_8I   | HIP_R_32I  | HIPBLAS_COMPUTE_32I |
-      | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+//! @}
 
-    With HIPBLAS_V2 define, hipblasGemmEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmEx will no
-    longer support hipblasDataType_t for these parameters in a future release.
+/*! @{
+    \brief SOLVER API
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+    \details
+    potrs solves a system of n linear equations on n variables in its factorized form.
 
-            hipblasStatus_t hipblasGemmEx(hipblasHandle_t      handle,
-                                          hipblasOperation_t   transA,
-                                          hipblasOperation_t   transB,
-                                          int                  m,
-                                          int                  n,
-                                          int                  k,
-                                          const void*          alpha,
-                                          const void*          A,
-                                          hipDataType          aType,
-                                          int                  lda,
-                                          const void*          B,
-                                          hipDataType          bType,
-                                          int                  ldb,
-                                          const void*          beta,
-                                          void*                C,
-                                          hipDataType          cType,
-                                          int                  ldc,
-                                          hipblasComputeType_t computeType,
-                                          hipblasGemmAlgo_t    algo)
+    It solves the system
 
-        #else // [DEPRECATED]
+    \f[
+        A X = B
+    \f]
 
-            hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                          hipblasOperation_t transA,
-                                          hipblasOperation_t transB,
-                                          int                m,
-                                          int                n,
-                                          int                k,
-                                          const void*        alpha,
-                                          const void*        A,
-                                          hipblasDatatype_t  aType,
-                                          int                lda,
-                                          const void*        B,
-                                          hipblasDatatype_t  bType,
-                                          int                ldb,
-                                          const void*        beta,
-                                          void*              C,
-                                          hipblasDatatype_t  cType,
-                                          int                ldc,
-                                          hipblasDatatype_t  computeType,
-                                          hipblasGemmAlgo_t  algo)
+    where A is a real symmetric (complex Hermitian) positive definite matrix defined by its
+    triangular factor
 
-        #endif
+    \f[
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L  L^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    as returned by \ref hipblasSpotrf "potrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle      hipblasHandle_t.
     @param[in]
-    transA    [hipblasOperation_t]
-              specifies the form of op( A ).
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrix A is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
     @param[in]
-    transB    [hipblasOperation_t]
-              specifies the form of op( B ).
+    n           int. n >= 0.\n
+                The number of rows and columns of matrix A.
     @param[in]
-    m         [int]
-              matrix dimension m.
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of the matrix B.
     @param[in]
-    n         [int]
-              matrix dimension n.
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factor L or U of the Cholesky factorization of A returned by \ref hipblasSpotrf "potrf".
     @param[in]
-    k         [int]
-              matrix dimension k.
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             float*                  A,
+                                             const int               lda,
+                                             float*                  B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             double*                 A,
+                                             const int               lda,
+                                             double*                 B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             hipblasDoubleComplex*   B,
+                                             const int               ldb,
+                                             int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrsBatched solves a batch of systems of n linear equations on n variables in its
+    factorized forms.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    where \f$A_i\f$ is a real symmetric (complex Hermitian) positive definite matrix defined by
+    its triangular factor
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    as returned by \ref hipblasSpotrfBatched "potrfBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of all the matrices B_i.
+    @param[in]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factor L_i or U_i of the Cholesky factorization of A_i returned by \ref hipblasSpotrfBatched "potrfBatched".
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in,out]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrices X_i.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    float* const            B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    double* const           B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrsStridedBatched solves a batch of systems of n linear equations on n variables in its
+    factorized forms.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    where \f$A_i\f$ is a real symmetric (complex Hermitian) positive definite matrix defined by
+    its triangular factor
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    as returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of all the matrices B_i.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factor L_i or U_i of the Cholesky factorization of A_i returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrices X_i.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           float*                  B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           double*                 B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasDoubleComplex*   B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potri inverts a real symmetric (complex Hermitian) positive definite matrix A, using
+    the triangular factor
+
+    \f[
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L  L^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    computed by \ref hipblasSpotrf "potrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrix A is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of matrix A.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the factor L or U of the Cholesky factorization of A returned by
+                \ref hipblasSpotrf "potrf".
+                On exit, the inverses of A if info = 0, stored in the same triangle.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    info        pointer to a int on the GPU.\n
+                If info = 0, successful exit.
+                If info = j > 0, the j-th diagonal element of the factor is zero,
+                A is singular and its inverse could not be computed.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potriBatched inverts a batch of real symmetric (complex Hermitian) positive definite
+    matrices \f$A_i\f$, using the triangular factors
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    computed by \ref hipblasSpotrfBatched "potrfBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in,out]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the factor L_i or U_i of the Cholesky factorization of A_i returned by
+                \ref hipblasSpotrfBatched "potrfBatched".
+                On exit, the inverses of A_i if info_i = 0, stored in the same triangle.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[out]
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info_i = 0, successful exit for instance i.
+                If info_i = j > 0, the j-th diagonal element of the i-th factor is zero,
+                A_i is singular and its inverse could not be computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potriStridedBatched inverts a batch of real symmetric (complex Hermitian) positive definite
+    matrices \f$A_i\f$, using the triangular factors
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    computed by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the upper or lower part of the Hermitian matrices A_i is stored.
+                If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of rows and columns of all matrices A_i in the batch.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the factor L_i or U_i of the Cholesky factorization of A_i returned by
+                \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+                On exit, the inverses of A_i if info_i = 0, stored in the same triangle.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    info        pointer to int. Array of batchCount integers on the GPU.\n
+                If info_i = 0, successful exit for instance i.
+                If info_i = j > 0, the j-th diagonal element of the i-th factor is zero,
+                A_i is singular and its inverse could not be computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+//! @}
+
+/*! @{
+    \brief GELS solves an overdetermined (or underdetermined) linear system defined by an m-by-n
+    matrix A, and a corresponding matrix B, using the QR factorization computed by \ref hipblasSgeqrf "GEQRF" (or the LQ
+    factorization computed by "GELQF").
+
+    \details
+    Depending on the value of trans, the problem solved by this function is either of the form
+
+    \f[
+        \begin{array}{cl}
+        A X = B & \: \text{not transposed, or}\\
+        A' X = B & \: \text{transposed if real, or conjugate transposed if complex}
+        \end{array}
+    \f]
+
+    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
+    and a least-squares solution approximating X is found by minimizing
+
+    \f[
+        || B - A  X || \quad \text{(or} \: || B - A' X ||\text{)}
+    \f]
+
+    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
+    and a unique solution for X is chosen such that \f$|| X ||\f$ is minimal.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of matrix A.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of matrix A.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of columns of matrices B and X;
+                i.e., the columns on the right hand side.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A.
+                On exit, the QR (or LQ) factorization of A as returned by "GEQRF" (or "GELQF").
+    @param[in]
+    lda         int. lda >= m.\n
+                Specifies the leading dimension of matrix A.
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the matrix B.
+                On exit, when info = 0, B is overwritten by the solution vectors (and the residuals in
+                the overdetermined cases) stored as columns.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                Specifies the leading dimension of matrix B.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int on the GPU.\n
+                If info = 0, successful exit.
+                If info = i > 0, the solution could not be computed because input matrix A is
+                rank deficient; the i-th diagonal element of its triangular factor is zero.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          nrhs,
+                                            float*             A,
+                                            const int          lda,
+                                            float*             B,
+                                            const int          ldb,
+                                            int*               info,
+                                            int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          nrhs,
+                                            double*            A,
+                                            const int          lda,
+                                            double*            B,
+                                            const int          ldb,
+                                            int*               info,
+                                            int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          nrhs,
+                                            hipblasComplex*    A,
+                                            const int          lda,
+                                            hipblasComplex*    B,
+                                            const int          ldb,
+                                            int*               info,
+                                            int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
+                                            hipblasOperation_t    trans,
+                                            const int             m,
+                                            const int             n,
+                                            const int             nrhs,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            hipblasDoubleComplex* B,
+                                            const int             ldb,
+                                            int*                  info,
+                                            int*                  deviceInfo);
+///@}
+
+/*! @{
+    \brief gelsBatched solves a batch of overdetermined (or underdetermined) linear systems
+    defined by a set of m-by-n matrices \f$A_j\f$, and corresponding matrices \f$B_j\f$, using the
+    QR factorizations computed by "GEQRF_BATCHED" (or the LQ factorizations computed by "GELQF_BATCHED").
+
+    \details
+    For each instance in the batch, depending on the value of trans, the problem solved by this function is either of the form
+
+    \f[
+        \begin{array}{cl}
+        A_j X_j = B_j & \: \text{not transposed, or}\\
+        A_j' X_j = B_j & \: \text{transposed if real, or conjugate transposed if complex}
+        \end{array}
+    \f]
+
+    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
+    and a least-squares solution approximating X_j is found by minimizing
+
+    \f[
+        || B_j - A_j  X_j || \quad \text{(or} \: || B_j - A_j' X_j ||\text{)}
+    \f]
+
+    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
+    and a unique solution for X_j is chosen such that \f$|| X_j ||\f$ is minimal.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+    Note that cuBLAS backend supports only the non-transpose operation and only solves over-determined systems (m >= n).
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of all matrices A_j in the batch.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of all matrices A_j in the batch.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of columns of all matrices B_j and X_j in the batch;
+                i.e., the columns on the right hand side.
+    @param[inout]
+    A           array of pointer to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j.
+                On exit, the QR (or LQ) factorizations of A_j as returned by "GEQRF_BATCHED"
+                (or "GELQF_BATCHED").
+    @param[in]
+    lda         int. lda >= m.\n
+                Specifies the leading dimension of matrices A_j.
+    @param[inout]
+    B           array of pointer to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the matrices B_j.
+                On exit, when info[j] = 0, B_j is overwritten by the solution vectors (and the residuals in
+                the overdetermined cases) stored as columns.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                Specifies the leading dimension of matrices B_j.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[j] = 0, successful exit for solution of A_j.
+                If deviceInfo[j] = i > 0, the solution of A_j could not be computed because input
+                matrix A_j is rank deficient; the i-th diagonal element of its triangular factor is zero.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t trans,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const int          nrhs,
+                                                   float* const       A[],
+                                                   const int          lda,
+                                                   float* const       B[],
+                                                   const int          ldb,
+                                                   int*               info,
+                                                   int*               deviceInfo,
+                                                   const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t trans,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const int          nrhs,
+                                                   double* const      A[],
+                                                   const int          lda,
+                                                   double* const      B[],
+                                                   const int          ldb,
+                                                   int*               info,
+                                                   int*               deviceInfo,
+                                                   const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
+                                                   hipblasOperation_t    trans,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   int*                  deviceInfo,
+                                                   const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          trans,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const int                   nrhs,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex* const B[],
+                                                   const int                   ldb,
+                                                   int*                        info,
+                                                   int*                        deviceInfo,
+                                                   const int                   batchCount);
+///@}
+
+/*! @{
+    \brief gelsStridedBatched solves a batch of overdetermined (or underdetermined) linear
+    systems defined by a set of m-by-n matrices \f$A_j\f$, and corresponding matrices \f$B_j\f$,
+    using the QR factorizations computed by "GEQRF_STRIDED_BATCHED"
+    (or the LQ factorizations computed by "GELQF_STRIDED_BATCHED").
+
+    \details
+    For each instance in the batch, depending on the value of trans, the problem solved by this function is either of the form
+
+    \f[
+        \begin{array}{cl}
+        A_j X_j = B_j & \: \text{not transposed, or}\\
+        A_j' X_j = B_j & \: \text{transposed if real, or conjugate transposed if complex}
+        \end{array}
+    \f]
+
+    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
+    and a least-squares solution approximating X_j is found by minimizing
+
+    \f[
+        || B_j - A_j  X_j || \quad \text{(or} \: || B_j - A_j' X_j ||\text{)}
+    \f]
+
+    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
+    and a unique solution for X_j is chosen such that \f$|| X_j ||\f$ is minimal.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of all matrices A_j in the batch.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of all matrices A_j in the batch.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of columns of all matrices B_j and X_j in the batch;
+                i.e., the columns on the right hand side.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j.
+                On exit, the QR (or LQ) factorizations of A_j as returned by "GEQRF_STRIDED_BATCHED"
+                (or "GELQF_STRIDED_BATCHED").
+    @param[in]
+    lda         int. lda >= m.\n
+                Specifies the leading dimension of matrices A_j.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_j to the next one A_(j+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[inout]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the matrices B_j.
+                On exit, when info[j] = 0, each B_j is overwritten by the solution vectors (and the residuals in
+                the overdetermined cases) stored as columns.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                Specifies the leading dimension of matrices B_j.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_j to the next one B_(j+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[j] = 0, successful exit for solution of A_j.
+                If deviceInfo[j] = i > 0, the solution of A_j could not be computed because input
+                matrix A_j is rank deficient; the i-th diagonal element of its triangular factor is zero.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
+                                                          hipblasOperation_t  trans,
+                                                          const int           m,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          float*              A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          float*              B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          int*                deviceInfo,
+                                                          const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
+                                                          hipblasOperation_t  trans,
+                                                          const int           m,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          double*             A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          double*             B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          int*                deviceInfo,
+                                                          const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
+                                                          hipblasOperation_t  trans,
+                                                          const int           m,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          int*                deviceInfo,
+                                                          const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    trans,
+                                                          const int             m,
+                                                          const int             n,
+                                                          const int             nrhs,
+                                                          hipblasDoubleComplex* A,
+                                                          const int             lda,
+                                                          const hipblasStride   strideA,
+                                                          hipblasDoubleComplex* B,
+                                                          const int             ldb,
+                                                          const hipblasStride   strideB,
+                                                          int*                  info,
+                                                          int*                  deviceInfo,
+                                                          const int             batch_count);
+///@}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gelsDeviceInfo solves an overdetermined (or underdetermined) linear system in the least-squares
+    sense, as \ref hipblasSgels "gels" does, without reading or writing host memory of the caller:
+    invalid arguments are reported through the returned status only, and there is no host-side info.
+    Rank deficiency is reported through deviceInfo, as in \ref hipblasSgels "gels".
+
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of A.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of A.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e. the number of columns of B.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrices A. On exit, their QR (or LQ) factorizations.
+    @param[in]
+    lda         int. lda >= m.\n
+                The leading dimension of A.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand sides B. On exit, the solutions X.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                The leading dimension of B.
+    @param[out]
+    deviceInfo  pointer to int on the GPU.\n
+                If deviceInfo = 0, successful exit.
+                If deviceInfo = i > 0, the solution could not be computed because A is rank
+                deficient; the i-th diagonal element of its triangular factor is zero.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsDeviceInfo(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      const int          m,
+                                                      const int          n,
+                                                      const int          nrhs,
+                                                      float*             A,
+                                                      const int          lda,
+                                                      float*             B,
+                                                      const int          ldb,
+                                                      int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsDeviceInfo(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      const int          m,
+                                                      const int          n,
+                                                      const int          nrhs,
+                                                      double*            A,
+                                                      const int          lda,
+                                                      double*            B,
+                                                      const int          ldb,
+                                                      int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsDeviceInfo(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      const int          m,
+                                                      const int          n,
+                                                      const int          nrhs,
+                                                      hipblasComplex*    A,
+                                                      const int          lda,
+                                                      hipblasComplex*    B,
+                                                      const int          ldb,
+                                                      int*               deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsDeviceInfo(hipblasHandle_t       handle,
+                                                      hipblasOperation_t    trans,
+                                                      const int             m,
+                                                      const int             n,
+                                                      const int             nrhs,
+                                                      hipblasDoubleComplex* A,
+                                                      const int             lda,
+                                                      hipblasDoubleComplex* B,
+                                                      const int             ldb,
+                                                      int*                  deviceInfo);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gelsBatchedDeviceInfo solves an overdetermined (or underdetermined) linear system in the
+    least-squares sense, for each instance of a batch, as \ref hipblasSgelsBatched "gelsBatched"
+    does, without reading or writing host memory of the caller: invalid arguments are reported
+    through the returned status only, and there is no host-side info. Rank deficiency is reported
+    through deviceInfo, as in \ref hipblasSgelsBatched "gelsBatched".
+
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of A_j.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of A_j.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e. the number of columns of B_j.
+    @param[inout]
+    A           array of pointers to type.\n
+                Each pointer points to an array on the GPU of dimension lda*n.
+                On entry, the matrices A_j. On exit, their QR (or LQ) factorizations.
+    @param[in]
+    lda         int. lda >= m.\n
+                The leading dimension of A_j.
+    @param[in,out]
+    B           array of pointers to type.\n
+                Each pointer points to an array on the GPU of dimension ldb*nrhs.
+                On entry, the right hand sides B_j. On exit, the solutions X_j.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                The leading dimension of B_j.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[j] = 0, successful exit.
+                If deviceInfo[j] = i > 0, the solution could not be computed because A_j is rank
+                deficient; the i-th diagonal element of its triangular factor is zero.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsBatchedDeviceInfo(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             const int          m,
+                                                             const int          n,
+                                                             const int          nrhs,
+                                                             float* const       A[],
+                                                             const int          lda,
+                                                             float* const       B[],
+                                                             const int          ldb,
+                                                             int*               deviceInfo,
+                                                             const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsBatchedDeviceInfo(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             const int          m,
+                                                             const int          n,
+                                                             const int          nrhs,
+                                                             double* const      A[],
+                                                             const int          lda,
+                                                             double* const      B[],
+                                                             const int          ldb,
+                                                             int*               deviceInfo,
+                                                             const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsBatchedDeviceInfo(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    trans,
+                                                             const int             m,
+                                                             const int             n,
+                                                             const int             nrhs,
+                                                             hipblasComplex* const A[],
+                                                             const int             lda,
+                                                             hipblasComplex* const B[],
+                                                             const int             ldb,
+                                                             int*                  deviceInfo,
+                                                             const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgelsBatchedDeviceInfo(hipblasHandle_t             handle,
+                                  hipblasOperation_t          trans,
+                                  const int                   m,
+                                  const int                   n,
+                                  const int                   nrhs,
+                                  hipblasDoubleComplex* const A[],
+                                  const int                   lda,
+                                  hipblasDoubleComplex* const B[],
+                                  const int                   ldb,
+                                  int*                        deviceInfo,
+                                  const int                   batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gelsStridedBatchedDeviceInfo solves an overdetermined (or underdetermined) linear system in the
+    least-squares sense, for each instance of a batch, as \ref hipblasSgelsStridedBatched
+    "gelsStridedBatched" does, without reading or writing host memory of the caller: invalid
+    arguments are reported through the returned status only, and there is no host-side info. Rank
+    deficiency is reported through deviceInfo, as in \ref hipblasSgelsStridedBatched
+    "gelsStridedBatched".
+
+    This allows a pipeline of solvers to be enqueued, or captured into a hipGraph, without
+    synchronizing with the host.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations.
+    @param[in]
+    m           int. m >= 0.\n
+                The number of rows of A_j.
+    @param[in]
+    n           int. n >= 0.\n
+                The number of columns of A_j.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e. the number of columns of B_j.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j. On exit, their QR (or LQ) factorizations.
+    @param[in]
+    lda         int. lda >= m.\n
+                The leading dimension of A_j.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_j to the next one A_(j+1).
+    @param[in,out]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the right hand sides B_j. On exit, the solutions X_j.
+    @param[in]
+    ldb         int. ldb >= max(m,n).\n
+                The leading dimension of B_j.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_j to the next one B_(j+1).
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[j] = 0, successful exit.
+                If deviceInfo[j] = i > 0, the solution could not be computed because A_j is rank
+                deficient; the i-th diagonal element of its triangular factor is zero.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                                    hipblasOperation_t  trans,
+                                                                    const int           m,
+                                                                    const int           n,
+                                                                    const int           nrhs,
+                                                                    float*              A,
+                                                                    const int           lda,
+                                                                    const hipblasStride strideA,
+                                                                    float*              B,
+                                                                    const int           ldb,
+                                                                    const hipblasStride strideB,
+                                                                    int*                deviceInfo,
+                                                                    const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                                    hipblasOperation_t  trans,
+                                                                    const int           m,
+                                                                    const int           n,
+                                                                    const int           nrhs,
+                                                                    double*             A,
+                                                                    const int           lda,
+                                                                    const hipblasStride strideA,
+                                                                    double*             B,
+                                                                    const int           ldb,
+                                                                    const hipblasStride strideB,
+                                                                    int*                deviceInfo,
+                                                                    const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                                    hipblasOperation_t  trans,
+                                                                    const int           m,
+                                                                    const int           n,
+                                                                    const int           nrhs,
+                                                                    hipblasComplex*     A,
+                                                                    const int           lda,
+                                                                    const hipblasStride strideA,
+                                                                    hipblasComplex*     B,
+                                                                    const int           ldb,
+                                                                    const hipblasStride strideB,
+                                                                    int*                deviceInfo,
+                                                                    const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgelsStridedBatchedDeviceInfo(hipblasHandle_t       handle,
+                                         hipblasOperation_t    trans,
+                                         const int             m,
+                                         const int             n,
+                                         const int             nrhs,
+                                         hipblasDoubleComplex* A,
+                                         const int             lda,
+                                         const hipblasStride   strideA,
+                                         hipblasDoubleComplex* B,
+                                         const int             ldb,
+                                         const hipblasStride   strideB,
+                                         int*                  deviceInfo,
+                                         const int             batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    geqrf computes a QR factorization of a general m-by-n matrix A.
+
+    The factorization has the form
+
+    \f[
+        A = Q\left[\begin{array}{c}
+        R\\
+        0
+        \end{array}\right]
+    \f]
+
+    where R is upper triangular (upper trapezoidal if m < n), and Q is
+    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
+
+    \f[
+        Q = H_1H_2\cdots H_k, \quad \text{with} \: k = \text{min}(m,n)
+    \f]
+
+    Each Householder matrix \f$H_i\f$ is given by
+
+    \f[
+        H_i = I - \text{ipiv}[i] \cdot v_i v_i'
+    \f]
+
+    where the first i-1 elements of the Householder vector \f$v_i\f$ are zero, and \f$v_i[i] = 1\f$.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of the matrix A.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrix to be factored.
+              On exit, the elements on and above the diagonal contain the
+              factor R; the elements below the diagonal are the last m - i elements
+              of Householder vector v_i.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
+              The Householder scalars.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             float*          A,
+                                             const int       lda,
+                                             float*          ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             double*         A,
+                                             const int       lda,
+                                             double*         ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             hipblasDoubleComplex* ipiv,
+                                             int*                  info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    geqrfBatched computes the QR factorization of a batch of general
+    m-by-n matrices.
+
+    The factorization of matrix \f$A_i\f$ in the batch has the form
+
+    \f[
+        A_i = Q_i\left[\begin{array}{c}
+        R_i\\
+        0
+        \end{array}\right]
+    \f]
+
+    where \f$R_i\f$ is upper triangular (upper trapezoidal if m < n), and \f$Q_i\f$ is
+    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
+
+    \f[
+        Q_i = H_{i_1}H_{i_2}\cdots H_{i_k}, \quad \text{with} \: k = \text{min}(m,n)
+    \f]
+
+    Each Householder matrix \f$H_{i_j}\f$ is given by
+
+    \f[
+        H_{i_j} = I - \text{ipiv}_i[j] \cdot v_{i_j} v_{i_j}'
+    \f]
+
+    where the first j-1 elements of Householder vector \f$v_{i_j}\f$ are zero, and \f$v_{i_j}[j] = 1\f$.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all the matrices A_i in the batch.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of all the matrices A_i in the batch.
+    @param[inout]
+    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrices A_i to be factored.
+              On exit, the elements on and above the diagonal contain the
+              factor R_i. The elements below the diagonal are the last m - j elements
+              of Householder vector v_(i_j).
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv      array of pointers to type. Each pointer points to an array on the GPU
+              of dimension min(m, n).\n
+              Contains the vectors ipiv_i of corresponding Householder scalars.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    float* const    A[],
+                                                    const int       lda,
+                                                    float* const    ipiv[],
+                                                    int*            info,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    double* const   A[],
+                                                    const int       lda,
+                                                    double* const   ipiv[],
+                                                    int*            info,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
+                                                    const int             m,
+                                                    const int             n,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const ipiv[],
+                                                    int*                  info,
+                                                    const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const ipiv[],
+                                                    int*                        info,
+                                                    const int                   batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    geqrfStridedBatched computes the QR factorization of a batch of
+    general m-by-n matrices.
+
+    The factorization of matrix \f$A_i\f$ in the batch has the form
+
+    \f[
+        A_i = Q_i\left[\begin{array}{c}
+        R_i\\
+        0
+        \end{array}\right]
+    \f]
+
+    where \f$R_i\f$ is upper triangular (upper trapezoidal if m < n), and \f$Q_i\f$ is
+    a m-by-m orthogonal/unitary matrix represented as the product of Householder matrices
+
+    \f[
+        Q_i = H_{i_1}H_{i_2}\cdots H_{i_k}, \quad \text{with} \: k = \text{min}(m,n)
+    \f]
+
+    Each Householder matrix \f$H_{i_j}\f$ is given by
+
+    \f[
+        H_{i_j} = I - \text{ipiv}_j[j] \cdot v_{i_j} v_{i_j}'
+    \f]
+
+    where the first j-1 elements of Householder vector \f$v_{i_j}\f$ are zero, and \f$v_{i_j}[j] = 1\f$.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all the matrices A_i in the batch.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of all the matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the m-by-n matrices A_i to be factored.
+              On exit, the elements on and above the diagonal contain the
+              factor R_i. The elements below the diagonal are the last m - j elements
+              of Householder vector v_(i_j).
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors ipiv_i of corresponding Householder scalars.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+              There is no restriction for the value
+              of strideP. Normal use is strideP >= min(m,n).
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           float*              A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           float*              ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           double*             ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           hipblasComplex*     ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const hipblasStride   strideA,
+                                                           hipblasDoubleComplex* ipiv,
+                                                           const hipblasStride   strideP,
+                                                           int*                  info,
+                                                           const int             batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details gesv solves a system of n linear equations on n variables
+
+    \f[
+        A X = B
+    \f]
+
+    in double precision by factoring A in single precision with \ref hipblasSgetrf "getrf"
+    and refining the solution with residuals computed in double precision:
+
+    \f[
+        R = B - A X, \quad A D = R, \quad X = X + D
+    \f]
+
+    The solves use the single precision factors widened to double precision. Refinement stops
+    once each column satisfies \f$\|r_j\|_2 \leq \|x_j\|_2 \|A\|_\infty \epsilon n\f$,
+    where the row sums of \f$\|A\|_\infty\f$ add \f$|Re(a_{ij})| + |Im(a_{ij})|\f$ for complex A.
+    If the single precision factorization cannot be used, or refinement stalls or does not
+    converge in 30 steps, A is factored in double precision instead, as LAPACK dsgesv does.
+    A is rounded to single precision, and its factors widened back, on the host; the refinement
+    runs on the device but reads the norms on the host after each step, so the call synchronizes
+    with the handle's stream and cannot be captured into a hipGraph.
+
+    - Supported precisions : ds (double precision with single precision factors),
+                             zc (double complex with single complex factors)
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of B.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The matrix A. A is not modified.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n.\n
+                The pivot indices of the factorization used for the solution.
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B. B is not modified.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                The solution matrix X.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of X.
+    @param[out]
+    iter        pointer to int on the host.\n
+                If iter >= 0, the number of refinement steps taken.
+                If iter < 0, the solution was computed with a double precision factorization because
+                -2: A overflowed in single precision,
+                -3: the single precision factorization was singular,
+                -4: refinement stalled, or
+                -31: refinement did not converge in 30 steps.
+    @param[out]
+    residual    pointer to double on the host.\n
+                The scaled residual max_j ||b_j - A x_j||_2 / (||A||_inf ||x_j||_2) of the
+                returned solution; infinite if A is singular.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int on the GPU.\n
+                If deviceInfo = 0, successful exit.
+                If deviceInfo = j > 0, U is singular. U[j,j] is the first zero pivot, and X is
+                not the solution.
+
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             const double*   A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             const double*   B,
+                                             const int       ldb,
+                                             double*         X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             double*         residual,
+                                             int*            info,
+                                             int*            deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             const int                   nrhs,
+                                             const hipblasDoubleComplex* A,
+                                             const int                   lda,
+                                             int*                        ipiv,
+                                             const hipblasDoubleComplex* B,
+                                             const int                   ldb,
+                                             hipblasDoubleComplex*       X,
+                                             const int                   ldx,
+                                             int*                        iter,
+                                             double*                     residual,
+                                             int*                        info,
+                                             int*                        deviceInfo);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details gesvBatched solves a batch of systems of n linear equations on n variables
+    in double precision with single precision factors and iterative refinement.
+
+    For each instance i in the batch, it solves
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    as described for \ref hipblasDSgesv "gesv".
+
+    - Supported precisions : ds (double precision with single precision factors),
+                             zc (double complex with single complex factors)
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of all B_i.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The matrices A_i. They are not modified.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount.\n
+                The pivot indices of the factorization used for the solution of each instance.
+    @param[in]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrices B_i. They are not modified.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[out]
+    X           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[out]
+    iter        pointer to int. Array on the host of dimension batchCount.\n
+                The number of refinement steps taken for each instance, or a negative value if
+                it was solved with a double precision factorization, as described for
+                \ref hipblasDSgesv "gesv".
+    @param[out]
+    residual    pointer to double. Array on the host of dimension batchCount.\n
+                The scaled residual of the returned solution of each instance.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array on the GPU of dimension batchCount.\n
+                If deviceInfo[i] = 0, successful exit for instance i.
+                If deviceInfo[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    const int           nrhs,
+                                                    const double* const A[],
+                                                    const int           lda,
+                                                    int*                ipiv,
+                                                    const double* const B[],
+                                                    const int           ldb,
+                                                    double* const       X[],
+                                                    const int           ldx,
+                                                    int*                iter,
+                                                    double*             residual,
+                                                    int*                info,
+                                                    int*                deviceInfo,
+                                                    const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                                    const int                         n,
+                                                    const int                         nrhs,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda,
+                                                    int*                              ipiv,
+                                                    const hipblasDoubleComplex* const B[],
+                                                    const int                         ldb,
+                                                    hipblasDoubleComplex* const       X[],
+                                                    const int                         ldx,
+                                                    int*                              iter,
+                                                    double*                           residual,
+                                                    int*                              info,
+                                                    int*                              deviceInfo,
+                                                    const int                         batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details gesvStridedBatched solves a batch of systems of n linear equations on n variables
+    in double precision with single precision factors and iterative refinement.
+
+    For each instance i in the batch, it solves
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    as described for \ref hipblasDSgesv "gesv".
+
+    - Supported precisions : ds (double precision with single precision factors),
+                             zc (double complex with single complex factors)
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of all B_i.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The matrices A_i. They are not modified.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+    @param[out]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                The pivot indices of the factorization used for the solution of each instance.
+    @param[in]
+    strideP     hipblasStride. strideP >= n.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+    @param[in]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                The right hand side matrices B_i. They are not modified.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+    @param[out]
+    X           pointer to type. Array on the GPU (the size depends on the value of strideX).\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[in]
+    strideX     hipblasStride.\n
+                Stride from the start of one matrix X_i to the next one X_(i+1).
+    @param[out]
+    iter        pointer to int. Array on the host of dimension batchCount.\n
+                The number of refinement steps taken for each instance, or a negative value if
+                it was solved with a double precision factorization, as described for
+                \ref hipblasDSgesv "gesv".
+    @param[out]
+    residual    pointer to double. Array on the host of dimension batchCount.\n
+                The scaled residual of the returned solution of each instance.
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array on the GPU of dimension batchCount.\n
+                If deviceInfo[i] = 0, successful exit for instance i.
+                If deviceInfo[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           const double*       A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           const double*       B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           double*             X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           double*             residual,
+                                                           int*                info,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                                           const int                   n,
+                                                           const int                   nrhs,
+                                                           const hipblasDoubleComplex* A,
+                                                           const int                   lda,
+                                                           const hipblasStride         strideA,
+                                                           int*                        ipiv,
+                                                           const hipblasStride         strideP,
+                                                           const hipblasDoubleComplex* B,
+                                                           const int                   ldb,
+                                                           const hipblasStride         strideB,
+                                                           hipblasDoubleComplex*       X,
+                                                           const int                   ldx,
+                                                           const hipblasStride         strideX,
+                                                           int*                        iter,
+                                                           double*                     residual,
+                                                           int*                        info,
+                                                           int*                        deviceInfo,
+                                                           const int                   batchCount);
+//! @}
+
+/*
+ * ===========================================================================
+ *   BLAS Extensions
+ * ===========================================================================
+ */
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmEx performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B, and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C is a m by n matrix.
+
+    - Supported types are determined by the backend. See cuBLAS documentation for cuBLAS backend.
+      For rocBLAS backend, conversion from hipblasComputeType_t to rocblas_datatype_t happens within hipBLAS.
+      Supported types are as follows:
+
+      |   aType    |   bType    |   cType    |     computeType     |
+      | ---------- | ---------- | ---------- | ------------------- |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_16F |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16BF | HIP_R_16BF | HIP_R_16BF | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16BF | HIP_R_16BF | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_32F  | HIP_R_32F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_64F  | HIP_R_64F  | HIP_R_64F  | HIPBLAS_COMPUTE_64F |
+      | HIP_R_8I   | HIP_R_8I   | HIP_R_32I  | HIPBLAS_COMPUTE_32I |
+      | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
+
+    - With hipDataType, A and B may also be FP8, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ on the
+      rocBLAS backend, and HIP_R_8F_E4M3 or HIP_R_8F_E5M2 on the cuBLAS backend. See gemmExScaled.
+
+    With HIPBLAS_V2 define, hipblasGemmEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmEx will no
+    longer support hipblasDataType_t for these parameters in a future release.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmEx(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transA,
+                                          hipblasOperation_t   transB,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasComputeType_t computeType,
+                                          hipblasGemmAlgo_t    algo)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  aType,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  bType,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  cType,
+                                          int                ldc,
+                                          hipblasDatatype_t  computeType,
+                                          hipblasGemmAlgo_t  algo)
+
+        #endif
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix A.\n
+    [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix B.\n
+    [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix C.\n
+    [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of computation.\n
+    [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  aType,
+                                             int                lda,
+                                             const void*        B,
+                                             hipblasDatatype_t  bType,
+                                             int                ldb,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  cType,
+                                             int                ldc,
+                                             hipblasDatatype_t  computeType,
+                                             hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
+                                                hipblasOperation_t   transA,
+                                                hipblasOperation_t   transB,
+                                                int                  m,
+                                                int                  n,
+                                                int                  k,
+                                                const void*          alpha,
+                                                const void*          A,
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void*          B,
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                const void*          beta,
+                                                void*                C,
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                hipblasComputeType_t computeType,
+                                                hipblasGemmAlgo_t    algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmExEpilogue performs the matrix-matrix operation
+
+        C = scale * act( alpha*op( A )*op( B ) + beta*C + bias ),
+
+    where op( X ) is as for gemmEx, bias is a vector of m elements added to every column, and act is
+    the activation of the epilogue. Optionally, the values before the activation are written to
+    aux, e.g. for the backward pass of a GELU layer. If epilogue is NULL, gemmExEpilogue is
+    gemmEx.
+
+    The epilogue is applied on the device. With the cuBLAS backend, it is applied by cublasLtMatmul
+    as part of the gemm, and with the rocBLAS backend by hipblasLtMatmul when hipBLAS is built with
+    hipBLASLt, for A, B and C of one type of HIP_R_16F, HIP_R_16BF and HIP_R_32F computed in
+    HIPBLAS_COMPUTE_32F. The values before a ReLU take a second gemm into aux. A scale other than 1
+    is folded into alpha and beta when they are host pointers and it commutes with the epilogue,
+    and otherwise applied by a further gemm. Without an activation, epilogues the Lt libraries do
+    not take are applied by further gemms: the bias by a gemm against a vector of ones, aux is
+    copied from C and the scale is applied by a gemm with k = 0.
+
+    HIPBLAS_STATUS_NOT_SUPPORTED is returned, without writing C, for an activation the Lt library
+    has no algorithm for, e.g. with k = 0, FP8 inputs or a misaligned ldaux, and for any activation
+    with the rocBLAS backend built without hipBLASLt. Epilogues are not applied on the host.
+
+    - Supported types are those of gemmEx with cType HIP_R_16F, HIP_R_16BF, HIP_R_32F or HIP_R_64F.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in, out]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of matrix C, bias and aux.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+    @param[in]
+    epilogue  [const hipblasGemmEpilogue_t *]
+              host pointer to the epilogue, or NULL.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExEpilogue(hipblasHandle_t              handle,
+                                                     hipblasOperation_t           transA,
+                                                     hipblasOperation_t           transB,
+                                                     int                          m,
+                                                     int                          n,
+                                                     int                          k,
+                                                     const void*                  alpha,
+                                                     const void*                  A,
+                                                     hipDataType                  aType,
+                                                     int                          lda,
+                                                     const void*                  B,
+                                                     hipDataType                  bType,
+                                                     int                          ldb,
+                                                     const void*                  beta,
+                                                     void*                        C,
+                                                     hipDataType                  cType,
+                                                     int                          ldc,
+                                                     hipblasComputeType_t         computeType,
+                                                     hipblasGemmAlgo_t            algo,
+                                                     const hipblasGemmEpilogue_t* epilogue);
+
+/*! \brief BLAS EX API
+    \details
+    gemmBatchedEx performs one of the batched matrix-matrix operations
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
+    where op( X ) is one of
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
+    op( A ) an m by k by batchCount batched matrix,
+    op( B ) a k by n by batchCount batched matrix and
+    C a m by n by batchCount batched matrix.
+    The batched matrices are an array of pointers to matrices.
+    The number of pointers to matrices is batchCount.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    With HIPBLAS_V2 define, hipblasGemmBatchedEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmBatchedEx will no
+    longer support hipblasDataType_t for these parameters in a future release.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transA,
+                                                 hipblasOperation_t   transB,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          aType,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          bType,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          cType,
+                                                 int                  ldc,
+                                                 int                  batchCount,
+                                                 hipblasComputeType_t computeType,
+                                                 hipblasGemmAlgo_t    algo)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 const void*        alpha,
+                                                 const void*        A[],
+                                                 hipblasDatatype_t  aType,
+                                                 int                lda,
+                                                 const void*        B[],
+                                                 hipblasDatatype_t  bType,
+                                                 int                ldb,
+                                                 const void*        beta,
+                                                 void*              C[],
+                                                 hipblasDatatype_t  cType,
+                                                 int                ldc,
+                                                 int                batchCount,
+                                                 hipblasDatatype_t  computeType,
+                                                 hipblasGemmAlgo_t  algo)
+
+        #endif
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing array of pointers to each matrix A_i.
+    @param[in]
+    aType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix A_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         [void *]
+              device pointer storing array of pointers to each matrix B_i.
+    @param[in]
+    bType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix B_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i.
+    @param[in]
+    cType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix C_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of computation.\n
+    [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  aType,
+                                                    int                lda,
+                                                    const void*        B[],
+                                                    hipblasDatatype_t  bType,
+                                                    int                ldb,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  cType,
+                                                    int                ldc,
+                                                    int                batchCount,
+                                                    hipblasDatatype_t  computeType,
+                                                    hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   transA,
+                                                       hipblasOperation_t   transB,
+                                                       int                  m,
+                                                       int                  n,
+                                                       int                  k,
+                                                       const void*          alpha,
+                                                       const void*          A[],
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       const void*          B[],
+                                                       hipDataType          bType,
+                                                       int                  ldb,
+                                                       const void*          beta,
+                                                       void*                C[],
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType,
+                                                       hipblasGemmAlgo_t    algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix,
+    op( B ) a k by n by batchCount strided_batched matrix and
+    C a m by n by batchCount strided_batched matrix.
+
+    The strided_batched matrices are multiple matrices separated by a constant stride.
+    The number of matrices is batchCount.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    With HIPBLAS_V2 define, hipblasGemmStridedBatchedEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmStridedBatchedEx will no
+    longer support hipblasDataType_t for these parameters in a future release.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transA,
+                                                        hipblasOperation_t   transB,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          aType,
+                                                        int                  lda,
+                                                        hipblasStride        strideA,
+                                                        const void*          B,
+                                                        hipDataType          bType,
+                                                        int                  ldb,
+                                                        hipblasStride        strideB,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          cType,
+                                                        int                  ldc,
+                                                        hipblasStride        strideC,
+                                                        int                  batchCount,
+                                                        hipblasComputeType_t computeType,
+                                                        hipblasGemmAlgo_t    algo)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transA,
+                                                        hipblasOperation_t transB,
+                                                        int                m,
+                                                        int                n,
+                                                        int                k,
+                                                        const void*        alpha,
+                                                        const void*        A,
+                                                        hipblasDatatype_t  aType,
+                                                        int                lda,
+                                                        hipblasStride      strideA,
+                                                        const void*        B,
+                                                        hipblasDatatype_t  bType,
+                                                        int                ldb,
+                                                        hipblasStride      strideB,
+                                                        const void*        beta,
+                                                        void*              C,
+                                                        hipblasDatatype_t  cType,
+                                                        int                ldc,
+                                                        hipblasStride      strideC,
+                                                        int                batchCount,
+                                                        hipblasDatatype_t  computeType,
+                                                        hipblasGemmAlgo_t  algo)
+
+        #endif
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
     @param[in]
     alpha     [const void *]
               device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
     @param[in]
     A         [void *]
-              device pointer storing matrix A.
+              device pointer pointing to first matrix A_1.
     @param[in]
     aType
     [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix A.\n
+              specifies the datatype of each matrix A_i.\n
     [hipDataType]
-              specifies the datatype of matrix A.
+              specifies the datatype of each matrix A_i.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A.
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA  [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
     @param[in]
     B         [void *]
-              device pointer storing matrix B.
+              device pointer pointing to first matrix B_1.
     @param[in]
     bType
     [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix B.\n
+              specifies the datatype of each matrix B_i.\n
     [hipDataType]
-              specifies the datatype of matrix B.
+              specifies the datatype of each matrix B_i.
     @param[in]
     ldb       [int]
-              specifies the leading dimension of B.
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB  [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
     @param[in]
     beta      [const void *]
               device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
     @param[in]
     C         [void *]
-              device pointer storing matrix C.
+              device pointer pointing to first matrix C_1.
     @param[in]
     cType
     [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix C.\n
+              specifies the datatype of each matrix C_i.\n
     [hipDataType]
-              specifies the datatype of matrix C.
+              specifies the datatype of each matrix C_i.
     @param[in]
     ldc       [int]
-              specifies the leading dimension of C.
+              specifies the leading dimension of each C_i.
+    @param[in]
+    strideC  [hipblasStride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
     @param[in]
     computeType
     [hipblasDatatype_t] [DEPRECATED]
@@ -17718,114 +27538,238 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
               enumerant specifying the algorithm type.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                             hipblasOperation_t transA,
-                                             hipblasOperation_t transB,
-                                             int                m,
-                                             int                n,
-                                             int                k,
-                                             const void*        alpha,
-                                             const void*        A,
-                                             hipblasDatatype_t  aType,
-                                             int                lda,
-                                             const void*        B,
-                                             hipblasDatatype_t  bType,
-                                             int                ldb,
-                                             const void*        beta,
-                                             void*              C,
-                                             hipblasDatatype_t  cType,
-                                             int                ldc,
-                                             hipblasDatatype_t  computeType,
-                                             hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  aType,
+                                                           int                lda,
+                                                           hipblasStride      strideA,
+                                                           const void*        B,
+                                                           hipblasDatatype_t  bType,
+                                                           int                ldb,
+                                                           hipblasStride      strideB,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  cType,
+                                                           int                ldc,
+                                                           hipblasStride      strideC,
+                                                           int                batchCount,
+                                                           hipblasDatatype_t  computeType,
+                                                           hipblasGemmAlgo_t  algo);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
-                                                hipblasOperation_t   transA,
-                                                hipblasOperation_t   transB,
-                                                int                  m,
-                                                int                  n,
-                                                int                  k,
-                                                const void*          alpha,
-                                                const void*          A,
-                                                hipDataType          aType,
-                                                int                  lda,
-                                                const void*          B,
-                                                hipDataType          bType,
-                                                int                  ldb,
-                                                const void*          beta,
-                                                void*                C,
-                                                hipDataType          cType,
-                                                int                  ldc,
-                                                hipblasComputeType_t computeType,
-                                                hipblasGemmAlgo_t    algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
+                                                              hipblasOperation_t   transA,
+                                                              hipblasOperation_t   transB,
+                                                              int                  m,
+                                                              int                  n,
+                                                              int                  k,
+                                                              const void*          alpha,
+                                                              const void*          A,
+                                                              hipDataType          aType,
+                                                              int                  lda,
+                                                              hipblasStride        strideA,
+                                                              const void*          B,
+                                                              hipDataType          bType,
+                                                              int                  ldb,
+                                                              hipblasStride        strideB,
+                                                              const void*          beta,
+                                                              void*                C,
+                                                              hipDataType          cType,
+                                                              int                  ldc,
+                                                              hipblasStride        strideC,
+                                                              int                  batchCount,
+                                                              hipblasComputeType_t computeType,
+                                                              hipblasGemmAlgo_t    algo);
 
 /*! \brief BLAS EX API
+
     \details
-    gemmBatchedEx performs one of the batched matrix-matrix operations
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
-    where op( X ) is one of
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
-    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
-    op( A ) an m by k by batchCount batched matrix,
-    op( B ) a k by n by batchCount batched matrix and
-    C a m by n by batchCount batched matrix.
-    The batched matrices are an array of pointers to matrices.
-    The number of pointers to matrices is batchCount.
+    gemmExScaled performs the matrix-matrix operation
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+        C = alpha*( scaleA*op( A ) )*( scaleB*op( B ) ) + beta*C,
 
-    With HIPBLAS_V2 define, hipblasGemmBatchedEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmBatchedEx will no
-    longer support hipblasDataType_t for these parameters in a future release.
+    where op( X ) is as for gemmEx and scaleA and scaleB are per-tensor scales, such as those of
+    weights and activations quantized to FP8. gemmBatchedExScaled and gemmStridedBatchedExScaled
+    are the batched forms, with the same scales for every problem.
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+    A and B are FP8, both in the FNUZ formats, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ, or both in
+    the OCP formats, HIP_R_8F_E4M3 or HIP_R_8F_E5M2 (from HIP 6.3), with cType HIP_R_16BF or
+    HIP_R_32F and computeType HIPBLAS_COMPUTE_32F; alpha and beta are float. The product is
+    computed natively, with FP32 accumulation, or HIPBLAS_STATUS_NOT_SUPPORTED is returned:
+    - The rocBLAS backend computes the FNUZ formats through rocblas_gemm_ex3 of rocBLAS 3.1 or
+      later, on devices with FP8 support. The scales are folded into alpha on the device, so the
+      call does not synchronize and can be captured into a hipGraph once the handle has made a
+      scaled call.
+    - The cuBLAS backend computes the OCP formats through cublasLtMatmul of cuBLAS 11.11 or later,
+      with the scales as its A and B scale pointers, for the combinations and transposes cublasLt
+      has an algorithm for on the device; on most devices A is transposed and B is not, and A
+      and B are not both HIP_R_8F_E5M2. gemmBatchedExScaled copies the arrays of pointers to the
+      host and computes the problems one by one, so it synchronizes and cannot be captured.
 
-            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t      handle,
-                                                 hipblasOperation_t   transA,
-                                                 hipblasOperation_t   transB,
-                                                 int                  m,
-                                                 int                  n,
-                                                 int                  k,
-                                                 const void*          alpha,
-                                                 const void*          A[],
-                                                 hipDataType          aType,
-                                                 int                  lda,
-                                                 const void*          B[],
-                                                 hipDataType          bType,
-                                                 int                  ldb,
-                                                 const void*          beta,
-                                                 void*                C[],
-                                                 hipDataType          cType,
-                                                 int                  ldc,
-                                                 int                  batchCount,
-                                                 hipblasComputeType_t computeType,
-                                                 hipblasGemmAlgo_t    algo)
+    gemmEx, gemmBatchedEx and gemmStridedBatchedEx with hipDataType accept the same FP8 types, and
+    are the scaled functions with no scales. If neither A nor B is FP8 and both scales are NULL,
+    the scaled functions are the corresponding gemmEx.
 
-        #else // [DEPRECATED]
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in, out]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+    @param[in]
+    scaleA    [const float *]
+              device pointer to the scale of A, or NULL for 1.
+    @param[in]
+    scaleB    [const float *]
+              device pointer to the scale of B, or NULL for 1.
 
-            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                                 hipblasOperation_t transA,
-                                                 hipblasOperation_t transB,
-                                                 int                m,
-                                                 int                n,
-                                                 int                k,
-                                                 const void*        alpha,
-                                                 const void*        A[],
-                                                 hipblasDatatype_t  aType,
-                                                 int                lda,
-                                                 const void*        B[],
-                                                 hipblasDatatype_t  bType,
-                                                 int                ldb,
-                                                 const void*        beta,
-                                                 void*              C[],
-                                                 hipblasDatatype_t  cType,
-                                                 int                ldc,
-                                                 int                batchCount,
-                                                 hipblasDatatype_t  computeType,
-                                                 hipblasGemmAlgo_t  algo)
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExScaled(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transA,
+                                                   hipblasOperation_t   transB,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          aType,
+                                                   int                  lda,
+                                                   const void*          B,
+                                                   hipDataType          bType,
+                                                   int                  ldb,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          cType,
+                                                   int                  ldc,
+                                                   hipblasComputeType_t computeType,
+                                                   hipblasGemmAlgo_t    algo,
+                                                   const float*         scaleA,
+                                                   const float*         scaleB);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExScaled(hipblasHandle_t      handle,
+                                                          hipblasOperation_t   transA,
+                                                          hipblasOperation_t   transB,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          const void*          alpha,
+                                                          const void*          A[],
+                                                          hipDataType          aType,
+                                                          int                  lda,
+                                                          const void*          B[],
+                                                          hipDataType          bType,
+                                                          int                  ldb,
+                                                          const void*          beta,
+                                                          void*                C[],
+                                                          hipDataType          cType,
+                                                          int                  ldc,
+                                                          int                  batchCount,
+                                                          hipblasComputeType_t computeType,
+                                                          hipblasGemmAlgo_t    algo,
+                                                          const float*         scaleA,
+                                                          const float*         scaleB);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExScaled(hipblasHandle_t      handle,
+                                                                 hipblasOperation_t   transA,
+                                                                 hipblasOperation_t   transB,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 const void*          alpha,
+                                                                 const void*          A,
+                                                                 hipDataType          aType,
+                                                                 int                  lda,
+                                                                 hipblasStride        strideA,
+                                                                 const void*          B,
+                                                                 hipDataType          bType,
+                                                                 int                  ldb,
+                                                                 hipblasStride        strideB,
+                                                                 const void*          beta,
+                                                                 void*                C,
+                                                                 hipDataType          cType,
+                                                                 int                  ldc,
+                                                                 hipblasStride        strideC,
+                                                                 int                  batchCount,
+                                                                 hipblasComputeType_t computeType,
+                                                                 hipblasGemmAlgo_t    algo,
+                                                                 const float*         scaleA,
+                                                                 const float*         scaleB);
+
+/*! \brief BLAS EX API
 
-        #endif
+    \details
+    gemmExOutOfPlace performs the matrix-matrix operation
+
+        D = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is as for gemmEx, and C is left unchanged. gemmBatchedExOutOfPlace and
+    gemmStridedBatchedExOutOfPlace are the batched forms, with D_i for each C_i. This saves copying
+    C to D before an in-place gemmEx, e.g. to keep a residual.
+
+    - Supported types are those of gemmEx with hipDataType; dType must be cType.
+
+    The rocBLAS backend computes D directly. The cuBLAS backend computes D directly with
+    cublasLtMatmul for gemmExOutOfPlace, as in HIPBLAS_GEMM_EX_MODE_LT; otherwise, and for the
+    batched forms and FP8 types, C is copied to D on the handle's stream and the product is
+    computed in place on D. The copy of gemmBatchedExOutOfPlace reads the arrays of pointers on the
+    host, so it synchronizes with the handle's stream and cannot be captured into a hipGraph. D may
+    be C, with ldd equal to ldc, for an in-place gemmEx.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -17850,312 +27794,661 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
               device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
     @param[in]
     A         [void *]
-              device pointer storing array of pointers to each matrix A_i.
+              device pointer storing matrix A.
     @param[in]
-    aType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix A_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix A_i.
+    aType     [hipDataType]
+              specifies the datatype of matrix A.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i.
+              specifies the leading dimension of A.
     @param[in]
     B         [void *]
-              device pointer storing array of pointers to each matrix B_i.
+              device pointer storing matrix B.
     @param[in]
-    bType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix B_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix B_i.
+    bType     [hipDataType]
+              specifies the datatype of matrix B.
     @param[in]
     ldb       [int]
-              specifies the leading dimension of each B_i.
+              specifies the leading dimension of B.
     @param[in]
     beta      [const void *]
               device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
     @param[in]
-    C         [void *]
-              device array of device pointers to each matrix C_i.
+    C         [const void *]
+              device pointer storing matrix C.
     @param[in]
-    cType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix C_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix C_i.
+    cType     [hipDataType]
+              specifies the datatype of matrix C.
     @param[in]
     ldc       [int]
-              specifies the leading dimension of each C_i.
+              specifies the leading dimension of C.
+    @param[out]
+    D         [void *]
+              device pointer storing matrix D.
     @param[in]
-    batchCount
-              [int]
-              number of gemm operations in the batch.
+    dType     [hipDataType]
+              specifies the datatype of matrix D.
     @param[in]
-    computeType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of computation.\n
-    [hipblasComputeType_t]
+    ldd       [int]
+              specifies the leading dimension of D.
+    @param[in]
+    computeType [hipblasComputeType_t]
               specifies the datatype of computation.
     @param[in]
     algo      [hipblasGemmAlgo_t]
               enumerant specifying the algorithm type.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                                    hipblasOperation_t transA,
-                                                    hipblasOperation_t transB,
-                                                    int                m,
-                                                    int                n,
-                                                    int                k,
-                                                    const void*        alpha,
-                                                    const void*        A[],
-                                                    hipblasDatatype_t  aType,
-                                                    int                lda,
-                                                    const void*        B[],
-                                                    hipblasDatatype_t  bType,
-                                                    int                ldb,
-                                                    const void*        beta,
-                                                    void*              C[],
-                                                    hipblasDatatype_t  cType,
-                                                    int                ldc,
-                                                    int                batchCount,
-                                                    hipblasDatatype_t  computeType,
-                                                    hipblasGemmAlgo_t  algo);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExOutOfPlace(hipblasHandle_t      handle,
                                                        hipblasOperation_t   transA,
                                                        hipblasOperation_t   transB,
                                                        int                  m,
                                                        int                  n,
                                                        int                  k,
                                                        const void*          alpha,
-                                                       const void*          A[],
+                                                       const void*          A,
                                                        hipDataType          aType,
                                                        int                  lda,
-                                                       const void*          B[],
+                                                       const void*          B,
                                                        hipDataType          bType,
                                                        int                  ldb,
                                                        const void*          beta,
-                                                       void*                C[],
+                                                       const void*          C,
                                                        hipDataType          cType,
                                                        int                  ldc,
-                                                       int                  batchCount,
+                                                       void*                D,
+                                                       hipDataType          dType,
+                                                       int                  ldd,
                                                        hipblasComputeType_t computeType,
                                                        hipblasGemmAlgo_t    algo);
 
-/*! \brief BLAS EX API
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                                              hipblasOperation_t   transA,
+                                                              hipblasOperation_t   transB,
+                                                              int                  m,
+                                                              int                  n,
+                                                              int                  k,
+                                                              const void*          alpha,
+                                                              const void*          A[],
+                                                              hipDataType          aType,
+                                                              int                  lda,
+                                                              const void*          B[],
+                                                              hipDataType          bType,
+                                                              int                  ldb,
+                                                              const void*          beta,
+                                                              const void*          C[],
+                                                              hipDataType          cType,
+                                                              int                  ldc,
+                                                              void*                D[],
+                                                              hipDataType          dType,
+                                                              int                  ldd,
+                                                              int                  batchCount,
+                                                              hipblasComputeType_t computeType,
+                                                              hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transA,
+                                          hipblasOperation_t   transB,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          hipblasStride        strideA,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          hipblasStride        strideB,
+                                          const void*          beta,
+                                          const void*          C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasStride        strideC,
+                                          void*                D,
+                                          hipDataType          dType,
+                                          int                  ldd,
+                                          hipblasStride        strideD,
+                                          int                  batchCount,
+                                          hipblasComputeType_t computeType,
+                                          hipblasGemmAlgo_t    algo);
+
+/*! @{
+    \brief BLAS Extension API
 
     \details
-    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+    tpttrBatched and tpttrStridedBatched unpack each n by n triangular matrix AP_i in packed
+    storage into the full-storage matrix A_i:
 
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+        A_i := AP_i, 0 \le i < batchCount
 
-    where op( X ) is one of
+    Only the uplo triangle of A_i is written; the other triangle is left unchanged. The cuBLAS
+    backend converts each matrix with one call of cublasXtpttr when there are no more matrices
+    than columns. Otherwise, and on the rocBLAS backend, column j of AP_i is copied to column j of
+    A_i with one device-to-device copy for all matrices of a strided batch. The batched form
+    copies the arrays of pointers to the host.
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
-    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
-    op( A ) an m by k by batchCount strided_batched matrix,
-    op( B ) a k by n by batchCount strided_batched matrix and
-    C a m by n by batchCount strided_batched matrix.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  AP_i holds the upper triangle of A_i.
+              HIPBLAS_FILL_MODE_LOWER:  AP_i holds the lower triangle of A_i.
+    @param[in]
+    n         [int]
+              the number of rows and columns of A_i. n >= 0.
+    @param[in]
+    AP        device array of device pointers, or device pointer to the first matrix, storing
+              each AP_i in packed storage, of dimension at least ( n * ( n + 1 ) / 2 ).
+    @param[in]
+    strideAP  [hipblasStride]
+              stride from the start of one AP_i to the next AP_{i + 1}.
+    @param[out]
+    A         device array of device pointers, or device pointer to the first matrix, storing
+              each A_i.
+    @param[in]
+    lda       [int]
+              leading dimension of each A_i. lda >= max( 1, n ).
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_{i + 1}.
+    @param[in]
+    batchCount [int]
+              number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    int                n,
+                                                    const float* const AP[],
+                                                    float* const       A[],
+                                                    int                lda,
+                                                    int                batchCount);
 
-    The strided_batched matrices are multiple matrices separated by a constant stride.
-    The number of matrices is batchCount.
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    int                 n,
+                                                    const double* const AP[],
+                                                    double* const       A[],
+                                                    int                 lda,
+                                                    int                 batchCount);
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount);
 
-    With HIPBLAS_V2 define, hipblasGemmStridedBatchedEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmStridedBatchedEx will no
-    longer support hipblasDataType_t for these parameters in a future release.
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const AP[],
+                                                    hipblasDoubleComplex* const       A[],
+                                                    int                               lda,
+                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const float*      AP,
+                                                           hipblasStride     strideAP,
+                                                           float*            A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const double*     AP,
+                                                           hipblasStride     strideAP,
+                                                           double*           A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* AP,
+                                                           hipblasStride         strideAP,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* AP,
+                                                           hipblasStride               strideAP,
+                                                           hipblasDoubleComplex*       A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Extension API
+
+    \details
+    trttpBatched and trttpStridedBatched pack the uplo triangle of each n by n full-storage matrix
+    A_i into AP_i in packed storage, the inverse of tpttrBatched and tpttrStridedBatched:
+
+        AP_i := A_i, 0 \le i < batchCount
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle of A_i is packed.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle of A_i is packed.
+    @param[in]
+    n         [int]
+              the number of rows and columns of A_i. n >= 0.
+    @param[in]
+    A         device array of device pointers, or device pointer to the first matrix, storing
+              each A_i.
+    @param[in]
+    lda       [int]
+              leading dimension of each A_i. lda >= max( 1, n ).
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_{i + 1}.
+    @param[out]
+    AP        device array of device pointers, or device pointer to the first matrix, storing
+              each AP_i in packed storage, of dimension at least ( n * ( n + 1 ) / 2 ).
+    @param[in]
+    strideAP  [hipblasStride]
+              stride from the start of one AP_i to the next AP_{i + 1}.
+    @param[in]
+    batchCount [int]
+              number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    int                n,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       AP[],
+                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    int                 n,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       AP[],
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AP[],
+                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       AP[],
+                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const float*      A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           float*            AP,
+                                                           hipblasStride     strideAP,
+                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const double*     A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           double*           AP,
+                                                           hipblasStride     strideAP,
+                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AP,
+                                                           hipblasStride         strideAP,
+                                                           int                   batchCount);
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           hipblasDoubleComplex*       AP,
+                                                           hipblasStride               strideAP,
+                                                           int                         batchCount);
+//! @}
 
-            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t      handle,
-                                                        hipblasOperation_t   transA,
-                                                        hipblasOperation_t   transB,
-                                                        int                  m,
-                                                        int                  n,
-                                                        int                  k,
-                                                        const void*          alpha,
-                                                        const void*          A,
-                                                        hipDataType          aType,
-                                                        int                  lda,
-                                                        hipblasStride        strideA,
-                                                        const void*          B,
-                                                        hipDataType          bType,
-                                                        int                  ldb,
-                                                        hipblasStride        strideB,
-                                                        const void*          beta,
-                                                        void*                C,
-                                                        hipDataType          cType,
-                                                        int                  ldc,
-                                                        hipblasStride        strideC,
-                                                        int                  batchCount,
-                                                        hipblasComputeType_t computeType,
-                                                        hipblasGemmAlgo_t    algo)
+/*! @{
+    \brief BLAS Extension API
 
-        #else // [DEPRECATED]
+    \details
+    gb2geBatched and gb2geStridedBatched unpack each m by n band matrix AB_i, with kl
+    subdiagonals and ku superdiagonals in band storage, into the full-storage matrix A_i:
 
-            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                                        hipblasOperation_t transA,
-                                                        hipblasOperation_t transB,
-                                                        int                m,
-                                                        int                n,
-                                                        int                k,
-                                                        const void*        alpha,
-                                                        const void*        A,
-                                                        hipblasDatatype_t  aType,
-                                                        int                lda,
-                                                        hipblasStride      strideA,
-                                                        const void*        B,
-                                                        hipblasDatatype_t  bType,
-                                                        int                ldb,
-                                                        hipblasStride      strideB,
-                                                        const void*        beta,
-                                                        void*              C,
-                                                        hipblasDatatype_t  cType,
-                                                        int                ldc,
-                                                        hipblasStride      strideC,
-                                                        int                batchCount,
-                                                        hipblasDatatype_t  computeType,
-                                                        hipblasGemmAlgo_t  algo)
+        A_i := AB_i, 0 \le i < batchCount
 
-        #endif
+    The elements of A_i outside the band are set to zero. The columns of A_i which hold a full
+    band are copied with a single pitched device-to-device copy, and the remaining columns one
+    at a time. A triangular band matrix with k diagonals off the main one is the band matrix
+    with kl = 0 and ku = k if it is upper triangular, and kl = k and ku = 0 if it is lower
+    triangular. The batched form copies the arrays of pointers to the host.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    transA    [hipblasOperation_t]
-              specifies the form of op( A ).
-    @param[in]
-    transB    [hipblasOperation_t]
-              specifies the form of op( B ).
-    @param[in]
     m         [int]
-              matrix dimension m.
+              the number of rows of A_i. m >= 0.
     @param[in]
     n         [int]
-              matrix dimension n.
+              the number of columns of A_i. n >= 0.
     @param[in]
-    k         [int]
-              matrix dimension k.
+    kl        [int]
+              the number of subdiagonals of A_i. kl >= 0.
     @param[in]
-    alpha     [const void *]
-              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    ku        [int]
+              the number of superdiagonals of A_i. ku >= 0.
     @param[in]
-    A         [void *]
-              device pointer pointing to first matrix A_1.
+    AB        device array of device pointers, or device pointer to the first matrix, storing
+              each AB_i in band storage: A_i(i, j) is AB_i(ku + i - j, j).
     @param[in]
-    aType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix A_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix A_i.
+    ldab      [int]
+              leading dimension of each AB_i. ldab >= kl + ku + 1.
+    @param[in]
+    strideAB  [hipblasStride]
+              stride from the start of one AB_i to the next AB_{i + 1}.
+    @param[out]
+    A         device array of device pointers, or device pointer to the first matrix, storing
+              each A_i.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i.
+              leading dimension of each A_i. lda >= max( 1, m ).
     @param[in]
-    strideA  [hipblasStride]
-              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_{i + 1}.
     @param[in]
-    B         [void *]
-              device pointer pointing to first matrix B_1.
+    batchCount [int]
+              number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgb2geBatched(hipblasHandle_t    handle,
+                                                    int                m,
+                                                    int                n,
+                                                    int                kl,
+                                                    int                ku,
+                                                    const float* const AB[],
+                                                    int                ldab,
+                                                    float* const       A[],
+                                                    int                lda,
+                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgb2geBatched(hipblasHandle_t     handle,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 kl,
+                                                    int                 ku,
+                                                    const double* const AB[],
+                                                    int                 ldab,
+                                                    double* const       A[],
+                                                    int                 lda,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgb2geBatched(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const AB[],
+                                                    int                         ldab,
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgb2geBatched(hipblasHandle_t                   handle,
+                                                    int                               m,
+                                                    int                               n,
+                                                    int                               kl,
+                                                    int                               ku,
+                                                    const hipblasDoubleComplex* const AB[],
+                                                    int                               ldab,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    int                               lda,
+                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgb2geStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const float*    AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           float*          A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgb2geStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const double*   AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           double*         A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgb2geStridedBatched(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgb2geStridedBatched(hipblasHandle_t             handle,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         kl,
+                                                           int                         ku,
+                                                           const hipblasDoubleComplex* AB,
+                                                           int                         ldab,
+                                                           hipblasStride               strideAB,
+                                                           hipblasDoubleComplex*       A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Extension API
+
+    \details
+    ge2gbBatched and ge2gbStridedBatched copy the band of kl subdiagonals and ku superdiagonals
+    of each m by n full-storage matrix A_i into AB_i in band storage, the inverse of
+    gb2geBatched and gb2geStridedBatched:
+
+        AB_i := A_i, 0 \le i < batchCount
+
+    The elements of AB_i which hold no element of A_i are left unchanged.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
     @param[in]
-    bType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix B_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix B_i.
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    ldb       [int]
-              specifies the leading dimension of each B_i.
+    m         [int]
+              the number of rows of A_i. m >= 0.
     @param[in]
-    strideB  [hipblasStride]
-              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    n         [int]
+              the number of columns of A_i. n >= 0.
     @param[in]
-    beta      [const void *]
-              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    kl        [int]
+              the number of subdiagonals of A_i. kl >= 0.
     @param[in]
-    C         [void *]
-              device pointer pointing to first matrix C_1.
+    ku        [int]
+              the number of superdiagonals of A_i. ku >= 0.
     @param[in]
-    cType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix C_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix C_i.
+    A         device array of device pointers, or device pointer to the first matrix, storing
+              each A_i.
     @param[in]
-    ldc       [int]
-              specifies the leading dimension of each C_i.
+    lda       [int]
+              leading dimension of each A_i. lda >= max( 1, m ).
     @param[in]
-    strideC  [hipblasStride]
-              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_{i + 1}.
+    @param[out]
+    AB        device array of device pointers, or device pointer to the first matrix, storing
+              each AB_i in band storage: A_i(i, j) is AB_i(ku + i - j, j).
     @param[in]
-    batchCount
-              [int]
-              number of gemm operations in the batch.
+    ldab      [int]
+              leading dimension of each AB_i. ldab >= kl + ku + 1.
     @param[in]
-    computeType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of computation.\n
-    [hipblasComputeType_t]
-              specifies the datatype of computation.
+    strideAB  [hipblasStride]
+              stride from the start of one AB_i to the next AB_{i + 1}.
     @param[in]
-    algo      [hipblasGemmAlgo_t]
-              enumerant specifying the algorithm type.
-
+    batchCount [int]
+              number of matrices in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                                           hipblasOperation_t transA,
-                                                           hipblasOperation_t transB,
-                                                           int                m,
-                                                           int                n,
-                                                           int                k,
-                                                           const void*        alpha,
-                                                           const void*        A,
-                                                           hipblasDatatype_t  aType,
-                                                           int                lda,
-                                                           hipblasStride      strideA,
-                                                           const void*        B,
-                                                           hipblasDatatype_t  bType,
-                                                           int                ldb,
-                                                           hipblasStride      strideB,
-                                                           const void*        beta,
-                                                           void*              C,
-                                                           hipblasDatatype_t  cType,
-                                                           int                ldc,
-                                                           hipblasStride      strideC,
-                                                           int                batchCount,
-                                                           hipblasDatatype_t  computeType,
-                                                           hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSge2gbBatched(hipblasHandle_t    handle,
+                                                    int                m,
+                                                    int                n,
+                                                    int                kl,
+                                                    int                ku,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       AB[],
+                                                    int                ldab,
+                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
-                                                              hipblasOperation_t   transA,
-                                                              hipblasOperation_t   transB,
-                                                              int                  m,
-                                                              int                  n,
-                                                              int                  k,
-                                                              const void*          alpha,
-                                                              const void*          A,
-                                                              hipDataType          aType,
-                                                              int                  lda,
-                                                              hipblasStride        strideA,
-                                                              const void*          B,
-                                                              hipDataType          bType,
-                                                              int                  ldb,
-                                                              hipblasStride        strideB,
-                                                              const void*          beta,
-                                                              void*                C,
-                                                              hipDataType          cType,
-                                                              int                  ldc,
-                                                              hipblasStride        strideC,
-                                                              int                  batchCount,
-                                                              hipblasComputeType_t computeType,
-                                                              hipblasGemmAlgo_t    algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDge2gbBatched(hipblasHandle_t     handle,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 kl,
+                                                    int                 ku,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       AB[],
+                                                    int                 ldab,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCge2gbBatched(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AB[],
+                                                    int                         ldab,
+                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZge2gbBatched(hipblasHandle_t                   handle,
+                                                    int                               m,
+                                                    int                               n,
+                                                    int                               kl,
+                                                    int                               ku,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       AB[],
+                                                    int                               ldab,
+                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSge2gbStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const float*    A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           float*          AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDge2gbStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const double*   A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           double*         AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCge2gbStridedBatched(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZge2gbStridedBatched(hipblasHandle_t             handle,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         kl,
+                                                           int                         ku,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           hipblasDoubleComplex*       AB,
+                                                           int                         ldab,
+                                                           hipblasStride               strideAB,
+                                                           int                         batchCount);
+//! @}
 
 /*! BLAS EX API
 
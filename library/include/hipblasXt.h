@@ -0,0 +1,428 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//! This is the include file for the hipblasXt multi-GPU API. Matrices passed to hipblasXt
+//! functions live in host memory; they are tiled and streamed to the selected devices, so
+//! their size is not limited by the memory of a single device.
+
+#ifndef HIPBLASXT_H
+#define HIPBLASXT_H
+
+#include "hipblas.h"
+
+/*! \brief hipblasXtHandle_t is a pointer to the hipblasXt library context */
+typedef struct hipblasXtContext* hipblasXtHandle_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \brief Create hipblasXt handle. */
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle);
+
+/*! \brief Destroys the hipblasXt handle and the device resources it owns. */
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle);
+
+/*! \brief Select the devices used by handle
+    \details
+    Tiles of the output matrix are distributed round-robin over the selected devices. The
+    default is device 0 only.
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt library context.
+    @param[in]
+    nbDevices [int]
+              number of devices in deviceId.
+    @param[in]
+    deviceId  [int*]
+              host array of nbDevices distinct device ids.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle,
+                                                     int               nbDevices,
+                                                     int               deviceId[]);
+
+/*! \brief Set the tile size used by handle
+    \details
+    Output matrices are split into blockDim by blockDim tiles, and the inner dimension is
+    streamed in panels of blockDim. Each device keeps two tiles in flight, so that the
+    transfers for one tile overlap the computation of the other. The default is 1024.
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt library context.
+    @param[in]
+    blockDim  [int]
+              tile size, greater than 0.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim);
+
+/*! \brief Get the tile size used by handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim);
+
+/*! @{
+    \brief hipblasXt Level 3 API
+
+    \details
+    hipblasXtgemm performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are matrices in host memory, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+    Transfers only overlap computation if the matrices are in pinned host memory.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt library context.
+    @param[in]
+    transa    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transb    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [size_t]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [size_t]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [size_t]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [size_t]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [size_t]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [size_t]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              size_t             m,
+                                              size_t             n,
+                                              size_t             k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              const float*       B,
+                                              size_t             ldb,
+                                              const float*       beta,
+                                              float*             C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              size_t             m,
+                                              size_t             n,
+                                              size_t             k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              const double*      B,
+                                              size_t             ldb,
+                                              const double*      beta,
+                                              double*            C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              size_t                m,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* B,
+                                              size_t                ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              size_t                      m,
+                                              size_t                      n,
+                                              size_t                      k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              size_t                      lda,
+                                              const hipblasDoubleComplex* B,
+                                              size_t                      ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              size_t                      ldc);
+//! @}
+
+/*! @{
+    \brief hipblasXt Level 3 API
+
+    \details
+    hipblasXtsyrk performs one of the matrix-matrix operations for a symmetric rank-k update
+
+    C := alpha*op( A )*op( A )^T + beta*C
+
+    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    C is a symmetric n x n matrix stored as either upper or lower, all in host memory.
+
+        op( A ) = A, and A is n by k if trans == HIPBLAS_OP_N
+        op( A ) = A^T and A is k by n if trans == HIPBLAS_OP_T
+
+    Diagonal tiles of C are updated with syrk and off-diagonal tiles with gemm.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt library context.
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  C is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  C is a  lower triangular matrix
+    @param[in]
+    trans  [hipblasOperation_t]
+            HIPBLAS_OP_T: op(A) = A^T
+            HIPBLAS_OP_N: op(A) = A
+            HIPBLAS_OP_C: op(A) = A^T
+            HIPBLAS_OP_C is not supported for complex types, see cherk
+            and zherk.
+    @param[in]
+    n       [size_t]
+            n specifies the number of rows and columns of C.
+    @param[in]
+    k       [size_t]
+            k specifies the number of columns of op(A).
+    @param[in]
+    alpha   host pointer specifying the scalar alpha.
+    @param[in]
+    A       host pointer storing matrix A.
+    @param[in]
+    lda     [size_t]
+            lda specifies the first dimension of A.
+    @param[in]
+    beta    host pointer specifying the scalar beta.
+    @param[in, out]
+    C       host pointer storing matrix C.
+    @param[in]
+    ldc    [size_t]
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              size_t             n,
+                                              size_t             k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              const float*       beta,
+                                              float*             C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              size_t             n,
+                                              size_t             k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              const double*      beta,
+                                              double*            C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    trans,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          trans,
+                                              size_t                      n,
+                                              size_t                      k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              size_t                      lda,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              size_t                      ldc);
+//! @}
+
+/*! @{
+    \brief hipblasXt Level 3 API
+
+    \details
+    hipblasXttrsm solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    where alpha is a scalar, X and B are m by n matrices,
+    A is triangular matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    The matrix X is overwritten on B; all matrices are in host memory.
+    B is split into independent panels of blockDim columns (side == HIPBLAS_SIDE_LEFT) or
+    rows (side == HIPBLAS_SIDE_RIGHT) which are distributed over the devices; each panel is
+    solved by blocked substitution while the tiles of A are streamed to its device.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle  [hipblasXtHandle_t]
+            handle to the hipblasXt library context.
+    @param[in]
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+    @param[in]
+    trans   [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+    @param[in]
+    m       [size_t]
+            m specifies the number of rows of B. m >= 0.
+    @param[in]
+    n       [size_t]
+            n specifies the number of columns of B. n >= 0.
+    @param[in]
+    alpha   host pointer specifying the scalar alpha.
+    @param[in]
+    A       host pointer storing matrix A, m by m if side == HIPBLAS_SIDE_LEFT and
+            n by n otherwise.
+    @param[in]
+    lda     [size_t]
+            lda specifies the first dimension of A.
+    @param[in,out]
+    B       host pointer storing matrix B.
+    @param[in]
+    ldb    [size_t]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              size_t             m,
+                                              size_t             n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              float*             B,
+                                              size_t             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              size_t             m,
+                                              size_t             n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              double*            B,
+                                              size_t             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    trans,
+                                              hipblasDiagType_t     diag,
+                                              size_t                m,
+                                              size_t                n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              hipblasComplex*       B,
+                                              size_t                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          trans,
+                                              hipblasDiagType_t           diag,
+                                              size_t                      m,
+                                              size_t                      n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              size_t                      lda,
+                                              hipblasDoubleComplex*       B,
+                                              size_t                      ldb);
+//! @}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,895 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "xt_tiles.hpp"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <climits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct hipblasXtContext
+{
+    std::mutex         mutex;
+    std::vector<int>   devices{0};
+    int                block_dim = 1024;
+    hipblasXtBackend_t backend   = HIPBLASXT_BACKEND_DEVICE;
+
+    // Created on first use, one per entry of devices
+    std::vector<std::unique_ptr<hipblasXtDevice>> workers;
+};
+
+namespace
+{
+    // Leading dimensions are passed on to hipblasSetMatrixAsync as int
+    bool xt_fits_int(size_t n)
+    {
+        return n <= size_t(INT_MAX);
+    }
+
+    bool xt_valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    bool xt_valid_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    /*! \brief Runs tile(device, slot, buffer, t) for every t in [0, tiles). Tiles are dealt
+        round-robin to the devices, each driven by its own host thread, and alternate between
+        the slots of a device so that consecutive tiles overlap. Each slot gets a buffer of
+        slot_bytes on its device. */
+    template <typename F>
+    hipblasStatus_t xt_run(hipblasXtContext* xt, size_t tiles, size_t slot_bytes, F tile)
+    {
+        if(xt->workers.empty())
+            for(int device : xt->devices)
+                xt->workers.push_back(xt->backend == HIPBLASXT_BACKEND_STUB
+                                          ? hipblasXtCreateStubDevice(device)
+                                          : hipblasXtCreateGpuDevice(device));
+
+        size_t                       num_devices = std::min(xt->workers.size(), tiles);
+        std::vector<hipblasStatus_t> status(num_devices, HIPBLAS_STATUS_SUCCESS);
+
+        auto worker = [&](size_t d) {
+            try
+            {
+                hipblasXtDevice& device    = *xt->workers[d];
+                hipblasStatus_t  status_d  = device.activate();
+                void*            buffers[hipblasXtSlots] = {};
+
+                for(int slot = 0; slot < hipblasXtSlots && status_d == HIPBLAS_STATUS_SUCCESS;
+                    slot++)
+                    status_d = device.reserve(slot, slot_bytes, &buffers[slot]);
+
+                for(size_t t = d, i = 0; t < tiles && status_d == HIPBLAS_STATUS_SUCCESS;
+                    t += num_devices, i++)
+                {
+                    int slot = int(i % hipblasXtSlots);
+                    status_d = tile(device, slot, buffers[slot], t);
+                }
+
+                hipblasStatus_t sync_status = device.synchronize();
+                status[d] = status_d != HIPBLAS_STATUS_SUCCESS ? status_d : sync_status;
+            }
+            catch(...)
+            {
+                status[d] = exception_to_hipblas_status();
+            }
+        };
+
+        // Every device gets its own thread, so the current device of the caller is untouched
+        std::vector<std::thread> threads;
+        for(size_t d = 0; d < num_devices; d++)
+            threads.emplace_back(worker, d);
+        for(auto& thread : threads)
+            thread.join();
+
+        for(hipblasStatus_t s : status)
+            if(s != HIPBLAS_STATUS_SUCCESS)
+                return s;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    /*! \brief Diagonal tile i0 of size nb of C = alpha*op(A)*op(A)^T + beta*C. buffer holds
+        2 block_dim^2 elements. */
+    template <typename T>
+    hipblasStatus_t xt_syrk_tile(hipblasXtDevice&   device,
+                                 int                slot,
+                                 T*                 buffer,
+                                 int                block_dim,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 size_t             i0,
+                                 int                nb,
+                                 size_t             k,
+                                 const T*           alpha,
+                                 const T*           A,
+                                 size_t             lda,
+                                 const T*           beta,
+                                 T*                 C,
+                                 size_t             ldc)
+    {
+        constexpr hipDataType type = hipblasXtType<T>::type;
+
+        const T one = hipblasXtConstant<T>(1);
+        T*      dA  = buffer;
+        T*      dC  = dA + size_t(block_dim) * block_dim;
+
+        // The whole tile is copied back, so the triangle syrk does not touch must be uploaded
+        XT_RETURN_IF_ERROR(xt_upload(device, slot, nb, nb, C + i0 + i0 * ldc, ldc, dC));
+
+        if(hipblasXtIsZero(*alpha))
+            k = 0;
+
+        size_t k0 = 0;
+        do
+        {
+            int kb = k ? xt_block_size(k, block_dim, k0 / block_dim) : 0;
+
+            const T* hA = trans == HIPBLAS_OP_N ? A + i0 + k0 * lda : A + k0 + i0 * lda;
+            int      ar = trans == HIPBLAS_OP_N ? nb : kb;
+            int      ac = trans == HIPBLAS_OP_N ? kb : nb;
+
+            XT_RETURN_IF_ERROR(xt_upload(device, slot, ar, ac, hA, lda, dA));
+            XT_RETURN_IF_ERROR(device.syrk(slot,
+                                           type,
+                                           uplo,
+                                           trans,
+                                           nb,
+                                           kb,
+                                           alpha,
+                                           dA,
+                                           std::max(1, ar),
+                                           k0 ? &one : beta,
+                                           dC,
+                                           nb));
+            k0 += kb;
+        } while(k0 < k);
+
+        return device.getMatrix(slot, nb, nb, sizeof(T), dC, nb, C + i0 + i0 * ldc, int(ldc));
+    }
+
+    /*! \brief Solves one panel of B by blocked substitution. For side == left the panel is
+        the m x nb block of columns starting at column j0, otherwise the mb x n block of rows
+        starting at row i0. buffer holds block_dim^2 elements followed by the panel. */
+    template <typename T>
+    hipblasStatus_t xt_trsm_panel(hipblasXtDevice&   device,
+                                  int                slot,
+                                  T*                 buffer,
+                                  int                block_dim,
+                                  hipblasSideMode_t  side,
+                                  hipblasFillMode_t  uplo,
+                                  hipblasOperation_t trans,
+                                  hipblasDiagType_t  diag,
+                                  size_t             m,
+                                  size_t             n,
+                                  size_t             panel,
+                                  const T*           alpha,
+                                  const T*           A,
+                                  size_t             lda,
+                                  T*                 B,
+                                  size_t             ldb)
+    {
+        constexpr hipDataType type = hipblasXtType<T>::type;
+
+        const T one       = hipblasXtConstant<T>(1);
+        const T minus_one = hipblasXtConstant<T>(-1);
+        bool    left      = side == HIPBLAS_SIDE_LEFT;
+        bool    lower     = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+
+        // Panel of B and the dimension of A
+        size_t p0    = panel * block_dim;
+        int    pb    = xt_block_size(left ? n : m, block_dim, panel);
+        int    rows  = left ? int(m) : pb;
+        int    cols  = left ? pb : int(n);
+        T*     hB    = left ? B + p0 * ldb : B + p0;
+        size_t dim   = left ? m : n;
+        size_t nblks = xt_blocks(dim, block_dim);
+
+        T* dA = buffer;
+        T* dB = dA + size_t(block_dim) * block_dim;
+
+        XT_RETURN_IF_ERROR(xt_upload(device, slot, rows, cols, hB, ldb, dB));
+
+        // Left: op(A) lower solves top to bottom. Right: op(A) upper solves left to right.
+        bool forward = left == lower;
+        for(size_t s = 0; s < nblks; s++)
+        {
+            size_t   b     = forward ? s : nblks - 1 - s;
+            size_t   b0    = b * block_dim;
+            int      bb    = xt_block_size(dim, block_dim, b);
+            const T* scale = alpha;
+
+            // Subtract the contributions of the blocks of X solved so far
+            for(size_t t = 0; t < s; t++)
+            {
+                size_t l  = forward ? t : nblks - 1 - t;
+                size_t l0 = l * block_dim;
+                int    lb = xt_block_size(dim, block_dim, l);
+
+                // Left uses op(A)(b, l), right uses op(A)(l, b)
+                size_t r0 = left ? b0 : l0, c0 = left ? l0 : b0;
+                int    rb = left ? bb : lb, cb = left ? lb : bb;
+
+                const T* hA = trans == HIPBLAS_OP_N ? A + r0 + c0 * lda : A + c0 + r0 * lda;
+                int      ar = trans == HIPBLAS_OP_N ? rb : cb;
+                int      ac = trans == HIPBLAS_OP_N ? cb : rb;
+                XT_RETURN_IF_ERROR(xt_upload(device, slot, ar, ac, hA, lda, dA));
+
+                if(left)
+                    XT_RETURN_IF_ERROR(device.gemm(slot,
+                                                   type,
+                                                   trans,
+                                                   HIPBLAS_OP_N,
+                                                   bb,
+                                                   cols,
+                                                   lb,
+                                                   &minus_one,
+                                                   dA,
+                                                   ar,
+                                                   dB + l0,
+                                                   rows,
+                                                   scale,
+                                                   dB + b0,
+                                                   rows));
+                else
+                    XT_RETURN_IF_ERROR(device.gemm(slot,
+                                                   type,
+                                                   HIPBLAS_OP_N,
+                                                   trans,
+                                                   rows,
+                                                   bb,
+                                                   lb,
+                                                   &minus_one,
+                                                   dB + l0 * rows,
+                                                   rows,
+                                                   dA,
+                                                   ar,
+                                                   scale,
+                                                   dB + b0 * rows,
+                                                   rows));
+                scale = &one;
+            }
+
+            XT_RETURN_IF_ERROR(xt_upload(device, slot, bb, bb, A + b0 + b0 * lda, lda, dA));
+            XT_RETURN_IF_ERROR(device.trsm(slot,
+                                           type,
+                                           side,
+                                           uplo,
+                                           trans,
+                                           diag,
+                                           left ? bb : rows,
+                                           left ? cols : bb,
+                                           scale,
+                                           dA,
+                                           bb,
+                                           left ? dB + b0 : dB + b0 * rows,
+                                           rows));
+        }
+
+        return device.getMatrix(slot, rows, cols, sizeof(T), dB, rows, hB, int(ldb));
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasXtGemmTemplate(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          size_t             lda,
+                                          const T*           B,
+                                          size_t             ldb,
+                                          const T*           beta,
+                                          T*                 C,
+                                          size_t             ldc)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!xt_valid_operation(transA) || !xt_valid_operation(transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        size_t A_row = transA == HIPBLAS_OP_N ? m : k;
+        size_t B_row = transB == HIPBLAS_OP_N ? k : n;
+        if(lda < std::max<size_t>(1, A_row) || ldb < std::max<size_t>(1, B_row)
+           || ldc < std::max<size_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!xt_fits_int(lda) || !xt_fits_int(ldb) || !xt_fits_int(ldc))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::lock_guard<std::mutex> lock(handle->mutex);
+
+        size_t bd = handle->block_dim;
+        size_t mt = xt_blocks(m, bd);
+        size_t nt = xt_blocks(n, bd);
+
+        return xt_run(handle,
+                      mt * nt,
+                      3 * bd * bd * sizeof(T),
+                      [&](hipblasXtDevice& device, int slot, void* buffer, size_t t) {
+                          size_t ti = t % mt, tj = t / mt;
+                          return xt_gemm_tile(device,
+                                              slot,
+                                              (T*)buffer,
+                                              int(bd),
+                                              transA,
+                                              transB,
+                                              ti * bd,
+                                              tj * bd,
+                                              xt_block_size(m, bd, ti),
+                                              xt_block_size(n, bd, tj),
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              B,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              ldc);
+                      });
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasXtSyrkTemplate(hipblasXtHandle_t  handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t trans,
+                                          size_t             n,
+                                          size_t             k,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          size_t             lda,
+                                          const T*           beta,
+                                          T*                 C,
+                                          size_t             ldc)
+    {
+        constexpr bool is_complex
+            = hipblasXtType<T>::type == HIP_C_32F || hipblasXtType<T>::type == HIP_C_64F;
+
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!xt_valid_fill(uplo) || !xt_valid_operation(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(is_complex && trans == HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // For real types op(A) = A^T for both HIPBLAS_OP_T and HIPBLAS_OP_C
+        if(trans == HIPBLAS_OP_C)
+            trans = HIPBLAS_OP_T;
+
+        size_t A_row = trans == HIPBLAS_OP_N ? n : k;
+        if(lda < std::max<size_t>(1, A_row) || ldc < std::max<size_t>(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!xt_fits_int(lda) || !xt_fits_int(ldc))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (k && !A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::lock_guard<std::mutex> lock(handle->mutex);
+
+        size_t bd = handle->block_dim;
+        size_t nt = xt_blocks(n, bd);
+
+        // Tiles of the stored triangle of C; diagonal tiles use syrk, the others gemm
+        std::vector<std::pair<size_t, size_t>> tiles;
+        for(size_t tj = 0; tj < nt; tj++)
+            for(size_t ti = 0; ti < nt; ti++)
+                if(uplo == HIPBLAS_FILL_MODE_LOWER ? ti >= tj : ti <= tj)
+                    tiles.emplace_back(ti, tj);
+
+        hipblasOperation_t transA = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        hipblasOperation_t transB = trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+        return xt_run(handle,
+                      tiles.size(),
+                      3 * bd * bd * sizeof(T),
+                      [&](hipblasXtDevice& device, int slot, void* buffer, size_t t) {
+                          size_t ti = tiles[t].first, tj = tiles[t].second;
+                          if(ti == tj)
+                              return xt_syrk_tile(device,
+                                                  slot,
+                                                  (T*)buffer,
+                                                  int(bd),
+                                                  uplo,
+                                                  trans,
+                                                  ti * bd,
+                                                  xt_block_size(n, bd, ti),
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  beta,
+                                                  C,
+                                                  ldc);
+                          return xt_gemm_tile(device,
+                                              slot,
+                                              (T*)buffer,
+                                              int(bd),
+                                              transA,
+                                              transB,
+                                              ti * bd,
+                                              tj * bd,
+                                              xt_block_size(n, bd, ti),
+                                              xt_block_size(n, bd, tj),
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              A,
+                                              lda,
+                                              beta,
+                                              C,
+                                              ldc);
+                      });
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasXtTrsmTemplate(hipblasXtHandle_t  handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t trans,
+                                          hipblasDiagType_t  diag,
+                                          size_t             m,
+                                          size_t             n,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          size_t             lda,
+                                          T*                 B,
+                                          size_t             ldb)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT) || !xt_valid_fill(uplo)
+           || !xt_valid_operation(trans)
+           || (diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        bool   left = side == HIPBLAS_SIDE_LEFT;
+        size_t dim  = left ? m : n;
+        if(lda < std::max<size_t>(1, dim) || ldb < std::max<size_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        // One whole panel of B is kept on the device, indexed with int
+        if(!xt_fits_int(lda) || !xt_fits_int(ldb) || !xt_fits_int(m) || !xt_fits_int(n))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::lock_guard<std::mutex> lock(handle->mutex);
+
+        size_t bd     = handle->block_dim;
+        size_t panels = xt_blocks(left ? n : m, bd);
+
+        return xt_run(handle,
+                      panels,
+                      (bd * bd + bd * dim) * sizeof(T),
+                      [&](hipblasXtDevice& device, int slot, void* buffer, size_t t) {
+                          return xt_trsm_panel(device,
+                                               slot,
+                                               (T*)buffer,
+                                               int(bd),
+                                               side,
+                                               uplo,
+                                               trans,
+                                               diag,
+                                               m,
+                                               n,
+                                               t,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb);
+                      });
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    *handle = new hipblasXtContext;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    delete handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle, int nbDevices, int deviceId[])
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(nbDevices <= 0 || !deviceId)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(handle->mutex);
+
+    int device_count = INT_MAX;
+    if(handle->backend == HIPBLASXT_BACKEND_DEVICE
+       && hipGetDeviceCount(&device_count) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    std::vector<int> devices(deviceId, deviceId + nbDevices);
+    for(int i = 0; i < nbDevices; i++)
+        if(devices[i] < 0 || devices[i] >= device_count
+           || std::find(devices.begin(), devices.begin() + i, devices[i]) != devices.begin() + i)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    handle->workers.clear();
+    handle->devices = std::move(devices);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    handle->block_dim = blockDim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!blockDim)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    *blockDim = handle->block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSetBackend(hipblasXtHandle_t handle, hipblasXtBackend_t backend)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(backend != HIPBLASXT_BACKEND_DEVICE && backend != HIPBLASXT_BACKEND_STUB)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    handle->workers.clear();
+    handle->backend = backend;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+
+// gemm
+hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               size_t             m,
+                               size_t             n,
+                               size_t             k,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               const float*       B,
+                               size_t             ldb,
+                               const float*       beta,
+                               float*             C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               size_t             m,
+                               size_t             n,
+                               size_t             k,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               const double*      B,
+                               size_t             ldb,
+                               const double*      beta,
+                               double*            C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               size_t                m,
+                               size_t                n,
+                               size_t                k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               size_t                lda,
+                               const hipblasComplex* B,
+                               size_t                ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               size_t                ldc)
+try
+{
+    return hipblasXtGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               size_t                      m,
+                               size_t                      n,
+                               size_t                      k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               size_t                      lda,
+                               const hipblasDoubleComplex* B,
+                               size_t                      ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               size_t                      ldc)
+try
+{
+    return hipblasXtGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// syrk
+hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               size_t             n,
+                               size_t             k,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               const float*       beta,
+                               float*             C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtSyrkTemplate(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               size_t             n,
+                               size_t             k,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               const double*      beta,
+                               double*            C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtSyrkTemplate(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    trans,
+                               size_t                n,
+                               size_t                k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               size_t                lda,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               size_t                ldc)
+try
+{
+    return hipblasXtSyrkTemplate(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          trans,
+                               size_t                      n,
+                               size_t                      k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               size_t                      lda,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               size_t                      ldc)
+try
+{
+    return hipblasXtSyrkTemplate(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trsm
+hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               hipblasDiagType_t  diag,
+                               size_t             m,
+                               size_t             n,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               float*             B,
+                               size_t             ldb)
+try
+{
+    return hipblasXtTrsmTemplate(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               hipblasDiagType_t  diag,
+                               size_t             m,
+                               size_t             n,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               double*            B,
+                               size_t             ldb)
+try
+{
+    return hipblasXtTrsmTemplate(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                               hipblasSideMode_t     side,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    trans,
+                               hipblasDiagType_t     diag,
+                               size_t                m,
+                               size_t                n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               size_t                lda,
+                               hipblasComplex*       B,
+                               size_t                ldb)
+try
+{
+    return hipblasXtTrsmTemplate(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                               hipblasSideMode_t           side,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          trans,
+                               hipblasDiagType_t           diag,
+                               size_t                      m,
+                               size_t                      n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               size_t                      lda,
+                               hipblasDoubleComplex*       B,
+                               size_t                      ldb)
+try
+{
+    return hipblasXtTrsmTemplate(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,615 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "xt_backend.hpp"
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+namespace
+{
+    // Typed entry points used by the GPU device
+    template <typename T>
+    struct xt_blas;
+
+#define XT_BLAS(T_, PREFIX_)                                                          \
+    template <>                                                                       \
+    struct xt_blas<T_>                                                                \
+    {                                                                                 \
+        static constexpr auto gemm = hipblas##PREFIX_##gemm;                          \
+        static constexpr auto syrk = hipblas##PREFIX_##syrk;                          \
+        static constexpr auto trsm = hipblas##PREFIX_##trsm;                          \
+    }
+
+    XT_BLAS(float, S);
+    XT_BLAS(double, D);
+    XT_BLAS(hipblasComplex, C);
+    XT_BLAS(hipblasDoubleComplex, Z);
+#undef XT_BLAS
+
+    // Calls f.template operator()<T>() for the hipBLAS type T matching type
+    template <typename F>
+    hipblasStatus_t xt_dispatch(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return f(float{});
+        case HIP_R_64F:
+            return f(double{});
+        case HIP_C_32F:
+            return f(hipblasComplex{});
+        case HIP_C_64F:
+            return f(hipblasDoubleComplex{});
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    class xt_gpu_device : public hipblasXtDevice
+    {
+        // Each slot has a handle of its own, bound to its stream, so that the tiles in flight on
+        // the two slots never share the workspace of a handle
+        int             m_device;
+        hipblasHandle_t m_handles[hipblasXtSlots]{};
+        hipStream_t     m_streams[hipblasXtSlots]{};
+        void*           m_buffers[hipblasXtSlots]{};
+        size_t          m_sizes[hipblasXtSlots]{};
+
+        // A borrowed handle serves slot 0. It is not destroyed, and gets its stream and pointer
+        // mode back when the device is.
+        bool                 m_borrowed    = false;
+        hipStream_t          m_user_stream = nullptr;
+        hipblasPointerMode_t m_user_mode   = HIPBLAS_POINTER_MODE_HOST;
+
+    public:
+        explicit xt_gpu_device(int device)
+            : m_device(device)
+        {
+        }
+
+        xt_gpu_device(hipblasHandle_t handle, int device)
+            : m_device(device)
+            , m_borrowed(true)
+        {
+            m_handles[0] = handle;
+        }
+
+        ~xt_gpu_device()
+        {
+            // Called from hipblasXtDestroy, so the device of the calling thread is restored
+            int current_device;
+            if(hipGetDevice(&current_device) != hipSuccess || hipSetDevice(m_device) != hipSuccess)
+                return;
+            if(m_borrowed && m_streams[0])
+            {
+                hipblasSetStream(m_handles[0], m_user_stream);
+                hipblasSetPointerMode(m_handles[0], m_user_mode);
+            }
+            for(int slot = 0; slot < hipblasXtSlots; slot++)
+            {
+                if(m_streams[slot])
+                {
+                    (void)hipStreamSynchronize(m_streams[slot]);
+                    (void)hipStreamDestroy(m_streams[slot]);
+                }
+                if(m_buffers[slot])
+                    (void)hipFree(m_buffers[slot]);
+            }
+            for(int slot = m_borrowed ? 1 : 0; slot < hipblasXtSlots; slot++)
+                if(m_handles[slot])
+                    hipblasDestroy(m_handles[slot]);
+            (void)hipSetDevice(current_device);
+        }
+
+        hipblasStatus_t activate() override
+        {
+            if(hipSetDevice(m_device) != hipSuccess)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            if(m_streams[0])
+                return HIPBLAS_STATUS_SUCCESS;
+
+            // Scalars are always passed in host memory. The handles of the other slots compute
+            // as the borrowed one does.
+            hipblasAtomicsMode_t atomics = HIPBLAS_ATOMICS_ALLOWED;
+            if(m_borrowed)
+            {
+                hipblasStatus_t status = hipblasGetStream(m_handles[0], &m_user_stream);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasGetPointerMode(m_handles[0], &m_user_mode);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasGetAtomicsMode(m_handles[0], &atomics);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasSetPointerMode(m_handles[0], HIPBLAS_POINTER_MODE_HOST);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+            for(int slot = 0; slot < hipblasXtSlots; slot++)
+            {
+                if(hipStreamCreateWithFlags(&m_streams[slot], hipStreamNonBlocking) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+
+                hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+                if(!m_handles[slot])
+                {
+                    status = hipblasCreate(&m_handles[slot]);
+                    if(status == HIPBLAS_STATUS_SUCCESS && m_borrowed)
+                        status = hipblasSetAtomicsMode(m_handles[slot], atomics);
+                }
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasSetStream(m_handles[slot], m_streams[slot]);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t reserve(int slot, size_t bytes, void** buffer) override
+        {
+            if(bytes > m_sizes[slot])
+            {
+                // Work queued on the slot may still use the old buffer
+                if(hipStreamSynchronize(m_streams[slot]) != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+                if(m_buffers[slot])
+                    (void)hipFree(m_buffers[slot]);
+                m_sizes[slot] = 0;
+                if(hipMalloc(&m_buffers[slot], bytes) != hipSuccess)
+                {
+                    m_buffers[slot] = nullptr;
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                }
+                m_sizes[slot] = bytes;
+            }
+            *buffer = m_buffers[slot];
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t setMatrix(int         slot,
+                                  int         rows,
+                                  int         cols,
+                                  int         elemSize,
+                                  const void* hostA,
+                                  int         lda,
+                                  void*       devB,
+                                  int         ldb) override
+        {
+            return hipblasSetMatrixAsync(
+                rows, cols, elemSize, hostA, lda, devB, ldb, m_streams[slot]);
+        }
+
+        hipblasStatus_t getMatrix(int         slot,
+                                  int         rows,
+                                  int         cols,
+                                  int         elemSize,
+                                  const void* devA,
+                                  int         lda,
+                                  void*       hostB,
+                                  int         ldb) override
+        {
+            return hipblasGetMatrixAsync(
+                rows, cols, elemSize, devA, lda, hostB, ldb, m_streams[slot]);
+        }
+
+        hipblasStatus_t gemm(int                slot,
+                             hipDataType        type,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             const void*        B,
+                             int                ldb,
+                             const void*        beta,
+                             void*              C,
+                             int                ldc) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using T = decltype(t);
+                return xt_blas<T>::gemm(m_handles[slot],
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        (const T*)alpha,
+                                        (const T*)A,
+                                        lda,
+                                        (const T*)B,
+                                        ldb,
+                                        (const T*)beta,
+                                        (T*)C,
+                                        ldc);
+            });
+        }
+
+        hipblasStatus_t syrk(int                slot,
+                             hipDataType        type,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             int                n,
+                             int                k,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             const void*        beta,
+                             void*              C,
+                             int                ldc) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using T = decltype(t);
+                return xt_blas<T>::syrk(m_handles[slot],
+                                        uplo,
+                                        trans,
+                                        n,
+                                        k,
+                                        (const T*)alpha,
+                                        (const T*)A,
+                                        lda,
+                                        (const T*)beta,
+                                        (T*)C,
+                                        ldc);
+            });
+        }
+
+        hipblasStatus_t trsm(int                slot,
+                             hipDataType        type,
+                             hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             hipblasDiagType_t  diag,
+                             int                m,
+                             int                n,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             void*              B,
+                             int                ldb) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using T = decltype(t);
+                return xt_blas<T>::trsm(m_handles[slot],
+                                        side,
+                                        uplo,
+                                        trans,
+                                        diag,
+                                        m,
+                                        n,
+                                        (const T*)alpha,
+                                        (const T*)A,
+                                        lda,
+                                        (T*)B,
+                                        ldb);
+            });
+        }
+
+        hipblasStatus_t synchronize() override
+        {
+            for(int slot = 0; slot < hipblasXtSlots; slot++)
+                if(hipStreamSynchronize(m_streams[slot]) != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    };
+
+    /* ======================================================================================== */
+    // Host reference kernels for the stub device, on hipblasXtType<T>::host
+
+    template <typename H>
+    H xt_conj(const H& x)
+    {
+        return x;
+    }
+
+    template <typename R>
+    std::complex<R> xt_conj(const std::complex<R>& x)
+    {
+        return std::conj(x);
+    }
+
+    // Element (i, j) of op(A)
+    template <typename H>
+    H xt_op(hipblasOperation_t trans, const H* A, int lda, int i, int j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return A[i + size_t(j) * lda];
+        if(trans == HIPBLAS_OP_T)
+            return A[j + size_t(i) * lda];
+        return xt_conj(A[j + size_t(i) * lda]);
+    }
+
+    template <typename H>
+    void xt_host_gemm(hipblasOperation_t transA,
+                      hipblasOperation_t transB,
+                      int                m,
+                      int                n,
+                      int                k,
+                      H                  alpha,
+                      const H*           A,
+                      int                lda,
+                      const H*           B,
+                      int                ldb,
+                      H                  beta,
+                      H*                 C,
+                      int                ldc)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                H sum(0);
+                for(int l = 0; l < k; l++)
+                    sum += xt_op(transA, A, lda, i, l) * xt_op(transB, B, ldb, l, j);
+
+                H& c = C[i + size_t(j) * ldc];
+                c    = alpha * sum + (beta == H(0) ? H(0) : beta * c);
+            }
+    }
+
+    template <typename H>
+    void xt_host_syrk(hipblasFillMode_t  uplo,
+                      hipblasOperation_t trans,
+                      int                n,
+                      int                k,
+                      H                  alpha,
+                      const H*           A,
+                      int                lda,
+                      H                  beta,
+                      H*                 C,
+                      int                ldc)
+    {
+        // syrk never conjugates
+        hipblasOperation_t op = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        for(int j = 0; j < n; j++)
+        {
+            int i_begin = uplo == HIPBLAS_FILL_MODE_LOWER ? j : 0;
+            int i_end   = uplo == HIPBLAS_FILL_MODE_LOWER ? n : j + 1;
+            for(int i = i_begin; i < i_end; i++)
+            {
+                H sum(0);
+                for(int l = 0; l < k; l++)
+                    sum += xt_op(op, A, lda, i, l) * xt_op(op, A, lda, j, l);
+
+                H& c = C[i + size_t(j) * ldc];
+                c    = alpha * sum + (beta == H(0) ? H(0) : beta * c);
+            }
+        }
+    }
+
+    template <typename H>
+    void xt_host_trsm(hipblasSideMode_t  side,
+                      hipblasFillMode_t  uplo,
+                      hipblasOperation_t trans,
+                      hipblasDiagType_t  diag,
+                      int                m,
+                      int                n,
+                      H                  alpha,
+                      const H*           A,
+                      int                lda,
+                      H*                 B,
+                      int                ldb)
+    {
+        // op(A) is lower triangular if A is lower and not transposed, or upper and transposed
+        bool lower = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+        auto a     = [&](int i, int j) { return xt_op(trans, A, lda, i, j); };
+        auto b     = [&](int i, int j) -> H& { return B[i + size_t(j) * ldb]; };
+
+        if(side == HIPBLAS_SIDE_LEFT)
+        {
+            // op(A) * X = alpha * B, one column at a time
+            for(int j = 0; j < n; j++)
+                for(int s = 0; s < m; s++)
+                {
+                    int i = lower ? s : m - 1 - s;
+                    H   x = alpha * b(i, j);
+                    for(int t = 0; t < s; t++)
+                    {
+                        int l = lower ? t : m - 1 - t;
+                        x -= a(i, l) * b(l, j);
+                    }
+                    b(i, j) = diag == HIPBLAS_DIAG_UNIT ? x : x / a(i, i);
+                }
+        }
+        else
+        {
+            // X * op(A) = alpha * B, one row at a time; op(A) upper solves left to right
+            for(int i = 0; i < m; i++)
+                for(int s = 0; s < n; s++)
+                {
+                    int j = lower ? n - 1 - s : s;
+                    H   x = alpha * b(i, j);
+                    for(int t = 0; t < s; t++)
+                    {
+                        int l = lower ? n - 1 - t : t;
+                        x -= b(i, l) * a(l, j);
+                    }
+                    b(i, j) = diag == HIPBLAS_DIAG_UNIT ? x : x / a(j, j);
+                }
+        }
+    }
+
+    class xt_stub_device : public hipblasXtDevice
+    {
+        std::vector<char> m_buffers[hipblasXtSlots];
+
+        static void copy_matrix(
+            int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
+        {
+            for(int j = 0; j < cols; j++)
+                std::memcpy((char*)B + size_t(j) * ldb * elemSize,
+                            (const char*)A + size_t(j) * lda * elemSize,
+                            size_t(rows) * elemSize);
+        }
+
+    public:
+        hipblasStatus_t activate() override
+        {
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t reserve(int slot, size_t bytes, void** buffer) override
+        {
+            if(bytes > m_buffers[slot].size())
+                m_buffers[slot].resize(bytes);
+            *buffer = m_buffers[slot].data();
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t setMatrix(int         slot,
+                                  int         rows,
+                                  int         cols,
+                                  int         elemSize,
+                                  const void* hostA,
+                                  int         lda,
+                                  void*       devB,
+                                  int         ldb) override
+        {
+            if(rows < 0 || cols < 0 || elemSize <= 0 || lda < rows || ldb < rows)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            copy_matrix(rows, cols, elemSize, hostA, lda, devB, ldb);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t getMatrix(int         slot,
+                                  int         rows,
+                                  int         cols,
+                                  int         elemSize,
+                                  const void* devA,
+                                  int         lda,
+                                  void*       hostB,
+                                  int         ldb) override
+        {
+            if(rows < 0 || cols < 0 || elemSize <= 0 || lda < rows || ldb < rows)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            copy_matrix(rows, cols, elemSize, devA, lda, hostB, ldb);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t gemm(int                slot,
+                             hipDataType        type,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             const void*        B,
+                             int                ldb,
+                             const void*        beta,
+                             void*              C,
+                             int                ldc) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using H = typename hipblasXtType<decltype(t)>::host;
+                xt_host_gemm(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             *(const H*)alpha,
+                             (const H*)A,
+                             lda,
+                             (const H*)B,
+                             ldb,
+                             *(const H*)beta,
+                             (H*)C,
+                             ldc);
+                return HIPBLAS_STATUS_SUCCESS;
+            });
+        }
+
+        hipblasStatus_t syrk(int                slot,
+                             hipDataType        type,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             int                n,
+                             int                k,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             const void*        beta,
+                             void*              C,
+                             int                ldc) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using H = typename hipblasXtType<decltype(t)>::host;
+                xt_host_syrk(uplo,
+                             trans,
+                             n,
+                             k,
+                             *(const H*)alpha,
+                             (const H*)A,
+                             lda,
+                             *(const H*)beta,
+                             (H*)C,
+                             ldc);
+                return HIPBLAS_STATUS_SUCCESS;
+            });
+        }
+
+        hipblasStatus_t trsm(int                slot,
+                             hipDataType        type,
+                             hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             hipblasDiagType_t  diag,
+                             int                m,
+                             int                n,
+                             const void*        alpha,
+                             const void*        A,
+                             int                lda,
+                             void*              B,
+                             int                ldb) override
+        {
+            return xt_dispatch(type, [&](auto t) {
+                using H = typename hipblasXtType<decltype(t)>::host;
+                xt_host_trsm(
+                    side, uplo, trans, diag, m, n, *(const H*)alpha, (const H*)A, lda, (H*)B, ldb);
+                return HIPBLAS_STATUS_SUCCESS;
+            });
+        }
+
+        hipblasStatus_t synchronize() override
+        {
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    };
+}
+
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateGpuDevice(int device)
+{
+    return std::make_unique<xt_gpu_device>(device);
+}
+
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateHandleDevice(hipblasHandle_t handle, int device)
+{
+    return std::make_unique<xt_gpu_device>(handle, device);
+}
+
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateStubDevice(int)
+{
+    return std::make_unique<xt_stub_device>();
+}
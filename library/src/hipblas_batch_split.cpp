@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "batch_split.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+
+#define BATCH_SPLIT_RETURN_IF_ERROR(status__)              \
+    do                                                     \
+    {                                                      \
+        hipblasStatus_t batch_split_status__ = (status__); \
+        if(batch_split_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return batch_split_status__;                   \
+    } while(0)
+
+namespace
+{
+    // Number of handles with batch streams, so that the common case of none does not need to look
+    // up the handle state
+    std::atomic<int> batch_split_handles{0};
+
+    // Set while a call is made unsplit, so that the function called does not split it again
+    thread_local bool batch_split_direct = false;
+
+    // The least work of a sub-batch: about 50 us at 2 TFLOPS, against the few microseconds of a
+    // fork and join
+    constexpr double min_sub_batch_flops = 1e8;
+
+    // Gives the sub-handle the settings of the parent a solver call depends on, setting only those
+    // which differ so that the trim policy of the sub-handle keeps its count
+    hipblasStatus_t batch_split_settings(hipblasHandle_t parent, hipblasHandle_t sub)
+    {
+        hipblasPointerMode_t         mode, sub_mode;
+        hipblasAtomicsMode_t         atomics, sub_atomics;
+        hipblasWorkspaceAllocMode_t  alloc, sub_alloc;
+        uint64_t                     threshold, sub_threshold;
+        hipblasWorkspaceTrimPolicy_t policy, sub_policy;
+
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetPointerMode(parent, &mode));
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetPointerMode(sub, &sub_mode));
+        if(mode != sub_mode)
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasSetPointerMode(sub, mode));
+
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetAtomicsMode(parent, &atomics));
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetAtomicsMode(sub, &sub_atomics));
+        if(atomics != sub_atomics)
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasSetAtomicsMode(sub, atomics));
+
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceAllocMode(parent, &alloc));
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceAllocMode(sub, &sub_alloc));
+        if(alloc != sub_alloc)
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasSetWorkspaceAllocMode(sub, alloc));
+
+        if(alloc == HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED)
+        {
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceReleaseThreshold(parent, &threshold));
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceReleaseThreshold(sub, &sub_threshold));
+            if(threshold != sub_threshold)
+                BATCH_SPLIT_RETURN_IF_ERROR(hipblasSetWorkspaceReleaseThreshold(sub, threshold));
+        }
+
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceTrimPolicy(parent, &policy));
+        BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetWorkspaceTrimPolicy(sub, &sub_policy));
+        if(policy.callCount != sub_policy.callCount || policy.idleMs != sub_policy.idleMs
+           || policy.targetBytes != sub_policy.targetBytes)
+            BATCH_SPLIT_RETURN_IF_ERROR(hipblasSetWorkspaceTrimPolicy(sub, &policy));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    class batch_split_direct_guard
+    {
+    public:
+        batch_split_direct_guard()
+        {
+            batch_split_direct = true;
+        }
+        ~batch_split_direct_guard()
+        {
+            batch_split_direct = false;
+        }
+    };
+}
+
+hipblasBatchStreams::~hipblasBatchStreams()
+{
+    resize(1);
+}
+
+hipblasStatus_t hipblasBatchStreams::resize(int count)
+{
+    const bool was_split = !handles.empty();
+    if(count <= 1)
+        count = 0;
+
+    while(int(handles.size()) > count)
+    {
+        (void)hipblasDestroy(handles.back());
+        (void)hipStreamDestroy(streams.back());
+        (void)hipEventDestroy(joins.back());
+        handles.pop_back();
+        streams.pop_back();
+        joins.pop_back();
+    }
+    if(!count && fork)
+    {
+        (void)hipEventDestroy(fork);
+        fork = nullptr;
+    }
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(count && !fork && hipEventCreateWithFlags(&fork, hipEventDisableTiming) != hipSuccess)
+    {
+        fork   = nullptr;
+        status = HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    while(status == HIPBLAS_STATUS_SUCCESS && int(handles.size()) < count)
+    {
+        hipblasHandle_t handle = nullptr;
+        hipStream_t     stream = nullptr;
+        hipEvent_t      join   = nullptr;
+
+        status = hipblasCreate(&handle);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess
+               || hipEventCreateWithFlags(&join, hipEventDisableTiming) != hipSuccess))
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(handle, stream);
+
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            if(handle)
+                (void)hipblasDestroy(handle);
+            if(stream)
+                (void)hipStreamDestroy(stream);
+            if(join)
+                (void)hipEventDestroy(join);
+            break;
+        }
+        handles.push_back(handle);
+        streams.push_back(stream);
+        joins.push_back(join);
+    }
+
+    if(was_split != !handles.empty())
+    {
+        if(was_split)
+            batch_split_handles--;
+        else
+            batch_split_handles++;
+    }
+    return status;
+}
+
+bool hipblasIsBatchSplit(hipblasHandle_t handle)
+{
+    if(!batch_split_handles || batch_split_direct)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->batch_streams.mutex);
+    return !state->batch_streams.handles.empty();
+}
+
+hipblasStatus_t hipblasBatchSplit(hipblasHandle_t         handle,
+                                  int                     batchCount,
+                                  double                  flops,
+                                  const hipblasBatchCall& call)
+{
+    hipblasHandleState*          state = hipblasFindHandleState(handle);
+    std::unique_lock<std::mutex> lock;
+    int                          parts = 0;
+
+    // The sub-handles allocate workspace of their own as they need it, outside any the caller
+    // reserved, so calls which must not allocate or are being captured are not split
+    if(state && batchCount > 0 && flops > 0 && !hipblasIsCaptureSafe(handle)
+       && !hipblasStreamIsCapturing(handle))
+    {
+        hipblasBatchStreams& streams = state->batch_streams;
+        lock  = std::unique_lock<std::mutex>(streams.mutex);
+        parts = int(std::min({double(streams.handles.size()),
+                              double(batchCount),
+                              batchCount * flops / min_sub_batch_flops}));
+    }
+
+    if(parts <= 1)
+    {
+        if(lock.owns_lock())
+            lock.unlock();
+        batch_split_direct_guard direct;
+        return call(handle, 0, batchCount);
+    }
+
+    hipblasBatchStreams& streams = state->batch_streams;
+    hipStream_t          stream;
+    BATCH_SPLIT_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+    if(hipEventRecord(streams.fork, stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+    int             started = 0;
+    for(int i = 0; i < parts && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        // Sub-batches differ in size by at most one problem
+        int offset = int(int64_t(batchCount) * i / parts);
+        int count  = int(int64_t(batchCount) * (i + 1) / parts) - offset;
+
+        if(hipStreamWaitEvent(streams.streams[i], streams.fork, 0) != hipSuccess)
+        {
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        status = batch_split_settings(handle, streams.handles[i]);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call(streams.handles[i], offset, count);
+        if(hipEventRecord(streams.joins[i], streams.streams[i]) != hipSuccess
+           && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        started++;
+    }
+
+    // The stream of the caller waits for every stream which was forked from it, even after an
+    // error
+    for(int i = 0; i < started; i++)
+        if(hipStreamWaitEvent(stream, streams.joins[i], 0) != hipSuccess
+           && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasSetBatchStreams(hipblasHandle_t handle, int numStreams)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(numStreams < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->batch_streams.mutex);
+    return state->batch_streams.resize(numStreams);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetBatchStreams(hipblasHandle_t handle, int* numStreams)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(numStreams == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *numStreams = 1;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(state)
+    {
+        std::lock_guard<std::mutex> lock(state->batch_streams.mutex);
+        *numStreams = std::max(1, int(state->batch_streams.handles.size()));
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
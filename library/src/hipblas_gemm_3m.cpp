@@ -0,0 +1,875 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_3m.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+// The 3M algorithm splits the complex operands into real and imaginary parts with transposing
+// geams, and forms the product from three real gemms, whose results are combined with geam. The
+// parts are kept in scratch owned by the handle, which only grows, at a fixed stride between the
+// problems of a batch, so that each step is one strided batched call for the whole batch, or for
+// as many problems as fit in the scratch.
+
+#define GEMM_3M_RETURN_IF_ERROR(status__)              \
+    do                                                 \
+    {                                                  \
+        hipblasStatus_t gemm_3m_status__ = (status__); \
+        if(gemm_3m_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return gemm_3m_status__;                   \
+    } while(0)
+
+#define GEMM_3M_RETURN_IF_HIP_ERROR(error__)      \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    // Scratch for as many problems of a batch as fit in 256 MiB, or for one
+    constexpr size_t gemm_3m_max_scratch = size_t(256) << 20;
+
+    template <typename T>
+    struct gemm_3m_functions;
+
+    template <>
+    struct gemm_3m_functions<hipblasComplex>
+    {
+        using real_t = float;
+
+        static constexpr auto geam_batched         = hipblasSgeamBatched;
+        static constexpr auto geam_strided_batched = hipblasSgeamStridedBatched;
+        static constexpr auto gemm_strided_batched = hipblasSgemmStridedBatched;
+    };
+
+    template <>
+    struct gemm_3m_functions<hipblasDoubleComplex>
+    {
+        using real_t = double;
+
+        static constexpr auto geam_batched         = hipblasDgeamBatched;
+        static constexpr auto geam_strided_batched = hipblasDgeamStridedBatched;
+        static constexpr auto gemm_strided_batched = hipblasDgemmStridedBatched;
+    };
+
+    // Elements spanned by A, B and C of one problem; each part of an operand has the span and
+    // the leading dimension of the operand itself. The parts of C are ldc * n apart, so that
+    // those of a batch are the columns of one matrix.
+    struct gemm_3m_spans
+    {
+        int64_t a, b, c, c_part;
+
+        gemm_3m_spans(hipblasOperation_t transa,
+                      hipblasOperation_t transb,
+                      int                m,
+                      int                n,
+                      int                k,
+                      int                lda,
+                      int                ldb,
+                      int                ldc)
+            : a(transa == HIPBLAS_OP_N ? int64_t(lda) * (k - 1) + m : int64_t(lda) * (m - 1) + k)
+            , b(transb == HIPBLAS_OP_N ? int64_t(ldb) * (n - 1) + k : int64_t(ldb) * (k - 1) + n)
+            , c(int64_t(ldc) * (n - 1) + m)
+            , c_part(int64_t(ldc) * n)
+        {
+        }
+
+        // Both parts of A, B and C, and the m by n product of two parts
+        size_t elements(int m, int n) const
+        {
+            return 2 * (a + b + c_part) + int64_t(m) * n;
+        }
+    };
+
+    // A complex operand of a strided batch, or of a batch with an array of pointers
+    template <typename X>
+    struct gemm_3m_strided
+    {
+        X*        x;
+        long long stride;
+    };
+
+    template <typename X>
+    struct gemm_3m_array
+    {
+        X* const* x;
+    };
+
+    // Copies span elements of problems first to first + count of X to their real parts at re,
+    // 2 part elements apart, each followed by its imaginary part, as the transpose of X viewed
+    // as a real 2 by span matrix. parts is the array of the real parts, for arrays of pointers.
+    template <typename T, typename U, typename R>
+    hipblasStatus_t gemm_3m_split(hipblasHandle_t           handle,
+                                  const gemm_3m_strided<U>& X,
+                                  int                       first,
+                                  int                       count,
+                                  int64_t                   span,
+                                  R*                        re,
+                                  int64_t                   part,
+                                  R* const*                 parts)
+    {
+        const R  one(1), zero(0);
+        const R* x = reinterpret_cast<const R*>(X.x + first * X.stride);
+        return gemm_3m_functions<T>::geam_strided_batched(handle,
+                                                          HIPBLAS_OP_T,
+                                                          HIPBLAS_OP_T,
+                                                          span,
+                                                          2,
+                                                          &one,
+                                                          x,
+                                                          2,
+                                                          2 * X.stride,
+                                                          &zero,
+                                                          x,
+                                                          2,
+                                                          2 * X.stride,
+                                                          re,
+                                                          part,
+                                                          2 * part,
+                                                          count);
+    }
+
+    template <typename T, typename U, typename R>
+    hipblasStatus_t gemm_3m_split(hipblasHandle_t         handle,
+                                  const gemm_3m_array<U>& X,
+                                  int                     first,
+                                  int                     count,
+                                  int64_t                 span,
+                                  R*                      re,
+                                  int64_t                 part,
+                                  R* const*               parts)
+    {
+        const R         one(1), zero(0);
+        const R* const* x = reinterpret_cast<const R* const*>(X.x + first);
+        return gemm_3m_functions<T>::geam_batched(handle,
+                                                  HIPBLAS_OP_T,
+                                                  HIPBLAS_OP_T,
+                                                  span,
+                                                  2,
+                                                  &one,
+                                                  x,
+                                                  2,
+                                                  &zero,
+                                                  x,
+                                                  2,
+                                                  parts,
+                                                  part,
+                                                  count);
+    }
+
+    // The inverse of gemm_3m_split, from the parts of C
+    template <typename T, typename R>
+    hipblasStatus_t gemm_3m_merge(hipblasHandle_t           handle,
+                                  const gemm_3m_strided<T>& X,
+                                  int                       first,
+                                  int                       count,
+                                  int64_t                   span,
+                                  const R*                  re,
+                                  int64_t                   part,
+                                  R* const*                 parts)
+    {
+        const R one(1), zero(0);
+        return gemm_3m_functions<T>::geam_strided_batched(
+            handle,
+            HIPBLAS_OP_T,
+            HIPBLAS_OP_T,
+            2,
+            span,
+            &one,
+            re,
+            part,
+            2 * part,
+            &zero,
+            re,
+            part,
+            2 * part,
+            reinterpret_cast<R*>(X.x + first * X.stride),
+            2,
+            2 * X.stride,
+            count);
+    }
+
+    template <typename T, typename R>
+    hipblasStatus_t gemm_3m_merge(hipblasHandle_t         handle,
+                                  const gemm_3m_array<T>& X,
+                                  int                     first,
+                                  int                     count,
+                                  int64_t                 span,
+                                  const R*                re,
+                                  int64_t                 part,
+                                  R* const*               parts)
+    {
+        const R one(1), zero(0);
+        return gemm_3m_functions<T>::geam_batched(handle,
+                                                  HIPBLAS_OP_T,
+                                                  HIPBLAS_OP_T,
+                                                  2,
+                                                  span,
+                                                  &one,
+                                                  parts,
+                                                  part,
+                                                  &zero,
+                                                  parts,
+                                                  part,
+                                                  reinterpret_cast<R* const*>(X.x + first),
+                                                  2,
+                                                  count);
+    }
+
+    template <typename T>
+    bool gemm_3m_eligible(hipblasHandle_t    handle,
+                          hipblasOperation_t transa,
+                          hipblasOperation_t transb,
+                          int                m,
+                          int                n,
+                          int                k,
+                          const T*           alpha,
+                          int                lda,
+                          int                ldb,
+                          const T*           beta,
+                          int                ldc,
+                          int                batchCount,
+                          bool               operands)
+    {
+        using R = typename gemm_3m_functions<T>::real_t;
+
+        if(handle == nullptr || !hipblasIsComplexGemm3m(handle))
+            return false;
+
+        auto valid_op = [](hipblasOperation_t op) {
+            return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+        };
+        if(!valid_op(transa) || !valid_op(transb) || m <= 0 || n <= 0 || k <= 0 || batchCount <= 0
+           || !alpha || !beta || !operands)
+            return false;
+        if(lda < (transa == HIPBLAS_OP_N ? m : k) || ldb < (transb == HIPBLAS_OP_N ? k : n)
+           || ldc < m)
+            return false;
+
+        const gemm_3m_spans spans(transa, transb, m, n, k, lda, ldb, ldc);
+        if(std::max({spans.a, spans.b, spans.c_part}) > INT_MAX)
+            return false;
+
+        hipblasPointerMode_t mode;
+        if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+           || mode != HIPBLAS_POINTER_MODE_HOST)
+            return false;
+
+        // alpha = 0 only scales C
+        const R* a = reinterpret_cast<const R*>(alpha);
+        if(a[0] == 0 && a[1] == 0)
+            return false;
+
+        // The scratch may need to grow
+        if(hipblasIsCaptureSafe(handle) || hipblasStreamIsCapturing(handle))
+            return false;
+
+        // The parts are formed and combined by batched geams, which cuBLAS does not have: an
+        // empty one reports whether the backend does
+        const R zero(0);
+        return gemm_3m_functions<T>::geam_strided_batched(handle,
+                                                          HIPBLAS_OP_N,
+                                                          HIPBLAS_OP_N,
+                                                          0,
+                                                          0,
+                                                          &zero,
+                                                          nullptr,
+                                                          1,
+                                                          0,
+                                                          &zero,
+                                                          nullptr,
+                                                          1,
+                                                          0,
+                                                          nullptr,
+                                                          1,
+                                                          0,
+                                                          0)
+               != HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // C := alpha op(A) op(B) + beta C for problems first to first + count, with their parts in
+    // work, which has room for capacity problems. parts holds the arrays of capacity pointers to
+    // the parts of A, B and C, for arrays of pointers.
+    template <typename T, typename In, typename Out>
+    hipblasStatus_t gemm_3m_compute(hipblasHandle_t                        handle,
+                                    hipStream_t                            stream,
+                                    hipblasOperation_t                     transa,
+                                    hipblasOperation_t                     transb,
+                                    int                                    m,
+                                    int                                    n,
+                                    int                                    k,
+                                    const T*                               alpha,
+                                    const In&                              A,
+                                    int                                    lda,
+                                    const In&                              B,
+                                    int                                    ldb,
+                                    const T*                               beta,
+                                    const Out&                             C,
+                                    int                                    ldc,
+                                    int                                    first,
+                                    int                                    count,
+                                    int                                    capacity,
+                                    typename gemm_3m_functions<T>::real_t* work,
+                                    typename gemm_3m_functions<T>::real_t* const* parts)
+    {
+        using F = gemm_3m_functions<T>;
+        using R = typename F::real_t;
+
+        const gemm_3m_spans spans(transa, transb, m, n, k, lda, ldb, ldc);
+        const int64_t       sa2 = 2 * spans.a, sb2 = 2 * spans.b, sc2 = 2 * spans.c_part;
+        const int64_t       mn  = int64_t(m) * n;
+
+        // The parts of problem i are at Xr + i * sx2, with the imaginary part after the real one
+        R* Cr = work;
+        R* Ci = Cr + spans.c_part;
+        R* Ar = Cr + sc2 * capacity;
+        R* Ai = Ar + spans.a;
+        R* Br = Ar + sa2 * capacity;
+        R* Bi = Br + spans.b;
+        R* P  = Br + sb2 * capacity;
+
+        R* const* pA = parts;
+        R* const* pB = parts ? parts + capacity : nullptr;
+        R* const* pC = parts ? parts + 2 * capacity : nullptr;
+
+        const R  one(1);
+        const R  zero(0);
+        const R* a = reinterpret_cast<const R*>(alpha);
+        const R* b = reinterpret_cast<const R*>(beta);
+
+        GEMM_3M_RETURN_IF_ERROR(
+            gemm_3m_split<T>(handle, A, first, count, spans.a, Ar, spans.a, pA));
+        GEMM_3M_RETURN_IF_ERROR(
+            gemm_3m_split<T>(handle, B, first, count, spans.b, Br, spans.b, pB));
+        GEMM_3M_RETURN_IF_ERROR(
+            gemm_3m_split<T>(handle, C, first, count, spans.c, Cr, spans.c_part, pC));
+
+        // Cr + i Ci := beta (Cr + i Ci). Only the first m rows are written, so that the rows
+        // between m and ldc are copied back to C unchanged.
+        if(b[0] == 0 && b[1] == 0)
+        {
+            // The parts of C of the batch are the 2 n count columns of one matrix
+            GEMM_3M_RETURN_IF_HIP_ERROR(hipMemset2DAsync(
+                Cr, sizeof(R) * ldc, 0, sizeof(R) * m, size_t(2) * n * count, stream));
+        }
+        else
+        {
+            const R minus_bi = -b[1];
+            GEMM_3M_RETURN_IF_ERROR(F::geam_strided_batched(handle,
+                                                            HIPBLAS_OP_N,
+                                                            HIPBLAS_OP_N,
+                                                            m,
+                                                            n,
+                                                            &b[0],
+                                                            Cr,
+                                                            ldc,
+                                                            sc2,
+                                                            &minus_bi,
+                                                            Ci,
+                                                            ldc,
+                                                            sc2,
+                                                            P,
+                                                            m,
+                                                            mn,
+                                                            count));
+            GEMM_3M_RETURN_IF_ERROR(F::geam_strided_batched(handle,
+                                                            HIPBLAS_OP_N,
+                                                            HIPBLAS_OP_N,
+                                                            m,
+                                                            n,
+                                                            &b[1],
+                                                            Cr,
+                                                            ldc,
+                                                            sc2,
+                                                            &b[0],
+                                                            Ci,
+                                                            ldc,
+                                                            sc2,
+                                                            Ci,
+                                                            ldc,
+                                                            sc2,
+                                                            count));
+            GEMM_3M_RETURN_IF_ERROR(F::geam_strided_batched(handle,
+                                                            HIPBLAS_OP_N,
+                                                            HIPBLAS_OP_N,
+                                                            m,
+                                                            n,
+                                                            &one,
+                                                            P,
+                                                            m,
+                                                            mn,
+                                                            &zero,
+                                                            P,
+                                                            m,
+                                                            mn,
+                                                            Cr,
+                                                            ldc,
+                                                            sc2,
+                                                            count));
+        }
+
+        // With op(X) = opr(Xr) + i sx opr(Xi), where opr is op without the conjugation and
+        // sx = -1 if op conjugates, the products P1 = opr(Ar) opr(Br),
+        // P2 = sa sb opr(Ai) opr(Bi) and P3 = opr(Ar + sa Ai) opr(Br + sb Bi) give
+        // op(A) op(B) = (P1 - P2) + i (P3 - P1 - P2). Multiplied by alpha, this adds
+        // (ar + ai) P1 + (ai - ar) P2 - ai P3 to Cr and (ai - ar) P1 - (ar + ai) P2 + ar P3 to Ci.
+        const hipblasOperation_t opa = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        const hipblasOperation_t opb = transb == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        const R                  sa  = transa == HIPBLAS_OP_C ? -1 : 1;
+        const R                  sb  = transb == HIPBLAS_OP_C ? -1 : 1;
+        const R                  sab = sa * sb;
+
+        auto add = [&](const R* s, R* Y) {
+            return F::geam_strided_batched(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           m,
+                                           n,
+                                           s,
+                                           P,
+                                           m,
+                                           mn,
+                                           &one,
+                                           Y,
+                                           ldc,
+                                           sc2,
+                                           Y,
+                                           ldc,
+                                           sc2,
+                                           count);
+        };
+        auto accumulate = [&](const R* X, const R* Y, const R* s, R cr, R ci) {
+            GEMM_3M_RETURN_IF_ERROR(F::gemm_strided_batched(
+                handle, opa, opb, m, n, k, s, X, lda, sa2, Y, ldb, sb2, &zero, P, m, mn, count));
+            if(cr != 0)
+                GEMM_3M_RETURN_IF_ERROR(add(&cr, Cr));
+            if(ci != 0)
+                GEMM_3M_RETURN_IF_ERROR(add(&ci, Ci));
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+        // Xr := Xr + sx Xi, as a column of span elements
+        auto combine = [&](R* Xr, const R* Xi, int64_t span, const R* sx) {
+            return F::geam_strided_batched(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           span,
+                                           1,
+                                           &one,
+                                           Xr,
+                                           span,
+                                           2 * span,
+                                           sx,
+                                           Xi,
+                                           span,
+                                           2 * span,
+                                           Xr,
+                                           span,
+                                           2 * span,
+                                           count);
+        };
+        GEMM_3M_RETURN_IF_ERROR(accumulate(Ar, Br, &one, a[0] + a[1], a[1] - a[0]));
+        GEMM_3M_RETURN_IF_ERROR(accumulate(Ai, Bi, &sab, a[1] - a[0], -(a[0] + a[1])));
+        GEMM_3M_RETURN_IF_ERROR(combine(Ar, Ai, spans.a, &sa));
+        GEMM_3M_RETURN_IF_ERROR(combine(Br, Bi, spans.b, &sb));
+        GEMM_3M_RETURN_IF_ERROR(accumulate(Ar, Br, &one, -a[1], a[0]));
+
+        return gemm_3m_merge<T>(handle, C, first, count, spans.c, Cr, spans.c_part, pC);
+    }
+
+    // Computes the batch in as few chunks as the scratch allows, each with one call per step
+    template <typename T, typename In, typename Out>
+    hipblasStatus_t hipblasGemm3mTemplate(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const T*           alpha,
+                                          const In&          A,
+                                          int                lda,
+                                          const In&          B,
+                                          int                ldb,
+                                          const T*           beta,
+                                          const Out&         C,
+                                          int                ldc,
+                                          int                batchCount)
+    {
+        using R = typename gemm_3m_functions<T>::real_t;
+
+        // Arrays of pointers take arrays of pointers to the parts
+        constexpr bool arrays = std::is_same<In, gemm_3m_array<const T>>{};
+
+        hipStream_t stream;
+        GEMM_3M_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasDeviceScratch&       scratch = hipblasGetHandleState(handle)->gemm_3m_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+
+        const gemm_3m_spans spans(transa, transb, m, n, k, lda, ldb, ldc);
+        const size_t        data_bytes    = sizeof(R) * spans.elements(m, n);
+        const size_t        problem_bytes = data_bytes + (arrays ? 3 * sizeof(R*) : 0);
+        const int           chunk         = int(std::min<size_t>(
+            batchCount, std::max<size_t>(1, gemm_3m_max_scratch / problem_bytes)));
+
+        // The arrays of pointers follow the parts, aligned for pointers
+        const size_t pointers_offset
+            = (data_bytes * chunk + sizeof(R*) - 1) / sizeof(R*) * sizeof(R*);
+        GEMM_3M_RETURN_IF_ERROR(
+            scratch.reserve(pointers_offset + (arrays ? 3 * sizeof(R*) * chunk : 0)));
+
+        R*              work  = static_cast<R*>(scratch.data);
+        R**             parts = nullptr;
+        std::vector<R*> hparts;
+        if(arrays)
+        {
+            // The parts of A, B and C of each problem of a chunk, laid out as in gemm_3m_compute
+            const int64_t sa2 = 2 * spans.a, sb2 = 2 * spans.b, sc2 = 2 * spans.c_part;
+            hparts.resize(3 * size_t(chunk));
+            for(int i = 0; i < chunk; i++)
+            {
+                hparts[i]             = work + sc2 * chunk + sa2 * i;
+                hparts[chunk + i]     = work + (sc2 + sa2) * chunk + sb2 * i;
+                hparts[2 * chunk + i] = work + sc2 * i;
+            }
+            parts = reinterpret_cast<R**>(static_cast<char*>(scratch.data) + pointers_offset);
+            GEMM_3M_RETURN_IF_HIP_ERROR(hipMemcpyAsync(parts,
+                                                       hparts.data(),
+                                                       sizeof(R*) * hparts.size(),
+                                                       hipMemcpyHostToDevice,
+                                                       stream));
+        }
+
+        for(int first = 0; first < batchCount; first += chunk)
+        {
+            GEMM_3M_RETURN_IF_ERROR(gemm_3m_compute(handle,
+                                                    stream,
+                                                    transa,
+                                                    transb,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    lda,
+                                                    B,
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    ldc,
+                                                    first,
+                                                    std::min(chunk, batchCount - first),
+                                                    chunk,
+                                                    work,
+                                                    parts));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t gemm_3m(hipblasHandle_t                   handle,
+                            hipblasOperation_t                transa,
+                            hipblasOperation_t                transb,
+                            int                               m,
+                            int                               n,
+                            int                               k,
+                            const T*                          alpha,
+                            const T*                          A,
+                            int                               lda,
+                            const T*                          B,
+                            int                               ldb,
+                            const T*                          beta,
+                            T*                                C,
+                            int                               ldc,
+                            std::function<hipblasStatus_t()>& direct)
+    {
+        if(!gemm_3m_eligible(
+               handle, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, 1, A && B && C))
+            return direct();
+
+        return hipblasGemm3mTemplate(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     gemm_3m_strided<const T>{A, 0},
+                                     lda,
+                                     gemm_3m_strided<const T>{B, 0},
+                                     ldb,
+                                     beta,
+                                     gemm_3m_strided<T>{C, 0},
+                                     ldc,
+                                     1);
+    }
+
+    template <typename T>
+    hipblasStatus_t gemm_3m_batched(hipblasHandle_t                   handle,
+                                    hipblasOperation_t                transa,
+                                    hipblasOperation_t                transb,
+                                    int                               m,
+                                    int                               n,
+                                    int                               k,
+                                    const T*                          alpha,
+                                    const T* const                    A[],
+                                    int                               lda,
+                                    const T* const                    B[],
+                                    int                               ldb,
+                                    const T*                          beta,
+                                    T* const                          C[],
+                                    int                               ldc,
+                                    int                               batchCount,
+                                    std::function<hipblasStatus_t()>& direct)
+    {
+        const bool operands = A && B && C;
+        if(!gemm_3m_eligible(
+               handle, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batchCount, operands))
+            return direct();
+
+        return hipblasGemm3mTemplate(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     gemm_3m_array<const T>{A},
+                                     lda,
+                                     gemm_3m_array<const T>{B},
+                                     ldb,
+                                     beta,
+                                     gemm_3m_array<T>{C},
+                                     ldc,
+                                     batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t gemm_3m_strided_batched(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                transa,
+                                            hipblasOperation_t                transb,
+                                            int                               m,
+                                            int                               n,
+                                            int                               k,
+                                            const T*                          alpha,
+                                            const T*                          A,
+                                            int                               lda,
+                                            long long                         strideA,
+                                            const T*                          B,
+                                            int                               ldb,
+                                            long long                         strideB,
+                                            const T*                          beta,
+                                            T*                                C,
+                                            int                               ldc,
+                                            long long                         strideC,
+                                            int                               batchCount,
+                                            std::function<hipblasStatus_t()>& direct)
+    {
+        const bool operands = A && B && C;
+        if(!gemm_3m_eligible(
+               handle, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batchCount, operands))
+            return direct();
+
+        return hipblasGemm3mTemplate(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     gemm_3m_strided<const T>{A, strideA},
+                                     lda,
+                                     gemm_3m_strided<const T>{B, strideB},
+                                     ldb,
+                                     beta,
+                                     gemm_3m_strided<T>{C, strideC},
+                                     ldc,
+                                     batchCount);
+    }
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t                  handle,
+                              hipblasOperation_t               transa,
+                              hipblasOperation_t               transb,
+                              int                              m,
+                              int                              n,
+                              int                              k,
+                              const hipblasComplex*            alpha,
+                              const hipblasComplex*            A,
+                              int                              lda,
+                              const hipblasComplex*            B,
+                              int                              ldb,
+                              const hipblasComplex*            beta,
+                              hipblasComplex*                  C,
+                              int                              ldc,
+                              std::function<hipblasStatus_t()> direct)
+{
+    return gemm_3m(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, direct);
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t                  handle,
+                              hipblasOperation_t               transa,
+                              hipblasOperation_t               transb,
+                              int                              m,
+                              int                              n,
+                              int                              k,
+                              const hipblasDoubleComplex*      alpha,
+                              const hipblasDoubleComplex*      A,
+                              int                              lda,
+                              const hipblasDoubleComplex*      B,
+                              int                              ldb,
+                              const hipblasDoubleComplex*      beta,
+                              hipblasDoubleComplex*            C,
+                              int                              ldc,
+                              std::function<hipblasStatus_t()> direct)
+{
+    return gemm_3m(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, direct);
+}
+
+hipblasStatus_t hipblasGemm3mBatched(hipblasHandle_t                  handle,
+                                     hipblasOperation_t               transa,
+                                     hipblasOperation_t               transb,
+                                     int                              m,
+                                     int                              n,
+                                     int                              k,
+                                     const hipblasComplex*            alpha,
+                                     const hipblasComplex* const      A[],
+                                     int                              lda,
+                                     const hipblasComplex* const      B[],
+                                     int                              ldb,
+                                     const hipblasComplex*            beta,
+                                     hipblasComplex* const            C[],
+                                     int                              ldc,
+                                     int                              batchCount,
+                                     std::function<hipblasStatus_t()> direct)
+{
+    return gemm_3m_batched(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount, direct);
+}
+
+hipblasStatus_t hipblasGemm3mBatched(hipblasHandle_t                   handle,
+                                     hipblasOperation_t                transa,
+                                     hipblasOperation_t                transb,
+                                     int                               m,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     const hipblasDoubleComplex* const B[],
+                                     int                               ldb,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       C[],
+                                     int                               ldc,
+                                     int                               batchCount,
+                                     std::function<hipblasStatus_t()>  direct)
+{
+    return gemm_3m_batched(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount, direct);
+}
+
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t                  handle,
+                                            hipblasOperation_t               transa,
+                                            hipblasOperation_t               transb,
+                                            int                              m,
+                                            int                              n,
+                                            int                              k,
+                                            const hipblasComplex*            alpha,
+                                            const hipblasComplex*            A,
+                                            int                              lda,
+                                            long long                        strideA,
+                                            const hipblasComplex*            B,
+                                            int                              ldb,
+                                            long long                        strideB,
+                                            const hipblasComplex*            beta,
+                                            hipblasComplex*                  C,
+                                            int                              ldc,
+                                            long long                        strideC,
+                                            int                              batchCount,
+                                            std::function<hipblasStatus_t()> direct)
+{
+    return gemm_3m_strided_batched(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   lda,
+                                   strideA,
+                                   B,
+                                   ldb,
+                                   strideB,
+                                   beta,
+                                   C,
+                                   ldc,
+                                   strideC,
+                                   batchCount,
+                                   direct);
+}
+
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t                  handle,
+                                            hipblasOperation_t               transa,
+                                            hipblasOperation_t               transb,
+                                            int                              m,
+                                            int                              n,
+                                            int                              k,
+                                            const hipblasDoubleComplex*      alpha,
+                                            const hipblasDoubleComplex*      A,
+                                            int                              lda,
+                                            long long                        strideA,
+                                            const hipblasDoubleComplex*      B,
+                                            int                              ldb,
+                                            long long                        strideB,
+                                            const hipblasDoubleComplex*      beta,
+                                            hipblasDoubleComplex*            C,
+                                            int                              ldc,
+                                            long long                        strideC,
+                                            int                              batchCount,
+                                            std::function<hipblasStatus_t()> direct)
+{
+    return gemm_3m_strided_batched(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   lda,
+                                   strideA,
+                                   B,
+                                   ldb,
+                                   strideB,
+                                   beta,
+                                   C,
+                                   ldc,
+                                   strideC,
+                                   batchCount,
+                                   direct);
+}
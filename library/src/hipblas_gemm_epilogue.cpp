@@ -0,0 +1,451 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_epilogue.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+
+// hipblasGemmExEpilogue computes the product and applies the bias, activation and scale on the
+// device, through the backend: see gemm_epilogue.hpp.
+
+#define EPILOGUE_RETURN_IF_ERROR(status__)              \
+    do                                                  \
+    {                                                   \
+        hipblasStatus_t epilogue_status__ = (status__); \
+        if(epilogue_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return epilogue_status__;                   \
+    } while(0)
+
+#define EPILOGUE_RETURN_IF_HIP_ERROR(error__)     \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    // Sets count elements of the type of C at ones to 1
+    hipError_t epilogue_fill_ones(void* ones, hipDataType type, size_t count, hipStream_t stream)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return hipMemsetD16Async(ones, 0x3C00, count, stream);
+        case HIP_R_16BF:
+            return hipMemsetD16Async(ones, 0x3F80, count, stream);
+        case HIP_R_32F:
+            return hipMemsetD32Async(ones, 0x3F800000, count, stream);
+        default:
+        {
+            // 1.0 is 0x3FF0000000000000: set both words of each element to the high word, then
+            // clear the low ones
+            hipError_t error = hipMemsetD32Async(ones, 0x3FF00000, 2 * count, stream);
+            if(error != hipSuccess)
+                return error;
+            return hipMemset2DAsync(ones, sizeof(double), 0, sizeof(uint32_t), count, stream);
+        }
+        }
+    }
+
+    // Fills the vector of ones of the handle with at least n elements of type, unless it already
+    // holds them. It is filled to its whole size, so that it is not filled again until it grows,
+    // and again on another stream, which the fill would not be ordered with.
+    hipblasStatus_t epilogue_ones(hipblasHandle_t     handle,
+                                  hipblasHandleState* state,
+                                  hipDataType         type,
+                                  size_t              size,
+                                  int                 n,
+                                  hipStream_t         stream)
+    {
+        hipblasDeviceScratch& ones = state->gemm_epilogue_scratch;
+        if(state->gemm_epilogue_ones_type == type && state->gemm_epilogue_ones >= size_t(n)
+           && state->gemm_epilogue_ones_stream == stream)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        if(ones.size < size * n)
+        {
+            EPILOGUE_RETURN_IF_ERROR(hipblasCheckCapture(
+                handle, "hipblasGemmExEpilogue", "scratch growth to %zu bytes", size * n));
+            state->gemm_epilogue_ones = 0;
+            EPILOGUE_RETURN_IF_ERROR(ones.reserve(size * n));
+        }
+        EPILOGUE_RETURN_IF_HIP_ERROR(epilogue_fill_ones(ones.data, type, ones.size / size, stream));
+        state->gemm_epilogue_ones_type   = type;
+        state->gemm_epilogue_ones        = ones.size / size;
+        state->gemm_epilogue_ones_stream = stream;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename S>
+    hipblasStatus_t epilogue_blas(hipblasHandle_t      handle,
+                                  int                  m,
+                                  int                  n,
+                                  const void*          bias,
+                                  void*                aux,
+                                  int                  ldaux,
+                                  S                    scale,
+                                  bool                 folded,
+                                  void*                C,
+                                  hipDataType          type,
+                                  size_t               size,
+                                  int                  ldc,
+                                  hipblasComputeType_t compute)
+    {
+        hipStream_t stream;
+        EPILOGUE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        hipblasHostPointerModeGuard host_mode(handle);
+
+        const S one = 1, zero = 0;
+        if(bias)
+        {
+            hipblasHandleState*         state = hipblasGetHandleState(handle);
+            hipblasDeviceScratch&       ones  = state->gemm_epilogue_scratch;
+            std::lock_guard<std::mutex> lock(ones.mutex);
+            EPILOGUE_RETURN_IF_ERROR(epilogue_ones(handle, state, type, size, n, stream));
+
+            // C = s * (C + bias * ones^T), scaled here unless aux takes the values before the
+            // scale, or C + s * bias * ones^T when the gemm computing C was scaled
+            const S* s = aux ? &one : &scale;
+            EPILOGUE_RETURN_IF_ERROR(hipblasGemmEx_v2(handle,
+                                                      HIPBLAS_OP_N,
+                                                      HIPBLAS_OP_N,
+                                                      m,
+                                                      n,
+                                                      1,
+                                                      folded ? &scale : s,
+                                                      bias,
+                                                      type,
+                                                      m,
+                                                      ones.data,
+                                                      type,
+                                                      1,
+                                                      folded ? &one : s,
+                                                      C,
+                                                      type,
+                                                      ldc,
+                                                      compute,
+                                                      HIPBLAS_GEMM_DEFAULT));
+            if(!aux)
+                return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(folded)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(aux)
+            EPILOGUE_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(aux,
+                                                          size * ldaux,
+                                                          C,
+                                                          size * ldc,
+                                                          size * m,
+                                                          n,
+                                                          hipMemcpyDeviceToDevice,
+                                                          stream));
+        if(scale == one)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // C = scale * C, as a gemm with k = 0
+        return hipblasGemmEx_v2(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                m,
+                                n,
+                                0,
+                                &zero,
+                                C,
+                                type,
+                                ldc,
+                                C,
+                                type,
+                                1,
+                                &scale,
+                                C,
+                                type,
+                                ldc,
+                                compute,
+                                HIPBLAS_GEMM_DEFAULT);
+    }
+}
+
+hipblasGemmEpilogueScale::hipblasGemmEpilogueScale(hipblasHandle_t      handle,
+                                                   hipblasComputeType_t computeType,
+                                                   const void*          alpha,
+                                                   const void*          beta,
+                                                   double               scale)
+    : m_alpha(alpha)
+    , m_beta(beta)
+{
+    if(scale == 1)
+    {
+        m_folded = true;
+        return;
+    }
+
+    hipblasPointerMode_t mode;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || mode != HIPBLAS_POINTER_MODE_HOST)
+        return;
+
+    switch(computeType)
+    {
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        m_float[0] = float(scale) * *static_cast<const float*>(alpha);
+        m_float[1] = float(scale) * *static_cast<const float*>(beta);
+        m_alpha    = &m_float[0];
+        m_beta     = &m_float[1];
+        break;
+
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        m_double[0] = scale * *static_cast<const double*>(alpha);
+        m_double[1] = scale * *static_cast<const double*>(beta);
+        m_alpha     = &m_double[0];
+        m_beta      = &m_double[1];
+        break;
+
+    default:
+        return;
+    }
+    m_folded = true;
+}
+
+hipblasStatus_t hipblasGemmEpilogueBlas(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const void*     bias,
+                                        void*           aux,
+                                        int             ldaux,
+                                        double          scale,
+                                        bool            folded,
+                                        void*           C,
+                                        hipDataType     cType,
+                                        int             ldc)
+{
+    switch(cType)
+    {
+    case HIP_R_16F:
+    case HIP_R_16BF:
+        return epilogue_blas<float>(handle,
+                                    m,
+                                    n,
+                                    bias,
+                                    aux,
+                                    ldaux,
+                                    float(scale),
+                                    folded,
+                                    C,
+                                    cType,
+                                    sizeof(uint16_t),
+                                    ldc,
+                                    HIPBLAS_COMPUTE_32F);
+    case HIP_R_32F:
+        return epilogue_blas<float>(handle,
+                                    m,
+                                    n,
+                                    bias,
+                                    aux,
+                                    ldaux,
+                                    float(scale),
+                                    folded,
+                                    C,
+                                    cType,
+                                    sizeof(float),
+                                    ldc,
+                                    HIPBLAS_COMPUTE_32F);
+    case HIP_R_64F:
+        return epilogue_blas<double>(handle,
+                                     m,
+                                     n,
+                                     bias,
+                                     aux,
+                                     ldaux,
+                                     scale,
+                                     folded,
+                                     C,
+                                     cType,
+                                     sizeof(double),
+                                     ldc,
+                                     HIPBLAS_COMPUTE_64F);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasGemmExEpilogueBlas(hipblasHandle_t              handle,
+                                          hipblasOperation_t           transA,
+                                          hipblasOperation_t           transB,
+                                          int                          m,
+                                          int                          n,
+                                          int                          k,
+                                          const void*                  alpha,
+                                          const void*                  A,
+                                          hipDataType                  aType,
+                                          int                          lda,
+                                          const void*                  B,
+                                          hipDataType                  bType,
+                                          int                          ldb,
+                                          const void*                  beta,
+                                          void*                        C,
+                                          hipDataType                  cType,
+                                          int                          ldc,
+                                          hipblasComputeType_t         computeType,
+                                          hipblasGemmAlgo_t            algo,
+                                          const hipblasGemmEpilogue_t& epilogue)
+{
+    if(epilogue.activation != HIPBLAS_ACTIVATION_NONE)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // aux takes the values before the scale, so then C is scaled after the gemm
+    hipblasGemmEpilogueScale scaled(
+        handle, computeType, alpha, beta, epilogue.aux ? 1.0 : epilogue.scale);
+    bool folded = !epilogue.aux && scaled.folded();
+
+    EPILOGUE_RETURN_IF_ERROR(hipblasGemmEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              scaled.alpha(),
+                                              A,
+                                              aType,
+                                              lda,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              scaled.beta(),
+                                              C,
+                                              cType,
+                                              ldc,
+                                              computeType,
+                                              algo));
+    return hipblasGemmEpilogueBlas(handle,
+                                   m,
+                                   n,
+                                   epilogue.bias,
+                                   epilogue.aux,
+                                   epilogue.ldaux,
+                                   epilogue.scale,
+                                   folded,
+                                   C,
+                                   cType,
+                                   ldc);
+}
+
+extern "C" hipblasStatus_t hipblasGemmExEpilogue(hipblasHandle_t              handle,
+                                                 hipblasOperation_t           transA,
+                                                 hipblasOperation_t           transB,
+                                                 int                          m,
+                                                 int                          n,
+                                                 int                          k,
+                                                 const void*                  alpha,
+                                                 const void*                  A,
+                                                 hipDataType                  aType,
+                                                 int                          lda,
+                                                 const void*                  B,
+                                                 hipDataType                  bType,
+                                                 int                          ldb,
+                                                 const void*                  beta,
+                                                 void*                        C,
+                                                 hipDataType                  cType,
+                                                 int                          ldc,
+                                                 hipblasComputeType_t         computeType,
+                                                 hipblasGemmAlgo_t            algo,
+                                                 const hipblasGemmEpilogue_t* epilogue)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(epilogue)
+    {
+        if(epilogue->activation != HIPBLAS_ACTIVATION_NONE
+           && epilogue->activation != HIPBLAS_ACTIVATION_RELU
+           && epilogue->activation != HIPBLAS_ACTIVATION_GELU)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(epilogue->aux && epilogue->ldaux < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(cType != HIP_R_16F && cType != HIP_R_16BF && cType != HIP_R_32F && cType != HIP_R_64F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // With nothing to apply, hipblasGemmEx_v2 also reports the invalid sizes
+    if(!epilogue || m <= 0 || n <= 0)
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                aType,
+                                lda,
+                                B,
+                                bType,
+                                ldb,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                computeType,
+                                algo);
+
+    // The backend is only asked about products it can compute
+    if(k < 0 || lda < std::max(1, transA == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, transB == HIPBLAS_OP_N ? k : n) || ldc < m)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGemmExEpilogueBackend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        aType,
+                                        lda,
+                                        B,
+                                        bType,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        cType,
+                                        ldc,
+                                        computeType,
+                                        algo,
+                                        *epilogue);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
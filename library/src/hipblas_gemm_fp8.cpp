@@ -0,0 +1,608 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_fp8.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+// FP8 gemms are computed by the backend natively, through the hooks of gemm_fp8.hpp. The scales are
+// folded into alpha on the device, so that the call stays on the stream and can be captured.
+
+#define FP8_RETURN_IF_ERROR(status__)              \
+    do                                             \
+    {                                              \
+        hipblasStatus_t fp8_status__ = (status__); \
+        if(fp8_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return fp8_status__;                   \
+    } while(0)
+
+#define FP8_RETURN_IF_HIP_ERROR(error__)          \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+bool hipblasIsFp8Datatype(hipDataType type)
+{
+    return type == HIP_R_8F_E4M3_FNUZ || type == HIP_R_8F_E5M2_FNUZ
+           || hipblasIsOcpFp8Datatype(type);
+}
+
+bool hipblasIsOcpFp8Datatype(hipDataType type)
+{
+#ifdef HIPBLAS_OCP_FP8
+    return type == HIP_R_8F_E4M3 || type == HIP_R_8F_E5M2;
+#else
+    (void)type;
+    return false;
+#endif
+}
+
+namespace
+{
+    hipblasStatus_t fp8_gemm_check(hipblasHandle_t      handle,
+                                   hipblasOperation_t   transa,
+                                   hipblasOperation_t   transb,
+                                   int                  m,
+                                   int                  n,
+                                   int                  k,
+                                   const void*          alpha,
+                                   bool                 a_b,
+                                   hipDataType          a_type,
+                                   int                  lda,
+                                   hipDataType          b_type,
+                                   int                  ldb,
+                                   const void*          beta,
+                                   bool                 c,
+                                   hipDataType          c_type,
+                                   int                  ldc,
+                                   int                  batch_count,
+                                   hipblasComputeType_t compute_type)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblasIsFp8Datatype(a_type) || !hipblasIsFp8Datatype(b_type)
+           || hipblasIsOcpFp8Datatype(a_type) != hipblasIsOcpFp8Datatype(b_type)
+           || (c_type != HIP_R_16BF && c_type != HIP_R_32F) || compute_type != HIPBLAS_COMPUTE_32F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        for(hipblasOperation_t trans : {transa, transb})
+            if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+                return HIPBLAS_STATUS_INVALID_ENUM;
+
+        const int rows_a = transa == HIPBLAS_OP_N ? m : k;
+        const int rows_b = transb == HIPBLAS_OP_N ? k : n;
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, rows_a)
+           || ldb < std::max(1, rows_b) || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !c || (k > 0 && !a_b))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Calls gemm(alpha, beta, scale_a, scale_b), which applies the scales natively where the
+    // backend can. If it cannot, it returns HIPBLAS_STATUS_NOT_SUPPORTED and is called again as
+    // gemm(alpha * scale_a * scale_b, beta, nullptr, nullptr): alpha, and beta in
+    // HIPBLAS_POINTER_MODE_HOST, are copied to the FP8 scratch of the handle, scaled there by
+    // sscal, and passed on in HIPBLAS_POINTER_MODE_DEVICE.
+    template <typename Gemm>
+    hipblasStatus_t fp8_gemm_scaled(hipblasHandle_t handle,
+                                    const char*     func,
+                                    const void*     alpha,
+                                    const void*     beta,
+                                    const float*    scale_a,
+                                    const float*    scale_b,
+                                    Gemm&&          gemm)
+    {
+        hipblasStatus_t status = gemm(alpha, beta, scale_a, scale_b);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED || (!scale_a && !scale_b))
+            return status;
+
+        hipStream_t stream;
+        FP8_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasDeviceScratch&       scratch = hipblasGetHandleState(handle)->gemm_fp8_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        if(scratch.size < 2 * sizeof(float))
+            FP8_RETURN_IF_ERROR(hipblasCheckCapture(
+                handle, func, "scratch growth to %zu bytes", 2 * sizeof(float)));
+        FP8_RETURN_IF_ERROR(scratch.reserve(2 * sizeof(float)));
+
+        hipblasHostPointerModeGuard device_mode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        float*                      d_scalars = static_cast<float*>(scratch.data);
+        if(device_mode.mode() == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            FP8_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                d_scalars, alpha, sizeof(float), hipMemcpyDeviceToDevice, stream));
+        }
+        else
+        {
+            uint32_t bits[2];
+            std::memcpy(bits, alpha, sizeof(float));
+            std::memcpy(bits + 1, beta, sizeof(float));
+            FP8_RETURN_IF_HIP_ERROR(hipMemsetD32Async(d_scalars, bits[0], 1, stream));
+            FP8_RETURN_IF_HIP_ERROR(hipMemsetD32Async(d_scalars + 1, bits[1], 1, stream));
+            beta = d_scalars + 1;
+        }
+        for(const float* scale : {scale_a, scale_b})
+            if(scale)
+                FP8_RETURN_IF_ERROR(hipblasSscal(handle, 1, scale, d_scalars, 1));
+
+        return gemm(d_scalars, beta, nullptr, nullptr);
+    }
+}
+
+hipblasStatus_t hipblasGemmExFp8(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transa,
+                                 hipblasOperation_t   transb,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          a_type,
+                                 int                  lda,
+                                 const void*          B,
+                                 hipDataType          b_type,
+                                 int                  ldb,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          c_type,
+                                 int                  ldc,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasGemmAlgo_t    algo,
+                                 const float*         scale_a,
+                                 const float*         scale_b)
+{
+    FP8_RETURN_IF_ERROR(fp8_gemm_check(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A && B,
+                                       a_type,
+                                       lda,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       1,
+                                       compute_type));
+    if(m == 0 || n == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    auto gemm = [&](const void*  alpha,
+                    const void*  beta,
+                    const float* scale_a,
+                    const float* scale_b) {
+        return hipblasGemmExFp8Backend(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       algo,
+                                       scale_a,
+                                       scale_b);
+    };
+    return fp8_gemm_scaled(handle, __func__, alpha, beta, scale_a, scale_b, gemm);
+}
+
+hipblasStatus_t hipblasGemmBatchedExFp8(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A[],
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B[],
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C[],
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        const float*         scale_a,
+                                        const float*         scale_b)
+{
+    FP8_RETURN_IF_ERROR(fp8_gemm_check(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A && B,
+                                       a_type,
+                                       lda,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       batch_count,
+                                       compute_type));
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    auto gemm = [&](const void*  alpha,
+                    const void*  beta,
+                    const float* scale_a,
+                    const float* scale_b) {
+        return hipblasGemmBatchedExFp8Backend(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type,
+                                              lda,
+                                              B,
+                                              b_type,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              c_type,
+                                              ldc,
+                                              batch_count,
+                                              algo,
+                                              scale_a,
+                                              scale_b);
+    };
+    return fp8_gemm_scaled(handle, __func__, alpha, beta, scale_a, scale_b, gemm);
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExFp8(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               hipblasStride        stride_a,
+                                               const void*          B,
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               hipblasStride        stride_b,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               hipblasStride        stride_c,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo,
+                                               const float*         scale_a,
+                                               const float*         scale_b)
+{
+    FP8_RETURN_IF_ERROR(fp8_gemm_check(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A && B,
+                                       a_type,
+                                       lda,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       batch_count,
+                                       compute_type));
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    auto gemm = [&](const void*  alpha,
+                    const void*  beta,
+                    const float* scale_a,
+                    const float* scale_b) {
+        return hipblasGemmStridedBatchedExFp8Backend(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_a,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_b,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_c,
+                                                     batch_count,
+                                                     algo,
+                                                     scale_a,
+                                                     scale_b);
+    };
+    return fp8_gemm_scaled(handle, __func__, alpha, beta, scale_a, scale_b, gemm);
+}
+
+extern "C" hipblasStatus_t hipblasGemmExScaled(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transA,
+                                               hipblasOperation_t   transB,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          aType,
+                                               int                  lda,
+                                               const void*          B,
+                                               hipDataType          bType,
+                                               int                  ldb,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          cType,
+                                               int                  ldc,
+                                               hipblasComputeType_t computeType,
+                                               hipblasGemmAlgo_t    algo,
+                                               const float*         scaleA,
+                                               const float*         scaleB)
+try
+{
+    if(!hipblasIsFp8Datatype(aType) && !hipblasIsFp8Datatype(bType) && !scaleA && !scaleB)
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                aType,
+                                lda,
+                                B,
+                                bType,
+                                ldb,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                computeType,
+                                algo);
+
+    return hipblasGemmExFp8(handle,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            A,
+                            aType,
+                            lda,
+                            B,
+                            bType,
+                            ldb,
+                            beta,
+                            C,
+                            cType,
+                            ldc,
+                            computeType,
+                            algo,
+                            scaleA,
+                            scaleB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmBatchedExScaled(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transA,
+                                                      hipblasOperation_t   transB,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A[],
+                                                      hipDataType          aType,
+                                                      int                  lda,
+                                                      const void*          B[],
+                                                      hipDataType          bType,
+                                                      int                  ldb,
+                                                      const void*          beta,
+                                                      void*                C[],
+                                                      hipDataType          cType,
+                                                      int                  ldc,
+                                                      int                  batchCount,
+                                                      hipblasComputeType_t computeType,
+                                                      hipblasGemmAlgo_t    algo,
+                                                      const float*         scaleA,
+                                                      const float*         scaleB)
+try
+{
+    if(!hipblasIsFp8Datatype(aType) && !hipblasIsFp8Datatype(bType) && !scaleA && !scaleB)
+        return hipblasGemmBatchedEx_v2(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       aType,
+                                       lda,
+                                       B,
+                                       bType,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       cType,
+                                       ldc,
+                                       batchCount,
+                                       computeType,
+                                       algo);
+
+    return hipblasGemmBatchedExFp8(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   aType,
+                                   lda,
+                                   B,
+                                   bType,
+                                   ldb,
+                                   beta,
+                                   C,
+                                   cType,
+                                   ldc,
+                                   batchCount,
+                                   computeType,
+                                   algo,
+                                   scaleA,
+                                   scaleB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmStridedBatchedExScaled(hipblasHandle_t      handle,
+                                                             hipblasOperation_t   transA,
+                                                             hipblasOperation_t   transB,
+                                                             int                  m,
+                                                             int                  n,
+                                                             int                  k,
+                                                             const void*          alpha,
+                                                             const void*          A,
+                                                             hipDataType          aType,
+                                                             int                  lda,
+                                                             hipblasStride        strideA,
+                                                             const void*          B,
+                                                             hipDataType          bType,
+                                                             int                  ldb,
+                                                             hipblasStride        strideB,
+                                                             const void*          beta,
+                                                             void*                C,
+                                                             hipDataType          cType,
+                                                             int                  ldc,
+                                                             hipblasStride        strideC,
+                                                             int                  batchCount,
+                                                             hipblasComputeType_t computeType,
+                                                             hipblasGemmAlgo_t    algo,
+                                                             const float*         scaleA,
+                                                             const float*         scaleB)
+try
+{
+    if(!hipblasIsFp8Datatype(aType) && !hipblasIsFp8Datatype(bType) && !scaleA && !scaleB)
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              batchCount,
+                                              computeType,
+                                              algo);
+
+    return hipblasGemmStridedBatchedExFp8(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          aType,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          bType,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C,
+                                          cType,
+                                          ldc,
+                                          strideC,
+                                          batchCount,
+                                          computeType,
+                                          algo,
+                                          scaleA,
+                                          scaleB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_out_of_place.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+#define OUT_OF_PLACE_RETURN_IF_ERROR(status__)              \
+    do                                                      \
+    {                                                       \
+        hipblasStatus_t out_of_place_status__ = (status__); \
+        if(out_of_place_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return out_of_place_status__;                   \
+    } while(0)
+
+#define OUT_OF_PLACE_RETURN_IF_HIP_ERROR(error__) \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    // Sizes of the types of C which gemmEx computes in
+    size_t type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+        case HIP_C_16F:
+        case HIP_C_16BF:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    hipblasStatus_t out_of_place_check(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       int             k,
+                                       hipDataType     c_type,
+                                       int             ldc,
+                                       hipDataType     d_type,
+                                       int             ldd,
+                                       int             batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m < 0 || n < 0 || k < 0 || ldc < std::max(1, m) || ldd < std::max(1, m)
+           || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(d_type != c_type || !type_size(c_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copies the m by n matrix C to D on the stream of the handle
+    hipblasStatus_t copy_matrix(hipStream_t stream,
+                                int         m,
+                                int         n,
+                                size_t      size,
+                                const void* C,
+                                int         ldc,
+                                void*       D,
+                                int         ldd)
+    {
+        if(C == D && ldc == ldd)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        OUT_OF_PLACE_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(D,
+                                                          size * ldd,
+                                                          C,
+                                                          size * ldc,
+                                                          size * m,
+                                                          n,
+                                                          hipMemcpyDeviceToDevice,
+                                                          stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasGemmExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                              hipblasOperation_t   transa,
+                                              hipblasOperation_t   transb,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              hipDataType          a_type,
+                                              int                  lda,
+                                              const void*          B,
+                                              hipDataType          b_type,
+                                              int                  ldb,
+                                              const void*          beta,
+                                              const void*          C,
+                                              hipDataType          c_type,
+                                              int                  ldc,
+                                              void*                D,
+                                              hipDataType          d_type,
+                                              int                  ldd,
+                                              hipblasComputeType_t compute_type,
+                                              hipblasGemmAlgo_t    algo)
+try
+{
+    OUT_OF_PLACE_RETURN_IF_ERROR(
+        out_of_place_check(handle, m, n, k, c_type, ldc, d_type, ldd, 1));
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    OUT_OF_PLACE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+    OUT_OF_PLACE_RETURN_IF_ERROR(copy_matrix(stream, m, n, type_size(c_type), C, ldc, D, ldd));
+
+    // Computed in place on the copy of C in D
+    return hipblasGemmEx_v2(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            A,
+                            a_type,
+                            lda,
+                            B,
+                            b_type,
+                            ldb,
+                            beta,
+                            D,
+                            d_type,
+                            ldd,
+                            compute_type,
+                            algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                                     hipblasOperation_t   transa,
+                                                     hipblasOperation_t   transb,
+                                                     int                  m,
+                                                     int                  n,
+                                                     int                  k,
+                                                     const void*          alpha,
+                                                     const void*          A[],
+                                                     hipDataType          a_type,
+                                                     int                  lda,
+                                                     const void*          B[],
+                                                     hipDataType          b_type,
+                                                     int                  ldb,
+                                                     const void*          beta,
+                                                     const void*          C[],
+                                                     hipDataType          c_type,
+                                                     int                  ldc,
+                                                     void*                D[],
+                                                     hipDataType          d_type,
+                                                     int                  ldd,
+                                                     int                  batch_count,
+                                                     hipblasComputeType_t compute_type,
+                                                     hipblasGemmAlgo_t    algo)
+try
+{
+    OUT_OF_PLACE_RETURN_IF_ERROR(
+        out_of_place_check(handle, m, n, k, c_type, ldc, d_type, ldd, batch_count));
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    OUT_OF_PLACE_RETURN_IF_ERROR(
+        hipblasCheckCapture(handle, __func__, "arrays of pointers are copied to the host"));
+
+    hipStream_t stream;
+    OUT_OF_PLACE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+    std::vector<const void*> hC(batch_count);
+    std::vector<void*>       hD(batch_count);
+    OUT_OF_PLACE_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hC.data(), C, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream));
+    OUT_OF_PLACE_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hD.data(), D, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream));
+    OUT_OF_PLACE_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        if(!hC[b] || !hD[b])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        OUT_OF_PLACE_RETURN_IF_ERROR(
+            copy_matrix(stream, m, n, type_size(c_type), hC[b], ldc, hD[b], ldd));
+    }
+
+    // Computed in place on the copy of C in D
+    return hipblasGemmBatchedEx_v2(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   a_type,
+                                   lda,
+                                   B,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   D,
+                                   d_type,
+                                   ldd,
+                                   batch_count,
+                                   compute_type,
+                                   algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                                            hipblasOperation_t   transa,
+                                                            hipblasOperation_t   transb,
+                                                            int                  m,
+                                                            int                  n,
+                                                            int                  k,
+                                                            const void*          alpha,
+                                                            const void*          A,
+                                                            hipDataType          a_type,
+                                                            int                  lda,
+                                                            hipblasStride        stride_a,
+                                                            const void*          B,
+                                                            hipDataType          b_type,
+                                                            int                  ldb,
+                                                            hipblasStride        stride_b,
+                                                            const void*          beta,
+                                                            const void*          C,
+                                                            hipDataType          c_type,
+                                                            int                  ldc,
+                                                            hipblasStride        stride_c,
+                                                            void*                D,
+                                                            hipDataType          d_type,
+                                                            int                  ldd,
+                                                            hipblasStride        stride_d,
+                                                            int                  batch_count,
+                                                            hipblasComputeType_t compute_type,
+                                                            hipblasGemmAlgo_t    algo)
+try
+{
+    OUT_OF_PLACE_RETURN_IF_ERROR(
+        out_of_place_check(handle, m, n, k, c_type, ldc, d_type, ldd, batch_count));
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    OUT_OF_PLACE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+    size_t size = type_size(c_type);
+    for(int b = 0; b < batch_count; b++)
+        OUT_OF_PLACE_RETURN_IF_ERROR(copy_matrix(stream,
+                                                 m,
+                                                 n,
+                                                 size,
+                                                 (const char*)C + size * stride_c * b,
+                                                 ldc,
+                                                 (char*)D + size * stride_d * b,
+                                                 ldd));
+
+    // Computed in place on the copy of C in D
+    return hipblasGemmStridedBatchedEx_v2(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          a_type,
+                                          lda,
+                                          stride_a,
+                                          B,
+                                          b_type,
+                                          ldb,
+                                          stride_b,
+                                          beta,
+                                          D,
+                                          d_type,
+                                          ldd,
+                                          stride_d,
+                                          batch_count,
+                                          compute_type,
+                                          algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
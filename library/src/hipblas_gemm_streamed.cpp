@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "xt_tiles.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Largest tile size whose buffers, three tiles for each slot, fit in device_memory_limit
+    template <typename T>
+    size_t gemm_streamed_block_dim(size_t device_memory_limit)
+    {
+        size_t elements  = device_memory_limit / (hipblasXtSlots * 3 * sizeof(T));
+        size_t block_dim = size_t(std::sqrt(double(elements)));
+        while(block_dim * block_dim > elements)
+            block_dim--;
+        while((block_dim + 1) * (block_dim + 1) <= elements)
+            block_dim++;
+        return block_dim;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGemmStreamedTemplate(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                const T*           B,
+                                                int                ldb,
+                                                const T*           beta,
+                                                T*                 C,
+                                                int                ldc,
+                                                size_t             device_memory_limit)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+           || (transB != HIPBLAS_OP_N && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int A_row = transA == HIPBLAS_OP_N ? m : k;
+        int B_row = transB == HIPBLAS_OP_N ? k : n;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(1, A_row) || ldb < std::max(1, B_row)
+           || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // No larger tile than the problem is needed
+        size_t block_dim = std::min<size_t>(gemm_streamed_block_dim<T>(device_memory_limit),
+                                            std::max(std::max(m, n), k));
+        if(!block_dim)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = hipblasCheckCapture(
+            handle, __func__, "host matrices are streamed through freshly allocated buffers");
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // The tiles run on streams of their own, and A, B and C may be written by work queued
+        // on the handle's stream
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        XT_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        XT_RETURN_IF_ERROR(hipblasGetPointerMode(handle, &mode));
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        T h_alpha, h_beta;
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            if(hipMemcpy(&h_alpha, alpha, sizeof(T), hipMemcpyDeviceToHost) != hipSuccess
+               || hipMemcpy(&h_beta, beta, sizeof(T), hipMemcpyDeviceToHost) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        else
+        {
+            h_alpha = *alpha;
+            h_beta  = *beta;
+        }
+
+        int device_id;
+        if(hipGetDevice(&device_id) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // Owns the slot streams and buffers, and gives the handle its stream back
+        auto             device_ptr = hipblasXtCreateHandleDevice(handle, device_id);
+        hipblasXtDevice& device     = *device_ptr;
+        void*            buffers[hipblasXtSlots];
+
+        XT_RETURN_IF_ERROR(device.activate());
+        for(int slot = 0; slot < hipblasXtSlots; slot++)
+            XT_RETURN_IF_ERROR(
+                device.reserve(slot, 3 * block_dim * block_dim * sizeof(T), &buffers[slot]));
+
+        size_t mt = xt_blocks(m, block_dim);
+        size_t nt = xt_blocks(n, block_dim);
+        for(size_t t = 0; t < mt * nt; t++)
+        {
+            int    slot = int(t % hipblasXtSlots);
+            size_t ti = t % mt, tj = t / mt;
+            XT_RETURN_IF_ERROR(xt_gemm_tile(device,
+                                            slot,
+                                            (T*)buffers[slot],
+                                            int(block_dim),
+                                            transA,
+                                            transB,
+                                            ti * block_dim,
+                                            tj * block_dim,
+                                            xt_block_size(m, block_dim, ti),
+                                            xt_block_size(n, block_dim, tj),
+                                            k,
+                                            &h_alpha,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            &h_beta,
+                                            C,
+                                            ldc));
+        }
+
+        return device.synchronize();
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSgemmStreamed(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int                lda,
+                                     const float*       B,
+                                     int                ldb,
+                                     const float*       beta,
+                                     float*             C,
+                                     int                ldc,
+                                     size_t             deviceMemoryLimit)
+try
+{
+    return hipblasGemmStreamedTemplate(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStreamed(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const double*      alpha,
+                                     const double*      A,
+                                     int                lda,
+                                     const double*      B,
+                                     int                ldb,
+                                     const double*      beta,
+                                     double*            C,
+                                     int                ldc,
+                                     size_t             deviceMemoryLimit)
+try
+{
+    return hipblasGemmStreamedTemplate(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStreamed(hipblasHandle_t       handle,
+                                     hipblasOperation_t    transA,
+                                     hipblasOperation_t    transB,
+                                     int                   m,
+                                     int                   n,
+                                     int                   k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int                   lda,
+                                     const hipblasComplex* B,
+                                     int                   ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int                   ldc,
+                                     size_t                deviceMemoryLimit)
+try
+{
+    return hipblasGemmStreamedTemplate(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStreamed(hipblasHandle_t             handle,
+                                     hipblasOperation_t          transA,
+                                     hipblasOperation_t          transB,
+                                     int                         m,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* B,
+                                     int                         ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int                         ldc,
+                                     size_t                      deviceMemoryLimit)
+try
+{
+    return hipblasGemmStreamedTemplate(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, deviceMemoryLimit);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,1045 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include "staging.hpp"
+#include "xt_backend.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <complex>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// DSgesv and ZCgesv solve A X = B by factoring A in single precision and refining the solution
+// with residuals computed in double precision, as LAPACK dsgesv and zcgesv do. hipBLAS has no
+// kernels of its own, so A is rounded to single precision, and its factors widened back, on the
+// host, for all items at once through the pinned staging pool; everything else is done on the
+// device with the Batched API, which both backends support.
+
+#define GESV_RETURN_IF_ERROR(status__)              \
+    do                                              \
+    {                                               \
+        hipblasStatus_t gesv_status__ = (status__); \
+        if(gesv_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return gesv_status__;                   \
+    } while(0)
+
+#define GESV_RETURN_IF_HIP_ERROR(error__)         \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    // Refinement steps before falling back to a double precision factorization
+    constexpr int gesv_max_iterations = 30;
+
+    // Values of iter when the double precision factorization was used
+    constexpr int gesv_overflow      = -2;
+    constexpr int gesv_singular      = -3;
+    constexpr int gesv_stalled       = -4;
+    constexpr int gesv_not_converged = -(gesv_max_iterations + 1);
+
+    template <typename T>
+    struct gesv_precision;
+
+    template <>
+    struct gesv_precision<double>
+    {
+        using low = float;
+
+        static constexpr auto getrf_low = hipblasSgetrfBatched;
+        static constexpr auto getrf     = hipblasDgetrfBatched;
+        static constexpr auto getrs     = hipblasDgetrsBatched;
+        static constexpr auto gemm      = hipblasDgemmBatched;
+        static constexpr auto geam      = hipblasDgeamBatched;
+        static constexpr auto nrm2      = hipblasDnrm2Batched;
+    };
+
+    template <>
+    struct gesv_precision<hipblasDoubleComplex>
+    {
+        using low = hipblasComplex;
+
+        static constexpr auto getrf_low = hipblasCgetrfBatched;
+        static constexpr auto getrf     = hipblasZgetrfBatched;
+        static constexpr auto getrs     = hipblasZgetrsBatched;
+        static constexpr auto gemm      = hipblasZgemmBatched;
+        static constexpr auto geam      = hipblasZgeamBatched;
+        static constexpr auto nrm2      = hipblasDznrm2Batched;
+    };
+
+    template <typename In, typename Out>
+    void gesv_convert(const In* in, Out* out, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+            out[i] = Out(in[i]);
+    }
+
+    // Largest of ||r_j|| / ||x_j|| over the columns of R and X given their norms, and whether
+    // every column satisfies ||r_j|| <= ||x_j|| * tolerance. NaN residuals give a NaN ratio.
+    double gesv_residual_ratio(
+        int nrhs, const double* rnorm, const double* xnorm, double tolerance, bool& converged)
+    {
+        double ratio = 0.0;
+        converged    = true;
+        for(int j = 0; j < nrhs; j++)
+        {
+            converged = converged && rnorm[j] <= xnorm[j] * tolerance;
+            if(rnorm[j] != 0)
+            {
+                double column = xnorm[j] > 0 ? rnorm[j] / xnorm[j] : HUGE_VAL;
+                if(!(column <= ratio))
+                    ratio = column;
+            }
+        }
+        return ratio;
+    }
+
+    // Layout of the arrays of the refinement in the scratch of the handle
+    class gesv_workspace
+    {
+    public:
+        // Reserves space for count elements of U and returns its offset
+        template <typename U>
+        size_t reserve(size_t count)
+        {
+            size_t offset = m_size;
+            m_size += (sizeof(U) * count + 255) / 256 * 256;
+            return offset;
+        }
+
+        // Grows the scratch to hold every array reserved; it must be held locked while in use
+        hipblasStatus_t allocate(hipblasDeviceScratch& scratch)
+        {
+            GESV_RETURN_IF_ERROR(scratch.reserve(m_size));
+            m_memory = scratch.data;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        template <typename U>
+        U* at(size_t offset) const
+        {
+            return reinterpret_cast<U*>(static_cast<char*>(m_memory) + offset);
+        }
+
+    private:
+        void*  m_memory = nullptr;
+        size_t m_size   = 0;
+    };
+
+    // Copies count consecutive n by n matrices between the device and pageable host memory
+    // through the pinned staging pool, in as few copies as their int sizes allow. The copies
+    // are synchronous; work on the device producing the source must be waited for first.
+    template <typename U>
+    hipblasStatus_t gesv_transfer(const U* src, U* dst, int n, size_t count, hipMemcpyKind kind)
+    {
+        const size_t nn       = size_t(n) * n;
+        const size_t per_copy = std::max(size_t(1), size_t(std::numeric_limits<int>::max() / n));
+        for(size_t first = 0; first < count; first += per_copy)
+        {
+            size_t   items  = std::min(per_copy, count - first);
+            const U* from   = src + first * nn;
+            U*       to     = dst + first * nn;
+            auto     direct = [&] {
+                return hipMemcpy(to, from, sizeof(U) * nn * items, kind) == hipSuccess
+                           ? HIPBLAS_STATUS_SUCCESS
+                           : HIPBLAS_STATUS_INTERNAL_ERROR;
+            };
+            int cols = int(items * n);
+            GESV_RETURN_IF_ERROR(
+                kind == hipMemcpyHostToDevice
+                    ? hipblasStagedSetMatrix(n, cols, sizeof(U), from, n, to, n, direct)
+                    : hipblasStagedGetMatrix(n, cols, sizeof(U), from, n, to, n, direct));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    inline double gesv_abs1(double x)
+    {
+        return std::abs(x);
+    }
+
+    inline double gesv_abs1(const std::complex<double>& x)
+    {
+        return std::abs(x.real()) + std::abs(x.imag());
+    }
+
+    // ||A|| as the largest sum of the rows of the n by n matrix A, with the magnitudes of
+    // complex elements taken as |re| + |im| as asum does. A NaN element gives a NaN norm.
+    template <typename H>
+    double gesv_norm(const H* A, int n)
+    {
+        std::vector<double> rows(n, 0.0);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                rows[i] += gesv_abs1(A[i + size_t(j) * n]);
+
+        double norm = 0.0;
+        for(double row : rows)
+            if(!(row <= norm))
+                norm = row;
+        return norm;
+    }
+
+    // The solve shared by all forms; A, B and X hold device pointers to the matrices of each
+    // item, and ipiv the pivots of item b at ipiv + b * strideP. The refinement solves with the
+    // single precision factors widened to double precision, so that no residual or correction
+    // is converted, and each step is a few batched calls over the items which are still refining.
+    template <typename T>
+    hipblasStatus_t gesv_mixed_solve(hipblasHandle_t              handle,
+                                     int                          n,
+                                     int                          nrhs,
+                                     const std::vector<const T*>& A,
+                                     int                          lda,
+                                     int*                         ipiv,
+                                     hipblasStride                strideP,
+                                     const std::vector<const T*>& B,
+                                     int                          ldb,
+                                     const std::vector<T*>&       X,
+                                     int                          ldx,
+                                     int*                         iter,
+                                     double*                      residual,
+                                     int*                         deviceInfo)
+    {
+        using P = gesv_precision<T>;
+        using L = typename P::low;
+        using H = typename hipblasXtType<T>::host;
+        using S = typename hipblasXtType<L>::host;
+
+        const size_t batch = A.size();
+        const size_t nn    = size_t(n) * n;
+        const size_t nr    = size_t(n) * nrhs;
+
+        hipStream_t stream;
+        GESV_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        if(!batch)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!nr)
+        {
+            std::fill(iter, iter + batch, 0);
+            std::fill(residual, residual + batch, 0.0);
+            GESV_RETURN_IF_HIP_ERROR(hipMemsetAsync(deviceInfo, 0, sizeof(int) * batch, stream));
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        const size_t   cols = size_t(nrhs) * batch;
+        gesv_workspace ws;
+        size_t         o_ptrs = ws.reserve<void*>(6 * batch + 2 * cols);
+        size_t         o_SA   = ws.reserve<L>(nn * batch);
+        size_t         o_F    = ws.reserve<T>(nn * batch);
+        size_t         o_R    = ws.reserve<T>(nr * batch);
+        size_t         o_ipiv = ws.reserve<int>(size_t(n) * batch);
+        size_t         o_spiv = ws.reserve<int>(size_t(n) * batch);
+        size_t         o_info = ws.reserve<int>(batch);
+
+        hipblasDeviceScratch&       scratch = hipblasGetHandleState(handle)->gesv_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        GESV_RETURN_IF_ERROR(ws.allocate(scratch));
+
+        L*   SA      = ws.at<L>(o_SA);
+        T*   F       = ws.at<T>(o_F);
+        T*   R       = ws.at<T>(o_R);
+        int* ws_ipiv = ws.at<int>(o_ipiv);
+        int* ws_spiv = ws.at<int>(o_spiv);
+        int* ws_info = ws.at<int>(o_info);
+
+        // Device arrays of pointers to the matrices of the items in the current set: A, B, X, R,
+        // SA, the factors F, then the columns of R and of X. ws_spiv holds the pivots of the set.
+        void**                   dptrs = ws.at<void*>(o_ptrs);
+        std::vector<const void*> ptrs(6 * batch + 2 * cols);
+
+        auto dA  = reinterpret_cast<const T* const*>(dptrs);
+        auto dB  = reinterpret_cast<const T* const*>(dptrs + batch);
+        auto dX  = reinterpret_cast<T* const*>(dptrs + 2 * batch);
+        auto dR  = reinterpret_cast<T* const*>(dptrs + 3 * batch);
+        auto dSA = reinterpret_cast<L* const*>(dptrs + 4 * batch);
+        auto dF  = reinterpret_cast<T* const*>(dptrs + 5 * batch);
+        auto dRc = reinterpret_cast<const T* const*>(dptrs + 6 * batch);
+        auto dXc = reinterpret_cast<const T* const*>(dptrs + 6 * batch + cols);
+
+        auto select = [&](const std::vector<size_t>& set, bool gather_pivots) -> hipblasStatus_t {
+            for(size_t k = 0; k < set.size(); k++)
+            {
+                size_t b            = set[k];
+                ptrs[k]             = A[b];
+                ptrs[batch + k]     = B[b];
+                ptrs[2 * batch + k] = X[b];
+                ptrs[3 * batch + k] = R + b * nr;
+                ptrs[4 * batch + k] = SA + b * nn;
+                ptrs[5 * batch + k] = F + b * nn;
+                for(int j = 0; j < nrhs; j++)
+                {
+                    ptrs[6 * batch + k * nrhs + j]        = R + b * nr + size_t(j) * n;
+                    ptrs[6 * batch + cols + k * nrhs + j] = X[b] + size_t(j) * ldx;
+                }
+                if(gather_pivots)
+                    GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(ws_spiv + k * n,
+                                                            ws_ipiv + b * n,
+                                                            sizeof(int) * n,
+                                                            hipMemcpyDeviceToDevice,
+                                                            stream));
+            }
+            GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dptrs, ptrs.data(), sizeof(void*) * ptrs.size(), hipMemcpyHostToDevice, stream));
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        // Keeps the pivots of the set in the pivots of each item
+        auto scatter_pivots = [&](const std::vector<size_t>& set) -> hipblasStatus_t {
+            for(size_t k = 0; k < set.size(); k++)
+                GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(ws_ipiv + set[k] * n,
+                                                        ws_spiv + k * n,
+                                                        sizeof(int) * n,
+                                                        hipMemcpyDeviceToDevice,
+                                                        stream));
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        const T      one       = hipblasXtConstant<T>(1);
+        const T      zero      = hipblasXtConstant<T>(0);
+        const T      minus_one = hipblasXtConstant<T>(-1);
+        const double eps       = std::numeric_limits<double>::epsilon() / 2;
+
+        // Copies matrices of the first count items of the set on the device
+        auto copy = [&](const T* const* src, int ld_src, T* const* dst, int ld_dst, int m, int count)
+            -> hipblasStatus_t {
+            return P::geam(handle,
+                           HIPBLAS_OP_N,
+                           HIPBLAS_OP_N,
+                           n,
+                           m,
+                           &one,
+                           src,
+                           ld_src,
+                           &zero,
+                           src,
+                           ld_src,
+                           dst,
+                           ld_dst,
+                           count);
+        };
+
+        // R = B - A X and the norms of the columns of R and X for the first count items
+        std::vector<double> rnorm(cols), xnorm(cols);
+
+        auto residuals = [&](int count) -> hipblasStatus_t {
+            GESV_RETURN_IF_ERROR(copy(dB, ldb, dR, n, nrhs, count));
+            GESV_RETURN_IF_ERROR(P::gemm(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         n,
+                                         nrhs,
+                                         n,
+                                         &minus_one,
+                                         dA,
+                                         lda,
+                                         dX,
+                                         ldx,
+                                         &one,
+                                         dR,
+                                         n,
+                                         count));
+            GESV_RETURN_IF_ERROR(P::nrm2(handle, n, dRc, 1, count * nrhs, rnorm.data()));
+            return P::nrm2(handle, n, dXc, 1, count * nrhs, xnorm.data());
+        };
+
+        hipblasHostPointerModeGuard host_mode(handle);
+
+        // A is rounded to single precision on the host, all items in one transfer each way.
+        // F holds a copy of A packed with leading dimension n until it holds the factors.
+        std::vector<size_t> all(batch);
+        for(size_t b = 0; b < batch; b++)
+            all[b] = b;
+        GESV_RETURN_IF_ERROR(select(all, false));
+        GESV_RETURN_IF_ERROR(copy(dA, lda, dF, n, n, int(batch)));
+        GESV_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<H> hA(nn * batch);
+        std::vector<S> hS(nn * batch);
+        GESV_RETURN_IF_ERROR(gesv_transfer(
+            F, reinterpret_cast<T*>(hA.data()), n, batch, hipMemcpyDeviceToHost));
+
+        // When ||A|| fits in single precision so do all the elements of A; other items are
+        // solved in double precision
+        std::vector<double> anorm(batch);
+        std::vector<size_t> set;
+        for(size_t b = 0; b < batch; b++)
+        {
+            anorm[b] = gesv_norm(hA.data() + b * nn, n);
+            if(anorm[b] <= FLT_MAX)
+            {
+                gesv_convert(hA.data() + b * nn, hS.data() + b * nn, nn);
+                set.push_back(b);
+            }
+            else
+                iter[b] = gesv_overflow;
+        }
+
+        std::vector<int>    hinfo(batch, 0);
+        std::vector<size_t> active;
+        if(!set.empty())
+        {
+            GESV_RETURN_IF_ERROR(gesv_transfer(
+                reinterpret_cast<const L*>(hS.data()), SA, n, batch, hipMemcpyHostToDevice));
+            GESV_RETURN_IF_ERROR(select(set, false));
+            GESV_RETURN_IF_ERROR(
+                P::getrf_low(handle, n, dSA, n, ws_spiv, ws_info, int(set.size())));
+            GESV_RETURN_IF_ERROR(scatter_pivots(set));
+            GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                hinfo.data(), ws_info, sizeof(int) * set.size(), hipMemcpyDeviceToHost, stream));
+            GESV_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            // The factors are widened to double precision the same way
+            GESV_RETURN_IF_ERROR(gesv_transfer(
+                SA, reinterpret_cast<L*>(hS.data()), n, batch, hipMemcpyDeviceToHost));
+            for(size_t k = 0; k < set.size(); k++)
+            {
+                size_t b = set[k];
+                if(hinfo[k] != 0)
+                {
+                    iter[b] = gesv_singular;
+                    continue;
+                }
+                gesv_convert(hS.data() + b * nn, hA.data() + b * nn, nn);
+                active.push_back(b);
+            }
+        }
+        if(!active.empty())
+            GESV_RETURN_IF_ERROR(gesv_transfer(
+                reinterpret_cast<const T*>(hA.data()), F, n, batch, hipMemcpyHostToDevice));
+
+        // X = B solved with the factors, then refined while the residuals keep falling
+        int solve_info;
+        if(!active.empty())
+        {
+            int count = int(active.size());
+            GESV_RETURN_IF_ERROR(select(active, true));
+            GESV_RETURN_IF_ERROR(copy(dB, ldb, dX, ldx, nrhs, count));
+            GESV_RETURN_IF_ERROR(P::getrs(
+                handle, HIPBLAS_OP_N, n, nrhs, dF, n, ws_spiv, dX, ldx, &solve_info, count));
+        }
+
+        // The columns are compared in the 2-norm, which the device computes directly; the bound
+        // uses n where LAPACK's infinity norm test uses sqrt(n), so that test passing implies this
+        std::vector<double> last_ratio(batch, HUGE_VAL);
+        for(int it = 0; !active.empty(); it++)
+        {
+            GESV_RETURN_IF_ERROR(residuals(int(active.size())));
+
+            std::vector<size_t> refining;
+            for(size_t k = 0; k < active.size(); k++)
+            {
+                size_t b = active[k];
+                bool   converged;
+                double ratio = gesv_residual_ratio(nrhs,
+                                                   rnorm.data() + k * nrhs,
+                                                   xnorm.data() + k * nrhs,
+                                                   anorm[b] * eps * n,
+                                                   converged);
+                residual[b]  = anorm[b] > 0 ? ratio / anorm[b] : ratio;
+
+                if(converged)
+                    iter[b] = it;
+                else if(it == gesv_max_iterations)
+                    iter[b] = gesv_not_converged;
+                else if(!(ratio < last_ratio[b]))
+                    iter[b] = gesv_stalled;
+                else
+                {
+                    last_ratio[b] = ratio;
+                    refining.push_back(b);
+                }
+            }
+            if(refining.empty())
+                break;
+            if(refining.size() < active.size())
+            {
+                active.swap(refining);
+                GESV_RETURN_IF_ERROR(select(active, true));
+            }
+
+            // A D = R, solved in place, and X = X + D
+            int count = int(active.size());
+            GESV_RETURN_IF_ERROR(P::getrs(
+                handle, HIPBLAS_OP_N, n, nrhs, dF, n, ws_spiv, dR, n, &solve_info, count));
+            GESV_RETURN_IF_ERROR(P::geam(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         n,
+                                         nrhs,
+                                         &one,
+                                         dX,
+                                         ldx,
+                                         &one,
+                                         dR,
+                                         n,
+                                         dX,
+                                         ldx,
+                                         count));
+        }
+
+        // Items which did not converge are solved with a double precision factorization
+        std::vector<size_t> fallback, solved;
+        for(size_t b = 0; b < batch; b++)
+            if(iter[b] < 0)
+                fallback.push_back(b);
+        std::fill(hinfo.begin(), hinfo.end(), 0);
+        if(!fallback.empty())
+        {
+            int count = int(fallback.size());
+            GESV_RETURN_IF_ERROR(select(fallback, false));
+            GESV_RETURN_IF_ERROR(copy(dA, lda, dF, n, n, count));
+            GESV_RETURN_IF_ERROR(copy(dB, ldb, dX, ldx, nrhs, count));
+            GESV_RETURN_IF_ERROR(P::getrf(handle, n, dF, n, ws_spiv, ws_info, count));
+            GESV_RETURN_IF_ERROR(scatter_pivots(fallback));
+
+            std::vector<int> finfo(fallback.size());
+            GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                finfo.data(), ws_info, sizeof(int) * finfo.size(), hipMemcpyDeviceToHost, stream));
+            GESV_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            for(size_t k = 0; k < fallback.size(); k++)
+            {
+                size_t b = fallback[k];
+                hinfo[b] = finfo[k];
+                if(finfo[k] != 0)
+                    residual[b] = HUGE_VAL;
+                else
+                    solved.push_back(b);
+            }
+        }
+        if(!solved.empty())
+        {
+            int count = int(solved.size());
+            if(solved.size() < fallback.size())
+                GESV_RETURN_IF_ERROR(select(solved, true));
+            GESV_RETURN_IF_ERROR(P::getrs(
+                handle, HIPBLAS_OP_N, n, nrhs, dF, n, ws_spiv, dX, ldx, &solve_info, count));
+            GESV_RETURN_IF_ERROR(residuals(count));
+            for(size_t k = 0; k < solved.size(); k++)
+            {
+                size_t b = solved[k];
+                bool   converged;
+                double ratio = gesv_residual_ratio(
+                    nrhs, rnorm.data() + k * nrhs, xnorm.data() + k * nrhs, 0.0, converged);
+                residual[b] = anorm[b] > 0 ? ratio / anorm[b] : ratio;
+            }
+        }
+
+        // The pivots are those of the factorization used for each item
+        if(strideP == n)
+            GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                ipiv, ws_ipiv, sizeof(int) * n * batch, hipMemcpyDeviceToDevice, stream));
+        else
+            GESV_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(ipiv,
+                                                      sizeof(int) * strideP,
+                                                      ws_ipiv,
+                                                      sizeof(int) * n,
+                                                      sizeof(int) * n,
+                                                      batch,
+                                                      hipMemcpyDeviceToDevice,
+                                                      stream));
+        GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            deviceInfo, hinfo.data(), sizeof(int) * batch, hipMemcpyHostToDevice, stream));
+        GESV_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copies an array of device pointers to the host
+    template <typename T>
+    hipblasStatus_t gesv_host_pointers(hipblasHandle_t  handle,
+                                       T* const         x[],
+                                       int              batch_count,
+                                       std::vector<T*>& host)
+    {
+        hipStream_t stream;
+        GESV_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        host.resize(batch_count);
+        GESV_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            host.data(), x, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream));
+        GESV_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGesvMixedTemplate(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             const T*        A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             const T*        B,
+                                             const int       ldb,
+                                             T*              X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             double*         residual,
+                                             int*            info,
+                                             int*            deviceInfo)
+    {
+        if(info == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        else if(n < 0)
+            *info = -1;
+        else if(nrhs < 0)
+            *info = -2;
+        else if(A == NULL && n)
+            *info = -3;
+        else if(lda < std::max(1, n))
+            *info = -4;
+        else if(ipiv == NULL && n)
+            *info = -5;
+        else if(B == NULL && n && nrhs)
+            *info = -6;
+        else if(ldb < std::max(1, n))
+            *info = -7;
+        else if(X == NULL && n && nrhs)
+            *info = -8;
+        else if(ldx < std::max(1, n))
+            *info = -9;
+        else if(iter == NULL)
+            *info = -10;
+        else if(residual == NULL)
+            *info = -11;
+        else if(deviceInfo == NULL)
+            *info = -13;
+        else
+            *info = 0;
+
+        HIPBLAS_CHECK_INFO_CAPTURE(info);
+        if(*info < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        GESV_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, __func__, "the refinement synchronizes with the host"));
+
+        return gesv_mixed_solve<T>(handle,
+                                   n,
+                                   nrhs,
+                                   {A},
+                                   lda,
+                                   ipiv,
+                                   n,
+                                   {B},
+                                   ldb,
+                                   {X},
+                                   ldx,
+                                   iter,
+                                   residual,
+                                   deviceInfo);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGesvMixedBatchedTemplate(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    const int       nrhs,
+                                                    const T* const  A[],
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    const T* const  B[],
+                                                    const int       ldb,
+                                                    T* const        X[],
+                                                    const int       ldx,
+                                                    int*            iter,
+                                                    double*         residual,
+                                                    int*            info,
+                                                    int*            deviceInfo,
+                                                    const int       batchCount)
+    {
+        if(info == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        else if(n < 0)
+            *info = -1;
+        else if(nrhs < 0)
+            *info = -2;
+        else if(A == NULL && batchCount)
+            *info = -3;
+        else if(lda < std::max(1, n))
+            *info = -4;
+        else if(ipiv == NULL && n && batchCount)
+            *info = -5;
+        else if(B == NULL && batchCount)
+            *info = -6;
+        else if(ldb < std::max(1, n))
+            *info = -7;
+        else if(X == NULL && batchCount)
+            *info = -8;
+        else if(ldx < std::max(1, n))
+            *info = -9;
+        else if(iter == NULL && batchCount)
+            *info = -10;
+        else if(residual == NULL && batchCount)
+            *info = -11;
+        else if(deviceInfo == NULL && batchCount)
+            *info = -13;
+        else if(batchCount < 0)
+            *info = -14;
+        else
+            *info = 0;
+
+        HIPBLAS_CHECK_INFO_CAPTURE(info);
+        if(*info < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        GESV_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, __func__, "the refinement synchronizes with the host"));
+
+        std::vector<const T*> hA, hB;
+        std::vector<T*>       hX;
+        if(batchCount)
+        {
+            GESV_RETURN_IF_ERROR(gesv_host_pointers(handle, A, batchCount, hA));
+            GESV_RETURN_IF_ERROR(gesv_host_pointers(handle, B, batchCount, hB));
+            GESV_RETURN_IF_ERROR(gesv_host_pointers(handle, X, batchCount, hX));
+        }
+        return gesv_mixed_solve<T>(
+            handle, n, nrhs, hA, lda, ipiv, n, hB, ldb, hX, ldx, iter, residual, deviceInfo);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGesvMixedStridedBatchedTemplate(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           const T*            A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           const T*            B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           T*                  X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           double*             residual,
+                                                           int*                info,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount)
+    {
+        if(info == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        else if(n < 0)
+            *info = -1;
+        else if(nrhs < 0)
+            *info = -2;
+        else if(A == NULL && n)
+            *info = -3;
+        else if(lda < std::max(1, n))
+            *info = -4;
+        else if(ipiv == NULL && n)
+            *info = -6;
+        else if(strideP < n)
+            *info = -7;
+        else if(B == NULL && n && nrhs)
+            *info = -8;
+        else if(ldb < std::max(1, n))
+            *info = -9;
+        else if(X == NULL && n && nrhs)
+            *info = -11;
+        else if(ldx < std::max(1, n))
+            *info = -12;
+        else if(iter == NULL && batchCount)
+            *info = -14;
+        else if(residual == NULL && batchCount)
+            *info = -15;
+        else if(deviceInfo == NULL && batchCount)
+            *info = -17;
+        else if(batchCount < 0)
+            *info = -18;
+        else
+            *info = 0;
+
+        HIPBLAS_CHECK_INFO_CAPTURE(info);
+        if(*info < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        GESV_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, __func__, "the refinement synchronizes with the host"));
+
+        std::vector<const T*> hA(batchCount), hB(batchCount);
+        std::vector<T*>       hX(batchCount);
+        for(int b = 0; b < batchCount; b++)
+        {
+            hA[b] = A + b * strideA;
+            hB[b] = B + b * strideB;
+            hX[b] = X + b * strideX;
+        }
+        return gesv_mixed_solve<T>(
+            handle, n, nrhs, hA, lda, ipiv, strideP, hB, ldb, hX, ldx, iter, residual, deviceInfo);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              const double*   A,
+                              const int       lda,
+                              int*            ipiv,
+                              const double*   B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              double*         residual,
+                              int*            info,
+                              int*            deviceInfo)
+try
+{
+    return hipblasGesvMixedTemplate(handle,
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    B,
+                                    ldb,
+                                    X,
+                                    ldx,
+                                    iter,
+                                    residual,
+                                    info,
+                                    deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                     const int           n,
+                                     const int           nrhs,
+                                     const double* const A[],
+                                     const int           lda,
+                                     int*                ipiv,
+                                     const double* const B[],
+                                     const int           ldb,
+                                     double* const       X[],
+                                     const int           ldx,
+                                     int*                iter,
+                                     double*             residual,
+                                     int*                info,
+                                     int*                deviceInfo,
+                                     const int           batchCount)
+try
+{
+    return hipblasGesvMixedBatchedTemplate(handle,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           lda,
+                                           ipiv,
+                                           B,
+                                           ldb,
+                                           X,
+                                           ldx,
+                                           iter,
+                                           residual,
+                                           info,
+                                           deviceInfo,
+                                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            const double*       A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            const double*       B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            double*             X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            double*             residual,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount)
+try
+{
+    return hipblasGesvMixedStridedBatchedTemplate(handle,
+                                                  n,
+                                                  nrhs,
+                                                  A,
+                                                  lda,
+                                                  strideA,
+                                                  ipiv,
+                                                  strideP,
+                                                  B,
+                                                  ldb,
+                                                  strideB,
+                                                  X,
+                                                  ldx,
+                                                  strideX,
+                                                  iter,
+                                                  residual,
+                                                  info,
+                                                  deviceInfo,
+                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                              const int                   n,
+                              const int                   nrhs,
+                              const hipblasDoubleComplex* A,
+                              const int                   lda,
+                              int*                        ipiv,
+                              const hipblasDoubleComplex* B,
+                              const int                   ldb,
+                              hipblasDoubleComplex*       X,
+                              const int                   ldx,
+                              int*                        iter,
+                              double*                     residual,
+                              int*                        info,
+                              int*                        deviceInfo)
+try
+{
+    return hipblasGesvMixedTemplate(handle,
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    B,
+                                    ldb,
+                                    X,
+                                    ldx,
+                                    iter,
+                                    residual,
+                                    info,
+                                    deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                     const int                         n,
+                                     const int                         nrhs,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda,
+                                     int*                              ipiv,
+                                     const hipblasDoubleComplex* const B[],
+                                     const int                         ldb,
+                                     hipblasDoubleComplex* const       X[],
+                                     const int                         ldx,
+                                     int*                              iter,
+                                     double*                           residual,
+                                     int*                              info,
+                                     int*                              deviceInfo,
+                                     const int                         batchCount)
+try
+{
+    return hipblasGesvMixedBatchedTemplate(handle,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           lda,
+                                           ipiv,
+                                           B,
+                                           ldb,
+                                           X,
+                                           ldx,
+                                           iter,
+                                           residual,
+                                           info,
+                                           deviceInfo,
+                                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            const hipblasDoubleComplex* A,
+                                            const int                   lda,
+                                            const hipblasStride         strideA,
+                                            int*                        ipiv,
+                                            const hipblasStride         strideP,
+                                            const hipblasDoubleComplex* B,
+                                            const int                   ldb,
+                                            const hipblasStride         strideB,
+                                            hipblasDoubleComplex*       X,
+                                            const int                   ldx,
+                                            const hipblasStride         strideX,
+                                            int*                        iter,
+                                            double*                     residual,
+                                            int*                        info,
+                                            int*                        deviceInfo,
+                                            const int                   batchCount)
+try
+{
+    return hipblasGesvMixedStridedBatchedTemplate(handle,
+                                                  n,
+                                                  nrhs,
+                                                  A,
+                                                  lda,
+                                                  strideA,
+                                                  ipiv,
+                                                  strideP,
+                                                  B,
+                                                  ldb,
+                                                  strideB,
+                                                  X,
+                                                  ldx,
+                                                  strideX,
+                                                  iter,
+                                                  residual,
+                                                  info,
+                                                  deviceInfo,
+                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
+
+#endif
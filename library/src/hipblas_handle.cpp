@@ -0,0 +1,667 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "exceptions.hpp"
+#include "packed.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <unordered_map>
+
+namespace
+{
+    std::mutex                                                                 state_map_mutex;
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>> state_map;
+
+    // Number of handles in HIPBLAS_CAPTURE_MODE_SAFE, so that the common case of no
+    // safe handles does not need to look up the handle state
+    std::atomic<int> capture_safe_handles{0};
+
+    // Likewise for HIPBLAS_COMPLEX_GEMM_MODE_3M, which every complex gemm checks
+    std::atomic<int> complex_gemm_3m_handles{0};
+
+    // And for HIPBLAS_PACKED_MODE_UNPACK, which every packed routine checks
+    std::atomic<int> packed_unpack_handles{0};
+
+    // And for HIPBLAS_GEMM_EX_MODE_LT, which every gemm_ex checks
+    std::atomic<int> gemm_ex_lt_handles{0};
+
+    // And for HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, which every growth of the workspace checks
+    std::atomic<int> stream_ordered_handles{0};
+
+    // And for trim policies, which every call which may grow the workspace checks
+    std::atomic<int> trim_policy_handles{0};
+
+    // Calls made while the stream of a handle in HIPBLAS_CAPTURE_MODE_DEFAULT is being captured
+    // are only recorded when HIPBLAS_CAPTURE_DIAGNOSTIC is set, as checking costs a query of the
+    // stream on every call
+    bool capture_diagnostic_requested()
+    {
+        static const bool requested = [] {
+            const char* env = getenv("HIPBLAS_CAPTURE_DIAGNOSTIC");
+            return env && strtol(env, nullptr, 10) != 0;
+        }();
+        return requested;
+    }
+
+    bool trim_policy_set(const hipblasWorkspaceTrimPolicy_t& policy)
+    {
+        return policy.callCount || policy.idleMs;
+    }
+}
+
+hipblasDeviceScratch::~hipblasDeviceScratch()
+{
+    (void)hipFree(data);
+}
+
+hipblasStatus_t hipblasDeviceScratch::reserve(size_t bytes)
+{
+    if(size >= bytes)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    (void)hipFree(data);
+    data = nullptr;
+    size = 0;
+    if(hipMalloc(&data, bytes) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    size = bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+bool hipblasStreamIsCapturing(hipblasHandle_t handle)
+{
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return false;
+    return capture_status != hipStreamCaptureStatusNone;
+}
+
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(state_map_mutex);
+
+    auto& state = state_map[handle];
+    if(!state)
+        state = std::make_unique<hipblasHandleState>();
+    return state.get();
+}
+
+hipblasHandleState* hipblasFindHandleState(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(state_map_mutex);
+
+    auto it = state_map.find(handle);
+    return it == state_map.end() ? nullptr : it->second.get();
+}
+
+void hipblasReleaseHandleState(hipblasHandle_t handle)
+{
+    std::unique_ptr<hipblasHandleState> state;
+    {
+        std::lock_guard<std::mutex> lock(state_map_mutex);
+
+        auto it = state_map.find(handle);
+        if(it == state_map.end())
+            return;
+        if(it->second->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            capture_safe_handles--;
+        if(it->second->complex_gemm_mode == HIPBLAS_COMPLEX_GEMM_MODE_3M)
+            complex_gemm_3m_handles--;
+        if(it->second->packed_mode == HIPBLAS_PACKED_MODE_UNPACK)
+            packed_unpack_handles--;
+        if(it->second->gemm_ex_mode == HIPBLAS_GEMM_EX_MODE_LT)
+            gemm_ex_lt_handles--;
+        if(it->second->workspace_alloc_mode == HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED)
+            stream_ordered_handles--;
+        if(trim_policy_set(it->second->trim_policy))
+            trim_policy_handles--;
+        state = std::move(it->second);
+        state_map.erase(it);
+    }
+
+    // Destroyed with the map unlocked, as destroying the handles of the batch streams releases
+    // their own states
+}
+
+bool hipblasIsCaptureSafe(hipblasHandle_t handle)
+{
+    if(!capture_safe_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE;
+}
+
+hipblasStatus_t
+    hipblasCheckCapture(hipblasHandle_t handle, const char* func, const char* reason, ...)
+{
+    // The common case: nothing to reject and nothing to record
+    if(!capture_safe_handles && !capture_diagnostic_requested())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool safe = hipblasIsCaptureSafe(handle);
+    if(!safe && (!capture_diagnostic_requested() || !hipblasStreamIsCapturing(handle)))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->capture_diagnostic.empty())
+    {
+        char    message[256];
+        va_list args;
+        va_start(args, reason);
+        vsnprintf(message, sizeof(message), reason, args);
+        va_end(args);
+        state->capture_diagnostic = std::string(func) + ": " + message;
+    }
+
+    return safe ? HIPBLAS_STATUS_NOT_SUPPORTED : HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasCheckHostResultCapture(hipblasHandle_t handle, const char* func)
+{
+    if(!capture_safe_handles && !capture_diagnostic_requested())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t mode;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || mode != HIPBLAS_POINTER_MODE_HOST)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    return hipblasCheckCapture(
+        handle, func, "result is copied to host memory in HIPBLAS_POINTER_MODE_HOST");
+}
+
+extern "C" hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasIsCaptureSafe(handle) ? HIPBLAS_CAPTURE_MODE_SAFE : HIPBLAS_CAPTURE_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetCaptureDiagnostic(hipblasHandle_t handle,
+                                                       const char**    message)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(message == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    *message = state->capture_diagnostic.c_str();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// Shared part of hipblasSetCaptureMode; the backends pin their workspace before calling this
+hipblasStatus_t hipblasSetHandleCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+{
+    if(mode != HIPBLAS_CAPTURE_MODE_DEFAULT && mode != HIPBLAS_CAPTURE_MODE_SAFE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->capture_mode != mode)
+    {
+        if(mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            capture_safe_handles++;
+        else
+            capture_safe_handles--;
+    }
+    state->capture_mode = mode;
+    state->capture_diagnostic.clear();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+bool hipblasIsComplexGemm3m(hipblasHandle_t handle)
+{
+    if(!complex_gemm_3m_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->complex_gemm_mode == HIPBLAS_COMPLEX_GEMM_MODE_3M;
+}
+
+extern "C" hipblasStatus_t hipblasSetComplexGemmMode(hipblasHandle_t          handle,
+                                                     hipblasComplexGemmMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_COMPLEX_GEMM_MODE_DEFAULT && mode != HIPBLAS_COMPLEX_GEMM_MODE_3M)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->complex_gemm_mode != mode)
+    {
+        if(mode == HIPBLAS_COMPLEX_GEMM_MODE_3M)
+            complex_gemm_3m_handles++;
+        else
+            complex_gemm_3m_handles--;
+    }
+    state->complex_gemm_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetComplexGemmMode(hipblasHandle_t           handle,
+                                                     hipblasComplexGemmMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasIsComplexGemm3m(handle) ? HIPBLAS_COMPLEX_GEMM_MODE_3M
+                                           : HIPBLAS_COMPLEX_GEMM_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+bool hipblasIsPackedUnpack(hipblasHandle_t handle)
+{
+    if(!packed_unpack_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->packed_mode == HIPBLAS_PACKED_MODE_UNPACK;
+}
+
+extern "C" hipblasStatus_t hipblasSetPackedMode(hipblasHandle_t handle, hipblasPackedMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_PACKED_MODE_DEFAULT && mode != HIPBLAS_PACKED_MODE_UNPACK)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // The mode is offered only where the backend unpacks AP in one call
+    if(mode == HIPBLAS_PACKED_MODE_UNPACK
+       && hipblasPackedConvertBackend(
+              handle, true, HIPBLAS_FILL_MODE_UPPER, 0, sizeof(float), nullptr, nullptr, 1)
+              == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->packed_mode != mode)
+    {
+        if(mode == HIPBLAS_PACKED_MODE_UNPACK)
+            packed_unpack_handles++;
+        else
+            packed_unpack_handles--;
+    }
+    state->packed_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetPackedMode(hipblasHandle_t handle, hipblasPackedMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode
+        = hipblasIsPackedUnpack(handle) ? HIPBLAS_PACKED_MODE_UNPACK : HIPBLAS_PACKED_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+bool hipblasIsGemmExLt(hipblasHandle_t handle)
+{
+    if(!gemm_ex_lt_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->gemm_ex_mode == HIPBLAS_GEMM_EX_MODE_LT;
+}
+
+extern "C" hipblasStatus_t hipblasSetGemmExMode(hipblasHandle_t handle, hipblasGemmExMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_EX_MODE_DEFAULT && mode != HIPBLAS_GEMM_EX_MODE_LT)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->gemm_ex_mode != mode)
+    {
+        if(mode == HIPBLAS_GEMM_EX_MODE_LT)
+            gemm_ex_lt_handles++;
+        else
+            gemm_ex_lt_handles--;
+    }
+    state->gemm_ex_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetGemmExMode(hipblasHandle_t handle, hipblasGemmExMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasIsGemmExLt(handle) ? HIPBLAS_GEMM_EX_MODE_LT : HIPBLAS_GEMM_EX_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+bool hipblasIsWorkspaceStreamOrdered(hipblasHandle_t handle)
+{
+    if(!stream_ordered_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->workspace_alloc_mode == HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED;
+}
+
+extern "C" hipblasStatus_t hipblasSetWorkspaceAllocMode(hipblasHandle_t             handle,
+                                                        hipblasWorkspaceAllocMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_WORKSPACE_ALLOC_DEFAULT && mode != HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->workspace_alloc_mode != mode)
+    {
+        if(mode == HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED)
+            stream_ordered_handles++;
+        else
+            stream_ordered_handles--;
+    }
+    state->workspace_alloc_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetWorkspaceAllocMode(hipblasHandle_t              handle,
+                                                        hipblasWorkspaceAllocMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasIsWorkspaceStreamOrdered(handle) ? HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED
+                                                    : HIPBLAS_WORKSPACE_ALLOC_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+bool hipblasWorkspaceTrimDue(hipblasHandle_t handle, size_t used_bytes, size_t* target_bytes)
+{
+    if(!trim_policy_handles)
+        return false;
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        const hipblasWorkspaceTrimPolicy_t& policy = state->trim_policy;
+        if(!trim_policy_set(policy))
+            return false;
+
+        // A call which grew the workspace, or needed more than the target, starts the count again
+        auto now = std::chrono::steady_clock::now();
+        if(state->trim_growths != state->workspace_growths || used_bytes > policy.targetBytes)
+        {
+            state->trim_growths = state->workspace_growths;
+            state->trim_calls   = 0;
+            state->trim_since   = now;
+            return false;
+        }
+
+        state->trim_calls++;
+        bool calls_due = policy.callCount && state->trim_calls >= policy.callCount;
+        bool idle_due
+            = policy.idleMs && now - state->trim_since >= std::chrono::milliseconds(policy.idleMs);
+        if(!calls_due && !idle_due)
+            return false;
+
+        state->trim_calls = 0;
+        state->trim_since = now;
+        *target_bytes     = policy.targetBytes;
+    }
+    return !hipblasIsCaptureSafe(handle) && !hipblasStreamIsCapturing(handle);
+}
+
+extern "C" hipblasStatus_t hipblasSetWorkspaceTrimPolicy(hipblasHandle_t                     handle,
+                                                         const hipblasWorkspaceTrimPolicy_t* policy)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasWorkspaceTrimPolicy_t new_policy = {};
+    if(policy)
+        new_policy = *policy;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(trim_policy_set(state->trim_policy) != trim_policy_set(new_policy))
+    {
+        if(trim_policy_set(new_policy))
+            trim_policy_handles++;
+        else
+            trim_policy_handles--;
+    }
+    state->trim_policy  = new_policy;
+    state->trim_calls   = 0;
+    state->trim_growths = state->workspace_growths;
+    state->trim_since   = std::chrono::steady_clock::now();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetWorkspaceTrimPolicy(hipblasHandle_t               handle,
+                                                         hipblasWorkspaceTrimPolicy_t* policy)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(policy == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *policy = {};
+
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(state)
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        *policy = state->trim_policy;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+void hipblasRecordWorkspaceAlloc(hipblasHandle_t handle,
+                                 size_t          bytes,
+                                 double          alloc_us,
+                                 bool            growth)
+{
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->peak_workspace_size = std::max(state->peak_workspace_size, bytes);
+    state->workspace_alloc_us += alloc_us;
+    if(growth)
+        state->workspace_growths++;
+}
+
+hipblasStatus_t hipblasGetHandleMemoryStats(hipblasHandle_t       handle,
+                                            size_t                workspace_size,
+                                            hipblasMemoryStats_t* stats)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->peak_workspace_size = std::max(state->peak_workspace_size, workspace_size);
+
+        stats->workspaceBytes     = workspace_size;
+        stats->peakWorkspaceBytes = state->peak_workspace_size;
+        stats->growthCount        = state->workspace_growths;
+        stats->allocTimeUs        = state->workspace_alloc_us;
+    }
+
+    // Taken one at a time, as the trsm cache and the deferred rank updates are locked while calls
+    // which take the state mutex are made
+    stats->scratchBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(state->trsm_cache.mutex);
+        stats->scratchBytes += state->trsm_cache.bytes + state->trsm_cache.scratch_size;
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->rank_updates.mutex);
+        stats->scratchBytes += state->rank_updates.vectors_size;
+    }
+    for(hipblasDeviceScratch* scratch : {&state->gemm_3m_scratch,
+                                         &state->gemm_fp8_scratch,
+                                         &state->gemm_epilogue_scratch,
+                                         &state->packed_scratch,
+                                         &state->vbatched_scratch,
+                                         &state->segmented_scratch})
+    {
+        std::lock_guard<std::mutex> lock(scratch->mutex);
+        stats->scratchBytes += scratch->size;
+    }
+
+    // The handles of the batch streams hold memory on behalf of this one
+    std::lock_guard<std::mutex> lock(state->batch_streams.mutex);
+    for(hipblasHandle_t sub_handle : state->batch_streams.handles)
+    {
+        hipblasMemoryStats_t sub_stats;
+        hipblasStatus_t      status = hipblasGetMemoryStats(sub_handle, &sub_stats);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        stats->workspaceBytes += sub_stats.workspaceBytes;
+        stats->peakWorkspaceBytes += sub_stats.peakWorkspaceBytes;
+        stats->scratchBytes += sub_stats.scratchBytes;
+        stats->growthCount += sub_stats.growthCount;
+        stats->allocTimeUs += sub_stats.allocTimeUs;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblasResetHandleMemoryStats(hipblasHandle_t handle, size_t workspace_size)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->peak_workspace_size = workspace_size;
+        state->workspace_growths   = 0;
+        state->workspace_alloc_us  = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(state->batch_streams.mutex);
+    for(hipblasHandle_t sub_handle : state->batch_streams.handles)
+        (void)hipblasResetMemoryStats(sub_handle);
+}
@@ -0,0 +1,19910 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include "ilp64_backend.hpp"
+#include "xt_backend.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+// The _64 functions take 64-bit sizes, increments and batch counts. They are made through the
+// native _64 API of the backend where it has one. Otherwise calls whose arguments fit in int are
+// forwarded to the int API unchanged, and larger ones are split into int-sized calls. Leading
+// dimensions and increments which do not fit in int cannot be split and are not supported.
+// Besides the level 1 functions, gemv, gemm, the banded gbmv, tbmv and tbsv, left-sided trsm and
+// trmm, and syrk and herk split their sizes; other level 2 and 3 functions split only their batch
+// counts.
+
+// Returns the result of a call through the native _64 API, unless the backend has none or the
+// tests are running the split paths
+#define ILP64_NATIVE(status__)                                          \
+    do                                                                  \
+    {                                                                   \
+        if(ilp64_chunk() == std::numeric_limits<int>::max())            \
+        {                                                               \
+            hipblasStatus_t native_status__ = (status__);               \
+            if(native_status__ != HIPBLAS_STATUS_NOT_SUPPORTED)         \
+                return native_status__;                                 \
+        }                                                               \
+    } while(0)
+
+namespace
+{
+    // Largest size passed to the int API in one call. Lowered only by the tests, through the
+    // environment variable HIPBLAS_ILP64_CHUNK_SIZE, so that the split paths run on problems
+    // which fit in memory; it is read on each call, so that a test can change it between calls.
+    int64_t ilp64_chunk()
+    {
+        const char* env   = getenv("HIPBLAS_ILP64_CHUNK_SIZE");
+        int64_t     chunk = env ? strtoll(env, nullptr, 10) : 0;
+        return chunk > 0 && chunk < std::numeric_limits<int>::max()
+                   ? chunk
+                   : std::numeric_limits<int>::max();
+    }
+
+    // Returns true if a call with these sizes is made whole. Negative values are passed on for
+    // the int API to report.
+    bool ilp64_fits(std::initializer_list<int64_t> values)
+    {
+        int64_t chunk = ilp64_chunk();
+        for(int64_t value : values)
+            if(value < std::numeric_limits<int>::min() || value > chunk)
+                return false;
+        return true;
+    }
+
+    // Returns true if the values, such as leading dimensions and increments, which are never
+    // split, can be passed to the int API
+    bool ilp64_is_int(std::initializer_list<int64_t> values)
+    {
+        for(int64_t value : values)
+            if(value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+                return false;
+        return true;
+    }
+
+    // Offset in memory of the first of elements [start, start + len) of a vector of n elements;
+    // with a negative increment element 0 is the last one in memory
+    int64_t ilp64_offset(int64_t n, int64_t inc, int64_t start, int64_t len)
+    {
+        return inc >= 0 ? start * inc : (n - start - len) * -inc;
+    }
+
+    // Calls fn(len, offset_x, offset_y) for int-sized chunks of two vectors of n elements
+    template <typename F>
+    hipblasStatus_t ilp64_chunks(int64_t n, int64_t incx, int64_t incy, F fn)
+    {
+        int64_t chunk = ilp64_chunk();
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int64_t         len    = std::min(chunk, n - start);
+            hipblasStatus_t status = fn(
+                int(len), ilp64_offset(n, incx, start, len), ilp64_offset(n, incy, start, len));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Calls fn(first, count) for int-sized parts of a batch
+    template <typename F>
+    hipblasStatus_t ilp64_batches(int64_t batch_count, F fn)
+    {
+        if(ilp64_fits({batch_count}))
+            return fn(0, int(batch_count));
+        int64_t chunk = ilp64_chunk();
+        for(int64_t first = 0; first < batch_count; first += chunk)
+        {
+            hipblasStatus_t status = fn(first, int(std::min(chunk, batch_count - first)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Calls fn(b) for each item of a batch whose sizes do not fit in int
+    template <typename F>
+    hipblasStatus_t ilp64_items(int64_t batch_count, F fn)
+    {
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        for(int64_t b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = fn(b);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t ilp64_synchronize(hipblasHandle_t handle)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipStreamSynchronize(stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                          : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Copies an array of device pointers to the host, for batches processed one item at a time
+    template <typename T>
+    hipblasStatus_t ilp64_host_pointers(hipblasHandle_t  handle,
+                                        const char*      func,
+                                        T* const         x[],
+                                        int64_t          batch_count,
+                                        std::vector<T*>& host)
+    {
+        hipblasStatus_t status
+            = hipblasCheckCapture(handle, func, "batch pointers are copied to the host");
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_synchronize(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS || batch_count <= 0)
+            return status;
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        host.resize(batch_count);
+        if(hipMemcpy(host.data(), x, sizeof(T*) * batch_count, hipMemcpyDeviceToHost) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Reads a scalar argument given in the caller's pointer mode
+    template <typename T>
+    hipblasStatus_t ilp64_host_scalar(hipblasHandle_t      handle,
+                                      const char*          func,
+                                      hipblasPointerMode_t mode,
+                                      const T*             scalar,
+                                      T&                   host)
+    {
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            host = *scalar;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t status
+            = hipblasCheckCapture(handle, func, "scalars are copied to the host to split the call");
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_synchronize(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipMemcpy(&host, scalar, sizeof(T), hipMemcpyDeviceToHost) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Stores count results computed on the host in the caller's pointer mode
+    template <typename T>
+    hipblasStatus_t
+        ilp64_store(hipblasPointerMode_t mode, T* result, const T* values, int64_t count)
+    {
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            std::copy(values, values + count, result);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        return hipMemcpy(result, values, sizeof(T) * count, hipMemcpyHostToDevice) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Conversions between the hipBLAS types and their host types, through the real and
+    // imaginary parts of the complex ones
+    template <typename T>
+    T ilp64_host_value(T value)
+    {
+        return value;
+    }
+
+    inline std::complex<float> ilp64_host_value(const hipblasComplex& value)
+    {
+        return std::complex<float>(value.real(), value.imag());
+    }
+
+    inline std::complex<double> ilp64_host_value(const hipblasDoubleComplex& value)
+    {
+        return std::complex<double>(value.real(), value.imag());
+    }
+
+    template <typename R, typename H>
+    R ilp64_from_host(H value)
+    {
+        return R(value);
+    }
+
+    template <typename R, typename H>
+    R ilp64_from_host(std::complex<H> value)
+    {
+        return R(value.real(), value.imag());
+    }
+
+    // The magnitude used by iamax and iamin
+    template <typename T>
+    T ilp64_abs1(T value)
+    {
+        return std::abs(value);
+    }
+
+    template <typename T>
+    T ilp64_abs1(std::complex<T> value)
+    {
+        return std::abs(value.real()) + std::abs(value.imag());
+    }
+
+    // Reduces int-sized chunks of two vectors on the host: part(len, offset_x, offset_y, &value)
+    // computes the result of one chunk and combine accumulates it
+    template <typename R, typename P, typename C>
+    hipblasStatus_t ilp64_reduce(hipblasHandle_t handle,
+                                 int64_t         n,
+                                 int64_t         incx,
+                                 int64_t         incy,
+                                 R*              result,
+                                 P               part,
+                                 C               combine)
+    {
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasHostPointerModeGuard     host_mode(handle);
+        typename hipblasXtType<R>::host value(0);
+        hipblasStatus_t                 status
+            = ilp64_chunks(n, incx, incy, [&](int len, int64_t offset_x, int64_t offset_y) {
+                  R               chunk_value;
+                  hipblasStatus_t status = part(len, offset_x, offset_y, &chunk_value);
+                  if(status == HIPBLAS_STATUS_SUCCESS)
+                      value = combine(value, ilp64_host_value(chunk_value));
+                  return status;
+              });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        R stored = ilp64_from_host<R>(value);
+        return ilp64_store(host_mode.mode(), result, &stored, 1);
+    }
+
+    /*
+     * ===========================================================================
+     *    level 1 BLAS
+     * ===========================================================================
+     */
+
+    // scal
+    template <typename Fn, typename T, typename U>
+    hipblasStatus_t hipblasScal64Template(
+        Fn fn, hipblasHandle_t handle, int64_t n, const U* alpha, T* x, int64_t incx)
+    {
+        if(ilp64_fits({n, incx}))
+            return fn(handle, int(n), alpha, x, int(incx));
+        if(!ilp64_is_int({incx}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return ilp64_chunks(n, incx, incx, [&](int len, int64_t offset_x, int64_t) {
+            return fn(handle, len, alpha, x + offset_x, int(incx));
+        });
+    }
+
+    template <typename Fn, typename FnBatched, typename T, typename U>
+    hipblasStatus_t hipblasScalBatched64Template(Fn              fn,
+                                                 FnBatched       fn_batched,
+                                                 hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 const U*        alpha,
+                                                 T* const        x[],
+                                                 int64_t         incx,
+                                                 int64_t         batch_count)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle, int(n), alpha, x + first, int(incx), count);
+            });
+
+        std::vector<T*> hx;
+        hipblasStatus_t status
+            = ilp64_host_pointers(handle, "hipblasXscalBatched_64", x, batch_count, hx);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasScal64Template(fn, handle, n, alpha, hx[b], incx);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T, typename U>
+    hipblasStatus_t hipblasScalStridedBatched64Template(Fn              fn,
+                                                        FnStrided       fn_strided,
+                                                        hipblasHandle_t handle,
+                                                        int64_t         n,
+                                                        const U*        alpha,
+                                                        T*              x,
+                                                        int64_t         incx,
+                                                        hipblasStride   stridex,
+                                                        int64_t         batch_count)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(
+                    handle, int(n), alpha, x + first * stridex, int(incx), stridex, count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasScal64Template(fn, handle, n, alpha, x + b * stridex, incx);
+        });
+    }
+
+    // axpy, copy, swap and rot: elementwise on two vectors. call(fn, len, x, y) makes the int
+    // call on one chunk, passing any scalars along.
+    template <typename Fn, typename Tx, typename Ty, typename Call>
+    hipblasStatus_t ilp64_xy(Fn              fn,
+                             hipblasHandle_t handle,
+                             int64_t         n,
+                             Tx*             x,
+                             int64_t         incx,
+                             Ty*             y,
+                             int64_t         incy,
+                             Call            call)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return call(fn, int(n), x, y);
+        if(!ilp64_is_int({incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return ilp64_chunks(n, incx, incy, [&](int len, int64_t offset_x, int64_t offset_y) {
+            return call(fn, len, x + offset_x, y + offset_y);
+        });
+    }
+
+    template <typename Fn,
+              typename FnBatched,
+              typename Tx,
+              typename Ty,
+              typename Call,
+              typename CallBatched>
+    hipblasStatus_t ilp64_xy_batched(Fn              fn,
+                                     FnBatched       fn_batched,
+                                     hipblasHandle_t handle,
+                                     const char*     func,
+                                     int64_t         n,
+                                     Tx* const       x[],
+                                     int64_t         incx,
+                                     Ty* const       y[],
+                                     int64_t         incy,
+                                     int64_t         batch_count,
+                                     Call            call,
+                                     CallBatched     call_batched)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return call_batched(fn_batched, x + first, y + first, count);
+            });
+
+        std::vector<Tx*> hx;
+        std::vector<Ty*> hy;
+        hipblasStatus_t  status = ilp64_host_pointers(handle, func, x, batch_count, hx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, func, y, batch_count, hy);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return ilp64_xy(fn, handle, n, hx[b], incx, hy[b], incy, call);
+        });
+    }
+
+    template <typename Fn,
+              typename FnStrided,
+              typename Tx,
+              typename Ty,
+              typename Call,
+              typename CallStrided>
+    hipblasStatus_t ilp64_xy_strided_batched(Fn              fn,
+                                             FnStrided       fn_strided,
+                                             hipblasHandle_t handle,
+                                             int64_t         n,
+                                             Tx*             x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             Ty*             y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batch_count,
+                                             Call            call,
+                                             CallStrided     call_strided)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return call_strided(fn_strided, x + first * stridex, y + first * stridey, count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return ilp64_xy(fn, handle, n, x + b * stridex, incx, y + b * stridey, incy, call);
+        });
+    }
+
+    // axpy
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasAxpy64Template(Fn              fn,
+                                          hipblasHandle_t handle,
+                                          int64_t         n,
+                                          const T*        alpha,
+                                          const T*        x,
+                                          int64_t         incx,
+                                          T*              y,
+                                          int64_t         incy)
+    {
+        return ilp64_xy(fn, handle, n, x, incx, y, incy, [&](Fn fn, int len, const T* x, T* y) {
+            return fn(handle, len, alpha, x, int(incx), y, int(incy));
+        });
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasAxpyBatched64Template(Fn              fn,
+                                                 FnBatched       fn_batched,
+                                                 hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 const T*        alpha,
+                                                 const T* const  x[],
+                                                 int64_t         incx,
+                                                 T* const        y[],
+                                                 int64_t         incy,
+                                                 int64_t         batch_count)
+    {
+        return ilp64_xy_batched(
+            fn,
+            fn_batched,
+            handle,
+            "hipblasXaxpyBatched_64",
+            n,
+            x,
+            incx,
+            y,
+            incy,
+            batch_count,
+            [&](Fn fn, int len, const T* x, T* y) {
+                return fn(handle, len, alpha, x, int(incx), y, int(incy));
+            },
+            [&](FnBatched fn, const T* const* x, T* const* y, int count) {
+                return fn(handle, int(n), alpha, x, int(incx), y, int(incy), count);
+            });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasAxpyStridedBatched64Template(Fn              fn,
+                                                        FnStrided       fn_strided,
+                                                        hipblasHandle_t handle,
+                                                        int64_t         n,
+                                                        const T*        alpha,
+                                                        const T*        x,
+                                                        int64_t         incx,
+                                                        hipblasStride   stridex,
+                                                        T*              y,
+                                                        int64_t         incy,
+                                                        hipblasStride   stridey,
+                                                        int64_t         batch_count)
+    {
+        return ilp64_xy_strided_batched(
+            fn,
+            fn_strided,
+            handle,
+            n,
+            x,
+            incx,
+            stridex,
+            y,
+            incy,
+            stridey,
+            batch_count,
+            [&](Fn fn, int len, const T* x, T* y) {
+                return fn(handle, len, alpha, x, int(incx), y, int(incy));
+            },
+            [&](FnStrided fn, const T* x, T* y, int count) {
+                return fn(
+                    handle, int(n), alpha, x, int(incx), stridex, y, int(incy), stridey, count);
+            });
+    }
+
+    // copy and swap
+    template <typename Fn, typename Tx, typename Ty>
+    hipblasStatus_t hipblasCopySwap64Template(
+        Fn fn, hipblasHandle_t handle, int64_t n, Tx* x, int64_t incx, Ty* y, int64_t incy)
+    {
+        return ilp64_xy(fn, handle, n, x, incx, y, incy, [&](Fn fn, int len, Tx* x, Ty* y) {
+            return fn(handle, len, x, int(incx), y, int(incy));
+        });
+    }
+
+    template <bool Swap, typename Fn, typename FnBatched, typename Tx, typename Ty>
+    hipblasStatus_t hipblasCopySwapBatched64Template(Fn              fn,
+                                                     FnBatched       fn_batched,
+                                                     hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     Tx* const       x[],
+                                                     int64_t         incx,
+                                                     Ty* const       y[],
+                                                     int64_t         incy,
+                                                     int64_t         batch_count)
+    {
+        return ilp64_xy_batched(
+            fn,
+            fn_batched,
+            handle,
+            Swap ? "hipblasXswapBatched_64" : "hipblasXcopyBatched_64",
+            n,
+            x,
+            incx,
+            y,
+            incy,
+            batch_count,
+            [&](Fn fn, int len, Tx* x, Ty* y) {
+                return fn(handle, len, x, int(incx), y, int(incy));
+            },
+            [&](FnBatched fn, Tx* const* x, Ty* const* y, int count) {
+                return fn(handle, int(n), x, int(incx), y, int(incy), count);
+            });
+    }
+
+    template <typename Fn, typename FnStrided, typename Tx, typename Ty>
+    hipblasStatus_t hipblasCopySwapStridedBatched64Template(Fn              fn,
+                                                            FnStrided       fn_strided,
+                                                            hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            Tx*             x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            Ty*             y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batch_count)
+    {
+        return ilp64_xy_strided_batched(
+            fn,
+            fn_strided,
+            handle,
+            n,
+            x,
+            incx,
+            stridex,
+            y,
+            incy,
+            stridey,
+            batch_count,
+            [&](Fn fn, int len, Tx* x, Ty* y) {
+                return fn(handle, len, x, int(incx), y, int(incy));
+            },
+            [&](FnStrided fn, Tx* x, Ty* y, int count) {
+                return fn(handle, int(n), x, int(incx), stridex, y, int(incy), stridey, count);
+            });
+    }
+
+    // rot
+    template <typename Fn, typename T, typename U, typename V>
+    hipblasStatus_t hipblasRot64Template(Fn              fn,
+                                         hipblasHandle_t handle,
+                                         int64_t         n,
+                                         T*              x,
+                                         int64_t         incx,
+                                         T*              y,
+                                         int64_t         incy,
+                                         const U*        c,
+                                         const V*        s)
+    {
+        return ilp64_xy(fn, handle, n, x, incx, y, incy, [&](Fn fn, int len, T* x, T* y) {
+            return fn(handle, len, x, int(incx), y, int(incy), c, s);
+        });
+    }
+
+    template <typename Fn, typename FnBatched, typename T, typename U, typename V>
+    hipblasStatus_t hipblasRotBatched64Template(Fn              fn,
+                                                FnBatched       fn_batched,
+                                                hipblasHandle_t handle,
+                                                int64_t         n,
+                                                T* const        x[],
+                                                int64_t         incx,
+                                                T* const        y[],
+                                                int64_t         incy,
+                                                const U*        c,
+                                                const V*        s,
+                                                int64_t         batch_count)
+    {
+        return ilp64_xy_batched(
+            fn,
+            fn_batched,
+            handle,
+            "hipblasXrotBatched_64",
+            n,
+            x,
+            incx,
+            y,
+            incy,
+            batch_count,
+            [&](Fn fn, int len, T* x, T* y) {
+                return fn(handle, len, x, int(incx), y, int(incy), c, s);
+            },
+            [&](FnBatched fn, T* const* x, T* const* y, int count) {
+                return fn(handle, int(n), x, int(incx), y, int(incy), c, s, count);
+            });
+    }
+
+    template <typename Fn, typename FnStrided, typename T, typename U, typename V>
+    hipblasStatus_t hipblasRotStridedBatched64Template(Fn              fn,
+                                                       FnStrided       fn_strided,
+                                                       hipblasHandle_t handle,
+                                                       int64_t         n,
+                                                       T*              x,
+                                                       int64_t         incx,
+                                                       hipblasStride   stridex,
+                                                       T*              y,
+                                                       int64_t         incy,
+                                                       hipblasStride   stridey,
+                                                       const U*        c,
+                                                       const V*        s,
+                                                       int64_t         batch_count)
+    {
+        return ilp64_xy_strided_batched(
+            fn,
+            fn_strided,
+            handle,
+            n,
+            x,
+            incx,
+            stridex,
+            y,
+            incy,
+            stridey,
+            batch_count,
+            [&](Fn fn, int len, T* x, T* y) {
+                return fn(handle, len, x, int(incx), y, int(incy), c, s);
+            },
+            [&](FnStrided fn, T* x, T* y, int count) {
+                return fn(
+                    handle, int(n), x, int(incx), stridex, y, int(incy), stridey, c, s, count);
+            });
+    }
+
+    // dot
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasDot64Template(Fn              fn,
+                                         hipblasHandle_t handle,
+                                         int64_t         n,
+                                         const T*        x,
+                                         int64_t         incx,
+                                         const T*        y,
+                                         int64_t         incy,
+                                         T*              result)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return fn(handle, int(n), x, int(incx), y, int(incy), result);
+        if(!ilp64_is_int({incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return ilp64_reduce(
+            handle,
+            n,
+            incx,
+            incy,
+            result,
+            [&](int len, int64_t offset_x, int64_t offset_y, T* value) {
+                return fn(handle, len, x + offset_x, int(incx), y + offset_y, int(incy), value);
+            },
+            [](auto sum, auto value) { return sum + value; });
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasDotBatched64Template(Fn              fn,
+                                                FnBatched       fn_batched,
+                                                hipblasHandle_t handle,
+                                                int64_t         n,
+                                                const T* const  x[],
+                                                int64_t         incx,
+                                                const T* const  y[],
+                                                int64_t         incy,
+                                                int64_t         batch_count,
+                                                T*              result)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  int(n),
+                                  x + first,
+                                  int(incx),
+                                  y + first,
+                                  int(incy),
+                                  count,
+                                  result + first);
+            });
+
+        std::vector<const T*> hx, hy;
+        hipblasStatus_t status
+            = ilp64_host_pointers(handle, "hipblasXdotBatched_64", x, batch_count, hx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXdotBatched_64", y, batch_count, hy);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasDot64Template(fn, handle, n, hx[b], incx, hy[b], incy, result + b);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasDotStridedBatched64Template(Fn              fn,
+                                                       FnStrided       fn_strided,
+                                                       hipblasHandle_t handle,
+                                                       int64_t         n,
+                                                       const T*        x,
+                                                       int64_t         incx,
+                                                       hipblasStride   stridex,
+                                                       const T*        y,
+                                                       int64_t         incy,
+                                                       hipblasStride   stridey,
+                                                       int64_t         batch_count,
+                                                       T*              result)
+    {
+        if(ilp64_fits({n, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  int(n),
+                                  x + first * stridex,
+                                  int(incx),
+                                  stridex,
+                                  y + first * stridey,
+                                  int(incy),
+                                  stridey,
+                                  count,
+                                  result + first);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasDot64Template(
+                fn, handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+        });
+    }
+
+    // asum and nrm2, whose partial results are summed and combined with hypot respectively
+    template <bool Nrm2, typename Fn, typename T, typename R>
+    hipblasStatus_t hipblasAsumNrm264Template(
+        Fn fn, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, R* result)
+    {
+        if(ilp64_fits({n, incx}))
+            return fn(handle, int(n), x, int(incx), result);
+        if(!ilp64_is_int({incx}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return ilp64_reduce(
+            handle,
+            n,
+            incx,
+            incx,
+            result,
+            [&](int len, int64_t offset_x, int64_t, R* value) {
+                return fn(handle, len, x + offset_x, int(incx), value);
+            },
+            [](R total, R value) { return Nrm2 ? std::hypot(total, value) : total + value; });
+    }
+
+    template <bool Nrm2, typename Fn, typename FnBatched, typename T, typename R>
+    hipblasStatus_t hipblasAsumNrm2Batched64Template(Fn              fn,
+                                                     FnBatched       fn_batched,
+                                                     hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const T* const  x[],
+                                                     int64_t         incx,
+                                                     int64_t         batch_count,
+                                                     R*              result)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle, int(n), x + first, int(incx), count, result + first);
+            });
+
+        std::vector<const T*> hx;
+        hipblasStatus_t       status = ilp64_host_pointers(
+            handle, Nrm2 ? "hipblasXnrm2Batched_64" : "hipblasXasumBatched_64", x, batch_count, hx);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasAsumNrm264Template<Nrm2>(fn, handle, n, hx[b], incx, result + b);
+        });
+    }
+
+    template <bool Nrm2, typename Fn, typename FnStrided, typename T, typename R>
+    hipblasStatus_t hipblasAsumNrm2StridedBatched64Template(Fn              fn,
+                                                            FnStrided       fn_strided,
+                                                            hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const T*        x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            int64_t         batch_count,
+                                                            R*              result)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(
+                    handle, int(n), x + first * stridex, int(incx), stridex, count, result + first);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasAsumNrm264Template<Nrm2>(
+                fn, handle, n, x + b * stridex, incx, result + b);
+        });
+    }
+
+    // iamax and iamin. The int API returns int indices, which are widened on the host.
+    template <bool Max, typename Fn, typename T>
+    hipblasStatus_t hipblasIamaxIamin64Template(
+        Fn fn, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result)
+    {
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(ilp64_fits({n, incx}))
+        {
+            hipblasPointerMode_t mode;
+            hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                int index = 0;
+                status    = fn(handle, int(n), x, int(incx), &index);
+                *result   = index;
+                return status;
+            }
+
+            // The index is never negative, so on the little-endian devices writing it to the low
+            // half of a zeroed int64_t widens it without a round trip through the host
+            hipStream_t stream;
+            status = hipblasGetStream(handle, &stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(hipMemsetAsync(result, 0, sizeof(int64_t), stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            return fn(handle, int(n), x, int(incx), (int*)result);
+        }
+        if(!ilp64_is_int({incx}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // Compare the best element of each chunk, keeping the first of equal ones
+        using real_t = decltype(ilp64_abs1(ilp64_host_value(T{})));
+        hipblasHostPointerModeGuard host_mode(handle);
+        int64_t                 best_index = 0;
+        real_t                  best_value = 0;
+        hipblasStatus_t         status     = HIPBLAS_STATUS_SUCCESS;
+        if(incx > 0)
+            status = ilp64_chunks(n, incx, incx, [&](int len, int64_t offset_x, int64_t) {
+                int             index  = 0;
+                hipblasStatus_t status = fn(handle, len, x + offset_x, int(incx), &index);
+                if(status != HIPBLAS_STATUS_SUCCESS || index <= 0)
+                    return status;
+
+                T element;
+                if(hipMemcpy(&element,
+                             x + offset_x + int64_t(index - 1) * incx,
+                             sizeof(T),
+                             hipMemcpyDeviceToHost)
+                   != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+                real_t value = ilp64_abs1(ilp64_host_value(element));
+                if(!best_index || (Max ? value > best_value : value < best_value))
+                {
+                    best_index = offset_x / incx + index;
+                    best_value = value;
+                }
+                return HIPBLAS_STATUS_SUCCESS;
+            });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_store(host_mode.mode(), result, &best_index, 1);
+    }
+
+    // Runs an int batched iamax or iamin on the host and widens the indices
+    template <typename Call>
+    hipblasStatus_t ilp64_widen_indices(hipblasHandle_t handle,
+                                        int64_t         batch_count,
+                                        int64_t*        result,
+                                        Call            call)
+    {
+        if(!result && batch_count > 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasHostPointerModeGuard host_mode(handle);
+        return ilp64_batches(batch_count, [&](int64_t first, int count) {
+            std::vector<int> indices(std::max(count, 0));
+            hipblasStatus_t  status = call(first, count, indices.data());
+            if(status != HIPBLAS_STATUS_SUCCESS || count <= 0)
+                return status;
+            std::vector<int64_t> wide(indices.begin(), indices.end());
+            return ilp64_store(host_mode.mode(), result + first, wide.data(), count);
+        });
+    }
+
+    template <bool Max, typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasIamaxIaminBatched64Template(Fn              fn,
+                                                       FnBatched       fn_batched,
+                                                       hipblasHandle_t handle,
+                                                       int64_t         n,
+                                                       const T* const  x[],
+                                                       int64_t         incx,
+                                                       int64_t         batch_count,
+                                                       int64_t*        result)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_widen_indices(
+                handle, batch_count, result, [&](int64_t first, int count, int* indices) {
+                    return fn_batched(handle, int(n), x + first, int(incx), count, indices);
+                });
+
+        std::vector<const T*> hx;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle,
+                                  Max ? "hipblasIXamaxBatched_64" : "hipblasIXaminBatched_64",
+                                  x,
+                                  batch_count,
+                                  hx);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasIamaxIamin64Template<Max>(fn, handle, n, hx[b], incx, result + b);
+        });
+    }
+
+    template <bool Max, typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasIamaxIaminStridedBatched64Template(Fn              fn,
+                                                              FnStrided       fn_strided,
+                                                              hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const T*        x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batch_count,
+                                                              int64_t*        result)
+    {
+        if(ilp64_fits({n, incx}))
+            return ilp64_widen_indices(
+                handle, batch_count, result, [&](int64_t first, int count, int* indices) {
+                    return fn_strided(
+                        handle, int(n), x + first * stridex, int(incx), stridex, count, indices);
+                });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasIamaxIamin64Template<Max>(
+                fn, handle, n, x + b * stridex, incx, result + b);
+        });
+    }
+
+    /*
+     * ===========================================================================
+     *    level 2 BLAS
+     * ===========================================================================
+     */
+
+    // gemv, split along the columns of A: m never needs splitting, as it is at most lda. With
+    // trans == HIPBLAS_OP_N each split adds to all of y, and beta is applied by the first only.
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasGemv64Template(Fn                 fn,
+                                          hipblasHandle_t    handle,
+                                          hipblasOperation_t trans,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int64_t            lda,
+                                          const T*           x,
+                                          int64_t            incx,
+                                          const T*           beta,
+                                          T*                 y,
+                                          int64_t            incy)
+    {
+        if(ilp64_fits({m, n, lda, incx, incy}))
+            return fn(handle,
+                      trans,
+                      int(m),
+                      int(n),
+                      alpha,
+                      A,
+                      int(lda),
+                      x,
+                      int(incx),
+                      beta,
+                      y,
+                      int(incy));
+        if(!ilp64_is_int({lda, incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || m > lda)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasHostPointerModeGuard host_mode(handle);
+        T                       h_alpha, h_beta, one = hipblasXtConstant<T>(1);
+        hipblasStatus_t         status = ilp64_host_scalar(
+            handle, "hipblasXgemv_64", host_mode.mode(), alpha, h_alpha);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_scalar(handle, "hipblasXgemv_64", host_mode.mode(), beta, h_beta);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool    no_trans = trans == HIPBLAS_OP_N;
+        int64_t chunk    = ilp64_chunk();
+        for(int64_t j = 0; j < n; j += chunk)
+        {
+            int64_t cols = std::min(chunk, n - j);
+            status       = fn(handle,
+                        trans,
+                        int(m),
+                        int(cols),
+                        &h_alpha,
+                        A + j * lda,
+                        int(lda),
+                        no_trans ? x + ilp64_offset(n, incx, j, cols) : x,
+                        int(incx),
+                        no_trans && j ? &one : &h_beta,
+                        no_trans ? y : y + ilp64_offset(n, incy, j, cols),
+                        int(incy));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasGemvBatched64Template(Fn                 fn,
+                                                 FnBatched          fn_batched,
+                                                 hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 const T*           alpha,
+                                                 const T* const     A[],
+                                                 int64_t            lda,
+                                                 const T* const     x[],
+                                                 int64_t            incx,
+                                                 const T*           beta,
+                                                 T* const           y[],
+                                                 int64_t            incy,
+                                                 int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  trans,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  x + first,
+                                  int(incx),
+                                  beta,
+                                  y + first,
+                                  int(incy),
+                                  count);
+            });
+
+        std::vector<const T*> hA, hx;
+        std::vector<T*>       hy;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle, "hipblasXgemvBatched_64", A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgemvBatched_64", x, batch_count, hx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgemvBatched_64", y, batch_count, hy);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGemv64Template(
+                fn, handle, trans, m, n, alpha, hA[b], lda, hx[b], incx, beta, hy[b], incy);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasGemvStridedBatched64Template(Fn                 fn,
+                                                        FnStrided          fn_strided,
+                                                        hipblasHandle_t    handle,
+                                                        hipblasOperation_t trans,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        const T*           alpha,
+                                                        const T*           A,
+                                                        int64_t            lda,
+                                                        hipblasStride      strideA,
+                                                        const T*           x,
+                                                        int64_t            incx,
+                                                        hipblasStride      stridex,
+                                                        const T*           beta,
+                                                        T*                 y,
+                                                        int64_t            incy,
+                                                        hipblasStride      stridey,
+                                                        int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  trans,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  x + first * stridex,
+                                  int(incx),
+                                  stridex,
+                                  beta,
+                                  y + first * stridey,
+                                  int(incy),
+                                  stridey,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGemv64Template(fn,
+                                         handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A + b * strideA,
+                                         lda,
+                                         x + b * stridex,
+                                         incx,
+                                         beta,
+                                         y + b * stridey,
+                                         incy);
+        });
+    }
+
+    // gbmv, split along y: each split is made on the block of A holding the rows, or with trans
+    // the columns, which it writes and the band of columns, or rows, which they reach. The block
+    // is a band matrix of its own, with the band shifted by the offset of its first column from
+    // its first row. Rows of y which the band does not reach are only scaled by beta.
+    template <typename Fn, typename FnScal, typename T>
+    hipblasStatus_t hipblasGbmv64Template(Fn                 fn,
+                                          FnScal             scal,
+                                          hipblasHandle_t    handle,
+                                          hipblasOperation_t trans,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          int64_t            kl,
+                                          int64_t            ku,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int64_t            lda,
+                                          const T*           x,
+                                          int64_t            incx,
+                                          const T*           beta,
+                                          T*                 y,
+                                          int64_t            incy)
+    {
+        if(ilp64_fits({m, n, kl, ku, lda, incx, incy}))
+            return fn(handle,
+                      trans,
+                      int(m),
+                      int(n),
+                      int(kl),
+                      int(ku),
+                      alpha,
+                      A,
+                      int(lda),
+                      x,
+                      int(incx),
+                      beta,
+                      y,
+                      int(incy));
+        if(!ilp64_is_int({kl, ku, lda, incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || lda < kl + ku + 1)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // A block is at most kl + ku larger than its split of y
+        int64_t chunk = ilp64_chunk() - kl - ku;
+        if(chunk < 1)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        bool    no_trans = trans == HIPBLAS_OP_N;
+        int64_t len_x    = no_trans ? n : m;
+        int64_t len_y    = no_trans ? m : n;
+        for(int64_t i = 0; i < len_y; i += chunk)
+        {
+            int64_t len = std::min(chunk, len_y - i);
+
+            // Rows [r0, r1) and columns [c0, c1) of the block
+            int64_t r0 = no_trans ? i : std::max<int64_t>(0, i - ku);
+            int64_t r1 = no_trans ? i + len : std::min(m, i + len + kl);
+            int64_t c0 = no_trans ? std::max<int64_t>(0, i - kl) : i;
+            int64_t c1 = no_trans ? std::min(n, i + len + ku) : i + len;
+
+            hipblasStatus_t status;
+            T*              y_block = y + ilp64_offset(len_y, incy, i, len);
+            if(r0 >= r1 || c0 >= c1)
+                status = scal(handle, int(len), beta, y_block, int(incy));
+            else
+            {
+                int64_t d      = c0 - r0;
+                int64_t x_from = no_trans ? c0 : r0;
+                int64_t x_len  = no_trans ? c1 - c0 : r1 - r0;
+                status         = fn(handle,
+                            trans,
+                            int(r1 - r0),
+                            int(c1 - c0),
+                            int(kl + d),
+                            int(ku - d),
+                            alpha,
+                            A + c0 * lda,
+                            int(lda),
+                            x + ilp64_offset(len_x, incx, x_from, x_len),
+                            int(incx),
+                            beta,
+                            y_block,
+                            int(incy));
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename FnScal, typename FnBatched, typename T>
+    hipblasStatus_t hipblasGbmvBatched64Template(Fn                 fn,
+                                                 FnScal             scal,
+                                                 FnBatched          fn_batched,
+                                                 hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            kl,
+                                                 int64_t            ku,
+                                                 const T*           alpha,
+                                                 const T* const     A[],
+                                                 int64_t            lda,
+                                                 const T* const     x[],
+                                                 int64_t            incx,
+                                                 const T*           beta,
+                                                 T* const           y[],
+                                                 int64_t            incy,
+                                                 int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, kl, ku, lda, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  trans,
+                                  int(m),
+                                  int(n),
+                                  int(kl),
+                                  int(ku),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  x + first,
+                                  int(incx),
+                                  beta,
+                                  y + first,
+                                  int(incy),
+                                  count);
+            });
+
+        std::vector<const T*> hA, hx;
+        std::vector<T*>       hy;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle, "hipblasXgbmvBatched_64", A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgbmvBatched_64", x, batch_count, hx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgbmvBatched_64", y, batch_count, hy);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGbmv64Template(fn,
+                                         scal,
+                                         handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         alpha,
+                                         hA[b],
+                                         lda,
+                                         hx[b],
+                                         incx,
+                                         beta,
+                                         hy[b],
+                                         incy);
+        });
+    }
+
+    template <typename Fn, typename FnScal, typename FnStrided, typename T>
+    hipblasStatus_t hipblasGbmvStridedBatched64Template(Fn                 fn,
+                                                        FnScal             scal,
+                                                        FnStrided          fn_strided,
+                                                        hipblasHandle_t    handle,
+                                                        hipblasOperation_t trans,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        int64_t            kl,
+                                                        int64_t            ku,
+                                                        const T*           alpha,
+                                                        const T*           A,
+                                                        int64_t            lda,
+                                                        hipblasStride      strideA,
+                                                        const T*           x,
+                                                        int64_t            incx,
+                                                        hipblasStride      stridex,
+                                                        const T*           beta,
+                                                        T*                 y,
+                                                        int64_t            incy,
+                                                        hipblasStride      stridey,
+                                                        int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, kl, ku, lda, incx, incy}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  trans,
+                                  int(m),
+                                  int(n),
+                                  int(kl),
+                                  int(ku),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  x + first * stridex,
+                                  int(incx),
+                                  stridex,
+                                  beta,
+                                  y + first * stridey,
+                                  int(incy),
+                                  stridey,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGbmv64Template(fn,
+                                         scal,
+                                         handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         alpha,
+                                         A + b * strideA,
+                                         lda,
+                                         x + b * stridex,
+                                         incx,
+                                         beta,
+                                         y + b * stridey,
+                                         incy);
+        });
+    }
+
+    // tbmv and tbsv, split along x. Each split is made on its diagonal block, with fn, and on the
+    // block of A holding the up to k elements of x on which it also depends, with gbmv, as in
+    // hipblasGbmv64Template. tbmv adds that product after its diagonal block, working away from
+    // the elements it depends on so that they are not yet overwritten; tbsv subtracts it first,
+    // working towards them so that they are already solved.
+    template <typename Fn, typename FnGbmv, typename T>
+    hipblasStatus_t hipblasTbmvTbsv64Template(Fn                 fn,
+                                              FnGbmv             gbmv,
+                                              bool               solve,
+                                              hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const T*           A,
+                                              int64_t            lda,
+                                              T*                 x,
+                                              int64_t            incx)
+    {
+        if(ilp64_fits({n, k, lda, incx}))
+            return fn(handle, uplo, trans, diag, int(n), int(k), A, int(lda), x, int(incx));
+        if(!ilp64_is_int({k, lda, incx}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(n < 0 || k < 0 || lda < k + 1)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipblasHostPointerModeGuard host_mode(handle);
+        T one = hipblasXtConstant<T>(1), minus_one = hipblasXtConstant<T>(-1);
+
+        bool    lower    = uplo == HIPBLAS_FILL_MODE_LOWER;
+        bool    no_trans = trans == HIPBLAS_OP_N;
+        bool    before   = lower == no_trans; // the dependencies precede the split
+        bool    forward  = solve == before;
+        int64_t chunk    = ilp64_chunk();
+        int64_t count    = (n - 1) / chunk + 1;
+        for(int64_t c = 0; c < count; c++)
+        {
+            int64_t s0  = (forward ? c : count - 1 - c) * chunk;
+            int64_t len = std::min(chunk, n - s0);
+            int64_t s1  = s0 + len;
+
+            // The elements [d0, d1) it depends on, and those [o0, o1) of the split which do
+            int64_t d0 = before ? std::max<int64_t>(0, s0 - k) : s1;
+            int64_t d1 = before ? s0 : std::min(n, s1 + k);
+            int64_t o0 = before ? s0 : std::max(s0, s1 - k);
+            int64_t o1 = before ? std::min(s1, s0 + k) : s1;
+            int64_t r0 = no_trans ? o0 : d0, r1 = no_trans ? o1 : d1;
+            int64_t c0 = no_trans ? d0 : o0, c1 = no_trans ? d1 : o1;
+            int64_t d  = c0 - r0;
+
+            auto diagonal = [&]() {
+                return fn(handle,
+                          uplo,
+                          trans,
+                          diag,
+                          int(len),
+                          int(k),
+                          A + s0 * lda,
+                          int(lda),
+                          x + ilp64_offset(n, incx, s0, len),
+                          int(incx));
+            };
+            auto band = [&]() {
+                if(d0 >= d1)
+                    return HIPBLAS_STATUS_SUCCESS;
+                return gbmv(handle,
+                            trans,
+                            int(r1 - r0),
+                            int(c1 - c0),
+                            int((lower ? k : 0) + d),
+                            int((lower ? 0 : k) - d),
+                            solve ? &minus_one : &one,
+                            A + c0 * lda,
+                            int(lda),
+                            x + ilp64_offset(n, incx, d0, d1 - d0),
+                            int(incx),
+                            &one,
+                            x + ilp64_offset(n, incx, o0, o1 - o0),
+                            int(incx));
+            };
+
+            hipblasStatus_t status = solve ? band() : diagonal();
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = solve ? diagonal() : band();
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename FnGbmv, typename FnBatched, typename T>
+    hipblasStatus_t hipblasTbmvTbsvBatched64Template(Fn                 fn,
+                                                     FnGbmv             gbmv,
+                                                     FnBatched          fn_batched,
+                                                     bool               solve,
+                                                     hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t trans,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const T* const     A[],
+                                                     int64_t            lda,
+                                                     T* const           x[],
+                                                     int64_t            incx,
+                                                     int64_t            batch_count)
+    {
+        if(ilp64_fits({n, k, lda, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  uplo,
+                                  trans,
+                                  diag,
+                                  int(n),
+                                  int(k),
+                                  A + first,
+                                  int(lda),
+                                  x + first,
+                                  int(incx),
+                                  count);
+            });
+
+        const char*           func = solve ? "hipblasXtbsvBatched_64" : "hipblasXtbmvBatched_64";
+        std::vector<const T*> hA;
+        std::vector<T*>       hx;
+        hipblasStatus_t       status = ilp64_host_pointers(handle, func, A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, func, x, batch_count, hx);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTbmvTbsv64Template(
+                fn, gbmv, solve, handle, uplo, trans, diag, n, k, hA[b], lda, hx[b], incx);
+        });
+    }
+
+    template <typename Fn, typename FnGbmv, typename FnStrided, typename T>
+    hipblasStatus_t hipblasTbmvTbsvStridedBatched64Template(Fn                 fn,
+                                                            FnGbmv             gbmv,
+                                                            FnStrided          fn_strided,
+                                                            bool               solve,
+                                                            hipblasHandle_t    handle,
+                                                            hipblasFillMode_t  uplo,
+                                                            hipblasOperation_t trans,
+                                                            hipblasDiagType_t  diag,
+                                                            int64_t            n,
+                                                            int64_t            k,
+                                                            const T*           A,
+                                                            int64_t            lda,
+                                                            hipblasStride      strideA,
+                                                            T*                 x,
+                                                            int64_t            incx,
+                                                            hipblasStride      stridex,
+                                                            int64_t            batch_count)
+    {
+        if(ilp64_fits({n, k, lda, incx}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  uplo,
+                                  trans,
+                                  diag,
+                                  int(n),
+                                  int(k),
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  x + first * stridex,
+                                  int(incx),
+                                  stridex,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTbmvTbsv64Template(fn,
+                                             gbmv,
+                                             solve,
+                                             handle,
+                                             uplo,
+                                             trans,
+                                             diag,
+                                             n,
+                                             k,
+                                             A + b * strideA,
+                                             lda,
+                                             x + b * stridex,
+                                             incx);
+        });
+    }
+
+    /*
+     * ===========================================================================
+     *    level 3 BLAS
+     * ===========================================================================
+     */
+
+    // gemm, split along the columns of C and along k, with beta applied by the first split of k
+    // only. m never needs splitting, as it is at most ldc.
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasGemm64Template(Fn                 fn,
+                                          hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          int64_t            k,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int64_t            lda,
+                                          const T*           B,
+                                          int64_t            ldb,
+                                          const T*           beta,
+                                          T*                 C,
+                                          int64_t            ldc)
+    {
+        if(ilp64_fits({m, n, k, lda, ldb, ldc}))
+            return fn(handle,
+                      transA,
+                      transB,
+                      int(m),
+                      int(n),
+                      int(k),
+                      alpha,
+                      A,
+                      int(lda),
+                      B,
+                      int(ldb),
+                      beta,
+                      C,
+                      int(ldc));
+        if(!ilp64_is_int({lda, ldb, ldc}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || k < 0 || m > ldc)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasHostPointerModeGuard host_mode(handle);
+        T                       h_alpha, h_beta, one = hipblasXtConstant<T>(1);
+        hipblasStatus_t         status = ilp64_host_scalar(
+            handle, "hipblasXgemm_64", host_mode.mode(), alpha, h_alpha);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_scalar(handle, "hipblasXgemm_64", host_mode.mode(), beta, h_beta);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int64_t chunk = ilp64_chunk();
+        for(int64_t j = 0; j < n; j += chunk)
+        {
+            int64_t cols = std::min(chunk, n - j);
+
+            // k = 0 still scales C by beta
+            for(int64_t l = 0; l == 0 || l < k; l += chunk)
+            {
+                int64_t depth = std::min(chunk, k - l);
+                status        = fn(handle,
+                            transA,
+                            transB,
+                            int(m),
+                            int(cols),
+                            int(depth),
+                            &h_alpha,
+                            transA == HIPBLAS_OP_N ? A + l * lda : A + l,
+                            int(lda),
+                            transB == HIPBLAS_OP_N ? B + l + j * ldb : B + j + l * ldb,
+                            int(ldb),
+                            l ? &one : &h_beta,
+                            C + j * ldc,
+                            int(ldc));
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasGemmBatched64Template(Fn                 fn,
+                                                 FnBatched          fn_batched,
+                                                 hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            k,
+                                                 const T*           alpha,
+                                                 const T* const     A[],
+                                                 int64_t            lda,
+                                                 const T* const     B[],
+                                                 int64_t            ldb,
+                                                 const T*           beta,
+                                                 T* const           C[],
+                                                 int64_t            ldc,
+                                                 int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, k, lda, ldb, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  transA,
+                                  transB,
+                                  int(m),
+                                  int(n),
+                                  int(k),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  B + first,
+                                  int(ldb),
+                                  beta,
+                                  C + first,
+                                  int(ldc),
+                                  count);
+            });
+
+        std::vector<const T*> hA, hB;
+        std::vector<T*>       hC;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle, "hipblasXgemmBatched_64", A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgemmBatched_64", B, batch_count, hB);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXgemmBatched_64", C, batch_count, hC);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGemm64Template(fn,
+                                         handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         hA[b],
+                                         lda,
+                                         hB[b],
+                                         ldb,
+                                         beta,
+                                         hC[b],
+                                         ldc);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasGemmStridedBatched64Template(Fn                 fn,
+                                                        FnStrided          fn_strided,
+                                                        hipblasHandle_t    handle,
+                                                        hipblasOperation_t transA,
+                                                        hipblasOperation_t transB,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        int64_t            k,
+                                                        const T*           alpha,
+                                                        const T*           A,
+                                                        int64_t            lda,
+                                                        long long          strideA,
+                                                        const T*           B,
+                                                        int64_t            ldb,
+                                                        long long          strideB,
+                                                        const T*           beta,
+                                                        T*                 C,
+                                                        int64_t            ldc,
+                                                        long long          strideC,
+                                                        int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, k, lda, ldb, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  transA,
+                                  transB,
+                                  int(m),
+                                  int(n),
+                                  int(k),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  B + first * strideB,
+                                  int(ldb),
+                                  strideB,
+                                  beta,
+                                  C + first * strideC,
+                                  int(ldc),
+                                  strideC,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasGemm64Template(fn,
+                                         handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A + b * strideA,
+                                         lda,
+                                         B + b * strideB,
+                                         ldb,
+                                         beta,
+                                         C + b * strideC,
+                                         ldc);
+        });
+    }
+
+    // trsm and trmm with side == HIPBLAS_SIDE_LEFT, split along the columns of B, which are
+    // independent. m never needs splitting, as it is at most lda, nor do m and n with
+    // side == HIPBLAS_SIDE_RIGHT. call(cols, j) makes the int call on columns [j, j + cols).
+    template <typename Call>
+    hipblasStatus_t ilp64_left_columns(
+        hipblasSideMode_t side, int64_t m, int64_t n, int64_t lda, int64_t ldb, Call call)
+    {
+        if(ilp64_fits({m, n, lda, ldb})
+           || (side != HIPBLAS_SIDE_LEFT && ilp64_is_int({m, n, lda, ldb})))
+            return call(int(n), 0);
+        if(side != HIPBLAS_SIDE_LEFT || !ilp64_is_int({m, lda, ldb}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t chunk = ilp64_chunk();
+        for(int64_t j = 0; j < n; j += chunk)
+        {
+            hipblasStatus_t status = call(int(std::min(chunk, n - j)), j);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasTrsm64Template(Fn                 fn,
+                                          hipblasHandle_t    handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int64_t            lda,
+                                          T*                 B,
+                                          int64_t            ldb)
+    {
+        return ilp64_left_columns(side, m, n, lda, ldb, [&](int cols, int64_t j) {
+            return fn(handle,
+                      side,
+                      uplo,
+                      transA,
+                      diag,
+                      int(m),
+                      cols,
+                      alpha,
+                      A,
+                      int(lda),
+                      B + j * ldb,
+                      int(ldb));
+        });
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasTrsmBatched64Template(Fn                 fn,
+                                                 FnBatched          fn_batched,
+                                                 hipblasHandle_t    handle,
+                                                 hipblasSideMode_t  side,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t transA,
+                                                 hipblasDiagType_t  diag,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 const T*           alpha,
+                                                 const T* const     A[],
+                                                 int64_t            lda,
+                                                 T* const           B[],
+                                                 int64_t            ldb,
+                                                 int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, ldb}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  B + first,
+                                  int(ldb),
+                                  count);
+            });
+
+        std::vector<const T*> hA;
+        std::vector<T*>       hB;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle, "hipblasXtrsmBatched_64", A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXtrsmBatched_64", B, batch_count, hB);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTrsm64Template(
+                fn, handle, side, uplo, transA, diag, m, n, alpha, hA[b], lda, hB[b], ldb);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasTrsmStridedBatched64Template(Fn                 fn,
+                                                        FnStrided          fn_strided,
+                                                        hipblasHandle_t    handle,
+                                                        hipblasSideMode_t  side,
+                                                        hipblasFillMode_t  uplo,
+                                                        hipblasOperation_t transA,
+                                                        hipblasDiagType_t  diag,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        const T*           alpha,
+                                                        const T*           A,
+                                                        int64_t            lda,
+                                                        hipblasStride      strideA,
+                                                        T*                 B,
+                                                        int64_t            ldb,
+                                                        hipblasStride      strideB,
+                                                        int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, ldb}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  B + first * strideB,
+                                  int(ldb),
+                                  strideB,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTrsm64Template(fn,
+                                         handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A + b * strideA,
+                                         lda,
+                                         B + b * strideB,
+                                         ldb);
+        });
+    }
+
+    template <typename Fn, typename T>
+    hipblasStatus_t hipblasTrmm64Template(Fn                 fn,
+                                          hipblasHandle_t    handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int64_t            lda,
+                                          const T*           B,
+                                          int64_t            ldb,
+                                          T*                 C,
+                                          int64_t            ldc)
+    {
+        if(!ilp64_is_int({ldc}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return ilp64_left_columns(side, m, n, lda, ldb, [&](int cols, int64_t j) {
+            return fn(handle,
+                      side,
+                      uplo,
+                      transA,
+                      diag,
+                      int(m),
+                      cols,
+                      alpha,
+                      A,
+                      int(lda),
+                      B + j * ldb,
+                      int(ldb),
+                      C + j * ldc,
+                      int(ldc));
+        });
+    }
+
+    template <typename Fn, typename FnBatched, typename T>
+    hipblasStatus_t hipblasTrmmBatched64Template(Fn                 fn,
+                                                 FnBatched          fn_batched,
+                                                 hipblasHandle_t    handle,
+                                                 hipblasSideMode_t  side,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t transA,
+                                                 hipblasDiagType_t  diag,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 const T*           alpha,
+                                                 const T* const     A[],
+                                                 int64_t            lda,
+                                                 const T* const     B[],
+                                                 int64_t            ldb,
+                                                 T* const           C[],
+                                                 int64_t            ldc,
+                                                 int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, ldb, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  B + first,
+                                  int(ldb),
+                                  C + first,
+                                  int(ldc),
+                                  count);
+            });
+
+        std::vector<const T*> hA, hB;
+        std::vector<T*>       hC;
+        hipblasStatus_t       status
+            = ilp64_host_pointers(handle, "hipblasXtrmmBatched_64", A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXtrmmBatched_64", B, batch_count, hB);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, "hipblasXtrmmBatched_64", C, batch_count, hC);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTrmm64Template(fn,
+                                         handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         hA[b],
+                                         lda,
+                                         hB[b],
+                                         ldb,
+                                         hC[b],
+                                         ldc);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T>
+    hipblasStatus_t hipblasTrmmStridedBatched64Template(Fn                 fn,
+                                                        FnStrided          fn_strided,
+                                                        hipblasHandle_t    handle,
+                                                        hipblasSideMode_t  side,
+                                                        hipblasFillMode_t  uplo,
+                                                        hipblasOperation_t transA,
+                                                        hipblasDiagType_t  diag,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        const T*           alpha,
+                                                        const T*           A,
+                                                        int64_t            lda,
+                                                        hipblasStride      strideA,
+                                                        const T*           B,
+                                                        int64_t            ldb,
+                                                        hipblasStride      strideB,
+                                                        T*                 C,
+                                                        int64_t            ldc,
+                                                        hipblasStride      strideC,
+                                                        int64_t            batch_count)
+    {
+        if(ilp64_fits({m, n, lda, ldb, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  B + first * strideB,
+                                  int(ldb),
+                                  strideB,
+                                  C + first * strideC,
+                                  int(ldc),
+                                  strideC,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasTrmm64Template(fn,
+                                         handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A + b * strideA,
+                                         lda,
+                                         B + b * strideB,
+                                         ldb,
+                                         C + b * strideC,
+                                         ldc);
+        });
+    }
+
+    // syrk and herk, split along k, with beta applied by the first split only. n never needs
+    // splitting, as it is at most ldc. For herk, T is complex and U, the type of the scalars, real.
+    template <typename Fn, typename T, typename U>
+    hipblasStatus_t hipblasSyrkHerk64Template(Fn                 fn,
+                                              hipblasHandle_t    handle,
+                                              const char*        func,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const U*           alpha,
+                                              const T*           A,
+                                              int64_t            lda,
+                                              const U*           beta,
+                                              T*                 C,
+                                              int64_t            ldc)
+    {
+        if(ilp64_fits({n, k, lda, ldc}))
+            return fn(handle, uplo, trans, int(n), int(k), alpha, A, int(lda), beta, C, int(ldc));
+        if(!ilp64_is_int({n, lda, ldc}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(n < 0 || k < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasHostPointerModeGuard host_mode(handle);
+        U                       h_alpha, h_beta, one = hipblasXtConstant<U>(1);
+        hipblasStatus_t status = ilp64_host_scalar(handle, func, host_mode.mode(), alpha, h_alpha);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_scalar(handle, func, host_mode.mode(), beta, h_beta);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // k = 0 still scales C by beta
+        int64_t chunk = ilp64_chunk();
+        for(int64_t l = 0; l == 0 || l < k; l += chunk)
+        {
+            status = fn(handle,
+                        uplo,
+                        trans,
+                        int(n),
+                        int(std::min(chunk, k - l)),
+                        &h_alpha,
+                        trans == HIPBLAS_OP_N ? A + l * lda : A + l,
+                        int(lda),
+                        l ? &one : &h_beta,
+                        C,
+                        int(ldc));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename Fn, typename FnBatched, typename T, typename U>
+    hipblasStatus_t hipblasSyrkHerkBatched64Template(Fn                 fn,
+                                                     FnBatched          fn_batched,
+                                                     hipblasHandle_t    handle,
+                                                     const char*        func,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t trans,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const U*           alpha,
+                                                     const T* const     A[],
+                                                     int64_t            lda,
+                                                     const U*           beta,
+                                                     T* const           C[],
+                                                     int64_t            ldc,
+                                                     int64_t            batch_count)
+    {
+        if(ilp64_fits({n, k, lda, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_batched(handle,
+                                  uplo,
+                                  trans,
+                                  int(n),
+                                  int(k),
+                                  alpha,
+                                  A + first,
+                                  int(lda),
+                                  beta,
+                                  C + first,
+                                  int(ldc),
+                                  count);
+            });
+
+        std::vector<const T*> hA;
+        std::vector<T*>       hC;
+        hipblasStatus_t       status = ilp64_host_pointers(handle, func, A, batch_count, hA);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = ilp64_host_pointers(handle, func, C, batch_count, hC);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasSyrkHerk64Template(
+                fn, handle, func, uplo, trans, n, k, alpha, hA[b], lda, beta, hC[b], ldc);
+        });
+    }
+
+    template <typename Fn, typename FnStrided, typename T, typename U>
+    hipblasStatus_t hipblasSyrkHerkStridedBatched64Template(Fn                 fn,
+                                                            FnStrided          fn_strided,
+                                                            hipblasHandle_t    handle,
+                                                            const char*        func,
+                                                            hipblasFillMode_t  uplo,
+                                                            hipblasOperation_t trans,
+                                                            int64_t            n,
+                                                            int64_t            k,
+                                                            const U*           alpha,
+                                                            const T*           A,
+                                                            int64_t            lda,
+                                                            hipblasStride      strideA,
+                                                            const U*           beta,
+                                                            T*                 C,
+                                                            int64_t            ldc,
+                                                            hipblasStride      strideC,
+                                                            int64_t            batch_count)
+    {
+        if(ilp64_fits({n, k, lda, ldc}))
+            return ilp64_batches(batch_count, [&](int64_t first, int count) {
+                return fn_strided(handle,
+                                  uplo,
+                                  trans,
+                                  int(n),
+                                  int(k),
+                                  alpha,
+                                  A + first * strideA,
+                                  int(lda),
+                                  strideA,
+                                  beta,
+                                  C + first * strideC,
+                                  int(ldc),
+                                  strideC,
+                                  count);
+            });
+        return ilp64_items(batch_count, [&](int64_t b) {
+            return hipblasSyrkHerk64Template(fn,
+                                             handle,
+                                             func,
+                                             uplo,
+                                             trans,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A + b * strideA,
+                                             lda,
+                                             beta,
+                                             C + b * strideC,
+                                             ldc);
+        });
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+try
+{
+    ILP64_NATIVE(hipblasSscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasSscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+try
+{
+    ILP64_NATIVE(hipblasDscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasDscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscal_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    ILP64_NATIVE(hipblasCscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasCscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    ILP64_NATIVE(hipblasCsscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasCsscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasZscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+try
+{
+    ILP64_NATIVE(hipblasZdscal_64Backend(handle, n, alpha, x, incx));
+    return hipblasScal64Template(hipblasZdscal, handle, n, alpha, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const float*    alpha,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasSscal, hipblasSscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasDscal, hipblasDscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasCscal, hipblasCscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                        int64_t               n,
+                                        const float*          alpha,
+                                        hipblasComplex* const x[],
+                                        int64_t               incx,
+                                        int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasCsscal, hipblasCsscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasZscal, hipblasZscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const double*               alpha,
+                                        hipblasDoubleComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZdscalBatched_64Backend(handle, n, alpha, x, incx, batchCount));
+    return hipblasScalBatched64Template(
+        hipblasZdscal, hipblasZdscalBatched, handle, n, alpha, x, incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasSscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasSscal, hipblasSscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasDscal, hipblasDscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasCscal, hipblasCscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCsscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasCsscal, hipblasCsscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasZscal, hipblasZscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const double*         alpha,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZdscalStridedBatched_64Backend(handle, n, alpha, x, incx, stridex, batchCount));
+    return hipblasScalStridedBatched64Template(
+        hipblasZdscal, hipblasZdscalStridedBatched, handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const float*    alpha,
+                                const float*    x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy)
+try
+{
+    ILP64_NATIVE(hipblasSaxpy_64Backend(handle, n, alpha, x, incx, y, incy));
+    return hipblasAxpy64Template(hipblasSaxpy, handle, n, alpha, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const double*   alpha,
+                                const double*   x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy)
+try
+{
+    ILP64_NATIVE(hipblasDaxpy_64Backend(handle, n, alpha, x, incx, y, incy));
+    return hipblasAxpy64Template(hipblasDaxpy, handle, n, alpha, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasCaxpy_64Backend(handle, n, alpha, x, incx, y, incy));
+    return hipblasAxpy64Template(hipblasCaxpy, handle, n, alpha, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZaxpy_64Backend(handle, n, alpha, x, incx, y, incy));
+    return hipblasAxpy64Template(hipblasZaxpy, handle, n, alpha, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSaxpyBatched_64Backend(handle, n, alpha, x, incx, y, incy, batchCount));
+    return hipblasAxpyBatched64Template(
+        hipblasSaxpy, hipblasSaxpyBatched, handle, n, alpha, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDaxpyBatched_64Backend(handle, n, alpha, x, incx, y, incy, batchCount));
+    return hipblasAxpyBatched64Template(
+        hipblasDaxpy, hipblasDaxpyBatched, handle, n, alpha, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCaxpyBatched_64Backend(handle, n, alpha, x, incx, y, incy, batchCount));
+    return hipblasAxpyBatched64Template(
+        hipblasCaxpy, hipblasCaxpyBatched, handle, n, alpha, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZaxpyBatched_64Backend(handle, n, alpha, x, incx, y, incy, batchCount));
+    return hipblasAxpyBatched64Template(
+        hipblasZaxpy, hipblasZaxpyBatched, handle, n, alpha, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSaxpyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasAxpyStridedBatched64Template(hipblasSaxpy,
+                                               hipblasSaxpyStridedBatched,
+                                               handle,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDaxpyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasAxpyStridedBatched64Template(hipblasDaxpy,
+                                               hipblasDaxpyStridedBatched,
+                                               handle,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCaxpyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasAxpyStridedBatched64Template(hipblasCaxpy,
+                                               hipblasCaxpyStridedBatched,
+                                               handle,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZaxpyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasAxpyStridedBatched64Template(hipblasZaxpy,
+                                               hipblasZaxpyStridedBatched,
+                                               handle,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    ILP64_NATIVE(hipblasScopy_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasScopy, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    ILP64_NATIVE(hipblasDcopy_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasDcopy, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasCcopy_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasCcopy, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZcopy_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasZcopy, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasScopyBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<false>(
+        hipblasScopy, hipblasScopyBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDcopyBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<false>(
+        hipblasDcopy, hipblasDcopyBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCcopyBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<false>(
+        hipblasCcopy, hipblasCcopyBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZcopyBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<false>(
+        hipblasZcopy, hipblasZcopyBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasScopyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasScopy,
+                                                   hipblasScopyStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDcopyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasDcopy,
+                                                   hipblasDcopyStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCcopyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasCcopy,
+                                                   hipblasCcopyStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZcopyStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasZcopy,
+                                                   hipblasZcopyStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    ILP64_NATIVE(hipblasSswap_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasSswap, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    ILP64_NATIVE(hipblasDswap_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasDswap, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy)
+try
+{
+    ILP64_NATIVE(hipblasCswap_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasCswap, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasZswap_64Backend(handle, n, x, incx, y, incy));
+    return hipblasCopySwap64Template(hipblasZswap, handle, n, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       float* const    y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSswapBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<true>(
+        hipblasSswap, hipblasSswapBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       double* const   y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDswapBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<true>(
+        hipblasDswap, hipblasDswapBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCswapBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<true>(
+        hipblasCswap, hipblasCswapBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZswapBatched_64Backend(handle, n, x, incx, y, incy, batchCount));
+    return hipblasCopySwapBatched64Template<true>(
+        hipblasZswap, hipblasZswapBatched, handle, n, x, incx, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSswapStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasSswap,
+                                                   hipblasSswapStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDswapStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasDswap,
+                                                   hipblasDswapStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCswapStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasCswap,
+                                                   hipblasCswapStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZswapStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasCopySwapStridedBatched64Template(hipblasZswap,
+                                                   hipblasZswapStridedBatched,
+                                                   handle,
+                                                   n,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          result)
+try
+{
+    ILP64_NATIVE(hipblasSdot_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasSdot, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         result)
+try
+{
+    ILP64_NATIVE(hipblasDdot_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasDdot, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasCdotu_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasCdotu, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasCdotc_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasCdotc, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasZdotu_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasZdotu, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasZdotc_64Backend(handle, n, x, incx, y, incy, result));
+    return hipblasDot64Template(hipblasZdotc, handle, n, x, incx, y, incy, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                      int64_t            n,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      const float* const y[],
+                                      int64_t            incy,
+                                      int64_t            batchCount,
+                                      float*             result)
+try
+{
+    ILP64_NATIVE(hipblasSdotBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasSdot, hipblasSdotBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                      int64_t             n,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      const double* const y[],
+                                      int64_t             incy,
+                                      int64_t             batchCount,
+                                      double*             result)
+try
+{
+    ILP64_NATIVE(hipblasDdotBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasDdot, hipblasDdotBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+try
+{
+    ILP64_NATIVE(hipblasCdotuBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasCdotu, hipblasCdotuBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+try
+{
+    ILP64_NATIVE(hipblasCdotcBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasCdotc, hipblasCdotcBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+try
+{
+    ILP64_NATIVE(hipblasZdotuBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasZdotu, hipblasZdotuBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+try
+{
+    ILP64_NATIVE(hipblasZdotcBatched_64Backend(handle, n, x, incx, y, incy, batchCount, result));
+    return hipblasDotBatched64Template(
+        hipblasZdotc, hipblasZdotcBatched, handle, n, x, incx, y, incy, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const float*    x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const float*    y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             float*          result)
+try
+{
+    ILP64_NATIVE(hipblasSdotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     batchCount,
+                                                     result));
+    return hipblasDotStridedBatched64Template(hipblasSdot,
+                                              hipblasSdotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const double*   x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const double*   y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             double*         result)
+try
+{
+    ILP64_NATIVE(hipblasDdotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     batchCount,
+                                                     result));
+    return hipblasDotStridedBatched64Template(hipblasDdot,
+                                              hipblasDdotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasCdotuStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount,
+                                                      result));
+    return hipblasDotStridedBatched64Template(hipblasCdotu,
+                                              hipblasCdotuStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasCdotcStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount,
+                                                      result));
+    return hipblasDotStridedBatched64Template(hipblasCdotc,
+                                              hipblasCdotcStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasZdotuStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount,
+                                                      result));
+    return hipblasDotStridedBatched64Template(hipblasZdotu,
+                                              hipblasZdotuStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+try
+{
+    ILP64_NATIVE(hipblasZdotcStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount,
+                                                      result));
+    return hipblasDotStridedBatched64Template(hipblasZdotc,
+                                              hipblasZdotcStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batchCount,
+                                              result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasum_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    ILP64_NATIVE(hipblasSasum_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<false>(hipblasSasum, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    ILP64_NATIVE(hipblasDasum_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<false>(hipblasDasum, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    ILP64_NATIVE(hipblasScasum_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<false>(hipblasScasum, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    ILP64_NATIVE(hipblasDzasum_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<false>(hipblasDzasum, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+try
+{
+    ILP64_NATIVE(hipblasSasumBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<false>(
+        hipblasSasum, hipblasSasumBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+try
+{
+    ILP64_NATIVE(hipblasDasumBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<false>(
+        hipblasDasum, hipblasDasumBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+try
+{
+    ILP64_NATIVE(hipblasScasumBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<false>(
+        hipblasScasum, hipblasScasumBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+try
+{
+    ILP64_NATIVE(hipblasDzasumBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<false>(
+        hipblasDzasum, hipblasDzasumBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+try
+{
+    ILP64_NATIVE(
+        hipblasSasumStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<false>(
+        hipblasSasum, hipblasSasumStridedBatched, handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+try
+{
+    ILP64_NATIVE(
+        hipblasDasumStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<false>(
+        hipblasDasum, hipblasDasumStridedBatched, handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+try
+{
+    ILP64_NATIVE(
+        hipblasScasumStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<false>(hipblasScasum,
+                                                          hipblasScasumStridedBatched,
+                                                          handle,
+                                                          n,
+                                                          x,
+                                                          incx,
+                                                          stridex,
+                                                          batchCount,
+                                                          result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+try
+{
+    ILP64_NATIVE(
+        hipblasDzasumStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<false>(hipblasDzasum,
+                                                          hipblasDzasumStridedBatched,
+                                                          handle,
+                                                          n,
+                                                          x,
+                                                          incx,
+                                                          stridex,
+                                                          batchCount,
+                                                          result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    ILP64_NATIVE(hipblasSnrm2_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<true>(hipblasSnrm2, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    ILP64_NATIVE(hipblasDnrm2_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<true>(hipblasDnrm2, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    ILP64_NATIVE(hipblasScnrm2_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<true>(hipblasScnrm2, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    ILP64_NATIVE(hipblasDznrm2_64Backend(handle, n, x, incx, result));
+    return hipblasAsumNrm264Template<true>(hipblasDznrm2, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+try
+{
+    ILP64_NATIVE(hipblasSnrm2Batched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<true>(
+        hipblasSnrm2, hipblasSnrm2Batched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+try
+{
+    ILP64_NATIVE(hipblasDnrm2Batched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<true>(
+        hipblasDnrm2, hipblasDnrm2Batched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+try
+{
+    ILP64_NATIVE(hipblasScnrm2Batched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<true>(
+        hipblasScnrm2, hipblasScnrm2Batched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+try
+{
+    ILP64_NATIVE(hipblasDznrm2Batched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasAsumNrm2Batched64Template<true>(
+        hipblasDznrm2, hipblasDznrm2Batched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+try
+{
+    ILP64_NATIVE(
+        hipblasSnrm2StridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<true>(
+        hipblasSnrm2, hipblasSnrm2StridedBatched, handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+try
+{
+    ILP64_NATIVE(
+        hipblasDnrm2StridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<true>(
+        hipblasDnrm2, hipblasDnrm2StridedBatched, handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+try
+{
+    ILP64_NATIVE(
+        hipblasScnrm2StridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<true>(hipblasScnrm2,
+                                                         hipblasScnrm2StridedBatched,
+                                                         handle,
+                                                         n,
+                                                         x,
+                                                         incx,
+                                                         stridex,
+                                                         batchCount,
+                                                         result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+try
+{
+    ILP64_NATIVE(
+        hipblasDznrm2StridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasAsumNrm2StridedBatched64Template<true>(hipblasDznrm2,
+                                                         hipblasDznrm2StridedBatched,
+                                                         handle,
+                                                         n,
+                                                         x,
+                                                         incx,
+                                                         stridex,
+                                                         batchCount,
+                                                         result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIsamax_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<true>(hipblasIsamax, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIdamax_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<true>(hipblasIdamax, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIcamax_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<true>(hipblasIcamax, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIzamax_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<true>(hipblasIzamax, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    ILP64_NATIVE(hipblasIsamaxBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<true>(
+        hipblasIsamax, hipblasIsamaxBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    ILP64_NATIVE(hipblasIdamaxBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<true>(
+        hipblasIdamax, hipblasIdamaxBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    ILP64_NATIVE(hipblasIcamaxBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<true>(
+        hipblasIcamax, hipblasIcamaxBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    ILP64_NATIVE(hipblasIzamaxBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<true>(
+        hipblasIzamax, hipblasIzamaxBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIsamaxStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<true>(hipblasIsamax,
+                                                           hipblasIsamaxStridedBatched,
+                                                           handle,
+                                                           n,
+                                                           x,
+                                                           incx,
+                                                           stridex,
+                                                           batchCount,
+                                                           result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIdamaxStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<true>(hipblasIdamax,
+                                                           hipblasIdamaxStridedBatched,
+                                                           handle,
+                                                           n,
+                                                           x,
+                                                           incx,
+                                                           stridex,
+                                                           batchCount,
+                                                           result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIcamaxStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<true>(hipblasIcamax,
+                                                           hipblasIcamaxStridedBatched,
+                                                           handle,
+                                                           n,
+                                                           x,
+                                                           incx,
+                                                           stridex,
+                                                           batchCount,
+                                                           result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIzamaxStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<true>(hipblasIzamax,
+                                                           hipblasIzamaxStridedBatched,
+                                                           handle,
+                                                           n,
+                                                           x,
+                                                           incx,
+                                                           stridex,
+                                                           batchCount,
+                                                           result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIsamin_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<false>(hipblasIsamin, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIdamin_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<false>(hipblasIdamin, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIcamin_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<false>(hipblasIcamin, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    ILP64_NATIVE(hipblasIzamin_64Backend(handle, n, x, incx, result));
+    return hipblasIamaxIamin64Template<false>(hipblasIzamin, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsaminBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    ILP64_NATIVE(hipblasIsaminBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<false>(
+        hipblasIsamin, hipblasIsaminBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdaminBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    ILP64_NATIVE(hipblasIdaminBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<false>(
+        hipblasIdamin, hipblasIdaminBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    ILP64_NATIVE(hipblasIcaminBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<false>(
+        hipblasIcamin, hipblasIcaminBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    ILP64_NATIVE(hipblasIzaminBatched_64Backend(handle, n, x, incx, batchCount, result));
+    return hipblasIamaxIaminBatched64Template<false>(
+        hipblasIzamin, hipblasIzaminBatched, handle, n, x, incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIsaminStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<false>(hipblasIsamin,
+                                                            hipblasIsaminStridedBatched,
+                                                            handle,
+                                                            n,
+                                                            x,
+                                                            incx,
+                                                            stridex,
+                                                            batchCount,
+                                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIdaminStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<false>(hipblasIdamin,
+                                                            hipblasIdaminStridedBatched,
+                                                            handle,
+                                                            n,
+                                                            x,
+                                                            incx,
+                                                            stridex,
+                                                            batchCount,
+                                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIcaminStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<false>(hipblasIcamin,
+                                                            hipblasIcaminStridedBatched,
+                                                            handle,
+                                                            n,
+                                                            x,
+                                                            incx,
+                                                            stridex,
+                                                            batchCount,
+                                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    ILP64_NATIVE(
+        hipblasIzaminStridedBatched_64Backend(handle, n, x, incx, stridex, batchCount, result));
+    return hipblasIamaxIaminStridedBatched64Template<false>(hipblasIzamin,
+                                                            hipblasIzaminStridedBatched,
+                                                            handle,
+                                                            n,
+                                                            x,
+                                                            incx,
+                                                            stridex,
+                                                            batchCount,
+                                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               float*          x,
+                               int64_t         incx,
+                               float*          y,
+                               int64_t         incy,
+                               const float*    c,
+                               const float*    s)
+try
+{
+    ILP64_NATIVE(hipblasSrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasSrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               double*         x,
+                               int64_t         incx,
+                               double*         y,
+                               int64_t         incy,
+                               const double*   c,
+                               const double*   s)
+try
+{
+    ILP64_NATIVE(hipblasDrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasDrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                               int64_t               n,
+                               hipblasComplex*       x,
+                               int64_t               incx,
+                               hipblasComplex*       y,
+                               int64_t               incy,
+                               const float*          c,
+                               const hipblasComplex* s)
+try
+{
+    ILP64_NATIVE(hipblasCrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasCrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy,
+                                const float*    c,
+                                const float*    s)
+try
+{
+    ILP64_NATIVE(hipblasCsrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasCsrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                               int64_t                     n,
+                               hipblasDoubleComplex*       x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       y,
+                               int64_t                     incy,
+                               const double*               c,
+                               const hipblasDoubleComplex* s)
+try
+{
+    ILP64_NATIVE(hipblasZrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasZrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy,
+                                const double*         c,
+                                const double*         s)
+try
+{
+    ILP64_NATIVE(hipblasZdrot_64Backend(handle, n, x, incx, y, incy, c, s));
+    return hipblasRot64Template(hipblasZdrot, handle, n, x, incx, y, incy, c, s);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      float* const    x[],
+                                      int64_t         incx,
+                                      float* const    y[],
+                                      int64_t         incy,
+                                      const float*    c,
+                                      const float*    s,
+                                      int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasSrot, hipblasSrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      double* const   x[],
+                                      int64_t         incx,
+                                      double* const   y[],
+                                      int64_t         incy,
+                                      const double*   c,
+                                      const double*   s,
+                                      int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasDrot, hipblasDrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                      int64_t               n,
+                                      hipblasComplex* const x[],
+                                      int64_t               incx,
+                                      hipblasComplex* const y[],
+                                      int64_t               incy,
+                                      const float*          c,
+                                      const hipblasComplex* s,
+                                      int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasCrot, hipblasCrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       const float*          c,
+                                       const float*          s,
+                                       int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasCsrot, hipblasCsrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                      int64_t                     n,
+                                      hipblasDoubleComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex* const y[],
+                                      int64_t                     incy,
+                                      const double*               c,
+                                      const hipblasDoubleComplex* s,
+                                      int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasZrot, hipblasZrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       const double*               c,
+                                       const double*               s,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZdrotBatched_64Backend(handle, n, x, incx, y, incy, c, s, batchCount));
+    return hipblasRotBatched64Template(
+        hipblasZdrot, hipblasZdrotBatched, handle, n, x, incx, y, incy, c, s, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             float*          x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             float*          y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const float*    c,
+                                             const float*    s,
+                                             int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSrotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     c,
+                                                     s,
+                                                     batchCount));
+    return hipblasRotStridedBatched64Template(hipblasSrot,
+                                              hipblasSrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             double*         x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             double*         y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const double*   c,
+                                             const double*   s,
+                                             int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDrotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     c,
+                                                     s,
+                                                     batchCount));
+    return hipblasRotStridedBatched64Template(hipblasDrot,
+                                              hipblasDrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                             int64_t               n,
+                                             hipblasComplex*       x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       y,
+                                             int64_t               incy,
+                                             hipblasStride         stridey,
+                                             const float*          c,
+                                             const hipblasComplex* s,
+                                             int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCrotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     c,
+                                                     s,
+                                                     batchCount));
+    return hipblasRotStridedBatched64Template(hipblasCrot,
+                                              hipblasCrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const float*    c,
+                                              const float*    s,
+                                              int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsrotStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+    return hipblasRotStridedBatched64Template(hipblasCsrot,
+                                              hipblasCsrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                             int64_t                     n,
+                                             hipblasDoubleComplex*       x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       y,
+                                             int64_t                     incy,
+                                             hipblasStride               stridey,
+                                             const double*               c,
+                                             const hipblasDoubleComplex* s,
+                                             int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZrotStridedBatched_64Backend(handle,
+                                                     n,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     c,
+                                                     s,
+                                                     batchCount));
+    return hipblasRotStridedBatched64Template(hipblasZrot,
+                                              hipblasZrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              const double*         c,
+                                              const double*         s,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZdrotStridedBatched_64Backend(handle,
+                                                      n,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+    return hipblasRotStridedBatched64Template(hipblasZdrot,
+                                              hipblasZdrotStridedBatched,
+                                              handle,
+                                              n,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              c,
+                                              s,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       x,
+                                int64_t            incx,
+                                const float*       beta,
+                                float*             y,
+                                int64_t            incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasSgemv_64Backend(handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy));
+    return hipblasGemv64Template(
+        hipblasSgemv, handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      x,
+                                int64_t            incx,
+                                const double*      beta,
+                                double*            y,
+                                int64_t            incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasDgemv_64Backend(handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy));
+    return hipblasGemv64Template(
+        hipblasDgemv, handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasCgemv_64Backend(handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy));
+    return hipblasGemv64Template(
+        hipblasCgemv, handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasZgemv_64Backend(handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy));
+    return hipblasGemv64Template(
+        hipblasZgemv, handle, trans, m, n, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgemvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGemvBatched64Template(hipblasSgemv,
+                                        hipblasSgemvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  trans,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgemvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGemvBatched64Template(hipblasDgemv,
+                                        hipblasDgemvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgemvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGemvBatched64Template(hipblasCgemv,
+                                        hipblasCgemvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                trans,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgemvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGemvBatched64Template(hipblasZgemv,
+                                        hipblasZgemvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgemvStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGemvStridedBatched64Template(hipblasSgemv,
+                                               hipblasSgemvStridedBatched,
+                                               handle,
+                                               transA,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgemvStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGemvStridedBatched64Template(hipblasDgemv,
+                                               hipblasDgemvStridedBatched,
+                                               handle,
+                                               transA,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgemvStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGemvStridedBatched64Template(hipblasCgemv,
+                                               hipblasCgemvStridedBatched,
+                                               handle,
+                                               transA,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgemvStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGemvStridedBatched64Template(hipblasZgemv,
+                                               hipblasZgemvStridedBatched,
+                                               handle,
+                                               transA,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgbmv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            kl,
+                                int64_t            ku,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       x,
+                                int64_t            incx,
+                                const float*       beta,
+                                float*             y,
+                                int64_t            incy)
+try
+{
+    ILP64_NATIVE(hipblasSgbmv_64Backend(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy));
+    return hipblasGbmv64Template(hipblasSgbmv,
+                                 hipblasSscal,
+                                 handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 alpha,
+                                 AP,
+                                 lda,
+                                 x,
+                                 incx,
+                                 beta,
+                                 y,
+                                 incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbmv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            kl,
+                                int64_t            ku,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      x,
+                                int64_t            incx,
+                                const double*      beta,
+                                double*            y,
+                                int64_t            incy)
+try
+{
+    ILP64_NATIVE(hipblasDgbmv_64Backend(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy));
+    return hipblasGbmv64Template(hipblasDgbmv,
+                                 hipblasDscal,
+                                 handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 alpha,
+                                 AP,
+                                 lda,
+                                 x,
+                                 incx,
+                                 beta,
+                                 y,
+                                 incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbmv_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int64_t               m,
+                                int64_t               n,
+                                int64_t               kl,
+                                int64_t               ku,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasCgbmv_64Backend(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy));
+    return hipblasGbmv64Template(hipblasCgbmv,
+                                 hipblasCscal,
+                                 handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 alpha,
+                                 AP,
+                                 lda,
+                                 x,
+                                 incx,
+                                 beta,
+                                 y,
+                                 incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbmv_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int64_t                     m,
+                                int64_t                     n,
+                                int64_t                     kl,
+                                int64_t                     ku,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZgbmv_64Backend(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy));
+    return hipblasGbmv64Template(hipblasZgbmv,
+                                 hipblasZscal,
+                                 handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 alpha,
+                                 AP,
+                                 lda,
+                                 x,
+                                 incx,
+                                 beta,
+                                 y,
+                                 incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgbmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            kl,
+                                       int64_t            ku,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgbmvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGbmvBatched64Template(hipblasSgbmv,
+                                        hipblasSscal,
+                                        hipblasSgbmvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  trans,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       int64_t             kl,
+                                       int64_t             ku,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgbmvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGbmvBatched64Template(hipblasDgbmv,
+                                        hipblasDscal,
+                                        hipblasDgbmvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     kl,
+                                       int64_t                     ku,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgbmvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGbmvBatched64Template(hipblasCgbmv,
+                                        hipblasCscal,
+                                        hipblasCgbmvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                trans,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       int64_t                           kl,
+                                       int64_t                           ku,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgbmvBatched_64Backend(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    return hipblasGbmvBatched64Template(hipblasZgbmv,
+                                        hipblasZscal,
+                                        hipblasZgbmvBatched,
+                                        handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        x,
+                                        incx,
+                                        beta,
+                                        y,
+                                        incy,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            kl,
+                                              int64_t            ku,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgbmvStridedBatched_64Backend(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGbmvStridedBatched64Template(hipblasSgbmv,
+                                               hipblasSscal,
+                                               hipblasSgbmvStridedBatched,
+                                               handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            kl,
+                                              int64_t            ku,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgbmvStridedBatched_64Backend(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGbmvStridedBatched64Template(hipblasDgbmv,
+                                               hipblasDscal,
+                                               hipblasDgbmvStridedBatched,
+                                               handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    trans,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               kl,
+                                              int64_t               ku,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgbmvStridedBatched_64Backend(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGbmvStridedBatched64Template(hipblasCgbmv,
+                                               hipblasCscal,
+                                               hipblasCgbmvStridedBatched,
+                                               handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     kl,
+                                              int64_t                     ku,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgbmvStridedBatched_64Backend(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    return hipblasGbmvStridedBatched64Template(hipblasZgbmv,
+                                               hipblasZscal,
+                                               hipblasZgbmvStridedBatched,
+                                               handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               y,
+                                               incy,
+                                               stridey,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSger_64(hipblasHandle_t handle,
+                               int64_t         m,
+                               int64_t         n,
+                               const float*    alpha,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          AP,
+                               int64_t         lda)
+try
+{
+    ILP64_NATIVE(hipblasSger_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSger(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDger_64(hipblasHandle_t handle,
+                               int64_t         m,
+                               int64_t         n,
+                               const double*   alpha,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         AP,
+                               int64_t         lda)
+try
+{
+    ILP64_NATIVE(hipblasDger_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDger(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgerBatched_64(hipblasHandle_t    handle,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const float*       alpha,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      const float* const y[],
+                                      int64_t            incy,
+                                      float* const       AP[],
+                                      int64_t            lda,
+                                      int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasSgerBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSgerBatched(handle,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  x + first,
+                                  int(incx),
+                                  y + first,
+                                  int(incy),
+                                  AP + first,
+                                  int(lda),
+                                  count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgerBatched_64(hipblasHandle_t     handle,
+                                      int64_t             m,
+                                      int64_t             n,
+                                      const double*       alpha,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      const double* const y[],
+                                      int64_t             incy,
+                                      double* const       AP[],
+                                      int64_t             lda,
+                                      int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDgerBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDgerBatched(handle,
+                                  int(m),
+                                  int(n),
+                                  alpha,
+                                  x + first,
+                                  int(incx),
+                                  y + first,
+                                  int(incy),
+                                  AP + first,
+                                  int(lda),
+                                  count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgerStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         m,
+                                             int64_t         n,
+                                             const float*    alpha,
+                                             const float*    x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const float*    y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             float*          AP,
+                                             int64_t         lda,
+                                             hipblasStride   strideA,
+                                             int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgerStridedBatched_64Backend(handle,
+                                                     m,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSgerStridedBatched(handle,
+                                         int(m),
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         y + first * stridey,
+                                         int(incy),
+                                         stridey,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgerStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         m,
+                                             int64_t         n,
+                                             const double*   alpha,
+                                             const double*   x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const double*   y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             double*         AP,
+                                             int64_t         lda,
+                                             hipblasStride   strideA,
+                                             int64_t         batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgerStridedBatched_64Backend(handle,
+                                                     m,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     y,
+                                                     incy,
+                                                     stridey,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDgerStridedBatched(handle,
+                                         int(m),
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         y + first * stridey,
+                                         int(incy),
+                                         stridey,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeru_64(hipblasHandle_t       handle,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       AP,
+                                int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCgeru_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCgeru(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeru_64(hipblasHandle_t             handle,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       AP,
+                                int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZgeru_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZgeru(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeruBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       hipblasComplex* const       AP[],
+                                       int64_t                     lda,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCgeruBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgeruBatched(handle,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeruBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       hipblasDoubleComplex* const       AP[],
+                                       int64_t                           lda,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZgeruBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgeruBatched(handle,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeruStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgeruStridedBatched_64Backend(handle,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgeruStridedBatched(handle,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeruStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgeruStridedBatched_64Backend(handle,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgeruStridedBatched(handle,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgerc_64(hipblasHandle_t       handle,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       AP,
+                                int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCgerc_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCgerc(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgerc_64(hipblasHandle_t             handle,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       AP,
+                                int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZgerc_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZgerc(handle, int(m), int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgercBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       hipblasComplex* const       AP[],
+                                       int64_t                     lda,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCgercBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgercBatched(handle,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgercBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       hipblasDoubleComplex* const       AP[],
+                                       int64_t                           lda,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZgercBatched_64Backend(handle, m, n, alpha, x, incx, y, incy, AP, lda, batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgercBatched(handle,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgercStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgercStridedBatched_64Backend(handle,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgercStridedBatched(handle,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgercStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgercStridedBatched_64Backend(handle,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgercStridedBatched(handle,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChbmv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasChbmv_64Backend(handle, uplo, n, k, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChbmv(
+        handle, uplo, int(n), int(k), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhbmv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasZhbmv_64Backend(handle, uplo, n, k, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhbmv(
+        handle, uplo, int(n), int(k), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChbmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChbmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChbmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhbmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhbmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhbmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChbmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChbmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhbmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhbmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasChemv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChemv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZhemv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhemv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChemvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChemvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhemvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhemvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChemvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChemvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhemvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhemvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher_64(hipblasHandle_t       handle,
+                               hipblasFillMode_t     uplo,
+                               int64_t               n,
+                               const float*          alpha,
+                               const hipblasComplex* x,
+                               int64_t               incx,
+                               hipblasComplex*       AP,
+                               int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCher_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCher(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher_64(hipblasHandle_t             handle,
+                               hipblasFillMode_t           uplo,
+                               int64_t                     n,
+                               const double*               alpha,
+                               const hipblasDoubleComplex* x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       AP,
+                               int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZher_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZher(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherBatched_64(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const float*                alpha,
+                                      const hipblasComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasComplex* const       AP[],
+                                      int64_t                     lda,
+                                      int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCherBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCherBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherBatched_64(hipblasHandle_t                   handle,
+                                      hipblasFillMode_t                 uplo,
+                                      int64_t                           n,
+                                      const double*                     alpha,
+                                      const hipblasDoubleComplex* const x[],
+                                      int64_t                           incx,
+                                      hipblasDoubleComplex* const       AP[],
+                                      int64_t                           lda,
+                                      int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZherBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZherBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherStridedBatched_64(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int64_t               n,
+                                             const float*          alpha,
+                                             const hipblasComplex* x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       AP,
+                                             int64_t               lda,
+                                             hipblasStride         strideA,
+                                             int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCherStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCherStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherStridedBatched_64(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const double*               alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       AP,
+                                             int64_t                     lda,
+                                             hipblasStride               strideA,
+                                             int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZherStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZherStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       AP,
+                                int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCher2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCher2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       AP,
+                                int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZher2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZher2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2Batched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       hipblasComplex* const       AP[],
+                                       int64_t                     lda,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCher2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCher2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2Batched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       hipblasDoubleComplex* const       AP[],
+                                       int64_t                           lda,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZher2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZher2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2StridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCher2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCher2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2StridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZher2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZher2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpmv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasChpmv_64Backend(handle, uplo, n, alpha, AP, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChpmv(handle, uplo, int(n), alpha, AP, x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpmv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZhpmv_64Backend(handle, uplo, n, alpha, AP, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhpmv(handle, uplo, int(n), alpha, AP, x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChpmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChpmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhpmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhpmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChpmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhpmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpr_64(hipblasHandle_t       handle,
+                               hipblasFillMode_t     uplo,
+                               int64_t               n,
+                               const float*          alpha,
+                               const hipblasComplex* x,
+                               int64_t               incx,
+                               hipblasComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasChpr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChpr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr_64(hipblasHandle_t             handle,
+                               hipblasFillMode_t           uplo,
+                               int64_t                     n,
+                               const double*               alpha,
+                               const hipblasDoubleComplex* x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasZhpr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhpr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChprBatched_64(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const float*                alpha,
+                                      const hipblasComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasComplex* const       AP[],
+                                      int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhprBatched_64(hipblasHandle_t                   handle,
+                                      hipblasFillMode_t                 uplo,
+                                      int64_t                           n,
+                                      const double*                     alpha,
+                                      const hipblasDoubleComplex* const x[],
+                                      int64_t                           incx,
+                                      hipblasDoubleComplex* const       AP[],
+                                      int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChprStridedBatched_64(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int64_t               n,
+                                             const float*          alpha,
+                                             const hipblasComplex* x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       AP,
+                                             hipblasStride         strideA,
+                                             int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhprStridedBatched_64(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const double*               alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       AP,
+                                             hipblasStride               strideA,
+                                             int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpr2_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasChpr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChpr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr2_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasZhpr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhpr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpr2Batched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       hipblasComplex* const       AP[],
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasChpr2Batched_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChpr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr2Batched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       hipblasDoubleComplex* const       AP[],
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZhpr2Batched_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhpr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpr2StridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              hipblasComplex*       AP,
+                                              hipblasStride         strideA,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChpr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChpr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr2StridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              hipblasDoubleComplex*       AP,
+                                              hipblasStride               strideA,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhpr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhpr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsbmv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                int64_t           k,
+                                const float*      alpha,
+                                const float*      AP,
+                                int64_t           lda,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      beta,
+                                float*            y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasSsbmv_64Backend(handle, uplo, n, k, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsbmv(
+        handle, uplo, int(n), int(k), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsbmv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                int64_t           k,
+                                const double*     alpha,
+                                const double*     AP,
+                                int64_t           lda,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     beta,
+                                double*           y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(
+        hipblasDsbmv_64Backend(handle, uplo, n, k, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsbmv(
+        handle, uplo, int(n), int(k), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsbmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsbmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsbmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsbmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsbmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsbmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              int64_t           k,
+                                              const float*      alpha,
+                                              const float*      AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const float*      beta,
+                                              float*            y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsbmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              int64_t           k,
+                                              const double*     alpha,
+                                              const double*     AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const double*     beta,
+                                              double*           y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsbmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspmv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      AP,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      beta,
+                                float*            y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(hipblasSspmv_64Backend(handle, uplo, n, alpha, AP, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSspmv(handle, uplo, int(n), alpha, AP, x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspmv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     AP,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     beta,
+                                double*           y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(hipblasDspmv_64Backend(handle, uplo, n, alpha, AP, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDspmv(handle, uplo, int(n), alpha, AP, x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSspmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSspmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDspmvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDspmvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspmvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      AP,
+                                              hipblasStride     strideA,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const float*      beta,
+                                              float*            y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSspmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSspmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspmvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     AP,
+                                              hipblasStride     strideA,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const double*     beta,
+                                              double*           y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDspmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDspmvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspr_64(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int64_t           n,
+                               const float*      alpha,
+                               const float*      x,
+                               int64_t           incx,
+                               float*            AP)
+try
+{
+    ILP64_NATIVE(hipblasSspr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSspr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr_64(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int64_t           n,
+                               const double*     alpha,
+                               const double*     x,
+                               int64_t           incx,
+                               double*           AP)
+try
+{
+    ILP64_NATIVE(hipblasDspr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDspr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCspr_64(hipblasHandle_t       handle,
+                               hipblasFillMode_t     uplo,
+                               int64_t               n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* x,
+                               int64_t               incx,
+                               hipblasComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasCspr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCspr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZspr_64(hipblasHandle_t             handle,
+                               hipblasFillMode_t           uplo,
+                               int64_t                     n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       AP)
+try
+{
+    ILP64_NATIVE(hipblasZspr_64Backend(handle, uplo, n, alpha, x, incx, AP));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZspr(handle, uplo, int(n), alpha, x, int(incx), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsprBatched_64(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      int64_t            n,
+                                      const float*       alpha,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      float* const       AP[],
+                                      int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsprBatched_64(hipblasHandle_t     handle,
+                                      hipblasFillMode_t   uplo,
+                                      int64_t             n,
+                                      const double*       alpha,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      double* const       AP[],
+                                      int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsprBatched_64(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasComplex*       alpha,
+                                      const hipblasComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasComplex* const       AP[],
+                                      int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsprBatched_64(hipblasHandle_t                   handle,
+                                      hipblasFillMode_t                 uplo,
+                                      int64_t                           n,
+                                      const hipblasDoubleComplex*       alpha,
+                                      const hipblasDoubleComplex* const x[],
+                                      int64_t                           incx,
+                                      hipblasDoubleComplex* const       AP[],
+                                      int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsprBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsprBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsprStridedBatched_64(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const float*      alpha,
+                                             const float*      x,
+                                             int64_t           incx,
+                                             hipblasStride     stridex,
+                                             float*            AP,
+                                             hipblasStride     strideA,
+                                             int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsprStridedBatched_64(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const double*     alpha,
+                                             const double*     x,
+                                             int64_t           incx,
+                                             hipblasStride     stridex,
+                                             double*           AP,
+                                             hipblasStride     strideA,
+                                             int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsprStridedBatched_64(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int64_t               n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       AP,
+                                             hipblasStride         strideA,
+                                             int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsprStridedBatched_64(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       AP,
+                                             hipblasStride               strideA,
+                                             int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsprStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsprStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspr2_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      y,
+                                int64_t           incy,
+                                float*            AP)
+try
+{
+    ILP64_NATIVE(hipblasSspr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSspr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr2_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     y,
+                                int64_t           incy,
+                                double*           AP)
+try
+{
+    ILP64_NATIVE(hipblasDspr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDspr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspr2Batched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float* const y[],
+                                       int64_t            incy,
+                                       float* const       AP[],
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasSspr2Batched_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSspr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr2Batched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double* const y[],
+                                       int64_t             incy,
+                                       double* const       AP[],
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDspr2Batched_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDspr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspr2StridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const float*      y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              float*            AP,
+                                              hipblasStride     strideA,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSspr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSspr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr2StridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const double*     y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              double*           AP,
+                                              hipblasStride     strideA,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDspr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDspr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      AP,
+                                int64_t           lda,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      beta,
+                                float*            y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(hipblasSsymv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsymv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     AP,
+                                int64_t           lda,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     beta,
+                                double*           y,
+                                int64_t           incy)
+try
+{
+    ILP64_NATIVE(hipblasDsymv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsymv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    ILP64_NATIVE(hipblasCsymv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsymv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    ILP64_NATIVE(hipblasZsymv_64Backend(handle, uplo, n, alpha, AP, lda, x, incx, beta, y, incy));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsymv(
+        handle, uplo, int(n), alpha, AP, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsymvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsymvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsymvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsymvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsymvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsymvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsymvBatched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               beta,
+                                               y,
+                                               incy,
+                                               batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsymvBatched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   beta,
+                                   y + first,
+                                   int(incy),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const float*      beta,
+                                              float*            y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsymvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsymvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymvStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const double*     beta,
+                                              double*           y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsymvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsymvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsymvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsymvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsymvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      beta,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      batchCount));
+    if(!ilp64_is_int({n, lda, incx, incy}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsymvStridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          beta,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr_64(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int64_t           n,
+                               const float*      alpha,
+                               const float*      x,
+                               int64_t           incx,
+                               float*            AP,
+                               int64_t           lda)
+try
+{
+    ILP64_NATIVE(hipblasSsyr_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsyr(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr_64(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int64_t           n,
+                               const double*     alpha,
+                               const double*     x,
+                               int64_t           incx,
+                               double*           AP,
+                               int64_t           lda)
+try
+{
+    ILP64_NATIVE(hipblasDsyr_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsyr(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr_64(hipblasHandle_t       handle,
+                               hipblasFillMode_t     uplo,
+                               int64_t               n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* x,
+                               int64_t               incx,
+                               hipblasComplex*       AP,
+                               int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCsyr_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsyr(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr_64(hipblasHandle_t             handle,
+                               hipblasFillMode_t           uplo,
+                               int64_t                     n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       AP,
+                               int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZsyr_64Backend(handle, uplo, n, alpha, x, incx, AP, lda));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsyr(handle, uplo, int(n), alpha, x, int(incx), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrBatched_64(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      int64_t            n,
+                                      const float*       alpha,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      float* const       AP[],
+                                      int64_t            lda,
+                                      int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasSsyrBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyrBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrBatched_64(hipblasHandle_t     handle,
+                                      hipblasFillMode_t   uplo,
+                                      int64_t             n,
+                                      const double*       alpha,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      double* const       AP[],
+                                      int64_t             lda,
+                                      int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDsyrBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyrBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrBatched_64(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasComplex*       alpha,
+                                      const hipblasComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasComplex* const       AP[],
+                                      int64_t                     lda,
+                                      int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCsyrBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyrBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrBatched_64(hipblasHandle_t                   handle,
+                                      hipblasFillMode_t                 uplo,
+                                      int64_t                           n,
+                                      const hipblasDoubleComplex*       alpha,
+                                      const hipblasDoubleComplex* const x[],
+                                      int64_t                           incx,
+                                      hipblasDoubleComplex* const       AP[],
+                                      int64_t                           lda,
+                                      int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZsyrBatched_64Backend(handle, uplo, n, alpha, x, incx, AP, lda, batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyrBatched(
+            handle, uplo, int(n), alpha, x + first, int(incx), AP + first, int(lda), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrStridedBatched_64(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const float*      alpha,
+                                             const float*      x,
+                                             int64_t           incx,
+                                             hipblasStride     stridex,
+                                             float*            AP,
+                                             int64_t           lda,
+                                             hipblasStride     strideA,
+                                             int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyrStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyrStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrStridedBatched_64(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const double*     alpha,
+                                             const double*     x,
+                                             int64_t           incx,
+                                             hipblasStride     stridex,
+                                             double*           AP,
+                                             int64_t           lda,
+                                             hipblasStride     strideA,
+                                             int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyrStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyrStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrStridedBatched_64(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int64_t               n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       AP,
+                                             int64_t               lda,
+                                             hipblasStride         strideA,
+                                             int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyrStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyrStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrStridedBatched_64(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       AP,
+                                             int64_t                     lda,
+                                             hipblasStride               strideA,
+                                             int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyrStridedBatched_64Backend(handle,
+                                                     uplo,
+                                                     n,
+                                                     alpha,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     AP,
+                                                     lda,
+                                                     strideA,
+                                                     batchCount));
+    if(!ilp64_is_int({n, incx, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyrStridedBatched(handle,
+                                         uplo,
+                                         int(n),
+                                         alpha,
+                                         x + first * stridex,
+                                         int(incx),
+                                         stridex,
+                                         AP + first * strideA,
+                                         int(lda),
+                                         strideA,
+                                         count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      y,
+                                int64_t           incy,
+                                float*            AP,
+                                int64_t           lda)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsyr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     y,
+                                int64_t           incy,
+                                double*           AP,
+                                int64_t           lda)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsyr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       AP,
+                                int64_t               lda)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsyr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       AP,
+                                int64_t                     lda)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2_64Backend(handle, uplo, n, alpha, x, incx, y, incy, AP, lda));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsyr2(handle, uplo, int(n), alpha, x, int(incx), y, int(incy), AP, int(lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2Batched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float* const y[],
+                                       int64_t            incy,
+                                       float* const       AP[],
+                                       int64_t            lda,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2Batched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double* const y[],
+                                       int64_t             incy,
+                                       double* const       AP[],
+                                       int64_t             lda,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2Batched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       hipblasComplex* const       AP[],
+                                       int64_t                     lda,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2Batched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       hipblasDoubleComplex* const       AP[],
+                                       int64_t                           lda,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2Batched_64Backend(handle,
+                                               uplo,
+                                               n,
+                                               alpha,
+                                               x,
+                                               incx,
+                                               y,
+                                               incy,
+                                               AP,
+                                               lda,
+                                               batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyr2Batched(handle,
+                                   uplo,
+                                   int(n),
+                                   alpha,
+                                   x + first,
+                                   int(incx),
+                                   y + first,
+                                   int(incy),
+                                   AP + first,
+                                   int(lda),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const float*      y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              float*            AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const double*     y,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              double*           AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2StridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2StridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2StridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      n,
+                                                      alpha,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      y,
+                                                      incy,
+                                                      stridey,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      batchCount));
+    if(!ilp64_is_int({n, incx, incy, lda}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyr2StridedBatched(handle,
+                                          uplo,
+                                          int(n),
+                                          alpha,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          y + first * stridey,
+                                          int(incy),
+                                          stridey,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            k,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStbmv_64Backend(handle, uplo, transA, diag, m, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasStbmv, hipblasSgbmv, false, handle, uplo, transA, diag, m, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            k,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtbmv_64Backend(handle, uplo, transA, diag, m, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasDtbmv, hipblasDgbmv, false, handle, uplo, transA, diag, m, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbmv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                int64_t               k,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtbmv_64Backend(handle, uplo, transA, diag, m, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasCtbmv, hipblasCgbmv, false, handle, uplo, transA, diag, m, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbmv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtbmv_64Backend(handle, uplo, transA, diag, m, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasZtbmv, hipblasZgbmv, false, handle, uplo, transA, diag, m, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStbmvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasStbmv,
+                                            hipblasSgbmv,
+                                            hipblasStbmvBatched,
+                                            false,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            m,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       int64_t             k,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtbmvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasDtbmv,
+                                            hipblasDgbmv,
+                                            hipblasDtbmvBatched,
+                                            false,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            m,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     k,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtbmvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasCtbmv,
+                                            hipblasCgbmv,
+                                            hipblasCtbmvBatched,
+                                            false,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            m,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtbmvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasZtbmv,
+                                            hipblasZgbmv,
+                                            hipblasZtbmvBatched,
+                                            false,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            m,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            k,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasStbmv,
+                                                   hipblasSgbmv,
+                                                   hipblasStbmvStridedBatched,
+                                                   false,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   m,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            k,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasDtbmv,
+                                                   hipblasDgbmv,
+                                                   hipblasDtbmvStridedBatched,
+                                                   false,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   m,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               k,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasCtbmv,
+                                                   hipblasCgbmv,
+                                                   hipblasCtbmvStridedBatched,
+                                                   false,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   m,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtbmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasZtbmv,
+                                                   hipblasZgbmv,
+                                                   hipblasZtbmvStridedBatched,
+                                                   false,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   m,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStbsv_64Backend(handle, uplo, transA, diag, n, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasStbsv, hipblasSgbmv, true, handle, uplo, transA, diag, n, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtbsv_64Backend(handle, uplo, transA, diag, n, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasDtbsv, hipblasDgbmv, true, handle, uplo, transA, diag, n, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbsv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtbsv_64Backend(handle, uplo, transA, diag, n, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasCtbsv, hipblasCgbmv, true, handle, uplo, transA, diag, n, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbsv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtbsv_64Backend(handle, uplo, transA, diag, n, k, AP, lda, x, incx));
+    return hipblasTbmvTbsv64Template(
+        hipblasZtbsv, hipblasZgbmv, true, handle, uplo, transA, diag, n, k, AP, lda, x, incx);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbsvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStbsvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               n,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasStbsv,
+                                            hipblasSgbmv,
+                                            hipblasStbsvBatched,
+                                            true,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            n,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbsvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtbsvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               n,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasDtbsv,
+                                            hipblasDgbmv,
+                                            hipblasDtbsvBatched,
+                                            true,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            n,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbsvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtbsvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               n,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasCtbsv,
+                                            hipblasCgbmv,
+                                            hipblasCtbsvBatched,
+                                            true,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            n,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbsvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtbsvBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               n,
+                                               k,
+                                               AP,
+                                               lda,
+                                               x,
+                                               incx,
+                                               batchCount));
+    return hipblasTbmvTbsvBatched64Template(hipblasZtbsv,
+                                            hipblasZgbmv,
+                                            hipblasZtbsvBatched,
+                                            true,
+                                            handle,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            n,
+                                            k,
+                                            AP,
+                                            lda,
+                                            x,
+                                            incx,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStbsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      n,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasStbsv,
+                                                   hipblasSgbmv,
+                                                   hipblasStbsvStridedBatched,
+                                                   true,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   n,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtbsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      n,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasDtbsv,
+                                                   hipblasDgbmv,
+                                                   hipblasDtbsvStridedBatched,
+                                                   true,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   n,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbsvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtbsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      n,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasCtbsv,
+                                                   hipblasCgbmv,
+                                                   hipblasCtbsvStridedBatched,
+                                                   true,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   n,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbsvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtbsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      n,
+                                                      k,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    return hipblasTbmvTbsvStridedBatched64Template(hipblasZtbsv,
+                                                   hipblasZgbmv,
+                                                   hipblasZtbsvStridedBatched,
+                                                   true,
+                                                   handle,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   n,
+                                                   k,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const float*       AP,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStpmv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasStpmv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const double*      AP,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtpmv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDtpmv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpmv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                const hipblasComplex* AP,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtpmv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCtpmv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpmv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                const hipblasDoubleComplex* AP,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtpmv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZtpmv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float* const AP[],
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasStpmvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStpmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       const double* const AP[],
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDtpmvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtpmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasComplex* const AP[],
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCtpmvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtpmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       const hipblasDoubleComplex* const AP[],
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZtpmvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtpmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float*       AP,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStpmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const double*      AP,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtpmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              const hipblasComplex* AP,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtpmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasDoubleComplex* AP,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtpmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtpmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const float*       AP,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStpsv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasStpsv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const double*      AP,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtpsv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDtpsv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpsv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                const hipblasComplex* AP,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtpsv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCtpsv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpsv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                const hipblasDoubleComplex* AP,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtpsv_64Backend(handle, uplo, transA, diag, m, AP, x, incx));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZtpsv(handle, uplo, transA, diag, int(m), AP, x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpsvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float* const AP[],
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasStpsvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStpsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpsvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       const double* const AP[],
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDtpsvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtpsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpsvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasComplex* const AP[],
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCtpsvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtpsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpsvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       const hipblasDoubleComplex* const AP[],
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZtpsvBatched_64Backend(handle, uplo, transA, diag, m, AP, x, incx, batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtpsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float*       AP,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStpsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStpsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const double*      AP,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtpsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtpsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpsvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              const hipblasComplex* AP,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtpsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtpsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpsvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasDoubleComplex* AP,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtpsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtpsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStrmv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasStrmv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtrmv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDtrmv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtrmv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCtrmv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtrmv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZtrmv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasStrmvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStrmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDtrmvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtrmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCtrmvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtrmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZtrmvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtrmvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStrmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtrmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtrmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrmvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtrmvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasStrsv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasStrsv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    ILP64_NATIVE(hipblasDtrsv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDtrsv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    ILP64_NATIVE(hipblasCtrsv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCtrsv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    ILP64_NATIVE(hipblasZtrsv_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZtrsv(handle, uplo, transA, diag, int(m), AP, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsvBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasStrsvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStrsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsvBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDtrsvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtrsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsvBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCtrsvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtrsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       x[],
+                                       int64_t                           incx,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZtrsvBatched_64Backend(handle, uplo, transA, diag, m, AP, lda, x, incx, batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtrsvBatched(
+            handle, uplo, transA, diag, int(m), AP + first, int(lda), x + first, int(incx), count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasStrsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDtrsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCtrsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrsvStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      batchCount));
+    if(!ilp64_is_int({m, lda, incx}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZtrsvStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          int(m),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       BP,
+                                int64_t            ldb,
+                                const float*       beta,
+                                float*             CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasSgemm_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc));
+    return hipblasGemm64Template(
+        hipblasSgemm, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      BP,
+                                int64_t            ldb,
+                                const double*      beta,
+                                double*            CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDgemm_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc));
+    return hipblasGemm64Template(
+        hipblasDgemm, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int64_t               m,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* BP,
+                                int64_t               ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    return hipblasGemm64Template(
+        hipblasCgemm, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          transA,
+                                hipblasOperation_t          transB,
+                                int64_t                     m,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* BP,
+                                int64_t                     ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    return hipblasGemm64Template(
+        hipblasZgemm, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const BP[],
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgemmBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasGemmBatched64Template(hipblasSgemm,
+                                        hipblasSgemmBatched,
+                                        handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transA,
+                                       hipblasOperation_t  transB,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const BP[],
+                                       int64_t             ldb,
+                                       const double*       beta,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgemmBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasGemmBatched64Template(hipblasDgemm,
+                                        hipblasDgemmBatched,
+                                        handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const BP[],
+                                       int64_t                     ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    return hipblasGemmBatched64Template(hipblasCgemm,
+                                        hipblasCgemmBatched,
+                                        handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transA,
+                                       hipblasOperation_t                transB,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const BP[],
+                                       int64_t                           ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    return hipblasGemmBatched64Template(hipblasZgemm,
+                                        hipblasZgemmBatched,
+                                        handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        beta,
+                                        CP,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              long long          strideA,
+                                              const float*       BP,
+                                              int64_t            ldb,
+                                              long long          strideB,
+                                              const float*       beta,
+                                              float*             CP,
+                                              int64_t            ldc,
+                                              long long          strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgemmStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasGemmStridedBatched64Template(hipblasSgemm,
+                                               hipblasSgemmStridedBatched,
+                                               handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              long long          strideA,
+                                              const double*      BP,
+                                              int64_t            ldb,
+                                              long long          strideB,
+                                              const double*      beta,
+                                              double*            CP,
+                                              int64_t            ldc,
+                                              long long          strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgemmStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasGemmStridedBatched64Template(hipblasDgemm,
+                                               hipblasDgemmStridedBatched,
+                                               handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              long long             strideA,
+                                              const hipblasComplex* BP,
+                                              int64_t               ldb,
+                                              long long             strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              long long             strideC,
+                                              int64_t               batchCount)
+try
+{
+    return hipblasGemmStridedBatched64Template(hipblasCgemm,
+                                               hipblasCgemmStridedBatched,
+                                               handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              long long                   strideA,
+                                              const hipblasDoubleComplex* BP,
+                                              int64_t                     ldb,
+                                              long long                   strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              long long                   strideC,
+                                              int64_t                     batchCount)
+try
+{
+    return hipblasGemmStridedBatched64Template(hipblasZgemm,
+                                               hipblasZgemmStridedBatched,
+                                               handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherk_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int64_t               n,
+                                int64_t               k,
+                                const float*          alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const float*          beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCherk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasCherk, handle, "hipblasXherk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherk_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const double*               alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const double*               beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZherk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasZherk, handle, "hipblasXherk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const float*                alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const float*                beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCherkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasCherk,
+                                            hipblasCherkBatched,
+                                            handle,
+                                            "hipblasXherkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const double*                     alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const double*                     beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZherkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasZherk,
+                                            hipblasZherkBatched,
+                                            handle,
+                                            "hipblasXherkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const float*          alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const float*          beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCherkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasCherk,
+                                                   hipblasCherkStridedBatched,
+                                                   handle,
+                                                   "hipblasXherkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const double*               alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const double*               beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZherkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasZherk,
+                                                   hipblasZherkStridedBatched,
+                                                   handle,
+                                                   "hipblasXherkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkx_64(hipblasHandle_t       handle,
+                                 hipblasFillMode_t     uplo,
+                                 hipblasOperation_t    transA,
+                                 int64_t               n,
+                                 int64_t               k,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* AP,
+                                 int64_t               lda,
+                                 const hipblasComplex* BP,
+                                 int64_t               ldb,
+                                 const float*          beta,
+                                 hipblasComplex*       CP,
+                                 int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCherkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCherkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkx_64(hipblasHandle_t             handle,
+                                 hipblasFillMode_t           uplo,
+                                 hipblasOperation_t          transA,
+                                 int64_t                     n,
+                                 int64_t                     k,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* AP,
+                                 int64_t                     lda,
+                                 const hipblasDoubleComplex* BP,
+                                 int64_t                     ldb,
+                                 const double*               beta,
+                                 hipblasDoubleComplex*       CP,
+                                 int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZherkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZherkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkxBatched_64(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const AP[],
+                                        int64_t                     lda,
+                                        const hipblasComplex* const BP[],
+                                        int64_t                     ldb,
+                                        const float*                beta,
+                                        hipblasComplex* const       CP[],
+                                        int64_t                     ldc,
+                                        int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCherkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCherkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkxBatched_64(hipblasHandle_t                   handle,
+                                        hipblasFillMode_t                 uplo,
+                                        hipblasOperation_t                transA,
+                                        int64_t                           n,
+                                        int64_t                           k,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const AP[],
+                                        int64_t                           lda,
+                                        const hipblasDoubleComplex* const BP[],
+                                        int64_t                           ldb,
+                                        const double*                     beta,
+                                        hipblasDoubleComplex* const       CP[],
+                                        int64_t                           ldc,
+                                        int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZherkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZherkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkxStridedBatched_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasStride         strideA,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasStride         strideB,
+                                               const float*          beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc,
+                                               hipblasStride         strideC,
+                                               int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCherkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCherkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkxStridedBatched_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasStride               strideA,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasStride               strideB,
+                                               const double*               beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc,
+                                               hipblasStride               strideC,
+                                               int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZherkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZherkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2k_64(hipblasHandle_t       handle,
+                                 hipblasFillMode_t     uplo,
+                                 hipblasOperation_t    transA,
+                                 int64_t               n,
+                                 int64_t               k,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* AP,
+                                 int64_t               lda,
+                                 const hipblasComplex* BP,
+                                 int64_t               ldb,
+                                 const float*          beta,
+                                 hipblasComplex*       CP,
+                                 int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCher2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCher2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2k_64(hipblasHandle_t             handle,
+                                 hipblasFillMode_t           uplo,
+                                 hipblasOperation_t          transA,
+                                 int64_t                     n,
+                                 int64_t                     k,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* AP,
+                                 int64_t                     lda,
+                                 const hipblasDoubleComplex* BP,
+                                 int64_t                     ldb,
+                                 const double*               beta,
+                                 hipblasDoubleComplex*       CP,
+                                 int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZher2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZher2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2kBatched_64(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const AP[],
+                                        int64_t                     lda,
+                                        const hipblasComplex* const BP[],
+                                        int64_t                     ldb,
+                                        const float*                beta,
+                                        hipblasComplex* const       CP[],
+                                        int64_t                     ldc,
+                                        int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCher2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCher2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2kBatched_64(hipblasHandle_t                   handle,
+                                        hipblasFillMode_t                 uplo,
+                                        hipblasOperation_t                transA,
+                                        int64_t                           n,
+                                        int64_t                           k,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const AP[],
+                                        int64_t                           lda,
+                                        const hipblasDoubleComplex* const BP[],
+                                        int64_t                           ldb,
+                                        const double*                     beta,
+                                        hipblasDoubleComplex* const       CP[],
+                                        int64_t                           ldc,
+                                        int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZher2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZher2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2kStridedBatched_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasStride         strideA,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasStride         strideB,
+                                               const float*          beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc,
+                                               hipblasStride         strideC,
+                                               int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCher2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCher2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2kStridedBatched_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasStride               strideA,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasStride               strideB,
+                                               const double*               beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc,
+                                               hipblasStride               strideC,
+                                               int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZher2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZher2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymm_64(hipblasHandle_t   handle,
+                                hipblasSideMode_t side,
+                                hipblasFillMode_t uplo,
+                                int64_t           m,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      AP,
+                                int64_t           lda,
+                                const float*      BP,
+                                int64_t           ldb,
+                                const float*      beta,
+                                float*            CP,
+                                int64_t           ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasSsymm_64Backend(handle, side, uplo, m, n, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsymm(
+        handle, side, uplo, int(m), int(n), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymm_64(hipblasHandle_t   handle,
+                                hipblasSideMode_t side,
+                                hipblasFillMode_t uplo,
+                                int64_t           m,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     AP,
+                                int64_t           lda,
+                                const double*     BP,
+                                int64_t           ldb,
+                                const double*     beta,
+                                double*           CP,
+                                int64_t           ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasDsymm_64Backend(handle, side, uplo, m, n, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsymm(
+        handle, side, uplo, int(m), int(n), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* BP,
+                                int64_t               ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasCsymm_64Backend(handle, side, uplo, m, n, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsymm(
+        handle, side, uplo, int(m), int(n), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* BP,
+                                int64_t                     ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasZsymm_64Backend(handle, side, uplo, m, n, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsymm(
+        handle, side, uplo, int(m), int(n), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymmBatched_64(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const BP[],
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsymmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsymmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymmBatched_64(hipblasHandle_t     handle,
+                                       hipblasSideMode_t   side,
+                                       hipblasFillMode_t   uplo,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const BP[],
+                                       int64_t             ldb,
+                                       const double*       beta,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsymmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsymmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const BP[],
+                                       int64_t                     ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsymmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsymmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const BP[],
+                                       int64_t                           ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsymmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsymmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymmStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasSideMode_t side,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           m,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const float*      BP,
+                                              int64_t           ldb,
+                                              hipblasStride     strideB,
+                                              const float*      beta,
+                                              float*            CP,
+                                              int64_t           ldc,
+                                              hipblasStride     strideC,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsymmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymmStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasSideMode_t side,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           m,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const double*     BP,
+                                              int64_t           ldb,
+                                              hipblasStride     strideB,
+                                              const double*     beta,
+                                              double*           CP,
+                                              int64_t           ldc,
+                                              hipblasStride     strideC,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsymmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* BP,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsymmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* BP,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsymmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrk_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       beta,
+                                float*             CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasSsyrk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasSsyrk, handle, "hipblasXsyrk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrk_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      beta,
+                                double*            CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDsyrk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasDsyrk, handle, "hipblasXsyrk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrk_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCsyrk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasCsyrk, handle, "hipblasXsyrk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrk_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZsyrk_64Backend(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc));
+    return hipblasSyrkHerk64Template(
+        hipblasZsyrk, handle, "hipblasXsyrk_64", uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkBatched_64(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyrkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasSsyrk,
+                                            hipblasSsyrkBatched,
+                                            handle,
+                                            "hipblasXsyrkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkBatched_64(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double*       beta,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyrkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasDsyrk,
+                                            hipblasDsyrkBatched,
+                                            handle,
+                                            "hipblasXsyrkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkBatched_64(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyrkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasCsyrk,
+                                            hipblasCsyrkBatched,
+                                            handle,
+                                            "hipblasXsyrkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkBatched_64(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyrkBatched_64Backend(handle,
+                                               uplo,
+                                               transA,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    return hipblasSyrkHerkBatched64Template(hipblasZsyrk,
+                                            hipblasZsyrkBatched,
+                                            handle,
+                                            "hipblasXsyrkBatched_64",
+                                            uplo,
+                                            transA,
+                                            n,
+                                            k,
+                                            alpha,
+                                            AP,
+                                            lda,
+                                            beta,
+                                            CP,
+                                            ldc,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       beta,
+                                              float*             CP,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyrkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasSsyrk,
+                                                   hipblasSsyrkStridedBatched,
+                                                   handle,
+                                                   "hipblasXsyrkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      beta,
+                                              double*            CP,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyrkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasDsyrk,
+                                                   hipblasDsyrkStridedBatched,
+                                                   handle,
+                                                   "hipblasXsyrkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyrkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasCsyrk,
+                                                   hipblasCsyrkStridedBatched,
+                                                   handle,
+                                                   "hipblasXsyrkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyrkStridedBatched_64Backend(handle,
+                                                      uplo,
+                                                      transA,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasSyrkHerkStridedBatched64Template(hipblasZsyrk,
+                                                   hipblasZsyrkStridedBatched,
+                                                   handle,
+                                                   "hipblasXsyrkStridedBatched_64",
+                                                   uplo,
+                                                   transA,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   AP,
+                                                   lda,
+                                                   strideA,
+                                                   beta,
+                                                   CP,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2k_64(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const float*       alpha,
+                                 const float*       AP,
+                                 int64_t            lda,
+                                 const float*       BP,
+                                 int64_t            ldb,
+                                 const float*       beta,
+                                 float*             CP,
+                                 int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsyr2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2k_64(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const double*      alpha,
+                                 const double*      AP,
+                                 int64_t            lda,
+                                 const double*      BP,
+                                 int64_t            ldb,
+                                 const double*      beta,
+                                 double*            CP,
+                                 int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsyr2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2k_64(hipblasHandle_t       handle,
+                                 hipblasFillMode_t     uplo,
+                                 hipblasOperation_t    transA,
+                                 int64_t               n,
+                                 int64_t               k,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* AP,
+                                 int64_t               lda,
+                                 const hipblasComplex* BP,
+                                 int64_t               ldb,
+                                 const hipblasComplex* beta,
+                                 hipblasComplex*       CP,
+                                 int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsyr2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2k_64(hipblasHandle_t             handle,
+                                 hipblasFillMode_t           uplo,
+                                 hipblasOperation_t          transA,
+                                 int64_t                     n,
+                                 int64_t                     k,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* AP,
+                                 int64_t                     lda,
+                                 const hipblasDoubleComplex* BP,
+                                 int64_t                     ldb,
+                                 const hipblasDoubleComplex* beta,
+                                 hipblasDoubleComplex*       CP,
+                                 int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2k_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsyr2k(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2kBatched_64(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float* const AP[],
+                                        int64_t            lda,
+                                        const float* const BP[],
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float* const       CP[],
+                                        int64_t            ldc,
+                                        int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyr2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2kBatched_64(hipblasHandle_t     handle,
+                                        hipblasFillMode_t   uplo,
+                                        hipblasOperation_t  transA,
+                                        int64_t             n,
+                                        int64_t             k,
+                                        const double*       alpha,
+                                        const double* const AP[],
+                                        int64_t             lda,
+                                        const double* const BP[],
+                                        int64_t             ldb,
+                                        const double*       beta,
+                                        double* const       CP[],
+                                        int64_t             ldc,
+                                        int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyr2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2kBatched_64(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const AP[],
+                                        int64_t                     lda,
+                                        const hipblasComplex* const BP[],
+                                        int64_t                     ldb,
+                                        const hipblasComplex*       beta,
+                                        hipblasComplex* const       CP[],
+                                        int64_t                     ldc,
+                                        int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyr2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2kBatched_64(hipblasHandle_t                   handle,
+                                        hipblasFillMode_t                 uplo,
+                                        hipblasOperation_t                transA,
+                                        int64_t                           n,
+                                        int64_t                           k,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const AP[],
+                                        int64_t                           lda,
+                                        const hipblasDoubleComplex* const BP[],
+                                        int64_t                           ldb,
+                                        const hipblasDoubleComplex*       beta,
+                                        hipblasDoubleComplex* const       CP[],
+                                        int64_t                           ldc,
+                                        int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2kBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyr2kBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               hipblasStride      strideA,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               hipblasStride      strideB,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc,
+                                               hipblasStride      strideC,
+                                               int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyr2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyr2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               hipblasStride      strideA,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               hipblasStride      strideB,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc,
+                                               hipblasStride      strideC,
+                                               int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyr2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyr2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2kStridedBatched_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasStride         strideA,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasStride         strideB,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc,
+                                               hipblasStride         strideC,
+                                               int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyr2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyr2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2kStridedBatched_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasStride               strideA,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasStride               strideB,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc,
+                                               hipblasStride               strideC,
+                                               int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyr2kStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyr2kStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkx_64(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const float*       alpha,
+                                 const float*       AP,
+                                 int64_t            lda,
+                                 const float*       BP,
+                                 int64_t            ldb,
+                                 const float*       beta,
+                                 float*             CP,
+                                 int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasSsyrkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSsyrkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkx_64(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const double*      alpha,
+                                 const double*      AP,
+                                 int64_t            lda,
+                                 const double*      BP,
+                                 int64_t            ldb,
+                                 const double*      beta,
+                                 double*            CP,
+                                 int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDsyrkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDsyrkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkx_64(hipblasHandle_t       handle,
+                                 hipblasFillMode_t     uplo,
+                                 hipblasOperation_t    transA,
+                                 int64_t               n,
+                                 int64_t               k,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* AP,
+                                 int64_t               lda,
+                                 const hipblasComplex* BP,
+                                 int64_t               ldb,
+                                 const hipblasComplex* beta,
+                                 hipblasComplex*       CP,
+                                 int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCsyrkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCsyrkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkx_64(hipblasHandle_t             handle,
+                                 hipblasFillMode_t           uplo,
+                                 hipblasOperation_t          transA,
+                                 int64_t                     n,
+                                 int64_t                     k,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* AP,
+                                 int64_t                     lda,
+                                 const hipblasDoubleComplex* BP,
+                                 int64_t                     ldb,
+                                 const hipblasDoubleComplex* beta,
+                                 hipblasDoubleComplex*       CP,
+                                 int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZsyrkx_64Backend(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         AP,
+                                         lda,
+                                         BP,
+                                         ldb,
+                                         beta,
+                                         CP,
+                                         ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZsyrkx(handle,
+                         uplo,
+                         transA,
+                         int(n),
+                         int(k),
+                         alpha,
+                         AP,
+                         int(lda),
+                         BP,
+                         int(ldb),
+                         beta,
+                         CP,
+                         int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkxBatched_64(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float* const AP[],
+                                        int64_t            lda,
+                                        const float* const BP[],
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float* const       CP[],
+                                        int64_t            ldc,
+                                        int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyrkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyrkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkxBatched_64(hipblasHandle_t     handle,
+                                        hipblasFillMode_t   uplo,
+                                        hipblasOperation_t  transA,
+                                        int64_t             n,
+                                        int64_t             k,
+                                        const double*       alpha,
+                                        const double* const AP[],
+                                        int64_t             lda,
+                                        const double* const BP[],
+                                        int64_t             ldb,
+                                        const double*       beta,
+                                        double* const       CP[],
+                                        int64_t             ldc,
+                                        int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyrkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyrkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkxBatched_64(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const AP[],
+                                        int64_t                     lda,
+                                        const hipblasComplex* const BP[],
+                                        int64_t                     ldb,
+                                        const hipblasComplex*       beta,
+                                        hipblasComplex* const       CP[],
+                                        int64_t                     ldc,
+                                        int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyrkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyrkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkxBatched_64(hipblasHandle_t                   handle,
+                                        hipblasFillMode_t                 uplo,
+                                        hipblasOperation_t                transA,
+                                        int64_t                           n,
+                                        int64_t                           k,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const AP[],
+                                        int64_t                           lda,
+                                        const hipblasDoubleComplex* const BP[],
+                                        int64_t                           ldb,
+                                        const hipblasDoubleComplex*       beta,
+                                        hipblasDoubleComplex* const       CP[],
+                                        int64_t                           ldc,
+                                        int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyrkxBatched_64Backend(handle,
+                                                uplo,
+                                                transA,
+                                                n,
+                                                k,
+                                                alpha,
+                                                AP,
+                                                lda,
+                                                BP,
+                                                ldb,
+                                                beta,
+                                                CP,
+                                                ldc,
+                                                batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyrkxBatched(handle,
+                                    uplo,
+                                    transA,
+                                    int(n),
+                                    int(k),
+                                    alpha,
+                                    AP + first,
+                                    int(lda),
+                                    BP + first,
+                                    int(ldb),
+                                    beta,
+                                    CP + first,
+                                    int(ldc),
+                                    count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               hipblasStride      strideA,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               hipblasStride      strideB,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc,
+                                               hipblasStride      strideC,
+                                               int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSsyrkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSsyrkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               hipblasStride      strideA,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               hipblasStride      strideB,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc,
+                                               hipblasStride      strideC,
+                                               int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDsyrkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDsyrkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkxStridedBatched_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasStride         strideA,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasStride         strideB,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc,
+                                               hipblasStride         strideC,
+                                               int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCsyrkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCsyrkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkxStridedBatched_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasStride               strideA,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasStride               strideB,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc,
+                                               hipblasStride               strideC,
+                                               int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZsyrkxStridedBatched_64Backend(handle,
+                                                       uplo,
+                                                       transA,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       AP,
+                                                       lda,
+                                                       strideA,
+                                                       BP,
+                                                       ldb,
+                                                       strideB,
+                                                       beta,
+                                                       CP,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZsyrkxStridedBatched(handle,
+                                           uplo,
+                                           transA,
+                                           int(n),
+                                           int(k),
+                                           alpha,
+                                           AP + first * strideA,
+                                           int(lda),
+                                           strideA,
+                                           BP + first * strideB,
+                                           int(ldb),
+                                           strideB,
+                                           beta,
+                                           CP + first * strideC,
+                                           int(ldc),
+                                           strideC,
+                                           count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeam_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       beta,
+                                const float*       BP,
+                                int64_t            ldb,
+                                float*             CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasSgeam_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        beta,
+                                        BP,
+                                        ldb,
+                                        CP,
+                                        ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSgeam(handle,
+                        transA,
+                        transB,
+                        int(m),
+                        int(n),
+                        alpha,
+                        AP,
+                        int(lda),
+                        beta,
+                        BP,
+                        int(ldb),
+                        CP,
+                        int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeam_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      beta,
+                                const double*      BP,
+                                int64_t            ldb,
+                                double*            CP,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDgeam_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        beta,
+                                        BP,
+                                        ldb,
+                                        CP,
+                                        ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDgeam(handle,
+                        transA,
+                        transB,
+                        int(m),
+                        int(n),
+                        alpha,
+                        AP,
+                        int(lda),
+                        beta,
+                        BP,
+                        int(ldb),
+                        CP,
+                        int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeam_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* beta,
+                                const hipblasComplex* BP,
+                                int64_t               ldb,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCgeam_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        beta,
+                                        BP,
+                                        ldb,
+                                        CP,
+                                        ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCgeam(handle,
+                        transA,
+                        transB,
+                        int(m),
+                        int(n),
+                        alpha,
+                        AP,
+                        int(lda),
+                        beta,
+                        BP,
+                        int(ldb),
+                        CP,
+                        int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeam_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          transA,
+                                hipblasOperation_t          transB,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* beta,
+                                const hipblasDoubleComplex* BP,
+                                int64_t                     ldb,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZgeam_64Backend(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        beta,
+                                        BP,
+                                        ldb,
+                                        CP,
+                                        ldc));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZgeam(handle,
+                        transA,
+                        transB,
+                        int(m),
+                        int(n),
+                        alpha,
+                        AP,
+                        int(lda),
+                        beta,
+                        BP,
+                        int(ldb),
+                        CP,
+                        int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeamBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       const float* const BP[],
+                                       int64_t            ldb,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgeamBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               BP,
+                                               ldb,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSgeamBatched(handle,
+                                   transA,
+                                   transB,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   beta,
+                                   BP + first,
+                                   int(ldb),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeamBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transA,
+                                       hipblasOperation_t  transB,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double*       beta,
+                                       const double* const BP[],
+                                       int64_t             ldb,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgeamBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               BP,
+                                               ldb,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDgeamBatched(handle,
+                                   transA,
+                                   transB,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   beta,
+                                   BP + first,
+                                   int(ldb),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex*       beta,
+                                       const hipblasComplex* const BP[],
+                                       int64_t                     ldb,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgeamBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               BP,
+                                               ldb,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgeamBatched(handle,
+                                   transA,
+                                   transB,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   beta,
+                                   BP + first,
+                                   int(ldb),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transA,
+                                       hipblasOperation_t                transB,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex*       beta,
+                                       const hipblasDoubleComplex* const BP[],
+                                       int64_t                           ldb,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgeamBatched_64Backend(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               beta,
+                                               BP,
+                                               ldb,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgeamBatched(handle,
+                                   transA,
+                                   transB,
+                                   int(m),
+                                   int(n),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   beta,
+                                   BP + first,
+                                   int(ldb),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeamStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       beta,
+                                              const float*       BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              float*             CP,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSgeamStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSgeamStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          beta,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeamStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      beta,
+                                              const double*      BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              double*            CP,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDgeamStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDgeamStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          beta,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* beta,
+                                              const hipblasComplex* BP,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCgeamStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCgeamStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          beta,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* beta,
+                                              const hipblasDoubleComplex* BP,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZgeamStridedBatched_64Backend(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      beta,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZgeamStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          int(m),
+                                          int(n),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          beta,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* BP,
+                                int64_t               ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasChemm_64Backend(handle, side, uplo, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasChemm(
+        handle, side, uplo, int(n), int(k), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* BP,
+                                int64_t                     ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(
+        hipblasZhemm_64Backend(handle, side, uplo, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZhemm(
+        handle, side, uplo, int(n), int(k), alpha, AP, int(lda), BP, int(ldb), beta, CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const BP[],
+                                       int64_t                     ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChemmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChemmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       hipblasFillMode_t                 uplo,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const BP[],
+                                       int64_t                           ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhemmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               n,
+                                               k,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               beta,
+                                               CP,
+                                               ldc,
+                                               batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhemmBatched(handle,
+                                   side,
+                                   uplo,
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   AP + first,
+                                   int(lda),
+                                   BP + first,
+                                   int(ldb),
+                                   beta,
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* BP,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasChemmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasChemmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* BP,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZhemmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({n, k, lda, ldb, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZhemmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          int(n),
+                                          int(k),
+                                          alpha,
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          BP + first * strideB,
+                                          int(ldb),
+                                          strideB,
+                                          beta,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       A,
+                                int64_t            lda,
+                                const float*       B,
+                                int64_t            ldb,
+                                float*             C,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasStrmm_64Backend(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc));
+    return hipblasTrmm64Template(
+        hipblasStrmm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      A,
+                                int64_t            lda,
+                                const double*      B,
+                                int64_t            ldb,
+                                double*            C,
+                                int64_t            ldc)
+try
+{
+    ILP64_NATIVE(hipblasDtrmm_64Backend(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc));
+    return hipblasTrmm64Template(
+        hipblasDtrmm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const hipblasComplex* B,
+                                int64_t               ldb,
+                                hipblasComplex*       C,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCtrmm_64Backend(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc));
+    return hipblasTrmm64Template(
+        hipblasCtrmm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* B,
+                                int64_t                     ldb,
+                                hipblasDoubleComplex*       C,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZtrmm_64Backend(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc));
+    return hipblasTrmm64Template(
+        hipblasZtrmm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmmBatched_64(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int64_t            lda,
+                                       const float* const B[],
+                                       int64_t            ldb,
+                                       float* const       C[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrmmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               C,
+                                               ldc,
+                                               batchCount));
+    return hipblasTrmmBatched64Template(hipblasStrmm,
+                                        hipblasStrmmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmmBatched_64(hipblasHandle_t     handle,
+                                       hipblasSideMode_t   side,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int64_t             lda,
+                                       const double* const B[],
+                                       int64_t             ldb,
+                                       double* const       C[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrmmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               C,
+                                               ldc,
+                                               batchCount));
+    return hipblasTrmmBatched64Template(hipblasDtrmm,
+                                        hipblasDtrmmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const B[],
+                                       int64_t                     ldb,
+                                       hipblasComplex* const       C[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrmmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               C,
+                                               ldc,
+                                               batchCount));
+    return hipblasTrmmBatched64Template(hipblasCtrmm,
+                                        hipblasCtrmmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int64_t                           ldb,
+                                       hipblasDoubleComplex* const       C[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrmmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               C,
+                                               ldc,
+                                               batchCount));
+    return hipblasTrmmBatched64Template(hipblasZtrmm,
+                                        hipblasZtrmmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        C,
+                                        ldc,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       B,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              float*             C,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      B,
+                                                      ldb,
+                                                      strideB,
+                                                      C,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasTrmmStridedBatched64Template(hipblasStrmm,
+                                               hipblasStrmmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               B,
+                                               ldb,
+                                               strideB,
+                                               C,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      B,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              double*            C,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      B,
+                                                      ldb,
+                                                      strideB,
+                                                      C,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasTrmmStridedBatched64Template(hipblasDtrmm,
+                                               hipblasDtrmmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               B,
+                                               ldb,
+                                               strideB,
+                                               C,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* B,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      B,
+                                                      ldb,
+                                                      strideB,
+                                                      C,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasTrmmStridedBatched64Template(hipblasCtrmm,
+                                               hipblasCtrmmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               B,
+                                               ldb,
+                                               strideB,
+                                               C,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* B,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              hipblasDoubleComplex*       C,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      B,
+                                                      ldb,
+                                                      strideB,
+                                                      C,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    return hipblasTrmmStridedBatched64Template(hipblasZtrmm,
+                                               hipblasZtrmmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               B,
+                                               ldb,
+                                               strideB,
+                                               C,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             BP,
+                                int64_t            ldb)
+try
+{
+    ILP64_NATIVE(
+        hipblasStrsm_64Backend(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb));
+    return hipblasTrsm64Template(
+        hipblasStrsm, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            BP,
+                                int64_t            ldb)
+try
+{
+    ILP64_NATIVE(
+        hipblasDtrsm_64Backend(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb));
+    return hipblasTrsm64Template(
+        hipblasDtrsm, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       BP,
+                                int64_t               ldb)
+try
+{
+    ILP64_NATIVE(
+        hipblasCtrsm_64Backend(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb));
+    return hipblasTrsm64Template(
+        hipblasCtrsm, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       BP,
+                                int64_t                     ldb)
+try
+{
+    ILP64_NATIVE(
+        hipblasZtrsm_64Backend(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb));
+    return hipblasTrsm64Template(
+        hipblasZtrsm, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmBatched_64(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       BP[],
+                                       int64_t            ldb,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrsmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               batchCount));
+    return hipblasTrsmBatched64Template(hipblasStrsm,
+                                        hipblasStrsmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmBatched_64(hipblasHandle_t     handle,
+                                       hipblasSideMode_t   side,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       BP[],
+                                       int64_t             ldb,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrsmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               batchCount));
+    return hipblasTrsmBatched64Template(hipblasDtrsm,
+                                        hipblasDtrsmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       BP[],
+                                       int64_t                     ldb,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrsmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               batchCount));
+    return hipblasTrsmBatched64Template(hipblasCtrsm,
+                                        hipblasCtrsmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       BP[],
+                                       int64_t                           ldb,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrsmBatched_64Backend(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               BP,
+                                               ldb,
+                                               batchCount));
+    return hipblasTrsmBatched64Template(hipblasZtrsm,
+                                        hipblasZtrsmBatched,
+                                        handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        lda,
+                                        BP,
+                                        ldb,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasStrsmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      batchCount));
+    return hipblasTrsmStridedBatched64Template(hipblasStrsm,
+                                               hipblasStrsmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDtrsmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      batchCount));
+    return hipblasTrsmStridedBatched64Template(hipblasDtrsm,
+                                               hipblasDtrsmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       BP,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCtrsmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      batchCount));
+    return hipblasTrsmStridedBatched64Template(hipblasCtrsm,
+                                               hipblasCtrsmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       BP,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZtrsmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      ldb,
+                                                      strideB,
+                                                      batchCount));
+    return hipblasTrsmStridedBatched64Template(hipblasZtrsm,
+                                               hipblasZtrsmStridedBatched,
+                                               handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               AP,
+                                               lda,
+                                               strideA,
+                                               BP,
+                                               ldb,
+                                               strideB,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdgmm_64(hipblasHandle_t   handle,
+                                hipblasSideMode_t side,
+                                int64_t           m,
+                                int64_t           n,
+                                const float*      AP,
+                                int64_t           lda,
+                                const float*      x,
+                                int64_t           incx,
+                                float*            CP,
+                                int64_t           ldc)
+try
+{
+    ILP64_NATIVE(hipblasSdgmm_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasSdgmm(handle, side, int(m), int(n), AP, int(lda), x, int(incx), CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdgmm_64(hipblasHandle_t   handle,
+                                hipblasSideMode_t side,
+                                int64_t           m,
+                                int64_t           n,
+                                const double*     AP,
+                                int64_t           lda,
+                                const double*     x,
+                                int64_t           incx,
+                                double*           CP,
+                                int64_t           ldc)
+try
+{
+    ILP64_NATIVE(hipblasDdgmm_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasDdgmm(handle, side, int(m), int(n), AP, int(lda), x, int(incx), CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdgmm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    ILP64_NATIVE(hipblasCdgmm_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCdgmm(handle, side, int(m), int(n), AP, int(lda), x, int(incx), CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdgmm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    ILP64_NATIVE(hipblasZdgmm_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZdgmm(handle, side, int(m), int(n), AP, int(lda), x, int(incx), CP, int(ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdgmmBatched_64(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasSdgmmBatched_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc, batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSdgmmBatched(handle,
+                                   side,
+                                   int(m),
+                                   int(n),
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdgmmBatched_64(hipblasHandle_t     handle,
+                                       hipblasSideMode_t   side,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasDdgmmBatched_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc, batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDdgmmBatched(handle,
+                                   side,
+                                   int(m),
+                                   int(n),
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdgmmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasCdgmmBatched_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc, batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCdgmmBatched(handle,
+                                   side,
+                                   int(m),
+                                   int(n),
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdgmmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    ILP64_NATIVE(
+        hipblasZdgmmBatched_64Backend(handle, side, m, n, AP, lda, x, incx, CP, ldc, batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZdgmmBatched(handle,
+                                   side,
+                                   int(m),
+                                   int(n),
+                                   AP + first,
+                                   int(lda),
+                                   x + first,
+                                   int(incx),
+                                   CP + first,
+                                   int(ldc),
+                                   count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasSideMode_t side,
+                                              int64_t           m,
+                                              int64_t           n,
+                                              const float*      AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              float*            CP,
+                                              int64_t           ldc,
+                                              hipblasStride     strideC,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasSdgmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasSdgmmStridedBatched(handle,
+                                          side,
+                                          int(m),
+                                          int(n),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                              hipblasSideMode_t side,
+                                              int64_t           m,
+                                              int64_t           n,
+                                              const double*     AP,
+                                              int64_t           lda,
+                                              hipblasStride     strideA,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              double*           CP,
+                                              int64_t           ldc,
+                                              hipblasStride     strideC,
+                                              int64_t           batchCount)
+try
+{
+    ILP64_NATIVE(hipblasDdgmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasDdgmmStridedBatched(handle,
+                                          side,
+                                          int(m),
+                                          int(n),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdgmmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    ILP64_NATIVE(hipblasCdgmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasCdgmmStridedBatched(handle,
+                                          side,
+                                          int(m),
+                                          int(n),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdgmmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    ILP64_NATIVE(hipblasZdgmmStridedBatched_64Backend(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      AP,
+                                                      lda,
+                                                      strideA,
+                                                      x,
+                                                      incx,
+                                                      stridex,
+                                                      CP,
+                                                      ldc,
+                                                      strideC,
+                                                      batchCount));
+    if(!ilp64_is_int({m, n, lda, incx, ldc}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return ilp64_batches(batchCount, [&](int64_t first, int count) {
+        return hipblasZdgmmStridedBatched(handle,
+                                          side,
+                                          int(m),
+                                          int(n),
+                                          AP + first * strideA,
+                                          int(lda),
+                                          strideA,
+                                          x + first * stridex,
+                                          int(incx),
+                                          stridex,
+                                          CP + first * strideC,
+                                          int(ldc),
+                                          strideC,
+                                          count);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,1393 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include "packed.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Conversions between packed or band storage and full storage, and the
+// HIPBLAS_PACKED_MODE_UNPACK path of the packed routines built on them. The conversions only move
+// bytes, so one implementation serves every precision. A packed matrix is converted by the
+// backend in one call where it can (see packed.hpp); otherwise each column, which is contiguous
+// in both packed and full storage, is a device-to-device copy across the whole batch. The full
+// band of consecutive columns of a band matrix lies along a diagonal of A, with pitch lda + 1, so
+// it is a single copy.
+
+#define PACKED_RETURN_IF_ERROR(status__)              \
+    do                                                \
+    {                                                 \
+        hipblasStatus_t packed_status__ = (status__); \
+        if(packed_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return packed_status__;                   \
+    } while(0)
+
+#define PACKED_RETURN_IF_HIP_ERROR(error__)       \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    // Copies width bytes from src to dst in each of batchCount matrices, spitch and dpitch bytes
+    // apart, as one 2D copy unless the strides are too small to be pitches
+    hipblasStatus_t copy_batch(hipStream_t stream,
+                               char*       dst,
+                               int64_t     dpitch,
+                               const char* src,
+                               int64_t     spitch,
+                               int64_t     width,
+                               int         batchCount)
+    {
+        if(batchCount == 1)
+            dpitch = spitch = width;
+
+        if(dpitch >= width && spitch >= width)
+        {
+            PACKED_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(
+                dst, dpitch, src, spitch, width, batchCount, hipMemcpyDeviceToDevice, stream));
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        for(int b = 0; b < batchCount; b++)
+            PACKED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dst + b * dpitch, src + b * spitch, width, hipMemcpyDeviceToDevice, stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copies the uplo triangles of n by n matrices from packed storage to full storage, or back
+    // if unpack is false; P and A are the packed and full-storage matrices, whichever is the
+    // source. Strides and lda are in elements of size bytes. There is one call of the backend per
+    // matrix or one copy per column, whichever is fewer.
+    hipblasStatus_t packed_convert(hipblasHandle_t   handle,
+                                   hipStream_t       stream,
+                                   bool              unpack,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   int64_t           size,
+                                   const void*       P,
+                                   int64_t           strideP,
+                                   const void*       A,
+                                   int               lda,
+                                   int64_t           strideA,
+                                   int               batchCount)
+    {
+        if(batchCount <= n)
+        {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = hipblasPackedConvertBackend(handle,
+                                                     unpack,
+                                                     uplo,
+                                                     n,
+                                                     size,
+                                                     (const char*)P + b * strideP * size,
+                                                     (const char*)A + b * strideA * size,
+                                                     lda);
+            if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+                return status;
+        }
+
+        const bool upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+        for(int64_t j = 0; j < n; j++)
+        {
+            const int64_t length = upper ? j + 1 : n - j;
+            const int64_t p      = upper ? j * (j + 1) / 2 : j * (2 * n - j + 1) / 2;
+            const int64_t a      = j * lda + (upper ? 0 : j);
+
+            char* pj = (char*)P + p * size;
+            char* aj = (char*)A + a * size;
+            if(unpack)
+                PACKED_RETURN_IF_ERROR(copy_batch(
+                    stream, aj, strideA * size, pj, strideP * size, length * size, batchCount));
+            else
+                PACKED_RETURN_IF_ERROR(copy_batch(
+                    stream, pj, strideP * size, aj, strideA * size, length * size, batchCount));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copies the bands of m by n matrices with kl subdiagonals and ku superdiagonals from band
+    // storage B to full storage A, setting the rest of A to zero, or back if unpack is false.
+    // Strides and leading dimensions are in elements of size bytes.
+    hipblasStatus_t band_convert(hipStream_t stream,
+                                 bool        unpack,
+                                 int         m,
+                                 int         n,
+                                 int         kl,
+                                 int         ku,
+                                 int64_t     size,
+                                 const void* B,
+                                 int         ldb,
+                                 int64_t     strideB,
+                                 const void* A,
+                                 int         lda,
+                                 int64_t     strideA,
+                                 int         batchCount)
+    {
+        char* b0 = (char*)B;
+        char* a0 = (char*)A;
+
+        if(unpack)
+        {
+            if(strideA == int64_t(lda) * n)
+                PACKED_RETURN_IF_HIP_ERROR(hipMemset2DAsync(
+                    a0, size * lda, 0, size * m, int64_t(n) * batchCount, stream));
+            else
+                for(int i = 0; i < batchCount; i++)
+                    PACKED_RETURN_IF_HIP_ERROR(hipMemset2DAsync(
+                        a0 + i * strideA * size, size * lda, 0, size * m, n, stream));
+        }
+
+        // Columns ku <= j < last hold all kl + ku + 1 elements of the band, starting in row
+        // j - ku of A, so the band of these columns is one 2D copy per matrix: B steps by ldb
+        // from column to column and A by lda + 1
+        const int first = std::min(ku, n);
+        const int last  = std::max(first, std::min(n, m - kl));
+        if(first < last)
+        {
+            const int64_t width  = size * (kl + ku + 1);
+            const int64_t bpitch = size * ldb;
+            const int64_t apitch = size * (int64_t(lda) + 1);
+            for(int i = 0; i < batchCount; i++)
+            {
+                char* bj = b0 + (i * strideB + int64_t(first) * ldb) * size;
+                char* aj = a0 + (i * strideA + int64_t(first) * lda + first - ku) * size;
+                if(unpack)
+                    PACKED_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(aj,
+                                                                apitch,
+                                                                bj,
+                                                                bpitch,
+                                                                width,
+                                                                last - first,
+                                                                hipMemcpyDeviceToDevice,
+                                                                stream));
+                else
+                    PACKED_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(bj,
+                                                                bpitch,
+                                                                aj,
+                                                                apitch,
+                                                                width,
+                                                                last - first,
+                                                                hipMemcpyDeviceToDevice,
+                                                                stream));
+            }
+        }
+
+        // The band of the other columns is clipped by the first or the last row of A
+        for(int j = 0; j < n; j++)
+        {
+            if(j == first)
+                j = last;
+            if(j >= n)
+                break;
+
+            const int i0 = std::max(0, j - ku);
+            const int i1 = std::min(m - 1, j + kl);
+            if(i0 > i1)
+                continue;
+
+            const int64_t length = size * (i1 - i0 + 1);
+            char*         bj     = b0 + (int64_t(j) * ldb + ku + i0 - j) * size;
+            char*         aj     = a0 + (int64_t(j) * lda + i0) * size;
+            if(unpack)
+                PACKED_RETURN_IF_ERROR(copy_batch(
+                    stream, aj, strideA * size, bj, strideB * size, length, batchCount));
+            else
+                PACKED_RETURN_IF_ERROR(copy_batch(
+                    stream, bj, strideB * size, aj, strideA * size, length, batchCount));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t packed_check(hipblasHandle_t   handle,
+                                 hipblasFillMode_t uplo,
+                                 int               n,
+                                 int               lda,
+                                 int               batchCount)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || lda < std::max(1, n) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t band_check(
+        hipblasHandle_t handle, int m, int n, int kl, int ku, int ldab, int lda, int batchCount)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < kl + ku + 1 || lda < std::max(1, m)
+           || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Converts the matrices of a batched call one at a time, with their pointers copied to the
+    // host; convert(stream, src, dst) converts one matrix
+    template <typename T, typename Convert>
+    hipblasStatus_t convert_batched(hipblasHandle_t handle,
+                                    const char*     func,
+                                    const T* const  src[],
+                                    T* const        dst[],
+                                    int             batchCount,
+                                    Convert&&       convert)
+    {
+        if(!src || !dst)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        PACKED_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, func, "arrays of pointers are copied to the host"));
+
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        std::vector<const T*> hsrc(batchCount);
+        std::vector<T*>       hdst(batchCount);
+        PACKED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hsrc.data(), src, sizeof(T*) * batchCount, hipMemcpyDeviceToHost, stream));
+        PACKED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hdst.data(), dst, sizeof(T*) * batchCount, hipMemcpyDeviceToHost, stream));
+        PACKED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        for(int i = 0; i < batchCount; i++)
+        {
+            if(!hsrc[i] || !hdst[i])
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            PACKED_RETURN_IF_ERROR(convert(stream, hsrc[i], hdst[i]));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t tpttr_batched(hipblasHandle_t   handle,
+                                  const char*       func,
+                                  hipblasFillMode_t uplo,
+                                  int               n,
+                                  const T* const    AP[],
+                                  T* const          A[],
+                                  int               lda,
+                                  int               batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(packed_check(handle, uplo, n, lda, batchCount));
+        if(n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        return convert_batched(
+            handle, func, AP, A, batchCount, [&](hipStream_t stream, const T* APi, T* Ai) {
+                return packed_convert(
+                    handle, stream, true, uplo, n, sizeof(T), APi, 0, Ai, lda, 0, 1);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t tpttr_strided_batched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const T*          AP,
+                                          hipblasStride     strideAP,
+                                          T*                A,
+                                          int               lda,
+                                          hipblasStride     strideA,
+                                          int               batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(packed_check(handle, uplo, n, lda, batchCount));
+        if(n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!AP || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        return packed_convert(
+            handle, stream, true, uplo, n, sizeof(T), AP, strideAP, A, lda, strideA, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t trttp_batched(hipblasHandle_t   handle,
+                                  const char*       func,
+                                  hipblasFillMode_t uplo,
+                                  int               n,
+                                  const T* const    A[],
+                                  int               lda,
+                                  T* const          AP[],
+                                  int               batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(packed_check(handle, uplo, n, lda, batchCount));
+        if(n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        return convert_batched(
+            handle, func, A, AP, batchCount, [&](hipStream_t stream, const T* Ai, T* APi) {
+                return packed_convert(
+                    handle, stream, false, uplo, n, sizeof(T), APi, 0, Ai, lda, 0, 1);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t trttp_strided_batched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const T*          A,
+                                          int               lda,
+                                          hipblasStride     strideA,
+                                          T*                AP,
+                                          hipblasStride     strideAP,
+                                          int               batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(packed_check(handle, uplo, n, lda, batchCount));
+        if(n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !AP)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        return packed_convert(
+            handle, stream, false, uplo, n, sizeof(T), AP, strideAP, A, lda, strideA, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t gb2ge_batched(hipblasHandle_t handle,
+                                  const char*     func,
+                                  int             m,
+                                  int             n,
+                                  int             kl,
+                                  int             ku,
+                                  const T* const  AB[],
+                                  int             ldab,
+                                  T* const        A[],
+                                  int             lda,
+                                  int             batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(band_check(handle, m, n, kl, ku, ldab, lda, batchCount));
+        if(m == 0 || n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        return convert_batched(
+            handle, func, AB, A, batchCount, [&](hipStream_t stream, const T* ABi, T* Ai) {
+                return band_convert(
+                    stream, true, m, n, kl, ku, sizeof(T), ABi, ldab, 0, Ai, lda, 0, 1);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t gb2ge_strided_batched(hipblasHandle_t handle,
+                                          int             m,
+                                          int             n,
+                                          int             kl,
+                                          int             ku,
+                                          const T*        AB,
+                                          int             ldab,
+                                          hipblasStride   strideAB,
+                                          T*              A,
+                                          int             lda,
+                                          hipblasStride   strideA,
+                                          int             batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(band_check(handle, m, n, kl, ku, ldab, lda, batchCount));
+        if(m == 0 || n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!AB || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        return band_convert(
+            stream, true, m, n, kl, ku, sizeof(T), AB, ldab, strideAB, A, lda, strideA, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t ge2gb_batched(hipblasHandle_t handle,
+                                  const char*     func,
+                                  int             m,
+                                  int             n,
+                                  int             kl,
+                                  int             ku,
+                                  const T* const  A[],
+                                  int             lda,
+                                  T* const        AB[],
+                                  int             ldab,
+                                  int             batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(band_check(handle, m, n, kl, ku, ldab, lda, batchCount));
+        if(m == 0 || n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        return convert_batched(
+            handle, func, A, AB, batchCount, [&](hipStream_t stream, const T* Ai, T* ABi) {
+                return band_convert(
+                    stream, false, m, n, kl, ku, sizeof(T), ABi, ldab, 0, Ai, lda, 0, 1);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t ge2gb_strided_batched(hipblasHandle_t handle,
+                                          int             m,
+                                          int             n,
+                                          int             kl,
+                                          int             ku,
+                                          const T*        A,
+                                          int             lda,
+                                          hipblasStride   strideA,
+                                          T*              AB,
+                                          int             ldab,
+                                          hipblasStride   strideAB,
+                                          int             batchCount)
+    {
+        PACKED_RETURN_IF_ERROR(band_check(handle, m, n, kl, ku, ldab, lda, batchCount));
+        if(m == 0 || n == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !AB)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        return band_convert(stream,
+                            false,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            sizeof(T),
+                            AB,
+                            ldab,
+                            strideAB,
+                            A,
+                            lda,
+                            strideA,
+                            batchCount);
+    }
+
+    template <typename T>
+    struct packed_functions;
+
+    template <>
+    struct packed_functions<float>
+    {
+        static constexpr auto trmv = hipblasStrmv;
+        static constexpr auto trsv = hipblasStrsv;
+        static constexpr auto symv = hipblasSsymv;
+    };
+
+    template <>
+    struct packed_functions<double>
+    {
+        static constexpr auto trmv = hipblasDtrmv;
+        static constexpr auto trsv = hipblasDtrsv;
+        static constexpr auto symv = hipblasDsymv;
+    };
+
+    // hpmv is unpacked for hemv
+    template <>
+    struct packed_functions<hipblasComplex>
+    {
+        static constexpr auto trmv = hipblasCtrmv;
+        static constexpr auto trsv = hipblasCtrsv;
+        static constexpr auto symv = hipblasChemv;
+    };
+
+    template <>
+    struct packed_functions<hipblasDoubleComplex>
+    {
+        static constexpr auto trmv = hipblasZtrmv;
+        static constexpr auto trsv = hipblasZtrsv;
+        static constexpr auto symv = hipblasZhemv;
+    };
+
+    bool packed_unpack_eligible(hipblasHandle_t handle, hipblasFillMode_t uplo, int n, bool valid)
+    {
+        if(handle == nullptr || !hipblasIsPackedUnpack(handle))
+            return false;
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || n <= 0 || !valid)
+            return false;
+
+        // The scratch may need to grow
+        return !hipblasIsCaptureSafe(handle) && !hipblasStreamIsCapturing(handle);
+    }
+
+    // Unpacks the uplo triangle of AP into the handle's scratch, as an n by n matrix with
+    // leading dimension n, and calls dense(A, lda) on it; the rest of A is not set, as the
+    // full-storage routines do not read it
+    template <typename T, typename Dense>
+    hipblasStatus_t packed_unpack_call(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       int                               n,
+                                       const T*                          AP,
+                                       std::function<hipblasStatus_t()>& direct,
+                                       Dense&&                           dense)
+    {
+        hipStream_t stream;
+        PACKED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasDeviceScratch&        scratch = hipblasGetHandleState(handle)->packed_scratch;
+        std::unique_lock<std::mutex> lock(scratch.mutex);
+        if(scratch.reserve(sizeof(T) * n * n) != HIPBLAS_STATUS_SUCCESS)
+        {
+            lock.unlock();
+            return direct();
+        }
+
+        T* A = static_cast<T*>(scratch.data);
+        PACKED_RETURN_IF_ERROR(
+            packed_convert(handle, stream, true, uplo, n, sizeof(T), AP, 0, A, n, 0, 1));
+        return dense(A, n);
+    }
+
+    template <typename T>
+    hipblasStatus_t tpmv_unpacked(hipblasHandle_t                   handle,
+                                  hipblasFillMode_t                 uplo,
+                                  hipblasOperation_t                transA,
+                                  hipblasDiagType_t                 diag,
+                                  int                               n,
+                                  const T*                          AP,
+                                  T*                                x,
+                                  int                               incx,
+                                  std::function<hipblasStatus_t()>& direct)
+    {
+        if(!packed_unpack_eligible(handle, uplo, n, AP && x && incx != 0))
+            return direct();
+
+        return packed_unpack_call(handle, uplo, n, AP, direct, [&](const T* A, int lda) {
+            return packed_functions<T>::trmv(handle, uplo, transA, diag, n, A, lda, x, incx);
+        });
+    }
+
+    template <typename T>
+    hipblasStatus_t tpsv_unpacked(hipblasHandle_t                   handle,
+                                  hipblasFillMode_t                 uplo,
+                                  hipblasOperation_t                transA,
+                                  hipblasDiagType_t                 diag,
+                                  int                               n,
+                                  const T*                          AP,
+                                  T*                                x,
+                                  int                               incx,
+                                  std::function<hipblasStatus_t()>& direct)
+    {
+        if(!packed_unpack_eligible(handle, uplo, n, AP && x && incx != 0))
+            return direct();
+
+        return packed_unpack_call(handle, uplo, n, AP, direct, [&](const T* A, int lda) {
+            return packed_functions<T>::trsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+        });
+    }
+
+    // spmv and hpmv
+    template <typename T>
+    hipblasStatus_t spmv_unpacked(hipblasHandle_t                   handle,
+                                  hipblasFillMode_t                 uplo,
+                                  int                               n,
+                                  const T*                          alpha,
+                                  const T*                          AP,
+                                  const T*                          x,
+                                  int                               incx,
+                                  const T*                          beta,
+                                  T*                                y,
+                                  int                               incy,
+                                  std::function<hipblasStatus_t()>& direct)
+    {
+        const bool valid = alpha && beta && AP && x && y && incx != 0 && incy != 0;
+        if(!packed_unpack_eligible(handle, uplo, n, valid))
+            return direct();
+
+        return packed_unpack_call(handle, uplo, n, AP, direct, [&](const T* A, int lda) {
+            return packed_functions<T>::symv(
+                handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+        });
+    }
+}
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const float*                     AP,
+                                    float*                           x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpmv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const double*                    AP,
+                                    double*                          x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpmv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasComplex*            AP,
+                                    hipblasComplex*                  x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpmv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      AP,
+                                    hipblasDoubleComplex*            x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpmv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const float*                     AP,
+                                    float*                           x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpsv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const double*                    AP,
+                                    double*                          x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpsv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasComplex*            AP,
+                                    hipblasComplex*                  x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpsv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      AP,
+                                    hipblasDoubleComplex*            x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return tpsv_unpacked(handle, uplo, transA, diag, n, AP, x, incx, direct);
+}
+
+hipblasStatus_t hipblasSpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const float*                     alpha,
+                                    const float*                     AP,
+                                    const float*                     x,
+                                    int                              incx,
+                                    const float*                     beta,
+                                    float*                           y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return spmv_unpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
+}
+
+hipblasStatus_t hipblasSpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const double*                    alpha,
+                                    const double*                    AP,
+                                    const double*                    x,
+                                    int                              incx,
+                                    const double*                    beta,
+                                    double*                          y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return spmv_unpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
+}
+
+hipblasStatus_t hipblasHpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const hipblasComplex*            alpha,
+                                    const hipblasComplex*            AP,
+                                    const hipblasComplex*            x,
+                                    int                              incx,
+                                    const hipblasComplex*            beta,
+                                    hipblasComplex*                  y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return spmv_unpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
+}
+
+hipblasStatus_t hipblasHpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      alpha,
+                                    const hipblasDoubleComplex*      AP,
+                                    const hipblasDoubleComplex*      x,
+                                    int                              incx,
+                                    const hipblasDoubleComplex*      beta,
+                                    hipblasDoubleComplex*            y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct)
+{
+    return spmv_unpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const AP[],
+                                     float* const       A[],
+                                     int                lda,
+                                     int                batchCount)
+try
+{
+    return tpttr_batched(handle, __func__, uplo, n, AP, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const AP[],
+                                     double* const       A[],
+                                     int                 lda,
+                                     int                 batchCount)
+try
+{
+    return tpttr_batched(handle, __func__, uplo, n, AP, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const AP[],
+                                     hipblasComplex* const       A[],
+                                     int                         lda,
+                                     int                         batchCount)
+try
+{
+    return tpttr_batched(handle, __func__, uplo, n, AP, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const AP[],
+                                     hipblasDoubleComplex* const       A[],
+                                     int                               lda,
+                                     int                               batchCount)
+try
+{
+    return tpttr_batched(handle, __func__, uplo, n, AP, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      AP,
+                                            hipblasStride     strideAP,
+                                            float*            A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    return tpttr_strided_batched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     AP,
+                                            hipblasStride     strideAP,
+                                            double*           A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    return tpttr_strided_batched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* AP,
+                                            hipblasStride         strideAP,
+                                            hipblasComplex*       A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            int                   batchCount)
+try
+{
+    return tpttr_strided_batched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasStride               strideAP,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            int                         batchCount)
+try
+{
+    return tpttr_strided_batched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       AP[],
+                                     int                batchCount)
+try
+{
+    return trttp_batched(handle, __func__, uplo, n, A, lda, AP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       AP[],
+                                     int                 batchCount)
+try
+{
+    return trttp_batched(handle, __func__, uplo, n, A, lda, AP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       AP[],
+                                     int                         batchCount)
+try
+{
+    return trttp_batched(handle, __func__, uplo, n, A, lda, AP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       AP[],
+                                     int                               batchCount)
+try
+{
+    return trttp_batched(handle, __func__, uplo, n, A, lda, AP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            float*            AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    return trttp_strided_batched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            double*           AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    return trttp_strided_batched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            hipblasComplex*       AP,
+                                            hipblasStride         strideAP,
+                                            int                   batchCount)
+try
+{
+    return trttp_strided_batched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            hipblasDoubleComplex*       AP,
+                                            hipblasStride               strideAP,
+                                            int                         batchCount)
+try
+{
+    return trttp_strided_batched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgb2geBatched(hipblasHandle_t    handle,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const float* const AB[],
+                                     int                ldab,
+                                     float* const       A[],
+                                     int                lda,
+                                     int                batchCount)
+try
+{
+    return gb2ge_batched(handle, __func__, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgb2geBatched(hipblasHandle_t     handle,
+                                     int                 m,
+                                     int                 n,
+                                     int                 kl,
+                                     int                 ku,
+                                     const double* const AB[],
+                                     int                 ldab,
+                                     double* const       A[],
+                                     int                 lda,
+                                     int                 batchCount)
+try
+{
+    return gb2ge_batched(handle, __func__, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgb2geBatched(hipblasHandle_t             handle,
+                                     int                         m,
+                                     int                         n,
+                                     int                         kl,
+                                     int                         ku,
+                                     const hipblasComplex* const AB[],
+                                     int                         ldab,
+                                     hipblasComplex* const       A[],
+                                     int                         lda,
+                                     int                         batchCount)
+try
+{
+    return gb2ge_batched(handle, __func__, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgb2geBatched(hipblasHandle_t                   handle,
+                                     int                               m,
+                                     int                               n,
+                                     int                               kl,
+                                     int                               ku,
+                                     const hipblasDoubleComplex* const AB[],
+                                     int                               ldab,
+                                     hipblasDoubleComplex* const       A[],
+                                     int                               lda,
+                                     int                               batchCount)
+try
+{
+    return gb2ge_batched(handle, __func__, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgb2geStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const float*    AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            float*          A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            int             batchCount)
+try
+{
+    return gb2ge_strided_batched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgb2geStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const double*   AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            double*         A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            int             batchCount)
+try
+{
+    return gb2ge_strided_batched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgb2geStridedBatched(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            int                   kl,
+                                            int                   ku,
+                                            const hipblasComplex* AB,
+                                            int                   ldab,
+                                            hipblasStride         strideAB,
+                                            hipblasComplex*       A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            int                   batchCount)
+try
+{
+    return gb2ge_strided_batched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgb2geStridedBatched(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            int                         kl,
+                                            int                         ku,
+                                            const hipblasDoubleComplex* AB,
+                                            int                         ldab,
+                                            hipblasStride               strideAB,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            int                         batchCount)
+try
+{
+    return gb2ge_strided_batched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSge2gbBatched(hipblasHandle_t    handle,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       AB[],
+                                     int                ldab,
+                                     int                batchCount)
+try
+{
+    return ge2gb_batched(handle, __func__, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDge2gbBatched(hipblasHandle_t     handle,
+                                     int                 m,
+                                     int                 n,
+                                     int                 kl,
+                                     int                 ku,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       AB[],
+                                     int                 ldab,
+                                     int                 batchCount)
+try
+{
+    return ge2gb_batched(handle, __func__, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCge2gbBatched(hipblasHandle_t             handle,
+                                     int                         m,
+                                     int                         n,
+                                     int                         kl,
+                                     int                         ku,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       AB[],
+                                     int                         ldab,
+                                     int                         batchCount)
+try
+{
+    return ge2gb_batched(handle, __func__, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZge2gbBatched(hipblasHandle_t                   handle,
+                                     int                               m,
+                                     int                               n,
+                                     int                               kl,
+                                     int                               ku,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       AB[],
+                                     int                               ldab,
+                                     int                               batchCount)
+try
+{
+    return ge2gb_batched(handle, __func__, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSge2gbStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const float*    A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            float*          AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            int             batchCount)
+try
+{
+    return ge2gb_strided_batched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDge2gbStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const double*   A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            double*         AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            int             batchCount)
+try
+{
+    return ge2gb_strided_batched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCge2gbStridedBatched(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            int                   kl,
+                                            int                   ku,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            hipblasComplex*       AB,
+                                            int                   ldab,
+                                            hipblasStride         strideAB,
+                                            int                   batchCount)
+try
+{
+    return ge2gb_strided_batched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZge2gbStridedBatched(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            int                         kl,
+                                            int                         ku,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            hipblasDoubleComplex*       AB,
+                                            int                         ldab,
+                                            hipblasStride               strideAB,
+                                            int                         batchCount)
+try
+{
+    return ge2gb_strided_batched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
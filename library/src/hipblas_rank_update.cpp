@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// hipblasXgerDeferred and hipblasXsyrDeferred copy x into the next column of X and alpha*y (or
+// alpha*x) into the next column of Y, on the handle's stream. When block_size updates are pending,
+// on a deferred update to another matrix, or on hipblasFlushRankUpdates, they are applied as
+//
+//     A += X*Y'               by gemm for ger
+//     A += (X*Y' + Y*X')/2    by syr2k for syr, which leaves the other triangle of A alone
+//
+// so A is read and written once per block rather than once per update.
+
+#define RANK_UPDATE_RETURN_IF_ERROR(status__)              \
+    do                                                     \
+    {                                                      \
+        hipblasStatus_t rank_update_status__ = (status__); \
+        if(rank_update_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return rank_update_status__;                   \
+    } while(0)
+
+#define RANK_UPDATE_RETURN_IF_HIP_ERROR(error__)  \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+hipblasRankUpdates::~hipblasRankUpdates()
+{
+    (void)hipFree(vectors);
+}
+
+namespace
+{
+    template <typename T>
+    struct rank_update_functions;
+
+    template <>
+    struct rank_update_functions<float>
+    {
+        static constexpr auto copy  = hipblasScopy;
+        static constexpr auto axpy  = hipblasSaxpy;
+        static constexpr auto gemm  = hipblasSgemm;
+        static constexpr auto syr2k = hipblasSsyr2k;
+    };
+
+    template <>
+    struct rank_update_functions<double>
+    {
+        static constexpr auto copy  = hipblasDcopy;
+        static constexpr auto axpy  = hipblasDaxpy;
+        static constexpr auto gemm  = hipblasDgemm;
+        static constexpr auto syr2k = hipblasDsyr2k;
+    };
+
+    // Applies the pending updates; called with them locked
+    template <typename T>
+    hipblasStatus_t rank_updates_apply(hipblasHandle_t handle, hipblasRankUpdates& updates)
+    {
+        using F = rank_update_functions<T>;
+
+        int k         = updates.count;
+        updates.count = 0;
+        if(!k)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        T*      A = static_cast<T*>(updates.A);
+        T*      X = static_cast<T*>(updates.vectors);
+        T*      Y = X + size_t(updates.m) * updates.block_size;
+        const T one(1), half(0.5);
+
+        hipblasHostPointerModeGuard guard(handle);
+        if(updates.symmetric)
+            return F::syr2k(handle,
+                            updates.uplo,
+                            HIPBLAS_OP_N,
+                            updates.n,
+                            k,
+                            &half,
+                            X,
+                            updates.n,
+                            Y,
+                            updates.n,
+                            &one,
+                            A,
+                            updates.lda);
+        return F::gemm(handle,
+                       HIPBLAS_OP_N,
+                       HIPBLAS_OP_T,
+                       updates.m,
+                       updates.n,
+                       k,
+                       &one,
+                       X,
+                       updates.m,
+                       Y,
+                       updates.n,
+                       &one,
+                       A,
+                       updates.lda);
+    }
+
+    hipblasStatus_t rank_updates_flush(hipblasHandle_t handle, hipblasRankUpdates& updates)
+    {
+        return updates.count ? updates.apply(handle, updates) : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Defers A += alpha*x*y', or alpha*x*x' to the uplo triangle of A if symmetric
+    template <typename T>
+    hipblasStatus_t rank_update_defer(hipblasHandle_t   handle,
+                                      bool              symmetric,
+                                      hipblasFillMode_t uplo,
+                                      int               m,
+                                      int               n,
+                                      const T*          alpha,
+                                      const T*          x,
+                                      int               incx,
+                                      const T*          y,
+                                      int               incy,
+                                      T*                A,
+                                      int               lda,
+                                      const char*       func)
+    {
+        using F = rank_update_functions<T>;
+
+        hipStream_t stream;
+        RANK_UPDATE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasRankUpdates&         updates = hipblasGetHandleState(handle)->rank_updates;
+        std::lock_guard<std::mutex> lock(updates.mutex);
+
+        bool same = updates.count && updates.apply == rank_updates_apply<T>
+                    && updates.symmetric == symmetric && updates.A == A && updates.m == m
+                    && updates.n == n && updates.lda == lda && (!symmetric || updates.uplo == uplo);
+        if(!same)
+        {
+            RANK_UPDATE_RETURN_IF_ERROR(rank_updates_flush(handle, updates));
+
+            size_t bytes = sizeof(T) * (size_t(m) + n) * updates.block_size;
+            if(updates.vectors_size < bytes)
+            {
+                RANK_UPDATE_RETURN_IF_ERROR(hipblasCheckCapture(
+                    handle, func, "the buffer of deferred updates is allocated"));
+                (void)hipFree(updates.vectors);
+                updates.vectors      = nullptr;
+                updates.vectors_size = 0;
+                if(hipMalloc(&updates.vectors, bytes) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                updates.vectors_size = bytes;
+            }
+
+            updates.symmetric = symmetric;
+            updates.uplo      = uplo;
+            updates.A         = A;
+            updates.m         = m;
+            updates.n         = n;
+            updates.lda       = lda;
+            updates.apply     = rank_updates_apply<T>;
+
+            // Y is accumulated into by axpy
+            T* Y = static_cast<T*>(updates.vectors) + size_t(m) * updates.block_size;
+            RANK_UPDATE_RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                Y, 0, sizeof(T) * size_t(n) * updates.block_size, stream));
+        }
+
+        T* X = static_cast<T*>(updates.vectors) + size_t(m) * updates.count;
+        T* Y = static_cast<T*>(updates.vectors) + size_t(m) * updates.block_size
+               + size_t(n) * updates.count;
+        RANK_UPDATE_RETURN_IF_ERROR(F::copy(handle, m, x, incx, X, 1));
+        RANK_UPDATE_RETURN_IF_ERROR(F::axpy(handle, n, alpha, y, incy, Y, 1));
+
+        if(++updates.count == updates.block_size)
+            return rank_updates_flush(handle, updates);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGerDeferredTemplate(hipblasHandle_t handle,
+                                               int             m,
+                                               int             n,
+                                               const T*        alpha,
+                                               const T*        x,
+                                               int             incx,
+                                               const T*        y,
+                                               int             incy,
+                                               T*              A,
+                                               int             lda,
+                                               const char*     func)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m < 0 || n < 0 || !incx || !incy || lda < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !x || !y || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return rank_update_defer(handle,
+                                 false,
+                                 HIPBLAS_FILL_MODE_UPPER,
+                                 m,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 y,
+                                 incy,
+                                 A,
+                                 lda,
+                                 func);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasSyrDeferredTemplate(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int               n,
+                                               const T*          alpha,
+                                               const T*          x,
+                                               int               incx,
+                                               T*                A,
+                                               int               lda,
+                                               const char*       func)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || n < 0 || !incx
+           || lda < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !x || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return rank_update_defer(handle, true, uplo, n, n, alpha, x, incx, x, incx, A, lda, func);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetRankUpdateBlockSize(hipblasHandle_t handle, int blockSize)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockSize < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The pending updates are laid out for the old block size
+    hipblasRankUpdates&         updates = hipblasGetHandleState(handle)->rank_updates;
+    std::lock_guard<std::mutex> lock(updates.mutex);
+    RANK_UPDATE_RETURN_IF_ERROR(rank_updates_flush(handle, updates));
+    updates.block_size = blockSize;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetRankUpdateBlockSize(hipblasHandle_t handle, int* blockSize)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockSize == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasRankUpdates&         updates = hipblasGetHandleState(handle)->rank_updates;
+    std::lock_guard<std::mutex> lock(updates.mutex);
+    *blockSize = updates.block_size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasFlushRankUpdates(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasRankUpdates&         updates = hipblasGetHandleState(handle)->rank_updates;
+    std::lock_guard<std::mutex> lock(updates.mutex);
+    return rank_updates_flush(handle, updates);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgerDeferred(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    const float*    alpha,
+                                    const float*    x,
+                                    int             incx,
+                                    const float*    y,
+                                    int             incy,
+                                    float*          A,
+                                    int             lda)
+try
+{
+    return hipblasGerDeferredTemplate(handle, m, n, alpha, x, incx, y, incy, A, lda, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgerDeferred(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    const double*   alpha,
+                                    const double*   x,
+                                    int             incx,
+                                    const double*   y,
+                                    int             incy,
+                                    double*         A,
+                                    int             lda)
+try
+{
+    return hipblasGerDeferredTemplate(handle, m, n, alpha, x, incx, y, incy, A, lda, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrDeferred(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const float*      alpha,
+                                    const float*      x,
+                                    int               incx,
+                                    float*            A,
+                                    int               lda)
+try
+{
+    return hipblasSyrDeferredTemplate(handle, uplo, n, alpha, x, incx, A, lda, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrDeferred(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const double*     alpha,
+                                    const double*     x,
+                                    int               incx,
+                                    double*           A,
+                                    int               lda)
+try
+{
+    return hipblasSyrDeferredTemplate(handle, uplo, n, alpha, x, incx, A, lda, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+} // extern "C"
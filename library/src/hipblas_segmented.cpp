@@ -0,0 +1,892 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <numeric>
+#include <vector>
+
+// The segments of a segmented Level-1 function tile x (and y) from offsets[0] to
+// offsets[segmentCount]. Each segment is split into pieces whose lengths are the powers of two
+// making up its length, and the batched function is called once for each power of two, so a call
+// takes at most 31 batched calls however many different lengths there are. dot and nrm2 sort the
+// segments by length, longest first, so that the call for 2^b takes the segments of length 2^b or
+// more, with zeros in scratch for those whose length lacks 2^b; the results of the pieces are then
+// combined by gemv or nrm2StridedBatched and put back in the order of the caller through the host.
+// axpy computes the pieces of 2^b elements with one gemvBatched of 1 x 2^b matrices, whose vector
+// is the alpha of the segment. cuBLAS has neither batched Level-1 functions nor gemvBatched, so
+// there each segment is computed by a call of its own.
+
+#define SEGMENTED_RETURN_IF_ERROR(status__)              \
+    do                                                   \
+    {                                                    \
+        hipblasStatus_t segmented_status__ = (status__); \
+        if(segmented_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return segmented_status__;                   \
+    } while(0)
+
+#define SEGMENTED_RETURN_IF_HIP_ERROR(error__)    \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    template <typename T>
+    struct segmented_blas;
+
+    template <>
+    struct segmented_blas<float>
+    {
+        using real_t                                    = float;
+        static constexpr auto dotu                      = hipblasSdot;
+        static constexpr auto dotc                      = hipblasSdot;
+        static constexpr auto dotu_batched              = hipblasSdotBatched;
+        static constexpr auto dotc_batched              = hipblasSdotBatched;
+        static constexpr auto nrm2                      = hipblasSnrm2;
+        static constexpr auto nrm2_batched              = hipblasSnrm2Batched;
+        static constexpr auto axpy                      = hipblasSaxpy;
+        static constexpr auto gemv                      = hipblasSgemv;
+        static constexpr auto gemv_batched              = hipblasSgemvBatched;
+        static constexpr auto real_nrm2_strided_batched = hipblasSnrm2StridedBatched;
+    };
+
+    template <>
+    struct segmented_blas<double>
+    {
+        using real_t                                    = double;
+        static constexpr auto dotu                      = hipblasDdot;
+        static constexpr auto dotc                      = hipblasDdot;
+        static constexpr auto dotu_batched              = hipblasDdotBatched;
+        static constexpr auto dotc_batched              = hipblasDdotBatched;
+        static constexpr auto nrm2                      = hipblasDnrm2;
+        static constexpr auto nrm2_batched              = hipblasDnrm2Batched;
+        static constexpr auto axpy                      = hipblasDaxpy;
+        static constexpr auto gemv                      = hipblasDgemv;
+        static constexpr auto gemv_batched              = hipblasDgemvBatched;
+        static constexpr auto real_nrm2_strided_batched = hipblasDnrm2StridedBatched;
+    };
+
+    template <>
+    struct segmented_blas<hipblasComplex>
+    {
+        using real_t                                    = float;
+        static constexpr auto dotu                      = hipblasCdotu;
+        static constexpr auto dotc                      = hipblasCdotc;
+        static constexpr auto dotu_batched              = hipblasCdotuBatched;
+        static constexpr auto dotc_batched              = hipblasCdotcBatched;
+        static constexpr auto nrm2                      = hipblasScnrm2;
+        static constexpr auto nrm2_batched              = hipblasScnrm2Batched;
+        static constexpr auto axpy                      = hipblasCaxpy;
+        static constexpr auto gemv                      = hipblasCgemv;
+        static constexpr auto gemv_batched              = hipblasCgemvBatched;
+        static constexpr auto real_nrm2_strided_batched = hipblasSnrm2StridedBatched;
+    };
+
+    template <>
+    struct segmented_blas<hipblasDoubleComplex>
+    {
+        using real_t                                    = double;
+        static constexpr auto dotu                      = hipblasZdotu;
+        static constexpr auto dotc                      = hipblasZdotc;
+        static constexpr auto dotu_batched              = hipblasZdotuBatched;
+        static constexpr auto dotc_batched              = hipblasZdotcBatched;
+        static constexpr auto nrm2                      = hipblasDznrm2;
+        static constexpr auto nrm2_batched              = hipblasDznrm2Batched;
+        static constexpr auto axpy                      = hipblasZaxpy;
+        static constexpr auto gemv                      = hipblasZgemv;
+        static constexpr auto gemv_batched              = hipblasZgemvBatched;
+        static constexpr auto real_nrm2_strided_batched = hipblasDnrm2StridedBatched;
+    };
+
+    // The offsets must start at 0 or more and be non-decreasing
+    bool segments_valid(int segmentCount, const int* offsets)
+    {
+        if(offsets[0] < 0)
+            return false;
+        for(int i = 0; i < segmentCount; i++)
+            if(offsets[i + 1] < offsets[i])
+                return false;
+        return true;
+    }
+
+    // Restores the pointer mode of the caller on return
+    class segmented_pointer_mode
+    {
+    public:
+        segmented_pointer_mode(hipblasHandle_t handle, hipblasPointerMode_t caller)
+            : m_handle(handle)
+            , m_caller(caller)
+        {
+        }
+
+        ~segmented_pointer_mode()
+        {
+            hipblasSetPointerMode(m_handle, m_caller);
+        }
+
+        segmented_pointer_mode(const segmented_pointer_mode&) = delete;
+        segmented_pointer_mode& operator=(const segmented_pointer_mode&) = delete;
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_caller;
+    };
+
+    // The number of powers of two up to the highest one in length
+    int segmented_levels(int length)
+    {
+        int levels = 0;
+        while(length >> levels)
+            levels++;
+        return levels;
+    }
+
+    // Offsets in scratch are kept aligned for every type
+    size_t segmented_align(size_t bytes)
+    {
+        return (bytes + 255) / 256 * 256;
+    }
+
+    // Computes one result R for each segment of x, and of y when y is not null.
+    // batched(n, x, y, count, result) computes count pieces of length n from arrays of pointers on
+    // the GPU, and combine(levels, partials, ones, result) the result of each segment from the
+    // levels results of its pieces, the one of 2^b at partials[b * segmentCount], with
+    // ones[levels] == 0. single(n, x, y, result) computes one segment from pointers to the vectors
+    // themselves, which is used for each segment when batched is not supported.
+    template <typename T, typename R, typename Batched, typename Combine, typename Single>
+    hipblasStatus_t segmented_reduce(hipblasHandle_t handle,
+                                     const char*     func,
+                                     int             segmentCount,
+                                     const int*      offsets,
+                                     const T*        x,
+                                     int             incx,
+                                     const T*        y,
+                                     int             incy,
+                                     R*              result,
+                                     Batched         batched,
+                                     Combine         combine,
+                                     Single          single)
+    {
+        SEGMENTED_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, func, "results are reordered through the host"));
+
+        hipStream_t stream;
+        SEGMENTED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        hipblasPointerMode_t mode;
+        SEGMENTED_RETURN_IF_ERROR(hipblasGetPointerMode(handle, &mode));
+
+        auto length = [&](int i) { return offsets[i + 1] - offsets[i]; };
+
+        std::vector<int> order(segmentCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return length(a) > length(b);
+        });
+
+        // The call for 2^b takes the segments of length 2^b or more, the first count[b] in order.
+        // A segment whose length lacks 2^b reads zeros instead, which at most doubles its work.
+        int              levels = segmented_levels(length(order[0]));
+        std::vector<int> count(levels);
+        for(int b = 0, p = segmentCount; b < levels; b++)
+        {
+            while(length(order[p - 1]) < (1 << b))
+                p--;
+            count[b] = p;
+        }
+
+        int    vectors = y ? 2 : 1;
+        int    inc     = y ? std::max(incx, incy) : incx;
+        size_t zeros   = levels ? size_t((1 << (levels - 1)) - 1) * inc + 1 : 0;
+
+        std::vector<size_t> first(levels + 1, 0);
+        for(int b = 0; b < levels; b++)
+            first[b + 1] = first[b] + size_t(vectors) * count[b];
+
+        size_t pointer_bytes = segmented_align(sizeof(T*) * first[levels]);
+        size_t ones_bytes    = segmented_align(sizeof(R) * (levels + 1));
+        size_t partial_bytes = segmented_align(sizeof(R) * levels * segmentCount);
+        size_t result_bytes  = segmented_align(sizeof(R) * segmentCount);
+        size_t zero_bytes    = sizeof(T) * zeros;
+
+        hipblasHandleState*         state   = hipblasGetHandleState(handle);
+        hipblasDeviceScratch&       scratch = state->segmented_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        SEGMENTED_RETURN_IF_ERROR(scratch.reserve(pointer_bytes + ones_bytes + partial_bytes
+                                                  + result_bytes + zero_bytes));
+
+        char*     data     = static_cast<char*>(scratch.data);
+        const T** dptr     = reinterpret_cast<const T**>(data);
+        R*        dones    = reinterpret_cast<R*>(data += pointer_bytes);
+        R*        partials = reinterpret_cast<R*>(data += ones_bytes);
+        R*        dresult  = reinterpret_cast<R*>(data += partial_bytes);
+        const T*  dzeros   = reinterpret_cast<const T*>(data += result_bytes);
+
+        // The pieces are laid out from the highest power of two down
+        std::vector<const T*> hptr(first[levels]);
+        for(int b = 0; b < levels; b++)
+            for(int p = 0; p < count[b]; p++)
+            {
+                int    i     = order[p];
+                size_t start = offsets[i] + (length(i) >> (b + 1) << (b + 1));
+                bool   piece = length(i) >> b & 1;
+
+                hptr[first[b] + p] = piece ? x + start * incx : dzeros;
+                if(y)
+                    hptr[first[b] + count[b] + p] = piece ? y + start * incy : dzeros;
+            }
+
+        std::vector<R> hones(levels + 1, R(1));
+        hones[levels] = R(0);
+
+        // Pieces missing from a call and segments of length 0 are left at 0
+        SEGMENTED_RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(partials, 0, partial_bytes + result_bytes + zero_bytes, stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dptr, hptr.data(), sizeof(T*) * hptr.size(), hipMemcpyHostToDevice, stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dones, hones.data(), sizeof(R) * hones.size(), hipMemcpyHostToDevice, stream));
+
+        {
+            segmented_pointer_mode restore(handle, mode);
+            SEGMENTED_RETURN_IF_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = levels - 1; b >= 0 && status == HIPBLAS_STATUS_SUCCESS; b--)
+            {
+                const T* const* dy = y ? dptr + first[b] + count[b] : nullptr;
+                status             = batched(
+                    1 << b, dptr + first[b], dy, count[b], partials + size_t(b) * segmentCount);
+            }
+
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            {
+                for(int p = 0; p < segmentCount && length(order[p]); p++)
+                {
+                    int i = order[p];
+                    SEGMENTED_RETURN_IF_ERROR(single(length(i),
+                                                     x + size_t(offsets[i]) * incx,
+                                                     y ? y + size_t(offsets[i]) * incy : nullptr,
+                                                     dresult + p));
+                }
+            }
+            else
+            {
+                SEGMENTED_RETURN_IF_ERROR(status);
+                if(levels)
+                    SEGMENTED_RETURN_IF_ERROR(combine(levels, partials, dones, dresult));
+            }
+        }
+
+        // Back to the order of the caller
+        std::vector<R> hresult_sorted(segmentCount), hresult(segmentCount);
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(hresult_sorted.data(),
+                                                     dresult,
+                                                     sizeof(R) * segmentCount,
+                                                     hipMemcpyDeviceToHost,
+                                                     stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        for(int i = 0; i < segmentCount; i++)
+            hresult[order[i]] = hresult_sorted[i];
+
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            std::copy(hresult.begin(), hresult.end(), result);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            result, hresult.data(), sizeof(R) * segmentCount, hipMemcpyHostToDevice, stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T, bool CONJ>
+    hipblasStatus_t hipblasDotSegmentedTemplate(hipblasHandle_t handle,
+                                                int             segmentCount,
+                                                const int*      offsets,
+                                                const T*        x,
+                                                int             incx,
+                                                const T*        y,
+                                                int             incy,
+                                                T*              result,
+                                                const char*     func)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(segmentCount < 0 || incx <= 0 || incy <= 0
+           || (segmentCount && (!offsets || !x || !y || !result)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!segmentCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!segments_valid(segmentCount, offsets))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto batched = [&](int n, const T* const* dx, const T* const* dy, int count, T* dresult) {
+            return (CONJ ? segmented_blas<T>::dotc_batched : segmented_blas<T>::dotu_batched)(
+                handle, n, dx, incx, dy, incy, count, dresult);
+        };
+        // The sum of the dot products of the pieces of each segment
+        auto combine = [&](int levels, const T* partials, const T* ones, T* dresult) {
+            return segmented_blas<T>::gemv(handle,
+                                           HIPBLAS_OP_N,
+                                           segmentCount,
+                                           levels,
+                                           ones,
+                                           partials,
+                                           segmentCount,
+                                           ones,
+                                           1,
+                                           ones + levels,
+                                           dresult,
+                                           1);
+        };
+        auto single = [&](int n, const T* sx, const T* sy, T* dresult) {
+            return (CONJ ? segmented_blas<T>::dotc : segmented_blas<T>::dotu)(
+                handle, n, sx, incx, sy, incy, dresult);
+        };
+        return segmented_reduce(handle,
+                                func,
+                                segmentCount,
+                                offsets,
+                                x,
+                                incx,
+                                y,
+                                incy,
+                                result,
+                                batched,
+                                combine,
+                                single);
+    }
+
+    template <typename T, typename R = typename segmented_blas<T>::real_t>
+    hipblasStatus_t hipblasNrm2SegmentedTemplate(hipblasHandle_t handle,
+                                                 int             segmentCount,
+                                                 const int*      offsets,
+                                                 const T*        x,
+                                                 int             incx,
+                                                 R*              result,
+                                                 const char*     func)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(segmentCount < 0 || incx <= 0 || (segmentCount && (!offsets || !x || !result)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!segmentCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!segments_valid(segmentCount, offsets))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto batched = [&](int n, const T* const* dx, const T* const*, int count, R* dresult) {
+            return segmented_blas<T>::nrm2_batched(handle, n, dx, incx, count, dresult);
+        };
+        // The norm of the norms of the pieces of each segment
+        auto combine = [&](int levels, const R* partials, const R*, R* dresult) {
+            return segmented_blas<T>::real_nrm2_strided_batched(
+                handle, levels, partials, segmentCount, 1, segmentCount, dresult);
+        };
+        auto single = [&](int n, const T* sx, const T*, R* dresult) {
+            return segmented_blas<T>::nrm2(handle, n, sx, incx, dresult);
+        };
+        return segmented_reduce<T, R>(handle,
+                                      func,
+                                      segmentCount,
+                                      offsets,
+                                      x,
+                                      incx,
+                                      nullptr,
+                                      0,
+                                      result,
+                                      batched,
+                                      combine,
+                                      single);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasAxpySegmentedTemplate(hipblasHandle_t handle,
+                                                 int             segmentCount,
+                                                 const int*      offsets,
+                                                 const T*        alpha,
+                                                 const T*        x,
+                                                 int             incx,
+                                                 T*              y,
+                                                 int             incy,
+                                                 const char*     func)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(segmentCount < 0 || incx <= 0 || incy <= 0
+           || (segmentCount && (!offsets || !alpha || !x || !y)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!segmentCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!segments_valid(segmentCount, offsets))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int n = offsets[segmentCount] - offsets[0];
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t stream;
+        SEGMENTED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        hipblasHostPointerModeGuard guard(handle, HIPBLAS_POINTER_MODE_DEVICE);
+
+        // With one alpha on the host for all of the segments, this is axpy over all of them
+        if(guard.mode() == HIPBLAS_POINTER_MODE_HOST
+           && std::all_of(alpha, alpha + segmentCount, [&](const T& a) {
+                  return std::memcmp(&a, alpha, sizeof(T)) == 0;
+              }))
+        {
+            SEGMENTED_RETURN_IF_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            return segmented_blas<T>::axpy(handle,
+                                           n,
+                                           alpha,
+                                           x + size_t(offsets[0]) * incx,
+                                           incx,
+                                           y + size_t(offsets[0]) * incy,
+                                           incy);
+        }
+
+        SEGMENTED_RETURN_IF_ERROR(
+            hipblasCheckCapture(handle, func, "arrays of pointers are copied from the host"));
+
+        auto length = [&](int i) { return offsets[i + 1] - offsets[i]; };
+
+        int levels = 0;
+        for(int i = 0; i < segmentCount; i++)
+            levels = std::max(levels, segmented_levels(length(i)));
+
+        // The pieces of 2^b elements are those of the segments whose length has 2^b, laid out
+        // from the highest power of two down. Each is computed as y += A^T * alpha_i, with A the
+        // 1 x 2^b matrix of leading dimension incx made of the piece of x.
+        std::vector<size_t> first(levels + 1, 0);
+        for(int b = 0; b < levels; b++)
+        {
+            first[b + 1] = first[b];
+            for(int i = 0; i < segmentCount; i++)
+                first[b + 1] += length(i) >> b & 1;
+        }
+
+        size_t pieces        = first[levels];
+        size_t pointer_bytes = segmented_align(sizeof(T*) * 3 * pieces);
+        size_t alpha_bytes   = segmented_align(sizeof(T) * segmentCount);
+
+        hipblasHandleState*         state   = hipblasGetHandleState(handle);
+        hipblasDeviceScratch&       scratch = state->segmented_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        SEGMENTED_RETURN_IF_ERROR(scratch.reserve(pointer_bytes + alpha_bytes + sizeof(T)));
+
+        char*     data   = static_cast<char*>(scratch.data);
+        const T** din    = reinterpret_cast<const T**>(data);
+        T**       dout   = reinterpret_cast<T**>(data + sizeof(T*) * 2 * pieces);
+        T*        dalpha = reinterpret_cast<T*>(data + pointer_bytes);
+        T*        done   = reinterpret_cast<T*>(data + pointer_bytes + alpha_bytes);
+
+        // alpha on the host is copied to the device, one value for each segment
+        const T* alphas = alpha;
+        if(guard.mode() == HIPBLAS_POINTER_MODE_HOST)
+        {
+            SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dalpha, alpha, sizeof(T) * segmentCount, hipMemcpyHostToDevice, stream));
+            alphas = dalpha;
+        }
+
+        std::vector<const T*> hin(2 * pieces);
+        std::vector<T*>       hout(pieces);
+        for(int b = 0; b < levels; b++)
+        {
+            size_t p = first[b];
+            for(int i = 0; i < segmentCount; i++)
+            {
+                if(!(length(i) >> b & 1))
+                    continue;
+                size_t start    = offsets[i] + (length(i) >> (b + 1) << (b + 1));
+                hin[p]          = x + start * incx;
+                hin[pieces + p] = alphas + i;
+                hout[p++]       = y + start * incy;
+            }
+        }
+
+        const T one(1);
+        SEGMENTED_RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(done, &one, sizeof(T), hipMemcpyHostToDevice, stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            din, hin.data(), sizeof(T*) * hin.size(), hipMemcpyHostToDevice, stream));
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dout, hout.data(), sizeof(T*) * hout.size(), hipMemcpyHostToDevice, stream));
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int b = levels - 1; b >= 0 && status == HIPBLAS_STATUS_SUCCESS; b--)
+        {
+            int count = first[b + 1] - first[b];
+            if(count)
+                status = segmented_blas<T>::gemv_batched(handle,
+                                                         HIPBLAS_OP_T,
+                                                         1,
+                                                         1 << b,
+                                                         done,
+                                                         din + first[b],
+                                                         incx,
+                                                         din + pieces + first[b],
+                                                         1,
+                                                         done,
+                                                         dout + first[b],
+                                                         incy,
+                                                         count);
+        }
+
+        // gemvBatched is supported for all of the calls or for none
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            for(int i = 0; i < segmentCount; i++)
+                SEGMENTED_RETURN_IF_ERROR(segmented_blas<T>::axpy(handle,
+                                                                  length(i),
+                                                                  alphas + i,
+                                                                  x + size_t(offsets[i]) * incx,
+                                                                  incx,
+                                                                  y + size_t(offsets[i]) * incy,
+                                                                  incy));
+        else
+            SEGMENTED_RETURN_IF_ERROR(status);
+
+        // The arrays of pointers are copied from host vectors which go out of scope on return
+        SEGMENTED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" {
+hipblasStatus_t hipblasSdotSegmented(hipblasHandle_t handle,
+                                     int             segmentCount,
+                                     const int*      offsets,
+                                     const float*    x,
+                                     int             incx,
+                                     const float*    y,
+                                     int             incy,
+                                     float*          result)
+try
+{
+    return hipblasDotSegmentedTemplate<float, false>(handle,
+                                                     segmentCount,
+                                                     offsets,
+                                                     x,
+                                                     incx,
+                                                     y,
+                                                     incy,
+                                                     result,
+                                                     __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotSegmented(hipblasHandle_t handle,
+                                     int             segmentCount,
+                                     const int*      offsets,
+                                     const double*   x,
+                                     int             incx,
+                                     const double*   y,
+                                     int             incy,
+                                     double*         result)
+try
+{
+    return hipblasDotSegmentedTemplate<double, false>(handle,
+                                                      segmentCount,
+                                                      offsets,
+                                                      x,
+                                                      incx,
+                                                      y,
+                                                      incy,
+                                                      result,
+                                                      __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotuSegmented(hipblasHandle_t       handle,
+                                      int                   segmentCount,
+                                      const int*            offsets,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      const hipblasComplex* y,
+                                      int                   incy,
+                                      hipblasComplex*       result)
+try
+{
+    return hipblasDotSegmentedTemplate<hipblasComplex, false>(handle,
+                                                              segmentCount,
+                                                              offsets,
+                                                              x,
+                                                              incx,
+                                                              y,
+                                                              incy,
+                                                              result,
+                                                              __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotcSegmented(hipblasHandle_t       handle,
+                                      int                   segmentCount,
+                                      const int*            offsets,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      const hipblasComplex* y,
+                                      int                   incy,
+                                      hipblasComplex*       result)
+try
+{
+    return hipblasDotSegmentedTemplate<hipblasComplex, true>(handle,
+                                                             segmentCount,
+                                                             offsets,
+                                                             x,
+                                                             incx,
+                                                             y,
+                                                             incy,
+                                                             result,
+                                                             __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotuSegmented(hipblasHandle_t             handle,
+                                      int                         segmentCount,
+                                      const int*                  offsets,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      const hipblasDoubleComplex* y,
+                                      int                         incy,
+                                      hipblasDoubleComplex*       result)
+try
+{
+    return hipblasDotSegmentedTemplate<hipblasDoubleComplex, false>(handle,
+                                                                    segmentCount,
+                                                                    offsets,
+                                                                    x,
+                                                                    incx,
+                                                                    y,
+                                                                    incy,
+                                                                    result,
+                                                                    __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotcSegmented(hipblasHandle_t             handle,
+                                      int                         segmentCount,
+                                      const int*                  offsets,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      const hipblasDoubleComplex* y,
+                                      int                         incy,
+                                      hipblasDoubleComplex*       result)
+try
+{
+    return hipblasDotSegmentedTemplate<hipblasDoubleComplex, true>(handle,
+                                                                   segmentCount,
+                                                                   offsets,
+                                                                   x,
+                                                                   incx,
+                                                                   y,
+                                                                   incy,
+                                                                   result,
+                                                                   __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpySegmented(hipblasHandle_t handle,
+                                      int             segmentCount,
+                                      const int*      offsets,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int             incx,
+                                      float*          y,
+                                      int             incy)
+try
+{
+    return hipblasAxpySegmentedTemplate(handle,
+                                        segmentCount,
+                                        offsets,
+                                        alpha,
+                                        x,
+                                        incx,
+                                        y,
+                                        incy,
+                                        __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpySegmented(hipblasHandle_t handle,
+                                      int             segmentCount,
+                                      const int*      offsets,
+                                      const double*   alpha,
+                                      const double*   x,
+                                      int             incx,
+                                      double*         y,
+                                      int             incy)
+try
+{
+    return hipblasAxpySegmentedTemplate(handle,
+                                        segmentCount,
+                                        offsets,
+                                        alpha,
+                                        x,
+                                        incx,
+                                        y,
+                                        incy,
+                                        __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpySegmented(hipblasHandle_t       handle,
+                                      int                   segmentCount,
+                                      const int*            offsets,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      hipblasComplex*       y,
+                                      int                   incy)
+try
+{
+    return hipblasAxpySegmentedTemplate(handle,
+                                        segmentCount,
+                                        offsets,
+                                        alpha,
+                                        x,
+                                        incx,
+                                        y,
+                                        incy,
+                                        __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpySegmented(hipblasHandle_t             handle,
+                                      int                         segmentCount,
+                                      const int*                  offsets,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      hipblasDoubleComplex*       y,
+                                      int                         incy)
+try
+{
+    return hipblasAxpySegmentedTemplate(handle,
+                                        segmentCount,
+                                        offsets,
+                                        alpha,
+                                        x,
+                                        incx,
+                                        y,
+                                        incy,
+                                        __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2Segmented(hipblasHandle_t handle,
+                                      int             segmentCount,
+                                      const int*      offsets,
+                                      const float*    x,
+                                      int             incx,
+                                      float*          result)
+try
+{
+    return hipblasNrm2SegmentedTemplate(handle, segmentCount, offsets, x, incx, result, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2Segmented(hipblasHandle_t handle,
+                                      int             segmentCount,
+                                      const int*      offsets,
+                                      const double*   x,
+                                      int             incx,
+                                      double*         result)
+try
+{
+    return hipblasNrm2SegmentedTemplate(handle, segmentCount, offsets, x, incx, result, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2Segmented(hipblasHandle_t       handle,
+                                       int                   segmentCount,
+                                       const int*            offsets,
+                                       const hipblasComplex* x,
+                                       int                   incx,
+                                       float*                result)
+try
+{
+    return hipblasNrm2SegmentedTemplate(handle, segmentCount, offsets, x, incx, result, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2Segmented(hipblasHandle_t             handle,
+                                       int                         segmentCount,
+                                       const int*                  offsets,
+                                       const hipblasDoubleComplex* x,
+                                       int                         incx,
+                                       double*                     result)
+try
+{
+    return hipblasNrm2SegmentedTemplate(handle, segmentCount, offsets, x, incx, result, __func__);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+} // extern "C"
@@ -0,0 +1,292 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t set_get_matrix_batched_check(
+        int rows, int cols, int elemSize, int lda, int ldb, int batchCount)
+    {
+        if(rows < 0 || cols < 0 || elemSize <= 0 || lda <= 0 || ldb <= 0 || lda < rows
+           || ldb < rows || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copies batch_count matrices of rows x cols elements, with consecutive matrices stride_a and
+    // stride_b bytes apart, in as few copy commands as the layout allows
+    hipblasStatus_t copy_matrix_strided(int           rows,
+                                        int           cols,
+                                        size_t        elem_size,
+                                        const char*   A,
+                                        size_t        lda,
+                                        ptrdiff_t     stride_a,
+                                        char*         B,
+                                        size_t        ldb,
+                                        ptrdiff_t     stride_b,
+                                        int           batch_count,
+                                        hipMemcpyKind kind,
+                                        hipStream_t   stream)
+    {
+        size_t    width   = rows * elem_size;
+        size_t    pitch_a = lda * elem_size;
+        size_t    pitch_b = ldb * elem_size;
+        ptrdiff_t size_a  = ptrdiff_t(pitch_a * cols);
+        ptrdiff_t size_b  = ptrdiff_t(pitch_b * cols);
+
+        hipError_t err = hipSuccess;
+        if(batch_count > 1 && stride_a == size_a && stride_b == size_b)
+        {
+            // The matrices are back to back, so the batch is a single rows x (cols * batch_count)
+            // matrix
+            err = hipMemcpy2DAsync(
+                B, pitch_b, A, pitch_a, width, size_t(cols) * batch_count, kind, stream);
+        }
+        else if(batch_count > 1 && stride_a >= size_a && stride_a % pitch_a == 0
+                && stride_b >= size_b && stride_b % pitch_b == 0)
+        {
+            // The matrices are a whole number of columns apart, so the batch is a 3D array
+            hipMemcpy3DParms params = {};
+            params.srcPtr = make_hipPitchedPtr((void*)A, pitch_a, width, stride_a / pitch_a);
+            params.dstPtr = make_hipPitchedPtr(B, pitch_b, width, stride_b / pitch_b);
+            params.extent = make_hipExtent(width, cols, batch_count);
+            params.kind   = kind;
+            err           = hipMemcpy3DAsync(&params, stream);
+        }
+        else
+        {
+            for(int b = 0; b < batch_count && err == hipSuccess; b++)
+                err = hipMemcpy2DAsync(B + b * stride_b,
+                                       pitch_b,
+                                       A + b * stride_a,
+                                       pitch_a,
+                                       width,
+                                       cols,
+                                       kind,
+                                       stream);
+        }
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_MAPPING_ERROR;
+    }
+
+    ptrdiff_t pointer_distance(const void* from, const void* to)
+    {
+        return ptrdiff_t(uintptr_t(to) - uintptr_t(from));
+    }
+
+    hipblasStatus_t copy_matrix_batched(int               rows,
+                                        int               cols,
+                                        int               elemSize,
+                                        const void* const A[],
+                                        int               lda,
+                                        void* const       B[],
+                                        int               ldb,
+                                        int               batchCount,
+                                        hipMemcpyKind     kind,
+                                        hipStream_t       stream)
+    {
+        hipblasStatus_t status
+            = set_get_matrix_batched_check(rows, cols, elemSize, lda, ldb, batchCount);
+        if(status != HIPBLAS_STATUS_SUCCESS || !rows || !cols || !batchCount)
+            return status;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        for(int b = 0; b < batchCount; b++)
+            if(!A[b] || !B[b])
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // Each run of matrices which are evenly spaced in both arrays is copied as a strided batch
+        int first = 0;
+        while(first < batchCount)
+        {
+            int       last     = first + 1;
+            ptrdiff_t stride_a = 0, stride_b = 0;
+            if(last < batchCount)
+            {
+                stride_a = pointer_distance(A[first], A[last]);
+                stride_b = pointer_distance(B[first], B[last]);
+                while(++last < batchCount
+                      && pointer_distance(A[last - 1], A[last]) == stride_a
+                      && pointer_distance(B[last - 1], B[last]) == stride_b)
+                    ;
+            }
+
+            status = copy_matrix_strided(rows,
+                                         cols,
+                                         elemSize,
+                                         (const char*)A[first],
+                                         lda,
+                                         stride_a,
+                                         (char*)B[first],
+                                         ldb,
+                                         stride_b,
+                                         last - first,
+                                         kind,
+                                         stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            first = last;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t copy_matrix_strided_batched(int           rows,
+                                                int           cols,
+                                                int           elemSize,
+                                                const void*   A,
+                                                int           lda,
+                                                hipblasStride strideA,
+                                                void*         B,
+                                                int           ldb,
+                                                hipblasStride strideB,
+                                                int           batchCount,
+                                                hipMemcpyKind kind,
+                                                hipStream_t   stream)
+    {
+        hipblasStatus_t status
+            = set_get_matrix_batched_check(rows, cols, elemSize, lda, ldb, batchCount);
+        if(status != HIPBLAS_STATUS_SUCCESS || !rows || !cols || !batchCount)
+            return status;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return copy_matrix_strided(rows,
+                                   cols,
+                                   elemSize,
+                                   (const char*)A,
+                                   lda,
+                                   strideA * elemSize,
+                                   (char*)B,
+                                   ldb,
+                                   strideB * elemSize,
+                                   batchCount,
+                                   kind,
+                                   stream);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    return copy_matrix_batched(
+        rows, cols, elemSize, AP, lda, BP, ldb, batchCount, hipMemcpyHostToDevice, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    return copy_matrix_batched(
+        rows, cols, elemSize, AP, lda, BP, ldb, batchCount, hipMemcpyDeviceToHost, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    return copy_matrix_strided_batched(rows,
+                                       cols,
+                                       elemSize,
+                                       AP,
+                                       lda,
+                                       strideA,
+                                       BP,
+                                       ldb,
+                                       strideB,
+                                       batchCount,
+                                       hipMemcpyHostToDevice,
+                                       stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    return copy_matrix_strided_batched(rows,
+                                       cols,
+                                       elemSize,
+                                       AP,
+                                       lda,
+                                       strideA,
+                                       BP,
+                                       ldb,
+                                       strideB,
+                                       batchCount,
+                                       hipMemcpyDeviceToHost,
+                                       stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,853 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// The DeviceInfo solvers report invalid arguments through the returned status only, and numerical
+// results only through deviceInfo, so that nothing is read from or written to host memory of the
+// caller. They check their arguments up front and then call the solver with an info of their own,
+// which the checks in the backend leave at 0.
+
+#define DEVICE_INFO_RETURN_IF_ERROR(status__)              \
+    do                                                     \
+    {                                                      \
+        hipblasStatus_t device_info_status__ = (status__); \
+        if(device_info_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return device_info_status__;                   \
+    } while(0)
+
+namespace
+{
+    template <typename T>
+    struct solver_device_info;
+
+    template <>
+    struct solver_device_info<float>
+    {
+        static constexpr auto getrs                 = hipblasSgetrs;
+        static constexpr auto getrs_batched         = hipblasSgetrsBatched;
+        static constexpr auto getrs_strided_batched = hipblasSgetrsStridedBatched;
+        static constexpr auto gels                  = hipblasSgels;
+        static constexpr auto gels_batched          = hipblasSgelsBatched;
+        static constexpr auto gels_strided_batched  = hipblasSgelsStridedBatched;
+    };
+
+    template <>
+    struct solver_device_info<double>
+    {
+        static constexpr auto getrs                 = hipblasDgetrs;
+        static constexpr auto getrs_batched         = hipblasDgetrsBatched;
+        static constexpr auto getrs_strided_batched = hipblasDgetrsStridedBatched;
+        static constexpr auto gels                  = hipblasDgels;
+        static constexpr auto gels_batched          = hipblasDgelsBatched;
+        static constexpr auto gels_strided_batched  = hipblasDgelsStridedBatched;
+    };
+
+    template <>
+    struct solver_device_info<hipblasComplex>
+    {
+        static constexpr auto getrs                 = hipblasCgetrs;
+        static constexpr auto getrs_batched         = hipblasCgetrsBatched;
+        static constexpr auto getrs_strided_batched = hipblasCgetrsStridedBatched;
+        static constexpr auto gels                  = hipblasCgels;
+        static constexpr auto gels_batched          = hipblasCgelsBatched;
+        static constexpr auto gels_strided_batched  = hipblasCgelsStridedBatched;
+    };
+
+    template <>
+    struct solver_device_info<hipblasDoubleComplex>
+    {
+        static constexpr auto getrs                 = hipblasZgetrs;
+        static constexpr auto getrs_batched         = hipblasZgetrsBatched;
+        static constexpr auto getrs_strided_batched = hipblasZgetrsStridedBatched;
+        static constexpr auto gels                  = hipblasZgels;
+        static constexpr auto gels_batched          = hipblasZgelsBatched;
+        static constexpr auto gels_strided_batched  = hipblasZgelsStridedBatched;
+    };
+
+    bool getrs_args_valid(hipblasOperation_t trans,
+                          int                n,
+                          int                nrhs,
+                          const void*        A,
+                          int                lda,
+                          const int*         ipiv,
+                          const void*        B,
+                          int                ldb)
+    {
+        return (trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C) && n >= 0
+               && nrhs >= 0 && (A || !n) && lda >= std::max(1, n) && (ipiv || !n)
+               && (B || !(n * nrhs)) && ldb >= std::max(1, n);
+    }
+
+    bool gels_args_valid(hipblasOperation_t trans,
+                         int                m,
+                         int                n,
+                         int                nrhs,
+                         const void*        A,
+                         int                lda,
+                         const void*        B,
+                         int                ldb)
+    {
+        return (trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T) && m >= 0 && n >= 0 && nrhs >= 0
+               && (A || !(m * n)) && lda >= m && (B || !(m * nrhs || n * nrhs)) && ldb >= m
+               && ldb >= n;
+    }
+
+    // getrs cannot fail numerically, but deviceInfo is still cleared, on the stream, so that every
+    // solver of a pipeline can be checked the same way
+    hipblasStatus_t clear_device_info(hipblasHandle_t handle, int* deviceInfo, int count)
+    {
+        hipStream_t stream;
+        DEVICE_INFO_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        if(count && hipMemsetAsync(deviceInfo, 0, sizeof(int) * count, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrsDeviceInfoTemplate(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   T*                       A,
+                                                   const int                lda,
+                                                   const int*               ipiv,
+                                                   T*                       B,
+                                                   const int                ldb,
+                                                   int*                     deviceInfo)
+    {
+        if(!getrs_args_valid(trans, n, nrhs, A, lda, ipiv, B, ldb) || deviceInfo == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        DEVICE_INFO_RETURN_IF_ERROR(solver_device_info<T>::getrs(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, &info));
+        return clear_device_info(handle, deviceInfo, 1);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrsBatchedDeviceInfoTemplate(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          T* const                 A[],
+                                                          const int                lda,
+                                                          const int*               ipiv,
+                                                          T* const                 B[],
+                                                          const int                ldb,
+                                                          int*                     deviceInfo,
+                                                          const int                batchCount)
+    {
+        if(!getrs_args_valid(trans, n, nrhs, A, lda, ipiv, B, ldb)
+           || (deviceInfo == NULL && batchCount) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        DEVICE_INFO_RETURN_IF_ERROR(solver_device_info<T>::getrs_batched(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, &info, batchCount));
+        return clear_device_info(handle, deviceInfo, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t
+        hipblasGetrsStridedBatchedDeviceInfoTemplate(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int                n,
+                                                     const int                nrhs,
+                                                     T*                       A,
+                                                     const int                lda,
+                                                     const hipblasStride      strideA,
+                                                     const int*               ipiv,
+                                                     const hipblasStride      strideP,
+                                                     T*                       B,
+                                                     const int                ldb,
+                                                     const hipblasStride      strideB,
+                                                     int*                     deviceInfo,
+                                                     const int                batchCount)
+    {
+        if(!getrs_args_valid(trans, n, nrhs, A, lda, ipiv, B, ldb)
+           || (deviceInfo == NULL && batchCount) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        DEVICE_INFO_RETURN_IF_ERROR(solver_device_info<T>::getrs_strided_batched(handle,
+                                                                                 trans,
+                                                                                 n,
+                                                                                 nrhs,
+                                                                                 A,
+                                                                                 lda,
+                                                                                 strideA,
+                                                                                 ipiv,
+                                                                                 strideP,
+                                                                                 B,
+                                                                                 ldb,
+                                                                                 strideB,
+                                                                                 &info,
+                                                                                 batchCount));
+        return clear_device_info(handle, deviceInfo, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGelsDeviceInfoTemplate(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans,
+                                                  const int          m,
+                                                  const int          n,
+                                                  const int          nrhs,
+                                                  T*                 A,
+                                                  const int          lda,
+                                                  T*                 B,
+                                                  const int          ldb,
+                                                  int*               deviceInfo)
+    {
+        if(!gels_args_valid(trans, m, n, nrhs, A, lda, B, ldb) || deviceInfo == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        return solver_device_info<T>::gels(
+            handle, trans, m, n, nrhs, A, lda, B, ldb, &info, deviceInfo);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGelsBatchedDeviceInfoTemplate(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans,
+                                                         const int          m,
+                                                         const int          n,
+                                                         const int          nrhs,
+                                                         T* const           A[],
+                                                         const int          lda,
+                                                         T* const           B[],
+                                                         const int          ldb,
+                                                         int*               deviceInfo,
+                                                         const int          batchCount)
+    {
+        if(!gels_args_valid(trans, m, n, nrhs, A, lda, B, ldb)
+           || (deviceInfo == NULL && batchCount) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        return solver_device_info<T>::gels_batched(
+            handle, trans, m, n, nrhs, A, lda, B, ldb, &info, deviceInfo, batchCount);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGelsStridedBatchedDeviceInfoTemplate(hipblasHandle_t     handle,
+                                                                hipblasOperation_t  trans,
+                                                                const int           m,
+                                                                const int           n,
+                                                                const int           nrhs,
+                                                                T*                  A,
+                                                                const int           lda,
+                                                                const hipblasStride strideA,
+                                                                T*                  B,
+                                                                const int           ldb,
+                                                                const hipblasStride strideB,
+                                                                int*                deviceInfo,
+                                                                const int           batchCount)
+    {
+        if(!gels_args_valid(trans, m, n, nrhs, A, lda, B, ldb)
+           || (deviceInfo == NULL && batchCount) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int info = 0;
+        return solver_device_info<T>::gels_strided_batched(handle,
+                                                           trans,
+                                                           m,
+                                                           n,
+                                                           nrhs,
+                                                           A,
+                                                           lda,
+                                                           strideA,
+                                                           B,
+                                                           ldb,
+                                                           strideB,
+                                                           &info,
+                                                           deviceInfo,
+                                                           batchCount);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSgetrsDeviceInfo(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        float*                   A,
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        float*                   B,
+                                        const int                ldb,
+                                        int*                     deviceInfo)
+try
+{
+    return hipblasGetrsDeviceInfoTemplate(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetrsDeviceInfo(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        double*                  A,
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        double*                  B,
+                                        const int                ldb,
+                                        int*                     deviceInfo)
+try
+{
+    return hipblasGetrsDeviceInfoTemplate(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetrsDeviceInfo(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipblasComplex*          A,
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipblasComplex*          B,
+                                        const int                ldb,
+                                        int*                     deviceInfo)
+try
+{
+    return hipblasGetrsDeviceInfoTemplate(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetrsDeviceInfo(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipblasDoubleComplex*    A,
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipblasDoubleComplex*    B,
+                                        const int                ldb,
+                                        int*                     deviceInfo)
+try
+{
+    return hipblasGetrsDeviceInfoTemplate(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               float* const             A[],
+                                               const int                lda,
+                                               const int*               ipiv,
+                                               float* const             B[],
+                                               const int                ldb,
+                                               int*                     deviceInfo,
+                                               const int                batchCount)
+try
+{
+    return hipblasGetrsBatchedDeviceInfoTemplate(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               double* const            A[],
+                                               const int                lda,
+                                               const int*               ipiv,
+                                               double* const            B[],
+                                               const int                ldb,
+                                               int*                     deviceInfo,
+                                               const int                batchCount)
+try
+{
+    return hipblasGetrsBatchedDeviceInfoTemplate(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetrsBatchedDeviceInfo(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               hipblasComplex* const    A[],
+                                               const int                lda,
+                                               const int*               ipiv,
+                                               hipblasComplex* const    B[],
+                                               const int                ldb,
+                                               int*                     deviceInfo,
+                                               const int                batchCount)
+try
+{
+    return hipblasGetrsBatchedDeviceInfoTemplate(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetrsBatchedDeviceInfo(hipblasHandle_t             handle,
+                                               const hipblasOperation_t    trans,
+                                               const int                   n,
+                                               const int                   nrhs,
+                                               hipblasDoubleComplex* const A[],
+                                               const int                   lda,
+                                               const int*                  ipiv,
+                                               hipblasDoubleComplex* const B[],
+                                               const int                   ldb,
+                                               int*                        deviceInfo,
+                                               const int                   batchCount)
+try
+{
+    return hipblasGetrsBatchedDeviceInfoTemplate(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      float*                   A,
+                                                      const int                lda,
+                                                      const hipblasStride      strideA,
+                                                      const int*               ipiv,
+                                                      const hipblasStride      strideP,
+                                                      float*                   B,
+                                                      const int                ldb,
+                                                      const hipblasStride      strideB,
+                                                      int*                     deviceInfo,
+                                                      const int                batchCount)
+try
+{
+    return hipblasGetrsStridedBatchedDeviceInfoTemplate(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        ipiv,
+                                                        strideP,
+                                                        B,
+                                                        ldb,
+                                                        strideB,
+                                                        deviceInfo,
+                                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      double*                  A,
+                                                      const int                lda,
+                                                      const hipblasStride      strideA,
+                                                      const int*               ipiv,
+                                                      const hipblasStride      strideP,
+                                                      double*                  B,
+                                                      const int                ldb,
+                                                      const hipblasStride      strideB,
+                                                      int*                     deviceInfo,
+                                                      const int                batchCount)
+try
+{
+    return hipblasGetrsStridedBatchedDeviceInfoTemplate(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        ipiv,
+                                                        strideP,
+                                                        B,
+                                                        ldb,
+                                                        strideB,
+                                                        deviceInfo,
+                                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      hipblasComplex*          A,
+                                                      const int                lda,
+                                                      const hipblasStride      strideA,
+                                                      const int*               ipiv,
+                                                      const hipblasStride      strideP,
+                                                      hipblasComplex*          B,
+                                                      const int                ldb,
+                                                      const hipblasStride      strideB,
+                                                      int*                     deviceInfo,
+                                                      const int                batchCount)
+try
+{
+    return hipblasGetrsStridedBatchedDeviceInfoTemplate(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        ipiv,
+                                                        strideP,
+                                                        B,
+                                                        ldb,
+                                                        strideB,
+                                                        deviceInfo,
+                                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatchedDeviceInfo(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      hipblasDoubleComplex*    A,
+                                                      const int                lda,
+                                                      const hipblasStride      strideA,
+                                                      const int*               ipiv,
+                                                      const hipblasStride      strideP,
+                                                      hipblasDoubleComplex*    B,
+                                                      const int                ldb,
+                                                      const hipblasStride      strideB,
+                                                      int*                     deviceInfo,
+                                                      const int                batchCount)
+try
+{
+    return hipblasGetrsStridedBatchedDeviceInfoTemplate(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        ipiv,
+                                                        strideP,
+                                                        B,
+                                                        ldb,
+                                                        strideB,
+                                                        deviceInfo,
+                                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgelsDeviceInfo(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       const int          m,
+                                       const int          n,
+                                       const int          nrhs,
+                                       float*             A,
+                                       const int          lda,
+                                       float*             B,
+                                       const int          ldb,
+                                       int*               deviceInfo)
+try
+{
+    return hipblasGelsDeviceInfoTemplate(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgelsDeviceInfo(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       const int          m,
+                                       const int          n,
+                                       const int          nrhs,
+                                       double*            A,
+                                       const int          lda,
+                                       double*            B,
+                                       const int          ldb,
+                                       int*               deviceInfo)
+try
+{
+    return hipblasGelsDeviceInfoTemplate(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgelsDeviceInfo(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       const int          m,
+                                       const int          n,
+                                       const int          nrhs,
+                                       hipblasComplex*    A,
+                                       const int          lda,
+                                       hipblasComplex*    B,
+                                       const int          ldb,
+                                       int*               deviceInfo)
+try
+{
+    return hipblasGelsDeviceInfoTemplate(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgelsDeviceInfo(hipblasHandle_t       handle,
+                                       hipblasOperation_t    trans,
+                                       const int             m,
+                                       const int             n,
+                                       const int             nrhs,
+                                       hipblasDoubleComplex* A,
+                                       const int             lda,
+                                       hipblasDoubleComplex* B,
+                                       const int             ldb,
+                                       int*                  deviceInfo)
+try
+{
+    return hipblasGelsDeviceInfoTemplate(handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgelsBatchedDeviceInfo(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              const int          m,
+                                              const int          n,
+                                              const int          nrhs,
+                                              float* const       A[],
+                                              const int          lda,
+                                              float* const       B[],
+                                              const int          ldb,
+                                              int*               deviceInfo,
+                                              const int          batchCount)
+try
+{
+    return hipblasGelsBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgelsBatchedDeviceInfo(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              const int          m,
+                                              const int          n,
+                                              const int          nrhs,
+                                              double* const      A[],
+                                              const int          lda,
+                                              double* const      B[],
+                                              const int          ldb,
+                                              int*               deviceInfo,
+                                              const int          batchCount)
+try
+{
+    return hipblasGelsBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgelsBatchedDeviceInfo(hipblasHandle_t       handle,
+                                              hipblasOperation_t    trans,
+                                              const int             m,
+                                              const int             n,
+                                              const int             nrhs,
+                                              hipblasComplex* const A[],
+                                              const int             lda,
+                                              hipblasComplex* const B[],
+                                              const int             ldb,
+                                              int*                  deviceInfo,
+                                              const int             batchCount)
+try
+{
+    return hipblasGelsBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgelsBatchedDeviceInfo(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              const int                   m,
+                                              const int                   n,
+                                              const int                   nrhs,
+                                              hipblasDoubleComplex* const A[],
+                                              const int                   lda,
+                                              hipblasDoubleComplex* const B[],
+                                              const int                   ldb,
+                                              int*                        deviceInfo,
+                                              const int                   batchCount)
+try
+{
+    return hipblasGelsBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                     hipblasOperation_t  trans,
+                                                     const int           m,
+                                                     const int           n,
+                                                     const int           nrhs,
+                                                     float*              A,
+                                                     const int           lda,
+                                                     const hipblasStride strideA,
+                                                     float*              B,
+                                                     const int           ldb,
+                                                     const hipblasStride strideB,
+                                                     int*                deviceInfo,
+                                                     const int           batchCount)
+try
+{
+    return hipblasGelsStridedBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                     hipblasOperation_t  trans,
+                                                     const int           m,
+                                                     const int           n,
+                                                     const int           nrhs,
+                                                     double*             A,
+                                                     const int           lda,
+                                                     const hipblasStride strideA,
+                                                     double*             B,
+                                                     const int           ldb,
+                                                     const hipblasStride strideB,
+                                                     int*                deviceInfo,
+                                                     const int           batchCount)
+try
+{
+    return hipblasGelsStridedBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgelsStridedBatchedDeviceInfo(hipblasHandle_t     handle,
+                                                     hipblasOperation_t  trans,
+                                                     const int           m,
+                                                     const int           n,
+                                                     const int           nrhs,
+                                                     hipblasComplex*     A,
+                                                     const int           lda,
+                                                     const hipblasStride strideA,
+                                                     hipblasComplex*     B,
+                                                     const int           ldb,
+                                                     const hipblasStride strideB,
+                                                     int*                deviceInfo,
+                                                     const int           batchCount)
+try
+{
+    return hipblasGelsStridedBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgelsStridedBatchedDeviceInfo(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    trans,
+                                                     const int             m,
+                                                     const int             n,
+                                                     const int             nrhs,
+                                                     hipblasDoubleComplex* A,
+                                                     const int             lda,
+                                                     const hipblasStride   strideA,
+                                                     hipblasDoubleComplex* B,
+                                                     const int             ldb,
+                                                     const hipblasStride   strideB,
+                                                     int*                  deviceInfo,
+                                                     const int             batchCount)
+try
+{
+    return hipblasGelsStridedBatchedDeviceInfoTemplate(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "staging.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    // Smaller copies are left to the backend, packing them would not pay off
+    constexpr size_t staging_min_bytes = size_t(1) << 20;
+
+    constexpr size_t staging_default_pool_size = size_t(32) << 20;
+
+    // One buffer is packed or unpacked on the host while the other is copied
+    constexpr int staging_buffers = 2;
+
+    struct staging_pool
+    {
+        std::mutex mutex;
+        bool       initialized = false;
+        size_t     buffer_size = 0;
+        char*      buffers[staging_buffers]{};
+
+        // Allocates the buffers on first use; returns false if staging is disabled
+        bool initialize()
+        {
+            if(initialized)
+                return buffer_size != 0;
+            initialized = true;
+
+            size_t      pool_size = staging_default_pool_size;
+            const char* env       = getenv("HIPBLAS_STAGING_POOL_SIZE");
+            if(env)
+                pool_size = strtoull(env, nullptr, 10);
+
+            size_t size = pool_size / staging_buffers;
+            if(!size)
+                return false;
+            for(int b = 0; b < staging_buffers; b++)
+            {
+                if(hipHostMalloc(&buffers[b], size, hipHostMallocPortable) != hipSuccess)
+                {
+                    // Fall back to unstaged copies for good
+                    while(b--)
+                        (void)hipHostFree(buffers[b]);
+                    return false;
+                }
+            }
+            buffer_size = size;
+            return true;
+        }
+    };
+
+    // Never destroyed: the HIP runtime may be gone by the time static destructors run
+    staging_pool& get_staging_pool()
+    {
+        static staging_pool* pool = new staging_pool;
+        return *pool;
+    }
+
+    // Events marking when each buffer is free again, destroyed on return
+    struct staging_events
+    {
+        hipEvent_t events[staging_buffers]{};
+
+        ~staging_events()
+        {
+            for(hipEvent_t event : events)
+                if(event)
+                    (void)hipEventDestroy(event);
+        }
+
+        bool create()
+        {
+            for(hipEvent_t& event : events)
+                if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                    return false;
+            return true;
+        }
+    };
+
+    // Part of the matrix which fits in one buffer: whole columns if a column fits, otherwise
+    // rows of a single column
+    struct staging_piece
+    {
+        int r0, nr, c0, nc;
+    };
+
+    std::vector<staging_piece>
+        staging_pieces(int rows, int cols, size_t elem_size, size_t buffer_size)
+    {
+        std::vector<staging_piece> pieces;
+        size_t                     column_bytes = rows * elem_size;
+        if(column_bytes <= buffer_size)
+        {
+            int nc = int(std::min<size_t>(buffer_size / column_bytes, cols));
+            for(int c0 = 0; c0 < cols; c0 += nc)
+                pieces.push_back({0, rows, c0, std::min(nc, cols - c0)});
+        }
+        else
+        {
+            int nr = int(buffer_size / elem_size);
+            for(int c0 = 0; c0 < cols; c0++)
+                for(int r0 = 0; r0 < rows; r0 += nr)
+                    pieces.push_back({r0, std::min(nr, rows - r0), c0, 1});
+        }
+        return pieces;
+    }
+
+    // Copies piece p between the host matrix and a buffer packed with leading dimension p.nr
+    void staging_pack(
+        const staging_piece& p, size_t elem_size, const char* A, int lda, char* buffer)
+    {
+        for(int c = 0; c < p.nc; c++)
+            memcpy(buffer + size_t(c) * p.nr * elem_size,
+                   A + (p.r0 + size_t(p.c0 + c) * lda) * elem_size,
+                   p.nr * elem_size);
+    }
+
+    void staging_unpack(
+        const staging_piece& p, size_t elem_size, const char* buffer, char* B, int ldb)
+    {
+        for(int c = 0; c < p.nc; c++)
+            memcpy(B + (p.r0 + size_t(p.c0 + c) * ldb) * elem_size,
+                   buffer + size_t(c) * p.nr * elem_size,
+                   p.nr * elem_size);
+    }
+
+    // Copies already issued read or write the pool's buffers, so they are waited for before an
+    // error unlocks the pool
+    hipblasStatus_t staging_error()
+    {
+        (void)hipStreamSynchronize(nullptr);
+        return HIPBLAS_STATUS_MAPPING_ERROR;
+    }
+
+    // Returns true if the copy should be staged. Invalid arguments are left to the backend so
+    // that it reports them.
+    bool staging_applies(
+        int rows, int cols, int elemSize, const void* host, int ld_host, int ld_device)
+    {
+        if(rows <= 0 || cols <= 0 || elemSize <= 0 || ld_host < rows || ld_device < rows)
+            return false;
+        if(size_t(rows) * cols * elemSize < staging_min_bytes)
+            return false;
+
+        // Pinned memory is already copied at full bandwidth
+        unsigned int flags;
+        if(hipHostGetFlags(&flags, const_cast<void*>(host)) == hipSuccess)
+            return false;
+        (void)hipGetLastError();
+        return true;
+    }
+}
+
+hipblasStatus_t hipblasStagedSetMatrix(int                              rows,
+                                       int                              cols,
+                                       int                              elemSize,
+                                       const void*                      A,
+                                       int                              lda,
+                                       void*                            B,
+                                       int                              ldb,
+                                       std::function<hipblasStatus_t()> direct)
+{
+    if(!A || !B || !staging_applies(rows, cols, elemSize, A, lda, ldb))
+        return direct();
+
+    staging_pool&                pool = get_staging_pool();
+    std::unique_lock<std::mutex> lock(pool.mutex, std::try_to_lock);
+    staging_events               events;
+    if(!lock || !pool.initialize() || !events.create())
+        return direct();
+
+    size_t elem_size = elemSize;
+    auto   pieces    = staging_pieces(rows, cols, elem_size, pool.buffer_size);
+    for(size_t i = 0; i < pieces.size(); i++)
+    {
+        const staging_piece& p      = pieces[i];
+        int                  b      = int(i % staging_buffers);
+        char*                buffer = pool.buffers[b];
+
+        // Wait for the previous copy out of this buffer
+        if(i >= staging_buffers && hipEventSynchronize(events.events[b]) != hipSuccess)
+            return staging_error();
+
+        staging_pack(p, elem_size, (const char*)A, lda, buffer);
+        if(hipMemcpy2DAsync((char*)B + (p.r0 + size_t(p.c0) * ldb) * elem_size,
+                            ldb * elem_size,
+                            buffer,
+                            p.nr * elem_size,
+                            p.nr * elem_size,
+                            p.nc,
+                            hipMemcpyHostToDevice,
+                            nullptr)
+               != hipSuccess
+           || hipEventRecord(events.events[b], nullptr) != hipSuccess)
+            return staging_error();
+    }
+
+    return hipStreamSynchronize(nullptr) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                       : HIPBLAS_STATUS_MAPPING_ERROR;
+}
+
+hipblasStatus_t hipblasStagedGetMatrix(int                              rows,
+                                       int                              cols,
+                                       int                              elemSize,
+                                       const void*                      A,
+                                       int                              lda,
+                                       void*                            B,
+                                       int                              ldb,
+                                       std::function<hipblasStatus_t()> direct)
+{
+    if(!A || !B || !staging_applies(rows, cols, elemSize, B, ldb, lda))
+        return direct();
+
+    staging_pool&                pool = get_staging_pool();
+    std::unique_lock<std::mutex> lock(pool.mutex, std::try_to_lock);
+    staging_events               events;
+    if(!lock || !pool.initialize() || !events.create())
+        return direct();
+
+    size_t elem_size = elemSize;
+    auto   pieces    = staging_pieces(rows, cols, elem_size, pool.buffer_size);
+
+    // Unpacks piece i once its copy into the buffer is done
+    auto unpack = [&](size_t i) {
+        int b = int(i % staging_buffers);
+        if(hipEventSynchronize(events.events[b]) != hipSuccess)
+            return false;
+        staging_unpack(pieces[i], elem_size, pool.buffers[b], (char*)B, ldb);
+        return true;
+    };
+
+    for(size_t i = 0; i < pieces.size(); i++)
+    {
+        const staging_piece& p = pieces[i];
+        int                  b = int(i % staging_buffers);
+
+        // The buffer still holds piece i - staging_buffers
+        if(i >= staging_buffers && !unpack(i - staging_buffers))
+            return staging_error();
+
+        if(hipMemcpy2DAsync(pool.buffers[b],
+                            p.nr * elem_size,
+                            (const char*)A + (p.r0 + size_t(p.c0) * lda) * elem_size,
+                            lda * elem_size,
+                            p.nr * elem_size,
+                            p.nc,
+                            hipMemcpyDeviceToHost,
+                            nullptr)
+               != hipSuccess
+           || hipEventRecord(events.events[b], nullptr) != hipSuccess)
+            return staging_error();
+    }
+
+    size_t first = pieces.size() > staging_buffers ? pieces.size() - staging_buffers : 0;
+    for(size_t i = first; i < pieces.size(); i++)
+        if(!unpack(i))
+            return staging_error();
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,475 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// hipblasXtrsmCached keeps the inverse of A, computed with trtri on first use, and solves later
+// calls with the same A, dimensions and version by a gemm with the inverse, which runs at gemm
+// rather than trsm throughput. The inverses are kept per handle, least recently used first out,
+// within the limit set by hipblasSetTrsmCacheSize.
+
+#define TRSM_CACHE_RETURN_IF_ERROR(status__)              \
+    do                                                    \
+    {                                                     \
+        hipblasStatus_t trsm_cache_status__ = (status__); \
+        if(trsm_cache_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return trsm_cache_status__;                   \
+    } while(0)
+
+#define TRSM_CACHE_RETURN_IF_HIP_ERROR(error__)   \
+    do                                            \
+    {                                             \
+        if((error__) != hipSuccess)               \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+hipblasTrsmCache::~hipblasTrsmCache()
+{
+    for(auto& entry : entries)
+        (void)hipFree(entry.invA);
+    (void)hipFree(scratch);
+    (void)hipFree(zero);
+}
+
+namespace
+{
+    template <typename T>
+    struct trsm_cache_functions;
+
+    template <>
+    struct trsm_cache_functions<float>
+    {
+        static constexpr auto trtri = hipblasStrtri;
+        static constexpr auto trsm  = hipblasStrsm;
+        static constexpr auto gemm  = hipblasSgemm;
+    };
+
+    template <>
+    struct trsm_cache_functions<double>
+    {
+        static constexpr auto trtri = hipblasDtrtri;
+        static constexpr auto trsm  = hipblasDtrsm;
+        static constexpr auto gemm  = hipblasDgemm;
+    };
+
+    template <>
+    struct trsm_cache_functions<hipblasComplex>
+    {
+        static constexpr auto trtri = hipblasCtrtri;
+        static constexpr auto trsm  = hipblasCtrsm;
+        static constexpr auto gemm  = hipblasCgemm;
+    };
+
+    template <>
+    struct trsm_cache_functions<hipblasDoubleComplex>
+    {
+        static constexpr auto trtri = hipblasZtrtri;
+        static constexpr auto trsm  = hipblasZtrsm;
+        static constexpr auto gemm  = hipblasZgemm;
+    };
+
+    void erase_entry(hipblasTrsmCache& cache, std::list<hipblasTrsmCache::Entry>::iterator it)
+    {
+        (void)hipFree(it->invA);
+        cache.bytes -= it->bytes;
+        cache.entries.erase(it);
+    }
+
+    // Drops the least recently used inverses until bytes more fit within the limit
+    void trsm_cache_evict(hipblasTrsmCache& cache, size_t bytes)
+    {
+        while(!cache.entries.empty() && cache.bytes + bytes > cache.max_bytes)
+            erase_entry(cache, std::prev(cache.entries.end()));
+    }
+
+    void trsm_cache_invalidate(hipblasTrsmCache& cache, const void* A)
+    {
+        for(auto it = cache.entries.begin(); it != cache.entries.end();)
+        {
+            auto next = std::next(it);
+            if(!A || it->A == A)
+                erase_entry(cache, it);
+            it = next;
+        }
+    }
+
+    // Grows the copy of B; the scratch counts against the limit as the inverses do
+    hipblasStatus_t trsm_cache_reserve_scratch(hipblasTrsmCache& cache, size_t bytes)
+    {
+        if(cache.scratch_size >= bytes)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        cache.bytes -= cache.scratch_size;
+        cache.scratch_size = 0;
+        (void)hipFree(cache.scratch);
+        cache.scratch = nullptr;
+
+        trsm_cache_evict(cache, bytes);
+        if(hipMalloc(&cache.scratch, bytes) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        cache.scratch_size = bytes;
+        cache.bytes += bytes;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Writes the inverse of the k by k triangular A to invA, which has leading dimension k and
+    // zeros outside the triangle of A
+    template <typename T>
+    hipblasStatus_t trsm_cache_invert(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      hipblasDiagType_t diag,
+                                      int               k,
+                                      const T*          A,
+                                      int               lda,
+                                      T*                invA)
+    {
+        using F = trsm_cache_functions<T>;
+
+        hipStream_t stream;
+        TRSM_CACHE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        TRSM_CACHE_RETURN_IF_HIP_ERROR(hipMemsetAsync(invA, 0, sizeof(T) * k * k, stream));
+
+        hipblasStatus_t status = F::trtri(handle, uplo, diag, k, A, lda, invA, k);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED
+           && (status != HIPBLAS_STATUS_SUCCESS || diag == HIPBLAS_DIAG_NON_UNIT))
+            return status;
+
+        // trtri does not write the unit diagonal; where it is not supported (cuBLAS) the inverse
+        // is found by solving A X = I instead
+        std::vector<T> ones(k, T(1));
+        TRSM_CACHE_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(invA,
+                                                        sizeof(T) * (k + 1),
+                                                        ones.data(),
+                                                        sizeof(T),
+                                                        sizeof(T),
+                                                        k,
+                                                        hipMemcpyHostToDevice,
+                                                        stream));
+        TRSM_CACHE_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const T                     one(1);
+        hipblasHostPointerModeGuard guard(handle);
+        return F::trsm(
+            handle, HIPBLAS_SIDE_LEFT, uplo, HIPBLAS_OP_N, diag, k, k, &one, A, lda, invA, k);
+    }
+
+    bool trsm_args_valid(hipblasSideMode_t  side,
+                         hipblasFillMode_t  uplo,
+                         hipblasOperation_t transA,
+                         hipblasDiagType_t  diag,
+                         int                m,
+                         int                n,
+                         const void*        alpha,
+                         const void*        A,
+                         int                lda,
+                         const void*        B,
+                         int                ldb)
+    {
+        const int k = side == HIPBLAS_SIDE_LEFT ? m : n;
+        return (side == HIPBLAS_SIDE_LEFT || side == HIPBLAS_SIDE_RIGHT)
+               && (uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER)
+               && (transA == HIPBLAS_OP_N || transA == HIPBLAS_OP_T || transA == HIPBLAS_OP_C)
+               && (diag == HIPBLAS_DIAG_UNIT || diag == HIPBLAS_DIAG_NON_UNIT) && m >= 0 && n >= 0
+               && lda >= std::max(1, k) && ldb >= std::max(1, m)
+               && ((alpha && A && B) || m == 0 || n == 0);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasTrsmCachedTemplate(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const T*           alpha,
+                                              const T*           A,
+                                              int                lda,
+                                              T*                 B,
+                                              int                ldb,
+                                              uint64_t           version)
+    {
+        using F = trsm_cache_functions<T>;
+
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!trsm_args_valid(side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        auto solve = [&]() {
+            return F::trsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+        };
+
+        hipblasTrsmCache&           cache = hipblasGetHandleState(handle)->trsm_cache;
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        const int    k             = side == HIPBLAS_SIDE_LEFT ? m : n;
+        const size_t inv_bytes     = sizeof(T) * k * k;
+        const size_t scratch_bytes = sizeof(T) * m * n;
+        if(inv_bytes + std::max(scratch_bytes, cache.scratch_size) > cache.max_bytes)
+            return solve();
+
+        // Allocations cannot be captured, so under capture, or in HIPBLAS_CAPTURE_MODE_SAFE, only
+        // calls which find everything allocated use the cache
+        const bool can_allocate
+            = !hipblasIsCaptureSafe(handle) && !hipblasStreamIsCapturing(handle);
+
+        auto it = std::find_if(cache.entries.begin(), cache.entries.end(), [&](const auto& e) {
+            return e.A == A && e.uplo == uplo && e.diag == diag && e.k == k && e.lda == lda
+                   && e.elem_size == sizeof(T) && e.version == version;
+        });
+
+        if(it != cache.entries.end())
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+        }
+        else
+        {
+            if(!can_allocate)
+                return solve();
+
+            // A new version or new dimensions of A make any older inverse of it stale
+            trsm_cache_invalidate(cache, A);
+            trsm_cache_evict(cache, inv_bytes);
+
+            void* invA = nullptr;
+            if(hipMalloc(&invA, inv_bytes) != hipSuccess)
+                return solve();
+
+            hipblasStatus_t status
+                = trsm_cache_invert(handle, uplo, diag, k, A, lda, static_cast<T*>(invA));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+            {
+                (void)hipFree(invA);
+                return status;
+            }
+
+            cache.entries.push_front({A, uplo, diag, k, lda, sizeof(T), version, invA, inv_bytes});
+            cache.bytes += inv_bytes;
+        }
+
+        hipblasPointerMode_t mode;
+        hipStream_t          stream;
+        TRSM_CACHE_RETURN_IF_ERROR(hipblasGetPointerMode(handle, &mode));
+        TRSM_CACHE_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        if(!can_allocate
+           && (cache.scratch_size < scratch_bytes
+               || (mode == HIPBLAS_POINTER_MODE_DEVICE && !cache.zero)))
+            return solve();
+
+        const T* invA = static_cast<const T*>(cache.entries.front().invA);
+        TRSM_CACHE_RETURN_IF_ERROR(trsm_cache_reserve_scratch(cache, scratch_bytes));
+
+        const T  host_zero(0);
+        const T* zero = &host_zero;
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            if(!cache.zero)
+            {
+                if(hipMalloc(&cache.zero, sizeof(hipblasDoubleComplex)) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                TRSM_CACHE_RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(cache.zero, 0, sizeof(hipblasDoubleComplex), stream));
+            }
+            zero = static_cast<const T*>(cache.zero);
+        }
+
+        // inv(op(A)) = op(inv(A)), so B := alpha op(inv(A)) B or alpha B op(inv(A))
+        T* tmp = static_cast<T*>(cache.scratch);
+        TRSM_CACHE_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(tmp,
+                                                        sizeof(T) * m,
+                                                        B,
+                                                        sizeof(T) * ldb,
+                                                        sizeof(T) * m,
+                                                        n,
+                                                        hipMemcpyDeviceToDevice,
+                                                        stream));
+        if(side == HIPBLAS_SIDE_LEFT)
+            return F::gemm(
+                handle, transA, HIPBLAS_OP_N, m, n, m, alpha, invA, k, tmp, m, zero, B, ldb);
+        return F::gemm(handle, HIPBLAS_OP_N, transA, m, n, n, alpha, tmp, m, invA, k, zero, B, ldb);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetTrsmCacheSize(hipblasHandle_t handle, size_t maxBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasTrsmCache&           cache = hipblasGetHandleState(handle)->trsm_cache;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.max_bytes = maxBytes;
+    if(cache.scratch_size > maxBytes)
+    {
+        cache.bytes -= cache.scratch_size;
+        cache.scratch_size = 0;
+        (void)hipFree(cache.scratch);
+        cache.scratch = nullptr;
+    }
+    trsm_cache_evict(cache, 0);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetTrsmCacheSize(hipblasHandle_t handle, size_t* maxBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(maxBytes == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasTrsmCache&           cache = hipblasGetHandleState(handle)->trsm_cache;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    *maxBytes = cache.max_bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasTrsmCacheInvalidate(hipblasHandle_t handle, const void* A)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasTrsmCache&           cache = hipblasGetHandleState(handle)->trsm_cache;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    trsm_cache_invalidate(cache, A);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmCached(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                m,
+                                   int                n,
+                                   const float*       alpha,
+                                   const float*       AP,
+                                   int                lda,
+                                   float*             BP,
+                                   int                ldb,
+                                   uint64_t           version)
+try
+{
+    return hipblasTrsmCachedTemplate(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb, version);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmCached(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                m,
+                                   int                n,
+                                   const double*      alpha,
+                                   const double*      AP,
+                                   int                lda,
+                                   double*            BP,
+                                   int                ldb,
+                                   uint64_t           version)
+try
+{
+    return hipblasTrsmCachedTemplate(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb, version);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmCached(hipblasHandle_t       handle,
+                                   hipblasSideMode_t     side,
+                                   hipblasFillMode_t     uplo,
+                                   hipblasOperation_t    transA,
+                                   hipblasDiagType_t     diag,
+                                   int                   m,
+                                   int                   n,
+                                   const hipblasComplex* alpha,
+                                   const hipblasComplex* AP,
+                                   int                   lda,
+                                   hipblasComplex*       BP,
+                                   int                   ldb,
+                                   uint64_t              version)
+try
+{
+    return hipblasTrsmCachedTemplate(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb, version);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmCached(hipblasHandle_t             handle,
+                                   hipblasSideMode_t           side,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   hipblasDiagType_t           diag,
+                                   int                         m,
+                                   int                         n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int                         lda,
+                                   hipblasDoubleComplex*       BP,
+                                   int                         ldb,
+                                   uint64_t                    version)
+try
+{
+    return hipblasTrsmCachedTemplate(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb, version);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,772 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include "xt_backend.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// The vbatched solvers sort the problems of the batch by size and call the batched solver once for
+// each run of problems which can share a call, largest first. Leading dimensions do not split a
+// run: when they differ within it, the matrices whose leading dimension is not their number of
+// rows are solved in packed copies in scratch, at two device-to-device copies each.
+//
+// getrs takes one call per distinct n and nrhs. getrf takes one call per power of two: the
+// problems with n in (N/2, N] are factorized together at size N, each matrix of another size in a
+// copy padded with an identity block,
+//
+//     [ A 0 ]
+//     [ 0 I ],
+//
+// whose factorization with partial pivoting has the factors and pivots of A in its leading block:
+// the pivot of each of the first n columns is found in the rows of A, as the rows below are zero
+// there, and the elimination leaves the identity block as it is. A run whose problems all have
+// the same n is factorized at that size, without padding.
+//
+// The arrays of pointers and the pivots are reordered through the host into scratch owned by the
+// handle, and the pivots and info of the factorizations are put back in the order of the caller
+// the same way, so the calls are synchronous.
+
+#define VBATCHED_RETURN_IF_ERROR(status__)              \
+    do                                                  \
+    {                                                   \
+        hipblasStatus_t vbatched_status__ = (status__); \
+        if(vbatched_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return vbatched_status__;                   \
+    } while(0)
+
+#define VBATCHED_RETURN_IF_HIP_ERROR(error__)   \
+    do                                          \
+    {                                           \
+        if((error__) != hipSuccess)             \
+            return HIPBLAS_STATUS_INTERNAL_ERROR; \
+    } while(0)
+
+namespace
+{
+    template <typename T>
+    struct vbatched_solver;
+
+    template <>
+    struct vbatched_solver<float>
+    {
+        static constexpr auto getrf_batched = hipblasSgetrfBatched;
+        static constexpr auto getrs_batched = hipblasSgetrsBatched;
+    };
+
+    template <>
+    struct vbatched_solver<double>
+    {
+        static constexpr auto getrf_batched = hipblasDgetrfBatched;
+        static constexpr auto getrs_batched = hipblasDgetrsBatched;
+    };
+
+    template <>
+    struct vbatched_solver<hipblasComplex>
+    {
+        static constexpr auto getrf_batched = hipblasCgetrfBatched;
+        static constexpr auto getrs_batched = hipblasCgetrsBatched;
+    };
+
+    template <>
+    struct vbatched_solver<hipblasDoubleComplex>
+    {
+        static constexpr auto getrf_batched = hipblasZgetrfBatched;
+        static constexpr auto getrs_batched = hipblasZgetrsBatched;
+    };
+
+    // Offsets of the pivots of each problem, packed one after another in the order of the batch,
+    // followed by their total
+    std::vector<size_t> pivot_offsets(const int* n, int batchCount)
+    {
+        std::vector<size_t> offsets(batchCount + 1, 0);
+        for(int i = 0; i < batchCount; i++)
+            offsets[i + 1] = offsets[i] + n[i];
+        return offsets;
+    }
+
+    // A run of sorted problems, first to last, which share one batched call of size n with leading
+    // dimensions lda and ldb
+    struct vbatched_run
+    {
+        int first;
+        int last;
+        int n;
+        int lda;
+        int ldb;
+    };
+
+    // A matrix of the caller which is solved in a packed copy in scratch, whose leading dimension
+    // is its number of rows, or in a square copy of size padded, with an identity block after the
+    // matrix, for getrf
+    template <typename T>
+    struct vbatched_copy
+    {
+        T*  matrix;
+        int ld;
+        int rows;
+        int cols;
+        T*  packed;
+        int padded = 0;
+
+        int packed_ld() const
+        {
+            return std::max(rows, padded);
+        }
+    };
+
+    // The size at which getrf factorizes a problem of size n with those of other sizes: the power
+    // of two at or above n, or n itself when that would not fit in an int
+    int padded_size(int n)
+    {
+        if(n > (1 << 30))
+            return n;
+        int size = n ? 1 : 0;
+        while(size < n)
+            size *= 2;
+        return size;
+    }
+
+    // Offset of the packed copies in scratch, after bytes of pointers, info and pivots
+    size_t packed_offset(size_t bytes)
+    {
+        return (bytes + 255) / 256 * 256;
+    }
+
+    // Copies each matrix to its packed copy, or back
+    template <typename T>
+    hipblasStatus_t
+        copy_packed(const std::vector<vbatched_copy<T>>& copies, bool pack, hipStream_t stream)
+    {
+        for(const vbatched_copy<T>& c : copies)
+            VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(pack ? c.packed : c.matrix,
+                                                          sizeof(T) * (pack ? c.packed_ld() : c.ld),
+                                                          pack ? c.matrix : c.packed,
+                                                          sizeof(T) * (pack ? c.ld : c.packed_ld()),
+                                                          sizeof(T) * c.rows,
+                                                          c.cols,
+                                                          hipMemcpyDeviceToDevice,
+                                                          stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Sets the padded copies to the identity, on whose leading block the matrices are then copied;
+    // the ones of the diagonal are copied from ones, at the stride of the diagonal
+    template <typename T>
+    hipblasStatus_t
+        pad_identity(const std::vector<vbatched_copy<T>>& copies, const T* ones, hipStream_t stream)
+    {
+        for(const vbatched_copy<T>& c : copies)
+        {
+            if(c.padded <= c.rows)
+                continue;
+            VBATCHED_RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(c.packed, 0, sizeof(T) * c.padded * c.padded, stream));
+            VBATCHED_RETURN_IF_HIP_ERROR(
+                hipMemcpy2DAsync(c.packed + size_t(c.rows) * (c.padded + 1),
+                                 sizeof(T) * (c.padded + 1),
+                                 ones,
+                                 sizeof(T),
+                                 sizeof(T),
+                                 c.padded - c.rows,
+                                 hipMemcpyDeviceToDevice,
+                                 stream));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The problems in the order they are solved: by decreasing n, then by the other dimensions,
+    // so that problems which can share a batched call are next to each other
+    template <typename Key>
+    std::vector<int> sort_by_size(int batchCount, Key key)
+    {
+        std::vector<int> order(batchCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(
+            order.begin(), order.end(), [&](int a, int b) { return key(a) > key(b); });
+        return order;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrfVbatchedTemplate(hipblasHandle_t handle,
+                                                 const int*      n,
+                                                 T* const        A[],
+                                                 const int*      lda,
+                                                 int*            ipiv,
+                                                 int*            info,
+                                                 int             batchCount)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batchCount < 0 || (batchCount && (!n || !A || !lda || !info)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        for(int i = 0; i < batchCount; i++)
+            if(n[i] < 0 || lda[i] < std::max(1, n[i]))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        VBATCHED_RETURN_IF_ERROR(hipblasCheckCapture(
+            handle, __func__, "arrays of pointers and pivots are reordered through the host"));
+
+        hipStream_t stream;
+        VBATCHED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        std::vector<T*> hA(batchCount);
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hA.data(), A, sizeof(T*) * batchCount, hipMemcpyDeviceToHost, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<int> order = sort_by_size(
+            batchCount, [&](int i) { return std::make_pair(n[i], -lda[i]); });
+        std::vector<size_t> offsets = pivot_offsets(n, batchCount);
+
+        // Problems of sizes in the same power of two share one batched call, at the size of that
+        // power when they differ and in padded copies of the matrices not of that size; when the
+        // sizes are the same but their lda differ, those whose lda is not n are factorized in
+        // packed copies
+        std::vector<vbatched_run> runs;
+        size_t                    packed_elements = 0;
+        size_t                    pivot_elements  = 0;
+        int                       max_padding     = 0;
+        for(int first = 0, last; first < batchCount; first = last)
+        {
+            int nn     = n[order[first]];
+            int bucket = padded_size(nn);
+            for(last = first + 1;
+                last < batchCount && padded_size(n[order[last]]) == bucket;
+                last++)
+                ;
+
+            // Sorted by decreasing n, then by decreasing lda
+            vbatched_run run = {first, last, nn, lda[order[first]], 0};
+            if(nn != n[order[last - 1]])
+            {
+                run.n   = bucket;
+                run.lda = bucket;
+                for(int i = first; i < last; i++)
+                {
+                    int p = order[i];
+                    if(n[p] != bucket || lda[p] != bucket)
+                        packed_elements += size_t(bucket) * bucket;
+                    max_padding = std::max(max_padding, bucket - n[p]);
+                }
+            }
+            else if(run.lda != lda[order[last - 1]])
+            {
+                run.lda = std::max(1, nn);
+                for(int i = first; i < last; i++)
+                    if(lda[order[i]] != run.lda)
+                        packed_elements += size_t(nn) * nn;
+            }
+            pivot_elements += size_t(run.n) * (last - first);
+            runs.push_back(run);
+        }
+
+        // Scratch for the reordered pointers, info, pivots, ones of the identity blocks and packed
+        // copies
+        size_t pointer_bytes = sizeof(T*) * batchCount;
+        size_t info_bytes    = sizeof(int) * batchCount;
+        size_t pivot_bytes   = sizeof(int) * offsets[batchCount];
+        size_t ones_start
+            = packed_offset(pointer_bytes + info_bytes + sizeof(int) * pivot_elements);
+        size_t packed_start = packed_offset(ones_start + sizeof(T) * max_padding);
+
+        hipblasHandleState*         state   = hipblasGetHandleState(handle);
+        hipblasDeviceScratch&       scratch = state->vbatched_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        VBATCHED_RETURN_IF_ERROR(scratch.reserve(packed_start + sizeof(T) * packed_elements));
+
+        T**  dA     = static_cast<T**>(scratch.data);
+        int* dinfo  = reinterpret_cast<int*>(static_cast<char*>(scratch.data) + pointer_bytes);
+        int* dpiv   = dinfo + batchCount;
+        T*   ones   = reinterpret_cast<T*>(static_cast<char*>(scratch.data) + ones_start);
+        T*   packed = reinterpret_cast<T*>(static_cast<char*>(scratch.data) + packed_start);
+
+        std::vector<T*>               hA_sorted(batchCount);
+        std::vector<vbatched_copy<T>> copies;
+        for(const vbatched_run& run : runs)
+            for(int i = run.first; i < run.last; i++)
+            {
+                int p        = order[i];
+                hA_sorted[i] = hA[p];
+                if((n[p] != run.n || lda[p] != run.lda) && n[p])
+                {
+                    vbatched_copy<T> c = {hA[p], lda[p], n[p], n[p], packed};
+                    if(n[p] != run.n)
+                        c.padded = run.n;
+                    copies.push_back(c);
+                    hA_sorted[i] = packed;
+                    packed += size_t(c.packed_ld()) * c.packed_ld();
+                }
+            }
+
+        std::vector<T> hones(max_padding, hipblasXtConstant<T>(1));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dA, hA_sorted.data(), pointer_bytes, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemsetAsync(dinfo, 0, info_bytes, stream));
+        if(max_padding)
+            VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                ones, hones.data(), sizeof(T) * max_padding, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_ERROR(pad_identity(copies, ones, stream));
+        VBATCHED_RETURN_IF_ERROR(copy_packed(copies, true, stream));
+
+        // The pivots of the sorted problems are packed in the sorted order, so each run has its
+        // pivots at a stride of its size, as the batched solver expects
+        size_t pivots = 0;
+        for(const vbatched_run& run : runs)
+        {
+            if(run.n)
+                VBATCHED_RETURN_IF_ERROR(
+                    vbatched_solver<T>::getrf_batched(handle,
+                                                      run.n,
+                                                      dA + run.first,
+                                                      run.lda,
+                                                      ipiv ? dpiv + pivots : nullptr,
+                                                      dinfo + run.first,
+                                                      run.last - run.first));
+            pivots += size_t(run.n) * (run.last - run.first);
+        }
+        VBATCHED_RETURN_IF_ERROR(copy_packed(copies, false, stream));
+
+        // Back to the order of the caller, with the pivots of the leading block of each padded
+        // copy
+        std::vector<int> hinfo(batchCount), hinfo_sorted(batchCount);
+        std::vector<int> hpiv(ipiv ? offsets[batchCount] : 0);
+        std::vector<int> hpiv_sorted(ipiv ? pivot_elements : 0);
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hinfo_sorted.data(), dinfo, info_bytes, hipMemcpyDeviceToHost, stream));
+        if(ipiv)
+            VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(hpiv_sorted.data(),
+                                                        dpiv,
+                                                        sizeof(int) * pivot_elements,
+                                                        hipMemcpyDeviceToHost,
+                                                        stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        pivots = 0;
+        for(const vbatched_run& run : runs)
+            for(int i = run.first; i < run.last; i++)
+            {
+                int p    = order[i];
+                hinfo[p] = hinfo_sorted[i];
+                if(ipiv)
+                    std::copy_n(hpiv_sorted.data() + pivots, n[p], hpiv.data() + offsets[p]);
+                pivots += run.n;
+            }
+
+        VBATCHED_RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(info, hinfo.data(), info_bytes, hipMemcpyHostToDevice, stream));
+        if(ipiv)
+            VBATCHED_RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(ipiv, hpiv.data(), pivot_bytes, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrsVbatchedTemplate(hipblasHandle_t          handle,
+                                                 const hipblasOperation_t trans,
+                                                 const int*               n,
+                                                 const int*               nrhs,
+                                                 T* const                 A[],
+                                                 const int*               lda,
+                                                 const int*               ipiv,
+                                                 T* const                 B[],
+                                                 const int*               ldb,
+                                                 int*                     info,
+                                                 const int                batchCount)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        *info = 0;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            *info = -1;
+        else if(batchCount < 0)
+            *info = -10;
+        else if(batchCount && !n)
+            *info = -2;
+        else if(batchCount && !nrhs)
+            *info = -3;
+        else if(batchCount && !A)
+            *info = -4;
+        else if(batchCount && !lda)
+            *info = -5;
+        else if(batchCount && !ipiv)
+            *info = -6;
+        else if(batchCount && !B)
+            *info = -7;
+        else if(batchCount && !ldb)
+            *info = -8;
+        for(int i = 0; i < batchCount && !*info; i++)
+        {
+            if(n[i] < 0)
+                *info = -2;
+            else if(nrhs[i] < 0)
+                *info = -3;
+            else if(lda[i] < std::max(1, n[i]))
+                *info = -5;
+            else if(ldb[i] < std::max(1, n[i]))
+                *info = -8;
+        }
+
+        HIPBLAS_CHECK_INFO_CAPTURE(info);
+        if(*info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        VBATCHED_RETURN_IF_ERROR(hipblasCheckCapture(
+            handle, __func__, "arrays of pointers and pivots are reordered through the host"));
+
+        hipStream_t stream;
+        VBATCHED_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+
+        std::vector<size_t> offsets     = pivot_offsets(n, batchCount);
+        size_t              pointer_bytes = sizeof(T*) * batchCount;
+        size_t              pivot_bytes   = sizeof(int) * offsets[batchCount];
+
+        std::vector<T*>  hA(batchCount), hB(batchCount);
+        std::vector<int> hpiv(offsets[batchCount]);
+        VBATCHED_RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(hA.data(), A, pointer_bytes, hipMemcpyDeviceToHost, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(hB.data(), B, pointer_bytes, hipMemcpyDeviceToHost, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(hpiv.data(), ipiv, pivot_bytes, hipMemcpyDeviceToHost, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<int> order = sort_by_size(batchCount, [&](int i) {
+            return std::make_tuple(n[i], nrhs[i], -lda[i], -ldb[i]);
+        });
+
+        // The arrays of pointers and the pivots in the sorted order
+        std::vector<T*>  hA_sorted(batchCount), hB_sorted(batchCount);
+        std::vector<int> hpiv_sorted(offsets[batchCount]);
+        size_t           pivots = 0;
+        for(int i = 0; i < batchCount; i++)
+        {
+            int p        = order[i];
+            hA_sorted[i] = hA[p];
+            hB_sorted[i] = hB[p];
+            std::copy_n(hpiv.data() + offsets[p], n[p], hpiv_sorted.data() + pivots);
+            pivots += n[p];
+        }
+
+        // Problems of the same n and nrhs share one batched call; when their lda or ldb differ,
+        // those whose lda or ldb is not n are solved with packed copies of A or B
+        std::vector<vbatched_run> runs;
+        size_t                    packed_elements = 0;
+        for(int first = 0, last; first < batchCount; first = last)
+        {
+            int p = order[first];
+            for(last = first + 1;
+                last < batchCount && n[order[last]] == n[p] && nrhs[order[last]] == nrhs[p];
+                last++)
+                ;
+
+            vbatched_run run = {first, last, n[p], lda[p], ldb[p]};
+            bool         lda_differ = false, ldb_differ = false;
+            for(int i = first; i < last; i++)
+            {
+                lda_differ = lda_differ || lda[order[i]] != run.lda;
+                ldb_differ = ldb_differ || ldb[order[i]] != run.ldb;
+            }
+            if(lda_differ)
+                run.lda = std::max(1, n[p]);
+            if(ldb_differ)
+                run.ldb = std::max(1, n[p]);
+            for(int i = first; i < last && n[p] && nrhs[p]; i++)
+            {
+                if(lda[order[i]] != run.lda)
+                    packed_elements += size_t(n[p]) * n[p];
+                if(ldb[order[i]] != run.ldb)
+                    packed_elements += size_t(n[p]) * nrhs[p];
+            }
+            runs.push_back(run);
+        }
+
+        size_t packed_start = packed_offset(2 * pointer_bytes + pivot_bytes);
+
+        hipblasHandleState*         state   = hipblasGetHandleState(handle);
+        hipblasDeviceScratch&       scratch = state->vbatched_scratch;
+        std::lock_guard<std::mutex> lock(scratch.mutex);
+        VBATCHED_RETURN_IF_ERROR(scratch.reserve(packed_start + sizeof(T) * packed_elements));
+
+        T**  dA     = static_cast<T**>(scratch.data);
+        T**  dB     = dA + batchCount;
+        int* dpiv   = reinterpret_cast<int*>(dB + batchCount);
+        T*   packed = reinterpret_cast<T*>(static_cast<char*>(scratch.data) + packed_start);
+
+        std::vector<vbatched_copy<T>> copies_A, copies_B;
+        for(const vbatched_run& run : runs)
+            for(int i = run.first; i < run.last; i++)
+            {
+                int p = order[i];
+                if(!n[p] || !nrhs[p])
+                    continue;
+                if(lda[p] != run.lda)
+                {
+                    copies_A.push_back({hA[p], lda[p], n[p], n[p], packed});
+                    hA_sorted[i] = packed;
+                    packed += size_t(n[p]) * n[p];
+                }
+                if(ldb[p] != run.ldb)
+                {
+                    copies_B.push_back({hB[p], ldb[p], n[p], nrhs[p], packed});
+                    hB_sorted[i] = packed;
+                    packed += size_t(n[p]) * nrhs[p];
+                }
+            }
+
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dA, hA_sorted.data(), pointer_bytes, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dB, hB_sorted.data(), pointer_bytes, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dpiv, hpiv_sorted.data(), pivot_bytes, hipMemcpyHostToDevice, stream));
+        VBATCHED_RETURN_IF_ERROR(copy_packed(copies_A, true, stream));
+        VBATCHED_RETURN_IF_ERROR(copy_packed(copies_B, true, stream));
+
+        pivots = 0;
+        for(const vbatched_run& run : runs)
+        {
+            int p = order[run.first];
+            if(n[p] && nrhs[p])
+                VBATCHED_RETURN_IF_ERROR(vbatched_solver<T>::getrs_batched(handle,
+                                                                           trans,
+                                                                           n[p],
+                                                                           nrhs[p],
+                                                                           dA + run.first,
+                                                                           run.lda,
+                                                                           dpiv + pivots,
+                                                                           dB + run.first,
+                                                                           run.ldb,
+                                                                           info,
+                                                                           run.last - run.first));
+            pivots += size_t(n[p]) * (run.last - run.first);
+        }
+        VBATCHED_RETURN_IF_ERROR(copy_packed(copies_B, false, stream));
+
+        // The pointers and pivots are copied from host vectors which go out of scope on return
+        VBATCHED_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" {
+hipblasStatus_t hipblasSgetrfVbatched(hipblasHandle_t handle,
+                                      const int*      n,
+                                      float* const    A[],
+                                      const int*      lda,
+                                      int*            ipiv,
+                                      int*            info,
+                                      const int       batchCount)
+try
+{
+    return hipblasGetrfVbatchedTemplate(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetrfVbatched(hipblasHandle_t handle,
+                                      const int*      n,
+                                      double* const   A[],
+                                      const int*      lda,
+                                      int*            ipiv,
+                                      int*            info,
+                                      const int       batchCount)
+try
+{
+    return hipblasGetrfVbatchedTemplate(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetrfVbatched(hipblasHandle_t       handle,
+                                      const int*            n,
+                                      hipblasComplex* const A[],
+                                      const int*            lda,
+                                      int*                  ipiv,
+                                      int*                  info,
+                                      const int             batchCount)
+try
+{
+    return hipblasGetrfVbatchedTemplate(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetrfVbatched(hipblasHandle_t             handle,
+                                      const int*                  n,
+                                      hipblasDoubleComplex* const A[],
+                                      const int*                  lda,
+                                      int*                        ipiv,
+                                      int*                        info,
+                                      const int                   batchCount)
+try
+{
+    return hipblasGetrfVbatchedTemplate(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgetrsVbatched(hipblasHandle_t          handle,
+                                      const hipblasOperation_t trans,
+                                      const int*               n,
+                                      const int*               nrhs,
+                                      float* const             A[],
+                                      const int*               lda,
+                                      const int*               ipiv,
+                                      float* const             B[],
+                                      const int*               ldb,
+                                      int*                     info,
+                                      const int                batchCount)
+try
+{
+    return hipblasGetrsVbatchedTemplate(handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetrsVbatched(hipblasHandle_t          handle,
+                                      const hipblasOperation_t trans,
+                                      const int*               n,
+                                      const int*               nrhs,
+                                      double* const            A[],
+                                      const int*               lda,
+                                      const int*               ipiv,
+                                      double* const            B[],
+                                      const int*               ldb,
+                                      int*                     info,
+                                      const int                batchCount)
+try
+{
+    return hipblasGetrsVbatchedTemplate(handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetrsVbatched(hipblasHandle_t          handle,
+                                      const hipblasOperation_t trans,
+                                      const int*               n,
+                                      const int*               nrhs,
+                                      hipblasComplex* const    A[],
+                                      const int*               lda,
+                                      const int*               ipiv,
+                                      hipblasComplex* const    B[],
+                                      const int*               ldb,
+                                      int*                     info,
+                                      const int                batchCount)
+try
+{
+    return hipblasGetrsVbatchedTemplate(handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetrsVbatched(hipblasHandle_t             handle,
+                                      const hipblasOperation_t    trans,
+                                      const int*                  n,
+                                      const int*                  nrhs,
+                                      hipblasDoubleComplex* const A[],
+                                      const int*                  lda,
+                                      const int*                  ipiv,
+                                      hipblasDoubleComplex* const B[],
+                                      const int*                  ldb,
+                                      int*                        info,
+                                      const int                   batchCount)
+try
+{
+    return hipblasGetrsVbatchedTemplate(handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+} // extern "C"
+
+#endif
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "workspace_pool.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <chrono>
+#include <hip/hip_runtime_api.h>
+#include <string>
+
+hipblasWorkspacePool::~hipblasWorkspacePool()
+{
+    // Memory still being freed in stream order is released by the runtime once it has been
+    if(pool)
+        (void)hipMemPoolDestroy(pool);
+    if(stream_change)
+        (void)hipEventDestroy(stream_change);
+}
+
+namespace
+{
+    // Creates the pool of the workspace on the current device; called with the state mutex held
+    hipblasStatus_t create_workspace_pool(hipblasWorkspacePool& pool)
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipMemPoolProps props = {};
+        props.allocType       = hipMemAllocationTypePinned;
+        props.location.type   = hipMemLocationTypeDevice;
+        props.location.id     = device;
+        if(hipMemPoolCreate(&pool.pool, &props) != hipSuccess)
+        {
+            pool.pool = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        uint64_t threshold = pool.release_threshold;
+        if(hipMemPoolSetAttribute(pool.pool, hipMemPoolAttrReleaseThreshold, &threshold)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Replaces the workspace owned by hipBLAS with one of bytes, from the pool if pooled, and
+    // hands it to the backend; a size of 0 hands the backend back its own. Called with the state
+    // mutex held.
+    hipblasStatus_t replace_workspace(hipblasHandle_t            handle,
+                                      hipblasHandleState*        state,
+                                      size_t                     bytes,
+                                      bool                       pooled,
+                                      hipblasSetBackendWorkspace set_workspace)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(pooled && !state->workspace_pool.pool)
+        {
+            status = create_workspace_pool(state->workspace_pool);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        void*      workspace = nullptr;
+        hipError_t error     = hipSuccess;
+        auto       start     = std::chrono::steady_clock::now();
+        if(bytes && pooled)
+            error = hipMallocFromPoolAsync(&workspace, bytes, state->workspace_pool.pool, stream);
+        else if(bytes)
+            error = hipMalloc(&workspace, bytes);
+        if(error != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        std::chrono::duration<double, std::micro> elapsed
+            = std::chrono::steady_clock::now() - start;
+
+        status = set_workspace(handle, workspace, bytes);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            if(pooled)
+                (void)hipFreeAsync(workspace, stream);
+            else
+                (void)hipFree(workspace);
+            return status;
+        }
+
+        hipblasFreeWorkspace(handle, state);
+        state->workspace           = workspace;
+        state->workspace_size      = bytes;
+        state->workspace_pooled    = pooled && workspace;
+        state->peak_workspace_size = std::max(state->peak_workspace_size, bytes);
+        state->workspace_alloc_us += elapsed.count();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+void hipblasFreeWorkspace(hipblasHandle_t handle, hipblasHandleState* state)
+{
+    if(!state->workspace)
+        return;
+
+    hipStream_t stream;
+    if(state->workspace_pooled && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS)
+        (void)hipFreeAsync(state->workspace, stream);
+    else
+    {
+        // The backend may still have work queued which uses the workspace
+        (void)hipDeviceSynchronize();
+        (void)hipFree(state->workspace);
+    }
+    state->workspace        = nullptr;
+    state->workspace_size   = 0;
+    state->workspace_pooled = false;
+}
+
+hipblasStatus_t hipblasPoolWorkspaceStreamChange(hipblasHandle_t handle, hipStream_t stream)
+{
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    hipStream_t                 old_stream;
+    if(!state->workspace_pooled || hipblasGetStream(handle, &old_stream) != HIPBLAS_STATUS_SUCCESS
+       || old_stream == stream)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // Work on a stream being captured runs when the graph is launched, and cannot be waited on
+    // from outside the capture, nor a capture made to wait on work outside it
+    hipStreamCaptureStatus old_capture = hipStreamCaptureStatusNone;
+    hipStreamCaptureStatus new_capture = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(old_stream, &old_capture) != hipSuccess
+       || hipStreamIsCapturing(stream, &new_capture) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(old_capture != hipStreamCaptureStatusNone || new_capture != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasWorkspacePool& pool = state->workspace_pool;
+    if(!pool.stream_change
+       && hipEventCreateWithFlags(&pool.stream_change, hipEventDisableTiming) != hipSuccess)
+    {
+        pool.stream_change = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(hipEventRecord(pool.stream_change, old_stream) != hipSuccess
+       || hipStreamWaitEvent(stream, pool.stream_change, 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasPoolWorkspaceReserve(hipblasHandle_t            handle,
+                                            const char*                func,
+                                            size_t                     bytes,
+                                            bool                       growth,
+                                            hipblasSetBackendWorkspace set_workspace)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if(bytes <= state->workspace_size)
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The pool allocates in stream order, but the workspace outlives any graph it would be
+    // allocated by, so growing it is still kept out of captures
+    hipblasStatus_t status
+        = hipblasCheckCapture(handle, func, "workspace growth to %zu bytes", size_t(bytes));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(bytes <= state->workspace_size)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    status = replace_workspace(handle, state, bytes, true, set_workspace);
+    if(status == HIPBLAS_STATUS_SUCCESS && growth)
+        state->workspace_growths++;
+    return status;
+}
+
+hipblasStatus_t hipblasTrimOwnedWorkspace(hipblasHandle_t            handle,
+                                          size_t                     bytes,
+                                          hipblasSetBackendWorkspace set_workspace)
+{
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(bytes >= state->workspace_size)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    return replace_workspace(handle,
+                             state,
+                             bytes,
+                             state->workspace_alloc_mode == HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED,
+                             set_workspace);
+}
+
+extern "C" hipblasStatus_t hipblasSetWorkspaceReleaseThreshold(hipblasHandle_t handle,
+                                                               uint64_t        releaseThreshold)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->workspace_pool.release_threshold = releaseThreshold;
+    if(state->workspace_pool.pool
+       && hipMemPoolSetAttribute(
+              state->workspace_pool.pool, hipMemPoolAttrReleaseThreshold, &releaseThreshold)
+              != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetWorkspaceReleaseThreshold(hipblasHandle_t handle,
+                                                               uint64_t*       releaseThreshold)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(releaseThreshold == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    *releaseThreshold = state->workspace_pool.release_threshold;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+// With hipblasSetBatchStreams, a batched solver call is split into sub-batches which run
+// concurrently on internal streams, each with a handle of its own, forked from and joined back to
+// the stream of the caller with events. The sub-handles take the settings of the caller's handle
+// at each call; calls in HIPBLAS_CAPTURE_MODE_SAFE or being captured are not split. The backends
+// call the templates below first; they call the same function again with the sub-handles, which
+// are not split.
+
+// Returns true if batched calls on handle may be split; false inside a call being made unsplit
+bool hipblasIsBatchSplit(hipblasHandle_t handle);
+
+// A sub-batch of count problems, starting at problem offset, to run on handle
+using hipblasBatchCall
+    = std::function<hipblasStatus_t(hipblasHandle_t handle, int offset, int count)>;
+
+// Runs the batchCount problems of a batched call, of about flops operations each, as calls on
+// sub-batches. The number of sub-batches is the number of streams of the handle, reduced so that
+// each has enough work to pay for its fork and join; with one, call is made with handle itself.
+hipblasStatus_t hipblasBatchSplit(hipblasHandle_t         handle,
+                                  int                     batchCount,
+                                  double                  flops,
+                                  const hipblasBatchCall& call);
+
+// Operation counts of one problem for the cost model, as in clients/include/flops.hpp, with four
+// real operations for each complex one
+template <typename T>
+constexpr double hipblasBatchSplitScale
+    = std::is_same<T, hipblasComplex>{} || std::is_same<T, hipblasDoubleComplex>{} ? 4.0 : 1.0;
+
+template <typename T>
+constexpr double hipblasGetrfFlops(int n)
+{
+    return hipblasBatchSplitScale<T> * double(n) * n * n;
+}
+
+template <typename T>
+constexpr double hipblasGetrsFlops(int n, int nrhs)
+{
+    return hipblasBatchSplitScale<T> * 2.0 * n * n * nrhs;
+}
+
+// The QR factorization, counted as geqrf_gflop_count does, and its application to B
+template <typename T>
+constexpr double hipblasGelsFlops(int m, int n, int nrhs)
+{
+    double k = m > n ? m : n;
+    return hipblasBatchSplitScale<T> * ((4.0 / 3.0) * k * k * k + 4.0 * m * n * nrhs);
+}
+
+// The sub-batches of each solver; fn is the function being split. A problem count of 0 for
+// missing arrays leaves the call unsplit, for the backend to report.
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGetrfBatchedSplit(Fn              fn,
+                                         hipblasHandle_t handle,
+                                         int             n,
+                                         T* const        A[],
+                                         int             lda,
+                                         int*            ipiv,
+                                         int*            info,
+                                         int             batchCount)
+{
+    double flops = A && info ? hipblasGetrfFlops<T>(n) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h, n, A + i, lda, ipiv ? ipiv + int64_t(i) * n : nullptr, info + i, count);
+    });
+}
+
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGetrfStridedBatchedSplit(Fn              fn,
+                                                hipblasHandle_t handle,
+                                                int             n,
+                                                T*              A,
+                                                int             lda,
+                                                hipblasStride   strideA,
+                                                int*            ipiv,
+                                                hipblasStride   strideP,
+                                                int*            info,
+                                                int             batchCount)
+{
+    double flops = A && info ? hipblasGetrfFlops<T>(n) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h,
+                  n,
+                  A + i * strideA,
+                  lda,
+                  strideA,
+                  ipiv ? ipiv + i * strideP : nullptr,
+                  strideP,
+                  info + i,
+                  count);
+    });
+}
+
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGetrsBatchedSplit(Fn                 fn,
+                                         hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                n,
+                                         int                nrhs,
+                                         T* const           A[],
+                                         int                lda,
+                                         const int*         ipiv,
+                                         T* const           B[],
+                                         int                ldb,
+                                         int*               info,
+                                         int                batchCount)
+{
+    double flops = A && ipiv && B ? hipblasGetrsFlops<T>(n, nrhs) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h, trans, n, nrhs, A + i, lda, ipiv + int64_t(i) * n, B + i, ldb, info, count);
+    });
+}
+
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGetrsStridedBatchedSplit(Fn                 fn,
+                                                hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                int                nrhs,
+                                                T*                 A,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                const int*         ipiv,
+                                                hipblasStride      strideP,
+                                                T*                 B,
+                                                int                ldb,
+                                                hipblasStride      strideB,
+                                                int*               info,
+                                                int                batchCount)
+{
+    double flops = A && ipiv && B ? hipblasGetrsFlops<T>(n, nrhs) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h,
+                  trans,
+                  n,
+                  nrhs,
+                  A + i * strideA,
+                  lda,
+                  strideA,
+                  ipiv + i * strideP,
+                  strideP,
+                  B + i * strideB,
+                  ldb,
+                  strideB,
+                  info,
+                  count);
+    });
+}
+
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGelsBatchedSplit(Fn                 fn,
+                                        hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        int                nrhs,
+                                        T* const           A[],
+                                        int                lda,
+                                        T* const           B[],
+                                        int                ldb,
+                                        int*               info,
+                                        int*               deviceInfo,
+                                        int                batchCount)
+{
+    double flops = A && B && deviceInfo ? hipblasGelsFlops<T>(m, n, nrhs) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h, trans, m, n, nrhs, A + i, lda, B + i, ldb, info, deviceInfo + i, count);
+    });
+}
+
+template <typename Fn, typename T>
+hipblasStatus_t hipblasGelsStridedBatchedSplit(Fn                 fn,
+                                               hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               int                nrhs,
+                                               T*                 A,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               T*                 B,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int*               info,
+                                               int*               deviceInfo,
+                                               int                batchCount)
+{
+    double flops = A && B && deviceInfo ? hipblasGelsFlops<T>(m, n, nrhs) : 0;
+    return hipblasBatchSplit(handle, batchCount, flops, [&](hipblasHandle_t h, int i, int count) {
+        return fn(h,
+                  trans,
+                  m,
+                  n,
+                  nrhs,
+                  A + i * strideA,
+                  lda,
+                  strideA,
+                  B + i * strideB,
+                  ldb,
+                  strideB,
+                  info,
+                  deviceInfo + i,
+                  count);
+    });
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+
+// Complex gemms of a handle in HIPBLAS_COMPLEX_GEMM_MODE_3M are computed here with the 3M
+// algorithm, on top of the real gemm of the backend. direct is called instead, to run the
+// standard algorithm, when the call is not eligible: the handle is in the default mode, the
+// arguments are invalid or describe a quick return, the pointer mode is device, or the call is
+// being captured (see hipblasSetComplexGemmMode).
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t                  handle,
+                              hipblasOperation_t               transa,
+                              hipblasOperation_t               transb,
+                              int                              m,
+                              int                              n,
+                              int                              k,
+                              const hipblasComplex*            alpha,
+                              const hipblasComplex*            A,
+                              int                              lda,
+                              const hipblasComplex*            B,
+                              int                              ldb,
+                              const hipblasComplex*            beta,
+                              hipblasComplex*                  C,
+                              int                              ldc,
+                              std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t                  handle,
+                              hipblasOperation_t               transa,
+                              hipblasOperation_t               transb,
+                              int                              m,
+                              int                              n,
+                              int                              k,
+                              const hipblasDoubleComplex*      alpha,
+                              const hipblasDoubleComplex*      A,
+                              int                              lda,
+                              const hipblasDoubleComplex*      B,
+                              int                              ldb,
+                              const hipblasDoubleComplex*      beta,
+                              hipblasDoubleComplex*            C,
+                              int                              ldc,
+                              std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasGemm3mBatched(hipblasHandle_t                  handle,
+                                     hipblasOperation_t               transa,
+                                     hipblasOperation_t               transb,
+                                     int                              m,
+                                     int                              n,
+                                     int                              k,
+                                     const hipblasComplex*            alpha,
+                                     const hipblasComplex* const      A[],
+                                     int                              lda,
+                                     const hipblasComplex* const      B[],
+                                     int                              ldb,
+                                     const hipblasComplex*            beta,
+                                     hipblasComplex* const            C[],
+                                     int                              ldc,
+                                     int                              batchCount,
+                                     std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasGemm3mBatched(hipblasHandle_t                   handle,
+                                     hipblasOperation_t                transa,
+                                     hipblasOperation_t                transb,
+                                     int                               m,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     const hipblasDoubleComplex* const B[],
+                                     int                               ldb,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       C[],
+                                     int                               ldc,
+                                     int                               batchCount,
+                                     std::function<hipblasStatus_t()>  direct);
+
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t                  handle,
+                                            hipblasOperation_t               transa,
+                                            hipblasOperation_t               transb,
+                                            int                              m,
+                                            int                              n,
+                                            int                              k,
+                                            const hipblasComplex*            alpha,
+                                            const hipblasComplex*            A,
+                                            int                              lda,
+                                            long long                        strideA,
+                                            const hipblasComplex*            B,
+                                            int                              ldb,
+                                            long long                        strideB,
+                                            const hipblasComplex*            beta,
+                                            hipblasComplex*                  C,
+                                            int                              ldc,
+                                            long long                        strideC,
+                                            int                              batchCount,
+                                            std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t                  handle,
+                                            hipblasOperation_t               transa,
+                                            hipblasOperation_t               transb,
+                                            int                              m,
+                                            int                              n,
+                                            int                              k,
+                                            const hipblasDoubleComplex*      alpha,
+                                            const hipblasDoubleComplex*      A,
+                                            int                              lda,
+                                            long long                        strideA,
+                                            const hipblasDoubleComplex*      B,
+                                            int                              ldb,
+                                            long long                        strideB,
+                                            const hipblasDoubleComplex*      beta,
+                                            hipblasDoubleComplex*            C,
+                                            int                              ldc,
+                                            long long                        strideC,
+                                            int                              batchCount,
+                                            std::function<hipblasStatus_t()> direct);
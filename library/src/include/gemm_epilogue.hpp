@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// hipblasGemmExEpilogue checks its arguments and calls the backend, which computes the gemm and
+// applies the epilogue on the device, or returns HIPBLAS_STATUS_NOT_SUPPORTED before writing C if
+// it cannot. cuBLAS applies it in cublasLtMatmul, and on rocBLAS hipBLASLt does in
+// hipblasLtMatmul when hipBLAS is built with it; those without an activation are otherwise
+// applied by hipblasGemmExEpilogueBlas. Defined by each backend, inside its extern "C" block.
+extern "C" hipblasStatus_t
+    hipblasGemmExEpilogueBackend(hipblasHandle_t              handle,
+                                 hipblasOperation_t           transA,
+                                 hipblasOperation_t           transB,
+                                 int                          m,
+                                 int                          n,
+                                 int                          k,
+                                 const void*                  alpha,
+                                 const void*                  A,
+                                 hipDataType                  aType,
+                                 int                          lda,
+                                 const void*                  B,
+                                 hipDataType                  bType,
+                                 int                          ldb,
+                                 const void*                  beta,
+                                 void*                        C,
+                                 hipDataType                  cType,
+                                 int                          ldc,
+                                 hipblasComputeType_t         computeType,
+                                 hipblasGemmAlgo_t            algo,
+                                 const hipblasGemmEpilogue_t& epilogue);
+
+// alpha and beta of a gemm with the scale of an epilogue folded in, which saves a pass over C.
+// Only scalars on the host whose compute type takes them in float or double are folded; for
+// others folded() is false and alpha() and beta() are those given.
+class hipblasGemmEpilogueScale
+{
+public:
+    hipblasGemmEpilogueScale(hipblasHandle_t      handle,
+                             hipblasComputeType_t computeType,
+                             const void*          alpha,
+                             const void*          beta,
+                             double               scale);
+
+    hipblasGemmEpilogueScale(const hipblasGemmEpilogueScale&) = delete;
+    hipblasGemmEpilogueScale& operator=(const hipblasGemmEpilogueScale&) = delete;
+
+    bool folded() const
+    {
+        return m_folded;
+    }
+
+    const void* alpha() const
+    {
+        return m_alpha;
+    }
+
+    const void* beta() const
+    {
+        return m_beta;
+    }
+
+private:
+    bool        m_folded = false;
+    const void* m_alpha;
+    const void* m_beta;
+    float       m_float[2];
+    double      m_double[2];
+};
+
+// Adds bias to every column of the m by n matrix C, copies the result to aux and scales C, for
+// the epilogues with no activation; either of bias and aux may be nullptr. When folded, the
+// gemm computing C was already scaled, and aux must be nullptr. The bias is added by a gemm with
+// k = 1 against a vector of ones, and the scale by a gemm with k = 0 or together with the bias.
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED for types of C other than real 16F, 16BF, 32F and 64F.
+hipblasStatus_t hipblasGemmEpilogueBlas(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const void*     bias,
+                                        void*           aux,
+                                        int             ldaux,
+                                        double          scale,
+                                        bool            folded,
+                                        void*           C,
+                                        hipDataType     cType,
+                                        int             ldc);
+
+// gemmEx with an epilogue without an activation, through hipblasGemmEx_v2 and
+// hipblasGemmEpilogueBlas, with the scale folded into the gemm unless aux takes the values
+// before it. Returns HIPBLAS_STATUS_NOT_SUPPORTED for epilogues with an activation.
+hipblasStatus_t hipblasGemmExEpilogueBlas(hipblasHandle_t              handle,
+                                          hipblasOperation_t           transA,
+                                          hipblasOperation_t           transB,
+                                          int                          m,
+                                          int                          n,
+                                          int                          k,
+                                          const void*                  alpha,
+                                          const void*                  A,
+                                          hipDataType                  aType,
+                                          int                          lda,
+                                          const void*                  B,
+                                          hipDataType                  bType,
+                                          int                          ldb,
+                                          const void*                  beta,
+                                          void*                        C,
+                                          hipDataType                  cType,
+                                          int                          ldc,
+                                          hipblasComputeType_t         computeType,
+                                          hipblasGemmAlgo_t            algo,
+                                          const hipblasGemmEpilogue_t& epilogue);
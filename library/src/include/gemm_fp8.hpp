@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// The OCP FP8 types of hipDataType, HIP_R_8F_E4M3 and HIP_R_8F_E5M2, are declared from HIP 6.3
+#if HIP_VERSION >= 60300000
+#define HIPBLAS_OCP_FP8
+#endif
+
+// gemmEx with FP8 inputs in A and B, both in the FNUZ formats, HIP_R_8F_E4M3_FNUZ or
+// HIP_R_8F_E5M2_FNUZ, or both in the OCP formats, HIP_R_8F_E4M3 or HIP_R_8F_E5M2, producing
+// bfloat16 or float with FP32 accumulation. The product is computed natively by the backend hooks
+// below, which return HIPBLAS_STATUS_NOT_SUPPORTED where the backend or the device has no FP8 gemm
+// for the formats: rocBLAS computes the FNUZ ones and cublasLt the OCP ones. The per-tensor scales
+// are device pointers, or nullptr for 1; the hooks apply them natively where the backend can, and
+// otherwise they are folded into alpha on the device. The _v2 gemmEx functions call these when A
+// or B is FP8, with no scales.
+bool hipblasIsFp8Datatype(hipDataType type);
+
+bool hipblasIsOcpFp8Datatype(hipDataType type);
+
+hipblasStatus_t hipblasGemmExFp8(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transa,
+                                 hipblasOperation_t   transb,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          a_type,
+                                 int                  lda,
+                                 const void*          B,
+                                 hipDataType          b_type,
+                                 int                  ldb,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          c_type,
+                                 int                  ldc,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasGemmAlgo_t    algo,
+                                 const float*         scale_a,
+                                 const float*         scale_b);
+
+hipblasStatus_t hipblasGemmBatchedExFp8(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A[],
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B[],
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C[],
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        const float*         scale_a,
+                                        const float*         scale_b);
+
+hipblasStatus_t hipblasGemmStridedBatchedExFp8(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               hipblasStride        stride_a,
+                                               const void*          B,
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               hipblasStride        stride_b,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               hipblasStride        stride_c,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo,
+                                               const float*         scale_a,
+                                               const float*         scale_b);
+
+// The FP8 gemms of the backend, called with checked arguments, a non-empty problem and scalars in
+// the pointer mode of the handle; C is computed in place with FP32 accumulation. They return
+// HIPBLAS_STATUS_NOT_SUPPORTED for scales they cannot apply natively, which are then folded into
+// alpha and the hook called again without them.
+extern "C" hipblasStatus_t hipblasGemmExFp8Backend(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const void*        alpha,
+                                                   const void*        A,
+                                                   hipDataType        a_type,
+                                                   int                lda,
+                                                   const void*        B,
+                                                   hipDataType        b_type,
+                                                   int                ldb,
+                                                   const void*        beta,
+                                                   void*              C,
+                                                   hipDataType        c_type,
+                                                   int                ldc,
+                                                   hipblasGemmAlgo_t  algo,
+                                                   const float*       scale_a,
+                                                   const float*       scale_b);
+
+extern "C" hipblasStatus_t hipblasGemmBatchedExFp8Backend(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const void*        alpha,
+                                                          const void*        A[],
+                                                          hipDataType        a_type,
+                                                          int                lda,
+                                                          const void*        B[],
+                                                          hipDataType        b_type,
+                                                          int                ldb,
+                                                          const void*        beta,
+                                                          void*              C[],
+                                                          hipDataType        c_type,
+                                                          int                ldc,
+                                                          int                batch_count,
+                                                          hipblasGemmAlgo_t  algo,
+                                                          const float*       scale_a,
+                                                          const float*       scale_b);
+
+extern "C" hipblasStatus_t hipblasGemmStridedBatchedExFp8Backend(hipblasHandle_t    handle,
+                                                                 hipblasOperation_t transa,
+                                                                 hipblasOperation_t transb,
+                                                                 int                m,
+                                                                 int                n,
+                                                                 int                k,
+                                                                 const void*        alpha,
+                                                                 const void*        A,
+                                                                 hipDataType        a_type,
+                                                                 int                lda,
+                                                                 hipblasStride      stride_a,
+                                                                 const void*        B,
+                                                                 hipDataType        b_type,
+                                                                 int                ldb,
+                                                                 hipblasStride      stride_b,
+                                                                 const void*        beta,
+                                                                 void*              C,
+                                                                 hipDataType        c_type,
+                                                                 int                ldc,
+                                                                 hipblasStride      stride_c,
+                                                                 int                batch_count,
+                                                                 hipblasGemmAlgo_t  algo,
+                                                                 const float*       scale_a,
+                                                                 const float*       scale_b);
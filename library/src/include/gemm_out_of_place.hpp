@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// The out-of-place gemmEx functions for backends which cannot write D separately from C: C is
+// copied to D on the stream, and the product is computed in place on D by the _v2 gemmEx of the
+// backend. D must be of the type of C.
+
+hipblasStatus_t hipblasGemmExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                              hipblasOperation_t   transa,
+                                              hipblasOperation_t   transb,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              hipDataType          a_type,
+                                              int                  lda,
+                                              const void*          B,
+                                              hipDataType          b_type,
+                                              int                  ldb,
+                                              const void*          beta,
+                                              const void*          C,
+                                              hipDataType          c_type,
+                                              int                  ldc,
+                                              void*                D,
+                                              hipDataType          d_type,
+                                              int                  ldd,
+                                              hipblasComputeType_t compute_type,
+                                              hipblasGemmAlgo_t    algo);
+
+hipblasStatus_t hipblasGemmBatchedExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                                     hipblasOperation_t   transa,
+                                                     hipblasOperation_t   transb,
+                                                     int                  m,
+                                                     int                  n,
+                                                     int                  k,
+                                                     const void*          alpha,
+                                                     const void*          A[],
+                                                     hipDataType          a_type,
+                                                     int                  lda,
+                                                     const void*          B[],
+                                                     hipDataType          b_type,
+                                                     int                  ldb,
+                                                     const void*          beta,
+                                                     const void*          C[],
+                                                     hipDataType          c_type,
+                                                     int                  ldc,
+                                                     void*                D[],
+                                                     hipDataType          d_type,
+                                                     int                  ldd,
+                                                     int                  batch_count,
+                                                     hipblasComputeType_t compute_type,
+                                                     hipblasGemmAlgo_t    algo);
+
+hipblasStatus_t hipblasGemmStridedBatchedExOutOfPlaceByCopy(hipblasHandle_t      handle,
+                                                            hipblasOperation_t   transa,
+                                                            hipblasOperation_t   transb,
+                                                            int                  m,
+                                                            int                  n,
+                                                            int                  k,
+                                                            const void*          alpha,
+                                                            const void*          A,
+                                                            hipDataType          a_type,
+                                                            int                  lda,
+                                                            hipblasStride        stride_a,
+                                                            const void*          B,
+                                                            hipDataType          b_type,
+                                                            int                  ldb,
+                                                            hipblasStride        stride_b,
+                                                            const void*          beta,
+                                                            const void*          C,
+                                                            hipDataType          c_type,
+                                                            int                  ldc,
+                                                            hipblasStride        stride_c,
+                                                            void*                D,
+                                                            hipDataType          d_type,
+                                                            int                  ldd,
+                                                            hipblasStride        stride_d,
+                                                            int                  batch_count,
+                                                            hipblasComputeType_t compute_type,
+                                                            hipblasGemmAlgo_t    algo);
@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Inverses of triangular matrices kept by hipblasXtrsmCached, most recently used first
+struct hipblasTrsmCache
+{
+    struct Entry
+    {
+        const void*       A;
+        hipblasFillMode_t uplo;
+        hipblasDiagType_t diag;
+        int               k;
+        int               lda;
+        size_t            elem_size;
+        uint64_t          version;
+        void*             invA;
+        size_t            bytes;
+    };
+
+    // Separate from the handle state mutex, which the backend calls made with the cache locked
+    // may take
+    std::mutex       mutex;
+    std::list<Entry> entries;
+    size_t           max_bytes = size_t(256) << 20;
+    size_t           bytes     = 0;
+
+    // Copy of B for the multiplication by the inverse, and a zero beta for device pointer mode
+    void*  scratch      = nullptr;
+    size_t scratch_size = 0;
+    void*  zero         = nullptr;
+
+    hipblasTrsmCache() = default;
+    ~hipblasTrsmCache();
+
+    hipblasTrsmCache(const hipblasTrsmCache&) = delete;
+    hipblasTrsmCache& operator=(const hipblasTrsmCache&) = delete;
+};
+
+// Device memory for functions which compute through temporaries of their own, such as the 3M
+// complex gemm, reused from call to call. It only grows, and is held locked while in use.
+struct hipblasDeviceScratch
+{
+    std::mutex mutex;
+    void*      data = nullptr;
+    size_t     size = 0;
+
+    hipblasDeviceScratch() = default;
+    ~hipblasDeviceScratch();
+
+    hipblasDeviceScratch(const hipblasDeviceScratch&) = delete;
+    hipblasDeviceScratch& operator=(const hipblasDeviceScratch&) = delete;
+
+    // Grows the scratch to at least bytes; the contents are not kept
+    hipblasStatus_t reserve(size_t bytes);
+};
+
+// Handles of hipBLAS's own, each on an internal stream, across which batched solvers are split;
+// see hipblasSetBatchStreams. Each has its own workspace, so that the sub-batches running
+// concurrently do not share one.
+struct hipblasBatchStreams
+{
+    std::mutex                   mutex;
+    std::vector<hipblasHandle_t> handles;
+    std::vector<hipStream_t>     streams;
+    std::vector<hipEvent_t>      joins;
+    hipEvent_t                   fork = nullptr;
+
+    hipblasBatchStreams() = default;
+    ~hipblasBatchStreams();
+
+    hipblasBatchStreams(const hipblasBatchStreams&) = delete;
+    hipblasBatchStreams& operator=(const hipblasBatchStreams&) = delete;
+
+    // Creates or destroys handles so that calls are split across count streams; none are kept
+    // for 1. Called with the mutex held.
+    hipblasStatus_t resize(int count);
+};
+
+// Memory pool of a handle in HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, created on first use, and
+// the event by which hipblasSetStream orders the new stream after the old one
+struct hipblasWorkspacePool
+{
+    hipMemPool_t pool              = nullptr;
+    uint64_t     release_threshold = 0;
+    hipEvent_t   stream_change     = nullptr;
+
+    hipblasWorkspacePool() = default;
+    ~hipblasWorkspacePool();
+
+    hipblasWorkspacePool(const hipblasWorkspacePool&) = delete;
+    hipblasWorkspacePool& operator=(const hipblasWorkspacePool&) = delete;
+};
+
+// Rank-1 updates deferred by hipblasXgerDeferred and hipblasXsyrDeferred, kept as the columns of
+// two matrices X and Y until they are applied to A as one rank-k update
+struct hipblasRankUpdates
+{
+    std::mutex mutex;
+    int        block_size = 64;
+
+    // The number of pending updates, the matrix they are to, and the function which applies them
+    int               count     = 0;
+    bool              symmetric = false;
+    void*             A         = nullptr;
+    int               m         = 0;
+    int               n         = 0;
+    int               lda       = 0;
+    hipblasFillMode_t uplo      = HIPBLAS_FILL_MODE_UPPER;
+    hipblasStatus_t (*apply)(hipblasHandle_t, hipblasRankUpdates&) = nullptr;
+
+    // X of m by block_size followed by Y of n by block_size
+    void*  vectors      = nullptr;
+    size_t vectors_size = 0;
+
+    hipblasRankUpdates() = default;
+    ~hipblasRankUpdates();
+
+    hipblasRankUpdates(const hipblasRankUpdates&) = delete;
+    hipblasRankUpdates& operator=(const hipblasRankUpdates&) = delete;
+};
+
+// cublasLt plans and workspace of a handle in HIPBLAS_GEMM_EX_MODE_LT and for gemm epilogues, or
+// those of hipBLASLt on the rocBLAS backend; defined by the backend, which creates it on first
+// use and destroys it in hipblasDestroy
+struct hipblasGemmLtCache;
+
+// hipblasHandle_t is the backend (rocBLAS or cuBLAS) handle itself, so state which
+// only hipBLAS knows about is kept here, keyed by the handle.
+struct hipblasHandleState
+{
+    std::mutex mutex;
+
+    hipblasCaptureMode_t capture_mode = HIPBLAS_CAPTURE_MODE_DEFAULT;
+    std::string          capture_diagnostic;
+
+    // Workspace owned by hipBLAS rather than by the backend: on cuBLAS once reserved, and on
+    // rocBLAS when allocated from the workspace pool
+    void*  workspace        = nullptr;
+    size_t workspace_size   = 0;
+    bool   workspace_pooled = false;
+
+    hipblasWorkspaceAllocMode_t workspace_alloc_mode = HIPBLAS_WORKSPACE_ALLOC_DEFAULT;
+    hipblasWorkspacePool        workspace_pool;
+
+    // Calls and time counted towards the trim policy since workspace_growths was trim_growths
+    hipblasWorkspaceTrimPolicy_t          trim_policy  = {};
+    uint64_t                              trim_calls   = 0;
+    uint64_t                              trim_growths = 0;
+    std::chrono::steady_clock::time_point trim_since;
+
+    // For hipblasGetMemoryStats
+    size_t   peak_workspace_size = 0;
+    uint64_t workspace_growths   = 0;
+    double   workspace_alloc_us  = 0;
+
+    hipblasTrsmCache trsm_cache;
+
+    hipblasComplexGemmMode_t complex_gemm_mode = HIPBLAS_COMPLEX_GEMM_MODE_DEFAULT;
+    hipblasDeviceScratch     gemm_3m_scratch;
+
+    // alpha and beta of scaled FP8 gemms, with the scales folded in
+    hipblasDeviceScratch gemm_fp8_scratch;
+
+    // Vector of ones by which gemm epilogues add their bias, filled with gemm_epilogue_ones
+    // elements of gemm_epilogue_ones_type on gemm_epilogue_ones_stream
+    hipblasDeviceScratch gemm_epilogue_scratch;
+    hipDataType          gemm_epilogue_ones_type   = HIP_R_32F;
+    size_t               gemm_epilogue_ones        = 0;
+    hipStream_t          gemm_epilogue_ones_stream = nullptr;
+
+    hipblasPackedMode_t  packed_mode = HIPBLAS_PACKED_MODE_DEFAULT;
+    hipblasDeviceScratch packed_scratch;
+
+    hipblasGemmExMode_t gemm_ex_mode  = HIPBLAS_GEMM_EX_MODE_DEFAULT;
+    hipblasGemmLtCache* gemm_lt_cache = nullptr;
+
+    // Arrays of pointers and pivots of the vbatched solvers, in the order they are solved
+    hipblasDeviceScratch vbatched_scratch;
+
+    // Copies, factors and residuals of the mixed precision solvers
+    hipblasDeviceScratch gesv_scratch;
+
+    // Arrays of pointers and results of the segmented Level-1 functions, or the alpha of each
+    // element for axpy
+    hipblasDeviceScratch segmented_scratch;
+
+    hipblasRankUpdates rank_updates;
+
+    hipblasBatchStreams batch_streams;
+};
+
+// Returns the state for handle, creating it on first use. The state is owned by the map of states
+// and is used after its lock is released: it stays valid because, as with any other call on the
+// handle, the caller must not destroy the handle concurrently with a call using it
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle);
+
+// Returns the state for handle, or nullptr if none has been created; valid as above
+hipblasHandleState* hipblasFindHandleState(hipblasHandle_t handle);
+
+// Destroys the state for handle, and any handles of its own; called from hipblasDestroy
+void hipblasReleaseHandleState(hipblasHandle_t handle);
+
+// Records an allocation of the workspace to bytes which took alloc_us; growth is true when a
+// call grew the workspace because it needed more
+void hipblasRecordWorkspaceAlloc(hipblasHandle_t handle,
+                                 size_t          bytes,
+                                 double          alloc_us,
+                                 bool            growth);
+
+// Shared parts of hipblasGetMemoryStats and hipblasResetMemoryStats; the backends pass the size of
+// the workspace, which only they know
+hipblasStatus_t hipblasGetHandleMemoryStats(hipblasHandle_t       handle,
+                                            size_t                workspace_size,
+                                            hipblasMemoryStats_t* stats);
+void hipblasResetHandleMemoryStats(hipblasHandle_t handle, size_t workspace_size);
+
+// Returns true if the handle's stream is being captured into a hipGraph
+bool hipblasStreamIsCapturing(hipblasHandle_t handle);
+
+// Called before an operation which cannot be recorded into a hipGraph, such as an allocation
+// or a blocking copy. In HIPBLAS_CAPTURE_MODE_SAFE the operation is rejected; otherwise it is
+// only recorded, and only if HIPBLAS_CAPTURE_DIAGNOSTIC is set and the handle's stream is being
+// captured. reason is a printf format for the arguments which follow, formatted only when the
+// call is recorded.
+hipblasStatus_t
+    hipblasCheckCapture(hipblasHandle_t handle, const char* func, const char* reason, ...);
+
+// hipblasCheckCapture for functions which return their result in host memory
+// when the pointer mode is HIPBLAS_POINTER_MODE_HOST
+hipblasStatus_t hipblasCheckHostResultCapture(hipblasHandle_t handle, const char* func);
+
+// Returns true if the handle is in HIPBLAS_CAPTURE_MODE_SAFE
+bool hipblasIsCaptureSafe(hipblasHandle_t handle);
+
+// Returns true if the handle is in HIPBLAS_COMPLEX_GEMM_MODE_3M
+bool hipblasIsComplexGemm3m(hipblasHandle_t handle);
+
+// Returns true if the handle is in HIPBLAS_PACKED_MODE_UNPACK
+bool hipblasIsPackedUnpack(hipblasHandle_t handle);
+
+// Returns true if the handle is in HIPBLAS_GEMM_EX_MODE_LT
+bool hipblasIsGemmExLt(hipblasHandle_t handle);
+
+// Returns true if the handle is in HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED
+bool hipblasIsWorkspaceStreamOrdered(hipblasHandle_t handle);
+
+// Counts a call which needed used_bytes of workspace towards the trim policy of the handle, and
+// returns true with the size to trim the workspace to when the policy is due and the handle can
+// allocate. A call which grew the workspace or needed more than the target restarts the count.
+bool hipblasWorkspaceTrimDue(hipblasHandle_t handle, size_t used_bytes, size_t* target_bytes);
+
+// Records the capture mode and clears the capture diagnostic
+hipblasStatus_t hipblasSetHandleCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t mode);
+
+// Puts the handle in HIPBLAS_POINTER_MODE_HOST, or the given mode, for functions which pass
+// scalars of their own to other hipBLAS functions, and restores the mode of the caller
+class hipblasHostPointerModeGuard
+{
+public:
+    explicit hipblasHostPointerModeGuard(hipblasHandle_t      handle,
+                                         hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST)
+        : m_handle(handle)
+    {
+        if(hipblasGetPointerMode(handle, &m_mode) == HIPBLAS_STATUS_SUCCESS)
+            hipblasSetPointerMode(handle, mode);
+    }
+
+    ~hipblasHostPointerModeGuard()
+    {
+        hipblasSetPointerMode(m_handle, m_mode);
+    }
+
+    hipblasHostPointerModeGuard(const hipblasHostPointerModeGuard&) = delete;
+    hipblasHostPointerModeGuard& operator=(const hipblasHostPointerModeGuard&) = delete;
+
+    hipblasPointerMode_t mode() const
+    {
+        return m_mode;
+    }
+
+private:
+    hipblasHandle_t      m_handle;
+    hipblasPointerMode_t m_mode = HIPBLAS_POINTER_MODE_HOST;
+};
+
+#define HIPBLAS_CHECK_HOST_RESULT_CAPTURE()                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        hipblasStatus_t capture_status__ = hipblasCheckHostResultCapture(handle, __func__); \
+        if(capture_status__ != HIPBLAS_STATUS_SUCCESS)                                      \
+            return capture_status__;                                                        \
+    } while(0)
+
+// Solvers report invalid arguments through a host-side info; in HIPBLAS_CAPTURE_MODE_SAFE the call
+// is rejected instead, so that a no-op solve is not silently recorded into a graph
+#define HIPBLAS_CHECK_INFO_CAPTURE(info__)                                                  \
+    do                                                                                      \
+    {                                                                                       \
+        if(*(info__) < 0)                                                                   \
+        {                                                                                   \
+            hipblasStatus_t capture_status__                                                \
+                = hipblasCheckCapture(handle, __func__, "invalid argument %d", -*(info__)); \
+            if(capture_status__ != HIPBLAS_STATUS_SUCCESS)                                  \
+                return capture_status__;                                                    \
+        }                                                                                   \
+    } while(0)
@@ -0,0 +1,5705 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// The _64 functions through the native ILP64 API of the backend, with the arguments of the public
+// _64 functions. They return HIPBLAS_STATUS_NOT_SUPPORTED where the backend, or the version built
+// against, has no such function, and hipblas_ilp64.cpp then splits the call into int-sized ones.
+extern "C" {
+
+hipblasStatus_t hipblasSscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
+hipblasStatus_t hipblasDscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
+hipblasStatus_t hipblasCscal_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasCsscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
+hipblasStatus_t hipblasZscal_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasZdscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
+
+hipblasStatus_t hipblasSscalBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              float* const    x[],
+                                              int64_t         incx,
+                                              int64_t         batchCount);
+
+hipblasStatus_t hipblasDscalBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              double* const   x[],
+                                              int64_t         incx,
+                                              int64_t         batchCount);
+
+hipblasStatus_t hipblasCscalBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              int64_t               batchCount);
+
+hipblasStatus_t hipblasCsscalBatched_64Backend(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const float*          alpha,
+                                               hipblasComplex* const x[],
+                                               int64_t               incx,
+                                               int64_t               batchCount);
+
+hipblasStatus_t hipblasZscalBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZdscalBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const double*               alpha,
+                                               hipblasDoubleComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount);
+
+hipblasStatus_t hipblasSscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    alpha,
+                                                     float*          x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasDscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   alpha,
+                                                     double*         x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasCscalStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasCsscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    alpha,
+                                                      hipblasComplex* x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount);
+
+hipblasStatus_t hipblasZscalStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasZdscalStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const double*         alpha,
+                                                      hipblasDoubleComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount);
+
+hipblasStatus_t hipblasSaxpy_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const float*    alpha,
+                                       const float*    x,
+                                       int64_t         incx,
+                                       float*          y,
+                                       int64_t         incy);
+
+hipblasStatus_t hipblasDaxpy_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy);
+
+hipblasStatus_t hipblasCaxpy_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZaxpy_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasSaxpyBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDaxpyBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCaxpyBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZaxpyBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSaxpyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    alpha,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasDaxpyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   alpha,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasCaxpyStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZaxpyStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasScopy_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
+hipblasStatus_t hipblasDcopy_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
+hipblasStatus_t hipblasCcopy_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZcopy_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasScopyBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDcopyBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCcopyBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZcopyBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasScopyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasDcopyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasCcopyStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZcopyStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSswap_64Backend(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
+hipblasStatus_t hipblasDswap_64Backend(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
+hipblasStatus_t hipblasCswap_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       hipblasComplex* x,
+                                       int64_t         incx,
+                                       hipblasComplex* y,
+                                       int64_t         incy);
+
+hipblasStatus_t hipblasZswap_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasDoubleComplex* x,
+                                       int64_t               incx,
+                                       hipblasDoubleComplex* y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasSswapBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float* const    x[],
+                                              int64_t         incx,
+                                              float* const    y[],
+                                              int64_t         incy,
+                                              int64_t         batchCount);
+
+hipblasStatus_t hipblasDswapBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double* const   x[],
+                                              int64_t         incx,
+                                              double* const   y[],
+                                              int64_t         incy,
+                                              int64_t         batchCount);
+
+hipblasStatus_t hipblasCswapBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              hipblasComplex* const y[],
+                                              int64_t               incy,
+                                              int64_t               batchCount);
+
+hipblasStatus_t hipblasZswapBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasSswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     float*          x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasDswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     double*         x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasCswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     hipblasComplex* x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     hipblasComplex* y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasZswapStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasDoubleComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasDoubleComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasSdot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      const float*    y,
+                                      int64_t         incy,
+                                      float*          result);
+
+hipblasStatus_t hipblasDdot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result);
+
+hipblasStatus_t hipblasCdotu_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       result);
+
+hipblasStatus_t hipblasCdotc_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       result);
+
+hipblasStatus_t hipblasZdotu_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       result);
+
+hipblasStatus_t hipblasZdotc_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       result);
+
+hipblasStatus_t hipblasSdotBatched_64Backend(hipblasHandle_t    handle,
+                                             int64_t            n,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             const float* const y[],
+                                             int64_t            incy,
+                                             int64_t            batchCount,
+                                             float*             result);
+
+hipblasStatus_t hipblasDdotBatched_64Backend(hipblasHandle_t     handle,
+                                             int64_t             n,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             const double* const y[],
+                                             int64_t             incy,
+                                             int64_t             batchCount,
+                                             double*             result);
+
+hipblasStatus_t hipblasCdotuBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount,
+                                              hipblasComplex*             result);
+
+hipblasStatus_t hipblasCdotcBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount,
+                                              hipblasComplex*             result);
+
+hipblasStatus_t hipblasZdotuBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount,
+                                              hipblasDoubleComplex*             result);
+
+hipblasStatus_t hipblasZdotcBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount,
+                                              hipblasDoubleComplex*             result);
+
+hipblasStatus_t hipblasSdotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    const float*    x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const float*    y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    int64_t         batchCount,
+                                                    float*          result);
+
+hipblasStatus_t hipblasDdotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    const double*   x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const double*   y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    int64_t         batchCount,
+                                                    double*         result);
+
+hipblasStatus_t hipblasCdotuStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount,
+                                                     hipblasComplex*       result);
+
+hipblasStatus_t hipblasCdotcStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount,
+                                                     hipblasComplex*       result);
+
+hipblasStatus_t hipblasZdotuStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount,
+                                                     hipblasDoubleComplex*       result);
+
+hipblasStatus_t hipblasZdotcStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount,
+                                                     hipblasDoubleComplex*       result);
+
+hipblasStatus_t hipblasSasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+hipblasStatus_t hipblasDasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+hipblasStatus_t hipblasScasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+hipblasStatus_t hipblasDzasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
+hipblasStatus_t hipblasSasumBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount,
+                                              float*             result);
+
+hipblasStatus_t hipblasDasumBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount,
+                                              double*             result);
+
+hipblasStatus_t hipblasScasumBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               float*                      result);
+
+hipblasStatus_t hipblasDzasumBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               double*                           result);
+
+hipblasStatus_t hipblasSasumStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     float*          result);
+
+hipblasStatus_t hipblasDasumStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     double*         result);
+
+hipblasStatus_t hipblasScasumStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      float*                result);
+
+hipblasStatus_t hipblasDzasumStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      double*                     result);
+
+hipblasStatus_t hipblasSnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+hipblasStatus_t hipblasDnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+hipblasStatus_t hipblasScnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+hipblasStatus_t hipblasDznrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
+hipblasStatus_t hipblasSnrm2Batched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount,
+                                              float*             result);
+
+hipblasStatus_t hipblasDnrm2Batched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount,
+                                              double*             result);
+
+hipblasStatus_t hipblasScnrm2Batched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               float*                      result);
+
+hipblasStatus_t hipblasDznrm2Batched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               double*                           result);
+
+hipblasStatus_t hipblasSnrm2StridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     float*          result);
+
+hipblasStatus_t hipblasDnrm2StridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     double*         result);
+
+hipblasStatus_t hipblasScnrm2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      float*                result);
+
+hipblasStatus_t hipblasDznrm2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      double*                     result);
+
+hipblasStatus_t hipblasIsamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIdamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIcamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIzamax_64Backend(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasDoubleComplex* x,
+                                        int64_t                     incx,
+                                        int64_t*                    result);
+
+hipblasStatus_t hipblasIsamaxBatched_64Backend(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const float* const x[],
+                                               int64_t            incx,
+                                               int64_t            batchCount,
+                                               int64_t*           result);
+
+hipblasStatus_t hipblasIdamaxBatched_64Backend(hipblasHandle_t     handle,
+                                               int64_t             n,
+                                               const double* const x[],
+                                               int64_t             incx,
+                                               int64_t             batchCount,
+                                               int64_t*            result);
+
+hipblasStatus_t hipblasIcamaxBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result);
+
+hipblasStatus_t hipblasIzamaxBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               int64_t*                          result);
+
+hipblasStatus_t hipblasIsamaxStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result);
+
+hipblasStatus_t hipblasIdamaxStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result);
+
+hipblasStatus_t hipblasIcamaxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      int64_t*              result);
+
+hipblasStatus_t hipblasIzamaxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      int64_t*                    result);
+
+hipblasStatus_t hipblasIsamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIdamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIcamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+hipblasStatus_t hipblasIzamin_64Backend(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasDoubleComplex* x,
+                                        int64_t                     incx,
+                                        int64_t*                    result);
+
+hipblasStatus_t hipblasIsaminBatched_64Backend(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const float* const x[],
+                                               int64_t            incx,
+                                               int64_t            batchCount,
+                                               int64_t*           result);
+
+hipblasStatus_t hipblasIdaminBatched_64Backend(hipblasHandle_t     handle,
+                                               int64_t             n,
+                                               const double* const x[],
+                                               int64_t             incx,
+                                               int64_t             batchCount,
+                                               int64_t*            result);
+
+hipblasStatus_t hipblasIcaminBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result);
+
+hipblasStatus_t hipblasIzaminBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               int64_t*                          result);
+
+hipblasStatus_t hipblasIsaminStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result);
+
+hipblasStatus_t hipblasIdaminStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result);
+
+hipblasStatus_t hipblasIcaminStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      int64_t*              result);
+
+hipblasStatus_t hipblasIzaminStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      int64_t*                    result);
+
+hipblasStatus_t hipblasSrot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      float*          x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy,
+                                      const float*    c,
+                                      const float*    s);
+
+hipblasStatus_t hipblasDrot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      double*         x,
+                                      int64_t         incx,
+                                      double*         y,
+                                      int64_t         incy,
+                                      const double*   c,
+                                      const double*   s);
+
+hipblasStatus_t hipblasCrot_64Backend(hipblasHandle_t       handle,
+                                      int64_t               n,
+                                      hipblasComplex*       x,
+                                      int64_t               incx,
+                                      hipblasComplex*       y,
+                                      int64_t               incy,
+                                      const float*          c,
+                                      const hipblasComplex* s);
+
+hipblasStatus_t hipblasCsrot_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       hipblasComplex* x,
+                                       int64_t         incx,
+                                       hipblasComplex* y,
+                                       int64_t         incy,
+                                       const float*    c,
+                                       const float*    s);
+
+hipblasStatus_t hipblasZrot_64Backend(hipblasHandle_t             handle,
+                                      int64_t                     n,
+                                      hipblasDoubleComplex*       x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       y,
+                                      int64_t                     incy,
+                                      const double*               c,
+                                      const hipblasDoubleComplex* s);
+
+hipblasStatus_t hipblasZdrot_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasDoubleComplex* x,
+                                       int64_t               incx,
+                                       hipblasDoubleComplex* y,
+                                       int64_t               incy,
+                                       const double*         c,
+                                       const double*         s);
+
+hipblasStatus_t hipblasSrotBatched_64Backend(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             float* const    x[],
+                                             int64_t         incx,
+                                             float* const    y[],
+                                             int64_t         incy,
+                                             const float*    c,
+                                             const float*    s,
+                                             int64_t         batchCount);
+
+hipblasStatus_t hipblasDrotBatched_64Backend(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             double* const   x[],
+                                             int64_t         incx,
+                                             double* const   y[],
+                                             int64_t         incy,
+                                             const double*   c,
+                                             const double*   s,
+                                             int64_t         batchCount);
+
+hipblasStatus_t hipblasCrotBatched_64Backend(hipblasHandle_t       handle,
+                                             int64_t               n,
+                                             hipblasComplex* const x[],
+                                             int64_t               incx,
+                                             hipblasComplex* const y[],
+                                             int64_t               incy,
+                                             const float*          c,
+                                             const hipblasComplex* s,
+                                             int64_t               batchCount);
+
+hipblasStatus_t hipblasCsrotBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              hipblasComplex* const y[],
+                                              int64_t               incy,
+                                              const float*          c,
+                                              const float*          s,
+                                              int64_t               batchCount);
+
+hipblasStatus_t hipblasZrotBatched_64Backend(hipblasHandle_t             handle,
+                                             int64_t                     n,
+                                             hipblasDoubleComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasDoubleComplex* const y[],
+                                             int64_t                     incy,
+                                             const double*               c,
+                                             const hipblasDoubleComplex* s,
+                                             int64_t                     batchCount);
+
+hipblasStatus_t hipblasZdrotBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex* const y[],
+                                              int64_t                     incy,
+                                              const double*               c,
+                                              const double*               s,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasSrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    float*          x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    float*          y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    const float*    c,
+                                                    const float*    s,
+                                                    int64_t         batchCount);
+
+hipblasStatus_t hipblasDrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    double*         x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    double*         y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    const double*   c,
+                                                    const double*   s,
+                                                    int64_t         batchCount);
+
+hipblasStatus_t hipblasCrotStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    int64_t               n,
+                                                    hipblasComplex*       x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       y,
+                                                    int64_t               incy,
+                                                    hipblasStride         stridey,
+                                                    const float*          c,
+                                                    const hipblasComplex* s,
+                                                    int64_t               batchCount);
+
+hipblasStatus_t hipblasCsrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     hipblasComplex* x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     hipblasComplex* y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     const float*    c,
+                                                     const float*    s,
+                                                     int64_t         batchCount);
+
+hipblasStatus_t hipblasZrotStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    hipblasDoubleComplex*       x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       y,
+                                                    int64_t                     incy,
+                                                    hipblasStride               stridey,
+                                                    const double*               c,
+                                                    const hipblasDoubleComplex* s,
+                                                    int64_t                     batchCount);
+
+hipblasStatus_t hipblasZdrotStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasDoubleComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasDoubleComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     const double*         c,
+                                                     const double*         s,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasSgemv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       const float*       x,
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float*             y,
+                                       int64_t            incy);
+
+hipblasStatus_t hipblasDgemv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       const double*      x,
+                                       int64_t            incx,
+                                       const double*      beta,
+                                       double*            y,
+                                       int64_t            incy);
+
+hipblasStatus_t hipblasCgemv_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    trans,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZgemv_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasSgemvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDgemvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCgemvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZgemvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                trans,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSgemvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDgemvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCgemvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZgemvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSgbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            kl,
+                                       int64_t            ku,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       const float*       x,
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float*             y,
+                                       int64_t            incy);
+
+hipblasStatus_t hipblasDgbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            kl,
+                                       int64_t            ku,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       const double*      x,
+                                       int64_t            incx,
+                                       const double*      beta,
+                                       double*            y,
+                                       int64_t            incy);
+
+hipblasStatus_t hipblasCgbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    trans,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       int64_t               kl,
+                                       int64_t               ku,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZgbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     kl,
+                                       int64_t                     ku,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasSgbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            kl,
+                                              int64_t            ku,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDgbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              int64_t             kl,
+                                              int64_t             ku,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCgbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     kl,
+                                              int64_t                     ku,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZgbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                trans,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              int64_t                           kl,
+                                              int64_t                           ku,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSgbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            kl,
+                                                     int64_t            ku,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDgbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            kl,
+                                                     int64_t            ku,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCgbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    trans,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     int64_t               kl,
+                                                     int64_t               ku,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZgbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          trans,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     int64_t                     kl,
+                                                     int64_t                     ku,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSger_64Backend(hipblasHandle_t handle,
+                                      int64_t         m,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      const float*    y,
+                                      int64_t         incy,
+                                      float*          AP,
+                                      int64_t         lda);
+
+hipblasStatus_t hipblasDger_64Backend(hipblasHandle_t handle,
+                                      int64_t         m,
+                                      int64_t         n,
+                                      const double*   alpha,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         AP,
+                                      int64_t         lda);
+
+hipblasStatus_t hipblasSgerBatched_64Backend(hipblasHandle_t    handle,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             const float* const y[],
+                                             int64_t            incy,
+                                             float* const       AP[],
+                                             int64_t            lda,
+                                             int64_t            batchCount);
+
+hipblasStatus_t hipblasDgerBatched_64Backend(hipblasHandle_t     handle,
+                                             int64_t             m,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             const double* const y[],
+                                             int64_t             incy,
+                                             double* const       AP[],
+                                             int64_t             lda,
+                                             int64_t             batchCount);
+
+hipblasStatus_t hipblasSgerStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         m,
+                                                    int64_t         n,
+                                                    const float*    alpha,
+                                                    const float*    x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const float*    y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    float*          AP,
+                                                    int64_t         lda,
+                                                    hipblasStride   strideA,
+                                                    int64_t         batchCount);
+
+hipblasStatus_t hipblasDgerStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         m,
+                                                    int64_t         n,
+                                                    const double*   alpha,
+                                                    const double*   x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const double*   y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    double*         AP,
+                                                    int64_t         lda,
+                                                    hipblasStride   strideA,
+                                                    int64_t         batchCount);
+
+hipblasStatus_t hipblasCgeru_64Backend(hipblasHandle_t       handle,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP,
+                                       int64_t               lda);
+
+hipblasStatus_t hipblasZgeru_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP,
+                                       int64_t                     lda);
+
+hipblasStatus_t hipblasCgeruBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZgeruBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasCgeruStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZgeruStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasCgerc_64Backend(hipblasHandle_t       handle,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP,
+                                       int64_t               lda);
+
+hipblasStatus_t hipblasZgerc_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP,
+                                       int64_t                     lda);
+
+hipblasStatus_t hipblasCgercBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZgercBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasCgercStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZgercStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasChbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZhbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasChbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasChbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZhbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasChemv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZhemv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasChemvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhemvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasChemvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZhemvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasCher_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const float*          alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP,
+                                      int64_t               lda);
+
+hipblasStatus_t hipblasZher_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const double*               alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP,
+                                      int64_t                     lda);
+
+hipblasStatus_t hipblasCherBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const float*                alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     lda,
+                                             int64_t                     batchCount);
+
+hipblasStatus_t hipblasZherBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const double*                     alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           lda,
+                                             int64_t                           batchCount);
+
+hipblasStatus_t hipblasCherStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const float*          alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    int64_t               lda,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount);
+
+hipblasStatus_t hipblasZherStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const double*               alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    int64_t                     lda,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount);
+
+hipblasStatus_t hipblasCher2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP,
+                                       int64_t               lda);
+
+hipblasStatus_t hipblasZher2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP,
+                                       int64_t                     lda);
+
+hipblasStatus_t hipblasCher2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZher2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasCher2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZher2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasChpmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZhpmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasChpmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhpmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasChpmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZhpmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasChpr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const float*          alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP);
+
+hipblasStatus_t hipblasZhpr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const double*               alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP);
+
+hipblasStatus_t hipblasChprBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const float*                alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhprBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const double*                     alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           batchCount);
+
+hipblasStatus_t hipblasChprStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const float*          alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount);
+
+hipblasStatus_t hipblasZhprStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const double*               alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount);
+
+hipblasStatus_t hipblasChpr2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP);
+
+hipblasStatus_t hipblasZhpr2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP);
+
+hipblasStatus_t hipblasChpr2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhpr2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasChpr2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZhpr2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsbmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       int64_t           k,
+                                       const float*      alpha,
+                                       const float*      AP,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasDsbmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       int64_t           k,
+                                       const double*     alpha,
+                                       const double*     AP,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasSsbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDsbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasSsbmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     int64_t           k,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDsbmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     int64_t           k,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasSspmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      AP,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasDspmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     AP,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasSspmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDspmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasSspmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDspmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasSspr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const float*      alpha,
+                                      const float*      x,
+                                      int64_t           incx,
+                                      float*            AP);
+
+hipblasStatus_t hipblasDspr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const double*     alpha,
+                                      const double*     x,
+                                      int64_t           incx,
+                                      double*           AP);
+
+hipblasStatus_t hipblasCspr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP);
+
+hipblasStatus_t hipblasZspr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP);
+
+hipblasStatus_t hipblasSsprBatched_64Backend(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             float* const       AP[],
+                                             int64_t            batchCount);
+
+hipblasStatus_t hipblasDsprBatched_64Backend(hipblasHandle_t     handle,
+                                             hipblasFillMode_t   uplo,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             double* const       AP[],
+                                             int64_t             batchCount);
+
+hipblasStatus_t hipblasCsprBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsprBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsprStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const float*      alpha,
+                                                    const float*      x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    float*            AP,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+hipblasStatus_t hipblasDsprStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const double*     alpha,
+                                                    const double*     x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    double*           AP,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+hipblasStatus_t hipblasCsprStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount);
+
+hipblasStatus_t hipblasZsprStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount);
+
+hipblasStatus_t hipblasSspr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      y,
+                                       int64_t           incy,
+                                       float*            AP);
+
+hipblasStatus_t hipblasDspr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     y,
+                                       int64_t           incy,
+                                       double*           AP);
+
+hipblasStatus_t hipblasSspr2Batched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float* const y[],
+                                              int64_t            incy,
+                                              float* const       AP[],
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDspr2Batched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double* const y[],
+                                              int64_t             incy,
+                                              double* const       AP[],
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasSspr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     float*            AP,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDspr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     double*           AP,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasSsymv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      AP,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasDsymv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     AP,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy);
+
+hipblasStatus_t hipblasCsymv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy);
+
+hipblasStatus_t hipblasZsymv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy);
+
+hipblasStatus_t hipblasSsymvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDsymvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCsymvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsymvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsymvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDsymvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasCsymvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZsymvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsyr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const float*      alpha,
+                                      const float*      x,
+                                      int64_t           incx,
+                                      float*            AP,
+                                      int64_t           lda);
+
+hipblasStatus_t hipblasDsyr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const double*     alpha,
+                                      const double*     x,
+                                      int64_t           incx,
+                                      double*           AP,
+                                      int64_t           lda);
+
+hipblasStatus_t hipblasCsyr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP,
+                                      int64_t               lda);
+
+hipblasStatus_t hipblasZsyr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP,
+                                      int64_t                     lda);
+
+hipblasStatus_t hipblasSsyrBatched_64Backend(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             float* const       AP[],
+                                             int64_t            lda,
+                                             int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyrBatched_64Backend(hipblasHandle_t     handle,
+                                             hipblasFillMode_t   uplo,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             double* const       AP[],
+                                             int64_t             lda,
+                                             int64_t             batchCount);
+
+hipblasStatus_t hipblasCsyrBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     lda,
+                                             int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsyrBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           lda,
+                                             int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsyrStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const float*      alpha,
+                                                    const float*      x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    float*            AP,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+hipblasStatus_t hipblasDsyrStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const double*     alpha,
+                                                    const double*     x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    double*           AP,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+hipblasStatus_t hipblasCsyrStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    int64_t               lda,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount);
+
+hipblasStatus_t hipblasZsyrStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    int64_t                     lda,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsyr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      y,
+                                       int64_t           incy,
+                                       float*            AP,
+                                       int64_t           lda);
+
+hipblasStatus_t hipblasDsyr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     y,
+                                       int64_t           incy,
+                                       double*           AP,
+                                       int64_t           lda);
+
+hipblasStatus_t hipblasCsyr2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP,
+                                       int64_t               lda);
+
+hipblasStatus_t hipblasZsyr2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP,
+                                       int64_t                     lda);
+
+hipblasStatus_t hipblasSsyr2Batched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float* const y[],
+                                              int64_t            incy,
+                                              float* const       AP[],
+                                              int64_t            lda,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyr2Batched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double* const y[],
+                                              int64_t             incy,
+                                              double* const       AP[],
+                                              int64_t             lda,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCsyr2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsyr2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsyr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     float*            AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDsyr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     double*           AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasCsyr2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZsyr2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               k,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            k,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             k,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     k,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            k,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            k,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               k,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStbsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtbsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtbsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtbsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStbsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtbsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtbsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtbsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStbsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtbsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtbsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtbsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStpmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtpmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtpmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtpmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStpmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtpmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtpmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtpmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStpmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtpmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtpmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtpmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStpsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtpsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtpsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtpsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStpsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtpsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtpsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtpsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStpsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtpsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtpsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtpsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStrmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtrmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtrmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtrmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStrmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtrmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtrmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStrmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtrmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtrmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStrsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasDtrsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx);
+
+hipblasStatus_t hipblasCtrsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx);
+
+hipblasStatus_t hipblasZtrsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx);
+
+hipblasStatus_t hipblasStrsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtrsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtrsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStrsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtrsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtrsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSgemm_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       const float*       BP,
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float*             CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasDgemm_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       const double*      BP,
+                                       int64_t            ldb,
+                                       const double*      beta,
+                                       double*            CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasSgemmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const BP[],
+                                              int64_t            ldb,
+                                              const float*       beta,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDgemmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  transA,
+                                              hipblasOperation_t  transB,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const BP[],
+                                              int64_t             ldb,
+                                              const double*       beta,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasSgemmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     long long          strideA,
+                                                     const float*       BP,
+                                                     int64_t            ldb,
+                                                     long long          strideB,
+                                                     const float*       beta,
+                                                     float*             CP,
+                                                     int64_t            ldc,
+                                                     long long          strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDgemmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     long long          strideA,
+                                                     const double*      BP,
+                                                     int64_t            ldb,
+                                                     long long          strideB,
+                                                     const double*      beta,
+                                                     double*            CP,
+                                                     int64_t            ldc,
+                                                     long long          strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCherk_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const float*          alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const float*          beta,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZherk_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const double*               alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const double*               beta,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasCherkBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const float*                alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const float*                beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZherkBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const double*                     alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const double*                     beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasCherkStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const float*          alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const float*          beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZherkStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const double*               alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const double*               beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasCherkx_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        int64_t               lda,
+                                        const hipblasComplex* BP,
+                                        int64_t               ldb,
+                                        const float*          beta,
+                                        hipblasComplex*       CP,
+                                        int64_t               ldc);
+
+hipblasStatus_t hipblasZherkx_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* BP,
+                                        int64_t                     ldb,
+                                        const double*               beta,
+                                        hipblasDoubleComplex*       CP,
+                                        int64_t                     ldc);
+
+hipblasStatus_t hipblasCherkxBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const float*                beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount);
+
+hipblasStatus_t hipblasZherkxBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const double*                     beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount);
+
+hipblasStatus_t hipblasCherkxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const float*          beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount);
+
+hipblasStatus_t hipblasZherkxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const double*               beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount);
+
+hipblasStatus_t hipblasCher2k_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        int64_t               lda,
+                                        const hipblasComplex* BP,
+                                        int64_t               ldb,
+                                        const float*          beta,
+                                        hipblasComplex*       CP,
+                                        int64_t               ldc);
+
+hipblasStatus_t hipblasZher2k_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* BP,
+                                        int64_t                     ldb,
+                                        const double*               beta,
+                                        hipblasDoubleComplex*       CP,
+                                        int64_t                     ldc);
+
+hipblasStatus_t hipblasCher2kBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const float*                beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount);
+
+hipblasStatus_t hipblasZher2kBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const double*                     beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount);
+
+hipblasStatus_t hipblasCher2kStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const float*          beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount);
+
+hipblasStatus_t hipblasZher2kStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const double*               beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsymm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      AP,
+                                       int64_t           lda,
+                                       const float*      BP,
+                                       int64_t           ldb,
+                                       const float*      beta,
+                                       float*            CP,
+                                       int64_t           ldc);
+
+hipblasStatus_t hipblasDsymm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     AP,
+                                       int64_t           lda,
+                                       const double*     BP,
+                                       int64_t           ldb,
+                                       const double*     beta,
+                                       double*           CP,
+                                       int64_t           ldc);
+
+hipblasStatus_t hipblasCsymm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* BP,
+                                       int64_t               ldb,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZsymm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* BP,
+                                       int64_t                     ldb,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasSsymmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const BP[],
+                                              int64_t            ldb,
+                                              const float*       beta,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDsymmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const BP[],
+                                              int64_t             ldb,
+                                              const double*       beta,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCsymmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsymmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsymmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      BP,
+                                                     int64_t           ldb,
+                                                     hipblasStride     strideB,
+                                                     const float*      beta,
+                                                     float*            CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDsymmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     BP,
+                                                     int64_t           ldb,
+                                                     hipblasStride     strideB,
+                                                     const double*     beta,
+                                                     double*           CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasCsymmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZsymmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsyrk_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       float*             CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasDsyrk_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       const double*      beta,
+                                       double*            CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasCsyrk_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZsyrk_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasSsyrkBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float*       beta,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyrkBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double*       beta,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCsyrkBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsyrkBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsyrkStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       beta,
+                                                     float*             CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyrkStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      beta,
+                                                     double*            CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCsyrkStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZsyrkStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsyr2k_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float*       AP,
+                                        int64_t            lda,
+                                        const float*       BP,
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float*             CP,
+                                        int64_t            ldc);
+
+hipblasStatus_t hipblasDsyr2k_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const double*      alpha,
+                                        const double*      AP,
+                                        int64_t            lda,
+                                        const double*      BP,
+                                        int64_t            ldb,
+                                        const double*      beta,
+                                        double*            CP,
+                                        int64_t            ldc);
+
+hipblasStatus_t hipblasCsyr2k_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        int64_t               lda,
+                                        const hipblasComplex* BP,
+                                        int64_t               ldb,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       CP,
+                                        int64_t               ldc);
+
+hipblasStatus_t hipblasZsyr2k_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* BP,
+                                        int64_t                     ldb,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       CP,
+                                        int64_t                     ldc);
+
+hipblasStatus_t hipblasSsyr2kBatched_64Backend(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               int64_t            lda,
+                                               const float* const BP[],
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float* const       CP[],
+                                               int64_t            ldc,
+                                               int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyr2kBatched_64Backend(hipblasHandle_t     handle,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               int64_t             n,
+                                               int64_t             k,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               int64_t             lda,
+                                               const double* const BP[],
+                                               int64_t             ldb,
+                                               const double*       beta,
+                                               double* const       CP[],
+                                               int64_t             ldc,
+                                               int64_t             batchCount);
+
+hipblasStatus_t hipblasCsyr2kBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const hipblasComplex*       beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsyr2kBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const hipblasDoubleComplex*       beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsyr2kStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const float*       BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const float*       beta,
+                                                      float*             CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyr2kStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const double*      BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const double*      beta,
+                                                      double*            CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount);
+
+hipblasStatus_t hipblasCsyr2kStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const hipblasComplex* beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount);
+
+hipblasStatus_t hipblasZsyr2kStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount);
+
+hipblasStatus_t hipblasSsyrkx_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float*       AP,
+                                        int64_t            lda,
+                                        const float*       BP,
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float*             CP,
+                                        int64_t            ldc);
+
+hipblasStatus_t hipblasDsyrkx_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const double*      alpha,
+                                        const double*      AP,
+                                        int64_t            lda,
+                                        const double*      BP,
+                                        int64_t            ldb,
+                                        const double*      beta,
+                                        double*            CP,
+                                        int64_t            ldc);
+
+hipblasStatus_t hipblasCsyrkx_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        int64_t               lda,
+                                        const hipblasComplex* BP,
+                                        int64_t               ldb,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       CP,
+                                        int64_t               ldc);
+
+hipblasStatus_t hipblasZsyrkx_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* BP,
+                                        int64_t                     ldb,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       CP,
+                                        int64_t                     ldc);
+
+hipblasStatus_t hipblasSsyrkxBatched_64Backend(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               int64_t            lda,
+                                               const float* const BP[],
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float* const       CP[],
+                                               int64_t            ldc,
+                                               int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyrkxBatched_64Backend(hipblasHandle_t     handle,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               int64_t             n,
+                                               int64_t             k,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               int64_t             lda,
+                                               const double* const BP[],
+                                               int64_t             ldb,
+                                               const double*       beta,
+                                               double* const       CP[],
+                                               int64_t             ldc,
+                                               int64_t             batchCount);
+
+hipblasStatus_t hipblasCsyrkxBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const hipblasComplex*       beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount);
+
+hipblasStatus_t hipblasZsyrkxBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const hipblasDoubleComplex*       beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount);
+
+hipblasStatus_t hipblasSsyrkxStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const float*       BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const float*       beta,
+                                                      float*             CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount);
+
+hipblasStatus_t hipblasDsyrkxStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const double*      BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const double*      beta,
+                                                      double*            CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount);
+
+hipblasStatus_t hipblasCsyrkxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const hipblasComplex* beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount);
+
+hipblasStatus_t hipblasZsyrkxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount);
+
+hipblasStatus_t hipblasSgeam_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       const float*       BP,
+                                       int64_t            ldb,
+                                       float*             CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasDgeam_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       const double*      beta,
+                                       const double*      BP,
+                                       int64_t            ldb,
+                                       double*            CP,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasCgeam_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    transA,
+                                       hipblasOperation_t    transB,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* beta,
+                                       const hipblasComplex* BP,
+                                       int64_t               ldb,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZgeam_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* beta,
+                                       const hipblasDoubleComplex* BP,
+                                       int64_t                     ldb,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasSgeamBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float*       beta,
+                                              const float* const BP[],
+                                              int64_t            ldb,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDgeamBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  transA,
+                                              hipblasOperation_t  transB,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double*       beta,
+                                              const double* const BP[],
+                                              int64_t             ldb,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCgeamBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex*       beta,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZgeamBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                transA,
+                                              hipblasOperation_t                transB,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex*       beta,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSgeamStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       beta,
+                                                     const float*       BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     float*             CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDgeamStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      beta,
+                                                     const double*      BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     double*            CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCgeamStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasOperation_t    transB,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* beta,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZgeamStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* beta,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasChemm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* BP,
+                                       int64_t               ldb,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZhemm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* BP,
+                                       int64_t                     ldb,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasChemmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZhemmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasChemmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZhemmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStrmm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       B,
+                                       int64_t            ldb,
+                                       float*             C,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasDtrmm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       double*            C,
+                                       int64_t            ldc);
+
+hipblasStatus_t hipblasCtrmm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* B,
+                                       int64_t               ldb,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZtrmm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* B,
+                                       int64_t                     ldb,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasStrmmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const A[],
+                                              int64_t            lda,
+                                              const float* const B[],
+                                              int64_t            ldb,
+                                              float* const       C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrmmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const A[],
+                                              int64_t             lda,
+                                              const double* const B[],
+                                              int64_t             ldb,
+                                              double* const       C[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtrmmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const A[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const B[],
+                                              int64_t                     ldb,
+                                              hipblasComplex* const       C[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtrmmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const A[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const B[],
+                                              int64_t                           ldb,
+                                              hipblasDoubleComplex* const       C[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStrmmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     float*             C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrmmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     double*            C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtrmmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* B,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     hipblasComplex*       C,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtrmmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* B,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasStrsm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       AP,
+                                       int64_t            lda,
+                                       float*             BP,
+                                       int64_t            ldb);
+
+hipblasStatus_t hipblasDtrsm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      AP,
+                                       int64_t            lda,
+                                       double*            BP,
+                                       int64_t            ldb);
+
+hipblasStatus_t hipblasCtrsm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       hipblasComplex*       BP,
+                                       int64_t               ldb);
+
+hipblasStatus_t hipblasZtrsm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       BP,
+                                       int64_t                     ldb);
+
+hipblasStatus_t hipblasStrsmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       BP[],
+                                              int64_t            ldb,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrsmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       BP[],
+                                              int64_t             ldb,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCtrsmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       BP[],
+                                              int64_t                     ldb,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZtrsmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       BP[],
+                                              int64_t                           ldb,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasStrsmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasDtrsmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     int64_t            batchCount);
+
+hipblasStatus_t hipblasCtrsmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZtrsmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     int64_t                     batchCount);
+
+hipblasStatus_t hipblasSdgmm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const float*      AP,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       float*            CP,
+                                       int64_t           ldc);
+
+hipblasStatus_t hipblasDdgmm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const double*     AP,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       double*           CP,
+                                       int64_t           ldc);
+
+hipblasStatus_t hipblasCdgmm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* AP,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       CP,
+                                       int64_t               ldc);
+
+hipblasStatus_t hipblasZdgmm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* AP,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       CP,
+                                       int64_t                     ldc);
+
+hipblasStatus_t hipblasSdgmmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+hipblasStatus_t hipblasDdgmmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount);
+
+hipblasStatus_t hipblasCdgmmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount);
+
+hipblasStatus_t hipblasZdgmmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount);
+
+hipblasStatus_t hipblasSdgmmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     float*            CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasDdgmmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     double*           CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount);
+
+hipblasStatus_t hipblasCdgmmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount);
+
+hipblasStatus_t hipblasZdgmmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount);
+
+} // extern "C"
@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+
+// Copies the uplo triangle of an n by n matrix from packed storage AP to full storage A with
+// leading dimension lda, or back if unpack is false, in one call of the backend; the elements are
+// moved, not computed on, so they are chosen by their size in bytes. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED where the backend has no such conversion, and
+// HIPBLAS_PACKED_MODE_UNPACK is not supported there.
+extern "C" hipblasStatus_t hipblasPackedConvertBackend(hipblasHandle_t   handle,
+                                                       bool              unpack,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       size_t            size,
+                                                       const void*       AP,
+                                                       const void*       A,
+                                                       int               lda);
+
+// Packed routines of a handle in HIPBLAS_PACKED_MODE_UNPACK are computed here, by the matching
+// full-storage routine on a copy of AP unpacked into scratch owned by the handle. direct is
+// called instead, to operate on the packed storage, when the call is not eligible: the handle is
+// in the default mode, the arguments are invalid or describe a quick return, the call is being
+// captured, or the copy cannot be allocated (see hipblasSetPackedMode).
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const float*                     AP,
+                                    float*                           x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const double*                    AP,
+                                    double*                          x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasComplex*            AP,
+                                    hipblasComplex*                  x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      AP,
+                                    hipblasDoubleComplex*            x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const float*                     AP,
+                                    float*                           x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const double*                    AP,
+                                    double*                          x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasComplex*            AP,
+                                    hipblasComplex*                  x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasTpsvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    hipblasOperation_t               transA,
+                                    hipblasDiagType_t                diag,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      AP,
+                                    hipblasDoubleComplex*            x,
+                                    int                              incx,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasSpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const float*                     alpha,
+                                    const float*                     AP,
+                                    const float*                     x,
+                                    int                              incx,
+                                    const float*                     beta,
+                                    float*                           y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasSpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const double*                    alpha,
+                                    const double*                    AP,
+                                    const double*                    x,
+                                    int                              incx,
+                                    const double*                    beta,
+                                    double*                          y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasHpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const hipblasComplex*            alpha,
+                                    const hipblasComplex*            AP,
+                                    const hipblasComplex*            x,
+                                    int                              incx,
+                                    const hipblasComplex*            beta,
+                                    hipblasComplex*                  y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct);
+
+hipblasStatus_t hipblasHpmvUnpacked(hipblasHandle_t                  handle,
+                                    hipblasFillMode_t                uplo,
+                                    int                              n,
+                                    const hipblasDoubleComplex*      alpha,
+                                    const hipblasDoubleComplex*      AP,
+                                    const hipblasDoubleComplex*      x,
+                                    int                              incx,
+                                    const hipblasDoubleComplex*      beta,
+                                    hipblasDoubleComplex*            y,
+                                    int                              incy,
+                                    std::function<hipblasStatus_t()> direct);
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+
+// Synchronous copies between pageable host memory and the device go through a pool of pinned
+// staging buffers: the host side is packed into one buffer while the previous one is in flight,
+// which gets close to the bandwidth of copies from pinned memory. The pool is allocated on first
+// use with the size in bytes given by HIPBLAS_STAGING_POOL_SIZE; 0 disables staging.
+
+// Copies the rows x cols matrix A in host memory to B in device memory. direct is called instead
+// when the copy is not staged: staging is disabled, the copy is small or invalid, A is already
+// pinned, or the pool is in use by another thread.
+hipblasStatus_t hipblasStagedSetMatrix(int                              rows,
+                                       int                              cols,
+                                       int                              elemSize,
+                                       const void*                      A,
+                                       int                              lda,
+                                       void*                            B,
+                                       int                              ldb,
+                                       std::function<hipblasStatus_t()> direct);
+
+// Copies the rows x cols matrix A in device memory to B in host memory, see
+// hipblasStagedSetMatrix
+hipblasStatus_t hipblasStagedGetMatrix(int                              rows,
+                                       int                              cols,
+                                       int                              elemSize,
+                                       const void*                      A,
+                                       int                              lda,
+                                       void*                            B,
+                                       int                              ldb,
+                                       std::function<hipblasStatus_t()> direct);
+
+// A vector with stride inc is a 1 x n matrix with leading dimension inc, or a single column
+// if it is contiguous on both sides
+inline hipblasStatus_t hipblasStagedSetVector(int                              n,
+                                              int                              elemSize,
+                                              const void*                      x,
+                                              int                              incx,
+                                              void*                            y,
+                                              int                              incy,
+                                              std::function<hipblasStatus_t()> direct)
+{
+    if(incx <= 0 || incy <= 0)
+        return direct();
+    if(incx == 1 && incy == 1)
+        return hipblasStagedSetMatrix(n, 1, elemSize, x, n, y, n, direct);
+    return hipblasStagedSetMatrix(1, n, elemSize, x, incx, y, incy, direct);
+}
+
+inline hipblasStatus_t hipblasStagedGetVector(int                              n,
+                                              int                              elemSize,
+                                              const void*                      x,
+                                              int                              incx,
+                                              void*                            y,
+                                              int                              incy,
+                                              std::function<hipblasStatus_t()> direct)
+{
+    if(incx <= 0 || incy <= 0)
+        return direct();
+    if(incx == 1 && incy == 1)
+        return hipblasStagedGetMatrix(n, 1, elemSize, x, n, y, n, direct);
+    return hipblasStagedGetMatrix(1, n, elemSize, x, incx, y, incy, direct);
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+struct hipblasHandleState;
+
+// Hands workspace owned by hipBLAS to the backend handle
+using hipblasSetBackendWorkspace = hipblasStatus_t (*)(hipblasHandle_t handle,
+                                                       void*           workspace,
+                                                       size_t          bytes);
+
+// Grows the workspace of handle to at least bytes, from the handle's memory pool and in the order
+// of its stream, and hands it to the backend with set_workspace. The workspace it replaces is
+// freed once the work queued before has run. growth is true when a call needs the workspace,
+// rather than hipblasReserveWorkspace; func is the function growing it, for the capture checks.
+hipblasStatus_t hipblasPoolWorkspaceReserve(hipblasHandle_t            handle,
+                                            const char*                func,
+                                            size_t                     bytes,
+                                            bool                       growth,
+                                            hipblasSetBackendWorkspace set_workspace);
+
+// Shrinks the workspace owned by hipBLAS to bytes if it is larger, allocating the smaller one from
+// the pool in HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED; 0 hands the backend back its own workspace.
+// The caller makes the capture checks.
+hipblasStatus_t hipblasTrimOwnedWorkspace(hipblasHandle_t            handle,
+                                          size_t                     bytes,
+                                          hipblasSetBackendWorkspace set_workspace);
+
+// Frees the workspace owned by hipBLAS, once the work queued on the handle's stream has run if it
+// came from the pool. Called with the state mutex held, after the backend has stopped using it.
+void hipblasFreeWorkspace(hipblasHandle_t handle, hipblasHandleState* state);
+
+// Called by hipblasSetStream before the stream of handle is changed to stream. Workspace from the
+// pool is allocated and freed in the order of the handle's stream of the time, so while the handle
+// owns one, the work queued on stream from now on waits for the work queued on the old stream.
+hipblasStatus_t hipblasPoolWorkspaceStreamChange(hipblasHandle_t handle, hipStream_t stream);
@@ -0,0 +1,211 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblasXt.h"
+#include <complex>
+#include <memory>
+
+// Selects the devices on which hipblasXt runs its tiles. The stub backend runs them on the host,
+// so that tiling and scheduling can be tested without GPUs; it is not part of the public API, and
+// the tests declare hipblasXtSetBackend themselves.
+typedef enum
+{
+    HIPBLASXT_BACKEND_DEVICE = 0,
+    HIPBLASXT_BACKEND_STUB   = 1
+} hipblasXtBackend_t;
+
+// Changing the backend releases the device resources held by handle
+extern "C" HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetBackend(hipblasXtHandle_t  handle,
+                                                              hipblasXtBackend_t backend);
+
+// Number of tiles each device keeps in flight; while one is computing the
+// transfers of the other are in progress
+constexpr int hipblasXtSlots = 2;
+
+// Host type with arithmetic for each hipBLAS type, and its hipDataType
+template <typename T>
+struct hipblasXtType;
+
+template <>
+struct hipblasXtType<float>
+{
+    using host                        = float;
+    static constexpr hipDataType type = HIP_R_32F;
+};
+
+template <>
+struct hipblasXtType<double>
+{
+    using host                        = double;
+    static constexpr hipDataType type = HIP_R_64F;
+};
+
+template <>
+struct hipblasXtType<hipblasComplex>
+{
+    using host                        = std::complex<float>;
+    static constexpr hipDataType type = HIP_C_32F;
+};
+
+template <>
+struct hipblasXtType<hipblasDoubleComplex>
+{
+    using host                        = std::complex<double>;
+    static constexpr hipDataType type = HIP_C_64F;
+};
+
+// Real values of the hipBLAS types are constructed directly; complex ones from their parts
+template <typename T>
+inline T hipblasXtConstant(double value)
+{
+    return T(value);
+}
+
+template <>
+inline hipblasComplex hipblasXtConstant<hipblasComplex>(double value)
+{
+    return hipblasComplex(float(value), 0.0f);
+}
+
+template <>
+inline hipblasDoubleComplex hipblasXtConstant<hipblasDoubleComplex>(double value)
+{
+    return hipblasDoubleComplex(value, 0.0);
+}
+
+inline bool hipblasXtIsZero(float value)
+{
+    return value == 0;
+}
+
+inline bool hipblasXtIsZero(double value)
+{
+    return value == 0;
+}
+
+inline bool hipblasXtIsZero(const hipblasComplex& value)
+{
+    return value.real() == 0 && value.imag() == 0;
+}
+
+inline bool hipblasXtIsZero(const hipblasDoubleComplex& value)
+{
+    return value.real() == 0 && value.imag() == 0;
+}
+
+// One device as seen by the hipblasXt scheduler. Each device is driven by a single host
+// thread at a time. Work submitted to the same slot executes in order; work on different
+// slots may overlap. Scalars are host pointers of the type given by the hipDataType.
+class hipblasXtDevice
+{
+public:
+    virtual ~hipblasXtDevice() = default;
+
+    // Make the device current on the calling thread
+    virtual hipblasStatus_t activate() = 0;
+
+    // Returns a buffer of at least bytes for slot, valid until the next call for that slot
+    virtual hipblasStatus_t reserve(int slot, size_t bytes, void** buffer) = 0;
+
+    virtual hipblasStatus_t setMatrix(int         slot,
+                                      int         rows,
+                                      int         cols,
+                                      int         elemSize,
+                                      const void* hostA,
+                                      int         lda,
+                                      void*       devB,
+                                      int         ldb)
+        = 0;
+
+    virtual hipblasStatus_t getMatrix(int         slot,
+                                      int         rows,
+                                      int         cols,
+                                      int         elemSize,
+                                      const void* devA,
+                                      int         lda,
+                                      void*       hostB,
+                                      int         ldb)
+        = 0;
+
+    virtual hipblasStatus_t gemm(int                slot,
+                                 hipDataType        type,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 int                lda,
+                                 const void*        B,
+                                 int                ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 int                ldc)
+        = 0;
+
+    virtual hipblasStatus_t syrk(int                slot,
+                                 hipDataType        type,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 int                lda,
+                                 const void*        beta,
+                                 void*              C,
+                                 int                ldc)
+        = 0;
+
+    virtual hipblasStatus_t trsm(int                slot,
+                                 hipDataType        type,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb)
+        = 0;
+
+    // Wait for all work submitted on all slots
+    virtual hipblasStatus_t synchronize() = 0;
+};
+
+// Device backed by a hipBLAS handle and a stream for each slot
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateGpuDevice(int device);
+
+// Device which runs slot 0 on the caller's handle, on device, and the other slots on handles of
+// their own, each slot with a stream of its own. The stream of the handle is restored when the
+// device is destroyed.
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateHandleDevice(hipblasHandle_t handle, int device);
+
+// Device which runs everything on the calling host thread, for testing without GPUs
+std::unique_ptr<hipblasXtDevice> hipblasXtCreateStubDevice(int device);
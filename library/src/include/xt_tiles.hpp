@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "xt_backend.hpp"
+#include <algorithm>
+
+// Tiling shared by hipblasXt and the single device streamed functions. Tiles are block_dim by
+// block_dim; the last tile of a dimension may be smaller.
+
+inline size_t xt_blocks(size_t n, size_t block_dim)
+{
+    return (n + block_dim - 1) / block_dim;
+}
+
+inline int xt_block_size(size_t n, size_t block_dim, size_t block)
+{
+    return int(std::min(block_dim, n - block * block_dim));
+}
+
+#define XT_RETURN_IF_ERROR(status__)              \
+    do                                            \
+    {                                             \
+        hipblasStatus_t xt_status__ = (status__); \
+        if(xt_status__ != HIPBLAS_STATUS_SUCCESS) \
+            return xt_status__;                   \
+    } while(0)
+
+// Copies the rows x cols block at host into the device buffer dev, packed with ld = rows
+template <typename T>
+hipblasStatus_t xt_upload(
+    hipblasXtDevice& device, int slot, int rows, int cols, const T* host, size_t ld, T* dev)
+{
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    return device.setMatrix(slot, rows, cols, sizeof(T), host, int(ld), dev, rows);
+}
+
+/*! \brief C tile (i0, j0) of size mb x nb of C = alpha*op(A)*op(B) + beta*C, streaming the
+    inner dimension in panels of block_dim. buffer holds 3 block_dim^2 elements. */
+template <typename T>
+hipblasStatus_t xt_gemm_tile(hipblasXtDevice&   device,
+                             int                slot,
+                             T*                 buffer,
+                             int                block_dim,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             size_t             i0,
+                             size_t             j0,
+                             int                mb,
+                             int                nb,
+                             size_t             k,
+                             const T*           alpha,
+                             const T*           A,
+                             size_t             lda,
+                             const T*           B,
+                             size_t             ldb,
+                             const T*           beta,
+                             T*                 C,
+                             size_t             ldc)
+{
+    constexpr hipDataType type = hipblasXtType<T>::type;
+
+    const T one = hipblasXtConstant<T>(1);
+    T*      dA  = buffer;
+    T*      dB  = dA + size_t(block_dim) * block_dim;
+    T*      dC  = dB + size_t(block_dim) * block_dim;
+
+    // C is only read if beta != 0
+    if(!hipblasXtIsZero(*beta))
+        XT_RETURN_IF_ERROR(xt_upload(device, slot, mb, nb, C + i0 + j0 * ldc, ldc, dC));
+
+    // With alpha == 0 only the scaling by beta is left
+    if(hipblasXtIsZero(*alpha))
+        k = 0;
+
+    size_t k0 = 0;
+    do
+    {
+        int kb = k ? xt_block_size(k, block_dim, k0 / block_dim) : 0;
+
+        // Panels of A and B as stored, i.e. before op() is applied
+        const T* hA = transA == HIPBLAS_OP_N ? A + i0 + k0 * lda : A + k0 + i0 * lda;
+        const T* hB = transB == HIPBLAS_OP_N ? B + k0 + j0 * ldb : B + j0 + k0 * ldb;
+        int      ar = transA == HIPBLAS_OP_N ? mb : kb;
+        int      ac = transA == HIPBLAS_OP_N ? kb : mb;
+        int      br = transB == HIPBLAS_OP_N ? kb : nb;
+        int      bc = transB == HIPBLAS_OP_N ? nb : kb;
+
+        XT_RETURN_IF_ERROR(xt_upload(device, slot, ar, ac, hA, lda, dA));
+        XT_RETURN_IF_ERROR(xt_upload(device, slot, br, bc, hB, ldb, dB));
+        XT_RETURN_IF_ERROR(device.gemm(slot,
+                                       type,
+                                       transA,
+                                       transB,
+                                       mb,
+                                       nb,
+                                       kb,
+                                       alpha,
+                                       dA,
+                                       std::max(1, ar),
+                                       dB,
+                                       std::max(1, br),
+                                       k0 ? &one : beta,
+                                       dC,
+                                       mb));
+        k0 += kb;
+    } while(k0 < k);
+
+    return device.getMatrix(slot, mb, nb, sizeof(T), dC, mb, C + i0 + j0 * ldc, int(ldc));
+}
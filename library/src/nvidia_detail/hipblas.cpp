@@ -22,10 +22,118 @@
  * ************************************************************************ */
 
 #include "hipblas.h"
+#include "batch_split.hpp"
 #include "exceptions.hpp"
+#include "gemm_3m.hpp"
+#include "gemm_epilogue.hpp"
+#include "gemm_fp8.hpp"
+#include "gemm_out_of_place.hpp"
+#include "handle.hpp"
+#include "ilp64_backend.hpp"
+#include "packed.hpp"
+#include "staging.hpp"
+#include "workspace_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cublasLt.h>
 #include <cublas_v2.h>
 #include <cuda_runtime_api.h>
 #include <hip/hip_runtime.h>
+#include <list>
+
+// The _64 functions of cuBLAS, from CUDA 12; without them the _64Backend hooks return
+// HIPBLAS_STATUS_NOT_SUPPORTED
+#if CUBLAS_VER_MAJOR >= 12
+#define HIPBLAS_ILP64_NATIVE(status__) status__
+#else
+#define HIPBLAS_ILP64_NATIVE(status__) HIPBLAS_STATUS_NOT_SUPPORTED
+#endif
+
+// The FP8 gemms of cublasLt, from cuBLAS 11.11, in the OCP formats of hipDataType
+#if defined(HIPBLAS_OCP_FP8) \
+    && (CUBLAS_VER_MAJOR > 11 || (CUBLAS_VER_MAJOR == 11 && CUBLAS_VER_MINOR >= 11))
+#define HIPBLAS_CUBLASLT_FP8
+#endif
+
+// cublasLt for HIPBLAS_GEMM_EX_MODE_LT and for gemms with epilogues
+struct hipblasGemmLtCache
+{
+    struct Key
+    {
+        cublasOperation_t   transa;
+        cublasOperation_t   transb;
+        int                 m;
+        int                 n;
+        int                 k;
+        int                 lda;
+        int                 ldb;
+        int                 ldc;
+        cudaDataType_t      a_type;
+        cudaDataType_t      b_type;
+        cudaDataType_t      c_type;
+        cudaDataType_t      d_type;
+        int                 ldd;
+        cublasComputeType_t compute_type;
+        cudaDataType_t      scale_type;
+        cublasPointerMode_t pointer_mode;
+        cublasMath_t        math_mode;
+        cublasLtEpilogue_t  epilogue;
+        int64_t             ldaux;
+        uint32_t            a_alignment;
+        uint32_t            b_alignment;
+        uint32_t            c_alignment;
+        uint32_t            d_alignment;
+        int                 batch_count;
+        int64_t             stride_a;
+        int64_t             stride_b;
+        int64_t             stride_c;
+
+        bool operator==(const Key& other) const
+        {
+            return transa == other.transa && transb == other.transb && m == other.m
+                   && n == other.n && k == other.k && lda == other.lda && ldb == other.ldb
+                   && ldc == other.ldc && a_type == other.a_type && b_type == other.b_type
+                   && c_type == other.c_type && d_type == other.d_type && ldd == other.ldd
+                   && compute_type == other.compute_type
+                   && scale_type == other.scale_type && pointer_mode == other.pointer_mode
+                   && math_mode == other.math_mode && epilogue == other.epilogue
+                   && ldaux == other.ldaux && a_alignment == other.a_alignment
+                   && b_alignment == other.b_alignment && c_alignment == other.c_alignment
+                   && d_alignment == other.d_alignment && batch_count == other.batch_count
+                   && stride_a == other.stride_a && stride_b == other.stride_b
+                   && stride_c == other.stride_c;
+        }
+    };
+
+    // The descriptors of a call and the algorithm the heuristic chose for them, with the
+    // workspace it was allowed; found is false if the heuristic had none
+    struct Plan
+    {
+        Key                    key;
+        cublasLtMatmulDesc_t   desc = nullptr;
+        cublasLtMatrixLayout_t a    = nullptr;
+        cublasLtMatrixLayout_t b    = nullptr;
+        cublasLtMatrixLayout_t c    = nullptr;
+        cublasLtMatrixLayout_t d    = nullptr;
+        cublasLtMatmulAlgo_t   algo;
+        bool                   found          = false;
+        size_t                 workspace_size = 0;
+        size_t                 max_workspace  = 0;
+    };
+
+    // Plans most recently used first
+    std::mutex       mutex;
+    cublasLtHandle_t lt = nullptr;
+    std::list<Plan>  plans;
+    void*            workspace      = nullptr;
+    size_t           workspace_size = 0;
+
+    hipblasGemmLtCache() = default;
+    ~hipblasGemmLtCache();
+
+    hipblasGemmLtCache(const hipblasGemmLtCache&) = delete;
+    hipblasGemmLtCache& operator=(const hipblasGemmLtCache&) = delete;
+};
 
 #ifdef __cplusplus
 extern "C" {
@@ -272,6 +380,14 @@ cudaDataType_t HIPDatatypeToCudaDatatype_v2(hipDataType type)
     case HIP_C_16BF:
         return CUDA_C_16BF;
 
+#ifdef HIPBLAS_CUBLASLT_FP8
+    case HIP_R_8F_E4M3:
+        return CUDA_R_8F_E4M3;
+
+    case HIP_R_8F_E5M2:
+        return CUDA_R_8F_E5M2;
+#endif
+
     default:
         throw HIPBLAS_STATUS_INVALID_ENUM;
     }
@@ -389,7 +505,27 @@ hipblasStatus_t hipCUBLASStatusToHIPStatus(cublasStatus_t cuStatus)
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, streamId));
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasStatus_t status = hipblasPoolWorkspaceStreamChange(handle, streamId);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    status = hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, streamId));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // cublasSetStream hands cuBLAS back its default workspace, so the one owned by hipBLAS is
+    // handed to it again
+    hipblasHandleState* state = hipblasFindHandleState(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(!state->workspace)
+        return HIPBLAS_STATUS_SUCCESS;
+    return hipCUBLASStatusToHIPStatus(
+        cublasSetWorkspace((cublasHandle_t)handle, state->workspace, state->workspace_size));
 }
 catch(...)
 {
@@ -420,7 +556,24 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDestroy((cublasHandle_t)handle));
+    // Freed first, as a workspace from the pool is freed in the order of the handle's stream
+    hipblasHandleState* state        = hipblasFindHandleState(handle);
+    hipblasStatus_t     flush_status = HIPBLAS_STATUS_SUCCESS;
+    if(state)
+    {
+        // Rank-1 updates still deferred are applied before that
+        flush_status = hipblasFlushRankUpdates(handle);
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        hipblasFreeWorkspace(handle, state);
+        delete state->gemm_lt_cache;
+        state->gemm_lt_cache = nullptr;
+    }
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(cublasDestroy((cublasHandle_t)handle));
+    hipblasReleaseHandleState(handle);
+
+    return flush_status != HIPBLAS_STATUS_SUCCESS ? flush_status : status;
 }
 catch(...)
 {
@@ -455,8 +608,10 @@ catch(...)
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasSetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
+    return hipblasStagedSetVector(n, elemSize, x, incx, y, incy, [&] {
+        return hipCUBLASStatusToHIPStatus(
+            cublasSetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
+    });
 }
 catch(...)
 {
@@ -467,8 +622,10 @@ catch(...)
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasGetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
+    return hipblasStagedGetVector(n, elemSize, x, incx, y, incy, [&] {
+        return hipCUBLASStatusToHIPStatus(
+            cublasGetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
+    });
 }
 catch(...)
 {
@@ -480,7 +637,9 @@ hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSetMatrix(rows, cols, elemSize, A, lda, B, ldb));
+    return hipblasStagedSetMatrix(rows, cols, elemSize, A, lda, B, ldb, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasSetMatrix(rows, cols, elemSize, A, lda, B, ldb));
+    });
 }
 catch(...)
 {
@@ -492,7 +651,9 @@ hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasGetMatrix(rows, cols, elemSize, A, lda, B, ldb));
+    return hipblasStagedGetMatrix(rows, cols, elemSize, A, lda, B, ldb, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasGetMatrix(rows, cols, elemSize, A, lda, B, ldb));
+    });
 }
 catch(...)
 {
@@ -568,10 +729,161 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// Hands workspace owned by hipBLAS, allocated from the pool of the handle, to cuBLAS
+static hipblasStatus_t
+    hipblasSetCublasWorkspace(hipblasHandle_t handle, void* workspace, size_t bytes)
+{
+    return hipCUBLASStatusToHIPStatus(cublasSetWorkspace((cublasHandle_t)handle, workspace, bytes));
+}
+
+// capture mode
+hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cuBLAS allocates its default workspace when the handle is created and
+    // does not grow it, so there is nothing to pin here
+    return hipblasSetHandleCaptureMode(handle, mode);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasReserveWorkspace(hipblasHandle_t handle, size_t workspaceSizeInBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(hipblasIsWorkspaceStreamOrdered(handle))
+        return hipblasPoolWorkspaceReserve(
+            handle, __func__, workspaceSizeInBytes, false, hipblasSetCublasWorkspace);
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if(workspaceSizeInBytes <= state->workspace_size)
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t status = hipblasCheckCapture(
+        handle, __func__, "workspace growth to %zu bytes", size_t(workspaceSizeInBytes));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    void* workspace = nullptr;
+    auto  start     = std::chrono::steady_clock::now();
+    if(hipMalloc(&workspace, workspaceSizeInBytes) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    status = hipCUBLASStatusToHIPStatus(
+        cublasSetWorkspace((cublasHandle_t)handle, workspace, workspaceSizeInBytes));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipFree(workspace);
+        return status;
+    }
+
+    hipblasFreeWorkspace(handle, state);
+    state->workspace           = workspace;
+    state->workspace_size      = workspaceSizeInBytes;
+    state->peak_workspace_size = std::max(state->peak_workspace_size, workspaceSizeInBytes);
+    state->workspace_alloc_us += elapsed.count();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMemoryStats(hipblasHandle_t handle, hipblasMemoryStats_t* stats)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(stats == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // cuBLAS does not report the size of its default workspace, so only that set by
+    // hipblasReserveWorkspace is counted; cuBLAS never grows it on demand
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    size_t              size;
+    hipblasGemmLtCache* gemm_lt_cache;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        size          = state->workspace_size;
+        gemm_lt_cache = state->gemm_lt_cache;
+    }
+
+    hipblasStatus_t status = hipblasGetHandleMemoryStats(handle, size, stats);
+    if(status == HIPBLAS_STATUS_SUCCESS && gemm_lt_cache)
+    {
+        std::lock_guard<std::mutex> lock(gemm_lt_cache->mutex);
+        stats->scratchBytes += gemm_lt_cache->workspace_size;
+    }
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasResetMemoryStats(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    size_t              size;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        size = state->workspace_size;
+    }
+    hipblasResetHandleMemoryStats(handle, size);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasTrimWorkspace(hipblasHandle_t handle, size_t targetBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if(state->workspace_size <= targetBytes)
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t status
+        = hipblasCheckCapture(handle, __func__, "workspace trim to %zu bytes", size_t(targetBytes));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasTrimOwnedWorkspace(handle, targetBytes, hipblasSetCublasWorkspace);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // amax
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasIsamax((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -582,6 +894,7 @@ catch(...)
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasIdamax((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -593,6 +906,7 @@ hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -605,6 +919,7 @@ hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -695,6 +1010,7 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasIsamin((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -705,6 +1021,7 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasIdamin((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -716,6 +1033,7 @@ hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -728,6 +1046,7 @@ hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -818,6 +1137,7 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -829,6 +1149,7 @@ hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasDasum((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -840,6 +1161,7 @@ hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -852,6 +1174,7 @@ hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -865,6 +1188,7 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
@@ -1350,6 +1674,7 @@ hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                             float*          result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
 }
@@ -1367,6 +1692,7 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                             double*         result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasDdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
 }
@@ -1384,6 +1710,7 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasCdotc(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
 }
@@ -1401,6 +1728,7 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasCdotu(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
 }
@@ -1418,6 +1746,7 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasZdotc((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)x,
@@ -1440,6 +1769,7 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasZdotu((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)x,
@@ -1464,6 +1794,7 @@ hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                    hipblasHalf*             result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -1496,6 +1827,7 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -1683,6 +2015,7 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasSnrm2((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -1694,6 +2027,7 @@ hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(cublasDnrm2((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -1705,6 +2039,7 @@ hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -1717,6 +2052,7 @@ hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
     return hipCUBLASStatusToHIPStatus(
         cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -4279,16 +4615,19 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasChpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  n,
-                                                  (cuComplex*)alpha,
-                                                  (cuComplex*)AP,
-                                                  (cuComplex*)x,
-                                                  incx,
-                                                  (cuComplex*)beta,
-                                                  (cuComplex*)y,
-                                                  incy));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasChpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      n,
+                                                      (cuComplex*)alpha,
+                                                      (cuComplex*)AP,
+                                                      (cuComplex*)x,
+                                                      incx,
+                                                      (cuComplex*)beta,
+                                                      (cuComplex*)y,
+                                                      incy));
+    };
+    return hipblasHpmvUnpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
 }
 catch(...)
 {
@@ -4307,16 +4646,19 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZhpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  n,
-                                                  (cuDoubleComplex*)alpha,
-                                                  (cuDoubleComplex*)AP,
-                                                  (cuDoubleComplex*)x,
-                                                  incx,
-                                                  (cuDoubleComplex*)beta,
-                                                  (cuDoubleComplex*)y,
-                                                  incy));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZhpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      n,
+                                                      (cuDoubleComplex*)alpha,
+                                                      (cuDoubleComplex*)AP,
+                                                      (cuDoubleComplex*)x,
+                                                      incx,
+                                                      (cuDoubleComplex*)beta,
+                                                      (cuDoubleComplex*)y,
+                                                      incy));
+    };
+    return hipblasHpmvUnpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
 }
 catch(...)
 {
@@ -4761,8 +5103,11 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSspmv(
-        (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasSspmv(
+            (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
+    };
+    return hipblasSpmvUnpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
 }
 catch(...)
 {
@@ -4781,8 +5126,11 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDspmv(
-        (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasDspmv(
+            (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
+    };
+    return hipblasSpmvUnpacked(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, direct);
 }
 catch(...)
 {
@@ -6284,6 +6632,49 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
+// Packed conversion: see packed.hpp. cublas<t>tpttr and cublas<t>trttp convert in one call;
+// complex float elements are moved as doubles.
+hipblasStatus_t hipblasPackedConvertBackend(hipblasHandle_t   handle,
+                                            bool              unpack,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            size_t            size,
+                                            const void*       AP,
+                                            const void*       A,
+                                            int               lda)
+try
+{
+    cublasHandle_t   cublas_handle = (cublasHandle_t)handle;
+    cublasFillMode_t fill          = hipFillToCudaFill(uplo);
+    switch(size)
+    {
+    case sizeof(float):
+        if(unpack)
+            return hipCUBLASStatusToHIPStatus(
+                cublasStpttr(cublas_handle, fill, n, (const float*)AP, (float*)A, lda));
+        return hipCUBLASStatusToHIPStatus(
+            cublasStrttp(cublas_handle, fill, n, (const float*)A, lda, (float*)AP));
+    case sizeof(double):
+        if(unpack)
+            return hipCUBLASStatusToHIPStatus(
+                cublasDtpttr(cublas_handle, fill, n, (const double*)AP, (double*)A, lda));
+        return hipCUBLASStatusToHIPStatus(
+            cublasDtrttp(cublas_handle, fill, n, (const double*)A, lda, (double*)AP));
+    case sizeof(cuDoubleComplex):
+        if(unpack)
+            return hipCUBLASStatusToHIPStatus(cublasZtpttr(
+                cublas_handle, fill, n, (const cuDoubleComplex*)AP, (cuDoubleComplex*)A, lda));
+        return hipCUBLASStatusToHIPStatus(cublasZtrttp(
+            cublas_handle, fill, n, (const cuDoubleComplex*)A, lda, (cuDoubleComplex*)AP));
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // tpmv
 hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              hipblasFillMode_t  uplo,
@@ -6295,14 +6686,17 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasStpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  AP,
-                                                  x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasStpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      AP,
+                                                      x,
+                                                      incx));
+    };
+    return hipblasTpmvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6319,14 +6713,17 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDtpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  AP,
-                                                  x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasDtpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      AP,
+                                                      x,
+                                                      incx));
+    };
+    return hipblasTpmvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6343,14 +6740,17 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCtpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  (cuComplex*)AP,
-                                                  (cuComplex*)x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasCtpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      (cuComplex*)AP,
+                                                      (cuComplex*)x,
+                                                      incx));
+    };
+    return hipblasTpmvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6367,14 +6767,17 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZtpmv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  (cuDoubleComplex*)AP,
-                                                  (cuDoubleComplex*)x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZtpmv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      (cuDoubleComplex*)AP,
+                                                      (cuDoubleComplex*)x,
+                                                      incx));
+    };
+    return hipblasTpmvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6506,14 +6909,17 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasStpsv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  AP,
-                                                  x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasStpsv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      AP,
+                                                      x,
+                                                      incx));
+    };
+    return hipblasTpsvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6530,14 +6936,17 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDtpsv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  AP,
-                                                  x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasDtpsv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      AP,
+                                                      x,
+                                                      incx));
+    };
+    return hipblasTpsvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6554,14 +6963,17 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCtpsv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  (cuComplex*)AP,
-                                                  (cuComplex*)x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasCtpsv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      (cuComplex*)AP,
+                                                      (cuComplex*)x,
+                                                      incx));
+    };
+    return hipblasTpsvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -6578,14 +6990,17 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZtpsv((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  hipDiagonalToCudaDiagonal(diag),
-                                                  m,
-                                                  (cuDoubleComplex*)AP,
-                                                  (cuDoubleComplex*)x,
-                                                  incx));
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZtpsv((cublasHandle_t)handle,
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      (cuDoubleComplex*)AP,
+                                                      (cuDoubleComplex*)x,
+                                                      incx));
+    };
+    return hipblasTpsvUnpacked(handle, uplo, transA, diag, m, AP, x, incx, direct);
 }
 catch(...)
 {
@@ -10268,6 +10683,16 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrfBatchedSplit(hipblasSgetrfBatched,
+                                        handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(
         cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10285,6 +10710,16 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrfBatchedSplit(hipblasDgetrfBatched,
+                                        handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(
         cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10302,6 +10737,16 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrfBatchedSplit(hipblasCgetrfBatched,
+                                        handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
         (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10319,6 +10764,16 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrfBatchedSplit(hipblasZgetrfBatched,
+                                        handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
         (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10451,6 +10906,20 @@ hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrsBatchedSplit(hipblasSgetrsBatched,
+                                        handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10481,6 +10950,20 @@ hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrsBatchedSplit(hipblasDgetrsBatched,
+                                        handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10511,6 +10994,20 @@ hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrsBatchedSplit(hipblasCgetrsBatched,
+                                        handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10541,6 +11038,20 @@ hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGetrsBatchedSplit(hipblasZgetrsBatched,
+                                        handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        B,
+                                        ldb,
+                                        info,
+                                        batch_count);
+
     return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10631,64 +11142,82 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// getri_batched
-hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
-                                     const int       n,
-                                     float* const    A[],
-                                     const int       lda,
-                                     int*            ipiv,
-                                     float* const    C[],
-                                     const int       ldc,
-                                     int*            info,
-                                     const int       batch_count)
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    float* const    A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    float* const    B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
-}
-catch(...)
-{
-    return exception_to_hipblas_status();
-}
+    // cuBLAS checks the getrs arguments on the host, so check them before factorizing
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
 
-hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
-                                     const int       n,
-                                     double* const   A[],
-                                     const int       lda,
-                                     int*            ipiv,
-                                     double* const   C[],
-                                     const int       ldc,
-                                     int*            info,
-                                     const int       batch_count)
-try
-{
-    return hipCUBLASStatusToHIPStatus(
-        cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(
+        cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // getrs only reports argument errors, which were checked above; singular matrices are
+    // reported by getrf in the device info
+    int host_info = 0;
+    return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          ipiv,
+                                                          B,
+                                                          ldb,
+                                                          &host_info,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
-                                     const int             n,
-                                     hipblasComplex* const A[],
-                                     const int             lda,
-                                     int*                  ipiv,
-                                     hipblasComplex* const C[],
-                                     const int             ldc,
-                                     int*                  info,
-                                     const int             batch_count)
+hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    double* const   A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    double* const   B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
+    // cuBLAS checks the getrs arguments on the host, so check them before factorizing
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(
+        cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // getrs only reports argument errors, which were checked above; singular matrices are
+    // reported by getrf in the device info
+    int host_info = 0;
+    return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
                                                           n,
-                                                          (cuComplex**)A,
+                                                          nrhs,
+                                                          A,
                                                           lda,
                                                           ipiv,
-                                                          (cuComplex**)C,
-                                                          ldc,
-                                                          info,
+                                                          B,
+                                                          ldb,
+                                                          &host_info,
                                                           batch_count));
 }
 catch(...)
@@ -10696,25 +11225,81 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
-                                     const int                   n,
-                                     hipblasDoubleComplex* const A[],
-                                     const int                   lda,
-                                     int*                        ipiv,
-                                     hipblasDoubleComplex* const C[],
-                                     const int                   ldc,
-                                     int*                        info,
-                                     const int                   batch_count)
+hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    int*                  ipiv,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    const int             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
+    // cuBLAS checks the getrs arguments on the host, so check them before factorizing
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+        (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // getrs only reports argument errors, which were checked above; singular matrices are
+    // reported by getrf in the device info
+    int host_info = 0;
+    return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          (cuComplex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          (cuComplex**)B,
+                                                          ldb,
+                                                          &host_info,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    int*                        ipiv,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    const int                   batch_count)
+try
+{
+    // cuBLAS checks the getrs arguments on the host, so check them before factorizing
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+        (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // getrs only reports argument errors, which were checked above; singular matrices are
+    // reported by getrf in the device info
+    int host_info = 0;
+    return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
                                                           n,
+                                                          nrhs,
                                                           (cuDoubleComplex**)A,
                                                           lda,
                                                           ipiv,
-                                                          (cuDoubleComplex**)C,
-                                                          ldc,
-                                                          info,
+                                                          (cuDoubleComplex**)B,
+                                                          ldb,
+                                                          &host_info,
                                                           batch_count));
 }
 catch(...)
@@ -10722,122 +11307,158 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-// geqrf
-hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
-                              const int       m,
-                              const int       n,
-                              float*          A,
-                              const int       lda,
-                              float*          ipiv,
-                              int*            info)
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
-                              const int       m,
-                              const int       n,
-                              double*         A,
-                              const int       lda,
-                              double*         ipiv,
-                              int*            info)
+hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
-                              const int       m,
-                              const int       n,
-                              hipblasComplex* A,
-                              const int       lda,
-                              hipblasComplex* ipiv,
-                              int*            info)
+hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
-                              const int             m,
-                              const int             n,
-                              hipblasDoubleComplex* A,
-                              const int             lda,
-                              hipblasDoubleComplex* ipiv,
-                              int*                  info)
+hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           int*                  ipiv,
+                                           const hipblasStride   strideP,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           const int             batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// geqrf_batched
-hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
-                                     const int       m,
+// getri_batched
+hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       n,
                                      float* const    A[],
                                      const int       lda,
-                                     float* const    ipiv[],
+                                     int*            ipiv,
+                                     float* const    C[],
+                                     const int       ldc,
                                      int*            info,
                                      const int       batch_count)
 try
 {
     return hipCUBLASStatusToHIPStatus(
-        cublasSgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
+        cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
-                                     const int       m,
+hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       n,
                                      double* const   A[],
                                      const int       lda,
-                                     double* const   ipiv[],
+                                     int*            ipiv,
+                                     double* const   C[],
+                                     const int       ldc,
                                      int*            info,
                                      const int       batch_count)
 try
 {
     return hipCUBLASStatusToHIPStatus(
-        cublasDgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
+        cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
-                                     const int             m,
+hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             n,
                                      hipblasComplex* const A[],
                                      const int             lda,
-                                     hipblasComplex* const ipiv[],
+                                     int*                  ipiv,
+                                     hipblasComplex* const C[],
+                                     const int             ldc,
                                      int*                  info,
                                      const int             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
-        (cublasHandle_t)handle, m, n, (cuComplex**)A, lda, (cuComplex**)ipiv, info, batch_count));
+    return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
+                                                          n,
+                                                          (cuComplex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          (cuComplex**)C,
+                                                          ldc,
+                                                          info,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
-                                     const int                   m,
+hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   n,
                                      hipblasDoubleComplex* const A[],
                                      const int                   lda,
-                                     hipblasDoubleComplex* const ipiv[],
+                                     int*                        ipiv,
+                                     hipblasDoubleComplex* const C[],
+                                     const int                   ldc,
                                      int*                        info,
                                      const int                   batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
-                                                          m,
+    return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
                                                           n,
                                                           (cuDoubleComplex**)A,
                                                           lda,
-                                                          (cuDoubleComplex**)ipiv,
+                                                          ipiv,
+                                                          (cuDoubleComplex**)C,
+                                                          ldc,
                                                           info,
                                                           batch_count));
 }
@@ -10846,889 +11467,1529 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-// geqrf_strided_batched
-hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
-                                            const int           m,
-                                            const int           n,
-                                            float*              A,
-                                            const int           lda,
-                                            const hipblasStride strideA,
-                                            float*              ipiv,
-                                            const hipblasStride strideP,
-                                            int*                info,
-                                            const int           batch_count)
+// potrf
+// Cholesky factorizations are provided by cuSOLVER rather than cuBLAS, so potrf, potrs and potri
+// are not supported with the cuBLAS backend
+hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
-                                            const int           m,
-                                            const int           n,
-                                            double*             A,
-                                            const int           lda,
-                                            const hipblasStride strideA,
-                                            double*             ipiv,
-                                            const hipblasStride strideP,
-                                            int*                info,
-                                            const int           batch_count)
+hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
-                                            const int           m,
-                                            const int           n,
-                                            hipblasComplex*     A,
-                                            const int           lda,
-                                            const hipblasStride strideA,
-                                            hipblasComplex*     ipiv,
-                                            const hipblasStride strideP,
-                                            int*                info,
-                                            const int           batch_count)
+hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
-                                            const int             m,
-                                            const int             n,
-                                            hipblasDoubleComplex* A,
-                                            const int             lda,
-                                            const hipblasStride   strideA,
-                                            hipblasDoubleComplex* ipiv,
-                                            const hipblasStride   strideP,
-                                            int*                  info,
-                                            const int             batch_count)
+hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// gels
-hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
-                             hipblasOperation_t trans,
-                             const int          m,
-                             const int          n,
-                             const int          nrhs,
-                             float*             A,
-                             const int          lda,
-                             float*             B,
-                             const int          ldb,
-                             int*               info,
-                             int*               deviceInfo)
+// potrfBatched
+hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
-                             hipblasOperation_t trans,
-                             const int          m,
-                             const int          n,
-                             const int          nrhs,
-                             double*            A,
-                             const int          lda,
-                             double*            B,
-                             const int          ldb,
-                             int*               info,
-                             int*               deviceInfo)
+hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
-                             hipblasOperation_t trans,
-                             const int          m,
-                             const int          n,
-                             const int          nrhs,
-                             hipblasComplex*    A,
-                             const int          lda,
-                             hipblasComplex*    B,
-                             const int          ldb,
-                             int*               info,
-                             int*               deviceInfo)
+hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
-                             hipblasOperation_t    trans,
-                             const int             m,
-                             const int             n,
-                             const int             nrhs,
-                             hipblasDoubleComplex* A,
-                             const int             lda,
-                             hipblasDoubleComplex* B,
-                             const int             ldb,
-                             int*                  info,
-                             int*                  deviceInfo)
-{
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// gelsBatched
-hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
-                                    hipblasOperation_t trans,
-                                    const int          m,
-                                    const int          n,
-                                    const int          nrhs,
-                                    float* const       A[],
-                                    const int          lda,
-                                    float* const       B[],
-                                    const int          ldb,
-                                    int*               info,
-                                    int*               deviceInfo,
-                                    const int          batchCount)
-try
+// potrfStridedBatched
+hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasSgelsBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(trans),
-                                                         m,
-                                                         n,
-                                                         nrhs,
-                                                         A,
-                                                         lda,
-                                                         B,
-                                                         ldb,
-                                                         info,
-                                                         deviceInfo,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
-                                    hipblasOperation_t trans,
-                                    const int          m,
-                                    const int          n,
-                                    const int          nrhs,
-                                    double* const      A[],
-                                    const int          lda,
-                                    double* const      B[],
-                                    const int          ldb,
-                                    int*               info,
-                                    int*               deviceInfo,
-                                    const int          batchCount)
-try
+hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasDgelsBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(trans),
-                                                         m,
-                                                         n,
-                                                         nrhs,
-                                                         A,
-                                                         lda,
-                                                         B,
-                                                         ldb,
-                                                         info,
-                                                         deviceInfo,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
-                                    hipblasOperation_t    trans,
-                                    const int             m,
-                                    const int             n,
-                                    const int             nrhs,
-                                    hipblasComplex* const A[],
-                                    const int             lda,
-                                    hipblasComplex* const B[],
-                                    const int             ldb,
-                                    int*                  info,
-                                    int*                  deviceInfo,
-                                    const int             batchCount)
-try
+// potrs
+hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              float*                  A,
+                              const int               lda,
+                              float*                  B,
+                              const int               ldb,
+                              int*                    info)
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgelsBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(trans),
-                                                         m,
-                                                         n,
-                                                         nrhs,
-                                                         (cuComplex**)A,
-                                                         lda,
-                                                         (cuComplex**)B,
-                                                         ldb,
-                                                         info,
-                                                         deviceInfo,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              double*                 A,
+                              const int               lda,
+                              double*                 B,
+                              const int               ldb,
+                              int*                    info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
-                                    hipblasOperation_t          trans,
-                                    const int                   m,
-                                    const int                   n,
-                                    const int                   nrhs,
-                                    hipblasDoubleComplex* const A[],
-                                    const int                   lda,
-                                    hipblasDoubleComplex* const B[],
-                                    const int                   ldb,
-                                    int*                        info,
-                                    int*                        deviceInfo,
-                                    const int                   batchCount)
-try
+hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              hipblasComplex*         B,
+                              const int               ldb,
+                              int*                    info)
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgelsBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(trans),
-                                                         m,
-                                                         n,
-                                                         nrhs,
-                                                         (cuDoubleComplex**)A,
-                                                         lda,
-                                                         (cuDoubleComplex**)B,
-                                                         ldb,
-                                                         info,
-                                                         deviceInfo,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              hipblasDoubleComplex*   B,
+                              const int               ldb,
+                              int*                    info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// gelsStridedBatched
-hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
-                                           hipblasOperation_t  trans,
-                                           const int           m,
-                                           const int           n,
-                                           const int           nrhs,
-                                           float*              A,
-                                           const int           lda,
-                                           const hipblasStride strideA,
-                                           float*              B,
-                                           const int           ldb,
-                                           const hipblasStride strideB,
-                                           int*                info,
-                                           int*                deviceInfo,
-                                           const int           batchCount)
+// potrsBatched
+hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float* const            A[],
+                                     const int               lda,
+                                     float* const            B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
-                                           hipblasOperation_t  trans,
-                                           const int           m,
-                                           const int           n,
-                                           const int           nrhs,
-                                           double*             A,
-                                           const int           lda,
-                                           const hipblasStride strideA,
-                                           double*             B,
-                                           const int           ldb,
-                                           const hipblasStride strideB,
-                                           int*                info,
-                                           int*                deviceInfo,
-                                           const int           batchCount)
+hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double* const           A[],
+                                     const int               lda,
+                                     double* const           B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
-                                           hipblasOperation_t  trans,
-                                           const int           m,
-                                           const int           n,
-                                           const int           nrhs,
-                                           hipblasComplex*     A,
-                                           const int           lda,
-                                           const hipblasStride strideA,
-                                           hipblasComplex*     B,
-                                           const int           ldb,
-                                           const hipblasStride strideB,
-                                           int*                info,
-                                           int*                deviceInfo,
-                                           const int           batchCount)
+hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     hipblasComplex* const   B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
-                                           hipblasOperation_t    trans,
-                                           const int             m,
-                                           const int             n,
-                                           const int             nrhs,
-                                           hipblasDoubleComplex* A,
-                                           const int             lda,
-                                           const hipblasStride   strideA,
-                                           hipblasDoubleComplex* B,
-                                           const int             ldb,
-                                           const hipblasStride   strideB,
-                                           int*                  info,
-                                           int*                  deviceInfo,
-                                           const int             batchCount)
+hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batch_count)
 {
-    // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-#endif
+// potrsStridedBatched
+hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            float*                  B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
 
-// gemm
-hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const hipblasHalf* alpha,
-                             const hipblasHalf* A,
-                             int                lda,
-                             const hipblasHalf* B,
-                             int                ldb,
-                             const hipblasHalf* beta,
-                             hipblasHalf*       C,
-                             int                ldc)
-try
+hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            double*                 B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasHgemm((cublasHandle_t)handle,
-                                                  hipOperationToCudaOperation(transa),
-                                                  hipOperationToCudaOperation(transb),
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  (__half*)alpha,
-                                                  (__half*)A,
-                                                  lda,
-                                                  (__half*)B,
-                                                  ldb,
-                                                  (__half*)beta,
-                                                  (__half*)C,
-                                                  ldc));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasComplex*         B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const float*       alpha,
-                             const float*       A,
-                             int                lda,
-                             const float*       B,
-                             int                ldb,
-                             const float*       beta,
-                             float*             C,
-                             int                ldc)
-try
+hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasDoubleComplex*   B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasSgemm((cublasHandle_t)handle,
-                                                  hipOperationToCudaOperation(transa),
-                                                  hipOperationToCudaOperation(transb),
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  A,
-                                                  lda,
-                                                  B,
-                                                  ldb,
-                                                  beta,
-                                                  C,
-                                                  ldc));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+// potri
+hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const double*      alpha,
-                             const double*      A,
-                             int                lda,
-                             const double*      B,
-                             int                ldb,
-                             const double*      beta,
-                             double*            C,
-                             int                ldc)
-try
+hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
 {
-    return hipCUBLASStatusToHIPStatus(cublasDgemm((cublasHandle_t)handle,
-                                                  hipOperationToCudaOperation(transa),
-                                                  hipOperationToCudaOperation(transb),
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  A,
-                                                  lda,
-                                                  B,
-                                                  ldb,
-                                                  beta,
-                                                  C,
-                                                  ldc));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
-                             hipblasOperation_t    transa,
-                             hipblasOperation_t    transb,
-                             int                   m,
-                             int                   n,
-                             int                   k,
-                             const hipblasComplex* alpha,
-                             const hipblasComplex* A,
-                             int                   lda,
-                             const hipblasComplex* B,
-                             int                   ldb,
-                             const hipblasComplex* beta,
-                             hipblasComplex*       C,
-                             int                   ldc)
-try
+hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgemm((cublasHandle_t)handle,
-                                                  hipOperationToCudaOperation(transa),
-                                                  hipOperationToCudaOperation(transb),
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  (cuComplex*)alpha,
-                                                  (cuComplex*)A,
-                                                  lda,
-                                                  (cuComplex*)B,
-                                                  ldb,
-                                                  (cuComplex*)beta,
-                                                  (cuComplex*)C,
-                                                  ldc));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+// potriBatched
+hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
-                             hipblasOperation_t          transa,
-                             hipblasOperation_t          transb,
-                             int                         m,
-                             int                         n,
-                             int                         k,
-                             const hipblasDoubleComplex* alpha,
-                             const hipblasDoubleComplex* A,
-                             int                         lda,
-                             const hipblasDoubleComplex* B,
-                             int                         ldb,
-                             const hipblasDoubleComplex* beta,
-                             hipblasDoubleComplex*       C,
-                             int                         ldc)
-try
+hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgemm((cublasHandle_t)handle,
-                                                  hipOperationToCudaOperation(transa),
-                                                  hipOperationToCudaOperation(transb),
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  (cuDoubleComplex*)alpha,
-                                                  (cuDoubleComplex*)A,
-                                                  lda,
-                                                  (cuDoubleComplex*)B,
-                                                  ldb,
-                                                  (cuDoubleComplex*)beta,
-                                                  (cuDoubleComplex*)C,
-                                                  ldc));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// gemm_batched
-hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
-                                    hipblasOperation_t       transa,
-                                    hipblasOperation_t       transb,
-                                    int                      m,
-                                    int                      n,
-                                    int                      k,
-                                    const hipblasHalf*       alpha,
-                                    const hipblasHalf* const A[],
-                                    int                      lda,
-                                    const hipblasHalf* const B[],
-                                    int                      ldb,
-                                    const hipblasHalf*       beta,
-                                    hipblasHalf* const       C[],
-                                    int                      ldc,
-                                    int                      batchCount)
-try
+hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasHgemmBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(transa),
-                                                         hipOperationToCudaOperation(transb),
-                                                         m,
-                                                         n,
-                                                         k,
-                                                         (__half*)alpha,
-                                                         (__half* const*)A,
-                                                         lda,
-                                                         (__half* const*)B,
-                                                         ldb,
-                                                         (__half*)beta,
-                                                         (__half* const*)C,
-                                                         ldc,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+// potriStridedBatched
+hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
-                                    hipblasOperation_t transa,
-                                    hipblasOperation_t transb,
-                                    int                m,
-                                    int                n,
-                                    int                k,
-                                    const float*       alpha,
-                                    const float* const A[],
-                                    int                lda,
-                                    const float* const B[],
-                                    int                ldb,
-                                    const float*       beta,
-                                    float* const       C[],
-                                    int                ldc,
-                                    int                batchCount)
-try
+hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasSgemmBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(transa),
-                                                         hipOperationToCudaOperation(transb),
-                                                         m,
-                                                         n,
-                                                         k,
-                                                         alpha,
-                                                         A,
-                                                         lda,
-                                                         B,
-                                                         ldb,
-                                                         beta,
-                                                         C,
-                                                         ldc,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
-                                    hipblasOperation_t  transa,
-                                    hipblasOperation_t  transb,
-                                    int                 m,
-                                    int                 n,
-                                    int                 k,
-                                    const double*       alpha,
-                                    const double* const A[],
-                                    int                 lda,
-                                    const double* const B[],
-                                    int                 ldb,
-                                    const double*       beta,
-                                    double* const       C[],
-                                    int                 ldc,
-                                    int                 batchCount)
-try
+hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batch_count)
 {
-    return hipCUBLASStatusToHIPStatus(cublasDgemmBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(transa),
-                                                         hipOperationToCudaOperation(transb),
-                                                         m,
-                                                         n,
-                                                         k,
-                                                         alpha,
-                                                         A,
-                                                         lda,
-                                                         B,
-                                                         ldb,
-                                                         beta,
-                                                         C,
-                                                         ldc,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+// geqrf
+hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              float*          A,
+                              const int       lda,
+                              float*          ipiv,
+                              int*            info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
-                                    hipblasOperation_t          transa,
-                                    hipblasOperation_t          transb,
-                                    int                         m,
-                                    int                         n,
-                                    int                         k,
-                                    const hipblasComplex*       alpha,
-                                    const hipblasComplex* const A[],
-                                    int                         lda,
-                                    const hipblasComplex* const B[],
-                                    int                         ldb,
-                                    const hipblasComplex*       beta,
-                                    hipblasComplex* const       C[],
-                                    int                         ldc,
-                                    int                         batchCount)
-try
-{
-    return hipCUBLASStatusToHIPStatus(cublasCgemmBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(transa),
-                                                         hipOperationToCudaOperation(transb),
-                                                         m,
-                                                         n,
-                                                         k,
-                                                         (cuComplex*)alpha,
-                                                         (cuComplex* const*)A,
-                                                         lda,
-                                                         (cuComplex* const*)B,
-                                                         ldb,
-                                                         (cuComplex*)beta,
-                                                         (cuComplex* const*)C,
-                                                         ldc,
-                                                         batchCount));
-}
-catch(...)
+hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              double*         A,
+                              const int       lda,
+                              double*         ipiv,
+                              int*            info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
-                                    hipblasOperation_t                transa,
-                                    hipblasOperation_t                transb,
-                                    int                               m,
-                                    int                               n,
-                                    int                               k,
-                                    const hipblasDoubleComplex*       alpha,
-                                    const hipblasDoubleComplex* const A[],
-                                    int                               lda,
-                                    const hipblasDoubleComplex* const B[],
-                                    int                               ldb,
-                                    const hipblasDoubleComplex*       beta,
-                                    hipblasDoubleComplex* const       C[],
-                                    int                               ldc,
-                                    int                               batchCount)
-try
+hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              hipblasComplex* A,
+                              const int       lda,
+                              hipblasComplex* ipiv,
+                              int*            info)
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgemmBatched((cublasHandle_t)handle,
-                                                         hipOperationToCudaOperation(transa),
-                                                         hipOperationToCudaOperation(transb),
-                                                         m,
-                                                         n,
-                                                         k,
-                                                         (cuDoubleComplex*)alpha,
-                                                         (cuDoubleComplex* const*)A,
-                                                         lda,
-                                                         (cuDoubleComplex* const*)B,
-                                                         ldb,
-                                                         (cuDoubleComplex*)beta,
-                                                         (cuDoubleComplex* const*)C,
-                                                         ldc,
-                                                         batchCount));
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
-catch(...)
+
+hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              int*                  info)
 {
-    return exception_to_hipblas_status();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// gemm_strided_batched
-hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
-                                           hipblasOperation_t transa,
-                                           hipblasOperation_t transb,
-                                           int                m,
-                                           int                n,
-                                           int                k,
-                                           const hipblasHalf* alpha,
-                                           const hipblasHalf* A,
-                                           int                lda,
-                                           long long          bsa,
-                                           const hipblasHalf* B,
-                                           int                ldb,
-                                           long long          bsb,
-                                           const hipblasHalf* beta,
-                                           hipblasHalf*       C,
-                                           int                ldc,
-                                           long long          bsc,
-                                           int                batchCount)
+// geqrf_batched
+hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     float* const    ipiv[],
+                                     int*            info,
+                                     const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasHgemmStridedBatched((cublasHandle_t)handle,
-                                                                hipOperationToCudaOperation(transa),
-                                                                hipOperationToCudaOperation(transb),
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                (__half*)alpha,
-                                                                (__half*)(A),
-                                                                lda,
-                                                                bsa,
-                                                                (__half*)(B),
-                                                                ldb,
-                                                                bsb,
-                                                                (__half*)beta,
-                                                                (__half*)C,
-                                                                ldc,
-                                                                bsc,
-                                                                batchCount));
+    return hipCUBLASStatusToHIPStatus(
+        cublasSgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
-                                           hipblasOperation_t transa,
-                                           hipblasOperation_t transb,
-                                           int                m,
-                                           int                n,
-                                           int                k,
-                                           const float*       alpha,
-                                           const float*       A,
-                                           int                lda,
-                                           long long          bsa,
-                                           const float*       B,
-                                           int                ldb,
-                                           long long          bsb,
-                                           const float*       beta,
-                                           float*             C,
-                                           int                ldc,
-                                           long long          bsc,
-                                           int                batchCount)
+hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     double* const   ipiv[],
+                                     int*            info,
+                                     const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched((cublasHandle_t)handle,
-                                                                hipOperationToCudaOperation(transa),
-                                                                hipOperationToCudaOperation(transb),
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                alpha,
-                                                                const_cast<float*>(A),
-                                                                lda,
-                                                                bsa,
-                                                                const_cast<float*>(B),
-                                                                ldb,
-                                                                bsb,
-                                                                beta,
-                                                                C,
-                                                                ldc,
-                                                                bsc,
-                                                                batchCount));
+    return hipCUBLASStatusToHIPStatus(
+        cublasDgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
-                                           hipblasOperation_t transa,
-                                           hipblasOperation_t transb,
-                                           int                m,
-                                           int                n,
-                                           int                k,
-                                           const double*      alpha,
-                                           const double*      A,
-                                           int                lda,
-                                           long long          bsa,
-                                           const double*      B,
-                                           int                ldb,
-                                           long long          bsb,
-                                           const double*      beta,
-                                           double*            C,
-                                           int                ldc,
-                                           long long          bsc,
-                                           int                batchCount)
+hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
+                                     const int             m,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     int*                  info,
+                                     const int             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched((cublasHandle_t)handle,
-                                                                hipOperationToCudaOperation(transa),
-                                                                hipOperationToCudaOperation(transb),
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                alpha,
-                                                                const_cast<double*>(A),
-                                                                lda,
-                                                                bsa,
-                                                                const_cast<double*>(B),
-                                                                ldb,
-                                                                bsb,
-                                                                beta,
-                                                                C,
-                                                                ldc,
-                                                                bsc,
-                                                                batchCount));
+    return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
+        (cublasHandle_t)handle, m, n, (cuComplex**)A, lda, (cuComplex**)ipiv, info, batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
-                                           hipblasOperation_t    transa,
-                                           hipblasOperation_t    transb,
-                                           int                   m,
-                                           int                   n,
-                                           int                   k,
-                                           const hipblasComplex* alpha,
-                                           const hipblasComplex* A,
-                                           int                   lda,
-                                           long long             bsa,
-                                           const hipblasComplex* B,
-                                           int                   ldb,
-                                           long long             bsb,
-                                           const hipblasComplex* beta,
-                                           hipblasComplex*       C,
-                                           int                   ldc,
-                                           long long             bsc,
-                                           int                   batchCount)
+hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     int*                        info,
+                                     const int                   batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgemmStridedBatched((cublasHandle_t)handle,
-                                                                hipOperationToCudaOperation(transa),
-                                                                hipOperationToCudaOperation(transb),
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                (cuComplex*)alpha,
-                                                                (cuComplex*)(A),
-                                                                lda,
-                                                                bsa,
-                                                                (cuComplex*)(B),
-                                                                ldb,
-                                                                bsb,
-                                                                (cuComplex*)beta,
-                                                                (cuComplex*)C,
-                                                                ldc,
-                                                                bsc,
-                                                                batchCount));
+    return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          (cuDoubleComplex**)A,
+                                                          lda,
+                                                          (cuDoubleComplex**)ipiv,
+                                                          info,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
-                                           hipblasOperation_t          transa,
-                                           hipblasOperation_t          transb,
-                                           int                         m,
-                                           int                         n,
-                                           int                         k,
-                                           const hipblasDoubleComplex* alpha,
+// geqrf_strided_batched
+hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batch_count)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// gels
+hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             float*             A,
+                             const int          lda,
+                             float*             B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+{
+    // only batched variants of gels are supported in cuBLAS
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             double*            A,
+                             const int          lda,
+                             double*            B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             hipblasComplex*    A,
+                             const int          lda,
+                             hipblasComplex*    B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
+                             hipblasOperation_t    trans,
+                             const int             m,
+                             const int             n,
+                             const int             nrhs,
+                             hipblasDoubleComplex* A,
+                             const int             lda,
+                             hipblasDoubleComplex* B,
+                             const int             ldb,
+                             int*                  info,
+                             int*                  deviceInfo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// gelsBatched
+hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    float* const       A[],
+                                    const int          lda,
+                                    float* const       B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGelsBatchedSplit(hipblasSgelsBatched,
+                                       handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       B,
+                                       ldb,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+
+    return hipCUBLASStatusToHIPStatus(cublasSgelsBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(trans),
+                                                         m,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         info,
+                                                         deviceInfo,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    double* const      A[],
+                                    const int          lda,
+                                    double* const      B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGelsBatchedSplit(hipblasDgelsBatched,
+                                       handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       B,
+                                       ldb,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+
+    return hipCUBLASStatusToHIPStatus(cublasDgelsBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(trans),
+                                                         m,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         info,
+                                                         deviceInfo,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
+                                    hipblasOperation_t    trans,
+                                    const int             m,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    int*                  deviceInfo,
+                                    const int             batchCount)
+try
+{
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGelsBatchedSplit(hipblasCgelsBatched,
+                                       handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       B,
+                                       ldb,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+
+    return hipCUBLASStatusToHIPStatus(cublasCgelsBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(trans),
+                                                         m,
+                                                         n,
+                                                         nrhs,
+                                                         (cuComplex**)A,
+                                                         lda,
+                                                         (cuComplex**)B,
+                                                         ldb,
+                                                         info,
+                                                         deviceInfo,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          trans,
+                                    const int                   m,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    int*                        deviceInfo,
+                                    const int                   batchCount)
+try
+{
+    if(hipblasIsBatchSplit(handle))
+        return hipblasGelsBatchedSplit(hipblasZgelsBatched,
+                                       handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       B,
+                                       ldb,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+
+    return hipCUBLASStatusToHIPStatus(cublasZgelsBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(trans),
+                                                         m,
+                                                         n,
+                                                         nrhs,
+                                                         (cuDoubleComplex**)A,
+                                                         lda,
+                                                         (cuDoubleComplex**)B,
+                                                         ldb,
+                                                         info,
+                                                         deviceInfo,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gelsStridedBatched
+hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+{
+    // only batched variants of gels are supported in cuBLAS
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+{
+    // only batched variants of gels are supported in cuBLAS
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+{
+    // only batched variants of gels are supported in cuBLAS
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    trans,
+                                           const int             m,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           int*                  deviceInfo,
+                                           const int             batchCount)
+{
+    // only batched variants of gels are supported in cuBLAS
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#endif
+
+// gemm
+hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const hipblasHalf* alpha,
+                             const hipblasHalf* A,
+                             int                lda,
+                             const hipblasHalf* B,
+                             int                ldb,
+                             const hipblasHalf* beta,
+                             hipblasHalf*       C,
+                             int                ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasHgemm((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  (__half*)alpha,
+                                                  (__half*)A,
+                                                  lda,
+                                                  (__half*)B,
+                                                  ldb,
+                                                  (__half*)beta,
+                                                  (__half*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       B,
+                             int                ldb,
+                             const float*       beta,
+                             float*             C,
+                             int                ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasSgemm((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  beta,
+                                                  C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      B,
+                             int                ldb,
+                             const double*      beta,
+                             double*            C,
+                             int                ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasDgemm((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  beta,
+                                                  C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
+                             hipblasOperation_t    transa,
+                             hipblasOperation_t    transb,
+                             int                   m,
+                             int                   n,
+                             int                   k,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const hipblasComplex* B,
+                             int                   ldb,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+try
+{
+    auto gemm = hipblasIsComplexGemm3m(handle) ? cublasCgemm3m : cublasCgemm;
+    return hipCUBLASStatusToHIPStatus(gemm((cublasHandle_t)handle,
+                                           hipOperationToCudaOperation(transa),
+                                           hipOperationToCudaOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           (cuComplex*)alpha,
+                                           (cuComplex*)A,
+                                           lda,
+                                           (cuComplex*)B,
+                                           ldb,
+                                           (cuComplex*)beta,
+                                           (cuComplex*)C,
+                                           ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
+                             hipblasOperation_t          transa,
+                             hipblasOperation_t          transb,
+                             int                         m,
+                             int                         n,
+                             int                         k,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const hipblasDoubleComplex* B,
+                             int                         ldb,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
+try
+{
+    auto gemm = hipblasIsComplexGemm3m(handle) ? cublasZgemm3m : cublasZgemm;
+    return hipCUBLASStatusToHIPStatus(gemm((cublasHandle_t)handle,
+                                           hipOperationToCudaOperation(transa),
+                                           hipOperationToCudaOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           (cuDoubleComplex*)alpha,
+                                           (cuDoubleComplex*)A,
+                                           lda,
+                                           (cuDoubleComplex*)B,
+                                           ldb,
+                                           (cuDoubleComplex*)beta,
+                                           (cuDoubleComplex*)C,
+                                           ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm_batched
+hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
+                                    hipblasOperation_t       transa,
+                                    hipblasOperation_t       transb,
+                                    int                      m,
+                                    int                      n,
+                                    int                      k,
+                                    const hipblasHalf*       alpha,
+                                    const hipblasHalf* const A[],
+                                    int                      lda,
+                                    const hipblasHalf* const B[],
+                                    int                      ldb,
+                                    const hipblasHalf*       beta,
+                                    hipblasHalf* const       C[],
+                                    int                      ldc,
+                                    int                      batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasHgemmBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(transa),
+                                                         hipOperationToCudaOperation(transb),
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         (__half*)alpha,
+                                                         (__half* const*)A,
+                                                         lda,
+                                                         (__half* const*)B,
+                                                         ldb,
+                                                         (__half*)beta,
+                                                         (__half* const*)C,
+                                                         ldc,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const float*       alpha,
+                                    const float* const A[],
+                                    int                lda,
+                                    const float* const B[],
+                                    int                ldb,
+                                    const float*       beta,
+                                    float* const       C[],
+                                    int                ldc,
+                                    int                batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasSgemmBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(transa),
+                                                         hipOperationToCudaOperation(transb),
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
+                                    hipblasOperation_t  transa,
+                                    hipblasOperation_t  transb,
+                                    int                 m,
+                                    int                 n,
+                                    int                 k,
+                                    const double*       alpha,
+                                    const double* const A[],
+                                    int                 lda,
+                                    const double* const B[],
+                                    int                 ldb,
+                                    const double*       beta,
+                                    double* const       C[],
+                                    int                 ldc,
+                                    int                 batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasDgemmBatched((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(transa),
+                                                         hipOperationToCudaOperation(transb),
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transa,
+                                    hipblasOperation_t          transb,
+                                    int                         m,
+                                    int                         n,
+                                    int                         k,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const A[],
+                                    int                         lda,
+                                    const hipblasComplex* const B[],
+                                    int                         ldb,
+                                    const hipblasComplex*       beta,
+                                    hipblasComplex* const       C[],
+                                    int                         ldc,
+                                    int                         batchCount)
+try
+{
+    auto gemm = hipblasIsComplexGemm3m(handle) ? cublasCgemm3mBatched : cublasCgemmBatched;
+    return hipCUBLASStatusToHIPStatus(gemm((cublasHandle_t)handle,
+                                           hipOperationToCudaOperation(transa),
+                                           hipOperationToCudaOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           (cuComplex*)alpha,
+                                           (cuComplex* const*)A,
+                                           lda,
+                                           (cuComplex* const*)B,
+                                           ldb,
+                                           (cuComplex*)beta,
+                                           (cuComplex* const*)C,
+                                           ldc,
+                                           batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
+                                    hipblasOperation_t                transa,
+                                    hipblasOperation_t                transb,
+                                    int                               m,
+                                    int                               n,
+                                    int                               k,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const A[],
+                                    int                               lda,
+                                    const hipblasDoubleComplex* const B[],
+                                    int                               ldb,
+                                    const hipblasDoubleComplex*       beta,
+                                    hipblasDoubleComplex* const       C[],
+                                    int                               ldc,
+                                    int                               batchCount)
+try
+{
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZgemmBatched((cublasHandle_t)handle,
+                                                             hipOperationToCudaOperation(transa),
+                                                             hipOperationToCudaOperation(transb),
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             (cuDoubleComplex*)alpha,
+                                                             (cuDoubleComplex* const*)A,
+                                                             lda,
+                                                             (cuDoubleComplex* const*)B,
+                                                             ldb,
+                                                             (cuDoubleComplex*)beta,
+                                                             (cuDoubleComplex* const*)C,
+                                                             ldc,
+                                                             batchCount));
+    };
+    return hipblasGemm3mBatched(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount, direct);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm_strided_batched
+hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const hipblasHalf* alpha,
+                                           const hipblasHalf* A,
+                                           int                lda,
+                                           long long          bsa,
+                                           const hipblasHalf* B,
+                                           int                ldb,
+                                           long long          bsb,
+                                           const hipblasHalf* beta,
+                                           hipblasHalf*       C,
+                                           int                ldc,
+                                           long long          bsc,
+                                           int                batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasHgemmStridedBatched((cublasHandle_t)handle,
+                                                                hipOperationToCudaOperation(transa),
+                                                                hipOperationToCudaOperation(transb),
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                (__half*)alpha,
+                                                                (__half*)(A),
+                                                                lda,
+                                                                bsa,
+                                                                (__half*)(B),
+                                                                ldb,
+                                                                bsb,
+                                                                (__half*)beta,
+                                                                (__half*)C,
+                                                                ldc,
+                                                                bsc,
+                                                                batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const float*       alpha,
+                                           const float*       A,
+                                           int                lda,
+                                           long long          bsa,
+                                           const float*       B,
+                                           int                ldb,
+                                           long long          bsb,
+                                           const float*       beta,
+                                           float*             C,
+                                           int                ldc,
+                                           long long          bsc,
+                                           int                batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched((cublasHandle_t)handle,
+                                                                hipOperationToCudaOperation(transa),
+                                                                hipOperationToCudaOperation(transb),
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                alpha,
+                                                                const_cast<float*>(A),
+                                                                lda,
+                                                                bsa,
+                                                                const_cast<float*>(B),
+                                                                ldb,
+                                                                bsb,
+                                                                beta,
+                                                                C,
+                                                                ldc,
+                                                                bsc,
+                                                                batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const double*      alpha,
+                                           const double*      A,
+                                           int                lda,
+                                           long long          bsa,
+                                           const double*      B,
+                                           int                ldb,
+                                           long long          bsb,
+                                           const double*      beta,
+                                           double*            C,
+                                           int                ldc,
+                                           long long          bsc,
+                                           int                batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched((cublasHandle_t)handle,
+                                                                hipOperationToCudaOperation(transa),
+                                                                hipOperationToCudaOperation(transb),
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                alpha,
+                                                                const_cast<double*>(A),
+                                                                lda,
+                                                                bsa,
+                                                                const_cast<double*>(B),
+                                                                ldb,
+                                                                bsb,
+                                                                beta,
+                                                                C,
+                                                                ldc,
+                                                                bsc,
+                                                                batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    transa,
+                                           hipblasOperation_t    transb,
+                                           int                   m,
+                                           int                   n,
+                                           int                   k,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* A,
+                                           int                   lda,
+                                           long long             bsa,
+                                           const hipblasComplex* B,
+                                           int                   ldb,
+                                           long long             bsb,
+                                           const hipblasComplex* beta,
+                                           hipblasComplex*       C,
+                                           int                   ldc,
+                                           long long             bsc,
+                                           int                   batchCount)
+try
+{
+    auto gemm = hipblasIsComplexGemm3m(handle) ? cublasCgemm3mStridedBatched
+                                               : cublasCgemmStridedBatched;
+    return hipCUBLASStatusToHIPStatus(gemm((cublasHandle_t)handle,
+                                           hipOperationToCudaOperation(transa),
+                                           hipOperationToCudaOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           (cuComplex*)alpha,
+                                           (cuComplex*)(A),
+                                           lda,
+                                           bsa,
+                                           (cuComplex*)(B),
+                                           ldb,
+                                           bsb,
+                                           (cuComplex*)beta,
+                                           (cuComplex*)C,
+                                           ldc,
+                                           bsc,
+                                           batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transa,
+                                           hipblasOperation_t          transb,
+                                           int                         m,
+                                           int                         n,
+                                           int                         k,
+                                           const hipblasDoubleComplex* alpha,
                                            const hipblasDoubleComplex* A,
                                            int                         lda,
                                            long long                   bsa,
@@ -11742,21 +13003,8844 @@ hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgemmStridedBatched((cublasHandle_t)handle,
+    auto direct = [&] {
+        return hipCUBLASStatusToHIPStatus(
+            cublasZgemmStridedBatched((cublasHandle_t)handle,
+                                      hipOperationToCudaOperation(transa),
+                                      hipOperationToCudaOperation(transb),
+                                      m,
+                                      n,
+                                      k,
+                                      (cuDoubleComplex*)alpha,
+                                      (cuDoubleComplex*)(A),
+                                      lda,
+                                      bsa,
+                                      (cuDoubleComplex*)(B),
+                                      ldb,
+                                      bsb,
+                                      (cuDoubleComplex*)beta,
+                                      (cuDoubleComplex*)C,
+                                      ldc,
+                                      bsc,
+                                      batchCount));
+    };
+    return hipblasGemm3mStridedBatched(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       bsa,
+                                       B,
+                                       ldb,
+                                       bsb,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       bsc,
+                                       batchCount,
+                                       direct);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// The epilogue of a cublasLt gemm, with the pointers it reads and writes
+struct hipblasGemmLtEpilogue
+{
+    cublasLtEpilogue_t epilogue = CUBLASLT_EPILOGUE_DEFAULT;
+    const void*        bias     = nullptr;
+    void*              aux      = nullptr;
+    int64_t            ldaux    = 0;
+};
+
+namespace
+{
+    // As many plans as a model's distinct gemm shapes typically take
+    constexpr size_t gemm_lt_max_plans = 64;
+
+    // The workspace cuBLAS itself defaults to on recent devices
+    constexpr size_t gemm_lt_workspace_bytes = size_t(32) << 20;
+
+    void destroy_gemm_lt_plan(hipblasGemmLtCache::Plan& plan)
+    {
+        if(plan.d)
+            cublasLtMatrixLayoutDestroy(plan.d);
+        if(plan.c)
+            cublasLtMatrixLayoutDestroy(plan.c);
+        if(plan.b)
+            cublasLtMatrixLayoutDestroy(plan.b);
+        if(plan.a)
+            cublasLtMatrixLayoutDestroy(plan.a);
+        if(plan.desc)
+            cublasLtMatmulDescDestroy(plan.desc);
+    }
+
+    // The alignment of a pointer the heuristic may assume, up to the 256 bytes of hipMalloc
+    uint32_t gemm_lt_alignment(const void* ptr)
+    {
+        uintptr_t address   = reinterpret_cast<uintptr_t>(ptr);
+        uint32_t  alignment = 256;
+        while(address % alignment)
+            alignment /= 2;
+        return alignment;
+    }
+
+    // The compute type cublasGemmEx would use for the key in its math mode: TF32 tensor ops for
+    // float inputs computed in CUBLAS_COMPUTE_32F, and the pedantic compute types in
+    // CUBLAS_PEDANTIC_MATH
+    cublasComputeType_t gemm_lt_compute_type(const hipblasGemmLtCache::Key& key)
+    {
+        int  math      = key.math_mode & ~CUBLAS_MATH_DISALLOW_REDUCED_PRECISION_REDUCTION;
+        bool float_ins = (key.a_type == CUDA_R_32F || key.a_type == CUDA_C_32F)
+                         && (key.b_type == CUDA_R_32F || key.b_type == CUDA_C_32F);
+
+        if(math == CUBLAS_TF32_TENSOR_OP_MATH && key.compute_type == CUBLAS_COMPUTE_32F
+           && float_ins)
+            return CUBLAS_COMPUTE_32F_FAST_TF32;
+
+        if(math == CUBLAS_PEDANTIC_MATH)
+        {
+            switch(key.compute_type)
+            {
+            case CUBLAS_COMPUTE_16F:
+                return CUBLAS_COMPUTE_16F_PEDANTIC;
+            case CUBLAS_COMPUTE_32F:
+                return CUBLAS_COMPUTE_32F_PEDANTIC;
+            case CUBLAS_COMPUTE_64F:
+                return CUBLAS_COMPUTE_64F_PEDANTIC;
+            case CUBLAS_COMPUTE_32I:
+                return CUBLAS_COMPUTE_32I_PEDANTIC;
+            default:
+                break;
+            }
+        }
+        return key.compute_type;
+    }
+
+    void create_gemm_lt_plan(cublasLtHandle_t          lt,
+                             hipblasGemmLtCache::Plan& plan,
+                             size_t                    max_workspace)
+    {
+        const hipblasGemmLtCache::Key& key = plan.key;
+
+        auto ok = [](cublasStatus_t status) { return status == CUBLAS_STATUS_SUCCESS; };
+
+        int32_t  transa       = key.transa;
+        int32_t  transb       = key.transb;
+        int32_t  pointer_mode = key.pointer_mode == CUBLAS_POINTER_MODE_DEVICE
+                                    ? CUBLASLT_POINTER_MODE_DEVICE
+                                    : CUBLASLT_POINTER_MODE_HOST;
+        uint64_t a_rows       = key.transa == CUBLAS_OP_N ? key.m : key.k;
+        uint64_t a_cols       = key.transa == CUBLAS_OP_N ? key.k : key.m;
+        uint64_t b_rows       = key.transb == CUBLAS_OP_N ? key.k : key.n;
+        uint64_t b_cols       = key.transb == CUBLAS_OP_N ? key.n : key.k;
+        uint64_t workspace    = max_workspace;
+        uint32_t epilogue     = key.epilogue;
+
+        // Split-k reductions in the output type are of reduced precision, which the math mode
+        // may disallow
+        uint32_t reduction = key.math_mode & CUBLAS_MATH_DISALLOW_REDUCED_PRECISION_REDUCTION
+                                 ? CUBLASLT_REDUCTION_SCHEME_MASK
+                                       & ~CUBLASLT_REDUCTION_SCHEME_OUTPUT_TYPE
+                                 : CUBLASLT_REDUCTION_SCHEME_MASK;
+
+        cublasLtMatmulPreference_t      preference = nullptr;
+        cublasLtMatmulHeuristicResult_t result     = {};
+        int                             count      = 0;
+
+        // A batch of matrices at a constant stride, D at that of C
+        auto batch = [&](cublasLtMatrixLayout_t layout, int64_t stride) {
+            auto set = [&](cublasLtMatrixLayoutAttribute_t attr, const void* value, size_t size) {
+                return ok(cublasLtMatrixLayoutSetAttribute(layout, attr, value, size));
+            };
+            return set(CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &key.batch_count, sizeof(int))
+                   && set(CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+        };
+
+        auto prefer = [&](cublasLtMatmulPreferenceAttributes_t attribute, const uint32_t& value) {
+            return ok(
+                cublasLtMatmulPreferenceSetAttribute(preference, attribute, &value, sizeof(value)));
+        };
+
+        bool created
+            = ok(cublasLtMatmulDescCreate(&plan.desc, gemm_lt_compute_type(key), key.scale_type))
+              && ok(cublasLtMatmulDescSetAttribute(
+                  plan.desc, CUBLASLT_MATMUL_DESC_TRANSA, &transa, sizeof(transa)))
+              && ok(cublasLtMatmulDescSetAttribute(
+                  plan.desc, CUBLASLT_MATMUL_DESC_TRANSB, &transb, sizeof(transb)))
+              && ok(cublasLtMatmulDescSetAttribute(plan.desc,
+                                                   CUBLASLT_MATMUL_DESC_POINTER_MODE,
+                                                   &pointer_mode,
+                                                   sizeof(pointer_mode)))
+              && ok(cublasLtMatmulDescSetAttribute(
+                  plan.desc, CUBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue)))
+              && (!key.ldaux
+                  || ok(cublasLtMatmulDescSetAttribute(plan.desc,
+                                                       CUBLASLT_MATMUL_DESC_EPILOGUE_AUX_LD,
+                                                       &key.ldaux,
+                                                       sizeof(key.ldaux))))
+              && ok(cublasLtMatrixLayoutCreate(&plan.a, key.a_type, a_rows, a_cols, key.lda))
+              && ok(cublasLtMatrixLayoutCreate(&plan.b, key.b_type, b_rows, b_cols, key.ldb))
+              && ok(cublasLtMatrixLayoutCreate(&plan.c, key.c_type, key.m, key.n, key.ldc))
+              && ok(cublasLtMatrixLayoutCreate(&plan.d, key.d_type, key.m, key.n, key.ldd))
+              && (key.batch_count == 1
+                  || (batch(plan.a, key.stride_a) && batch(plan.b, key.stride_b)
+                      && batch(plan.c, key.stride_c) && batch(plan.d, key.stride_c)))
+              && ok(cublasLtMatmulPreferenceCreate(&preference))
+              && ok(cublasLtMatmulPreferenceSetAttribute(preference,
+                                                         CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                         &workspace,
+                                                         sizeof(workspace)))
+              && prefer(CUBLASLT_MATMUL_PREF_REDUCTION_SCHEME_MASK, reduction)
+              && prefer(CUBLASLT_MATMUL_PREF_MIN_ALIGNMENT_A_BYTES, key.a_alignment)
+              && prefer(CUBLASLT_MATMUL_PREF_MIN_ALIGNMENT_B_BYTES, key.b_alignment)
+              && prefer(CUBLASLT_MATMUL_PREF_MIN_ALIGNMENT_C_BYTES, key.c_alignment)
+              && prefer(CUBLASLT_MATMUL_PREF_MIN_ALIGNMENT_D_BYTES, key.d_alignment)
+              && ok(cublasLtMatmulAlgoGetHeuristic(
+                  lt, plan.desc, plan.a, plan.b, plan.c, plan.d, preference, 1, &result, &count));
+
+        plan.found          = created && count > 0;
+        plan.algo           = result.algo;
+        plan.workspace_size = result.workspaceSize;
+        plan.max_workspace  = max_workspace;
+
+        if(preference)
+            cublasLtMatmulPreferenceDestroy(preference);
+    }
+}
+
+hipblasGemmLtCache::~hipblasGemmLtCache()
+{
+    for(Plan& plan : plans)
+        destroy_gemm_lt_plan(plan);
+    if(lt)
+        cublasLtDestroy(lt);
+    (void)hipFree(workspace);
+}
+
+// Computes gemm_ex with cublasLtMatmul, with the plan cached by the handle for the call, into D,
+// which may be C, and applies the epilogue. A batch of batch_count gemms is at the given strides,
+// D at that of C, and the FP8 scales of A and B are device pointers, nullptr for 1. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED for calls left to cublasGemmEx: those with invalid arguments or a
+// quick return, which it reports as usual, those cublasLt has no algorithm for and those
+// cublasLtMatmul fails, whose plan is then not used again.
+hipblasStatus_t hipblasGemmExLt(hipblasHandle_t              handle,
+                                cublasOperation_t            transa,
+                                cublasOperation_t            transb,
+                                int                          m,
+                                int                          n,
+                                int                          k,
+                                const void*                  alpha,
+                                const void*                  A,
+                                cudaDataType_t               a_type,
+                                int                          lda,
+                                const void*                  B,
+                                cudaDataType_t               b_type,
+                                int                          ldb,
+                                const void*                  beta,
+                                const void*                  C,
+                                cudaDataType_t               c_type,
+                                int                          ldc,
+                                void*                        D,
+                                cudaDataType_t               d_type,
+                                int                          ldd,
+                                cublasComputeType_t          compute_type,
+                                cudaDataType_t               scale_type,
+                                const hipblasGemmLtEpilogue& epilogue    = {},
+                                int                          batch_count = 1,
+                                int64_t                      stride_a    = 0,
+                                int64_t                      stride_b    = 0,
+                                int64_t                      stride_c    = 0,
+                                const float*                 scale_a     = nullptr,
+                                const float*                 scale_b     = nullptr)
+{
+    int a_rows = transa == CUBLAS_OP_N ? m : k;
+    int b_rows = transb == CUBLAS_OP_N ? k : n;
+    if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || lda < a_rows || ldb < b_rows || ldc < m
+       || ldd < m || !alpha || !beta || !A || !B || !C || !D)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    cublasPointerMode_t pointer_mode;
+    cublasMath_t        math_mode;
+    cudaStream_t        stream;
+    if(cublasGetPointerMode((cublasHandle_t)handle, &pointer_mode) != CUBLAS_STATUS_SUCCESS
+       || cublasGetMathMode((cublasHandle_t)handle, &math_mode) != CUBLAS_STATUS_SUCCESS
+       || cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    hipblasGemmLtCache* cache;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if(!state->gemm_lt_cache)
+            state->gemm_lt_cache = new hipblasGemmLtCache;
+        cache = state->gemm_lt_cache;
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    if(!cache->lt && cublasLtCreate(&cache->lt) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The workspace is allocated on first use, unless that would be recorded into a capture; the
+    // calls planned without it run with none
+    if(!cache->workspace && !hipblasStreamIsCapturing(handle) && !hipblasIsCaptureSafe(handle)
+       && hipMalloc(&cache->workspace, gemm_lt_workspace_bytes) == hipSuccess)
+        cache->workspace_size = gemm_lt_workspace_bytes;
+
+    hipblasGemmLtCache::Key key = {transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   lda,
+                                   ldb,
+                                   ldc,
+                                   a_type,
+                                   b_type,
+                                   c_type,
+                                   d_type,
+                                   ldd,
+                                   compute_type,
+                                   scale_type,
+                                   pointer_mode,
+                                   math_mode,
+                                   epilogue.epilogue,
+                                   epilogue.aux ? epilogue.ldaux : 0,
+                                   gemm_lt_alignment(A),
+                                   gemm_lt_alignment(B),
+                                   gemm_lt_alignment(C),
+                                   gemm_lt_alignment(D),
+                                   batch_count,
+                                   batch_count == 1 ? 0 : stride_a,
+                                   batch_count == 1 ? 0 : stride_b,
+                                   batch_count == 1 ? 0 : stride_c};
+
+    auto plan = std::find_if(cache->plans.begin(),
+                             cache->plans.end(),
+                             [&](const hipblasGemmLtCache::Plan& p) { return p.key == key; });
+
+    // Planned again once there is more workspace than the plan was chosen with
+    if(plan != cache->plans.end() && plan->max_workspace < cache->workspace_size)
+    {
+        destroy_gemm_lt_plan(*plan);
+        cache->plans.erase(plan);
+        plan = cache->plans.end();
+    }
+
+    if(plan == cache->plans.end())
+    {
+        cache->plans.emplace_front();
+        plan      = cache->plans.begin();
+        plan->key = key;
+        create_gemm_lt_plan(cache->lt, *plan, cache->workspace_size);
+
+        if(cache->plans.size() > gemm_lt_max_plans)
+        {
+            destroy_gemm_lt_plan(cache->plans.back());
+            cache->plans.pop_back();
+        }
+    }
+    else
+        cache->plans.splice(cache->plans.begin(), cache->plans, plan);
+
+    if(!plan->found)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The pointers of the epilogue and the scales are set on the plan's descriptor for each call
+    bool fp8 = false;
+#ifdef HIPBLAS_CUBLASLT_FP8
+    fp8 = a_type == CUDA_R_8F_E4M3 || a_type == CUDA_R_8F_E5M2;
+#endif
+    if((fp8
+        && (cublasLtMatmulDescSetAttribute(plan->desc,
+                                           CUBLASLT_MATMUL_DESC_A_SCALE_POINTER,
+                                           &scale_a,
+                                           sizeof(scale_a))
+                != CUBLAS_STATUS_SUCCESS
+            || cublasLtMatmulDescSetAttribute(plan->desc,
+                                              CUBLASLT_MATMUL_DESC_B_SCALE_POINTER,
+                                              &scale_b,
+                                              sizeof(scale_b))
+                   != CUBLAS_STATUS_SUCCESS))
+       || (!fp8 && (scale_a || scale_b)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if((epilogue.bias
+        && cublasLtMatmulDescSetAttribute(plan->desc,
+                                          CUBLASLT_MATMUL_DESC_BIAS_POINTER,
+                                          &epilogue.bias,
+                                          sizeof(epilogue.bias))
+               != CUBLAS_STATUS_SUCCESS)
+       || (epilogue.aux
+           && cublasLtMatmulDescSetAttribute(plan->desc,
+                                             CUBLASLT_MATMUL_DESC_EPILOGUE_AUX_POINTER,
+                                             &epilogue.aux,
+                                             sizeof(epilogue.aux))
+                  != CUBLAS_STATUS_SUCCESS))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(cublasLtMatmul(cache->lt,
+                      plan->desc,
+                      alpha,
+                      A,
+                      plan->a,
+                      B,
+                      plan->b,
+                      beta,
+                      C,
+                      plan->c,
+                      D,
+                      plan->d,
+                      &plan->algo,
+                      cache->workspace,
+                      plan->workspace_size,
+                      stream)
+       != CUBLAS_STATUS_SUCCESS)
+    {
+        plan->found = false;
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The compute and scale types of cublasLt for the compute type of hipblasGemmEx, whose scalars
+// are of its compute type. Returns false for compute types cublasLt does not compute in.
+bool HIPDatatypeToCudaLtComputetype(hipblasDatatype_t    type,
+                                    cublasComputeType_t* compute_type,
+                                    cudaDataType_t*      scale_type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        *compute_type = CUBLAS_COMPUTE_16F;
+        break;
+
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        *compute_type = CUBLAS_COMPUTE_32F;
+        break;
+
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        *compute_type = CUBLAS_COMPUTE_64F;
+        break;
+
+    case HIPBLAS_R_32I:
+        *compute_type = CUBLAS_COMPUTE_32I;
+        break;
+
+    default:
+        return false;
+    }
+    *scale_type = HIPDatatypeToCudaDatatype(type);
+    return true;
+}
+
+// The scale type of cublasLt for the compute type of hipblasGemmEx_v2, as cublasGemmEx takes it
+cudaDataType_t CudaLtScaletype(cublasComputeType_t compute_type, cudaDataType_t c_type)
+{
+    bool complex = c_type == CUDA_C_16F || c_type == CUDA_C_16BF || c_type == CUDA_C_32F
+                   || c_type == CUDA_C_64F;
+
+    switch(compute_type)
+    {
+    case CUBLAS_COMPUTE_16F:
+    case CUBLAS_COMPUTE_16F_PEDANTIC:
+        return CUDA_R_16F;
+
+    case CUBLAS_COMPUTE_64F:
+    case CUBLAS_COMPUTE_64F_PEDANTIC:
+        return complex ? CUDA_C_64F : CUDA_R_64F;
+
+    case CUBLAS_COMPUTE_32I:
+    case CUBLAS_COMPUTE_32I_PEDANTIC:
+        return CUDA_R_32I;
+
+    default:
+        return complex ? CUDA_C_32F : CUDA_R_32F;
+    }
+}
+
+// gemmEx with an epilogue, applied by cublasLt: see gemm_epilogue.hpp. The values before a ReLU
+// are written to aux by a cublasLt gemm of their own, as cublasLt keeps only a bitmask of them.
+hipblasStatus_t hipblasGemmExEpilogueBackend(hipblasHandle_t              handle,
+                                             hipblasOperation_t           transA,
+                                             hipblasOperation_t           transB,
+                                             int                          m,
+                                             int                          n,
+                                             int                          k,
+                                             const void*                  alpha,
+                                             const void*                  A,
+                                             hipDataType                  aType,
+                                             int                          lda,
+                                             const void*                  B,
+                                             hipDataType                  bType,
+                                             int                          ldb,
+                                             const void*                  beta,
+                                             void*                        C,
+                                             hipDataType                  cType,
+                                             int                          ldc,
+                                             hipblasComputeType_t         computeType,
+                                             hipblasGemmAlgo_t            algo,
+                                             const hipblasGemmEpilogue_t& epilogue)
+try
+{
+    // Those without an activation are applied by further gemms when cublasLt cannot take them
+    auto gemms = [&]() {
+        return hipblasGemmExEpilogueBlas(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         aType,
+                                         lda,
+                                         B,
+                                         bType,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         cType,
+                                         ldc,
+                                         computeType,
+                                         algo,
+                                         epilogue);
+    };
+
+    bool activation = epilogue.activation != HIPBLAS_ACTIVATION_NONE;
+    if(hipblasIsFp8Datatype(aType) || hipblasIsFp8Datatype(bType))
+        return activation ? HIPBLAS_STATUS_NOT_SUPPORTED : gemms();
+
+    cublasOperation_t   transa       = hipOperationToCudaOperation(transA);
+    cublasOperation_t   transb       = hipOperationToCudaOperation(transB);
+    cudaDataType_t      a_type       = HIPDatatypeToCudaDatatype_v2(aType);
+    cudaDataType_t      b_type       = HIPDatatypeToCudaDatatype_v2(bType);
+    cudaDataType_t      c_type       = HIPDatatypeToCudaDatatype_v2(cType);
+    cublasComputeType_t compute_type = HIPComputetypeToCudaComputetype(computeType);
+    cudaDataType_t      scale_type   = CudaLtScaletype(compute_type, c_type);
+
+    bool                  bias = epilogue.bias != nullptr;
+    hipblasGemmLtEpilogue lt_epilogue;
+    lt_epilogue.bias = epilogue.bias;
+    switch(epilogue.activation)
+    {
+    case HIPBLAS_ACTIVATION_RELU:
+        lt_epilogue.epilogue = bias ? CUBLASLT_EPILOGUE_RELU_BIAS : CUBLASLT_EPILOGUE_RELU;
+        break;
+
+    case HIPBLAS_ACTIVATION_GELU:
+        if(epilogue.aux)
+        {
+            lt_epilogue.aux   = epilogue.aux;
+            lt_epilogue.ldaux = epilogue.ldaux;
+            lt_epilogue.epilogue
+                = bias ? CUBLASLT_EPILOGUE_GELU_AUX_BIAS : CUBLASLT_EPILOGUE_GELU_AUX;
+        }
+        else
+            lt_epilogue.epilogue = bias ? CUBLASLT_EPILOGUE_GELU_BIAS : CUBLASLT_EPILOGUE_GELU;
+        break;
+
+    default:
+        lt_epilogue.epilogue = bias ? CUBLASLT_EPILOGUE_BIAS : CUBLASLT_EPILOGUE_DEFAULT;
+        break;
+    }
+
+    // The scale is folded into alpha and beta when it commutes with the epilogue: with no bias,
+    // no aux, and no activation or a ReLU by a scale which is not negative
+    bool commutes = !bias && !epilogue.aux
+                    && (!activation
+                        || (epilogue.activation == HIPBLAS_ACTIVATION_RELU && epilogue.scale >= 0));
+    hipblasGemmEpilogueScale scaled(
+        handle, computeType, alpha, beta, commutes ? epilogue.scale : 1.0);
+    bool folded = commutes && scaled.folded();
+
+    auto matmul = [&](void* D, int ldd, const hipblasGemmLtEpilogue& lt) {
+        return hipblasGemmExLt(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               folded ? scaled.alpha() : alpha,
+                               A,
+                               a_type,
+                               lda,
+                               B,
+                               b_type,
+                               ldb,
+                               folded ? scaled.beta() : beta,
+                               C,
+                               c_type,
+                               ldc,
+                               D,
+                               c_type,
+                               ldd,
+                               compute_type,
+                               scale_type,
+                               lt);
+    };
+
+    if(epilogue.activation == HIPBLAS_ACTIVATION_RELU && epilogue.aux)
+    {
+        hipblasGemmLtEpilogue values;
+        values.epilogue = bias ? CUBLASLT_EPILOGUE_BIAS : CUBLASLT_EPILOGUE_DEFAULT;
+        values.bias     = epilogue.bias;
+
+        hipblasStatus_t status = matmul(epilogue.aux, epilogue.ldaux, values);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    hipblasStatus_t status = matmul(C, ldc, lt_epilogue);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED && !activation)
+        return gemms();
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The values before the activation are in aux, unless there is none
+    void* aux = activation ? nullptr : epilogue.aux;
+    return hipblasGemmEpilogueBlas(
+        handle, m, n, nullptr, aux, epilogue.ldaux, epilogue.scale, folded, C, cType, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// FP8 gemms: see gemm_fp8.hpp. cublasLt computes the OCP formats, with the scales, in the
+// algorithms of the device; the FNUZ formats, whose exponent bias and encodings of NaN and zero
+// differ, are not supported.
+namespace
+{
+    bool gemm_lt_fp8_types(hipDataType a_type, hipDataType b_type)
+    {
+        return hipblasIsOcpFp8Datatype(a_type) && hipblasIsOcpFp8Datatype(b_type);
+    }
+
+    hipblasStatus_t gemm_lt_fp8(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const void*        alpha,
+                                const void*        A,
+                                hipDataType        a_type,
+                                int                lda,
+                                hipblasStride      stride_a,
+                                const void*        B,
+                                hipDataType        b_type,
+                                int                ldb,
+                                hipblasStride      stride_b,
+                                const void*        beta,
+                                void*              C,
+                                hipDataType        c_type,
+                                int                ldc,
+                                hipblasStride      stride_c,
+                                int                batch_count,
+                                const float*       scale_a,
+                                const float*       scale_b)
+    {
+        cudaDataType_t c = HIPDatatypeToCudaDatatype_v2(c_type);
+        return hipblasGemmExLt(handle,
+                               hipOperationToCudaOperation(transa),
+                               hipOperationToCudaOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               HIPDatatypeToCudaDatatype_v2(a_type),
+                               lda,
+                               B,
+                               HIPDatatypeToCudaDatatype_v2(b_type),
+                               ldb,
+                               beta,
+                               C,
+                               c,
+                               ldc,
+                               C,
+                               c,
+                               ldc,
+                               CUBLAS_COMPUTE_32F,
+                               CUDA_R_32F,
+                               {},
+                               batch_count,
+                               stride_a,
+                               stride_b,
+                               stride_c,
+                               scale_a,
+                               scale_b);
+    }
+}
+
+hipblasStatus_t hipblasGemmExFp8Backend(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A,
+                                        hipDataType        a_type,
+                                        int                lda,
+                                        const void*        B,
+                                        hipDataType        b_type,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C,
+                                        hipDataType        c_type,
+                                        int                ldc,
+                                        hipblasGemmAlgo_t  algo,
+                                        const float*       scale_a,
+                                        const float*       scale_b)
+try
+{
+    if(!gemm_lt_fp8_types(a_type, b_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return gemm_lt_fp8(handle,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       A,
+                       a_type,
+                       lda,
+                       0,
+                       B,
+                       b_type,
+                       ldb,
+                       0,
+                       beta,
+                       C,
+                       c_type,
+                       ldc,
+                       0,
+                       1,
+                       scale_a,
+                       scale_b);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExFp8Backend(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A[],
+                                               hipDataType        a_type,
+                                               int                lda,
+                                               const void*        B[],
+                                               hipDataType        b_type,
+                                               int                ldb,
+                                               const void*        beta,
+                                               void*              C[],
+                                               hipDataType        c_type,
+                                               int                ldc,
+                                               int                batch_count,
+                                               hipblasGemmAlgo_t  algo,
+                                               const float*       scale_a,
+                                               const float*       scale_b)
+try
+{
+    if(!gemm_lt_fp8_types(a_type, b_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // cublasLt takes no arrays of pointers, so the gemms are computed one by one
+    hipblasStatus_t status
+        = hipblasCheckCapture(handle, __func__, "arrays of pointers are copied to the host");
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<const void*> hA(batch_count);
+    std::vector<const void*> hB(batch_count);
+    std::vector<void*>       hC(batch_count);
+    if(hipMemcpyAsync(hA.data(), A, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream)
+           != hipSuccess
+       || hipMemcpyAsync(hB.data(), B, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream)
+              != hipSuccess
+       || hipMemcpyAsync(hC.data(), C, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream)
+              != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        status = gemm_lt_fp8(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             hA[b],
+                             a_type,
+                             lda,
+                             0,
+                             hB[b],
+                             b_type,
+                             ldb,
+                             0,
+                             beta,
+                             hC[b],
+                             c_type,
+                             ldc,
+                             0,
+                             1,
+                             scale_a,
+                             scale_b);
+
+        // Once a gemm of the batch is computed the rest cannot be left to another path
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED && b > 0)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExFp8Backend(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transa,
+                                                      hipblasOperation_t transb,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const void*        alpha,
+                                                      const void*        A,
+                                                      hipDataType        a_type,
+                                                      int                lda,
+                                                      hipblasStride      stride_a,
+                                                      const void*        B,
+                                                      hipDataType        b_type,
+                                                      int                ldb,
+                                                      hipblasStride      stride_b,
+                                                      const void*        beta,
+                                                      void*              C,
+                                                      hipDataType        c_type,
+                                                      int                ldc,
+                                                      hipblasStride      stride_c,
+                                                      int                batch_count,
+                                                      hipblasGemmAlgo_t  algo,
+                                                      const float*       scale_a,
+                                                      const float*       scale_b)
+try
+{
+    if(!gemm_lt_fp8_types(a_type, b_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return gemm_lt_fp8(handle,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       A,
+                       a_type,
+                       lda,
+                       stride_a,
+                       B,
+                       b_type,
+                       ldb,
+                       stride_b,
+                       beta,
+                       C,
+                       c_type,
+                       ldc,
+                       stride_c,
+                       batch_count,
+                       scale_a,
+                       scale_b);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm_ex
+hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        B,
+                              hipblasDatatype_t  b_type,
+                              int                ldb,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type,
+                              hipblasGemmAlgo_t  algo)
+try
+{
+    cublasComputeType_t lt_compute_type;
+    cudaDataType_t      lt_scale_type;
+    if(algo == HIPBLAS_GEMM_DEFAULT && hipblasIsGemmExLt(handle)
+       && HIPDatatypeToCudaLtComputetype(compute_type, &lt_compute_type, &lt_scale_type))
+    {
+        hipblasStatus_t status = hipblasGemmExLt(handle,
+                                                 hipOperationToCudaOperation(transa),
+                                                 hipOperationToCudaOperation(transb),
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 HIPDatatypeToCudaDatatype(a_type),
+                                                 lda,
+                                                 B,
+                                                 HIPDatatypeToCudaDatatype(b_type),
+                                                 ldb,
+                                                 beta,
+                                                 C,
+                                                 HIPDatatypeToCudaDatatype(c_type),
+                                                 ldc,
+                                                 C,
+                                                 HIPDatatypeToCudaDatatype(c_type),
+                                                 ldc,
+                                                 lt_compute_type,
+                                                 lt_scale_type);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+
+    return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
+                                                   hipOperationToCudaOperation(transa),
+                                                   hipOperationToCudaOperation(transb),
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   HIPDatatypeToCudaDatatype(a_type),
+                                                   lda,
+                                                   B,
+                                                   HIPDatatypeToCudaDatatype(b_type),
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   HIPDatatypeToCudaDatatype(c_type),
+                                                   ldc,
+                                                   HIPDatatypeToCudaDatatype(compute_type),
+                                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transa,
+                                 hipblasOperation_t   transb,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          a_type,
+                                 int                  lda,
+                                 const void*          B,
+                                 hipDataType          b_type,
+                                 int                  ldb,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          c_type,
+                                 int                  ldc,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasGemmAlgo_t    algo)
+try
+{
+    if(hipblasIsFp8Datatype(a_type) || hipblasIsFp8Datatype(b_type))
+        return hipblasGemmExFp8(handle,
+                                transa,
+                                transb,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                a_type,
+                                lda,
+                                B,
+                                b_type,
+                                ldb,
+                                beta,
+                                C,
+                                c_type,
+                                ldc,
+                                compute_type,
+                                algo,
+                                nullptr,
+                                nullptr);
+
+    if(algo == HIPBLAS_GEMM_DEFAULT && hipblasIsGemmExLt(handle))
+    {
+        cublasComputeType_t lt_compute_type = HIPComputetypeToCudaComputetype(compute_type);
+        cudaDataType_t      lt_c_type       = HIPDatatypeToCudaDatatype_v2(c_type);
+        hipblasStatus_t     status
+            = hipblasGemmExLt(handle,
+                              hipOperationToCudaOperation(transa),
+                              hipOperationToCudaOperation(transb),
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              HIPDatatypeToCudaDatatype_v2(a_type),
+                              lda,
+                              B,
+                              HIPDatatypeToCudaDatatype_v2(b_type),
+                              ldb,
+                              beta,
+                              C,
+                              lt_c_type,
+                              ldc,
+                              C,
+                              lt_c_type,
+                              ldc,
+                              lt_compute_type,
+                              CudaLtScaletype(lt_compute_type, lt_c_type));
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+
+    return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
+                                                   hipOperationToCudaOperation(transa),
+                                                   hipOperationToCudaOperation(transb),
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   HIPDatatypeToCudaDatatype_v2(a_type),
+                                                   lda,
+                                                   B,
+                                                   HIPDatatypeToCudaDatatype_v2(b_type),
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   HIPDatatypeToCudaDatatype_v2(c_type),
+                                                   ldc,
+                                                   HIPComputetypeToCudaComputetype(compute_type),
+                                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        B[],
+                                     hipblasDatatype_t  b_type,
+                                     int                ldb,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type,
+                                     hipblasGemmAlgo_t  algo)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                          hipOperationToCudaOperation(transa),
+                                                          hipOperationToCudaOperation(transb),
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          A,
+                                                          HIPDatatypeToCudaDatatype(a_type),
+                                                          lda,
+                                                          B,
+                                                          HIPDatatypeToCudaDatatype(b_type),
+                                                          ldb,
+                                                          beta,
+                                                          C,
+                                                          HIPDatatypeToCudaDatatype(c_type),
+                                                          ldc,
+                                                          batch_count,
+                                                          HIPDatatypeToCudaDatatype(compute_type),
+                                                          HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A[],
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B[],
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C[],
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo)
+try
+{
+    if(hipblasIsFp8Datatype(a_type) || hipblasIsFp8Datatype(b_type))
+        return hipblasGemmBatchedExFp8(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       batch_count,
+                                       compute_type,
+                                       algo,
+                                       nullptr,
+                                       nullptr);
+
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmBatchedEx((cublasHandle_t)handle,
+                            hipOperationToCudaOperation(transa),
+                            hipOperationToCudaOperation(transb),
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            A,
+                            HIPDatatypeToCudaDatatype_v2(a_type),
+                            lda,
+                            B,
+                            HIPDatatypeToCudaDatatype_v2(b_type),
+                            ldb,
+                            beta,
+                            C,
+                            HIPDatatypeToCudaDatatype_v2(c_type),
+                            ldc,
+                            batch_count,
+                            HIPComputetypeToCudaComputetype(compute_type),
+                            HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        B,
+                                            hipblasDatatype_t  b_type,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type,
+                                            hipblasGemmAlgo_t  algo)
+try
+{
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                   hipOperationToCudaOperation(transa),
+                                   hipOperationToCudaOperation(transb),
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   HIPDatatypeToCudaDatatype(a_type),
+                                   lda,
+                                   stride_A,
+                                   B,
+                                   HIPDatatypeToCudaDatatype(b_type),
+                                   ldb,
+                                   stride_B,
+                                   beta,
+                                   C,
+                                   HIPDatatypeToCudaDatatype(c_type),
+                                   ldc,
+                                   stride_C,
+                                   batch_count,
+                                   HIPDatatypeToCudaDatatype(compute_type),
+                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               hipblasStride        stride_A,
+                                               const void*          B,
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               hipblasStride        stride_B,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               hipblasStride        stride_C,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo)
+try
+{
+    if(hipblasIsFp8Datatype(a_type) || hipblasIsFp8Datatype(b_type))
+        return hipblasGemmStridedBatchedExFp8(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              b_type,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              c_type,
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              compute_type,
+                                              algo,
+                                              nullptr,
+                                              nullptr);
+
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                   hipOperationToCudaOperation(transa),
+                                   hipOperationToCudaOperation(transb),
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   HIPDatatypeToCudaDatatype_v2(a_type),
+                                   lda,
+                                   stride_A,
+                                   B,
+                                   HIPDatatypeToCudaDatatype_v2(b_type),
+                                   ldb,
+                                   stride_B,
+                                   beta,
+                                   C,
+                                   HIPDatatypeToCudaDatatype_v2(c_type),
+                                   ldc,
+                                   stride_C,
+                                   batch_count,
+                                   HIPComputetypeToCudaComputetype(compute_type),
+                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm_ex out of place
+hipblasStatus_t hipblasGemmExOutOfPlace(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        const void*          C,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        void*                D,
+                                        hipDataType          d_type,
+                                        int                  ldd,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo)
+try
+{
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // cublasGemmEx computes in place only, but cublasLt writes D itself
+    if(algo == HIPBLAS_GEMM_DEFAULT && !hipblasIsFp8Datatype(a_type)
+       && !hipblasIsFp8Datatype(b_type))
+    {
+        cublasComputeType_t lt_compute_type = HIPComputetypeToCudaComputetype(compute_type);
+        cudaDataType_t      lt_c_type       = HIPDatatypeToCudaDatatype_v2(c_type);
+        hipblasStatus_t     status
+            = hipblasGemmExLt(handle,
+                              hipOperationToCudaOperation(transa),
+                              hipOperationToCudaOperation(transb),
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              HIPDatatypeToCudaDatatype_v2(a_type),
+                              lda,
+                              B,
+                              HIPDatatypeToCudaDatatype_v2(b_type),
+                              ldb,
+                              beta,
+                              C,
+                              lt_c_type,
+                              ldc,
+                              D,
+                              lt_c_type,
+                              ldd,
+                              lt_compute_type,
+                              CudaLtScaletype(lt_compute_type, lt_c_type));
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+
+    return hipblasGemmExOutOfPlaceByCopy(handle,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         a_type,
+                                         lda,
+                                         B,
+                                         b_type,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         c_type,
+                                         ldc,
+                                         D,
+                                         d_type,
+                                         ldd,
+                                         compute_type,
+                                         algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A[],
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               const void*          B[],
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               const void*          beta,
+                                               const void*          C[],
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               void*                D[],
+                                               hipDataType          d_type,
+                                               int                  ldd,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo)
+try
+{
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasGemmBatchedExOutOfPlaceByCopy(handle,
+                                                transa,
+                                                transb,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                a_type,
+                                                lda,
+                                                B,
+                                                b_type,
+                                                ldb,
+                                                beta,
+                                                C,
+                                                c_type,
+                                                ldc,
+                                                D,
+                                                d_type,
+                                                ldd,
+                                                batch_count,
+                                                compute_type,
+                                                algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transa,
+                                                      hipblasOperation_t   transb,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A,
+                                                      hipDataType          a_type,
+                                                      int                  lda,
+                                                      hipblasStride        stride_A,
+                                                      const void*          B,
+                                                      hipDataType          b_type,
+                                                      int                  ldb,
+                                                      hipblasStride        stride_B,
+                                                      const void*          beta,
+                                                      const void*          C,
+                                                      hipDataType          c_type,
+                                                      int                  ldc,
+                                                      hipblasStride        stride_C,
+                                                      void*                D,
+                                                      hipDataType          d_type,
+                                                      int                  ldd,
+                                                      hipblasStride        stride_D,
+                                                      int                  batch_count,
+                                                      hipblasComputeType_t compute_type,
+                                                      hipblasGemmAlgo_t    algo)
+try
+{
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasGemmStridedBatchedExOutOfPlaceByCopy(handle,
+                                                       transa,
+                                                       transb,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       a_type,
+                                                       lda,
+                                                       stride_A,
+                                                       B,
+                                                       b_type,
+                                                       ldb,
+                                                       stride_B,
+                                                       beta,
+                                                       C,
+                                                       c_type,
+                                                       ldc,
+                                                       stride_C,
+                                                       D,
+                                                       d_type,
+                                                       ldd,
+                                                       stride_D,
+                                                       batch_count,
+                                                       compute_type,
+                                                       algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trsm_ex
+hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              int                m,
+                              int                n,
+                              const void*        alpha,
+                              void*              A,
+                              int                lda,
+                              void*              B,
+                              int                ldb,
+                              const void*        invA,
+                              int                invA_size,
+                              hipblasDatatype_t  compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTrsmEx_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 void*              A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb,
+                                 const void*        invA,
+                                 int                invA_size,
+                                 hipDataType        compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const void*        alpha,
+                                     void*              A,
+                                     int                lda,
+                                     void*              B,
+                                     int                ldb,
+                                     int                batch_count,
+                                     const void*        invA,
+                                     int                invA_size,
+                                     hipblasDatatype_t  compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const void*        alpha,
+                                        void*              A,
+                                        int                lda,
+                                        void*              B,
+                                        int                ldb,
+                                        int                batch_count,
+                                        const void*        invA,
+                                        int                invA_size,
+                                        hipDataType        compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const void*        alpha,
+                                            void*              A,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            void*              B,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            int                batch_count,
+                                            const void*        invA,
+                                            int                invA_size,
+                                            hipblasStride      stride_invA,
+                                            hipblasDatatype_t  compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx_v2(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const void*        alpha,
+                                               void*              A,
+                                               int                lda,
+                                               hipblasStride      stride_A,
+                                               void*              B,
+                                               int                ldb,
+                                               hipblasStride      stride_B,
+                                               int                batch_count,
+                                               const void*        invA,
+                                               int                invA_size,
+                                               hipblasStride      stride_invA,
+                                               hipDataType        compute_type)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// // syrk_ex
+// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
+//                                           hipblasFillMode_t     uplo,
+//                                           hipblasOperation_t    trans,
+//                                           int                   n,
+//                                           int                   k,
+//                                           const hipblasComplex* alpha,
+//                                           const void*           A,
+//                                           hipblasDatatype_t     Atype,
+//                                           int                   lda,
+//                                           const hipblasComplex* beta,
+//                                           hipblasComplex*       C,
+//                                           hipblasDatatype_t     Ctype,
+//                                           int                   ldc)
+// try
+//{
+//     return hipCUBLASStatusToHIPStatus(cublasCsyrkEx((cublasHandle_t)handle,
+//                                                     hipFillToCudaFill(uplo),
+//                                                     hipOperationToCudaOperation(trans),
+//                                                     n,
+//                                                     k,
+//                                                     (cuComplex*)alpha,
+//                                                     A,
+//                                                     HIPDatatypeToCudaDatatype(Atype),
+//                                                     lda,
+//                                                     (cuComplex*)beta,
+//                                                     (cuComplex*)C,
+//                                                     HIPDatatypeToCudaDatatype(Ctype),
+//                                                     ldc));
+// }
+// catch(...)
+// {
+//     return exception_to_hipblas_status();
+// }
+
+// // herk_ex
+// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
+//                                           hipblasFillMode_t  uplo,
+//                                           hipblasOperation_t trans,
+//                                           int                n,
+//                                           int                k,
+//                                           const float*       alpha,
+//                                           const void*        A,
+//                                           hipblasDatatype_t  Atype,
+//                                           int                lda,
+//                                           const float*       beta,
+//                                           hipblasComplex*    C,
+//                                           hipblasDatatype_t  Ctype,
+//                                           int                ldc)
+// try
+// {
+//     return hipCUBLASStatusToHIPStatus(cublasCherkEx((cublasHandle_t)handle,
+//                                                     hipFillToCudaFill(uplo),
+//                                                     hipOperationToCudaOperation(trans),
+//                                                     n,
+//                                                     k,
+//                                                     alpha,
+//                                                     A,
+//                                                     HIPDatatypeToCudaDatatype(Atype),
+//                                                     lda,
+//                                                     beta,
+//                                                     (cuComplex*)C,
+//                                                     HIPDatatypeToCudaDatatype(Ctype),
+//                                                     ldc));
+// }
+// catch(...)
+// {
+//     return exception_to_hipblas_status();
+// }
+
+// axpy_ex
+hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              hipblasDatatype_t executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
+                                                   n,
+                                                   alpha,
+                                                   HIPDatatypeToCudaDatatype(alphaType),
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype(xType),
+                                                   incx,
+                                                   y,
+                                                   HIPDatatypeToCudaDatatype(yType),
+                                                   incy,
+                                                   HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 hipDataType     executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
+                                                   n,
+                                                   alpha,
+                                                   HIPDatatypeToCudaDatatype_v2(alphaType),
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype_v2(xType),
+                                                   incx,
+                                                   y,
+                                                   HIPDatatypeToCudaDatatype_v2(yType),
+                                                   incy,
+                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     void*             y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        void*           y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            void*             y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               void*           y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_ex
+hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
+                             int               n,
+                             const void*       x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             const void*       y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             void*             result,
+                             hipblasDatatype_t resultType,
+                             hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
+                                                  n,
+                                                  x,
+                                                  HIPDatatypeToCudaDatatype(xType),
+                                                  incx,
+                                                  y,
+                                                  HIPDatatypeToCudaDatatype(yType),
+                                                  incy,
+                                                  result,
+                                                  HIPDatatypeToCudaDatatype(resultType),
+                                                  HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                const void*     x,
+                                hipDataType     xType,
+                                int             incx,
+                                const void*     y,
+                                hipDataType     yType,
+                                int             incy,
+                                void*           result,
+                                hipDataType     resultType,
+                                hipDataType     executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
+                                                  n,
+                                                  x,
+                                                  HIPDatatypeToCudaDatatype_v2(xType),
+                                                  incx,
+                                                  y,
+                                                  HIPDatatypeToCudaDatatype_v2(yType),
+                                                  incy,
+                                                  result,
+                                                  HIPDatatypeToCudaDatatype_v2(resultType),
+                                                  HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              const void*       y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
+                                                   n,
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype(xType),
+                                                   incx,
+                                                   y,
+                                                   HIPDatatypeToCudaDatatype(yType),
+                                                   incy,
+                                                   result,
+                                                   HIPDatatypeToCudaDatatype(resultType),
+                                                   HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 const void*     y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
+                                                   n,
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype_v2(xType),
+                                                   incx,
+                                                   y,
+                                                   HIPDatatypeToCudaDatatype_v2(yType),
+                                                   incy,
+                                                   result,
+                                                   HIPDatatypeToCudaDatatype_v2(resultType),
+                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    const void*       x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    const void*       y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    int               batch_count,
+                                    void*             result,
+                                    hipblasDatatype_t resultType,
+                                    hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       const void*     x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       const void*     y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       int             batch_count,
+                                       void*           result,
+                                       hipDataType     resultType,
+                                       hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     const void*       y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        const void*     y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           const void*       x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           const void*       y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           int               batch_count,
+                                           void*             result,
+                                           hipblasDatatype_t resultType,
+                                           hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              const void*     y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            const void*       y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const void*     y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_ex
+hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                                   n,
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype(xType),
+                                                   incx,
+                                                   result,
+                                                   HIPDatatypeToCudaDatatype(resultType),
+                                                   HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                                   n,
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype_v2(xType),
+                                                   incx,
+                                                   result,
+                                                   HIPDatatypeToCudaDatatype_v2(resultType),
+                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rot_ex
+hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
+                             int               n,
+                             void*             x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             void*             y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             const void*       c,
+                             const void*       s,
+                             hipblasDatatype_t csType,
+                             hipblasDatatype_t executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
+                                                  n,
+                                                  x,
+                                                  HIPDatatypeToCudaDatatype(xType),
+                                                  incx,
+                                                  y,
+                                                  HIPDatatypeToCudaDatatype(yType),
+                                                  incy,
+                                                  c,
+                                                  s,
+                                                  HIPDatatypeToCudaDatatype(csType),
+                                                  HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                void*           x,
+                                hipDataType     xType,
+                                int             incx,
+                                void*           y,
+                                hipDataType     yType,
+                                int             incy,
+                                const void*     c,
+                                const void*     s,
+                                hipDataType     csType,
+                                hipDataType     executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
+                                                  n,
+                                                  x,
+                                                  HIPDatatypeToCudaDatatype_v2(xType),
+                                                  incx,
+                                                  y,
+                                                  HIPDatatypeToCudaDatatype_v2(yType),
+                                                  incy,
+                                                  c,
+                                                  s,
+                                                  HIPDatatypeToCudaDatatype_v2(csType),
+                                                  HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    void*             x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    void*             y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    const void*       c,
+                                    const void*       s,
+                                    hipblasDatatype_t csType,
+                                    int               batch_count,
+                                    hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       void*           x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       void*           y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       const void*     c,
+                                       const void*     s,
+                                       hipDataType     csType,
+                                       int             batch_count,
+                                       hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           void*             x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           void*             y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           const void*       c,
+                                           const void*       s,
+                                           hipblasDatatype_t csType,
+                                           int               batch_count,
+                                           hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              void*           x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              void*           y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const void*     c,
+                                              const void*     s,
+                                              hipDataType     csType,
+                                              int             batch_count,
+                                              hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// scal_ex
+hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              void*             x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              hipblasDatatype_t executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
+                                                   n,
+                                                   alpha,
+                                                   HIPDatatypeToCudaDatatype(alphaType),
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype(xType),
+                                                   incx,
+                                                   HIPDatatypeToCudaDatatype(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 void*           x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 hipDataType     executionType)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
+                                                   n,
+                                                   alpha,
+                                                   HIPDatatypeToCudaDatatype_v2(alphaType),
+                                                   x,
+                                                   HIPDatatypeToCudaDatatype_v2(xType),
+                                                   incx,
+                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     void*             x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        void*           x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            void*             x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               void*           x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// ilp64
+hipblasStatus_t hipblasSscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSscal_64((cublasHandle_t)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDscal_64((cublasHandle_t)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCscal_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsscal_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           alpha,
+                                                                           (cuComplex*)x,
+                                                                           incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscal_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZscal_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdscal_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZdscal_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           alpha,
+                                                                           (cuDoubleComplex*)x,
+                                                                           incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSscalBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              float* const    x[],
+                                              int64_t         incx,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDscalBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              double* const   x[],
+                                              int64_t         incx,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCscalBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsscalBatched_64Backend(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const float*          alpha,
+                                               hipblasComplex* const x[],
+                                               int64_t               incx,
+                                               int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZscalBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdscalBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const double*               alpha,
+                                               hipblasDoubleComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    alpha,
+                                                     float*          x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   alpha,
+                                                     double*         x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    alpha,
+                                                      hipblasComplex* x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const double*         alpha,
+                                                      hipblasDoubleComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpy_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const float*    alpha,
+                                       const float*    x,
+                                       int64_t         incx,
+                                       float*          y,
+                                       int64_t         incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSaxpy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpy_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDaxpy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpy_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCaxpy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpy_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZaxpy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpyBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDaxpyBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCaxpyBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZaxpyBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    alpha,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   alpha,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScopy_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasScopy_64((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDcopy_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDcopy_64((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCcopy_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCcopy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZcopy_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZcopy_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScopyBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDcopyBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCcopyBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZcopyBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScopyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSswap_64Backend(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSswap_64((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDswap_64Backend(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDswap_64((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCswap_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       hipblasComplex* x,
+                                       int64_t         incx,
+                                       hipblasComplex* y,
+                                       int64_t         incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCswap_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZswap_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasDoubleComplex* x,
+                                       int64_t               incx,
+                                       hipblasDoubleComplex* y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZswap_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSswapBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float* const    x[],
+                                              int64_t         incx,
+                                              float* const    y[],
+                                              int64_t         incy,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDswapBatched_64Backend(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double* const   x[],
+                                              int64_t         incx,
+                                              double* const   y[],
+                                              int64_t         incy,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCswapBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              hipblasComplex* const y[],
+                                              int64_t               incy,
+                                              int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZswapBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     float*          x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     float*          y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     double*         x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     hipblasComplex* x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     hipblasComplex* y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasDoubleComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasDoubleComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSdot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      const float*    y,
+                                      int64_t         incy,
+                                      float*          result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSdot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDdot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotu_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCdotu_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotc_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCdotc_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotu_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZdotu_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuDoubleComplex*)x,
+                                                  incx,
+                                                  (cuDoubleComplex*)y,
+                                                  incy,
+                                                  (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotc_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZdotc_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuDoubleComplex*)x,
+                                                  incx,
+                                                  (cuDoubleComplex*)y,
+                                                  incy,
+                                                  (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotBatched_64Backend(hipblasHandle_t    handle,
+                                             int64_t            n,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             const float* const y[],
+                                             int64_t            incy,
+                                             int64_t            batchCount,
+                                             float*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdotBatched_64Backend(hipblasHandle_t     handle,
+                                             int64_t             n,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             const double* const y[],
+                                             int64_t             incy,
+                                             int64_t             batchCount,
+                                             double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount,
+                                              hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount,
+                                              hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount,
+                                              hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount,
+                                              hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSdotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    const float*    x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const float*    y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    int64_t         batchCount,
+                                                    float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    const double*   x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const double*   y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    int64_t         batchCount,
+                                                    double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount,
+                                                     hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount,
+                                                     hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount,
+                                                     hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount,
+                                                     hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSasum_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDasum_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasScasum_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasum_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDzasum_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuDoubleComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasumBatched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount,
+                                              float*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDasumBatched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount,
+                                              double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScasumBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               float*                      result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDzasumBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               double*                           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSasumStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDasumStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      float*                result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      double*                     result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSnrm2_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDnrm2_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasScnrm2_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDznrm2_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuDoubleComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2Batched_64Backend(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount,
+                                              float*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2Batched_64Backend(hipblasHandle_t     handle,
+                                              int64_t             n,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount,
+                                              double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2Batched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               float*                      result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2Batched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               double*                           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSnrm2StridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const float*    x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     const double*   x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     int64_t         batchCount,
+                                                     double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      float*                result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      double*                     result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIsamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasIsamax_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasIdamax_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasIcamax_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamax_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasIzamax_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuDoubleComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamaxBatched_64Backend(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const float* const x[],
+                                               int64_t            incx,
+                                               int64_t            batchCount,
+                                               int64_t*           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIdamaxBatched_64Backend(hipblasHandle_t     handle,
+                                               int64_t             n,
+                                               const double* const x[],
+                                               int64_t             incx,
+                                               int64_t             batchCount,
+                                               int64_t*            result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIcamaxBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIzamaxBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               int64_t*                          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIsamaxStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      int64_t*              result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      int64_t*                    result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIsamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasIsamin_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasIdamin_64((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasIcamin_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamin_64Backend(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_CHECK_HOST_RESULT_CAPTURE();
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasIzamin_64((cublasHandle_t)handle,
+                                                                           n,
+                                                                           (cuDoubleComplex*)x,
+                                                                           incx,
+                                                                           result));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsaminBatched_64Backend(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const float* const x[],
+                                               int64_t            incx,
+                                               int64_t            batchCount,
+                                               int64_t*           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIdaminBatched_64Backend(hipblasHandle_t     handle,
+                                               int64_t             n,
+                                               const double* const x[],
+                                               int64_t             incx,
+                                               int64_t             batchCount,
+                                               int64_t*            result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIcaminBatched_64Backend(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasComplex* const x[],
+                                               int64_t                     incx,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIzaminBatched_64Backend(hipblasHandle_t                   handle,
+                                               int64_t                           n,
+                                               const hipblasDoubleComplex* const x[],
+                                               int64_t                           incx,
+                                               int64_t                           batchCount,
+                                               int64_t*                          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIsaminStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched_64Backend(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   x,
+                                                      int64_t         incx,
+                                                      hipblasStride   stridex,
+                                                      int64_t         batchCount,
+                                                      int64_t*        result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* x,
+                                                      int64_t               incx,
+                                                      hipblasStride         stridex,
+                                                      int64_t               batchCount,
+                                                      int64_t*              result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* x,
+                                                      int64_t                     incx,
+                                                      hipblasStride               stridex,
+                                                      int64_t                     batchCount,
+                                                      int64_t*                    result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSrot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      float*          x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy,
+                                      const float*    c,
+                                      const float*    s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSrot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         c,
+                                                                         s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDrot_64Backend(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      double*         x,
+                                      int64_t         incx,
+                                      double*         y,
+                                      int64_t         incy,
+                                      const double*   c,
+                                      const double*   s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDrot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         c,
+                                                                         s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCrot_64Backend(hipblasHandle_t       handle,
+                                      int64_t               n,
+                                      hipblasComplex*       x,
+                                      int64_t               incx,
+                                      hipblasComplex*       y,
+                                      int64_t               incy,
+                                      const float*          c,
+                                      const hipblasComplex* s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCrot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         (cuComplex*)x,
+                                                                         incx,
+                                                                         (cuComplex*)y,
+                                                                         incy,
+                                                                         c,
+                                                                         (cuComplex*)s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsrot_64Backend(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       hipblasComplex* x,
+                                       int64_t         incx,
+                                       hipblasComplex* y,
+                                       int64_t         incy,
+                                       const float*    c,
+                                       const float*    s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsrot_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          c,
+                                                                          s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZrot_64Backend(hipblasHandle_t             handle,
+                                      int64_t                     n,
+                                      hipblasDoubleComplex*       x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       y,
+                                      int64_t                     incy,
+                                      const double*               c,
+                                      const hipblasDoubleComplex* s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZrot_64((cublasHandle_t)handle,
+                                                                         n,
+                                                                         (cuDoubleComplex*)x,
+                                                                         incx,
+                                                                         (cuDoubleComplex*)y,
+                                                                         incy,
+                                                                         c,
+                                                                         (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdrot_64Backend(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasDoubleComplex* x,
+                                       int64_t               incx,
+                                       hipblasDoubleComplex* y,
+                                       int64_t               incy,
+                                       const double*         c,
+                                       const double*         s)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZdrot_64((cublasHandle_t)handle,
+                                                                          n,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          c,
+                                                                          s));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSrotBatched_64Backend(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             float* const    x[],
+                                             int64_t         incx,
+                                             float* const    y[],
+                                             int64_t         incy,
+                                             const float*    c,
+                                             const float*    s,
+                                             int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotBatched_64Backend(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             double* const   x[],
+                                             int64_t         incx,
+                                             double* const   y[],
+                                             int64_t         incy,
+                                             const double*   c,
+                                             const double*   s,
+                                             int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotBatched_64Backend(hipblasHandle_t       handle,
+                                             int64_t               n,
+                                             hipblasComplex* const x[],
+                                             int64_t               incx,
+                                             hipblasComplex* const y[],
+                                             int64_t               incy,
+                                             const float*          c,
+                                             const hipblasComplex* s,
+                                             int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsrotBatched_64Backend(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex* const x[],
+                                              int64_t               incx,
+                                              hipblasComplex* const y[],
+                                              int64_t               incy,
+                                              const float*          c,
+                                              const float*          s,
+                                              int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotBatched_64Backend(hipblasHandle_t             handle,
+                                             int64_t                     n,
+                                             hipblasDoubleComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasDoubleComplex* const y[],
+                                             int64_t                     incy,
+                                             const double*               c,
+                                             const hipblasDoubleComplex* s,
+                                             int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdrotBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex* const y[],
+                                              int64_t                     incy,
+                                              const double*               c,
+                                              const double*               s,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    float*          x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    float*          y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    const float*    c,
+                                                    const float*    s,
+                                                    int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    double*         x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    double*         y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    const double*   c,
+                                                    const double*   s,
+                                                    int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    int64_t               n,
+                                                    hipblasComplex*       x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       y,
+                                                    int64_t               incy,
+                                                    hipblasStride         stridey,
+                                                    const float*          c,
+                                                    const hipblasComplex* s,
+                                                    int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_64Backend(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     hipblasComplex* x,
+                                                     int64_t         incx,
+                                                     hipblasStride   stridex,
+                                                     hipblasComplex* y,
+                                                     int64_t         incy,
+                                                     hipblasStride   stridey,
+                                                     const float*    c,
+                                                     const float*    s,
+                                                     int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    hipblasDoubleComplex*       x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       y,
+                                                    int64_t                     incy,
+                                                    hipblasStride               stridey,
+                                                    const double*               c,
+                                                    const hipblasDoubleComplex* s,
+                                                    int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasDoubleComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasDoubleComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     const double*         c,
+                                                     const double*         s,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       x,
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float*             y,
+                                       int64_t            incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgemv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx,
+                                                  beta,
+                                                  y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      x,
+                                       int64_t            incx,
+                                       const double*      beta,
+                                       double*            y,
+                                       int64_t            incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgemv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx,
+                                                  beta,
+                                                  y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    trans,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCgemv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx,
+                                                  (cuComplex*)beta,
+                                                  (cuComplex*)y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZgemv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx,
+                                                  (cuDoubleComplex*)beta,
+                                                  (cuDoubleComplex*)y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                trans,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            kl,
+                                       int64_t            ku,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       x,
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float*             y,
+                                       int64_t            incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgbmv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  kl,
+                                                  ku,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx,
+                                                  beta,
+                                                  y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            kl,
+                                       int64_t            ku,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      x,
+                                       int64_t            incx,
+                                       const double*      beta,
+                                       double*            y,
+                                       int64_t            incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgbmv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  kl,
+                                                  ku,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx,
+                                                  beta,
+                                                  y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    trans,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       int64_t               kl,
+                                       int64_t               ku,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCgbmv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  kl,
+                                                  ku,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx,
+                                                  (cuComplex*)beta,
+                                                  (cuComplex*)y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     kl,
+                                       int64_t                     ku,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZgbmv_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(trans),
+                                                  m,
+                                                  n,
+                                                  kl,
+                                                  ku,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx,
+                                                  (cuDoubleComplex*)beta,
+                                                  (cuDoubleComplex*)y,
+                                                  incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            kl,
+                                              int64_t            ku,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              int64_t             kl,
+                                              int64_t             ku,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     kl,
+                                              int64_t                     ku,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                trans,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              int64_t                           kl,
+                                              int64_t                           ku,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            kl,
+                                                     int64_t            ku,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            kl,
+                                                     int64_t            ku,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    trans,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     int64_t               kl,
+                                                     int64_t               ku,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          trans,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     int64_t                     kl,
+                                                     int64_t                     ku,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSger_64Backend(hipblasHandle_t handle,
+                                      int64_t         m,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      const float*    y,
+                                      int64_t         incy,
+                                      float*          A,
+                                      int64_t         lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSger_64((cublasHandle_t)handle,
+                                                                         m,
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDger_64Backend(hipblasHandle_t handle,
+                                      int64_t         m,
+                                      int64_t         n,
+                                      const double*   alpha,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         A,
+                                      int64_t         lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDger_64((cublasHandle_t)handle,
+                                                                         m,
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         y,
+                                                                         incy,
+                                                                         A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgerBatched_64Backend(hipblasHandle_t    handle,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             const float* const y[],
+                                             int64_t            incy,
+                                             float* const       AP[],
+                                             int64_t            lda,
+                                             int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgerBatched_64Backend(hipblasHandle_t     handle,
+                                             int64_t             m,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             const double* const y[],
+                                             int64_t             incy,
+                                             double* const       AP[],
+                                             int64_t             lda,
+                                             int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgerStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         m,
+                                                    int64_t         n,
+                                                    const float*    alpha,
+                                                    const float*    x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const float*    y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    float*          AP,
+                                                    int64_t         lda,
+                                                    hipblasStride   strideA,
+                                                    int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgerStridedBatched_64Backend(hipblasHandle_t handle,
+                                                    int64_t         m,
+                                                    int64_t         n,
+                                                    const double*   alpha,
+                                                    const double*   x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    const double*   y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    double*         AP,
+                                                    int64_t         lda,
+                                                    hipblasStride   strideA,
+                                                    int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeru_64Backend(hipblasHandle_t       handle,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       A,
+                                       int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCgeru_64((cublasHandle_t)handle,
+                                                                          m,
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeru_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       A,
+                                       int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZgeru_64((cublasHandle_t)handle,
+                                                                          m,
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeruBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeruBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeruStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeruStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgerc_64Backend(hipblasHandle_t       handle,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       A,
+                                       int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCgerc_64((cublasHandle_t)handle,
+                                                                          m,
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgerc_64Backend(hipblasHandle_t             handle,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       A,
+                                       int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZgerc_64((cublasHandle_t)handle,
+                                                                          m,
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgercBatched_64Backend(hipblasHandle_t             handle,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgercBatched_64Backend(hipblasHandle_t                   handle,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgercStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgercStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasChbmv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)beta,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZhbmv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)beta,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChemv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasChemv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)beta,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhemv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZhemv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)beta,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChemvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhemvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChemvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhemvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCher_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const float*          alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       A,
+                                      int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCher_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         (cuComplex*)x,
+                                                                         incx,
+                                                                         (cuComplex*)A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const double*               alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       A,
+                                      int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZher_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         (cuDoubleComplex*)x,
+                                                                         incx,
+                                                                         (cuDoubleComplex*)A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const float*                alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     lda,
+                                             int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const double*                     alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           lda,
+                                             int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCherStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const float*          alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    int64_t               lda,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const double*               alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    int64_t                     lda,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCher2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       A,
+                                       int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCher2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZher2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       A,
+                                       int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZher2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZher2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCher2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZher2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* AP,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhpmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* AP,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhpmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhpmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const float*          alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasChpr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         (cuComplex*)x,
+                                                                         incx,
+                                                                         (cuComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const double*               alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZhpr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         (cuDoubleComplex*)x,
+                                                                         incx,
+                                                                         (cuDoubleComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChprBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const float*                alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhprBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const double*                     alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChprStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const float*          alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhprStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const double*               alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpr2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasChpr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZhpr2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZhpr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          (cuDoubleComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasChpr2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhpr2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChpr2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhpr2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsbmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       int64_t           k,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSsbmv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          beta,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsbmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       int64_t           k,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDsbmv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          beta,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsbmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     int64_t           k,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsbmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     int64_t           k,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      AP,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDspmv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     AP,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDspmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDspmvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const float*      alpha,
+                                      const float*      x,
+                                      int64_t           incx,
+                                      float*            AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSspr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const double*     alpha,
+                                      const double*     x,
+                                      int64_t           incx,
+                                      double*           AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDspr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCspr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       AP)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZspr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       AP)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsprBatched_64Backend(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             float* const       AP[],
+                                             int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsprBatched_64Backend(hipblasHandle_t     handle,
+                                             hipblasFillMode_t   uplo,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             double* const       AP[],
+                                             int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsprBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsprBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsprStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const float*      alpha,
+                                                    const float*      x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    float*            AP,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsprStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const double*     alpha,
+                                                    const double*     x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    double*           AP,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsprStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsprStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      y,
+                                       int64_t           incy,
+                                       float*            AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSspr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy,
+                                                                          AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDspr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     y,
+                                       int64_t           incy,
+                                       double*           AP)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDspr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy,
+                                                                          AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSspr2Batched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float* const y[],
+                                              int64_t            incy,
+                                              float* const       AP[],
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDspr2Batched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double* const y[],
+                                              int64_t             incy,
+                                              double* const       AP[],
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSspr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     float*            AP,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDspr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     double*           AP,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsymv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int64_t           incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSsymv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          beta,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymv_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int64_t           incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDsymv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          beta,
+                                                                          y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       y,
+                                       int64_t               incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsymv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)beta,
+                                                                          (cuComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       y,
+                                       int64_t                     incy)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZsymv_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)beta,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float*       beta,
+                                              float* const       y[],
+                                              int64_t            incy,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsymvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double*       beta,
+                                              double* const       y[],
+                                              int64_t             incy,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsymvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       y[],
+                                              int64_t                     incy,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsymvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int64_t                           incy,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsymvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      beta,
+                                                     float*            y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsymvStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     beta,
+                                                     double*           y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsymvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsymvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const float*      alpha,
+                                      const float*      x,
+                                      int64_t           incx,
+                                      float*            A,
+                                      int64_t           lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSsyr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr_64Backend(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const double*     alpha,
+                                      const double*     x,
+                                      int64_t           incx,
+                                      double*           A,
+                                      int64_t           lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDsyr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         incx,
+                                                                         A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr_64Backend(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      int64_t               n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int64_t               incx,
+                                      hipblasComplex*       A,
+                                      int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsyr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         (cuComplex*)alpha,
+                                                                         (cuComplex*)x,
+                                                                         incx,
+                                                                         (cuComplex*)A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr_64Backend(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      int64_t                     n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex*       A,
+                                      int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZsyr_64((cublasHandle_t)handle,
+                                                                         hipFillToCudaFill(uplo),
+                                                                         n,
+                                                                         (cuDoubleComplex*)alpha,
+                                                                         (cuDoubleComplex*)x,
+                                                                         incx,
+                                                                         (cuDoubleComplex*)A,
+                                                                         lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrBatched_64Backend(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             int64_t            n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int64_t            incx,
+                                             float* const       AP[],
+                                             int64_t            lda,
+                                             int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrBatched_64Backend(hipblasHandle_t     handle,
+                                             hipblasFillMode_t   uplo,
+                                             int64_t             n,
+                                             const double*       alpha,
+                                             const double* const x[],
+                                             int64_t             incx,
+                                             double* const       AP[],
+                                             int64_t             lda,
+                                             int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrBatched_64Backend(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int64_t                     n,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const x[],
+                                             int64_t                     incx,
+                                             hipblasComplex* const       AP[],
+                                             int64_t                     lda,
+                                             int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrBatched_64Backend(hipblasHandle_t                   handle,
+                                             hipblasFillMode_t                 uplo,
+                                             int64_t                           n,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const x[],
+                                             int64_t                           incx,
+                                             hipblasDoubleComplex* const       AP[],
+                                             int64_t                           lda,
+                                             int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyrStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const float*      alpha,
+                                                    const float*      x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    float*            AP,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const double*     alpha,
+                                                    const double*     x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    double*           AP,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                    hipblasFillMode_t     uplo,
+                                                    int64_t               n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    hipblasStride         stridex,
+                                                    hipblasComplex*       AP,
+                                                    int64_t               lda,
+                                                    hipblasStride         strideA,
+                                                    int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    hipblasStride               stridex,
+                                                    hipblasDoubleComplex*       AP,
+                                                    int64_t                     lda,
+                                                    hipblasStride               strideA,
+                                                    int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       const float*      y,
+                                       int64_t           incy,
+                                       float*            A,
+                                       int64_t           lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSsyr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy,
+                                                                          A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyr2_64Backend(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       const double*     y,
+                                       int64_t           incy,
+                                       double*           A,
+                                       int64_t           lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDsyr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          alpha,
+                                                                          x,
+                                                                          incx,
+                                                                          y,
+                                                                          incy,
+                                                                          A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyr2_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       const hipblasComplex* y,
+                                       int64_t               incy,
+                                       hipblasComplex*       A,
+                                       int64_t               lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsyr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)y,
+                                                                          incy,
+                                                                          (cuComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyr2_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       const hipblasDoubleComplex* y,
+                                       int64_t                     incy,
+                                       hipblasDoubleComplex*       A,
+                                       int64_t                     lda)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZsyr2_64((cublasHandle_t)handle,
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)y,
+                                                                          incy,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2Batched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              const float* const y[],
+                                              int64_t            incy,
+                                              float* const       AP[],
+                                              int64_t            lda,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyr2Batched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              const double* const y[],
+                                              int64_t             incy,
+                                              double* const       AP[],
+                                              int64_t             lda,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyr2Batched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              const hipblasComplex* const y[],
+                                              int64_t                     incy,
+                                              hipblasComplex* const       AP[],
+                                              int64_t                     lda,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyr2Batched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              const hipblasDoubleComplex* const y[],
+                                              int64_t                           incy,
+                                              hipblasDoubleComplex* const       AP[],
+                                              int64_t                           lda,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const float*      y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     float*            AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyr2StridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     const double*     y,
+                                                     int64_t           incy,
+                                                     hipblasStride     stridey,
+                                                     double*           AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyr2StridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasStride         stridey,
+                                                     hipblasComplex*       AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyr2StridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasStride               stridey,
+                                                     hipblasDoubleComplex*       AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStbmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  k,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            k,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtbmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  k,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               k,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtbmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  k,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtbmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  k,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            k,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtbmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             k,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtbmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     k,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtbmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            k,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtbmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            k,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtbmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               k,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtbmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStbsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStbsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  n,
+                                                  k,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtbsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtbsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  n,
+                                                  k,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtbsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtbsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  n,
+                                                  k,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtbsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtbsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  n,
+                                                  k,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStbsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtbsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtbsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtbsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStbsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtbsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtbsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtbsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       float*             x,
+                                       int64_t            incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       double*            x,
+                                       int64_t            incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       AP,
+                                       float*             x,
+                                       int64_t            incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      AP,
+                                       double*            x,
+                                       int64_t            incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* AP,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* AP,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStpsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtpsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtpsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtpsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStrmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtrmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtrmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtrmv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrmvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrmvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrmvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrmvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrmvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrmvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       float*             x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStrsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsv_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            x,
+                                       int64_t            incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtrsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  A,
+                                                  lda,
+                                                  x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsv_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       hipblasComplex*       x,
+                                       int64_t               incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtrsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsv_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       x,
+                                       int64_t                     incx)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtrsv_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)x,
+                                                  incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsvBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              float* const       x[],
+                                              int64_t            incx,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrsvBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              double* const       x[],
+                                              int64_t             incx,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrsvBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       x[],
+                                              int64_t                     incx,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrsvBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       x[],
+                                              int64_t                           incx,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrsvStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrsvStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrsvStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemm_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       B,
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float*             C,
+                                       int64_t            ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgemm_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  beta,
+                                                  C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgemm_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  beta,
+                                                  C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const A[],
+                                              int64_t            lda,
+                                              const float* const B[],
+                                              int64_t            ldb,
+                                              const float*       beta,
+                                              float* const       C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgemmBatched_64((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(transa),
+                                                         hipOperationToCudaOperation(transb),
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  transa,
+                                              hipblasOperation_t  transb,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const A[],
+                                              int64_t             lda,
+                                              const double* const B[],
+                                              int64_t             ldb,
+                                              const double*       beta,
+                                              double* const       C[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgemmBatched_64((cublasHandle_t)handle,
+                                                         hipOperationToCudaOperation(transa),
+                                                         hipOperationToCudaOperation(transb),
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc,
+                                                         batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int64_t            lda,
+                                                     long long          bsa,
+                                                     const float*       B,
+                                                     int64_t            ldb,
+                                                     long long          bsb,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int64_t            ldc,
+                                                     long long          bsc,
+                                                     int64_t            batchCount)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched_64((cublasHandle_t)handle,
+                                                                hipOperationToCudaOperation(transa),
+                                                                hipOperationToCudaOperation(transb),
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                alpha,
+                                                                const_cast<float*>(A),
+                                                                lda,
+                                                                bsa,
+                                                                const_cast<float*>(B),
+                                                                ldb,
+                                                                bsb,
+                                                                beta,
+                                                                C,
+                                                                ldc,
+                                                                bsc,
+                                                                batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     long long          bsa,
+                                                     const double*      B,
+                                                     int64_t            ldb,
+                                                     long long          bsb,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int64_t            ldc,
+                                                     long long          bsc,
+                                                     int64_t            batchCount)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched_64((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
                                                                 m,
                                                                 n,
                                                                 k,
-                                                                (cuDoubleComplex*)alpha,
-                                                                (cuDoubleComplex*)(A),
+                                                                alpha,
+                                                                const_cast<double*>(A),
                                                                 lda,
                                                                 bsa,
-                                                                (cuDoubleComplex*)(B),
+                                                                const_cast<double*>(B),
                                                                 ldb,
                                                                 bsb,
-                                                                (cuDoubleComplex*)beta,
-                                                                (cuDoubleComplex*)C,
+                                                                beta,
+                                                                C,
                                                                 ldc,
                                                                 bsc,
                                                                 batchCount));
@@ -11766,1226 +21850,2918 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-// gemm_ex
-hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                              hipblasOperation_t transa,
-                              hipblasOperation_t transb,
-                              int                m,
-                              int                n,
-                              int                k,
-                              const void*        alpha,
-                              const void*        A,
-                              hipblasDatatype_t  a_type,
-                              int                lda,
-                              const void*        B,
-                              hipblasDatatype_t  b_type,
-                              int                ldb,
-                              const void*        beta,
-                              void*              C,
-                              hipblasDatatype_t  c_type,
-                              int                ldc,
-                              hipblasDatatype_t  compute_type,
-                              hipblasGemmAlgo_t  algo)
+hipblasStatus_t hipblasCherk_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const float*          alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const float*          beta,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
-                                                   hipOperationToCudaOperation(transa),
-                                                   hipOperationToCudaOperation(transb),
-                                                   m,
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCherk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (cuComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherk_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const double*               alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const double*               beta,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZherk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (cuDoubleComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const float*                alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const float*                beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherkBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const double*                     alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const double*                     beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCherkStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const float*          alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const float*          beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherkStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const double*               alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const double*               beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCherkx_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int64_t               lda,
+                                        const hipblasComplex* B,
+                                        int64_t               ldb,
+                                        const float*          beta,
+                                        hipblasComplex*       C,
+                                        int64_t               ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCherkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
                                                    n,
                                                    k,
-                                                   alpha,
-                                                   A,
-                                                   HIPDatatypeToCudaDatatype(a_type),
+                                                   (cuComplex*)alpha,
+                                                   (cuComplex*)A,
                                                    lda,
-                                                   B,
-                                                   HIPDatatypeToCudaDatatype(b_type),
+                                                   (cuComplex*)B,
                                                    ldb,
                                                    beta,
-                                                   C,
-                                                   HIPDatatypeToCudaDatatype(c_type),
-                                                   ldc,
-                                                   HIPDatatypeToCudaDatatype(compute_type),
-                                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+                                                   (cuComplex*)C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
-                                 hipblasOperation_t   transa,
-                                 hipblasOperation_t   transb,
-                                 int                  m,
-                                 int                  n,
-                                 int                  k,
-                                 const void*          alpha,
-                                 const void*          A,
-                                 hipDataType          a_type,
-                                 int                  lda,
-                                 const void*          B,
-                                 hipDataType          b_type,
-                                 int                  ldb,
-                                 const void*          beta,
-                                 void*                C,
-                                 hipDataType          c_type,
-                                 int                  ldc,
-                                 hipblasComputeType_t compute_type,
-                                 hipblasGemmAlgo_t    algo)
+hipblasStatus_t hipblasZherkx_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* B,
+                                        int64_t                     ldb,
+                                        const double*               beta,
+                                        hipblasDoubleComplex*       C,
+                                        int64_t                     ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
-                                                   hipOperationToCudaOperation(transa),
-                                                   hipOperationToCudaOperation(transb),
-                                                   m,
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZherkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
                                                    n,
                                                    k,
-                                                   alpha,
-                                                   A,
-                                                   HIPDatatypeToCudaDatatype_v2(a_type),
+                                                   (cuDoubleComplex*)alpha,
+                                                   (cuDoubleComplex*)A,
                                                    lda,
-                                                   B,
-                                                   HIPDatatypeToCudaDatatype_v2(b_type),
+                                                   (cuDoubleComplex*)B,
                                                    ldb,
                                                    beta,
-                                                   C,
-                                                   HIPDatatypeToCudaDatatype_v2(c_type),
-                                                   ldc,
-                                                   HIPComputetypeToCudaComputetype(compute_type),
-                                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+                                                   (cuDoubleComplex*)C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                     hipblasOperation_t transa,
-                                     hipblasOperation_t transb,
-                                     int                m,
-                                     int                n,
-                                     int                k,
-                                     const void*        alpha,
-                                     const void*        A[],
-                                     hipblasDatatype_t  a_type,
-                                     int                lda,
-                                     const void*        B[],
-                                     hipblasDatatype_t  b_type,
-                                     int                ldb,
-                                     const void*        beta,
-                                     void*              C[],
-                                     hipblasDatatype_t  c_type,
-                                     int                ldc,
-                                     int                batch_count,
-                                     hipblasDatatype_t  compute_type,
-                                     hipblasGemmAlgo_t  algo)
+hipblasStatus_t hipblasCherkxBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const float*                beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherkxBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const double*                     beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCherkxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const float*          beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZherkxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const double*               beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCher2k_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int64_t               lda,
+                                        const hipblasComplex* B,
+                                        int64_t               ldb,
+                                        const float*          beta,
+                                        hipblasComplex*       C,
+                                        int64_t               ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
-                                                          hipOperationToCudaOperation(transa),
-                                                          hipOperationToCudaOperation(transb),
-                                                          m,
-                                                          n,
-                                                          k,
-                                                          alpha,
-                                                          A,
-                                                          HIPDatatypeToCudaDatatype(a_type),
-                                                          lda,
-                                                          B,
-                                                          HIPDatatypeToCudaDatatype(b_type),
-                                                          ldb,
-                                                          beta,
-                                                          C,
-                                                          HIPDatatypeToCudaDatatype(c_type),
-                                                          ldc,
-                                                          batch_count,
-                                                          HIPDatatypeToCudaDatatype(compute_type),
-                                                          HIPGemmAlgoToCudaGemmAlgo(algo)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCher2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuComplex*)alpha,
+                                                   (cuComplex*)A,
+                                                   lda,
+                                                   (cuComplex*)B,
+                                                   ldb,
+                                                   beta,
+                                                   (cuComplex*)C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
-                                        hipblasOperation_t   transa,
-                                        hipblasOperation_t   transb,
-                                        int                  m,
-                                        int                  n,
-                                        int                  k,
-                                        const void*          alpha,
-                                        const void*          A[],
-                                        hipDataType          a_type,
-                                        int                  lda,
-                                        const void*          B[],
-                                        hipDataType          b_type,
-                                        int                  ldb,
-                                        const void*          beta,
-                                        void*                C[],
-                                        hipDataType          c_type,
-                                        int                  ldc,
-                                        int                  batch_count,
-                                        hipblasComputeType_t compute_type,
-                                        hipblasGemmAlgo_t    algo)
+hipblasStatus_t hipblasZher2k_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* B,
+                                        int64_t                     ldb,
+                                        const double*               beta,
+                                        hipblasDoubleComplex*       C,
+                                        int64_t                     ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasGemmBatchedEx((cublasHandle_t)handle,
-                            hipOperationToCudaOperation(transa),
-                            hipOperationToCudaOperation(transb),
-                            m,
-                            n,
-                            k,
-                            alpha,
-                            A,
-                            HIPDatatypeToCudaDatatype_v2(a_type),
-                            lda,
-                            B,
-                            HIPDatatypeToCudaDatatype_v2(b_type),
-                            ldb,
-                            beta,
-                            C,
-                            HIPDatatypeToCudaDatatype_v2(c_type),
-                            ldc,
-                            batch_count,
-                            HIPComputetypeToCudaComputetype(compute_type),
-                            HIPGemmAlgoToCudaGemmAlgo(algo)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZher2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuDoubleComplex*)alpha,
+                                                   (cuDoubleComplex*)A,
+                                                   lda,
+                                                   (cuDoubleComplex*)B,
+                                                   ldb,
+                                                   beta,
+                                                   (cuDoubleComplex*)C,
+                                                   ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCher2kBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const float*                beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZher2kBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const double*                     beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCher2kStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const float*          beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZher2kStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const double*               beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsymm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int64_t           lda,
+                                       const float*      B,
+                                       int64_t           ldb,
+                                       const float*      beta,
+                                       float*            C,
+                                       int64_t           ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSsymm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          B,
+                                                                          ldb,
+                                                                          beta,
+                                                                          C,
+                                                                          ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       hipblasFillMode_t uplo,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int64_t           lda,
+                                       const double*     B,
+                                       int64_t           ldb,
+                                       const double*     beta,
+                                       double*           C,
+                                       int64_t           ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDsymm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          A,
+                                                                          lda,
+                                                                          B,
+                                                                          ldb,
+                                                                          beta,
+                                                                          C,
+                                                                          ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const void*        alpha,
-                                            const void*        A,
-                                            hipblasDatatype_t  a_type,
-                                            int                lda,
-                                            hipblasStride      stride_A,
-                                            const void*        B,
-                                            hipblasDatatype_t  b_type,
-                                            int                ldb,
-                                            hipblasStride      stride_B,
-                                            const void*        beta,
-                                            void*              C,
-                                            hipblasDatatype_t  c_type,
-                                            int                ldc,
-                                            hipblasStride      stride_C,
-                                            int                batch_count,
-                                            hipblasDatatype_t  compute_type,
-                                            hipblasGemmAlgo_t  algo)
+hipblasStatus_t hipblasCsymm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* B,
+                                       int64_t               ldb,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
-                                   hipOperationToCudaOperation(transa),
-                                   hipOperationToCudaOperation(transb),
-                                   m,
-                                   n,
-                                   k,
-                                   alpha,
-                                   A,
-                                   HIPDatatypeToCudaDatatype(a_type),
-                                   lda,
-                                   stride_A,
-                                   B,
-                                   HIPDatatypeToCudaDatatype(b_type),
-                                   ldb,
-                                   stride_B,
-                                   beta,
-                                   C,
-                                   HIPDatatypeToCudaDatatype(c_type),
-                                   ldc,
-                                   stride_C,
-                                   batch_count,
-                                   HIPDatatypeToCudaDatatype(compute_type),
-                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCsymm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          m,
+                                                                          n,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)B,
+                                                                          ldb,
+                                                                          (cuComplex*)beta,
+                                                                          (cuComplex*)C,
+                                                                          ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
-                                               hipblasOperation_t   transa,
-                                               hipblasOperation_t   transb,
-                                               int                  m,
-                                               int                  n,
-                                               int                  k,
-                                               const void*          alpha,
-                                               const void*          A,
-                                               hipDataType          a_type,
-                                               int                  lda,
-                                               hipblasStride        stride_A,
-                                               const void*          B,
-                                               hipDataType          b_type,
-                                               int                  ldb,
-                                               hipblasStride        stride_B,
-                                               const void*          beta,
-                                               void*                C,
-                                               hipDataType          c_type,
-                                               int                  ldc,
-                                               hipblasStride        stride_C,
-                                               int                  batch_count,
-                                               hipblasComputeType_t compute_type,
-                                               hipblasGemmAlgo_t    algo)
+hipblasStatus_t hipblasZsymm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* B,
+                                       int64_t                     ldb,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
-                                   hipOperationToCudaOperation(transa),
-                                   hipOperationToCudaOperation(transb),
-                                   m,
-                                   n,
-                                   k,
-                                   alpha,
-                                   A,
-                                   HIPDatatypeToCudaDatatype_v2(a_type),
-                                   lda,
-                                   stride_A,
-                                   B,
-                                   HIPDatatypeToCudaDatatype_v2(b_type),
-                                   ldb,
-                                   stride_B,
-                                   beta,
-                                   C,
-                                   HIPDatatypeToCudaDatatype_v2(c_type),
-                                   ldc,
-                                   stride_C,
-                                   batch_count,
-                                   HIPComputetypeToCudaComputetype(compute_type),
-                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZsymm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          m,
+                                                                          n,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)B,
+                                                                          ldb,
+                                                                          (cuDoubleComplex*)beta,
+                                                                          (cuDoubleComplex*)C,
+                                                                          ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-// trsm_ex
-hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
-                              hipblasSideMode_t  side,
-                              hipblasFillMode_t  uplo,
-                              hipblasOperation_t transA,
-                              hipblasDiagType_t  diag,
-                              int                m,
-                              int                n,
-                              const void*        alpha,
-                              void*              A,
-                              int                lda,
-                              void*              B,
-                              int                ldb,
-                              const void*        invA,
-                              int                invA_size,
-                              hipblasDatatype_t  compute_type)
+hipblasStatus_t hipblasSsymmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const BP[],
+                                              int64_t            ldb,
+                                              const float*       beta,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsymmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const BP[],
+                                              int64_t             ldb,
+                                              const double*       beta,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsymmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsymmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsymmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const float*      alpha,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      BP,
+                                                     int64_t           ldb,
+                                                     hipblasStride     strideB,
+                                                     const float*      beta,
+                                                     float*            CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsymmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     hipblasFillMode_t uplo,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const double*     alpha,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     BP,
+                                                     int64_t           ldb,
+                                                     hipblasStride     strideB,
+                                                     const double*     beta,
+                                                     double*           CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsymmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsymmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyrk_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       float*             C,
+                                       int64_t            ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSsyrk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  beta,
+                                                  C,
+                                                  ldc));
 }
-
-hipblasStatus_t hipblasTrsmEx_v2(hipblasHandle_t    handle,
-                                 hipblasSideMode_t  side,
-                                 hipblasFillMode_t  uplo,
-                                 hipblasOperation_t transA,
-                                 hipblasDiagType_t  diag,
-                                 int                m,
-                                 int                n,
-                                 const void*        alpha,
-                                 void*              A,
-                                 int                lda,
-                                 void*              B,
-                                 int                ldb,
-                                 const void*        invA,
-                                 int                invA_size,
-                                 hipDataType        compute_type)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
-                                     hipblasSideMode_t  side,
-                                     hipblasFillMode_t  uplo,
-                                     hipblasOperation_t transA,
-                                     hipblasDiagType_t  diag,
-                                     int                m,
-                                     int                n,
-                                     const void*        alpha,
-                                     void*              A,
-                                     int                lda,
-                                     void*              B,
-                                     int                ldb,
-                                     int                batch_count,
-                                     const void*        invA,
-                                     int                invA_size,
-                                     hipblasDatatype_t  compute_type)
+hipblasStatus_t hipblasDsyrk_64Backend(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDsyrk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  beta,
+                                                  C,
+                                                  ldc));
 }
-
-hipblasStatus_t hipblasTrsmBatchedEx_v2(hipblasHandle_t    handle,
-                                        hipblasSideMode_t  side,
-                                        hipblasFillMode_t  uplo,
-                                        hipblasOperation_t transA,
-                                        hipblasDiagType_t  diag,
-                                        int                m,
-                                        int                n,
-                                        const void*        alpha,
-                                        void*              A,
-                                        int                lda,
-                                        void*              B,
-                                        int                ldb,
-                                        int                batch_count,
-                                        const void*        invA,
-                                        int                invA_size,
-                                        hipDataType        compute_type)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
-                                            hipblasSideMode_t  side,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            int                n,
-                                            const void*        alpha,
-                                            void*              A,
-                                            int                lda,
-                                            hipblasStride      stride_A,
-                                            void*              B,
-                                            int                ldb,
-                                            hipblasStride      stride_B,
-                                            int                batch_count,
-                                            const void*        invA,
-                                            int                invA_size,
-                                            hipblasStride      stride_invA,
-                                            hipblasDatatype_t  compute_type)
+hipblasStatus_t hipblasCsyrk_64Backend(hipblasHandle_t       handle,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCsyrk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)beta,
+                                                  (cuComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasTrsmStridedBatchedEx_v2(hipblasHandle_t    handle,
-                                               hipblasSideMode_t  side,
-                                               hipblasFillMode_t  uplo,
-                                               hipblasOperation_t transA,
-                                               hipblasDiagType_t  diag,
-                                               int                m,
-                                               int                n,
-                                               const void*        alpha,
-                                               void*              A,
-                                               int                lda,
-                                               hipblasStride      stride_A,
-                                               void*              B,
-                                               int                ldb,
-                                               hipblasStride      stride_B,
-                                               int                batch_count,
-                                               const void*        invA,
-                                               int                invA_size,
-                                               hipblasStride      stride_invA,
-                                               hipDataType        compute_type)
+hipblasStatus_t hipblasZsyrk_64Backend(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZsyrk_64((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)beta,
+                                                  (cuDoubleComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float*       beta,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrkBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              int64_t             n,
+                                              int64_t             k,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double*       beta,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrkBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// // syrk_ex
-// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
-//                                           hipblasFillMode_t     uplo,
-//                                           hipblasOperation_t    trans,
-//                                           int                   n,
-//                                           int                   k,
-//                                           const hipblasComplex* alpha,
-//                                           const void*           A,
-//                                           hipblasDatatype_t     Atype,
-//                                           int                   lda,
-//                                           const hipblasComplex* beta,
-//                                           hipblasComplex*       C,
-//                                           hipblasDatatype_t     Ctype,
-//                                           int                   ldc)
-// try
-//{
-//     return hipCUBLASStatusToHIPStatus(cublasCsyrkEx((cublasHandle_t)handle,
-//                                                     hipFillToCudaFill(uplo),
-//                                                     hipOperationToCudaOperation(trans),
-//                                                     n,
-//                                                     k,
-//                                                     (cuComplex*)alpha,
-//                                                     A,
-//                                                     HIPDatatypeToCudaDatatype(Atype),
-//                                                     lda,
-//                                                     (cuComplex*)beta,
-//                                                     (cuComplex*)C,
-//                                                     HIPDatatypeToCudaDatatype(Ctype),
-//                                                     ldc));
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
+hipblasStatus_t hipblasZsyrkBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
 
-// // herk_ex
-// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
-//                                           hipblasFillMode_t  uplo,
-//                                           hipblasOperation_t trans,
-//                                           int                n,
-//                                           int                k,
-//                                           const float*       alpha,
-//                                           const void*        A,
-//                                           hipblasDatatype_t  Atype,
-//                                           int                lda,
-//                                           const float*       beta,
-//                                           hipblasComplex*    C,
-//                                           hipblasDatatype_t  Ctype,
-//                                           int                ldc)
-// try
-// {
-//     return hipCUBLASStatusToHIPStatus(cublasCherkEx((cublasHandle_t)handle,
-//                                                     hipFillToCudaFill(uplo),
-//                                                     hipOperationToCudaOperation(trans),
-//                                                     n,
-//                                                     k,
-//                                                     alpha,
-//                                                     A,
-//                                                     HIPDatatypeToCudaDatatype(Atype),
-//                                                     lda,
-//                                                     beta,
-//                                                     (cuComplex*)C,
-//                                                     HIPDatatypeToCudaDatatype(Ctype),
-//                                                     ldc));
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
+hipblasStatus_t hipblasSsyrkStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       beta,
+                                                     float*             CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
 
-// axpy_ex
-hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
-                              int               n,
-                              const void*       alpha,
-                              hipblasDatatype_t alphaType,
-                              const void*       x,
-                              hipblasDatatype_t xType,
-                              int               incx,
-                              void*             y,
-                              hipblasDatatype_t yType,
-                              int               incy,
-                              hipblasDatatype_t executionType)
+hipblasStatus_t hipblasDsyrkStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      beta,
+                                                     double*            CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrkStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrkStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyr2k_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float*       A,
+                                        int64_t            lda,
+                                        const float*       B,
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float*             C,
+                                        int64_t            ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSsyr2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
                                                    n,
+                                                   k,
                                                    alpha,
-                                                   HIPDatatypeToCudaDatatype(alphaType),
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToCudaDatatype(yType),
-                                                   incy,
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
-                                 int             n,
-                                 const void*     alpha,
-                                 hipDataType     alphaType,
-                                 const void*     x,
-                                 hipDataType     xType,
-                                 int             incx,
-                                 void*           y,
-                                 hipDataType     yType,
-                                 int             incy,
-                                 hipDataType     executionType)
+hipblasStatus_t hipblasDsyr2k_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const double*      alpha,
+                                        const double*      A,
+                                        int64_t            lda,
+                                        const double*      B,
+                                        int64_t            ldb,
+                                        const double*      beta,
+                                        double*            C,
+                                        int64_t            ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDsyr2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
                                                    n,
+                                                   k,
                                                    alpha,
-                                                   HIPDatatypeToCudaDatatype_v2(alphaType),
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype_v2(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToCudaDatatype_v2(yType),
-                                                   incy,
-                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
-                                     int               n,
-                                     const void*       alpha,
-                                     hipblasDatatype_t alphaType,
-                                     const void*       x,
-                                     hipblasDatatype_t xType,
-                                     int               incx,
-                                     void*             y,
-                                     hipblasDatatype_t yType,
-                                     int               incy,
-                                     int               batch_count,
-                                     hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCsyr2k_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int64_t               lda,
+                                        const hipblasComplex* B,
+                                        int64_t               ldb,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       C,
+                                        int64_t               ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCsyr2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuComplex*)alpha,
+                                                   (cuComplex*)A,
+                                                   lda,
+                                                   (cuComplex*)B,
+                                                   ldb,
+                                                   (cuComplex*)beta,
+                                                   (cuComplex*)C,
+                                                   ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
-                                        int             n,
-                                        const void*     alpha,
-                                        hipDataType     alphaType,
-                                        const void*     x,
-                                        hipDataType     xType,
-                                        int             incx,
-                                        void*           y,
-                                        hipDataType     yType,
-                                        int             incy,
-                                        int             batch_count,
-                                        hipDataType     executionType)
+hipblasStatus_t hipblasZsyr2k_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* B,
+                                        int64_t                     ldb,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       C,
+                                        int64_t                     ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZsyr2k_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuDoubleComplex*)alpha,
+                                                   (cuDoubleComplex*)A,
+                                                   lda,
+                                                   (cuDoubleComplex*)B,
+                                                   ldb,
+                                                   (cuDoubleComplex*)beta,
+                                                   (cuDoubleComplex*)C,
+                                                   ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyr2kBatched_64Backend(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               int64_t            lda,
+                                               const float* const BP[],
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float* const       CP[],
+                                               int64_t            ldc,
+                                               int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyr2kBatched_64Backend(hipblasHandle_t     handle,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               int64_t             n,
+                                               int64_t             k,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               int64_t             lda,
+                                               const double* const BP[],
+                                               int64_t             ldb,
+                                               const double*       beta,
+                                               double* const       CP[],
+                                               int64_t             ldc,
+                                               int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyr2kBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const hipblasComplex*       beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyr2kBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const hipblasDoubleComplex*       beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyr2kStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const float*       BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const float*       beta,
+                                                      float*             CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyr2kStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const double*      BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const double*      beta,
+                                                      double*            CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyr2kStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const hipblasComplex* beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyr2kStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyrkx_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const float*       alpha,
+                                        const float*       A,
+                                        int64_t            lda,
+                                        const float*       B,
+                                        int64_t            ldb,
+                                        const float*       beta,
+                                        float*             C,
+                                        int64_t            ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSsyrkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkx_64Backend(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const double*      alpha,
+                                        const double*      A,
+                                        int64_t            lda,
+                                        const double*      B,
+                                        int64_t            ldb,
+                                        const double*      beta,
+                                        double*            C,
+                                        int64_t            ldc)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDsyrkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
-                                            int               n,
-                                            const void*       alpha,
-                                            hipblasDatatype_t alphaType,
-                                            const void*       x,
-                                            hipblasDatatype_t xType,
-                                            int               incx,
-                                            hipblasStride     stridex,
-                                            void*             y,
-                                            hipblasDatatype_t yType,
-                                            int               incy,
-                                            hipblasStride     stridey,
-                                            int               batch_count,
-                                            hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCsyrkx_64Backend(hipblasHandle_t       handle,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int64_t               lda,
+                                        const hipblasComplex* B,
+                                        int64_t               ldb,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       C,
+                                        int64_t               ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCsyrkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuComplex*)alpha,
+                                                   (cuComplex*)A,
+                                                   lda,
+                                                   (cuComplex*)B,
+                                                   ldb,
+                                                   (cuComplex*)beta,
+                                                   (cuComplex*)C,
+                                                   ldc));
 }
-
-hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t handle,
-                                               int             n,
-                                               const void*     alpha,
-                                               hipDataType     alphaType,
-                                               const void*     x,
-                                               hipDataType     xType,
-                                               int             incx,
-                                               hipblasStride   stridex,
-                                               void*           y,
-                                               hipDataType     yType,
-                                               int             incy,
-                                               hipblasStride   stridey,
-                                               int             batch_count,
-                                               hipDataType     executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-// dot_ex
-hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
-                             int               n,
-                             const void*       x,
-                             hipblasDatatype_t xType,
-                             int               incx,
-                             const void*       y,
-                             hipblasDatatype_t yType,
-                             int               incy,
-                             void*             result,
-                             hipblasDatatype_t resultType,
-                             hipblasDatatype_t executionType)
+hipblasStatus_t hipblasZsyrkx_64Backend(hipblasHandle_t             handle,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        int64_t                     n,
+                                        int64_t                     k,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int64_t                     lda,
+                                        const hipblasDoubleComplex* B,
+                                        int64_t                     ldb,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       C,
+                                        int64_t                     ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
-                                                  n,
-                                                  x,
-                                                  HIPDatatypeToCudaDatatype(xType),
-                                                  incx,
-                                                  y,
-                                                  HIPDatatypeToCudaDatatype(yType),
-                                                  incy,
-                                                  result,
-                                                  HIPDatatypeToCudaDatatype(resultType),
-                                                  HIPDatatypeToCudaDatatype(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZsyrkx_64((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   hipOperationToCudaOperation(transA),
+                                                   n,
+                                                   k,
+                                                   (cuDoubleComplex*)alpha,
+                                                   (cuDoubleComplex*)A,
+                                                   lda,
+                                                   (cuDoubleComplex*)B,
+                                                   ldb,
+                                                   (cuDoubleComplex*)beta,
+                                                   (cuDoubleComplex*)C,
+                                                   ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
-                                int             n,
-                                const void*     x,
-                                hipDataType     xType,
-                                int             incx,
-                                const void*     y,
-                                hipDataType     yType,
-                                int             incy,
-                                void*           result,
-                                hipDataType     resultType,
-                                hipDataType     executionType)
+hipblasStatus_t hipblasSsyrkxBatched_64Backend(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               int64_t            lda,
+                                               const float* const BP[],
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float* const       CP[],
+                                               int64_t            ldc,
+                                               int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrkxBatched_64Backend(hipblasHandle_t     handle,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               int64_t             n,
+                                               int64_t             k,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               int64_t             lda,
+                                               const double* const BP[],
+                                               int64_t             ldb,
+                                               const double*       beta,
+                                               double* const       CP[],
+                                               int64_t             ldc,
+                                               int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrkxBatched_64Backend(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               int64_t                     lda,
+                                               const hipblasComplex* const BP[],
+                                               int64_t                     ldb,
+                                               const hipblasComplex*       beta,
+                                               hipblasComplex* const       CP[],
+                                               int64_t                     ldc,
+                                               int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrkxBatched_64Backend(hipblasHandle_t                   handle,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               int64_t                           n,
+                                               int64_t                           k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               int64_t                           lda,
+                                               const hipblasDoubleComplex* const BP[],
+                                               int64_t                           ldb,
+                                               const hipblasDoubleComplex*       beta,
+                                               hipblasDoubleComplex* const       CP[],
+                                               int64_t                           ldc,
+                                               int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyrkxStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const float*       BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const float*       beta,
+                                                      float*             CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrkxStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      int64_t            lda,
+                                                      hipblasStride      strideA,
+                                                      const double*      BP,
+                                                      int64_t            ldb,
+                                                      hipblasStride      strideB,
+                                                      const double*      beta,
+                                                      double*            CP,
+                                                      int64_t            ldc,
+                                                      hipblasStride      strideC,
+                                                      int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrkxStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      int64_t               n,
+                                                      int64_t               k,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      int64_t               lda,
+                                                      hipblasStride         strideA,
+                                                      const hipblasComplex* BP,
+                                                      int64_t               ldb,
+                                                      hipblasStride         strideB,
+                                                      const hipblasComplex* beta,
+                                                      hipblasComplex*       CP,
+                                                      int64_t               ldc,
+                                                      hipblasStride         strideC,
+                                                      int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrkxStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      int64_t                     lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* BP,
+                                                      int64_t                     ldb,
+                                                      hipblasStride               strideB,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       CP,
+                                                      int64_t                     ldc,
+                                                      hipblasStride               strideC,
+                                                      int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgeam_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       beta,
+                                       const float*       B,
+                                       int64_t            ldb,
+                                       float*             C,
+                                       int64_t            ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasSgeam_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
                                                   n,
-                                                  x,
-                                                  HIPDatatypeToCudaDatatype_v2(xType),
-                                                  incx,
-                                                  y,
-                                                  HIPDatatypeToCudaDatatype_v2(yType),
-                                                  incy,
-                                                  result,
-                                                  HIPDatatypeToCudaDatatype_v2(resultType),
-                                                  HIPDatatypeToCudaDatatype_v2(executionType)));
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  beta,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
-                              int               n,
-                              const void*       x,
-                              hipblasDatatype_t xType,
-                              int               incx,
-                              const void*       y,
-                              hipblasDatatype_t yType,
-                              int               incy,
-                              void*             result,
-                              hipblasDatatype_t resultType,
-                              hipblasDatatype_t executionType)
+hipblasStatus_t hipblasDgeam_64Backend(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      beta,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       double*            C,
+                                       int64_t            ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToCudaDatatype(yType),
-                                                   incy,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype(resultType),
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDgeam_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  beta,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
-                                 int             n,
-                                 const void*     x,
-                                 hipDataType     xType,
-                                 int             incx,
-                                 const void*     y,
-                                 hipDataType     yType,
-                                 int             incy,
-                                 void*           result,
-                                 hipDataType     resultType,
-                                 hipDataType     executionType)
+hipblasStatus_t hipblasCgeam_64Backend(hipblasHandle_t       handle,
+                                       hipblasOperation_t    transa,
+                                       hipblasOperation_t    transb,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* beta,
+                                       const hipblasComplex* B,
+                                       int64_t               ldb,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype_v2(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToCudaDatatype_v2(yType),
-                                                   incy,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype_v2(resultType),
-                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCgeam_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)beta,
+                                                  (cuComplex*)B,
+                                                  ldb,
+                                                  (cuComplex*)C,
+                                                  ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
-                                    int               n,
-                                    const void*       x,
-                                    hipblasDatatype_t xType,
-                                    int               incx,
-                                    const void*       y,
-                                    hipblasDatatype_t yType,
-                                    int               incy,
-                                    int               batch_count,
-                                    void*             result,
-                                    hipblasDatatype_t resultType,
-                                    hipblasDatatype_t executionType)
+hipblasStatus_t hipblasZgeam_64Backend(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transa,
+                                       hipblasOperation_t          transb,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* beta,
+                                       const hipblasDoubleComplex* B,
+                                       int64_t                     ldb,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZgeam_64((cublasHandle_t)handle,
+                                                  hipOperationToCudaOperation(transa),
+                                                  hipOperationToCudaOperation(transb),
+                                                  m,
+                                                  n,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)beta,
+                                                  (cuDoubleComplex*)B,
+                                                  ldb,
+                                                  (cuDoubleComplex*)C,
+                                                  ldc));
 }
-
-hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
-                                       int             n,
-                                       const void*     x,
-                                       hipDataType     xType,
-                                       int             incx,
-                                       const void*     y,
-                                       hipDataType     yType,
-                                       int             incy,
-                                       int             batch_count,
-                                       void*           result,
-                                       hipDataType     resultType,
-                                       hipDataType     executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
-                                     int               n,
-                                     const void*       x,
-                                     hipblasDatatype_t xType,
-                                     int               incx,
-                                     const void*       y,
-                                     hipblasDatatype_t yType,
-                                     int               incy,
-                                     int               batch_count,
-                                     void*             result,
-                                     hipblasDatatype_t resultType,
-                                     hipblasDatatype_t executionType)
+hipblasStatus_t hipblasSgeamBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float*       beta,
+                                              const float* const BP[],
+                                              int64_t            ldb,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgeamBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasOperation_t  transA,
+                                              hipblasOperation_t  transB,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double*       beta,
+                                              const double* const BP[],
+                                              int64_t             ldb,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeamBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex*       beta,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeamBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                transA,
+                                              hipblasOperation_t                transB,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex*       beta,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgeamStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       beta,
+                                                     const float*       BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     float*             CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgeamStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      beta,
+                                                     const double*      BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     double*            CP,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeamStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasOperation_t    transB,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* beta,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeamStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* beta,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChemm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       int64_t               n,
+                                       int64_t               k,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* B,
+                                       int64_t               ldb,
+                                       const hipblasComplex* beta,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasChemm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          (cuComplex*)alpha,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)B,
+                                                                          ldb,
+                                                                          (cuComplex*)beta,
+                                                                          (cuComplex*)C,
+                                                                          ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
-                                        int             n,
-                                        const void*     x,
-                                        hipDataType     xType,
-                                        int             incx,
-                                        const void*     y,
-                                        hipDataType     yType,
-                                        int             incy,
-                                        int             batch_count,
-                                        void*           result,
-                                        hipDataType     resultType,
-                                        hipDataType     executionType)
+hipblasStatus_t hipblasZhemm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* B,
+                                       int64_t                     ldb,
+                                       const hipblasDoubleComplex* beta,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZhemm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          hipFillToCudaFill(uplo),
+                                                                          n,
+                                                                          k,
+                                                                          (cuDoubleComplex*)alpha,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)B,
+                                                                          ldb,
+                                                                          (cuDoubleComplex*)beta,
+                                                                          (cuDoubleComplex*)C,
+                                                                          ldc));
 }
-
-hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
-                                           int               n,
-                                           const void*       x,
-                                           hipblasDatatype_t xType,
-                                           int               incx,
-                                           hipblasStride     stridex,
-                                           const void*       y,
-                                           hipblasDatatype_t yType,
-                                           int               incy,
-                                           hipblasStride     stridey,
-                                           int               batch_count,
-                                           void*             result,
-                                           hipblasDatatype_t resultType,
-                                           hipblasDatatype_t executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t handle,
-                                              int             n,
-                                              const void*     x,
-                                              hipDataType     xType,
-                                              int             incx,
-                                              hipblasStride   stridex,
-                                              const void*     y,
-                                              hipDataType     yType,
-                                              int             incy,
-                                              hipblasStride   stridey,
-                                              int             batch_count,
-                                              void*           result,
-                                              hipDataType     resultType,
-                                              hipDataType     executionType)
+hipblasStatus_t hipblasChemmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const BP[],
+                                              int64_t                     ldb,
+                                              const hipblasComplex*       beta,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhemmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              int64_t                           n,
+                                              int64_t                           k,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const BP[],
+                                              int64_t                           ldb,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasChemmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     int64_t               n,
+                                                     int64_t               k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZhemmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrmm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       const float*       B,
+                                       int64_t            ldb,
+                                       float*             C,
+                                       int64_t            ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStrmm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc));
 }
-
-hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
-                                            int               n,
-                                            const void*       x,
-                                            hipblasDatatype_t xType,
-                                            int               incx,
-                                            hipblasStride     stridex,
-                                            const void*       y,
-                                            hipblasDatatype_t yType,
-                                            int               incy,
-                                            hipblasStride     stridey,
-                                            int               batch_count,
-                                            void*             result,
-                                            hipblasDatatype_t resultType,
-                                            hipblasDatatype_t executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t handle,
-                                               int             n,
-                                               const void*     x,
-                                               hipDataType     xType,
-                                               int             incx,
-                                               hipblasStride   stridex,
-                                               const void*     y,
-                                               hipDataType     yType,
-                                               int             incy,
-                                               hipblasStride   stridey,
-                                               int             batch_count,
-                                               void*           result,
-                                               hipDataType     resultType,
-                                               hipDataType     executionType)
+hipblasStatus_t hipblasDtrmm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       double*            C,
+                                       int64_t            ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtrmm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-// nrm2_ex
-hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
-                              int               n,
-                              const void*       x,
-                              hipblasDatatype_t xType,
-                              int               incx,
-                              void*             result,
-                              hipblasDatatype_t resultType,
-                              hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCtrmm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* B,
+                                       int64_t               ldb,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype(resultType),
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtrmm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)B,
+                                                  ldb,
+                                                  (cuComplex*)C,
+                                                  ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
-                                 int             n,
-                                 const void*     x,
-                                 hipDataType     xType,
-                                 int             incx,
-                                 void*           result,
-                                 hipDataType     resultType,
-                                 hipDataType     executionType)
+hipblasStatus_t hipblasZtrmm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* B,
+                                       int64_t                     ldb,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype_v2(xType),
-                                                   incx,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype_v2(resultType),
-                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtrmm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)B,
+                                                  ldb,
+                                                  (cuDoubleComplex*)C,
+                                                  ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
-                                     int               n,
-                                     const void*       x,
-                                     hipblasDatatype_t xType,
-                                     int               incx,
-                                     int               batch_count,
-                                     void*             result,
-                                     hipblasDatatype_t resultType,
-                                     hipblasDatatype_t executionType)
+hipblasStatus_t hipblasStrmmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const A[],
+                                              int64_t            lda,
+                                              const float* const B[],
+                                              int64_t            ldb,
+                                              float* const       C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrmmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const A[],
+                                              int64_t             lda,
+                                              const double* const B[],
+                                              int64_t             ldb,
+                                              double* const       C[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrmmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const A[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const B[],
+                                              int64_t                     ldb,
+                                              hipblasComplex* const       C[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrmmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const A[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const B[],
+                                              int64_t                           ldb,
+                                              hipblasDoubleComplex* const       C[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrmmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const float*       B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     float*             C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrmmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     double*            C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrmmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* B,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     hipblasComplex*       C,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrmmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* B,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrsm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float*       A,
+                                       int64_t            lda,
+                                       float*             B,
+                                       int64_t            ldb)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStrsm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
-                                        int             n,
-                                        const void*     x,
-                                        hipDataType     xType,
-                                        int             incx,
-                                        int             batch_count,
-                                        void*           result,
-                                        hipDataType     resultType,
-                                        hipDataType     executionType)
+hipblasStatus_t hipblasDtrsm_64Backend(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       double*            B,
+                                       int64_t            ldb)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtrsm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
-                                            int               n,
-                                            const void*       x,
-                                            hipblasDatatype_t xType,
-                                            int               incx,
-                                            hipblasStride     stridex,
-                                            int               batch_count,
-                                            void*             result,
-                                            hipblasDatatype_t resultType,
-                                            hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCtrsm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       hipblasComplex*       B,
+                                       int64_t               ldb)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtrsm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  (cuComplex*)alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  (cuComplex*)B,
+                                                  ldb));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t handle,
-                                               int             n,
-                                               const void*     x,
-                                               hipDataType     xType,
-                                               int             incx,
-                                               hipblasStride   stridex,
-                                               int             batch_count,
-                                               void*           result,
-                                               hipDataType     resultType,
-                                               hipDataType     executionType)
+hipblasStatus_t hipblasZtrsm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       hipblasDoubleComplex*       B,
+                                       int64_t                     ldb)
+try
+{
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtrsm_64((cublasHandle_t)handle,
+                                                  hipSideToCudaSide(side),
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  hipDiagonalToCudaDiagonal(diag),
+                                                  m,
+                                                  n,
+                                                  (cuDoubleComplex*)alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  (cuDoubleComplex*)B,
+                                                  ldb));
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-// rot_ex
-hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
-                             int               n,
-                             void*             x,
-                             hipblasDatatype_t xType,
-                             int               incx,
-                             void*             y,
-                             hipblasDatatype_t yType,
-                             int               incy,
-                             const void*       c,
-                             const void*       s,
-                             hipblasDatatype_t csType,
-                             hipblasDatatype_t executionType)
+hipblasStatus_t hipblasStrsmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float* const A[],
+                                              int64_t            lda,
+                                              float* const       B[],
+                                              int64_t            ldb,
+                                              int64_t            batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
-                                                  n,
-                                                  x,
-                                                  HIPDatatypeToCudaDatatype(xType),
-                                                  incx,
-                                                  y,
-                                                  HIPDatatypeToCudaDatatype(yType),
-                                                  incy,
-                                                  c,
-                                                  s,
-                                                  HIPDatatypeToCudaDatatype(csType),
-                                                  HIPDatatypeToCudaDatatype(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasStrsmBatched_64((cublasHandle_t)handle,
+                                                         hipSideToCudaSide(side),
+                                                         hipFillToCudaFill(uplo),
+                                                         hipOperationToCudaOperation(transA),
+                                                         hipDiagonalToCudaDiagonal(diag),
+                                                         m,
+                                                         n,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
-                                int             n,
-                                void*           x,
-                                hipDataType     xType,
-                                int             incx,
-                                void*           y,
-                                hipDataType     yType,
-                                int             incy,
-                                const void*     c,
-                                const void*     s,
-                                hipDataType     csType,
-                                hipDataType     executionType)
+hipblasStatus_t hipblasDtrsmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              hipblasFillMode_t   uplo,
+                                              hipblasOperation_t  transA,
+                                              hipblasDiagType_t   diag,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double*       alpha,
+                                              const double* const A[],
+                                              int64_t             lda,
+                                              double* const       B[],
+                                              int64_t             ldb,
+                                              int64_t             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
-                                                  n,
-                                                  x,
-                                                  HIPDatatypeToCudaDatatype_v2(xType),
-                                                  incx,
-                                                  y,
-                                                  HIPDatatypeToCudaDatatype_v2(yType),
-                                                  incy,
-                                                  c,
-                                                  s,
-                                                  HIPDatatypeToCudaDatatype_v2(csType),
-                                                  HIPDatatypeToCudaDatatype_v2(executionType)));
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasDtrsmBatched_64((cublasHandle_t)handle,
+                                                         hipSideToCudaSide(side),
+                                                         hipFillToCudaFill(uplo),
+                                                         hipOperationToCudaOperation(transA),
+                                                         hipDiagonalToCudaDiagonal(diag),
+                                                         m,
+                                                         n,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         B,
+                                                         ldb,
+                                                         batch_count));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
-                                    int               n,
-                                    void*             x,
-                                    hipblasDatatype_t xType,
-                                    int               incx,
-                                    void*             y,
-                                    hipblasDatatype_t yType,
-                                    int               incy,
-                                    const void*       c,
-                                    const void*       s,
-                                    hipblasDatatype_t csType,
-                                    int               batch_count,
-                                    hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCtrsmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex*       alpha,
+                                              const hipblasComplex* const A[],
+                                              int64_t                     lda,
+                                              hipblasComplex* const       B[],
+                                              int64_t                     ldb,
+                                              int64_t                     batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasCtrsmBatched_64((cublasHandle_t)handle,
+                                                         hipSideToCudaSide(side),
+                                                         hipFillToCudaFill(uplo),
+                                                         hipOperationToCudaOperation(transA),
+                                                         hipDiagonalToCudaDiagonal(diag),
+                                                         m,
+                                                         n,
+                                                         (cuComplex*)alpha,
+                                                         (cuComplex**)A,
+                                                         lda,
+                                                         (cuComplex**)B,
+                                                         ldb,
+                                                         batch_count));
 }
-
-hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
-                                       int             n,
-                                       void*           x,
-                                       hipDataType     xType,
-                                       int             incx,
-                                       void*           y,
-                                       hipDataType     yType,
-                                       int             incy,
-                                       const void*     c,
-                                       const void*     s,
-                                       hipDataType     csType,
-                                       int             batch_count,
-                                       hipDataType     executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
-                                           int               n,
-                                           void*             x,
-                                           hipblasDatatype_t xType,
-                                           int               incx,
-                                           hipblasStride     stridex,
-                                           void*             y,
-                                           hipblasDatatype_t yType,
-                                           int               incy,
-                                           hipblasStride     stridey,
-                                           const void*       c,
-                                           const void*       s,
-                                           hipblasDatatype_t csType,
-                                           int               batch_count,
-                                           hipblasDatatype_t executionType)
+hipblasStatus_t hipblasZtrsmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              hipblasFillMode_t                 uplo,
+                                              hipblasOperation_t                transA,
+                                              hipblasDiagType_t                 diag,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const A[],
+                                              int64_t                           lda,
+                                              hipblasDoubleComplex* const       B[],
+                                              int64_t                           ldb,
+                                              int64_t                           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(
+        hipCUBLASStatusToHIPStatus(cublasZtrsmBatched_64((cublasHandle_t)handle,
+                                                         hipSideToCudaSide(side),
+                                                         hipFillToCudaFill(uplo),
+                                                         hipOperationToCudaOperation(transA),
+                                                         hipDiagonalToCudaDiagonal(diag),
+                                                         m,
+                                                         n,
+                                                         (cuDoubleComplex*)alpha,
+                                                         (cuDoubleComplex**)A,
+                                                         lda,
+                                                         (cuDoubleComplex**)B,
+                                                         ldb,
+                                                         batch_count));
 }
-
-hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t handle,
-                                              int             n,
-                                              void*           x,
-                                              hipDataType     xType,
-                                              int             incx,
-                                              hipblasStride   stridex,
-                                              void*           y,
-                                              hipDataType     yType,
-                                              int             incy,
-                                              hipblasStride   stridey,
-                                              const void*     c,
-                                              const void*     s,
-                                              hipDataType     csType,
-                                              int             batch_count,
-                                              hipDataType     executionType)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-// scal_ex
-hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
-                              int               n,
-                              const void*       alpha,
-                              hipblasDatatype_t alphaType,
-                              void*             x,
-                              hipblasDatatype_t xType,
-                              int               incx,
-                              hipblasDatatype_t executionType)
+hipblasStatus_t hipblasStrsmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float*       AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     float*             BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrsmStridedBatched_64Backend(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      AP,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     double*            BP,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       BP,
+                                                     int64_t               ldb,
+                                                     hipblasStride         strideB,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       BP,
+                                                     int64_t                     ldb,
+                                                     hipblasStride               strideB,
+                                                     int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSdgmm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const float*      A,
+                                       int64_t           lda,
+                                       const float*      x,
+                                       int64_t           incx,
+                                       float*            C,
+                                       int64_t           ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
-                                                   n,
-                                                   alpha,
-                                                   HIPDatatypeToCudaDatatype(alphaType),
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasSdgmm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          m,
+                                                                          n,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          C,
+                                                                          ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
-                                 int             n,
-                                 const void*     alpha,
-                                 hipDataType     alphaType,
-                                 void*           x,
-                                 hipDataType     xType,
-                                 int             incx,
-                                 hipDataType     executionType)
+hipblasStatus_t hipblasDdgmm_64Backend(hipblasHandle_t   handle,
+                                       hipblasSideMode_t side,
+                                       int64_t           m,
+                                       int64_t           n,
+                                       const double*     A,
+                                       int64_t           lda,
+                                       const double*     x,
+                                       int64_t           incx,
+                                       double*           C,
+                                       int64_t           ldc)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
-                                                   n,
-                                                   alpha,
-                                                   HIPDatatypeToCudaDatatype_v2(alphaType),
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype_v2(xType),
-                                                   incx,
-                                                   HIPDatatypeToCudaDatatype_v2(executionType)));
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasDdgmm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          m,
+                                                                          n,
+                                                                          A,
+                                                                          lda,
+                                                                          x,
+                                                                          incx,
+                                                                          C,
+                                                                          ldc));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
-                                     int               n,
-                                     const void*       alpha,
-                                     hipblasDatatype_t alphaType,
-                                     void*             x,
-                                     hipblasDatatype_t xType,
-                                     int               incx,
-                                     int               batch_count,
-                                     hipblasDatatype_t executionType)
+hipblasStatus_t hipblasCdgmm_64Backend(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       int64_t               m,
+                                       int64_t               n,
+                                       const hipblasComplex* A,
+                                       int64_t               lda,
+                                       const hipblasComplex* x,
+                                       int64_t               incx,
+                                       hipblasComplex*       C,
+                                       int64_t               ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasCdgmm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          m,
+                                                                          n,
+                                                                          (cuComplex*)A,
+                                                                          lda,
+                                                                          (cuComplex*)x,
+                                                                          incx,
+                                                                          (cuComplex*)C,
+                                                                          ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
-                                        int             n,
-                                        const void*     alpha,
-                                        hipDataType     alphaType,
-                                        void*           x,
-                                        hipDataType     xType,
-                                        int             incx,
-                                        int             batch_count,
-                                        hipDataType     executionType)
+hipblasStatus_t hipblasZdgmm_64Backend(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* A,
+                                       int64_t                     lda,
+                                       const hipblasDoubleComplex* x,
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex*       C,
+                                       int64_t                     ldc)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_ILP64_NATIVE(hipCUBLASStatusToHIPStatus(cublasZdgmm_64((cublasHandle_t)handle,
+                                                                          hipSideToCudaSide(side),
+                                                                          m,
+                                                                          n,
+                                                                          (cuDoubleComplex*)A,
+                                                                          lda,
+                                                                          (cuDoubleComplex*)x,
+                                                                          incx,
+                                                                          (cuDoubleComplex*)C,
+                                                                          ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
-                                            int               n,
-                                            const void*       alpha,
-                                            hipblasDatatype_t alphaType,
-                                            void*             x,
-                                            hipblasDatatype_t xType,
-                                            int               incx,
-                                            hipblasStride     stridex,
-                                            int               batch_count,
-                                            hipblasDatatype_t executionType)
+hipblasStatus_t hipblasSdgmmBatched_64Backend(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float* const AP[],
+                                              int64_t            lda,
+                                              const float* const x[],
+                                              int64_t            incx,
+                                              float* const       CP[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t handle,
-                                               int             n,
-                                               const void*     alpha,
-                                               hipDataType     alphaType,
-                                               void*           x,
-                                               hipDataType     xType,
-                                               int             incx,
-                                               hipblasStride   stridex,
-                                               int             batch_count,
-                                               hipDataType     executionType)
+hipblasStatus_t hipblasDdgmmBatched_64Backend(hipblasHandle_t     handle,
+                                              hipblasSideMode_t   side,
+                                              int64_t             m,
+                                              int64_t             n,
+                                              const double* const AP[],
+                                              int64_t             lda,
+                                              const double* const x[],
+                                              int64_t             incx,
+                                              double* const       CP[],
+                                              int64_t             ldc,
+                                              int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdgmmBatched_64Backend(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasComplex* const AP[],
+                                              int64_t                     lda,
+                                              const hipblasComplex* const x[],
+                                              int64_t                     incx,
+                                              hipblasComplex* const       CP[],
+                                              int64_t                     ldc,
+                                              int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdgmmBatched_64Backend(hipblasHandle_t                   handle,
+                                              hipblasSideMode_t                 side,
+                                              int64_t                           m,
+                                              int64_t                           n,
+                                              const hipblasDoubleComplex* const AP[],
+                                              int64_t                           lda,
+                                              const hipblasDoubleComplex* const x[],
+                                              int64_t                           incx,
+                                              hipblasDoubleComplex* const       CP[],
+                                              int64_t                           ldc,
+                                              int64_t                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSdgmmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const float*      AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const float*      x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     float*            CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdgmmStridedBatched_64Backend(hipblasHandle_t   handle,
+                                                     hipblasSideMode_t side,
+                                                     int64_t           m,
+                                                     int64_t           n,
+                                                     const double*     AP,
+                                                     int64_t           lda,
+                                                     hipblasStride     strideA,
+                                                     const double*     x,
+                                                     int64_t           incx,
+                                                     hipblasStride     stridex,
+                                                     double*           CP,
+                                                     int64_t           ldc,
+                                                     hipblasStride     strideC,
+                                                     int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdgmmStridedBatched_64Backend(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* AP,
+                                                     int64_t               lda,
+                                                     hipblasStride         strideA,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasStride         stridex,
+                                                     hipblasComplex*       CP,
+                                                     int64_t               ldc,
+                                                     hipblasStride         strideC,
+                                                     int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdgmmStridedBatched_64Backend(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* AP,
+                                                     int64_t                     lda,
+                                                     hipblasStride               strideA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasStride               stridex,
+                                                     hipblasDoubleComplex*       CP,
+                                                     int64_t                     ldc,
+                                                     hipblasStride               strideC,
+                                                     int64_t                     batchCount)
 {
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }